@@ -8,6 +8,11 @@ DSL_DEFAULT_STREAMMUX_BATCH_TIMEOUT = 4000000
 DSL_DEFAULT_STREAMMUX_WIDTH = 1920
 DSL_DEFAULT_STREAMMUX_HEIGHT = 1080
 
+DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES = 33554432
+
+DSL_DEFAULT_SEGMENT_SINK_WRITE_BUFFER_SIZE = 1048576
+DSL_DEFAULT_SEGMENT_SINK_FSYNC_INTERVAL = 1000
+
 
 DSL_PAD_SINK = 0
 DSL_PAD_SRC = 1
@@ -15,6 +20,42 @@ DSL_PAD_SRC = 1
 DSL_RTP_TCP = 4
 DSL_RTP_ALL = 7
 
+DSL_RTSP_CONNECTION_STATE_IDLE = 0
+DSL_RTSP_CONNECTION_STATE_CONNECTED = 1
+DSL_RTSP_CONNECTION_STATE_RECONNECTING = 2
+
+DSL_TEST_PATTERN_SMPTE = 0
+DSL_TEST_PATTERN_SNOW = 1
+DSL_TEST_PATTERN_BLACK = 2
+DSL_TEST_PATTERN_WHITE = 3
+DSL_TEST_PATTERN_RED = 4
+DSL_TEST_PATTERN_GREEN = 5
+DSL_TEST_PATTERN_BLUE = 6
+DSL_TEST_PATTERN_CHECKERS_1 = 7
+DSL_TEST_PATTERN_CHECKERS_2 = 8
+DSL_TEST_PATTERN_CHECKERS_4 = 9
+DSL_TEST_PATTERN_CHECKERS_8 = 10
+DSL_TEST_PATTERN_CIRCULAR = 11
+DSL_TEST_PATTERN_BLINK = 12
+DSL_TEST_PATTERN_SMPTE75 = 13
+DSL_TEST_PATTERN_ZONE_PLATE = 14
+DSL_TEST_PATTERN_GAMUT = 15
+DSL_TEST_PATTERN_CHROMA_ZONE_PLATE = 16
+DSL_TEST_PATTERN_SOLID_COLOR = 17
+DSL_TEST_PATTERN_BALL = 18
+DSL_TEST_PATTERN_SMPTE100 = 19
+DSL_TEST_PATTERN_BAR = 20
+DSL_TEST_PATTERN_PINWHEEL = 21
+DSL_TEST_PATTERN_SPOKES = 22
+DSL_TEST_PATTERN_GRADIENT = 23
+DSL_TEST_PATTERN_COLORS = 24
+
+DSL_VIDEO_FORMAT_I420 = 0
+DSL_VIDEO_FORMAT_NV12 = 1
+DSL_VIDEO_FORMAT_RGBA = 2
+
+DSL_APP_SOURCE_TIMESTAMP_NONE = int('FFFFFFFFFFFFFFFF',16)
+
 DSL_CUDADEC_MEMTYPE_DEVICE = 0
 DSL_CUDADEC_MEMTYPE_PINNED = 1
 DSL_CUDADEC_MEMTYPE_UNIFIED = 2
@@ -29,6 +70,14 @@ DSL_CODEC_MPEG4 = 2
 DSL_CONTAINER_MP4 = 0
 DSL_CONTAINER_MKV = 1
 
+DSL_META_SINK_MODE_FILE = 0
+DSL_META_SINK_MODE_SOCKET = 1
+
+DSL_META_SINK_FORMAT_VERSION = 1
+
+DSL_THREAD_SCHED_OTHER = 0
+DSL_THREAD_SCHED_FIFO = 1
+
 DSL_STATE_NULL = 1
 DSL_STATE_READY = 2
 DSL_STATE_PAUSED = 3
@@ -54,6 +103,8 @@ DSL_TILER_SHOW_ALL_SOURCES = None
 ## Pointer Typedefs
 ##
 DSL_UINT_P = POINTER(c_uint)
+DSL_UINT64_P = POINTER(c_uint64)
+DSL_INT64_P = POINTER(c_int64)
 DSL_BOOL_P = POINTER(c_bool)
 DSL_WCHAR_PP = POINTER(c_wchar_p)
 DSL_DOUBLE_P = POINTER(c_double)
@@ -65,6 +116,12 @@ DSL_FLOAT_P = POINTER(c_float)
 DSL_META_BATCH_HANDLER = CFUNCTYPE(c_bool, c_void_p, c_void_p)
 DSL_STATE_CHANGE_LISTENER = CFUNCTYPE(None, c_uint, c_uint, c_void_p)
 DSL_EOS_LISTENER = CFUNCTYPE(None, c_void_p)
+DSL_QOS_LISTENER = CFUNCTYPE(None, c_wchar_p, c_uint64, c_uint64, c_int64, c_double, c_void_p)
+DSL_RTSP_CONNECTION_STATE_CHANGE_LISTENER = CFUNCTYPE(None, c_uint, c_uint, c_void_p)
+DSL_SOURCE_APP_NEED_DATA_HANDLER = CFUNCTYPE(None, c_uint, c_void_p)
+DSL_SOURCE_APP_ENOUGH_DATA_HANDLER = CFUNCTYPE(None, c_void_p)
+DSL_SOURCE_APP_BUFFER_RELEASE = CFUNCTYPE(None, c_void_p, c_void_p)
+DSL_SINK_APP_NEW_DATA_HANDLER = CFUNCTYPE(None, c_void_p, c_void_p, c_uint, c_void_p, c_void_p)
 DSL_XWINDOW_KEY_EVENT_HANDLER = CFUNCTYPE(None, c_wchar_p, c_void_p)
 DSL_XWINDOW_BUTTON_EVENT_HANDLER = CFUNCTYPE(None, c_uint, c_uint, c_void_p)
 DSL_XWINDOW_DELETE_EVENT_HANDLER = CFUNCTYPE(None, c_void_p)
@@ -72,6 +129,8 @@ DSL_ODE_HANDLE_OCCURRENCE = CFUNCTYPE(None, c_uint, c_wchar_p, c_void_p, c_void_
 DSL_ODE_CHECK_FOR_OCCURRENCE = CFUNCTYPE(c_bool, c_void_p, c_void_p, c_void_p, c_void_p)
 DSL_ODE_POST_PROCESS_FRAME = CFUNCTYPE(c_bool, c_void_p, c_void_p, c_void_p)
 DSL_RECORD_CLIENT_LISTNER = CFUNCTYPE(c_void_p, c_void_p, c_void_p)
+DSL_RING_RECORD_COMPLETE_LISTENER = CFUNCTYPE(None, c_uint, c_wchar_p, c_bool, c_void_p)
+DSL_GIE_INTERVAL_CHANGE_LISTENER = CFUNCTYPE(None, c_uint, c_uint, c_void_p)
 DSL_PPH_CUSTOM_CLIENT_HANDLER = CFUNCTYPE(c_bool, c_void_p, c_void_p)
 DSL_PPH_METER_CLIENT_HANDLER = CFUNCTYPE(c_bool, DSL_DOUBLE_P, DSL_DOUBLE_P, c_uint, c_void_p)
 ##
@@ -245,6 +304,16 @@ def dsl_ode_action_capture_frame_new(name, outdir, annotate):
     result =_dsl.dsl_ode_action_capture_frame_new(name, outdir, annotate)
     return int(result)
 
+##
+## dsl_ode_action_plugin_new()
+##
+_dsl.dsl_ode_action_plugin_new.argtypes = [c_wchar_p, c_wchar_p, c_wchar_p]
+_dsl.dsl_ode_action_plugin_new.restype = c_uint
+def dsl_ode_action_plugin_new(name, plugin, config):
+    global _dsl
+    result =_dsl.dsl_ode_action_plugin_new(name, plugin, config)
+    return int(result)
+
 ##
 ## dsl_ode_action_capture_object_new()
 ##
@@ -656,6 +725,16 @@ def dsl_ode_trigger_custom_new(name, source, class_id, limit, client_checker, cl
     result = _dsl.dsl_ode_trigger_custom_new(name, source, class_id, limit, checker_cb, processor_cb, client_data)
     return int(result)
 
+##
+## dsl_ode_trigger_plugin_new()
+##
+_dsl.dsl_ode_trigger_plugin_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint, c_wchar_p, c_wchar_p]
+_dsl.dsl_ode_trigger_plugin_new.restype = c_uint
+def dsl_ode_trigger_plugin_new(name, source, class_id, limit, plugin, config):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_plugin_new(name, source, class_id, limit, plugin, config)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_intersection_new()
 ##
@@ -1089,6 +1168,16 @@ def dsl_pph_custom_new(name, client_handler, client_data):
     result =_dsl.dsl_pph_custom_new(name, client_handler_cb, c_client_data)
     return int(result)
 
+##
+## dsl_pph_plugin_new()
+##
+_dsl.dsl_pph_plugin_new.argtypes = [c_wchar_p, c_wchar_p, c_wchar_p]
+_dsl.dsl_pph_plugin_new.restype = c_uint
+def dsl_pph_plugin_new(name, plugin, config):
+    global _dsl
+    result =_dsl.dsl_pph_plugin_new(name, plugin, config)
+    return int(result)
+
 ##
 ## dsl_pph_meter_new()
 ##
@@ -1225,6 +1314,147 @@ def dsl_source_rtsp_new(name, uri, protocol, cudadec_mem_type, intra_decode, dro
     result = _dsl.dsl_source_rtsp_new(name, uri, protocol, cudadec_mem_type, intra_decode, drop_frame_interval, latency)
     return int(result)
 
+##
+## dsl_source_test_new()
+##
+_dsl.dsl_source_test_new.argtypes = [c_wchar_p, c_bool, c_uint, c_uint, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_source_test_new.restype = c_uint
+def dsl_source_test_new(name, is_live, pattern, width, height, fps_n, fps_d, num_frames):
+    global _dsl
+    result = _dsl.dsl_source_test_new(name, is_live, pattern, width, height, fps_n, fps_d, num_frames)
+    return int(result)
+
+##
+## dsl_source_test_pattern_get()
+##
+_dsl.dsl_source_test_pattern_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_source_test_pattern_get.restype = c_uint
+def dsl_source_test_pattern_get(name):
+    global _dsl
+    pattern = c_uint(0)
+    result = _dsl.dsl_source_test_pattern_get(name, DSL_UINT_P(pattern))
+    return int(result), pattern.value
+
+##
+## dsl_source_test_pattern_set()
+##
+_dsl.dsl_source_test_pattern_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_source_test_pattern_set.restype = c_uint
+def dsl_source_test_pattern_set(name, pattern):
+    global _dsl
+    result = _dsl.dsl_source_test_pattern_set(name, pattern)
+    return int(result)
+
+##
+## dsl_source_app_new()
+##
+_dsl.dsl_source_app_new.argtypes = [c_wchar_p, c_bool, c_uint, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_source_app_new.restype = c_uint
+def dsl_source_app_new(name, is_live, format, width, height, fps_n, fps_d):
+    global _dsl
+    result = _dsl.dsl_source_app_new(name, is_live, format, width, height, fps_n, fps_d)
+    return int(result)
+
+##
+## dsl_source_app_data_handlers_add()
+##
+_dsl.dsl_source_app_data_handlers_add.argtypes = [c_wchar_p, 
+    DSL_SOURCE_APP_NEED_DATA_HANDLER, DSL_SOURCE_APP_ENOUGH_DATA_HANDLER, c_void_p]
+_dsl.dsl_source_app_data_handlers_add.restype = c_uint
+def dsl_source_app_data_handlers_add(name, need_data_handler, enough_data_handler, client_data):
+    global _dsl
+    c_need_data_handler = DSL_SOURCE_APP_NEED_DATA_HANDLER(need_data_handler)
+    callbacks.append(c_need_data_handler)
+    c_enough_data_handler = DSL_SOURCE_APP_ENOUGH_DATA_HANDLER(enough_data_handler)
+    callbacks.append(c_enough_data_handler)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    result = _dsl.dsl_source_app_data_handlers_add(name, 
+        c_need_data_handler, c_enough_data_handler, c_client_data)
+    return int(result)
+
+##
+## dsl_source_app_data_handlers_remove()
+##
+_dsl.dsl_source_app_data_handlers_remove.argtypes = [c_wchar_p]
+_dsl.dsl_source_app_data_handlers_remove.restype = c_uint
+def dsl_source_app_data_handlers_remove(name):
+    global _dsl
+    result = _dsl.dsl_source_app_data_handlers_remove(name)
+    return int(result)
+
+##
+## dsl_source_app_buffer_push()
+##
+_dsl.dsl_source_app_buffer_push.argtypes = [c_wchar_p, c_void_p, c_uint, c_uint64, c_uint64,
+    DSL_SOURCE_APP_BUFFER_RELEASE, c_void_p]
+_dsl.dsl_source_app_buffer_push.restype = c_uint
+def dsl_source_app_buffer_push(name, data, size, pts, duration, release, client_data):
+    global _dsl
+    c_release = None
+    c_client_data = None
+    if release is not None:
+        c_release = DSL_SOURCE_APP_BUFFER_RELEASE(release)
+        callbacks.append(c_release)
+        c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    result = _dsl.dsl_source_app_buffer_push(name, data, size, pts, duration, 
+        c_release, c_client_data)
+    return int(result)
+
+##
+## dsl_source_app_eos()
+##
+_dsl.dsl_source_app_eos.argtypes = [c_wchar_p]
+_dsl.dsl_source_app_eos.restype = c_uint
+def dsl_source_app_eos(name):
+    global _dsl
+    result = _dsl.dsl_source_app_eos(name)
+    return int(result)
+
+##
+## dsl_source_app_max_level_bytes_get()
+##
+_dsl.dsl_source_app_max_level_bytes_get.argtypes = [c_wchar_p, POINTER(c_uint64)]
+_dsl.dsl_source_app_max_level_bytes_get.restype = c_uint
+def dsl_source_app_max_level_bytes_get(name):
+    global _dsl
+    max_bytes = c_uint64(0)
+    result = _dsl.dsl_source_app_max_level_bytes_get(name, DSL_UINT64_P(max_bytes))
+    return int(result), max_bytes.value
+
+##
+## dsl_source_app_max_level_bytes_set()
+##
+_dsl.dsl_source_app_max_level_bytes_set.argtypes = [c_wchar_p, c_uint64]
+_dsl.dsl_source_app_max_level_bytes_set.restype = c_uint
+def dsl_source_app_max_level_bytes_set(name, max_bytes):
+    global _dsl
+    result = _dsl.dsl_source_app_max_level_bytes_set(name, max_bytes)
+    return int(result)
+
+##
+## dsl_source_playlist_new()
+##
+_dsl.dsl_source_playlist_new.restype = c_uint
+def dsl_source_playlist_new(name, files, repeat_enabled, cudadec_mem_type, intra_decode, drop_frame_interval):
+    global _dsl
+    arr = (c_wchar_p * len(files))()
+    arr[:] = files
+    result = _dsl.dsl_source_playlist_new(name, arr, c_bool(repeat_enabled), c_uint(cudadec_mem_type), 
+        c_uint(intra_decode), c_uint(drop_frame_interval))
+    return int(result)
+
+##
+## dsl_source_playlist_index_get()
+##
+_dsl.dsl_source_playlist_index_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_source_playlist_index_get.restype = c_uint
+def dsl_source_playlist_index_get(name):
+    global _dsl
+    index = c_uint(0)
+    size = c_uint(0)
+    result = _dsl.dsl_source_playlist_index_get(name, DSL_UINT_P(index), DSL_UINT_P(size))
+    return int(result), index.value, size.value
+
 ##
 ## dsl_source_name_get()
 ##
@@ -1281,6 +1511,27 @@ def dsl_source_decode_uri_set(name, uir):
     result = _dsl.dsl_source_decode_uri_set(name, uir)
     return int(result)
 
+##
+## dsl_source_decode_repeat_enabled_get()
+##
+_dsl.dsl_source_decode_repeat_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_source_decode_repeat_enabled_get.restype = c_uint
+def dsl_source_decode_repeat_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_source_decode_repeat_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_source_decode_repeat_enabled_set()
+##
+_dsl.dsl_source_decode_repeat_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_source_decode_repeat_enabled_set.restype = c_uint
+def dsl_source_decode_repeat_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_source_decode_repeat_enabled_set(name, enabled)
+    return int(result)
+
 ##
 ## dsl_source_decode_dewarper_add()
 ##
@@ -1321,6 +1572,97 @@ def dsl_source_rtsp_tap_remove(name):
     result = _dsl.dsl_source_rtsp_tap_remove(name)
     return int(result)
 
+##
+## dsl_source_rtsp_timeout_get()
+##
+_dsl.dsl_source_rtsp_timeout_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_source_rtsp_timeout_get.restype = c_uint
+def dsl_source_rtsp_timeout_get(name):
+    global _dsl
+    timeout = c_uint(0)
+    result = _dsl.dsl_source_rtsp_timeout_get(name, DSL_UINT_P(timeout))
+    return int(result), timeout.value
+
+##
+## dsl_source_rtsp_timeout_set()
+##
+_dsl.dsl_source_rtsp_timeout_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_source_rtsp_timeout_set.restype = c_uint
+def dsl_source_rtsp_timeout_set(name, timeout):
+    global _dsl
+    result = _dsl.dsl_source_rtsp_timeout_set(name, timeout)
+    return int(result)
+
+##
+## dsl_source_rtsp_reconnection_params_get()
+##
+_dsl.dsl_source_rtsp_reconnection_params_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_source_rtsp_reconnection_params_get.restype = c_uint
+def dsl_source_rtsp_reconnection_params_get(name):
+    global _dsl
+    backoff_min = c_uint(0)
+    backoff_max = c_uint(0)
+    result = _dsl.dsl_source_rtsp_reconnection_params_get(name, DSL_UINT_P(backoff_min), DSL_UINT_P(backoff_max))
+    return int(result), backoff_min.value, backoff_max.value
+
+##
+## dsl_source_rtsp_reconnection_params_set()
+##
+_dsl.dsl_source_rtsp_reconnection_params_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_source_rtsp_reconnection_params_set.restype = c_uint
+def dsl_source_rtsp_reconnection_params_set(name, backoff_min, backoff_max):
+    global _dsl
+    result = _dsl.dsl_source_rtsp_reconnection_params_set(name, backoff_min, backoff_max)
+    return int(result)
+
+##
+## dsl_source_rtsp_connection_data_get()
+##
+_dsl.dsl_source_rtsp_connection_data_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint), POINTER(c_wchar_p)]
+_dsl.dsl_source_rtsp_connection_data_get.restype = c_uint
+def dsl_source_rtsp_connection_data_get(name):
+    global _dsl
+    state = c_uint(0)
+    reconnect_count = c_uint(0)
+    last_error = c_wchar_p(0)
+    result = _dsl.dsl_source_rtsp_connection_data_get(name, 
+        DSL_UINT_P(state), DSL_UINT_P(reconnect_count), DSL_WCHAR_PP(last_error))
+    return int(result), state.value, reconnect_count.value, last_error.value
+
+##
+## dsl_source_rtsp_connection_stats_clear()
+##
+_dsl.dsl_source_rtsp_connection_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_source_rtsp_connection_stats_clear.restype = c_uint
+def dsl_source_rtsp_connection_stats_clear(name):
+    global _dsl
+    result = _dsl.dsl_source_rtsp_connection_stats_clear(name)
+    return int(result)
+
+##
+## dsl_source_rtsp_state_change_listener_add()
+##
+_dsl.dsl_source_rtsp_state_change_listener_add.argtypes = [c_wchar_p, DSL_RTSP_CONNECTION_STATE_CHANGE_LISTENER, c_void_p]
+_dsl.dsl_source_rtsp_state_change_listener_add.restype = c_uint
+def dsl_source_rtsp_state_change_listener_add(name, client_listener, client_data):
+    global _dsl
+    c_client_listener = DSL_RTSP_CONNECTION_STATE_CHANGE_LISTENER(client_listener)
+    callbacks.append(c_client_listener)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    result = _dsl.dsl_source_rtsp_state_change_listener_add(name, c_client_listener, c_client_data)
+    return int(result)
+    
+##
+## dsl_source_rtsp_state_change_listener_remove()
+##
+_dsl.dsl_source_rtsp_state_change_listener_remove.argtypes = [c_wchar_p, DSL_RTSP_CONNECTION_STATE_CHANGE_LISTENER]
+_dsl.dsl_source_rtsp_state_change_listener_remove.restype = c_uint
+def dsl_source_rtsp_state_change_listener_remove(name, client_listener):
+    global _dsl
+    c_client_listener = DSL_RTSP_CONNECTION_STATE_CHANGE_LISTENER(client_listener)
+    result = _dsl.dsl_source_rtsp_state_change_listener_remove(name, c_client_listener)
+    return int(result)
+
 ##
 ## dsl_source_is_live()
 ##
@@ -1467,6 +1809,120 @@ def dsl_tap_record_reset_done_get(name):
     result = _dsl.dsl_tap_record_reset_done_get(name, DSL_BOOL_P(reset_done))
     return int(result), reset_done.value 
 
+##
+## dsl_tap_ring_record_new()
+##
+_dsl.dsl_tap_ring_record_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint64, 
+    DSL_RING_RECORD_COMPLETE_LISTENER]
+_dsl.dsl_tap_ring_record_new.restype = c_uint
+def dsl_tap_ring_record_new(name, outdir, container, max_bytes, client_listener):
+    global _dsl
+    c_client_listener = DSL_RING_RECORD_COMPLETE_LISTENER(client_listener)
+    callbacks.append(c_client_listener)
+    result =_dsl.dsl_tap_ring_record_new(name, outdir, container, max_bytes, c_client_listener)
+    return int(result)
+    
+##
+## dsl_tap_ring_record_session_start()
+##
+_dsl.dsl_tap_ring_record_session_start.argtypes = [c_wchar_p, POINTER(c_uint), c_uint, c_uint, c_void_p]
+_dsl.dsl_tap_ring_record_session_start.restype = c_uint
+def dsl_tap_ring_record_session_start(name, pre_event, post_event, client_data):
+    global _dsl
+    session = c_uint(0)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    result = _dsl.dsl_tap_ring_record_session_start(name, 
+        DSL_UINT_P(session), pre_event, post_event, c_client_data)
+    return int(result), session.value 
+
+##
+## dsl_tap_ring_record_session_stop()
+##
+_dsl.dsl_tap_ring_record_session_stop.argtypes = [c_wchar_p]
+_dsl.dsl_tap_ring_record_session_stop.restype = c_uint
+def dsl_tap_ring_record_session_stop(name):
+    global _dsl
+    result = _dsl.dsl_tap_ring_record_session_stop(name)
+    return int(result)
+
+##
+## dsl_tap_ring_record_max_bytes_get()
+##
+_dsl.dsl_tap_ring_record_max_bytes_get.argtypes = [c_wchar_p, POINTER(c_uint64)]
+_dsl.dsl_tap_ring_record_max_bytes_get.restype = c_uint
+def dsl_tap_ring_record_max_bytes_get(name):
+    global _dsl
+    max_bytes = c_uint64(0)
+    result = _dsl.dsl_tap_ring_record_max_bytes_get(name, DSL_UINT64_P(max_bytes))
+    return int(result), max_bytes.value 
+
+##
+## dsl_tap_ring_record_max_bytes_set()
+##
+_dsl.dsl_tap_ring_record_max_bytes_set.argtypes = [c_wchar_p, c_uint64]
+_dsl.dsl_tap_ring_record_max_bytes_set.restype = c_uint
+def dsl_tap_ring_record_max_bytes_set(name, max_bytes):
+    global _dsl
+    result = _dsl.dsl_tap_ring_record_max_bytes_set(name, max_bytes)
+    return int(result)
+
+##
+## dsl_tap_ring_record_cache_level_get()
+##
+_dsl.dsl_tap_ring_record_cache_level_get.argtypes = [c_wchar_p, POINTER(c_uint64), POINTER(c_uint)]
+_dsl.dsl_tap_ring_record_cache_level_get.restype = c_uint
+def dsl_tap_ring_record_cache_level_get(name):
+    global _dsl
+    bytes = c_uint64(0)
+    duration = c_uint(0)
+    result = _dsl.dsl_tap_ring_record_cache_level_get(name, 
+        DSL_UINT64_P(bytes), DSL_UINT_P(duration))
+    return int(result), bytes.value, duration.value 
+
+##
+## dsl_tap_ring_record_is_on_get()
+##
+_dsl.dsl_tap_ring_record_is_on_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_tap_ring_record_is_on_get.restype = c_uint
+def dsl_tap_ring_record_is_on_get(name):
+    global _dsl
+    is_on = c_bool(0)
+    result = _dsl.dsl_tap_ring_record_is_on_get(name, DSL_BOOL_P(is_on))
+    return int(result), is_on.value 
+
+##
+## dsl_tap_file_new()
+##
+_dsl.dsl_tap_file_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint]
+_dsl.dsl_tap_file_new.restype = c_uint
+def dsl_tap_file_new(name, filepath, codec, container):
+    global _dsl
+    result = _dsl.dsl_tap_file_new(name, filepath, codec, container)
+    return int(result)
+
+##
+## dsl_tap_rtsp_new()
+##
+_dsl.dsl_tap_rtsp_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint, c_uint]
+_dsl.dsl_tap_rtsp_new.restype = c_uint
+def dsl_tap_rtsp_new(name, host, udp_port, rtsp_port, codec):
+    global _dsl
+    result = _dsl.dsl_tap_rtsp_new(name, host, udp_port, rtsp_port, codec)
+    return int(result)
+
+##
+## dsl_tap_rtsp_server_settings_get()
+##
+_dsl.dsl_tap_rtsp_server_settings_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_tap_rtsp_server_settings_get.restype = c_uint
+def dsl_tap_rtsp_server_settings_get(name):
+    global _dsl
+    udp_port = c_uint(0)
+    rtsp_port = c_uint(0)
+    codec = c_uint(0)
+    result = _dsl.dsl_tap_rtsp_server_settings_get(name, DSL_UINT_P(udp_port), DSL_UINT_P(rtsp_port), DSL_UINT_P(codec))
+    return int(result), udp_port.value, rtsp_port.value, codec.value 
+
 ##
 ## dsl_gie_primary_new()
 ##
@@ -1559,6 +2015,59 @@ def dsl_gie_raw_output_enabled_set(name, enabled, path):
     result = _dsl.dsl_gie_raw_output_enabled_set(name, enabled, path)
     return int(result)
 
+##
+## dsl_gie_primary_interval_adaptive_get()
+##
+_dsl.dsl_gie_primary_interval_adaptive_get.argtypes = [c_wchar_p, 
+    POINTER(c_bool), POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_gie_primary_interval_adaptive_get.restype = c_uint
+def dsl_gie_primary_interval_adaptive_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    min_interval = c_uint(0)
+    max_interval = c_uint(0)
+    result = _dsl.dsl_gie_primary_interval_adaptive_get(name, DSL_BOOL_P(enabled),
+        DSL_UINT_P(min_interval), DSL_UINT_P(max_interval))
+    return int(result), enabled.value, min_interval.value, max_interval.value
+
+##
+## dsl_gie_primary_interval_adaptive_set()
+##
+_dsl.dsl_gie_primary_interval_adaptive_set.argtypes = [c_wchar_p, c_bool, c_uint, c_uint]
+_dsl.dsl_gie_primary_interval_adaptive_set.restype = c_uint
+def dsl_gie_primary_interval_adaptive_set(name, enabled, min_interval, max_interval):
+    global _dsl
+    result = _dsl.dsl_gie_primary_interval_adaptive_set(name, 
+        enabled, min_interval, max_interval)
+    return int(result)
+
+##
+## dsl_gie_primary_interval_listener_add()
+##
+_dsl.dsl_gie_primary_interval_listener_add.argtypes = [c_wchar_p, 
+    DSL_GIE_INTERVAL_CHANGE_LISTENER, c_void_p]
+_dsl.dsl_gie_primary_interval_listener_add.restype = c_uint
+def dsl_gie_primary_interval_listener_add(name, client_listener, client_data):
+    global _dsl
+    c_client_listener = DSL_GIE_INTERVAL_CHANGE_LISTENER(client_listener)
+    callbacks.append(c_client_listener)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    result = _dsl.dsl_gie_primary_interval_listener_add(name, 
+        c_client_listener, c_client_data)
+    return int(result)
+
+##
+## dsl_gie_primary_interval_listener_remove()
+##
+_dsl.dsl_gie_primary_interval_listener_remove.argtypes = [c_wchar_p, 
+    DSL_GIE_INTERVAL_CHANGE_LISTENER]
+_dsl.dsl_gie_primary_interval_listener_remove.restype = c_uint
+def dsl_gie_primary_interval_listener_remove(name, client_listener):
+    global _dsl
+    c_client_listener = DSL_GIE_INTERVAL_CHANGE_LISTENER(client_listener)
+    result = _dsl.dsl_gie_primary_interval_listener_remove(name, c_client_listener)
+    return int(result)
+
 ##
 ## dsl_tracker_ktl_new()
 ##
@@ -1579,6 +2088,42 @@ def dsl_tracker_iou_new(name, config_file, width, height):
     result = _dsl.dsl_tracker_iou_new(name, config_file, width, height)
     return int(result)
 
+##
+## dsl_tracker_cpu_iou_new()
+##
+_dsl.dsl_tracker_cpu_iou_new.argtypes = [c_wchar_p, c_uint, c_float, c_uint]
+_dsl.dsl_tracker_cpu_iou_new.restype = c_uint
+def dsl_tracker_cpu_iou_new(name, max_age, iou_threshold, max_tracks):
+    global _dsl
+    result = _dsl.dsl_tracker_cpu_iou_new(name, max_age, iou_threshold, max_tracks)
+    return int(result)
+
+##
+## dsl_tracker_cpu_iou_settings_get()
+##
+_dsl.dsl_tracker_cpu_iou_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_float), POINTER(c_uint)]
+_dsl.dsl_tracker_cpu_iou_settings_get.restype = c_uint
+def dsl_tracker_cpu_iou_settings_get(name):
+    global _dsl
+    max_age = c_uint(0)
+    iou_threshold = c_float(0)
+    max_tracks = c_uint(0)
+    result = _dsl.dsl_tracker_cpu_iou_settings_get(name, DSL_UINT_P(max_age),
+        DSL_FLOAT_P(iou_threshold), DSL_UINT_P(max_tracks))
+    return int(result), max_age.value, iou_threshold.value, max_tracks.value
+
+##
+## dsl_tracker_cpu_iou_settings_set()
+##
+_dsl.dsl_tracker_cpu_iou_settings_set.argtypes = [c_wchar_p, c_uint, c_float, c_uint]
+_dsl.dsl_tracker_cpu_iou_settings_set.restype = c_uint
+def dsl_tracker_cpu_iou_settings_set(name, max_age, iou_threshold, max_tracks):
+    global _dsl
+    result = _dsl.dsl_tracker_cpu_iou_settings_set(name, 
+        max_age, iou_threshold, max_tracks)
+    return int(result)
+
 ##
 ## dsl_tracker_max_dimensions_get()
 ##
@@ -1935,6 +2480,27 @@ def dsl_tiler_source_show_all(name):
     result = _dsl.dsl_tiler_source_show_all(name)
     return int(result)
 
+##
+## dsl_tiler_frame_pruning_enabled_get()
+##
+_dsl.dsl_tiler_frame_pruning_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_tiler_frame_pruning_enabled_get.restype = c_uint
+def dsl_tiler_frame_pruning_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_tiler_frame_pruning_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_tiler_frame_pruning_enabled_set()
+##
+_dsl.dsl_tiler_frame_pruning_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_tiler_frame_pruning_enabled_set.restype = c_uint
+def dsl_tiler_frame_pruning_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_tiler_frame_pruning_enabled_set(name, enabled)
+    return int(result)
+
 ##
 ## dsl_tiler_pph_add()
 ##
@@ -1966,44 +2532,312 @@ def dsl_sink_fake_new(name):
     return int(result)
 
 ##
-## dsl_sink_overlay_new()
+## dsl_sink_app_new()
 ##
-_dsl.dsl_sink_overlay_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint, c_uint, c_uint, c_uint]
-_dsl.dsl_sink_overlay_new.restype = c_uint
-def dsl_sink_overlay_new(name, overlay_id, display_id, depth, offsetX, offsetY, width, height):
+_dsl.dsl_sink_app_new.argtypes = [c_wchar_p, DSL_SINK_APP_NEW_DATA_HANDLER, c_void_p]
+_dsl.dsl_sink_app_new.restype = c_uint
+def dsl_sink_app_new(name, handler, client_data):
     global _dsl
-    result =_dsl.dsl_sink_overlay_new(name, overlay_id, display_id, depth, offsetX, offsetY, width, height)
+    c_handler = None
+    c_client_data = None
+    if handler is not None:
+        c_handler = DSL_SINK_APP_NEW_DATA_HANDLER(handler)
+        callbacks.append(c_handler)
+        c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    result =_dsl.dsl_sink_app_new(name, c_handler, c_client_data)
     return int(result)
 
 ##
-## dsl_sink_window_new()
+## dsl_sink_app_data_pull()
 ##
-_dsl.dsl_sink_window_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint]
-_dsl.dsl_sink_window_new.restype = c_uint
-def dsl_sink_window_new(name, offsetX, offsetY, width, height):
+_dsl.dsl_sink_app_data_pull.argtypes = [c_wchar_p, c_uint, 
+    POINTER(c_void_p), POINTER(c_void_p), POINTER(c_uint), POINTER(c_void_p)]
+_dsl.dsl_sink_app_data_pull.restype = c_uint
+def dsl_sink_app_data_pull(name, timeout):
     global _dsl
-    result =_dsl.dsl_sink_window_new(name, offsetX, offsetY, width, height)
-    return int(result)
+    buffer = c_void_p(0)
+    data = c_void_p(0)
+    size = c_uint(0)
+    batch_meta = c_void_p(0)
+    result =_dsl.dsl_sink_app_data_pull(name, timeout, 
+        byref(buffer), byref(data), DSL_UINT_P(size), byref(batch_meta))
+    return int(result), buffer.value, data.value, size.value, batch_meta.value
 
 ##
-## dsl_sink_file_new()
+## dsl_sink_app_data_release()
 ##
-_dsl.dsl_sink_file_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint, c_uint, c_uint]
-_dsl.dsl_sink_file_new.restype = c_uint
-def dsl_sink_file_new(name, filepath, codec, container, bitrate, interval):
+_dsl.dsl_sink_app_data_release.argtypes = [c_wchar_p]
+_dsl.dsl_sink_app_data_release.restype = c_uint
+def dsl_sink_app_data_release(name):
     global _dsl
-    result =_dsl.dsl_sink_file_new(name, filepath, codec, container, bitrate, interval)
+    result =_dsl.dsl_sink_app_data_release(name)
     return int(result)
 
 ##
-## dsl_sink_record_new()
+## dsl_sink_app_max_buffers_get()
 ##
-_dsl.dsl_sink_record_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint, c_uint, c_uint, DSL_RECORD_CLIENT_LISTNER]
-_dsl.dsl_sink_record_new.restype = c_uint
-def dsl_sink_record_new(name, outdir, codec, container, bitrate, interval, client_listener):
+_dsl.dsl_sink_app_max_buffers_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_bool)]
+_dsl.dsl_sink_app_max_buffers_get.restype = c_uint
+def dsl_sink_app_max_buffers_get(name):
     global _dsl
-    c_client_listener = DSL_RECORD_CLIENT_LISTNER(client_listener)
-    callbacks.append(c_client_listener)
+    max_buffers = c_uint(0)
+    drop = c_bool(0)
+    result =_dsl.dsl_sink_app_max_buffers_get(name, DSL_UINT_P(max_buffers), DSL_BOOL_P(drop))
+    return int(result), max_buffers.value, drop.value
+
+##
+## dsl_sink_app_max_buffers_set()
+##
+_dsl.dsl_sink_app_max_buffers_set.argtypes = [c_wchar_p, c_uint, c_bool]
+_dsl.dsl_sink_app_max_buffers_set.restype = c_uint
+def dsl_sink_app_max_buffers_set(name, max_buffers, drop):
+    global _dsl
+    result =_dsl.dsl_sink_app_max_buffers_set(name, max_buffers, drop)
+    return int(result)
+
+##
+## dsl_sink_meta_new()
+##
+_dsl.dsl_sink_meta_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint]
+_dsl.dsl_sink_meta_new.restype = c_uint
+def dsl_sink_meta_new(name, path, mode, frames_per_write):
+    global _dsl
+    result =_dsl.dsl_sink_meta_new(name, path, mode, frames_per_write)
+    return int(result)
+
+##
+## dsl_sink_meta_stats_get()
+##
+_dsl.dsl_sink_meta_stats_get.argtypes = [c_wchar_p, POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_sink_meta_stats_get.restype = c_uint
+def dsl_sink_meta_stats_get(name):
+    global _dsl
+    frames_written = c_uint64(0)
+    frames_dropped = c_uint64(0)
+    result =_dsl.dsl_sink_meta_stats_get(name, 
+        DSL_UINT64_P(frames_written), DSL_UINT64_P(frames_dropped))
+    return int(result), frames_written.value, frames_dropped.value
+
+##
+## dsl_sink_meta_stats_clear()
+##
+_dsl.dsl_sink_meta_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_sink_meta_stats_clear.restype = c_uint
+def dsl_sink_meta_stats_clear(name):
+    global _dsl
+    result =_dsl.dsl_sink_meta_stats_clear(name)
+    return int(result)
+
+##
+## dsl_sink_overlay_new()
+##
+_dsl.dsl_sink_overlay_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_sink_overlay_new.restype = c_uint
+def dsl_sink_overlay_new(name, overlay_id, display_id, depth, offsetX, offsetY, width, height):
+    global _dsl
+    result =_dsl.dsl_sink_overlay_new(name, overlay_id, display_id, depth, offsetX, offsetY, width, height)
+    return int(result)
+
+##
+## dsl_sink_window_new()
+##
+_dsl.dsl_sink_window_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_sink_window_new.restype = c_uint
+def dsl_sink_window_new(name, offsetX, offsetY, width, height):
+    global _dsl
+    result =_dsl.dsl_sink_window_new(name, offsetX, offsetY, width, height)
+    return int(result)
+
+##
+## dsl_sink_render_max_fps_get()
+##
+_dsl.dsl_sink_render_max_fps_get.argtypes = [c_wchar_p, DSL_UINT_P]
+_dsl.dsl_sink_render_max_fps_get.restype = c_uint
+def dsl_sink_render_max_fps_get(name):
+    global _dsl
+    max_fps = c_uint(0)
+    result = _dsl.dsl_sink_render_max_fps_get(name, DSL_UINT_P(max_fps))
+    return int(result), max_fps.value
+
+##
+## dsl_sink_render_max_fps_set()
+##
+_dsl.dsl_sink_render_max_fps_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_sink_render_max_fps_set.restype = c_uint
+def dsl_sink_render_max_fps_set(name, max_fps):
+    global _dsl
+    result = _dsl.dsl_sink_render_max_fps_set(name, max_fps)
+    return int(result)
+
+##
+## dsl_sink_window_pause_when_hidden_get()
+##
+_dsl.dsl_sink_window_pause_when_hidden_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_sink_window_pause_when_hidden_get.restype = c_uint
+def dsl_sink_window_pause_when_hidden_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_sink_window_pause_when_hidden_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_sink_window_pause_when_hidden_set()
+##
+_dsl.dsl_sink_window_pause_when_hidden_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_sink_window_pause_when_hidden_set.restype = c_uint
+def dsl_sink_window_pause_when_hidden_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_sink_window_pause_when_hidden_set(name, enabled)
+    return int(result)
+
+##
+## dsl_sink_file_new()
+##
+_dsl.dsl_sink_file_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_sink_file_new.restype = c_uint
+def dsl_sink_file_new(name, filepath, codec, container, bitrate, interval):
+    global _dsl
+    result =_dsl.dsl_sink_file_new(name, filepath, codec, container, bitrate, interval)
+    return int(result)
+
+##
+## dsl_sink_segment_new()
+##
+_dsl.dsl_sink_segment_new.argtypes = [c_wchar_p, c_wchar_p, 
+    c_uint, c_uint, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_sink_segment_new.restype = c_uint
+def dsl_sink_segment_new(name, file_pattern, codec, container, bitrate, interval, 
+    max_duration, max_files):
+    global _dsl
+    result =_dsl.dsl_sink_segment_new(name, file_pattern, codec, container, 
+        bitrate, interval, max_duration, max_files)
+    return int(result)
+
+##
+## dsl_sink_segment_max_duration_get()
+##
+_dsl.dsl_sink_segment_max_duration_get.argtypes = [c_wchar_p, DSL_UINT_P]
+_dsl.dsl_sink_segment_max_duration_get.restype = c_uint
+def dsl_sink_segment_max_duration_get(name):
+    global _dsl
+    max_duration = c_uint(0)
+    result = _dsl.dsl_sink_segment_max_duration_get(name, DSL_UINT_P(max_duration))
+    return int(result), max_duration.value
+
+##
+## dsl_sink_segment_max_duration_set()
+##
+_dsl.dsl_sink_segment_max_duration_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_sink_segment_max_duration_set.restype = c_uint
+def dsl_sink_segment_max_duration_set(name, max_duration):
+    global _dsl
+    result = _dsl.dsl_sink_segment_max_duration_set(name, max_duration)
+    return int(result)
+
+##
+## dsl_sink_segment_max_size_get()
+##
+_dsl.dsl_sink_segment_max_size_get.argtypes = [c_wchar_p, DSL_UINT64_P]
+_dsl.dsl_sink_segment_max_size_get.restype = c_uint
+def dsl_sink_segment_max_size_get(name):
+    global _dsl
+    max_size = c_uint64(0)
+    result = _dsl.dsl_sink_segment_max_size_get(name, DSL_UINT64_P(max_size))
+    return int(result), max_size.value
+
+##
+## dsl_sink_segment_max_size_set()
+##
+_dsl.dsl_sink_segment_max_size_set.argtypes = [c_wchar_p, c_uint64]
+_dsl.dsl_sink_segment_max_size_set.restype = c_uint
+def dsl_sink_segment_max_size_set(name, max_size):
+    global _dsl
+    result = _dsl.dsl_sink_segment_max_size_set(name, max_size)
+    return int(result)
+
+##
+## dsl_sink_segment_max_files_get()
+##
+_dsl.dsl_sink_segment_max_files_get.argtypes = [c_wchar_p, DSL_UINT_P]
+_dsl.dsl_sink_segment_max_files_get.restype = c_uint
+def dsl_sink_segment_max_files_get(name):
+    global _dsl
+    max_files = c_uint(0)
+    result = _dsl.dsl_sink_segment_max_files_get(name, DSL_UINT_P(max_files))
+    return int(result), max_files.value
+
+##
+## dsl_sink_segment_max_files_set()
+##
+_dsl.dsl_sink_segment_max_files_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_sink_segment_max_files_set.restype = c_uint
+def dsl_sink_segment_max_files_set(name, max_files):
+    global _dsl
+    result = _dsl.dsl_sink_segment_max_files_set(name, max_files)
+    return int(result)
+
+##
+## dsl_sink_segment_write_settings_get()
+##
+_dsl.dsl_sink_segment_write_settings_get.argtypes = [c_wchar_p, DSL_UINT_P, DSL_UINT_P]
+_dsl.dsl_sink_segment_write_settings_get.restype = c_uint
+def dsl_sink_segment_write_settings_get(name):
+    global _dsl
+    buffer_size = c_uint(0)
+    fsync_interval = c_uint(0)
+    result = _dsl.dsl_sink_segment_write_settings_get(name, 
+        DSL_UINT_P(buffer_size), DSL_UINT_P(fsync_interval))
+    return int(result), buffer_size.value, fsync_interval.value 
+
+##
+## dsl_sink_segment_write_settings_set()
+##
+_dsl.dsl_sink_segment_write_settings_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_sink_segment_write_settings_set.restype = c_uint
+def dsl_sink_segment_write_settings_set(name, buffer_size, fsync_interval):
+    global _dsl
+    result = _dsl.dsl_sink_segment_write_settings_set(name, buffer_size, fsync_interval)
+    return int(result)
+
+##
+## dsl_sink_shared_encode_new()
+##
+_dsl.dsl_sink_shared_encode_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint]
+_dsl.dsl_sink_shared_encode_new.restype = c_uint
+def dsl_sink_shared_encode_new(name, codec, bitrate, interval):
+    global _dsl
+    result = _dsl.dsl_sink_shared_encode_new(name, codec, bitrate, interval)
+    return int(result)
+
+##
+## dsl_sink_shared_encode_tap_add()
+##
+_dsl.dsl_sink_shared_encode_tap_add.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_sink_shared_encode_tap_add.restype = c_uint
+def dsl_sink_shared_encode_tap_add(name, tap):
+    global _dsl
+    result = _dsl.dsl_sink_shared_encode_tap_add(name, tap)
+    return int(result)
+
+##
+## dsl_sink_shared_encode_tap_remove()
+##
+_dsl.dsl_sink_shared_encode_tap_remove.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_sink_shared_encode_tap_remove.restype = c_uint
+def dsl_sink_shared_encode_tap_remove(name, tap):
+    global _dsl
+    result = _dsl.dsl_sink_shared_encode_tap_remove(name, tap)
+    return int(result)
+
+##
+## dsl_sink_record_new()
+##
+_dsl.dsl_sink_record_new.argtypes = [c_wchar_p, c_wchar_p, c_uint, c_uint, c_uint, c_uint, DSL_RECORD_CLIENT_LISTNER]
+_dsl.dsl_sink_record_new.restype = c_uint
+def dsl_sink_record_new(name, outdir, codec, container, bitrate, interval, client_listener):
+    global _dsl
+    c_client_listener = DSL_RECORD_CLIENT_LISTNER(client_listener)
+    callbacks.append(c_client_listener)
     result =_dsl.dsl_sink_record_new(name, outdir, codec, container, bitrate, interval, c_client_listener)
     return int(result)
     
@@ -2173,6 +3007,42 @@ def dsl_sink_rtsp_encoder_settings_set(name, bitrate, interval):
     result = _dsl.dsl_sink_rtsp_encoder_settings_set(name, bitrate, interval)
     return int(result)
 
+##
+## dsl_sink_rtsp_bitrate_adaptive_get()
+##
+_dsl.dsl_sink_rtsp_bitrate_adaptive_get.argtypes = [c_wchar_p, POINTER(c_bool), POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_sink_rtsp_bitrate_adaptive_get.restype = c_uint
+def dsl_sink_rtsp_bitrate_adaptive_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    min_bitrate = c_uint(0)
+    max_bitrate = c_uint(0)
+    result = _dsl.dsl_sink_rtsp_bitrate_adaptive_get(name, DSL_BOOL_P(enabled), DSL_UINT_P(min_bitrate), DSL_UINT_P(max_bitrate))
+    return int(result), enabled.value, min_bitrate.value, max_bitrate.value
+
+##
+## dsl_sink_rtsp_bitrate_adaptive_set()
+##
+_dsl.dsl_sink_rtsp_bitrate_adaptive_set.argtypes = [c_wchar_p, c_bool, c_uint, c_uint]
+_dsl.dsl_sink_rtsp_bitrate_adaptive_set.restype = c_uint
+def dsl_sink_rtsp_bitrate_adaptive_set(name, enabled, min_bitrate, max_bitrate):
+    global _dsl
+    result = _dsl.dsl_sink_rtsp_bitrate_adaptive_set(name, enabled, min_bitrate, max_bitrate)
+    return int(result)
+
+##
+## dsl_sink_rtsp_stream_status_get()
+##
+_dsl.dsl_sink_rtsp_stream_status_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint), POINTER(c_bool)]
+_dsl.dsl_sink_rtsp_stream_status_get.restype = c_uint
+def dsl_sink_rtsp_stream_status_get(name):
+    global _dsl
+    client_count = c_uint(0)
+    bitrate = c_uint(0)
+    is_encoding = c_bool(0)
+    result = _dsl.dsl_sink_rtsp_stream_status_get(name, DSL_UINT_P(client_count), DSL_UINT_P(bitrate), DSL_BOOL_P(is_encoding))
+    return int(result), client_count.value, bitrate.value, is_encoding.value
+
 ##
 ## dsl_sink_sync_settings_get()
 ##
@@ -2490,6 +3360,46 @@ def dsl_pipeline_component_remove_many(pipeline, components):
     result =_dsl.dsl_pipeline_component_remove_many(pipeline, arr)
     return int(result)
 
+##
+## dsl_pipeline_source_standby_add()
+##
+_dsl.dsl_pipeline_source_standby_add.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_pipeline_source_standby_add.restype = c_uint
+def dsl_pipeline_source_standby_add(pipeline, source):
+    global _dsl
+    result =_dsl.dsl_pipeline_source_standby_add(pipeline, source)
+    return int(result)
+
+##
+## dsl_pipeline_source_standby_remove()
+##
+_dsl.dsl_pipeline_source_standby_remove.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_pipeline_source_standby_remove.restype = c_uint
+def dsl_pipeline_source_standby_remove(pipeline, source):
+    global _dsl
+    result =_dsl.dsl_pipeline_source_standby_remove(pipeline, source)
+    return int(result)
+
+##
+## dsl_pipeline_source_standby_attach()
+##
+_dsl.dsl_pipeline_source_standby_attach.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_pipeline_source_standby_attach.restype = c_uint
+def dsl_pipeline_source_standby_attach(pipeline, source):
+    global _dsl
+    result =_dsl.dsl_pipeline_source_standby_attach(pipeline, source)
+    return int(result)
+
+##
+## dsl_pipeline_source_standby_detach()
+##
+_dsl.dsl_pipeline_source_standby_detach.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_pipeline_source_standby_detach.restype = c_uint
+def dsl_pipeline_source_standby_detach(pipeline, source):
+    global _dsl
+    result =_dsl.dsl_pipeline_source_standby_detach(pipeline, source)
+    return int(result)
+
 ##
 ## dsl_pipeline_streammux_batch_properties_get()
 ##
@@ -2555,6 +3465,220 @@ def dsl_pipeline_streammux_padding_set(name, enabled):
     result = _dsl.dsl_pipeline_streammux_padding_set(name, enabled)
     return int(result)
 
+##
+## dsl_pipeline_streammux_batch_timeout_adaptive_get()
+##
+_dsl.dsl_pipeline_streammux_batch_timeout_adaptive_get.argtypes = [c_wchar_p, POINTER(c_bool), POINTER(c_uint)]
+_dsl.dsl_pipeline_streammux_batch_timeout_adaptive_get.restype = c_uint
+def dsl_pipeline_streammux_batch_timeout_adaptive_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    jitter_margin = c_uint(0)
+    result = _dsl.dsl_pipeline_streammux_batch_timeout_adaptive_get(name, DSL_BOOL_P(enabled), DSL_UINT_P(jitter_margin))
+    return int(result), enabled.value, jitter_margin.value
+
+##
+## dsl_pipeline_streammux_batch_timeout_adaptive_set()
+##
+_dsl.dsl_pipeline_streammux_batch_timeout_adaptive_set.argtypes = [c_wchar_p, c_bool, c_uint]
+_dsl.dsl_pipeline_streammux_batch_timeout_adaptive_set.restype = c_uint
+def dsl_pipeline_streammux_batch_timeout_adaptive_set(name, enabled, jitter_margin):
+    global _dsl
+    result = _dsl.dsl_pipeline_streammux_batch_timeout_adaptive_set(name, enabled, jitter_margin)
+    return int(result)
+
+##
+## dsl_pipeline_streammux_batch_stats_get()
+##
+_dsl.dsl_pipeline_streammux_batch_stats_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_double)]
+_dsl.dsl_pipeline_streammux_batch_stats_get.restype = c_uint
+def dsl_pipeline_streammux_batch_stats_get(name):
+    global _dsl
+    batch_timeout = c_uint(0)
+    fill_ratio = c_double(0)
+    result = _dsl.dsl_pipeline_streammux_batch_stats_get(name, DSL_UINT_P(batch_timeout), DSL_DOUBLE_P(fill_ratio))
+    return int(result), batch_timeout.value, fill_ratio.value
+
+##
+## dsl_pipeline_streammux_batch_size_adaptive_get()
+##
+_dsl.dsl_pipeline_streammux_batch_size_adaptive_get.argtypes = [c_wchar_p, POINTER(c_bool), POINTER(c_uint)]
+_dsl.dsl_pipeline_streammux_batch_size_adaptive_get.restype = c_uint
+def dsl_pipeline_streammux_batch_size_adaptive_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    hysteresis = c_uint(0)
+    result = _dsl.dsl_pipeline_streammux_batch_size_adaptive_get(name, DSL_BOOL_P(enabled), DSL_UINT_P(hysteresis))
+    return int(result), enabled.value, hysteresis.value
+
+##
+## dsl_pipeline_streammux_batch_size_adaptive_set()
+##
+_dsl.dsl_pipeline_streammux_batch_size_adaptive_set.argtypes = [c_wchar_p, c_bool, c_uint]
+_dsl.dsl_pipeline_streammux_batch_size_adaptive_set.restype = c_uint
+def dsl_pipeline_streammux_batch_size_adaptive_set(name, enabled, hysteresis):
+    global _dsl
+    result = _dsl.dsl_pipeline_streammux_batch_size_adaptive_set(name, enabled, hysteresis)
+    return int(result)
+
+##
+## dsl_pipeline_sgie_cache_settings_get()
+##
+_dsl.dsl_pipeline_sgie_cache_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_bool), POINTER(c_uint), POINTER(c_float)]
+_dsl.dsl_pipeline_sgie_cache_settings_get.restype = c_uint
+def dsl_pipeline_sgie_cache_settings_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    max_age = c_uint(0)
+    min_confidence = c_float(0)
+    result = _dsl.dsl_pipeline_sgie_cache_settings_get(name, DSL_BOOL_P(enabled),
+        DSL_UINT_P(max_age), DSL_FLOAT_P(min_confidence))
+    return int(result), enabled.value, max_age.value, min_confidence.value
+
+##
+## dsl_pipeline_sgie_cache_settings_set()
+##
+_dsl.dsl_pipeline_sgie_cache_settings_set.argtypes = [c_wchar_p, c_bool, c_uint, c_float]
+_dsl.dsl_pipeline_sgie_cache_settings_set.restype = c_uint
+def dsl_pipeline_sgie_cache_settings_set(name, enabled, max_age, min_confidence):
+    global _dsl
+    result = _dsl.dsl_pipeline_sgie_cache_settings_set(name, 
+        enabled, max_age, min_confidence)
+    return int(result)
+
+##
+## dsl_pipeline_sgie_cache_stats_get()
+##
+_dsl.dsl_pipeline_sgie_cache_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_pipeline_sgie_cache_stats_get.restype = c_uint
+def dsl_pipeline_sgie_cache_stats_get(name):
+    global _dsl
+    hits = c_uint64(0)
+    misses = c_uint64(0)
+    result = _dsl.dsl_pipeline_sgie_cache_stats_get(name, 
+        DSL_UINT64_P(hits), DSL_UINT64_P(misses))
+    return int(result), hits.value, misses.value
+
+##
+## dsl_pipeline_main_context_enabled_get()
+##
+_dsl.dsl_pipeline_main_context_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pipeline_main_context_enabled_get.restype = c_uint
+def dsl_pipeline_main_context_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_pipeline_main_context_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_pipeline_main_context_enabled_set()
+##
+_dsl.dsl_pipeline_main_context_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pipeline_main_context_enabled_set.restype = c_uint
+def dsl_pipeline_main_context_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_pipeline_main_context_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pipeline_qos_element_stats_get()
+##
+_dsl.dsl_pipeline_qos_element_stats_get.argtypes = [c_wchar_p, c_wchar_p, 
+    POINTER(c_uint64), POINTER(c_uint64), POINTER(c_int64), POINTER(c_double)]
+_dsl.dsl_pipeline_qos_element_stats_get.restype = c_uint
+def dsl_pipeline_qos_element_stats_get(name, element):
+    global _dsl
+    processed = c_uint64(0)
+    dropped = c_uint64(0)
+    jitter = c_int64(0)
+    proportion = c_double(0)
+    result = _dsl.dsl_pipeline_qos_element_stats_get(name, element, 
+        DSL_UINT64_P(processed), DSL_UINT64_P(dropped), 
+        DSL_INT64_P(jitter), DSL_DOUBLE_P(proportion))
+    return int(result), processed.value, dropped.value, jitter.value, proportion.value
+
+##
+## dsl_pipeline_qos_totals_get()
+##
+_dsl.dsl_pipeline_qos_totals_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint64)]
+_dsl.dsl_pipeline_qos_totals_get.restype = c_uint
+def dsl_pipeline_qos_totals_get(name):
+    global _dsl
+    elements = c_uint(0)
+    dropped = c_uint64(0)
+    result = _dsl.dsl_pipeline_qos_totals_get(name, 
+        DSL_UINT_P(elements), DSL_UINT64_P(dropped))
+    return int(result), elements.value, dropped.value
+
+##
+## dsl_pipeline_qos_stats_clear()
+##
+_dsl.dsl_pipeline_qos_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_pipeline_qos_stats_clear.restype = c_uint
+def dsl_pipeline_qos_stats_clear(name):
+    global _dsl
+    result = _dsl.dsl_pipeline_qos_stats_clear(name)
+    return int(result)
+
+##
+## dsl_pipeline_qos_listener_add()
+##
+_dsl.dsl_pipeline_qos_listener_add.argtypes = [c_wchar_p, DSL_QOS_LISTENER, c_uint, c_void_p]
+_dsl.dsl_pipeline_qos_listener_add.restype = c_uint
+def dsl_pipeline_qos_listener_add(name, client_listener, threshold, client_data):
+    global _dsl
+    c_client_listener = DSL_QOS_LISTENER(client_listener)
+    callbacks.append(c_client_listener)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    result = _dsl.dsl_pipeline_qos_listener_add(name, 
+        c_client_listener, threshold, c_client_data)
+    return int(result)
+
+##
+## dsl_pipeline_qos_listener_remove()
+##
+_dsl.dsl_pipeline_qos_listener_remove.argtypes = [c_wchar_p, DSL_QOS_LISTENER]
+_dsl.dsl_pipeline_qos_listener_remove.restype = c_uint
+def dsl_pipeline_qos_listener_remove(name, listener):
+    global _dsl
+    client_listener = DSL_QOS_LISTENER(listener)
+    result = _dsl.dsl_pipeline_qos_listener_remove(name, client_listener)
+    return int(result)
+
+##
+## dsl_pipeline_thread_policy_set()
+##
+_dsl.dsl_pipeline_thread_policy_set.argtypes = [c_wchar_p, c_wchar_p, c_uint64, c_uint, c_int]
+_dsl.dsl_pipeline_thread_policy_set.restype = c_uint
+def dsl_pipeline_thread_policy_set(name, component, cpu_mask, sched_policy, priority):
+    global _dsl
+    result = _dsl.dsl_pipeline_thread_policy_set(name, 
+        component, cpu_mask, sched_policy, priority)
+    return int(result)
+
+##
+## dsl_pipeline_thread_policy_remove()
+##
+_dsl.dsl_pipeline_thread_policy_remove.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_pipeline_thread_policy_remove.restype = c_uint
+def dsl_pipeline_thread_policy_remove(name, component):
+    global _dsl
+    result = _dsl.dsl_pipeline_thread_policy_remove(name, component)
+    return int(result)
+
+##
+## dsl_pipeline_thread_report_get()
+##
+_dsl.dsl_pipeline_thread_report_get.argtypes = [c_wchar_p, POINTER(c_wchar_p)]
+_dsl.dsl_pipeline_thread_report_get.restype = c_uint
+def dsl_pipeline_thread_report_get(name):
+    global _dsl
+    report = c_wchar_p(0)
+    result = _dsl.dsl_pipeline_thread_report_get(name, DSL_WCHAR_PP(report))
+    return int(result), report.value
+
 ##
 ## dsl_pipeline_xwindow_clear()
 ##
@@ -2779,6 +3903,91 @@ def dsl_pipeline_xwindow_delete_event_handler_remove(name, client_handler):
     result = _dsl.dsl_pipeline_xwindow_delete_event_handler_remove(name, c_client_handler)
     return int(result)
 
+##
+## dsl_metrics_http_exporter_start()
+##
+_dsl.dsl_metrics_http_exporter_start.argtypes = [c_uint]
+_dsl.dsl_metrics_http_exporter_start.restype = c_uint
+def dsl_metrics_http_exporter_start(port):
+    global _dsl
+    result = _dsl.dsl_metrics_http_exporter_start(port)
+    return int(result)
+
+##
+## dsl_metrics_http_exporter_stop()
+##
+_dsl.dsl_metrics_http_exporter_stop.restype = c_uint
+def dsl_metrics_http_exporter_stop():
+    global _dsl
+    result = _dsl.dsl_metrics_http_exporter_stop()
+    return int(result)
+
+##
+## dsl_metrics_file_exporter_start()
+##
+_dsl.dsl_metrics_file_exporter_start.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_metrics_file_exporter_start.restype = c_uint
+def dsl_metrics_file_exporter_start(file_path, interval):
+    global _dsl
+    result = _dsl.dsl_metrics_file_exporter_start(file_path, interval)
+    return int(result)
+
+##
+## dsl_metrics_file_exporter_stop()
+##
+_dsl.dsl_metrics_file_exporter_stop.restype = c_uint
+def dsl_metrics_file_exporter_stop():
+    global _dsl
+    result = _dsl.dsl_metrics_file_exporter_stop()
+    return int(result)
+
+##
+## dsl_metrics_list_size()
+##
+_dsl.dsl_metrics_list_size.restype = c_uint
+def dsl_metrics_list_size():
+    global _dsl
+    result =_dsl.dsl_metrics_list_size()
+    return int(result)
+
+##
+## dsl_plugin_load()
+##
+_dsl.dsl_plugin_load.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_plugin_load.restype = c_uint
+def dsl_plugin_load(name, path):
+    global _dsl
+    result =_dsl.dsl_plugin_load(name, path)
+    return int(result)
+
+##
+## dsl_plugin_delete()
+##
+_dsl.dsl_plugin_delete.argtypes = [c_wchar_p]
+_dsl.dsl_plugin_delete.restype = c_uint
+def dsl_plugin_delete(name):
+    global _dsl
+    result =_dsl.dsl_plugin_delete(name)
+    return int(result)
+
+##
+## dsl_plugin_delete_all()
+##
+_dsl.dsl_plugin_delete_all.restype = c_uint
+def dsl_plugin_delete_all():
+    global _dsl
+    result =_dsl.dsl_plugin_delete_all()
+    return int(result)
+
+##
+## dsl_plugin_list_size()
+##
+_dsl.dsl_plugin_list_size.restype = c_uint
+def dsl_plugin_list_size():
+    global _dsl
+    result =_dsl.dsl_plugin_list_size()
+    return int(result)
+
 ##
 ## dsl_main_loop_run()
 ##
@@ -0,0 +1,162 @@
+################################################################################
+# The MIT License
+#
+# Copyright (c) 2019-2020, Robert Howell. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+################################################################################
+
+
+#!/usr/bin/env python
+
+################################################################################
+#
+# Measures the process thread count, context switches, and throughput of a
+# Pipeline using GStreamer's default task pool, at 8, 16, and 32 synthetic
+# sources. Each run plays a fixed number of frames per source, through a
+# Demuxer to one Fake Sink per source, as fast as possible. 
+#
+# Each GstTask - every Queue and Source streaming thread - holds its thread
+# for as long as it runs, so the thread count grows with the number of 
+# sources whichever pool the tasks are pushed to. The threads per source
+# column shows the cost of each additional source.
+#
+################################################################################
+
+import sys
+sys.path.insert(0, "../../")
+import os
+import time
+import threading
+import resource
+
+from dsl import *
+
+SOURCE_COUNTS = [8, 16, 32]
+FRAMES_PER_SOURCE = 300
+
+SOURCE_WIDTH = 640
+SOURCE_HEIGHT = 360
+
+##
+# Samples the process thread count while the Pipeline is playing
+##
+class ThreadSampler(threading.Thread):
+    def __init__(self):
+        threading.Thread.__init__(self)
+        self.m_stop = threading.Event()
+        self.m_max_threads = 0
+
+    def run(self):
+        while not self.m_stop.wait(0.1):
+            self.m_max_threads = max(self.m_max_threads, 
+                len(os.listdir('/proc/self/task')))
+
+## 
+# Function to be called on End-of-Stream (EOS) event
+## 
+def eos_event_listener(client_data):
+    dsl_main_loop_quit()
+
+##
+# Builds and runs one Pipeline, returning the max threads, context switches
+# and frames per second for the run
+##
+def run_pipeline(source_count):
+
+    sources = []
+    branches = []
+    for i in range(source_count):
+        source = 'source-{}'.format(i)
+        sink = 'sink-{}'.format(i)
+        retval = dsl_source_test_new(source, False, 0, 
+            SOURCE_WIDTH, SOURCE_HEIGHT, 30, 1, FRAMES_PER_SOURCE)
+        if retval != DSL_RETURN_SUCCESS:
+            return retval, None
+        retval = dsl_sink_fake_new(sink)
+        if retval != DSL_RETURN_SUCCESS:
+            return retval, None
+            
+        # Don't sync to the clock, we want to measure the max throughput
+        retval = dsl_sink_sync_settings_set(sink, False, False)
+        if retval != DSL_RETURN_SUCCESS:
+            return retval, None
+        sources.append(source)
+        branches.append(sink)
+    branches.append(None)
+
+    retval = dsl_tee_demuxer_new_branch_add_many('demuxer', branches)
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+    retval = dsl_pipeline_new_component_add_many('pipeline', sources + ['demuxer', None])
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+    retval = dsl_pipeline_streammux_batch_properties_set('pipeline', source_count, 40000)
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+    retval = dsl_pipeline_eos_listener_add('pipeline', eos_event_listener, None)
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+
+    sampler = ThreadSampler()
+    sampler.start()
+    usage = resource.getrusage(resource.RUSAGE_SELF)
+    start = time.time()
+    
+    retval = dsl_pipeline_play('pipeline')
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+    dsl_main_loop_run()
+    
+    elapsed = time.time() - start
+    end_usage = resource.getrusage(resource.RUSAGE_SELF)
+    sampler.m_stop.set()
+    sampler.join()
+    
+    dsl_pipeline_stop('pipeline')
+    dsl_delete_all()
+    
+    context_switches = (end_usage.ru_nvcsw - usage.ru_nvcsw) + \
+        (end_usage.ru_nivcsw - usage.ru_nivcsw)
+    fps = (source_count * FRAMES_PER_SOURCE) / elapsed
+    
+    return DSL_RETURN_SUCCESS, (sampler.m_max_threads, context_switches, fps)
+
+def main(args):
+
+    base_threads = len(os.listdir('/proc/self/task'))
+    print('Threads before play = ', base_threads)
+    print()
+    print('{:<10}{:<12}{:<20}{:<18}{:<12}'.format(
+        'Sources', 'Threads', 'Threads per Source', 'Context Switches', 'FPS (total)'))
+
+    for source_count in SOURCE_COUNTS:
+        retval, results = run_pipeline(source_count)
+        if retval != DSL_RETURN_SUCCESS:
+            print(dsl_return_value_to_string(retval))
+            dsl_delete_all()
+            return retval
+        threads, context_switches, fps = results
+        print('{:<10}{:<12}{:<20.1f}{:<18}{:<12.1f}'.format(source_count, threads, 
+            (threads - base_threads) / source_count, context_switches, fps))
+    
+    return 0
+    
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
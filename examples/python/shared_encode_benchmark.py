@@ -0,0 +1,156 @@
+################################################################################
+# The MIT License
+#
+# Copyright (c) 2019-2020, Robert Howell. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+################################################################################
+
+
+#!/usr/bin/env python
+
+################################################################################
+#
+# Compares the process CPU time of encoding one Test Source to three files
+# with one Shared Encode Sink and three File Taps, against three File Sinks
+# that each encode the same stream. Each run plays a fixed number of frames,
+# as fast as possible. CPU time depends on the load of the system, so the
+# results are printed and not asserted.
+#
+################################################################################
+
+import sys
+sys.path.insert(0, "../../")
+import time
+import resource
+
+from dsl import *
+
+OUTPUT_COUNT = 3
+NUM_FRAMES = 300
+
+SOURCE_WIDTH = 1280
+SOURCE_HEIGHT = 720
+
+BITRATE = 4000000
+IFRAME_INTERVAL = 30
+
+## 
+# Function to be called on End-of-Stream (EOS) event
+## 
+def eos_event_listener(client_data):
+    dsl_main_loop_quit()
+
+##
+# Builds the encode Sinks for one run, returning the list of Sinks to add
+##
+def new_encode_sinks(codec, shared):
+
+    if shared:
+        retval = dsl_sink_shared_encode_new('shared-encode-sink', 
+            codec, BITRATE, IFRAME_INTERVAL)
+        if retval != DSL_RETURN_SUCCESS:
+            return retval, None
+        for i in range(OUTPUT_COUNT):
+            tap = 'file-tap-{}'.format(i)
+            retval = dsl_tap_file_new(tap, './shared-encode-{}.mp4'.format(i),
+                codec, DSL_CONTAINER_MP4)
+            if retval != DSL_RETURN_SUCCESS:
+                return retval, None
+            retval = dsl_sink_shared_encode_tap_add('shared-encode-sink', tap)
+            if retval != DSL_RETURN_SUCCESS:
+                return retval, None
+        return DSL_RETURN_SUCCESS, ['shared-encode-sink']
+
+    sinks = []
+    for i in range(OUTPUT_COUNT):
+        sink = 'file-sink-{}'.format(i)
+        retval = dsl_sink_file_new(sink, './separate-encode-{}.mp4'.format(i),
+            codec, DSL_CONTAINER_MP4, BITRATE, IFRAME_INTERVAL)
+        if retval != DSL_RETURN_SUCCESS:
+            return retval, None
+        sinks.append(sink)
+    return DSL_RETURN_SUCCESS, sinks
+
+##
+# Builds and runs one Pipeline, returning the CPU time and wall time for the run
+##
+def run_pipeline(codec, shared):
+
+    retval = dsl_source_test_new('source', False, DSL_TEST_PATTERN_BALL, 
+        SOURCE_WIDTH, SOURCE_HEIGHT, 30, 1, NUM_FRAMES)
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+    retval = dsl_tiler_new('tiler', SOURCE_WIDTH, SOURCE_HEIGHT)
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+    retval, sinks = new_encode_sinks(codec, shared)
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+
+    retval = dsl_pipeline_new_component_add_many('pipeline', 
+        ['source', 'tiler'] + sinks + [None])
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+    retval = dsl_pipeline_eos_listener_add('pipeline', eos_event_listener, None)
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+
+    usage = resource.getrusage(resource.RUSAGE_SELF)
+    start = time.time()
+    
+    retval = dsl_pipeline_play('pipeline')
+    if retval != DSL_RETURN_SUCCESS:
+        return retval, None
+    dsl_main_loop_run()
+    
+    elapsed = time.time() - start
+    end_usage = resource.getrusage(resource.RUSAGE_SELF)
+    
+    dsl_pipeline_stop('pipeline')
+    dsl_delete_all()
+    
+    cpu_time = (end_usage.ru_utime - usage.ru_utime) + \
+        (end_usage.ru_stime - usage.ru_stime)
+    
+    return DSL_RETURN_SUCCESS, (cpu_time, elapsed)
+
+def main(args):
+
+    # MPEG4 uses a software encoder, H264 the hardware encoder
+    codecs = [('MPEG4', DSL_CODEC_MPEG4), ('H264', DSL_CODEC_H264)]
+
+    print('{:<8}{:<12}{:<16}{:<16}'.format(
+        'Codec', 'Encoders', 'CPU time (s)', 'Wall time (s)'))
+
+    for codec_name, codec in codecs:
+        for shared in [True, False]:
+            retval, results = run_pipeline(codec, shared)
+            if retval != DSL_RETURN_SUCCESS:
+                print(dsl_return_value_to_string(retval))
+                dsl_delete_all()
+                return retval
+            cpu_time, elapsed = results
+            print('{:<8}{:<12}{:<16.2f}{:<16.2f}'.format(codec_name, 
+                1 if shared else OUTPUT_COUNT, cpu_time, elapsed))
+    
+    return 0
+    
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -28,7 +28,10 @@ THE SOFTWARE.
 #include <cstdlib>
 
 #include <gst/gst.h>
+#include <gst/video/video.h>
 #include <gst/video/videooverlay.h>
+#include <gst/app/gstappsrc.h>
+#include <gst/app/gstappsink.h>
 #include <gst/rtsp-server/rtsp-server.h>
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
@@ -42,12 +45,26 @@ THE SOFTWARE.
 #include <math.h>
 #include <fstream>
 #include <thread>
+#include <atomic>
 #include <chrono>
 #include <unordered_map>
 #include <typeinfo>
 #include <algorithm>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <dlfcn.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <sys/resource.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
 
 #include <deepstream_common.h>
 #include <deepstream_config.h>
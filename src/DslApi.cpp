@@ -320,6 +320,24 @@ DslReturnType dsl_ode_action_custom_new(const wchar_t* name,
     return DSL::Services::GetServices()->OdeActionCustomNew(cstrName.c_str(), client_hanlder, client_data);
 }
 
+DslReturnType dsl_ode_action_plugin_new(const wchar_t* name, 
+    const wchar_t* plugin, const wchar_t* config)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(plugin);
+    RETURN_IF_PARAM_IS_NULL(config);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrPlugin(plugin);
+    std::string cstrPlugin(wstrPlugin.begin(), wstrPlugin.end());
+    std::wstring wstrConfig(config);
+    std::string cstrConfig(wstrConfig.begin(), wstrConfig.end());
+
+    return DSL::Services::GetServices()->OdeActionPluginNew(cstrName.c_str(), 
+        cstrPlugin.c_str(), cstrConfig.c_str());
+}
+
 DslReturnType dsl_ode_action_capture_frame_new(const wchar_t* name, const wchar_t* outdir, boolean annotate)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -971,6 +989,30 @@ DslReturnType dsl_ode_trigger_custom_new(const wchar_t* name, const wchar_t* sou
     return DSL::Services::GetServices()->OdeTriggerCustomNew(cstrName.c_str(), cstrSource.c_str(), 
         class_id, limit, client_checker, client_post_processor, client_data);
 }
+
+DslReturnType dsl_ode_trigger_plugin_new(const wchar_t* name, const wchar_t* source, 
+    uint class_id, uint limit, const wchar_t* plugin, const wchar_t* config)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(plugin);
+    RETURN_IF_PARAM_IS_NULL(config);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrPlugin(plugin);
+    std::string cstrPlugin(wstrPlugin.begin(), wstrPlugin.end());
+    std::wstring wstrConfig(config);
+    std::string cstrConfig(wstrConfig.begin(), wstrConfig.end());
+
+    std::string cstrSource;
+    if (source)
+    {
+        std::wstring wstrSource(source);
+        cstrSource.assign(wstrSource.begin(), wstrSource.end());
+    }
+    return DSL::Services::GetServices()->OdeTriggerPluginNew(cstrName.c_str(), cstrSource.c_str(), 
+        class_id, limit, cstrPlugin.c_str(), cstrConfig.c_str());
+}
     
 DslReturnType dsl_ode_trigger_minimum_new(const wchar_t* name, const wchar_t* source, 
     uint class_id, uint limit, uint minimum)
@@ -1463,6 +1505,24 @@ DslReturnType dsl_pph_custom_new(const wchar_t* name,
     return DSL::Services::GetServices()->PphCustomNew(cstrName.c_str(), client_handler, client_data);
 }
 
+DslReturnType dsl_pph_plugin_new(const wchar_t* name,
+     const wchar_t* plugin, const wchar_t* config)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(plugin);
+    RETURN_IF_PARAM_IS_NULL(config);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrPlugin(plugin);
+    std::string cstrPlugin(wstrPlugin.begin(), wstrPlugin.end());
+    std::wstring wstrConfig(config);
+    std::string cstrConfig(wstrConfig.begin(), wstrConfig.end());
+
+    return DSL::Services::GetServices()->PphPluginNew(cstrName.c_str(), 
+        cstrPlugin.c_str(), cstrConfig.c_str());
+}
+
 DslReturnType dsl_pph_meter_new(const wchar_t* name, uint interval,
     dsl_pph_meter_client_handler_cb client_handler, void* client_data)
 {
@@ -1696,6 +1756,161 @@ DslReturnType dsl_source_rtsp_new(const wchar_t* name, const wchar_t* uri,
         protocol, cudadec_mem_type, intra_decode, dropFrameInterval, latency);
 }
 
+DslReturnType dsl_source_test_new(const wchar_t* name, boolean is_live, uint pattern,
+    uint width, uint height, uint fps_n, uint fps_d, uint num_frames)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceTestNew(cstrName.c_str(), is_live,
+        pattern, width, height, fps_n, fps_d, num_frames);
+}
+
+DslReturnType dsl_source_test_pattern_get(const wchar_t* name, uint* pattern)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(pattern);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceTestPatternGet(cstrName.c_str(), pattern);
+}
+
+DslReturnType dsl_source_test_pattern_set(const wchar_t* name, uint pattern)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceTestPatternSet(cstrName.c_str(), pattern);
+}
+
+DslReturnType dsl_source_app_new(const wchar_t* name, boolean is_live, uint format,
+    uint width, uint height, uint fps_n, uint fps_d)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppNew(cstrName.c_str(), is_live,
+        format, width, height, fps_n, fps_d);
+}
+
+DslReturnType dsl_source_app_data_handlers_add(const wchar_t* name, 
+    dsl_source_app_need_data_handler_cb need_data_handler, 
+    dsl_source_app_enough_data_handler_cb enough_data_handler, void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(need_data_handler);
+    RETURN_IF_PARAM_IS_NULL(enough_data_handler);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppDataHandlersAdd(cstrName.c_str(), 
+        need_data_handler, enough_data_handler, client_data);
+}
+
+DslReturnType dsl_source_app_data_handlers_remove(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppDataHandlersRemove(cstrName.c_str());
+}
+
+DslReturnType dsl_source_app_buffer_push(const wchar_t* name, void* data, uint size,
+    uint64_t pts, uint64_t duration, dsl_source_app_buffer_release_cb release, 
+    void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(data);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppBufferPush(cstrName.c_str(), 
+        data, size, pts, duration, release, client_data);
+}
+
+DslReturnType dsl_source_app_eos(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppEos(cstrName.c_str());
+}
+
+DslReturnType dsl_source_app_max_level_bytes_get(const wchar_t* name, uint64_t* max_bytes)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_bytes);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppMaxLevelBytesGet(cstrName.c_str(), 
+        max_bytes);
+}
+
+DslReturnType dsl_source_app_max_level_bytes_set(const wchar_t* name, uint64_t max_bytes)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppMaxLevelBytesSet(cstrName.c_str(), 
+        max_bytes);
+}
+
+DslReturnType dsl_source_playlist_new(const wchar_t* name, const wchar_t** files,
+    boolean repeat_enabled, uint cudadec_mem_type, uint intra_decode, uint dropFrameInterval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(files);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    std::vector<std::string> cstrFiles;
+    for (const wchar_t** file = files; *file; file++)
+    {
+        std::wstring wstrFile(*file);
+        cstrFiles.push_back(std::string(wstrFile.begin(), wstrFile.end()));
+    }
+    std::vector<const char*> cFiles;
+    for (auto const& ivec: cstrFiles)
+    {
+        cFiles.push_back(ivec.c_str());
+    }
+    cFiles.push_back(NULL);
+
+    return DSL::Services::GetServices()->SourcePlaylistNew(cstrName.c_str(), &cFiles[0], 
+        repeat_enabled, cudadec_mem_type, intra_decode, dropFrameInterval);
+}
+
+DslReturnType dsl_source_playlist_index_get(const wchar_t* name, uint* index, uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(index);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourcePlaylistIndexGet(cstrName.c_str(), index, size);
+}
+
 DslReturnType dsl_source_dimensions_get(const wchar_t* name, uint* width, uint* height)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -1751,6 +1966,27 @@ DslReturnType dsl_source_decode_uri_set(const wchar_t* name, const wchar_t* uri)
     return DSL::Services::GetServices()->SourceDecodeUriSet(cstrName.c_str(), cstrUri.c_str());
 }
 
+DslReturnType dsl_source_decode_repeat_enabled_get(const wchar_t* name, boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceDecodeRepeatEnabledGet(cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_source_decode_repeat_enabled_set(const wchar_t* name, boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceDecodeRepeatEnabledSet(cstrName.c_str(), enabled);
+}
+
 DslReturnType dsl_source_decode_dewarper_add(const wchar_t* name, const wchar_t* dewarper)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -1797,6 +2033,113 @@ DslReturnType dsl_source_rtsp_tap_remove(const wchar_t* name)
     return DSL::Services::GetServices()->SourceRtspTapRemove(cstrName.c_str());
 }
 
+DslReturnType dsl_source_rtsp_timeout_get(const wchar_t* name, uint* timeout)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(timeout);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceRtspTimeoutGet(cstrName.c_str(), timeout);
+}
+
+DslReturnType dsl_source_rtsp_timeout_set(const wchar_t* name, uint timeout)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceRtspTimeoutSet(cstrName.c_str(), timeout);
+}
+
+DslReturnType dsl_source_rtsp_reconnection_params_get(const wchar_t* name, 
+    uint* backoff_min, uint* backoff_max)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(backoff_min);
+    RETURN_IF_PARAM_IS_NULL(backoff_max);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceRtspReconnectionParamsGet(cstrName.c_str(), 
+        backoff_min, backoff_max);
+}
+
+DslReturnType dsl_source_rtsp_reconnection_params_set(const wchar_t* name, 
+    uint backoff_min, uint backoff_max)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceRtspReconnectionParamsSet(cstrName.c_str(), 
+        backoff_min, backoff_max);
+}
+
+DslReturnType dsl_source_rtsp_connection_data_get(const wchar_t* name, 
+    uint* state, uint* reconnect_count, const wchar_t** last_error)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(state);
+    RETURN_IF_PARAM_IS_NULL(reconnect_count);
+    RETURN_IF_PARAM_IS_NULL(last_error);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    std::string cstrLastError;
+    static std::wstring wcstrLastError;
+    
+    uint retval = DSL::Services::GetServices()->SourceRtspConnectionDataGet(cstrName.c_str(), 
+        state, reconnect_count, cstrLastError);
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        wcstrLastError.assign(cstrLastError.begin(), cstrLastError.end());
+        *last_error = wcstrLastError.c_str();
+    }
+    return retval;
+}
+
+DslReturnType dsl_source_rtsp_connection_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceRtspConnectionStatsClear(cstrName.c_str());
+}
+
+DslReturnType dsl_source_rtsp_state_change_listener_add(const wchar_t* name, 
+    dsl_rtsp_connection_state_change_listener_cb listener, void* user_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(listener);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceRtspStateChangeListenerAdd(cstrName.c_str(), 
+        listener, user_data);
+}
+
+DslReturnType dsl_source_rtsp_state_change_listener_remove(const wchar_t* name, 
+    dsl_rtsp_connection_state_change_listener_cb listener)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(listener);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceRtspStateChangeListenerRemove(cstrName.c_str(), 
+        listener);
+}
+
 DslReturnType dsl_source_name_get(uint source_id, const wchar_t** name)
 {
     const char* cName;
@@ -1971,50 +2314,181 @@ DslReturnType dsl_tap_record_reset_done_get(const wchar_t* name, boolean* reset_
     return DSL::Services::GetServices()->TapRecordResetDoneGet(cstrName.c_str(), reset_done);
 }
 
-DslReturnType dsl_gie_primary_new(const wchar_t* name, const wchar_t* infer_config_file,
-    const wchar_t* model_engine_file, uint interval)
+DslReturnType dsl_tap_ring_record_new(const wchar_t* name, const wchar_t* outdir, 
+    uint container, uint64_t max_bytes, dsl_ring_record_complete_listener_cb client_listener)
 {
     RETURN_IF_PARAM_IS_NULL(name);
-    RETURN_IF_PARAM_IS_NULL(infer_config_file);
-    RETURN_IF_PARAM_IS_NULL(model_engine_file);
+    RETURN_IF_PARAM_IS_NULL(outdir);
+    
+    // Note: client_listener is optional in this case
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
-    std::wstring wstrConfig(infer_config_file);
-    std::string cstrConfig(wstrConfig.begin(), wstrConfig.end());
-    std::wstring wstrEngine(model_engine_file);
-    std::string cstrEngine(wstrEngine.begin(), wstrEngine.end());
-    
-    return DSL::Services::GetServices()->PrimaryGieNew(cstrName.c_str(), cstrConfig.c_str(),
-        cstrEngine.c_str(), interval);
-}
+    std::wstring wstrOutdir(outdir);
+    std::string cstrOutdir(wstrOutdir.begin(), wstrOutdir.end());
 
-DslReturnType dsl_gie_primary_pph_add(const wchar_t* name, 
-    const wchar_t* handler, uint pad)
+    return DSL::Services::GetServices()->TapRingRecordNew(cstrName.c_str(), 
+        cstrOutdir.c_str(), container, max_bytes, client_listener);
+}     
+
+DslReturnType dsl_tap_ring_record_session_start(const wchar_t* name, 
+    uint* session, uint pre_event, uint post_event, void* client_data)
 {
     RETURN_IF_PARAM_IS_NULL(name);
-    RETURN_IF_PARAM_IS_NULL(handler);
+    RETURN_IF_PARAM_IS_NULL(session);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
-    std::wstring wstrHandler(handler);
-    std::string cstrHandler(wstrHandler.begin(), wstrHandler.end());
-    
-    return DSL::Services::GetServices()->PrimaryGiePphAdd(cstrName.c_str(), cstrHandler.c_str(), pad);
+
+    return DSL::Services::GetServices()->TapRingRecordSessionStart(cstrName.c_str(), 
+        session, pre_event, post_event, client_data);
 }
 
-DslReturnType dsl_gie_primary_pph_remove(const wchar_t* name,
-    const wchar_t* handler, uint pad)
+DslReturnType dsl_tap_ring_record_session_stop(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
-    RETURN_IF_PARAM_IS_NULL(handler);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
-    std::wstring wstrHandler(handler);
-    std::string cstrHandler(wstrHandler.begin(), wstrHandler.end());
-    
-    return DSL::Services::GetServices()->PrimaryGiePphRemove(cstrName.c_str(), cstrHandler.c_str(), pad);
+
+    return DSL::Services::GetServices()->TapRingRecordSessionStop(cstrName.c_str());
+}
+
+DslReturnType dsl_tap_ring_record_max_bytes_get(const wchar_t* name, uint64_t* max_bytes)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_bytes);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->TapRingRecordMaxBytesGet(cstrName.c_str(), max_bytes);
+}
+
+DslReturnType dsl_tap_ring_record_max_bytes_set(const wchar_t* name, uint64_t max_bytes)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->TapRingRecordMaxBytesSet(cstrName.c_str(), max_bytes);
+}
+
+DslReturnType dsl_tap_ring_record_cache_level_get(const wchar_t* name, 
+    uint64_t* bytes, uint* duration)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(bytes);
+    RETURN_IF_PARAM_IS_NULL(duration);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->TapRingRecordCacheLevelGet(cstrName.c_str(), 
+        bytes, duration);
+}
+
+DslReturnType dsl_tap_ring_record_is_on_get(const wchar_t* name, boolean* is_on)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(is_on);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->TapRingRecordIsOnGet(cstrName.c_str(), is_on);
+}
+
+DslReturnType dsl_tap_file_new(const wchar_t* name, const wchar_t* filepath, 
+    uint codec, uint container)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(filepath);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrFilepath(filepath);
+    std::string cstrFilepath(wstrFilepath.begin(), wstrFilepath.end());
+
+    return DSL::Services::GetServices()->TapFileNew(cstrName.c_str(), 
+        cstrFilepath.c_str(), codec, container);
+}
+
+DslReturnType dsl_tap_rtsp_new(const wchar_t* name, const wchar_t* host, 
+    uint udp_port, uint rtsp_port, uint codec)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(host);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrHost(host);
+    std::string cstrHost(wstrHost.begin(), wstrHost.end());
+
+    return DSL::Services::GetServices()->TapRtspNew(cstrName.c_str(), 
+        cstrHost.c_str(), udp_port, rtsp_port, codec);
+}
+
+DslReturnType dsl_tap_rtsp_server_settings_get(const wchar_t* name,
+    uint* udp_port, uint* rtsp_port, uint* codec)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(udp_port);
+    RETURN_IF_PARAM_IS_NULL(rtsp_port);
+    RETURN_IF_PARAM_IS_NULL(codec);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->TapRtspServerSettingsGet(cstrName.c_str(), 
+        udp_port, rtsp_port, codec);
+}
+
+DslReturnType dsl_gie_primary_new(const wchar_t* name, const wchar_t* infer_config_file,
+    const wchar_t* model_engine_file, uint interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(infer_config_file);
+    RETURN_IF_PARAM_IS_NULL(model_engine_file);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrConfig(infer_config_file);
+    std::string cstrConfig(wstrConfig.begin(), wstrConfig.end());
+    std::wstring wstrEngine(model_engine_file);
+    std::string cstrEngine(wstrEngine.begin(), wstrEngine.end());
+    
+    return DSL::Services::GetServices()->PrimaryGieNew(cstrName.c_str(), cstrConfig.c_str(),
+        cstrEngine.c_str(), interval);
+}
+
+DslReturnType dsl_gie_primary_pph_add(const wchar_t* name, 
+    const wchar_t* handler, uint pad)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(handler);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrHandler(handler);
+    std::string cstrHandler(wstrHandler.begin(), wstrHandler.end());
+    
+    return DSL::Services::GetServices()->PrimaryGiePphAdd(cstrName.c_str(), cstrHandler.c_str(), pad);
+}
+
+DslReturnType dsl_gie_primary_pph_remove(const wchar_t* name,
+    const wchar_t* handler, uint pad)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(handler);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrHandler(handler);
+    std::string cstrHandler(wstrHandler.begin(), wstrHandler.end());
+    
+    return DSL::Services::GetServices()->PrimaryGiePphRemove(cstrName.c_str(), cstrHandler.c_str(), pad);
 }
 
 DslReturnType dsl_gie_secondary_new(const wchar_t* name, const wchar_t* infer_config_file,
@@ -2128,6 +2602,59 @@ DslReturnType dsl_gie_interval_set(const wchar_t* name, uint interval)
     return DSL::Services::GetServices()->GieIntervalSet(cstrName.c_str(), interval);
 }
 
+DslReturnType dsl_gie_primary_interval_adaptive_get(const wchar_t* name, 
+    boolean* enabled, uint* min_interval, uint* max_interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+    RETURN_IF_PARAM_IS_NULL(min_interval);
+    RETURN_IF_PARAM_IS_NULL(max_interval);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->PrimaryGieIntervalAdaptiveGet(cstrName.c_str(), 
+        enabled, min_interval, max_interval);
+}
+
+DslReturnType dsl_gie_primary_interval_adaptive_set(const wchar_t* name, 
+    boolean enabled, uint min_interval, uint max_interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->PrimaryGieIntervalAdaptiveSet(cstrName.c_str(), 
+        enabled, min_interval, max_interval);
+}
+
+DslReturnType dsl_gie_primary_interval_listener_add(const wchar_t* name, 
+    dsl_gie_interval_change_listener_cb listener, void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(listener);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->PrimaryGieIntervalListenerAdd(cstrName.c_str(), 
+        listener, client_data);
+}
+
+DslReturnType dsl_gie_primary_interval_listener_remove(const wchar_t* name, 
+    dsl_gie_interval_change_listener_cb listener)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(listener);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->PrimaryGieIntervalListenerRemove(cstrName.c_str(), 
+        listener);
+}
+
 
 DslReturnType dsl_gie_raw_output_enabled_set(const wchar_t* name, boolean enabled, const wchar_t* path)
 {
@@ -2165,6 +2692,45 @@ DslReturnType dsl_tracker_iou_new(const wchar_t* name, const wchar_t* config_fil
     return DSL::Services::GetServices()->TrackerIouNew(cstrName.c_str(), cstrFile.c_str(), width, height);
 }
 
+DslReturnType dsl_tracker_cpu_iou_new(const wchar_t* name, 
+    uint max_age, float iou_threshold, uint max_tracks)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->TrackerCpuIouNew(cstrName.c_str(), 
+        max_age, iou_threshold, max_tracks);
+}
+
+DslReturnType dsl_tracker_cpu_iou_settings_get(const wchar_t* name, 
+    uint* max_age, float* iou_threshold, uint* max_tracks)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_age);
+    RETURN_IF_PARAM_IS_NULL(iou_threshold);
+    RETURN_IF_PARAM_IS_NULL(max_tracks);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->TrackerCpuIouSettingsGet(cstrName.c_str(), 
+        max_age, iou_threshold, max_tracks);
+}
+
+DslReturnType dsl_tracker_cpu_iou_settings_set(const wchar_t* name, 
+    uint max_age, float iou_threshold, uint max_tracks)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->TrackerCpuIouSettingsSet(cstrName.c_str(), 
+        max_age, iou_threshold, max_tracks);
+}
+
 DslReturnType dsl_tracker_max_dimensions_get(const wchar_t* name, uint* width, uint* height)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -2647,6 +3213,29 @@ DslReturnType dsl_tiler_source_show_all(const wchar_t* name)
     return DSL::Services::GetServices()->TilerSourceShowAll(cstrName.c_str());
 }
 
+DslReturnType dsl_tiler_frame_pruning_enabled_get(const wchar_t* name, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    return DSL::Services::GetServices()->TilerFramePruningEnabledGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_tiler_frame_pruning_enabled_set(const wchar_t* name, 
+    boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    return DSL::Services::GetServices()->TilerFramePruningEnabledSet(
+        cstrName.c_str(), enabled);
+}
+
 DslReturnType dsl_tiler_pph_add(const wchar_t* name, const wchar_t* handler, uint pad)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -2683,148 +3272,457 @@ DslReturnType dsl_sink_fake_new(const wchar_t* name)
     return DSL::Services::GetServices()->SinkFakeNew(cstrName.c_str());
 }
 
-DslReturnType dsl_sink_overlay_new(const wchar_t* name, uint overlay_id, uint display_id,
-    uint depth, uint offsetX, uint offsetY, uint width, uint height)
+DslReturnType dsl_sink_app_new(const wchar_t* name, 
+    dsl_sink_app_new_data_handler_cb handler, void* client_data)
 {
     RETURN_IF_PARAM_IS_NULL(name);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SinkOverlayNew(cstrName.c_str(), overlay_id, 
-        display_id, depth, offsetX, offsetY, width, height);
+    return DSL::Services::GetServices()->SinkAppNew(cstrName.c_str(), 
+        handler, client_data);
 }
 
-DslReturnType dsl_sink_window_new(const wchar_t* name,
-    uint offsetX, uint offsetY, uint width, uint height)
+DslReturnType dsl_sink_app_data_pull(const wchar_t* name, uint timeout, 
+    void** buffer, void** data, uint* size, void** batch_meta)
 {
     RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(buffer);
+    RETURN_IF_PARAM_IS_NULL(data);
+    RETURN_IF_PARAM_IS_NULL(size);
+    RETURN_IF_PARAM_IS_NULL(batch_meta);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SinkWindowNew(cstrName.c_str(), 
-        offsetX, offsetY, width, height);
+    return DSL::Services::GetServices()->SinkAppDataPull(cstrName.c_str(), 
+        timeout, buffer, data, size, batch_meta);
 }
 
-DslReturnType dsl_sink_file_new(const wchar_t* name, const wchar_t* filepath, 
-     uint codec, uint container, uint bitrate, uint interval)
+DslReturnType dsl_sink_app_data_release(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
-    RETURN_IF_PARAM_IS_NULL(filepath);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
-    std::wstring wstrPath(filepath);
-    std::string cstrPath(wstrPath.begin(), wstrPath.end());
 
-    return DSL::Services::GetServices()->SinkFileNew(cstrName.c_str(), 
-        cstrPath.c_str(), codec, container, bitrate, interval);
-}     
+    return DSL::Services::GetServices()->SinkAppDataRelease(cstrName.c_str());
+}
 
-DslReturnType dsl_sink_encode_video_formats_get(const wchar_t* name,
-    uint* codec, uint* container)
-{    
+DslReturnType dsl_sink_app_max_buffers_get(const wchar_t* name, 
+    uint* max_buffers, boolean* drop)
+{
     RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_buffers);
+    RETURN_IF_PARAM_IS_NULL(drop);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
-    
-    return DSL::Services::GetServices()->SinkEncodeVideoFormatsGet(cstrName.c_str(), 
-        codec, container);
+
+    return DSL::Services::GetServices()->SinkAppMaxBuffersGet(cstrName.c_str(), 
+        max_buffers, drop);
 }
 
-DslReturnType dsl_sink_encode_settings_get(const wchar_t* name,
-    uint* bitrate, uint* interval)
+DslReturnType dsl_sink_app_max_buffers_set(const wchar_t* name, 
+    uint max_buffers, boolean drop)
 {
     RETURN_IF_PARAM_IS_NULL(name);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
-    
-    return DSL::Services::GetServices()->SinkEncodeSettingsGet(cstrName.c_str(), 
-        bitrate, interval);
-}    
 
-DslReturnType dsl_sink_encode_settings_set(const wchar_t* name,
-    uint bitrate, uint interval)
+    return DSL::Services::GetServices()->SinkAppMaxBuffersSet(cstrName.c_str(), 
+        max_buffers, drop);
+}
+
+DslReturnType dsl_sink_meta_new(const wchar_t* name, 
+    const wchar_t* path, uint mode, uint frames_per_write)
 {
     RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(path);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
-    
-    return DSL::Services::GetServices()->SinkEncodeSettingsSet(cstrName.c_str(), 
-        bitrate, interval);
+    std::wstring wstrPath(path);
+    std::string cstrPath(wstrPath.begin(), wstrPath.end());
+
+    return DSL::Services::GetServices()->SinkMetaNew(cstrName.c_str(), 
+        cstrPath.c_str(), mode, frames_per_write);
 }
 
-DslReturnType dsl_sink_record_new(const wchar_t* name, const wchar_t* outdir, 
-     uint codec, uint container, uint bitrate, uint interval, dsl_record_client_listner_cb client_listener)
+DslReturnType dsl_sink_meta_stats_get(const wchar_t* name, 
+    uint64_t* frames_written, uint64_t* frames_dropped)
 {
     RETURN_IF_PARAM_IS_NULL(name);
-    RETURN_IF_PARAM_IS_NULL(outdir);
-
-    //Note client_listener is optional in the case.
+    RETURN_IF_PARAM_IS_NULL(frames_written);
+    RETURN_IF_PARAM_IS_NULL(frames_dropped);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
-    std::wstring wstrOutdir(outdir);
-    std::string cstrOutdir(wstrOutdir.begin(), wstrOutdir.end());
 
-    return DSL::Services::GetServices()->SinkRecordNew(cstrName.c_str(), 
-        cstrOutdir.c_str(), codec, container, bitrate, interval, client_listener);
-}     
+    return DSL::Services::GetServices()->SinkMetaStatsGet(cstrName.c_str(), 
+        frames_written, frames_dropped);
+}
 
-DslReturnType dsl_sink_record_session_start(const wchar_t* name, 
-     uint* session, uint start, uint duration,void* client_data)
+DslReturnType dsl_sink_meta_stats_clear(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SinkRecordSessionStart(cstrName.c_str(), 
-        session, start, duration, client_data);
-}     
+    return DSL::Services::GetServices()->SinkMetaStatsClear(cstrName.c_str());
+}
 
-DslReturnType dsl_sink_record_session_stop(const wchar_t* name, uint session)
+DslReturnType dsl_sink_overlay_new(const wchar_t* name, uint overlay_id, uint display_id,
+    uint depth, uint offsetX, uint offsetY, uint width, uint height)
 {
     RETURN_IF_PARAM_IS_NULL(name);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SinkRecordSessionStop(cstrName.c_str(), session);
+    return DSL::Services::GetServices()->SinkOverlayNew(cstrName.c_str(), overlay_id, 
+        display_id, depth, offsetX, offsetY, width, height);
 }
 
-DslReturnType dsl_sink_record_cache_size_get(const wchar_t* name, uint* cache_size)
+DslReturnType dsl_sink_window_new(const wchar_t* name,
+    uint offsetX, uint offsetY, uint width, uint height)
 {
     RETURN_IF_PARAM_IS_NULL(name);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SinkRecordCacheSizeGet(cstrName.c_str(), cache_size);
+    return DSL::Services::GetServices()->SinkWindowNew(cstrName.c_str(), 
+        offsetX, offsetY, width, height);
 }
 
-DslReturnType dsl_sink_record_cache_size_set(const wchar_t* name, uint cache_size)
+DslReturnType dsl_sink_render_max_fps_get(const wchar_t* name, uint* max_fps)
 {
     RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_fps);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SinkRecordCacheSizeSet(cstrName.c_str(), cache_size);
+    return DSL::Services::GetServices()->SinkRenderMaxFpsGet(cstrName.c_str(), 
+        max_fps);
 }
- 
-DslReturnType dsl_sink_record_dimensions_get(const wchar_t* name, uint* width, uint* height)
+
+DslReturnType dsl_sink_render_max_fps_set(const wchar_t* name, uint max_fps)
 {
     RETURN_IF_PARAM_IS_NULL(name);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SinkRecordDimensionsGet(cstrName.c_str(), width, height);
+    return DSL::Services::GetServices()->SinkRenderMaxFpsSet(cstrName.c_str(), 
+        max_fps);
+}
+
+DslReturnType dsl_sink_window_pause_when_hidden_get(const wchar_t* name, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkWindowPauseWhenHiddenGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_sink_window_pause_when_hidden_set(const wchar_t* name, 
+    boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkWindowPauseWhenHiddenSet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_sink_file_new(const wchar_t* name, const wchar_t* filepath, 
+     uint codec, uint container, uint bitrate, uint interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(filepath);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrPath(filepath);
+    std::string cstrPath(wstrPath.begin(), wstrPath.end());
+
+    return DSL::Services::GetServices()->SinkFileNew(cstrName.c_str(), 
+        cstrPath.c_str(), codec, container, bitrate, interval);
+}     
+
+DslReturnType dsl_sink_segment_new(const wchar_t* name, const wchar_t* file_pattern, 
+     uint codec, uint container, uint bitrate, uint interval, 
+     uint max_duration, uint max_files)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(file_pattern);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrPattern(file_pattern);
+    std::string cstrPattern(wstrPattern.begin(), wstrPattern.end());
+
+    return DSL::Services::GetServices()->SinkSegmentNew(cstrName.c_str(), 
+        cstrPattern.c_str(), codec, container, bitrate, interval, 
+        max_duration, max_files);
+}     
+
+DslReturnType dsl_sink_segment_max_duration_get(const wchar_t* name, 
+    uint* max_duration)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_duration);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkSegmentMaxDurationGet(cstrName.c_str(), 
+        max_duration);
+}
+
+DslReturnType dsl_sink_segment_max_duration_set(const wchar_t* name, 
+    uint max_duration)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkSegmentMaxDurationSet(cstrName.c_str(), 
+        max_duration);
+}
+
+DslReturnType dsl_sink_segment_max_size_get(const wchar_t* name, 
+    uint64_t* max_size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkSegmentMaxSizeGet(cstrName.c_str(), 
+        max_size);
+}
+
+DslReturnType dsl_sink_segment_max_size_set(const wchar_t* name, 
+    uint64_t max_size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkSegmentMaxSizeSet(cstrName.c_str(), 
+        max_size);
+}
+
+DslReturnType dsl_sink_segment_max_files_get(const wchar_t* name, 
+    uint* max_files)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_files);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkSegmentMaxFilesGet(cstrName.c_str(), 
+        max_files);
+}
+
+DslReturnType dsl_sink_segment_max_files_set(const wchar_t* name, 
+    uint max_files)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkSegmentMaxFilesSet(cstrName.c_str(), 
+        max_files);
+}
+
+DslReturnType dsl_sink_segment_write_settings_get(const wchar_t* name, 
+    uint* buffer_size, uint* fsync_interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(buffer_size);
+    RETURN_IF_PARAM_IS_NULL(fsync_interval);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkSegmentWriteSettingsGet(cstrName.c_str(), 
+        buffer_size, fsync_interval);
+}
+
+DslReturnType dsl_sink_segment_write_settings_set(const wchar_t* name, 
+    uint buffer_size, uint fsync_interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkSegmentWriteSettingsSet(cstrName.c_str(), 
+        buffer_size, fsync_interval);
+}
+
+DslReturnType dsl_sink_shared_encode_new(const wchar_t* name, 
+    uint codec, uint bitrate, uint interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkSharedEncodeNew(cstrName.c_str(), 
+        codec, bitrate, interval);
+}
+
+DslReturnType dsl_sink_shared_encode_tap_add(const wchar_t* name, const wchar_t* tap)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(tap);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrTap(tap);
+    std::string cstrTap(wstrTap.begin(), wstrTap.end());
+
+    return DSL::Services::GetServices()->SinkSharedEncodeTapAdd(cstrName.c_str(), 
+        cstrTap.c_str());
+}
+
+DslReturnType dsl_sink_shared_encode_tap_remove(const wchar_t* name, const wchar_t* tap)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(tap);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrTap(tap);
+    std::string cstrTap(wstrTap.begin(), wstrTap.end());
+
+    return DSL::Services::GetServices()->SinkSharedEncodeTapRemove(cstrName.c_str(), 
+        cstrTap.c_str());
+}
+
+DslReturnType dsl_sink_encode_video_formats_get(const wchar_t* name,
+    uint* codec, uint* container)
+{    
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->SinkEncodeVideoFormatsGet(cstrName.c_str(), 
+        codec, container);
+}
+
+DslReturnType dsl_sink_encode_settings_get(const wchar_t* name,
+    uint* bitrate, uint* interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->SinkEncodeSettingsGet(cstrName.c_str(), 
+        bitrate, interval);
+}    
+
+DslReturnType dsl_sink_encode_settings_set(const wchar_t* name,
+    uint bitrate, uint interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->SinkEncodeSettingsSet(cstrName.c_str(), 
+        bitrate, interval);
+}
+
+DslReturnType dsl_sink_record_new(const wchar_t* name, const wchar_t* outdir, 
+     uint codec, uint container, uint bitrate, uint interval, dsl_record_client_listner_cb client_listener)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(outdir);
+
+    //Note client_listener is optional in the case.
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrOutdir(outdir);
+    std::string cstrOutdir(wstrOutdir.begin(), wstrOutdir.end());
+
+    return DSL::Services::GetServices()->SinkRecordNew(cstrName.c_str(), 
+        cstrOutdir.c_str(), codec, container, bitrate, interval, client_listener);
+}     
+
+DslReturnType dsl_sink_record_session_start(const wchar_t* name, 
+     uint* session, uint start, uint duration,void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkRecordSessionStart(cstrName.c_str(), 
+        session, start, duration, client_data);
+}     
+
+DslReturnType dsl_sink_record_session_stop(const wchar_t* name, uint session)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkRecordSessionStop(cstrName.c_str(), session);
+}
+
+DslReturnType dsl_sink_record_cache_size_get(const wchar_t* name, uint* cache_size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkRecordCacheSizeGet(cstrName.c_str(), cache_size);
+}
+
+DslReturnType dsl_sink_record_cache_size_set(const wchar_t* name, uint cache_size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkRecordCacheSizeSet(cstrName.c_str(), cache_size);
+}
+ 
+DslReturnType dsl_sink_record_dimensions_get(const wchar_t* name, uint* width, uint* height)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkRecordDimensionsGet(cstrName.c_str(), width, height);
 }
 
 DslReturnType dsl_sink_record_dimensions_set(const wchar_t* name, uint width, uint height)
@@ -2906,6 +3804,48 @@ DslReturnType dsl_sink_rtsp_encoder_settings_set(const wchar_t* name,
     return DSL::Services::GetServices()->SinkRtspEncoderSettingsSet(cstrName.c_str(), bitrate, interval);
 }
 
+DslReturnType dsl_sink_rtsp_bitrate_adaptive_get(const wchar_t* name,
+    boolean* enabled, uint* min_bitrate, uint* max_bitrate)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+    RETURN_IF_PARAM_IS_NULL(min_bitrate);
+    RETURN_IF_PARAM_IS_NULL(max_bitrate);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->SinkRtspBitrateAdaptiveGet(cstrName.c_str(), 
+        enabled, min_bitrate, max_bitrate);
+}
+
+DslReturnType dsl_sink_rtsp_bitrate_adaptive_set(const wchar_t* name,
+    boolean enabled, uint min_bitrate, uint max_bitrate)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->SinkRtspBitrateAdaptiveSet(cstrName.c_str(), 
+        enabled, min_bitrate, max_bitrate);
+}
+
+DslReturnType dsl_sink_rtsp_stream_status_get(const wchar_t* name,
+    uint* client_count, uint* bitrate, boolean* is_encoding)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(client_count);
+    RETURN_IF_PARAM_IS_NULL(bitrate);
+    RETURN_IF_PARAM_IS_NULL(is_encoding);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->SinkRtspStreamStatusGet(cstrName.c_str(), 
+        client_count, bitrate, is_encoding);
+}
+
 DslReturnType dsl_sink_pph_add(const wchar_t* name, const wchar_t* handler)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3310,6 +4250,66 @@ DslReturnType dsl_pipeline_component_remove_many(const wchar_t* pipeline,
     return DSL_RESULT_SUCCESS;
 }
 
+DslReturnType dsl_pipeline_source_standby_add(const wchar_t* pipeline, 
+    const wchar_t* source)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(source);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    std::wstring wstrSource(source);
+    std::string cstrSource(wstrSource.begin(), wstrSource.end());
+
+    return DSL::Services::GetServices()->PipelineSourceStandbyAdd(cstrPipeline.c_str(), 
+        cstrSource.c_str());
+}
+
+DslReturnType dsl_pipeline_source_standby_remove(const wchar_t* pipeline, 
+    const wchar_t* source)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(source);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    std::wstring wstrSource(source);
+    std::string cstrSource(wstrSource.begin(), wstrSource.end());
+
+    return DSL::Services::GetServices()->PipelineSourceStandbyRemove(cstrPipeline.c_str(), 
+        cstrSource.c_str());
+}
+
+DslReturnType dsl_pipeline_source_standby_attach(const wchar_t* pipeline, 
+    const wchar_t* source)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(source);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    std::wstring wstrSource(source);
+    std::string cstrSource(wstrSource.begin(), wstrSource.end());
+
+    return DSL::Services::GetServices()->PipelineSourceStandbyAttach(cstrPipeline.c_str(), 
+        cstrSource.c_str());
+}
+
+DslReturnType dsl_pipeline_source_standby_detach(const wchar_t* pipeline, 
+    const wchar_t* source)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(source);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    std::wstring wstrSource(source);
+    std::string cstrSource(wstrSource.begin(), wstrSource.end());
+
+    return DSL::Services::GetServices()->PipelineSourceStandbyDetach(cstrPipeline.c_str(), 
+        cstrSource.c_str());
+}
+
 DslReturnType dsl_pipeline_streammux_batch_properties_get(const wchar_t* pipeline, 
     uint* batchSize, uint* batchTimeout)
 {
@@ -3366,6 +4366,256 @@ DslReturnType dsl_pipeline_streammux_padding_set(const wchar_t* pipeline, boolea
     return DSL::Services::GetServices()->PipelineStreamMuxPaddingSet(cstrPipeline.c_str(), enabled);
 }
 
+DslReturnType dsl_pipeline_streammux_batch_timeout_adaptive_get(const wchar_t* pipeline, 
+    boolean* enabled, uint* jitter_margin)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineStreamMuxBatchTimeoutAdaptiveGet(
+        cstrPipeline.c_str(), enabled, jitter_margin);
+}
+
+DslReturnType dsl_pipeline_streammux_batch_timeout_adaptive_set(const wchar_t* pipeline, 
+    boolean enabled, uint jitter_margin)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineStreamMuxBatchTimeoutAdaptiveSet(
+        cstrPipeline.c_str(), enabled, jitter_margin);
+}
+
+DslReturnType dsl_pipeline_streammux_batch_stats_get(const wchar_t* pipeline, 
+    uint* batch_timeout, double* fill_ratio)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineStreamMuxBatchStatsGet(
+        cstrPipeline.c_str(), batch_timeout, fill_ratio);
+}
+
+DslReturnType dsl_pipeline_streammux_batch_size_adaptive_get(const wchar_t* pipeline, 
+    boolean* enabled, uint* hysteresis)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineStreamMuxBatchSizeAdaptiveGet(
+        cstrPipeline.c_str(), enabled, hysteresis);
+}
+
+DslReturnType dsl_pipeline_streammux_batch_size_adaptive_set(const wchar_t* pipeline, 
+    boolean enabled, uint hysteresis)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineStreamMuxBatchSizeAdaptiveSet(
+        cstrPipeline.c_str(), enabled, hysteresis);
+}
+
+DslReturnType dsl_pipeline_sgie_cache_settings_get(const wchar_t* pipeline, 
+    boolean* enabled, uint* max_age, float* min_confidence)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+    RETURN_IF_PARAM_IS_NULL(max_age);
+    RETURN_IF_PARAM_IS_NULL(min_confidence);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineSgieCacheSettingsGet(
+        cstrPipeline.c_str(), enabled, max_age, min_confidence);
+}
+
+DslReturnType dsl_pipeline_sgie_cache_settings_set(const wchar_t* pipeline, 
+    boolean enabled, uint max_age, float min_confidence)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineSgieCacheSettingsSet(
+        cstrPipeline.c_str(), enabled, max_age, min_confidence);
+}
+
+DslReturnType dsl_pipeline_sgie_cache_stats_get(const wchar_t* pipeline, 
+    uint64_t* hits, uint64_t* misses)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(hits);
+    RETURN_IF_PARAM_IS_NULL(misses);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineSgieCacheStatsGet(
+        cstrPipeline.c_str(), hits, misses);
+}
+
+DslReturnType dsl_pipeline_main_context_enabled_get(const wchar_t* pipeline, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineMainContextEnabledGet(
+        cstrPipeline.c_str(), enabled);
+}
+
+DslReturnType dsl_pipeline_main_context_enabled_set(const wchar_t* pipeline, 
+    boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineMainContextEnabledSet(
+        cstrPipeline.c_str(), enabled);
+}
+
+DslReturnType dsl_pipeline_qos_element_stats_get(const wchar_t* pipeline, 
+    const wchar_t* element, uint64_t* processed, uint64_t* dropped, 
+    int64_t* jitter, double* proportion)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(element);
+    RETURN_IF_PARAM_IS_NULL(processed);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+    RETURN_IF_PARAM_IS_NULL(jitter);
+    RETURN_IF_PARAM_IS_NULL(proportion);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    std::wstring wstrElement(element);
+    std::string cstrElement(wstrElement.begin(), wstrElement.end());
+
+    return DSL::Services::GetServices()->PipelineQosElementStatsGet(
+        cstrPipeline.c_str(), cstrElement.c_str(), processed, dropped, 
+        jitter, proportion);
+}
+
+DslReturnType dsl_pipeline_qos_totals_get(const wchar_t* pipeline, 
+    uint* elements, uint64_t* dropped)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(elements);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineQosTotalsGet(
+        cstrPipeline.c_str(), elements, dropped);
+}
+
+DslReturnType dsl_pipeline_qos_stats_clear(const wchar_t* pipeline)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineQosStatsClear(
+        cstrPipeline.c_str());
+}
+
+DslReturnType dsl_pipeline_qos_listener_add(const wchar_t* pipeline, 
+    dsl_qos_listener_cb listener, uint threshold, void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(listener);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineQosListenerAdd(
+        cstrPipeline.c_str(), listener, threshold, client_data);
+}
+
+DslReturnType dsl_pipeline_qos_listener_remove(const wchar_t* pipeline, 
+    dsl_qos_listener_cb listener)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(listener);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineQosListenerRemove(
+        cstrPipeline.c_str(), listener);
+}
+
+DslReturnType dsl_pipeline_thread_policy_set(const wchar_t* pipeline, 
+    const wchar_t* component, uint64_t cpu_mask, uint sched_policy, int priority)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    
+    std::string cstrComponent;
+    if (component)
+    {
+        std::wstring wstrComponent(component);
+        cstrComponent.assign(wstrComponent.begin(), wstrComponent.end());
+    }
+
+    return DSL::Services::GetServices()->PipelineThreadPolicySet(
+        cstrPipeline.c_str(), cstrComponent.c_str(), cpu_mask, sched_policy, priority);
+}
+
+DslReturnType dsl_pipeline_thread_policy_remove(const wchar_t* pipeline, 
+    const wchar_t* component)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    
+    std::string cstrComponent;
+    if (component)
+    {
+        std::wstring wstrComponent(component);
+        cstrComponent.assign(wstrComponent.begin(), wstrComponent.end());
+    }
+
+    return DSL::Services::GetServices()->PipelineThreadPolicyRemove(
+        cstrPipeline.c_str(), cstrComponent.c_str());
+}
+
+DslReturnType dsl_pipeline_thread_report_get(const wchar_t* pipeline, 
+    const wchar_t** report)
+{
+    RETURN_IF_PARAM_IS_NULL(pipeline);
+    RETURN_IF_PARAM_IS_NULL(report);
+
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    const char* cReport(NULL);
+    static std::string cstrReport;
+    static std::wstring wcstrReport;
+    
+    uint retval = DSL::Services::GetServices()->PipelineThreadReportGet(
+        cstrPipeline.c_str(), &cReport);
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        cstrReport.assign(cReport);
+        wcstrReport.assign(cstrReport.begin(), cstrReport.end());
+        *report = wcstrReport.c_str();
+    }
+    return retval;
+}
+
 DslReturnType dsl_pipeline_xwindow_clear(const wchar_t* pipeline)
 {
     std::wstring wstrPipeline(pipeline);
@@ -3586,6 +4836,70 @@ DslReturnType dsl_pipeline_xwindow_delete_event_handler_remove(const wchar_t* pi
         PipelineXWindowDeleteEventHandlerRemove(cstrPipeline.c_str(), handler);
 }
 
+DslReturnType dsl_metrics_http_exporter_start(uint port)
+{
+    return DSL::Services::GetServices()->MetricsHttpExporterStart(port);
+}
+
+DslReturnType dsl_metrics_http_exporter_stop()
+{
+    return DSL::Services::GetServices()->MetricsHttpExporterStop();
+}
+
+DslReturnType dsl_metrics_file_exporter_start(const wchar_t* file_path, uint interval)
+{
+    RETURN_IF_PARAM_IS_NULL(file_path);
+
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->MetricsFileExporterStart(
+        cstrFilePath.c_str(), interval);
+}
+
+DslReturnType dsl_metrics_file_exporter_stop()
+{
+    return DSL::Services::GetServices()->MetricsFileExporterStop();
+}
+
+uint dsl_metrics_list_size()
+{
+    return DSL::Services::GetServices()->MetricsListSize();
+}
+
+DslReturnType dsl_plugin_load(const wchar_t* name, const wchar_t* path)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(path);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrPath(path);
+    std::string cstrPath(wstrPath.begin(), wstrPath.end());
+
+    return DSL::Services::GetServices()->PluginLoad(cstrName.c_str(), cstrPath.c_str());
+}
+
+DslReturnType dsl_plugin_delete(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PluginDelete(cstrName.c_str());
+}
+
+DslReturnType dsl_plugin_delete_all()
+{
+    return DSL::Services::GetServices()->PluginDeleteAll();
+}
+
+uint dsl_plugin_list_size()
+{
+    return DSL::Services::GetServices()->PluginListSize();
+}
+
 void dsl_delete_all()
 {
     dsl_pipeline_delete_all();
@@ -3595,6 +4909,7 @@ void dsl_delete_all()
     dsl_ode_area_delete_all();
     dsl_ode_action_delete_all();
     dsl_display_type_delete_all();
+    dsl_plugin_delete_all();
 }
 
 
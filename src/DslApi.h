@@ -74,6 +74,10 @@ THE SOFTWARE.
 #define DSL_RESULT_SOURCE_TAP_ADD_FAILED                            0x0002000E
 #define DSL_RESULT_SOURCE_TAP_REMOVE_FAILED                         0x0002000F
 #define DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE                   0x00020010
+#define DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED                       0x00020011
+#define DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED                    0x00020012
+#define DSL_RESULT_SOURCE_SET_FAILED                                0x00020013
+#define DSL_RESULT_SOURCE_BUFFER_PUSH_FAILED                        0x00020014
 
 /**
  * Dewarper API Return Values
@@ -101,6 +105,7 @@ THE SOFTWARE.
 #define DSL_RESULT_TRACKER_HANDLER_REMOVE_FAILED                    0x0003000A
 #define DSL_RESULT_TRACKER_PAD_TYPE_INVALID                         0x0003000B
 #define DSL_RESULT_TRACKER_COMPONENT_IS_NOT_TRACKER                 0x0003000C
+#define DSL_RESULT_TRACKER_SETTINGS_INVALID                         0x0003000D
 
 /**
  * Sink API Return Values
@@ -121,6 +126,12 @@ THE SOFTWARE.
 #define DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_REMOVE_FAILED          0x0004000E
 #define DSL_RESULT_SINK_HANDLER_ADD_FAILED                          0x0004000F
 #define DSL_RESULT_SINK_HANDLER_REMOVE_FAILED                       0x00040010
+#define DSL_RESULT_SINK_APP_DATA_NOT_AVAILABLE                      0x00040011
+#define DSL_RESULT_SINK_META_MODE_INVALID                           0x00040012
+#define DSL_RESULT_SINK_SEGMENT_PATTERN_INVALID                     0x00040013
+#define DSL_RESULT_SINK_TAP_ADD_FAILED                              0x00040014
+#define DSL_RESULT_SINK_TAP_REMOVE_FAILED                           0x00040015
+#define DSL_RESULT_SINK_COMPONENT_IS_NOT_RENDER_SINK                0x00040016
 
 /**
  * OSD API Return Values
@@ -172,6 +183,8 @@ THE SOFTWARE.
 #define DSL_RESULT_GIE_PAD_TYPE_INVALID                             0x0006000B
 #define DSL_RESULT_GIE_COMPONENT_IS_NOT_GIE                         0x0006000C
 #define DSL_RESULT_GIE_OUTPUT_DIR_DOES_NOT_EXIST                    0x0006000D
+#define DSL_RESULT_GIE_LISTENER_ADD_FAILED                          0x0006000E
+#define DSL_RESULT_GIE_LISTENER_REMOVE_FAILED                       0x0006000F
 
 /**
  * Demuxer API Return Values
@@ -227,6 +240,13 @@ THE SOFTWARE.
 #define DSL_RESULT_PIPELINE_FAILED_TO_STOP                          0x00080011
 #define DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED               0x00080012
 #define DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED                 0x00080013
+#define DSL_RESULT_PIPELINE_SOURCE_ATTACH_FAILED                    0x00080014
+#define DSL_RESULT_PIPELINE_SOURCE_DETACH_FAILED                    0x00080015
+#define DSL_RESULT_PIPELINE_SGIE_CACHE_SET_FAILED                   0x00080016
+#define DSL_RESULT_PIPELINE_MAIN_CONTEXT_SET_FAILED                 0x00080017
+#define DSL_RESULT_PIPELINE_QOS_ELEMENT_NOT_FOUND                   0x00080018
+#define DSL_RESULT_PIPELINE_THREAD_POLICY_SET_FAILED                0x00080019
+#define DSL_RESULT_PIPELINE_THREAD_POLICY_REMOVE_FAILED             0x0008001A
 
 #define DSL_RESULT_BRANCH_RESULT                                    0x000B0000
 #define DSL_RESULT_BRANCH_NAME_NOT_UNIQUE                           0x000B0001
@@ -330,6 +350,27 @@ THE SOFTWARE.
 #define DSL_RESULT_TAP_COMPONENT_IS_NOT_TAP                         0x00200006
 #define DSL_RESULT_TAP_FILE_PATH_NOT_FOUND                          0x00200007
 #define DSL_RESULT_TAP_CONTAINER_VALUE_INVALID                      0x00200008
+#define DSL_RESULT_TAP_CODEC_VALUE_INVALID                          0x00200009
+
+/**
+ * Metrics API Return Values
+ */
+#define DSL_RESULT_METRICS_RESULT                                   0x00300000
+#define DSL_RESULT_METRICS_THREW_EXCEPTION                          0x00300001
+#define DSL_RESULT_METRICS_EXPORTER_START_FAILED                    0x00300002
+#define DSL_RESULT_METRICS_EXPORTER_STOP_FAILED                     0x00300003
+
+/**
+ * Plugin API Return Values
+ */
+#define DSL_RESULT_PLUGIN_RESULT                                    0x00400000
+#define DSL_RESULT_PLUGIN_NAME_NOT_UNIQUE                           0x00400001
+#define DSL_RESULT_PLUGIN_NAME_NOT_FOUND                            0x00400002
+#define DSL_RESULT_PLUGIN_THREW_EXCEPTION                           0x00400003
+#define DSL_RESULT_PLUGIN_FILE_NOT_FOUND                            0x00400004
+#define DSL_RESULT_PLUGIN_LOAD_FAILED                               0x00400005
+#define DSL_RESULT_PLUGIN_CALLBACK_NOT_FOUND                        0x00400006
+#define DSL_RESULT_PLUGIN_CREATE_FAILED                             0x00400007
 
 /**
  *
@@ -350,6 +391,12 @@ THE SOFTWARE.
 #define DSL_CONTAINER_MP4                                           0
 #define DSL_CONTAINER_MKV                                           1
 
+#define DSL_META_SINK_MODE_FILE                                     0
+#define DSL_META_SINK_MODE_SOCKET                                   1
+
+// Version of the Meta Sink's binary message format, written in each header
+#define DSL_META_SINK_FORMAT_VERSION                                1
+
 #define DSL_STATE_NULL                                              1
 #define DSL_STATE_READY                                             2
 #define DSL_STATE_PAUSED                                            3
@@ -357,12 +404,51 @@ THE SOFTWARE.
 #define DSL_STATE_IN_TRANSITION                                     5
 #define DSL_STATE_INVALID_STATE_VALUE                               UINT32_MAX
 
+#define DSL_THREAD_SCHED_OTHER                                      0
+#define DSL_THREAD_SCHED_FIFO                                       1
+
 #define DSL_PAD_SINK                                                0
 #define DSL_PAD_SRC                                                 1
 
 #define DSL_RTP_TCP                                                 0x04
 #define DSL_RTP_ALL                                                 0x07
 
+#define DSL_RTSP_CONNECTION_STATE_IDLE                              0
+#define DSL_RTSP_CONNECTION_STATE_CONNECTED                         1
+#define DSL_RTSP_CONNECTION_STATE_RECONNECTING                      2
+
+#define DSL_TEST_PATTERN_SMPTE                                      0
+#define DSL_TEST_PATTERN_SNOW                                       1
+#define DSL_TEST_PATTERN_BLACK                                      2
+#define DSL_TEST_PATTERN_WHITE                                      3
+#define DSL_TEST_PATTERN_RED                                        4
+#define DSL_TEST_PATTERN_GREEN                                      5
+#define DSL_TEST_PATTERN_BLUE                                       6
+#define DSL_TEST_PATTERN_CHECKERS_1                                 7
+#define DSL_TEST_PATTERN_CHECKERS_2                                 8
+#define DSL_TEST_PATTERN_CHECKERS_4                                 9
+#define DSL_TEST_PATTERN_CHECKERS_8                                 10
+#define DSL_TEST_PATTERN_CIRCULAR                                   11
+#define DSL_TEST_PATTERN_BLINK                                      12
+#define DSL_TEST_PATTERN_SMPTE75                                    13
+#define DSL_TEST_PATTERN_ZONE_PLATE                                 14
+#define DSL_TEST_PATTERN_GAMUT                                      15
+#define DSL_TEST_PATTERN_CHROMA_ZONE_PLATE                          16
+#define DSL_TEST_PATTERN_SOLID_COLOR                                17
+#define DSL_TEST_PATTERN_BALL                                       18
+#define DSL_TEST_PATTERN_SMPTE100                                   19
+#define DSL_TEST_PATTERN_BAR                                        20
+#define DSL_TEST_PATTERN_PINWHEEL                                   21
+#define DSL_TEST_PATTERN_SPOKES                                     22
+#define DSL_TEST_PATTERN_GRADIENT                                   23
+#define DSL_TEST_PATTERN_COLORS                                     24
+
+#define DSL_VIDEO_FORMAT_I420                                       0
+#define DSL_VIDEO_FORMAT_NV12                                       1
+#define DSL_VIDEO_FORMAT_RGBA                                       2
+
+#define DSL_APP_SOURCE_TIMESTAMP_NONE                               0xFFFFFFFFFFFFFFFF
+
 #define DSL_CAPTURE_TYPE_OBJECT                                     0
 #define DSL_CAPTURE_TYPE_FRAME                                      1
 
@@ -390,7 +476,70 @@ THE SOFTWARE.
 #define DSL_DEFAULT_STREAMMUX_HEIGHT                                1080
 #define DSL_DEFAULT_STATE_CHANGE_TIMEOUT_IN_SEC                     10
 
+// Adaptive Stream Muxer batch-timeout controller defaults, all values in microseconds
+// other than the update interval which is in milliseconds
+#define DSL_DEFAULT_STREAMMUX_ADAPTIVE_JITTER_MARGIN                5000
+#define DSL_DEFAULT_STREAMMUX_ADAPTIVE_MIN_BATCH_TIMEOUT            1000
+#define DSL_DEFAULT_STREAMMUX_ADAPTIVE_UPDATE_INTERVAL              1000
+#define DSL_DEFAULT_STREAMMUX_ADAPTIVE_BATCH_SIZE_HYSTERESIS        2
+
 #define DSL_DEFAULT_VIDEO_RECORD_CACHE_IN_SEC                       30
+
+// Byte budget for a Ring Record Tap's ring buffer of encoded packets, 32 MB
+#define DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES                       33554432
+
+// Minimum number of recycled buffers held by an App Source's buffer pool, used 
+// when client frames are copied rather than wrapped
+#define DSL_DEFAULT_APP_SOURCE_MIN_POOL_BUFFERS                     4
+
+#define DSL_DEFAULT_APP_SINK_MAX_BUFFERS                            4
+
+// Segment Sink defaults. The write buffer size is in bytes, the fsync interval 
+// in milliseconds with 0 disabling the periodic fsync
+#define DSL_DEFAULT_SEGMENT_SINK_WRITE_BUFFER_SIZE                  1048576
+#define DSL_DEFAULT_SEGMENT_SINK_FSYNC_INTERVAL                     1000
+
+// RTSP Source stream watchdog defaults, all values in seconds. 
+// A buffer timeout of 0 disables the watchdog
+#define DSL_DEFAULT_RTSP_BUFFER_TIMEOUT                             0
+#define DSL_DEFAULT_RTSP_RECONNECT_BACKOFF_MIN                      1
+#define DSL_DEFAULT_RTSP_RECONNECT_BACKOFF_MAX                      32
+
+// RTSP Sink adaptive bitrate controller defaults. Loss thresholds are in units 
+// of 1/256 as reported by RTCP, jitter in milliseconds, and the update interval 
+// in milliseconds
+#define DSL_DEFAULT_RTSP_SINK_ADAPTIVE_UPDATE_INTERVAL              1000
+#define DSL_DEFAULT_RTSP_SINK_ADAPTIVE_HIGH_LOSS                    26
+#define DSL_DEFAULT_RTSP_SINK_ADAPTIVE_LOW_LOSS                     5
+#define DSL_DEFAULT_RTSP_SINK_ADAPTIVE_MAX_JITTER                   30
+
+// Primary GIE adaptive interval controller defaults. Queue fill and latency 
+// thresholds are in percent, latency relative to the period of the incoming 
+// batches. Hysteresis values are in consecutive update periods, and the update 
+// interval is in milliseconds
+#define DSL_DEFAULT_GIE_ADAPTIVE_UPDATE_INTERVAL                    1000
+#define DSL_DEFAULT_GIE_ADAPTIVE_HIGH_QUEUE_FILL                    50
+#define DSL_DEFAULT_GIE_ADAPTIVE_LOW_QUEUE_FILL                     10
+#define DSL_DEFAULT_GIE_ADAPTIVE_HIGH_LATENCY                       90
+#define DSL_DEFAULT_GIE_ADAPTIVE_LOW_LATENCY                        60
+#define DSL_DEFAULT_GIE_ADAPTIVE_MIN_THROUGHPUT                     90
+#define DSL_DEFAULT_GIE_ADAPTIVE_UP_HYSTERESIS                      2
+#define DSL_DEFAULT_GIE_ADAPTIVE_DOWN_HYSTERESIS                    5
+#define DSL_DEFAULT_GIE_ADAPTIVE_MAX_BATCHES_IN_FLIGHT              64
+
+// Secondary GIE classifier result cache defaults. The max age is in frames, and
+// the purge interval, for lost tracks, in batches
+#define DSL_DEFAULT_SGIE_CACHE_MAX_AGE                              30
+#define DSL_DEFAULT_SGIE_CACHE_MIN_CONFIDENCE                       0.5
+#define DSL_DEFAULT_SGIE_CACHE_PURGE_INTERVAL                       30
+
+// CPU IOU Tracker defaults. The max age is in frames, and the max tracks per source
+#define DSL_DEFAULT_CPU_IOU_TRACKER_MAX_AGE                         10
+#define DSL_DEFAULT_CPU_IOU_TRACKER_IOU_THRESHOLD                   0.3
+#define DSL_DEFAULT_CPU_IOU_TRACKER_MAX_TRACKS                      128
+
+// Maximum time to wait, for each step, when detaching a Tee branch while playing
+#define DSL_DEFAULT_TEE_BRANCH_DETACH_TIMEOUT_IN_MS                 1000
 #define DSL_DEFAULT_VIDEO_RECORD_DURATION_IN_SEC                    30
 
 EXTERN_C_BEGIN
@@ -472,6 +621,71 @@ typedef void (*dsl_state_change_listener_cb)(uint prev_state, uint curr_state, v
  */
 typedef void (*dsl_eos_listener_cb)(void* user_data);
 
+/**
+ * @brief callback typedef for a client listener function. Once added to a Pipeline, 
+ * the function will be called when an element's dropped count, as reported by its
+ * QoS messages, increases by the listener's threshold or more.
+ * @param[in] element path of the GStreamer element that posted the QoS message
+ * @param[in] processed total buffers processed by the element
+ * @param[in] dropped total buffers dropped by the element
+ * @param[in] jitter running average of the absolute jitter in nanoseconds
+ * @param[in] proportion long term proportion from the element's last QoS message
+ * @param[in] client_data opaque pointer to client's data
+ */
+typedef void (*dsl_qos_listener_cb)(const wchar_t* element, uint64_t processed, 
+    uint64_t dropped, int64_t jitter, double proportion, void* client_data);
+
+/**
+ * @brief callback typedef for a client listener function. Once added to an RTSP Source, 
+ * the function will be called when the Source's connection state changes.
+ * @param[in] prev_state one of DSL_RTSP_CONNECTION_STATE constants for the previous state
+ * @param[in] curr_state one of DSL_RTSP_CONNECTION_STATE constants for the current state
+ * @param[in] user_data opaque pointer to client's data
+ */
+typedef void (*dsl_rtsp_connection_state_change_listener_cb)(uint prev_state, 
+    uint curr_state, void* user_data);
+
+/**
+ * @brief callback typedef for a client need-data handler function. Once added to an 
+ * App Source, the function will be called when the Source's queue is running low
+ * and the client should start pushing buffers.
+ * @param[in] length the amount of bytes needed, 0 if unknown.
+ * @param[in] client_data opaque pointer to client's data
+ */
+typedef void (*dsl_source_app_need_data_handler_cb)(uint length, void* client_data);
+
+/**
+ * @brief callback typedef for a client enough-data handler function. Once added to an 
+ * App Source, the function will be called when the Source's queue is full and the 
+ * client should stop pushing buffers until the next need-data call.
+ * @param[in] client_data opaque pointer to client's data
+ */
+typedef void (*dsl_source_app_enough_data_handler_cb)(void* client_data);
+
+/**
+ * @brief callback typedef for a client buffer release function. Passed to the
+ * App Source with a buffer to push, the function will be called once the Pipeline
+ * has finished with the client's memory.
+ * @param[in] data pointer to the client memory that was pushed
+ * @param[in] client_data opaque pointer to client's data
+ */
+typedef void (*dsl_source_app_buffer_release_cb)(void* data, void* client_data);
+
+/**
+ * @brief callback typedef for a client new-data handler function. Passed to an 
+ * App Sink on creation, the function will be called, from the Sink's own thread,
+ * with each new buffer received. The mapped data is read-only and only valid
+ * for the duration of the call.
+ * @param[in] buffer pointer to the GstBuffer received
+ * @param[in] data mapped read-only view of the buffer data. For NVMM buffers,
+ * this is a pointer to the buffer's NvBufSurface.
+ * @param[in] size size of the mapped data in bytes
+ * @param[in] batch_meta pointer to the buffer's NvDsBatchMeta, NULL if none
+ * @param[in] client_data opaque pointer to client's data
+ */
+typedef void (*dsl_sink_app_new_data_handler_cb)(void* buffer, void* data, 
+    uint size, void* batch_meta, void* client_data);
+
 /**
  * @brief callback typedef for a client XWindow KeyRelease event handler function. Once added to a Pipeline, 
  * the function will be called when the Pipeline receives XWindow KeyRelease events.
@@ -503,6 +717,29 @@ typedef void (*dsl_xwindow_delete_event_handler_cb)(void* user_data);
  */
 typedef void* (*dsl_record_client_listner_cb)(void* info, void* user_data);
 
+/**
+ * @brief callback typedef for a client to listen for the completion of a 
+ * Ring Record Tap session. Called on the session's own thread once the
+ * recording file has been finalized.
+ * @param[in] session unique id of the completed session
+ * @param[in] file_path path to the recording file
+ * @param[in] success true if the file was written successfully, false otherwise
+ * @param[in] client_data opaque pointer to client's user data provided on session start
+ */
+typedef void (*dsl_ring_record_complete_listener_cb)(uint session, 
+    const wchar_t* file_path, boolean success, void* client_data);
+
+/**
+ * @brief callback typedef for a client to listen for changes to the infer
+ * interval made by a Primary GIE's adaptive interval controller. Called from
+ * the main-loop context on each change.
+ * @param[in] prev_interval the infer interval in use before the change
+ * @param[in] curr_interval the infer interval now in use
+ * @param[in] client_data opaque pointer to client's user data provided on add
+ */
+typedef void (*dsl_gie_interval_change_listener_cb)(uint prev_interval, 
+    uint curr_interval, void* client_data);
+
 /**
  * @brief creates a uniquely named RGBA Display Color
  * @param[in] name unique name for the RGBA Color
@@ -683,6 +920,18 @@ uint dsl_display_type_list_size();
 DslReturnType dsl_ode_action_custom_new(const wchar_t* name, 
     dsl_ode_handle_occurrence_cb client_handler, void* client_data);
 
+/**
+ * @brief Creates a uniquely named ODE Plugin Action, with its handler provided
+ * by a new instance of a loaded Plugin.
+ * @param[in] name unique name for the ODE Plugin Action 
+ * @param[in] plugin unique name of the Plugin to create the instance from
+ * @param[in] config opaque config string passed to the Plugin's create function
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT 
+ * or DSL_RESULT_PLUGIN_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_plugin_new(const wchar_t* name, 
+    const wchar_t* plugin, const wchar_t* config);
+
 /**
  * @brief Creates a uniquely named Capture Frame ODE Action
  * @param[in] name unique name for the Capture Frame ODE Action 
@@ -1137,6 +1386,21 @@ DslReturnType dsl_ode_trigger_custom_new(const wchar_t* name, const wchar_t* sou
     uint class_id, uint limit, dsl_ode_check_for_occurrence_cb client_checker, 
     dsl_ode_post_process_frame_cb client_post_processor, void* client_data);
 
+/**
+ * @brief Custom ODE Trigger with its check-for-occurrence and post-process-frame
+ * functions provided by a new instance of a loaded Plugin.
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] source unique source name filter for the ODE Trigger, NULL = ANY_SOURCE
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] plugin unique name of the Plugin to create the instance from
+ * @param[in] config opaque config string passed to the Plugin's create function
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_TRIGGER_RESULT 
+ * or DSL_RESULT_PLUGIN_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_plugin_new(const wchar_t* name, const wchar_t* source, 
+    uint class_id, uint limit, const wchar_t* plugin, const wchar_t* config);
+
 /**
  * @brief Miniumu occurence trigger that checks for the occurrence of Objects within a frame
  * against a specified minimum number, and generates an ODE occurence if not met
@@ -1512,6 +1776,18 @@ DslReturnType dsl_pph_ode_trigger_remove_all(const wchar_t* name);
  */
 DslReturnType dsl_pph_custom_new(const wchar_t* name,
      dsl_pph_custom_client_handler_cb client_handler, void* client_data);
+
+/**
+ * @brief creates a new, uniquely named Plugin pad-probe-handler, with its handler
+ * provided by a new instance of a loaded Plugin.
+ * @param[in] name unique component name for the new Plugin Handler
+ * @param[in] plugin unique name of the Plugin to create the instance from
+ * @param[in] config opaque config string passed to the Plugin's create function
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT 
+ * or DSL_RESULT_PLUGIN_RESULT otherwise
+ */
+DslReturnType dsl_pph_plugin_new(const wchar_t* name,
+     const wchar_t* plugin, const wchar_t* config);
      
 /**
  * @brief creates a new, uniquely named Meter pad-probe-handler to calcaulate performance measurements
@@ -1634,6 +1910,144 @@ DslReturnType dsl_source_uri_new(const wchar_t* name, const wchar_t* uri, boolea
 DslReturnType dsl_source_rtsp_new(const wchar_t* name, const wchar_t* uri, uint protocol,
     uint cudadec_mem_type, uint intra_decode, uint drop_frame_interval, uint latency);
 
+/**
+ * @brief creates a new, uniquely named Test Source component. The Source generates
+ * a synthetic test pattern, requiring no camera device, media file or decoder.
+ * @param[in] name unique name for the new Source
+ * @param[in] is_live set to true to generate frames in real-time at the framerate,
+ * false to generate frames as fast as the Pipeline will consume them.
+ * @param[in] pattern one of the DSL_TEST_PATTERN constant values
+ * @param[in] width width of the test pattern in pixels
+ * @param[in] height height of the test pattern in pixels
+ * @param[in] fps_n frames/second fraction numerator
+ * @param[in] fps_d frames/second fraction denominator
+ * @param[in] num_frames number of frames to generate before end-of-stream, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_test_new(const wchar_t* name, boolean is_live, uint pattern,
+    uint width, uint height, uint fps_n, uint fps_d, uint num_frames);
+
+/**
+ * @brief gets the current test pattern in use by the named Test Source
+ * @param[in] name unique name of the Test Source to query
+ * @param[out] pattern one of the DSL_TEST_PATTERN constant values
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_test_pattern_get(const wchar_t* name, uint* pattern);
+
+/**
+ * @brief sets the test pattern for the named Test Source to use. 
+ * The pattern can be updated while the Source is playing.
+ * @param[in] name unique name of the Test Source to update
+ * @param[in] pattern one of the DSL_TEST_PATTERN constant values
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_test_pattern_set(const wchar_t* name, uint pattern);
+
+/**
+ * @brief creates a new, uniquely named App Source component. The client pushes
+ * raw video frames into the Pipeline from application memory.
+ * @param[in] name unique name for the new Source
+ * @param[in] is_live set to true if the client is pushing frames in real-time.
+ * @param[in] format one of the DSL_VIDEO_FORMAT constant values
+ * @param[in] width width of the client frames in pixels
+ * @param[in] height height of the client frames in pixels
+ * @param[in] fps_n frames/second fraction numerator
+ * @param[in] fps_d frames/second fraction denominator
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_new(const wchar_t* name, boolean is_live, uint format,
+    uint width, uint height, uint fps_n, uint fps_d);
+
+/**
+ * @brief adds need-data and enough-data handlers to the named App Source for 
+ * the client to regulate the rate at which it pushes buffers.
+ * @param[in] name unique name of the App Source to update
+ * @param[in] need_data_handler client function to call when more data is needed
+ * @param[in] enough_data_handler client function to call when the queue is full
+ * @param[in] client_data opaque pointer to client data passed into both handlers
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_data_handlers_add(const wchar_t* name, 
+    dsl_source_app_need_data_handler_cb need_data_handler, 
+    dsl_source_app_enough_data_handler_cb enough_data_handler, void* client_data);
+
+/**
+ * @brief removes the data handlers previously added with dsl_source_app_data_handlers_add
+ * @param[in] name unique name of the App Source to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_data_handlers_remove(const wchar_t* name);
+
+/**
+ * @brief pushes a raw video frame into the named App Source. If a release function
+ * is provided, the client's memory is wrapped without copying and must remain valid
+ * until the release function is called. Otherwise, the frame is copied into a 
+ * recycled buffer from the Source's buffer pool before returning.
+ * @param[in] name unique name of the App Source to push to
+ * @param[in] data pointer to the client's frame data
+ * @param[in] size size of the frame data in bytes
+ * @param[in] pts presentation timestamp in nanoseconds, or DSL_APP_SOURCE_TIMESTAMP_NONE
+ * to have the Source timestamp the buffer with the current running-time.
+ * @param[in] duration duration of the frame in nanoseconds, or DSL_APP_SOURCE_TIMESTAMP_NONE
+ * @param[in] release client function to call when the Pipeline is done with data, or NULL
+ * @param[in] client_data opaque pointer to client data passed to the release function
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffer_push(const wchar_t* name, void* data, uint size,
+    uint64_t pts, uint64_t duration, dsl_source_app_buffer_release_cb release, 
+    void* client_data);
+
+/**
+ * @brief signals the end-of-stream to the named App Source. No more buffers
+ * can be pushed until the Pipeline is stopped and played again.
+ * @param[in] name unique name of the App Source to end
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_eos(const wchar_t* name);
+
+/**
+ * @brief gets the maximum number of bytes the named App Source will queue 
+ * before calling the client's enough-data handler.
+ * @param[in] name unique name of the App Source to query
+ * @param[out] max_bytes current maximum queue level in bytes, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_max_level_bytes_get(const wchar_t* name, uint64_t* max_bytes);
+
+/**
+ * @brief sets the maximum number of bytes the named App Source will queue 
+ * before calling the client's enough-data handler.
+ * @param[in] name unique name of the App Source to update
+ * @param[in] max_bytes new maximum queue level in bytes, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_max_level_bytes_set(const wchar_t* name, uint64_t max_bytes);
+
+/**
+ * @brief creates a new, uniquely named Playlist Source component. The files are
+ * played in order as a single continuous stream, without restarting the decoder.
+ * All files in the playlist must use the same codec.
+ * @param[in] name unique name for the new Source
+ * @param[in] files NULL terminated array of file paths to play in order
+ * @param[in] repeat_enabled set to true to restart the playlist on completion
+ * @param[in] cudadec_mem_type, use DSL_CUDADEC_MEMORY_TYPE_<type>
+ * @param[in] intra_decode
+ * @param[in] drop_frame_interval
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_playlist_new(const wchar_t* name, const wchar_t** files, 
+    boolean repeat_enabled, uint cudadec_mem_type, uint intra_decode, uint drop_frame_interval);
+
+/**
+ * @brief gets the index of the file currently playing for the named Playlist Source
+ * @param[in] name unique name of the Playlist Source to query
+ * @param[out] index index of the current file, starting at 0
+ * @param[out] size number of files in the playlist
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_playlist_index_get(const wchar_t* name, uint* index, uint* size);
+
 /**
  * @brief returns the frame rate of the name source as a fraction
  * Camera sources will return the value used on source creation
@@ -1672,6 +2086,24 @@ DslReturnType dsl_source_decode_uri_get(const wchar_t* name, const wchar_t** uri
  */
 DslReturnType dsl_source_decode_uri_set(const wchar_t* name, const wchar_t* uri);
 
+/**
+ * @brief Gets the current repeat enabled setting for the named Decode Source
+ * @param[in] name name of the Source to query
+ * @param[out] enabled true if the file stream is repeated on end-of-stream
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_decode_repeat_enabled_get(const wchar_t* name, boolean* enabled);
+
+/**
+ * @brief Sets the repeat enabled setting for the named Decode Source. URI file
+ * Sources are repeated gaplessly, with continuous timestamps, using segment seeks. 
+ * Playlist Sources restart with the first file. Not supported by live Sources.
+ * @param[in] name name of the Source to update
+ * @param[in] enabled set to true to repeat the file stream on end-of-stream
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_decode_repeat_enabled_set(const wchar_t* name, boolean enabled);
+
 /**
  * @brief Adds a named dewarper to a named decode source (URI, RTSP)
  * @param[in] name name of the source object to update
@@ -1702,6 +2134,85 @@ DslReturnType dsl_source_rtsp_tap_add(const wchar_t* name, const wchar_t* tap);
  */
 DslReturnType dsl_source_rtsp_tap_remove(const wchar_t* name);
 
+/**
+ * @brief Gets the current buffer timeout for the named RTSP Source's stream watchdog
+ * @param[in] name name of the source object to query
+ * @param[out] timeout time to wait for a new buffer before reconnecting in seconds, 
+ * 0 = watchdog disabled
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_timeout_get(const wchar_t* name, uint* timeout);
+
+/**
+ * @brief Sets the buffer timeout for the named RTSP Source's stream watchdog. If no
+ * buffer is received within the timeout, the Source's rtspsrc, depay, parser and decoder
+ * are restarted while the rest of the Pipeline continues to play.
+ * @param[in] name name of the source object to update
+ * @param[in] timeout time to wait for a new buffer before reconnecting in seconds, 
+ * set to 0 to disable the watchdog
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_timeout_set(const wchar_t* name, uint timeout);
+
+/**
+ * @brief Gets the current reconnection params for the named RTSP Source
+ * @param[in] name name of the source object to query
+ * @param[out] backoff_min initial wait between reconnection attempts in seconds
+ * @param[out] backoff_max maximum wait between reconnection attempts in seconds
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_reconnection_params_get(const wchar_t* name, 
+    uint* backoff_min, uint* backoff_max);
+
+/**
+ * @brief Sets the reconnection params for the named RTSP Source. The wait between
+ * attempts starts at backoff_min and doubles with each failed attempt up to backoff_max.
+ * @param[in] name name of the source object to update
+ * @param[in] backoff_min initial wait between reconnection attempts in seconds
+ * @param[in] backoff_max maximum wait between reconnection attempts in seconds
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_reconnection_params_set(const wchar_t* name, 
+    uint backoff_min, uint backoff_max);
+
+/**
+ * @brief Gets the current connection data for the named RTSP Source
+ * @param[in] name name of the source object to query
+ * @param[out] state one of the DSL_RTSP_CONNECTION_STATE constants
+ * @param[out] reconnect_count number of reconnection attempts since the last clear
+ * @param[out] last_error the last error message received from the Source's 
+ * rtspsrc, or an empty string if none.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_connection_data_get(const wchar_t* name, 
+    uint* state, uint* reconnect_count, const wchar_t** last_error);
+
+/**
+ * @brief Clears the reconnect count and last error for the named RTSP Source
+ * @param[in] name name of the source object to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_connection_stats_clear(const wchar_t* name);
+
+/**
+ * @brief adds a callback to be notified on change of RTSP Source connection state
+ * @param[in] name name of the RTSP Source to update
+ * @param[in] listener pointer to the client's function to call on state change
+ * @param[in] user_data opaque pointer to client data passed into the listener function.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_state_change_listener_add(const wchar_t* name, 
+    dsl_rtsp_connection_state_change_listener_cb listener, void* user_data);
+
+/**
+ * @brief removes a callback previously added with dsl_source_rtsp_state_change_listener_add
+ * @param[in] name name of the RTSP Source to update
+ * @param[in] listener pointer to the client's function to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_rtsp_state_change_listener_remove(const wchar_t* name, 
+    dsl_rtsp_connection_state_change_listener_cb listener);
+
 /**
  * @brief returns the name of a Source component from a unqiue Source Id
  * @param[in] source_id unique Source Id to check for
@@ -1854,6 +2365,115 @@ DslReturnType dsl_tap_record_is_on_get(const wchar_t* name, boolean* is_on);
  */
 DslReturnType dsl_tap_record_reset_done_get(const wchar_t* name, boolean* reset_done);
 
+/**
+ * @brief creates a new, uniquely named Ring Record Tap component. The Tap holds 
+ * the encoded stream in a keyframe-aligned ring buffer with a fixed byte budget,
+ * and writes the pre and post-event stream to file on session start, without 
+ * re-encoding. H.264 and H.265 streams only.
+ * @param[in] name unique component name for the new Ring Record Tap
+ * @param[in] outdir absolute or relative path to the recording output dir.
+ * @param[in] container one of DSL_CONTAINER_MP4 or DSL_CONTAINER_MKV
+ * @param[in] max_bytes byte budget for the ring buffer
+ * @param[in] client_listener client callback for end-of-session notifications.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TAP_RESULT on failure
+ */
+DslReturnType dsl_tap_ring_record_new(const wchar_t* name, const wchar_t* outdir, 
+    uint container, uint64_t max_bytes, dsl_ring_record_complete_listener_cb client_listener);
+
+/**
+ * @brief starts a new recording session for the named Ring Record Tap. 
+ * Only one session can be in progress at a time.
+ * @param[in] name unique of the Ring Record Tap to start the session
+ * @param[out] session unique id for the new session on successful start
+ * @param[in] pre_event seconds before the current time to record, 
+ * limited by the contents of the ring buffer
+ * @param[in] post_event seconds after the current time to record
+ * @param[in] client_data opaque pointer to client data returned
+ * on callback to the client listener function provided on Tap creation
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TAP_RESULT on failure
+ */
+DslReturnType dsl_tap_ring_record_session_start(const wchar_t* name, uint* session,
+    uint pre_event, uint post_event, void* client_data);
+
+/**
+ * @brief stops the current recording session before the end of its 
+ * post-event window
+ * @param[in] name unique of the Ring Record Tap to stop
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TAP_RESULT on failure
+ */
+DslReturnType dsl_tap_ring_record_session_stop(const wchar_t* name);
+
+/**
+ * @brief gets the byte budget for the named Ring Record Tap's ring buffer
+ * @param[in] name name of the Ring Record Tap to query
+ * @param[out] max_bytes current byte budget
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TAP_RESULT on failure
+ */
+DslReturnType dsl_tap_ring_record_max_bytes_get(const wchar_t* name, uint64_t* max_bytes);
+
+/**
+ * @brief sets the byte budget for the named Ring Record Tap's ring buffer. 
+ * The oldest GOPs are evicted immediately if the new budget is exceeded.
+ * @param[in] name name of the Ring Record Tap to update
+ * @param[in] max_bytes new byte budget
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TAP_RESULT on failure
+ */
+DslReturnType dsl_tap_ring_record_max_bytes_set(const wchar_t* name, uint64_t max_bytes);
+
+/**
+ * @brief gets the current level of the named Ring Record Tap's ring buffer
+ * @param[in] name name of the Ring Record Tap to query
+ * @param[out] bytes number of bytes currently held
+ * @param[out] duration time spanned by the packets held in milliseconds
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TAP_RESULT on failure
+ */
+DslReturnType dsl_tap_ring_record_cache_level_get(const wchar_t* name, 
+    uint64_t* bytes, uint* duration);
+
+/**
+ * @brief returns the current recording state of the Ring Record Tap
+ * @param[in] name name of the Ring Record Tap to query
+ * @param[out] is_on true if a session is currently in progress, false otherwise
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_TAP_RESULT on failure
+ */
+DslReturnType dsl_tap_ring_record_is_on_get(const wchar_t* name, boolean* is_on);
+
+/**
+ * @brief creates a new, uniquely named File Tap component. The Tap muxes 
+ * an encoded stream to file without re-encoding, starting on the first keyframe.
+ * @param[in] name unique component name for the new File Tap
+ * @param[in] filepath absolute or relative file path including extension
+ * @param[in] codec one of DSL_CODEC_H264, DSL_CODEC_H265, DSL_CODEC_MPEG4
+ * @param[in] container one of DSL_CONTAINER_MP4 or DSL_CONTAINER_MKV
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TAP_RESULT on failure
+ */
+DslReturnType dsl_tap_file_new(const wchar_t* name, const wchar_t* filepath, 
+    uint codec, uint container);
+
+/**
+ * @brief creates a new, uniquely named RTSP Tap component. The Tap payloads
+ * an encoded stream and serves it with its own RTSP Server without re-encoding.
+ * @param[in] name unique component name for the new RTSP Tap
+ * @param[in] host address for the RTSP Server
+ * @param[in] udp_port UDP port number for the RTSP Server
+ * @param[in] rtsp_port RTSP port number for the RTSP Server
+ * @param[in] codec one of DSL_CODEC_H264, DSL_CODEC_H265
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TAP_RESULT on failure
+ */
+DslReturnType dsl_tap_rtsp_new(const wchar_t* name, const wchar_t* host, 
+    uint udp_port, uint rtsp_port, uint codec);
+
+/**
+ * @brief gets the current server settings for the named RTSP Tap
+ * @param[in] name unique name of the RTSP Tap to query
+ * @param[out] udp_port UDP port number for the RTSP Server
+ * @param[out] rtsp_port RTSP port number for the RTSP Server
+ * @param[out] codec one of DSL_CODEC_H264, DSL_CODEC_H265
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TAP_RESULT on failure
+ */
+DslReturnType dsl_tap_rtsp_server_settings_get(const wchar_t* name,
+    uint* udp_port, uint* rtsp_port, uint* codec);
+
 
 /**
  * @brief creates a new, uniquely named Primary GIE object
@@ -1945,6 +2565,51 @@ DslReturnType dsl_gie_interval_get(const wchar_t* name, uint* interval);
  */
 DslReturnType dsl_gie_interval_set(const wchar_t* name, uint interval);
 
+/**
+ * @brief Gets the current adaptive infer-interval settings for the named Primary GIE
+ * @param[in] name unique name of the Primary GIE to query
+ * @param[out] enabled true if the adaptive interval controller is enabled
+ * @param[out] min_interval lower bound for the infer interval
+ * @param[out] max_interval upper bound for the infer interval
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_GIE_RESULT otherwise.
+ */
+DslReturnType dsl_gie_primary_interval_adaptive_get(const wchar_t* name, 
+    boolean* enabled, uint* min_interval, uint* max_interval);
+
+/**
+ * @brief Sets the adaptive infer-interval settings for the named Primary GIE.
+ * When enabled, the infer interval is raised when the GIE falls behind its input,
+ * and lowered again when idle, within [min_interval, max_interval]. The configured
+ * interval is restored when the Pipeline stops.
+ * @param[in] name unique name of the Primary GIE to update
+ * @param[in] enabled set to true to enable the adaptive interval controller
+ * @param[in] min_interval lower bound for the infer interval
+ * @param[in] max_interval upper bound for the infer interval, must be >= min_interval
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_GIE_RESULT otherwise.
+ */
+DslReturnType dsl_gie_primary_interval_adaptive_set(const wchar_t* name, 
+    boolean enabled, uint min_interval, uint max_interval);
+
+/**
+ * @brief Adds a callback to be notified on each infer-interval change made
+ * by the named Primary GIE's adaptive interval controller
+ * @param[in] name unique name of the Primary GIE to update
+ * @param[in] listener client callback function to add
+ * @param[in] client_data opaque pointer to client data passed into the listener function.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_GIE_RESULT otherwise.
+ */
+DslReturnType dsl_gie_primary_interval_listener_add(const wchar_t* name, 
+    dsl_gie_interval_change_listener_cb listener, void* client_data);
+
+/**
+ * @brief Removes a callback previously added with dsl_gie_primary_interval_listener_add
+ * @param[in] name unique name of the Primary GIE to update
+ * @param[in] listener client callback function to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_GIE_RESULT otherwise.
+ */
+DslReturnType dsl_gie_primary_interval_listener_remove(const wchar_t* name, 
+    dsl_gie_interval_change_listener_cb listener);
+
 /**
  * @brief Enbles/disables the raw layer-info output to binary file for the named the GIE
  * @param[in] name name of the Primary or Secondary GIE to update
@@ -1973,6 +2638,41 @@ DslReturnType dsl_tracker_ktl_new(const wchar_t* name, uint max_width, uint max_
  */
 DslReturnType dsl_tracker_iou_new(const wchar_t* name, const wchar_t* config_file, uint max_width, uint max_height);
 
+/**
+ * @brief creates a new, uniquely named CPU IOU Tracker object. The CPU IOU Tracker 
+ * associates the objects of each frame with the active tracks of the same source
+ * by greedy IOU matching, without the use of the nvtracker plugin or GPU.
+ * @param[in] name unique name for the new Tracker
+ * @param[in] max_age maximum number of frames a track can go unmatched before removal
+ * @param[in] iou_threshold minimum IOU for an object to match a track, in the range (0.0, 1.0]
+ * @param[in] max_tracks capacity of the track pool allocated for each source, > 0
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TRACKER_RESULT otherwise
+ */
+DslReturnType dsl_tracker_cpu_iou_new(const wchar_t* name, 
+    uint max_age, float iou_threshold, uint max_tracks);
+
+/**
+ * @brief gets the current settings for the named CPU IOU Tracker object
+ * @param[in] name unique name of the Tracker to query
+ * @param[out] max_age maximum number of frames a track can go unmatched before removal
+ * @param[out] iou_threshold minimum IOU for an object to match a track
+ * @param[out] max_tracks capacity of the track pool allocated for each source
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TRACKER_RESULT otherwise
+ */
+DslReturnType dsl_tracker_cpu_iou_settings_get(const wchar_t* name, 
+    uint* max_age, float* iou_threshold, uint* max_tracks);
+
+/**
+ * @brief sets the settings for the named CPU IOU Tracker object
+ * @param[in] name unique name of the Tracker to update
+ * @param[in] max_age maximum number of frames a track can go unmatched before removal
+ * @param[in] iou_threshold minimum IOU for an object to match a track, in the range (0.0, 1.0]
+ * @param[in] max_tracks capacity of the track pool allocated for each source, > 0
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TRACKER_RESULT otherwise
+ */
+DslReturnType dsl_tracker_cpu_iou_settings_set(const wchar_t* name, 
+    uint max_age, float iou_threshold, uint max_tracks);
+
 /**
  * @brief returns the current maximum frame width and height settings for the named IOU Tracker object
  * @param[in] name unique name of the Tracker to query
@@ -2327,6 +3027,27 @@ DslReturnType dsl_tiler_source_show_set(const wchar_t* name,
  */
 DslReturnType dsl_tiler_source_show_all(const wchar_t* name);
 
+/** 
+ * @brief Gets the current frame-pruning setting for the named Tiler
+ * @param[in] name unique name of the Tiler to query
+ * @param[out] enabled true if frame-pruning is enabled, false otherwise
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TILER_RESULT otherwise
+ */
+DslReturnType dsl_tiler_frame_pruning_enabled_get(const wchar_t* name, 
+    boolean* enabled);
+
+/** 
+ * @brief Sets the frame-pruning setting for the named Tiler. When enabled, and
+ * while a single source is shown, the frames of all hidden sources are removed 
+ * from the batch metadata at the Tiler's src pad, so that the OSD and all 
+ * downstream components process the shown source only.
+ * @param[in] name unique name of the Tiler to update
+ * @param[in] enabled set to true to enable frame-pruning
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TILER_RESULT otherwise
+ */
+DslReturnType dsl_tiler_frame_pruning_enabled_set(const wchar_t* name, 
+    boolean enabled);
+
 /**
  * @brief Adds a pad-probe-handler to either the Sink or Source pad of the named Tiler
  * A Tiled Display can have multiple Sink and Source pad probe handlers
@@ -2355,6 +3076,102 @@ DslReturnType dsl_tiler_pph_remove(const wchar_t* name,
  */
 DslReturnType dsl_sink_fake_new(const wchar_t* name);
 
+/**
+ * @brief creates a new, uniquely named App Sink component. The Sink delivers
+ * each buffer received to the client, either by calling the client's handler
+ * or on pull with dsl_sink_app_data_pull.
+ * @param[in] name unique component name for the new App Sink
+ * @param[in] handler client function to call with each new buffer, or NULL 
+ * to pull buffers with dsl_sink_app_data_pull
+ * @param[in] client_data opaque pointer to client data passed to the handler
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_new(const wchar_t* name, 
+    dsl_sink_app_new_data_handler_cb handler, void* client_data);
+
+/**
+ * @brief pulls the next buffer from the named App Sink, releasing the buffer 
+ * last pulled. Only available for App Sinks created without a handler.
+ * @param[in] name unique name of the App Sink to pull from
+ * @param[in] timeout maximum time to wait for a buffer in milliseconds
+ * @param[out] buffer pointer to the GstBuffer pulled
+ * @param[out] data mapped read-only view of the buffer data. For NVMM buffers,
+ * this is a pointer to the buffer's NvBufSurface.
+ * @param[out] size size of the mapped data in bytes
+ * @param[out] batch_meta pointer to the buffer's NvDsBatchMeta, NULL if none
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_APP_DATA_NOT_AVAILABLE
+ * on timeout or end-of-stream, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_data_pull(const wchar_t* name, uint timeout, 
+    void** buffer, void** data, uint* size, void** batch_meta);
+
+/**
+ * @brief releases the buffer last pulled from the named App Sink.
+ * @param[in] name unique name of the App Sink to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_data_release(const wchar_t* name);
+
+/**
+ * @brief gets the current max-buffers and drop policy for the named App Sink
+ * @param[in] name unique name of the App Sink to query
+ * @param[out] max_buffers maximum number of buffers to queue, 0 = unlimited
+ * @param[out] drop if true, old buffers are dropped when the queue is full,
+ * otherwise the upstream branch is blocked until the client catches up.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_max_buffers_get(const wchar_t* name, 
+    uint* max_buffers, boolean* drop);
+
+/**
+ * @brief sets the max-buffers and drop policy for the named App Sink
+ * @param[in] name unique name of the App Sink to update
+ * @param[in] max_buffers maximum number of buffers to queue, 0 = unlimited
+ * @param[in] drop if true, old buffers are dropped when the queue is full,
+ * otherwise the upstream branch is blocked until the client catches up.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_max_buffers_set(const wchar_t* name, 
+    uint max_buffers, boolean drop);
+
+/**
+ * @brief creates a new, uniquely named Meta Sink component. The Meta Sink 
+ * consumes the video and writes only the frame and object meta of each batch
+ * as compact, length-prefixed binary messages to a file or Unix domain socket.
+ * All writes are non-blocking, frames that can't be written are dropped.
+ * Each message is a header - uint32 length of the bytes that follow, 
+ * uint16 DSL_META_SINK_FORMAT_VERSION, uint16 frame count - followed by
+ * each frame - uint32 source_id, uint32 frame_num, uint64 buf_pts, 
+ * uint64 ntp_timestamp, uint32 object count - and each frame's objects - 
+ * uint64 object_id, int32 class_id, float confidence, float left, top, 
+ * width, height. All values are in host byte order.
+ * @param[in] name unique component name for the new Meta Sink
+ * @param[in] path absolute or relative path to the output file or socket
+ * @param[in] mode one of DSL_META_SINK_MODE_FILE or DSL_META_SINK_MODE_SOCKET
+ * @param[in] frames_per_write number of frames to batch into each message
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_meta_new(const wchar_t* name, 
+    const wchar_t* path, uint mode, uint frames_per_write);
+
+/**
+ * @brief gets the current write statistics for the named Meta Sink
+ * @param[in] name unique name of the Meta Sink to query
+ * @param[out] frames_written number of frames written since last cleared
+ * @param[out] frames_dropped number of frames dropped since last cleared,
+ * either because the write would block or the output was unavailable.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_meta_stats_get(const wchar_t* name, 
+    uint64_t* frames_written, uint64_t* frames_dropped);
+
+/**
+ * @brief clears the current write statistics for the named Meta Sink
+ * @param[in] name unique name of the Meta Sink to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_meta_stats_clear(const wchar_t* name);
+
 /**
  * @brief creates a new, uniquely named Ovelay Sink component
  * @param[in] name unique component name for the new Overlay Sink
@@ -2381,6 +3198,46 @@ DslReturnType dsl_sink_overlay_new(const wchar_t* name, uint overlay_id, uint di
 DslReturnType dsl_sink_window_new(const wchar_t* name, 
     uint offsetX, uint offsetY, uint width, uint height);
 
+/**
+ * @brief gets the current maximum render frame-rate for the named 
+ * Overlay or Window Sink
+ * @param[in] name unique name of the Render Sink to query
+ * @param[out] max_fps current maximum frames per second, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_render_max_fps_get(const wchar_t* name, uint* max_fps);
+
+/**
+ * @brief sets the maximum render frame-rate for the named Overlay or Window Sink.
+ * Frames in excess of the maximum are dropped before conversion and rendering.
+ * Can be called at any time, including while the Sink is in use.
+ * @param[in] name unique name of the Render Sink to update
+ * @param[in] max_fps new maximum frames per second, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_render_max_fps_set(const wchar_t* name, uint max_fps);
+
+/**
+ * @brief gets the current pause-when-hidden setting for the named Window Sink
+ * @param[in] name unique name of the Window Sink to query
+ * @param[out] enabled true if rendering is paused while the Pipeline's 
+ * XWindow is minimized or fully obscured, false otherwise
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_window_pause_when_hidden_get(const wchar_t* name, 
+    boolean* enabled);
+
+/**
+ * @brief sets the pause-when-hidden setting for the named Window Sink. When 
+ * enabled, all frames are dropped before conversion and rendering while the
+ * Pipeline's XWindow is minimized or fully obscured.
+ * @param[in] name unique name of the Window Sink to update
+ * @param[in] enabled set to true to pause rendering while hidden
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_window_pause_when_hidden_set(const wchar_t* name, 
+    boolean enabled);
+
 /**
  * @brief creates a new, uniquely named File Sink component
  * @param[in] name unique component name for the new File Sink
@@ -2394,6 +3251,136 @@ DslReturnType dsl_sink_window_new(const wchar_t* name,
 DslReturnType dsl_sink_file_new(const wchar_t* name, const wchar_t* filepath, 
      uint codec, uint container, uint bitrate, uint interval);
 
+/**
+ * @brief creates a new, uniquely named Segment Sink component. The Segment Sink
+ * encodes to a rolling sequence of segment files, splitting on keyframes once 
+ * the maximum duration, or maximum size if set, is reached.
+ * @param[in] name unique component name for the new Segment Sink
+ * @param[in] file_pattern absolute or relative file path including extension, 
+ * with a single printf-style integer directive for the segment index, 
+ * e.g. "./recordings/camera-1-%05d.mp4"
+ * @param[in] codec one of DSL_CODEC_H264, DSL_CODEC_H265, DSL_CODEC_MPEG4
+ * @param[in] container one of DSL_CONTAINER_MP4 or DSL_CONTAINER_MKV
+ * @param[in] bitrate in bits per second - H264 and H265 only
+ * @param[in] interval iframe interval to encode at
+ * @param[in] max_duration maximum duration of each segment in seconds, 0 = unlimited
+ * @param[in] max_files maximum number of segment files to retain, 0 = unlimited.
+ * Once reached, the oldest segment file is overwritten.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_segment_new(const wchar_t* name, const wchar_t* file_pattern, 
+     uint codec, uint container, uint bitrate, uint interval, 
+     uint max_duration, uint max_files);
+
+/**
+ * @brief gets the current maximum segment duration for the named Segment Sink
+ * @param[in] name unique name of the Segment Sink to query
+ * @param[out] max_duration current maximum duration in seconds, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_segment_max_duration_get(const wchar_t* name, 
+    uint* max_duration);
+
+/**
+ * @brief sets the maximum segment duration for the named Segment Sink,
+ * taking effect from the next keyframe.
+ * @param[in] name unique name of the Segment Sink to update
+ * @param[in] max_duration new maximum duration in seconds, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_segment_max_duration_set(const wchar_t* name, 
+    uint max_duration);
+
+/**
+ * @brief gets the current maximum segment size for the named Segment Sink
+ * @param[in] name unique name of the Segment Sink to query
+ * @param[out] max_size current maximum size in bytes, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_segment_max_size_get(const wchar_t* name, 
+    uint64_t* max_size);
+
+/**
+ * @brief sets the maximum segment size for the named Segment Sink,
+ * taking effect from the next keyframe.
+ * @param[in] name unique name of the Segment Sink to update
+ * @param[in] max_size new maximum size in bytes, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_segment_max_size_set(const wchar_t* name, 
+    uint64_t max_size);
+
+/**
+ * @brief gets the current maximum number of segment files retained
+ * @param[in] name unique name of the Segment Sink to query
+ * @param[out] max_files current maximum number of files, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_segment_max_files_get(const wchar_t* name, 
+    uint* max_files);
+
+/**
+ * @brief sets the maximum number of segment files to retain
+ * @param[in] name unique name of the Segment Sink to update
+ * @param[in] max_files new maximum number of files, 0 = unlimited
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_segment_max_files_set(const wchar_t* name, 
+    uint max_files);
+
+/**
+ * @brief gets the current write settings for the named Segment Sink
+ * @param[in] name unique name of the Segment Sink to query
+ * @param[out] buffer_size size of the write buffer in bytes
+ * @param[out] fsync_interval interval between fsyncs of the current 
+ * segment file in milliseconds, 0 = disabled
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_segment_write_settings_get(const wchar_t* name, 
+    uint* buffer_size, uint* fsync_interval);
+
+/**
+ * @brief sets the write settings for the named Segment Sink
+ * @param[in] name unique name of the Segment Sink to update
+ * @param[in] buffer_size new write buffer size in bytes
+ * @param[in] fsync_interval new interval between fsyncs of the current 
+ * segment file in milliseconds, 0 = disabled
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_segment_write_settings_set(const wchar_t* name, 
+    uint buffer_size, uint fsync_interval);
+
+/**
+ * @brief creates a new, uniquely named Shared Encode Sink component. The Sink 
+ * encodes the stream once and tees the output to each of its Taps - File, 
+ * RTSP, Record, or Ring Record - which can be added and removed while playing.
+ * @param[in] name unique component name for the new Shared Encode Sink
+ * @param[in] codec one of DSL_CODEC_H264, DSL_CODEC_H265, DSL_CODEC_MPEG4
+ * @param[in] bitrate in bits per second - H264 and H265 only
+ * @param[in] interval iframe interval to encode at
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_shared_encode_new(const wchar_t* name, 
+    uint codec, uint bitrate, uint interval);
+
+/**
+ * @brief adds a Tap to the named Shared Encode Sink. If the Sink is playing,
+ * the Tap is linked and started, and a keyframe is requested from the encoder.
+ * @param[in] name unique name of the Shared Encode Sink to update
+ * @param[in] tap unique name of the Tap to add
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_shared_encode_tap_add(const wchar_t* name, const wchar_t* tap);
+
+/**
+ * @brief removes a Tap from the named Shared Encode Sink. If the Sink is playing,
+ * the Tap is sent end-of-stream and stopped without interrupting the other Taps.
+ * @param[in] name unique name of the Shared Encode Sink to update
+ * @param[in] tap unique name of the Tap to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_shared_encode_tap_remove(const wchar_t* name, const wchar_t* tap);
+
 /**
  * @brief creates a new, uniquely named File Record component
  * @param[in] name unique component name for the new Record Sink
@@ -2561,6 +3548,41 @@ DslReturnType dsl_sink_rtsp_encoder_settings_get(const wchar_t* name,
 DslReturnType dsl_sink_rtsp_encoder_settings_set(const wchar_t* name,
     uint bitrate, uint interval);
 
+/**
+ * @brief gets the current adaptive bitrate settings for the named RTSP Sink
+ * @param[in] name unique name of the RTSP Sink to query
+ * @param[out] enabled true if the adaptive bitrate controller is enabled
+ * @param[out] min_bitrate lower bound for the Encoder bit-rate in bits/sec
+ * @param[out] max_bitrate upper bound for the Encoder bit-rate in bits/sec
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_rtsp_bitrate_adaptive_get(const wchar_t* name,
+    boolean* enabled, uint* min_bitrate, uint* max_bitrate);
+
+/**
+ * @brief sets the adaptive bitrate settings for the named RTSP Sink. When enabled,
+ * the Encoder bit-rate is adjusted within bounds from the RTCP receiver reports 
+ * of the connected clients, and encoding is paused while no client is connected.
+ * @param[in] name unique name of the RTSP Sink to update
+ * @param[in] enabled set to true to enable the adaptive bitrate controller
+ * @param[in] min_bitrate lower bound for the Encoder bit-rate in bits/sec
+ * @param[in] max_bitrate upper bound for the Encoder bit-rate in bits/sec
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_rtsp_bitrate_adaptive_set(const wchar_t* name,
+    boolean enabled, uint min_bitrate, uint max_bitrate);
+
+/**
+ * @brief gets the current client and Encoder status for the named RTSP Sink
+ * @param[in] name unique name of the RTSP Sink to query
+ * @param[out] client_count number of RTSP clients currently connected
+ * @param[out] bitrate Encoder bit-rate currently in use in bits/sec
+ * @param[out] is_encoding false while encoding is paused, true otherwise
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ */
+DslReturnType dsl_sink_rtsp_stream_status_get(const wchar_t* name,
+    uint* client_count, uint* bitrate, boolean* is_encoding);
+
 /**
  * @brief Adds a pad-probe-handler to be called to process each frame buffer.
  * One or more Pad Probe Handlers can be added to the SINK PAD only (single stream).
@@ -2824,6 +3846,45 @@ DslReturnType dsl_pipeline_component_remove(const wchar_t* pipeline,
 DslReturnType dsl_pipeline_component_remove_many(const wchar_t* pipeline, 
     const wchar_t** components);
 
+/**
+ * @brief adds a live Source to a Pipeline's standby pool. Standby Sources are linked, 
+ * negotiated, and played with the Pipeline, but their decoded frames are dropped 
+ * until the Source is attached to the Pipeline's Stream Muxer.
+ * @param[in] pipeline name of the Pipeline to update
+ * @param[in] source name of the live Source to add
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_source_standby_add(const wchar_t* pipeline, 
+    const wchar_t* source);
+
+/**
+ * @brief removes a detached Source from a Pipeline's standby pool
+ * @param[in] pipeline name of the Pipeline to update
+ * @param[in] source name of the Source to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_source_standby_remove(const wchar_t* pipeline, 
+    const wchar_t* source);
+
+/**
+ * @brief attaches a Source in a Pipeline's standby pool to the Pipeline's Stream Muxer.
+ * @param[in] pipeline name of the Pipeline to update
+ * @param[in] source name of the standby Source to attach
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_source_standby_attach(const wchar_t* pipeline, 
+    const wchar_t* source);
+
+/**
+ * @brief detaches an attached Source in a Pipeline's standby pool from the Pipeline's
+ * Stream Muxer, returning the Source to standby without stopping it.
+ * @param[in] pipeline name of the Pipeline to update
+ * @param[in] source name of the standby Source to detach
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_source_standby_detach(const wchar_t* pipeline, 
+    const wchar_t* source);
+
 /**
  * @brief 
  * @param[in] pipeline name of the pipeline to query
@@ -2902,6 +3963,222 @@ DslReturnType dsl_pipeline_streammux_padding_get(const wchar_t* name, boolean* e
  */
 DslReturnType dsl_pipeline_streammux_padding_set(const wchar_t* name, boolean enabled);
 
+/**
+ * @brief returns the current adaptive batch-timeout settings for the Pipeline's 
+ * Stream Muxer.
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] enabled true if the adaptive batch-timeout controller is enabled
+ * @param[out] jitter_margin margin in microseconds added to the slowest source's
+ * measured frame period
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_streammux_batch_timeout_adaptive_get(const wchar_t* pipeline, 
+    boolean* enabled, uint* jitter_margin);
+
+/**
+ * @brief enables/disables the adaptive batch-timeout controller for the Pipeline's
+ * Stream Muxer. When enabled, the arrival interval of each source is measured at the 
+ * Stream Muxer's sink pads and the batched-push-timeout is updated once per second to 
+ * the slowest live source's frame period plus measured jitter and jitter_margin. 
+ * The batch-timeout set with dsl_pipeline_streammux_batch_properties_set is used 
+ * as the upper bound. Settings can only be updated while the Pipeline is stopped.
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] enabled set to true to enable the adaptive controller, false to disable
+ * @param[in] jitter_margin margin in microseconds to add to the measured frame period
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_streammux_batch_timeout_adaptive_set(const wchar_t* pipeline, 
+    boolean enabled, uint jitter_margin);
+
+/**
+ * @brief returns the batch-timeout currently in use by the Pipeline's Stream Muxer
+ * and the batch fill ratio measured over the last update interval. The fill ratio 
+ * is only measured while the adaptive batch-timeout controller is enabled.
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] batch_timeout batched-push-timeout currently in use in microseconds
+ * @param[out] fill_ratio average number of frames per batch / batch-size
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_streammux_batch_stats_get(const wchar_t* pipeline, 
+    uint* batch_timeout, double* fill_ratio);
+
+/**
+ * @brief returns the current adaptive batch-size settings for the named Pipeline.
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] enabled true if the batch-size follows the number of Sources
+ * @param[out] hysteresis number of Sources the count must fall below the current
+ * batch-size before the batch-size is reduced.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_streammux_batch_size_adaptive_get(const wchar_t* pipeline, 
+    boolean* enabled, uint* hysteresis);
+
+/**
+ * @brief enables/disables the adaptive batch-size for the named Pipeline. When enabled,
+ * the batch-size is set to the number of Sources on Play, grows immediately as Sources 
+ * are added while playing, and is reduced when the number of Sources falls by hysteresis
+ * or more. The new batch-size is propagated to the Primary GIE and Tracker.
+ * Settings can only be updated while the Pipeline is stopped.
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] enabled set to true to enable the adaptive batch-size, false to disable
+ * @param[in] hysteresis number of Sources below the batch-size to reduce on, must be > 0
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_streammux_batch_size_adaptive_set(const wchar_t* pipeline, 
+    boolean enabled, uint hysteresis);
+
+/**
+ * @brief returns the current Secondary GIE result cache settings for the named Pipeline.
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] enabled true if the result cache is enabled
+ * @param[out] max_age maximum age, in frames, of a cached result before the 
+ * tracked object is re-inferred
+ * @param[out] min_confidence minimum label probability for a cached result to be reused
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_sgie_cache_settings_get(const wchar_t* pipeline, 
+    boolean* enabled, uint* max_age, float* min_confidence);
+
+/**
+ * @brief enables/disables the Secondary GIE result cache for the named Pipeline.
+ * When enabled, tracked objects with classifier results no older than max_age 
+ * frames, and with all label probabilities at or above min_confidence, are 
+ * skipped by all Secondary GIEs and have their cached classifier meta re-attached.
+ * Requires a Tracker. Settings can only be updated while the Pipeline is stopped.
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] enabled set to true to enable the result cache, false to disable
+ * @param[in] max_age maximum age, in frames, of a cached result
+ * @param[in] min_confidence minimum label probability for reuse [0..1]
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_sgie_cache_settings_set(const wchar_t* pipeline, 
+    boolean enabled, uint max_age, float min_confidence);
+
+/**
+ * @brief returns the Secondary GIE result cache counters for the named Pipeline, 
+ * reset each time the Pipeline is played.
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] hits number of tracked objects that reused cached results
+ * @param[out] misses number of tracked objects inferred by the Secondary GIEs
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_sgie_cache_stats_get(const wchar_t* pipeline, 
+    uint64_t* hits, uint64_t* misses);
+
+/**
+ * @brief gets the current main-context setting for the named Pipeline
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] enabled true if the Pipeline handles its bus messages in its own
+ * main-context and thread, false if handled by the default main loop
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_main_context_enabled_get(const wchar_t* pipeline, 
+    boolean* enabled);
+
+/**
+ * @brief enables/disables a dedicated main-context and thread for the named 
+ * Pipeline. When enabled, the Pipeline's state-change, end-of-stream, and error
+ * messages are handled, and its state-change and end-of-stream listeners called,
+ * on the Pipeline's own thread and not by the default main loop. The timers of
+ * the Pipeline's components, including Meter callbacks, run on the same thread.
+ * Listeners of different Pipelines may then be called concurrently. The setting can only be 
+ * updated while the Pipeline is stopped.
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] enabled set to true to use a dedicated main-context and thread
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_main_context_enabled_set(const wchar_t* pipeline, 
+    boolean enabled);
+
+/**
+ * @brief gets the QoS counters for an element in the Pipeline, accumulated
+ * from the QoS messages posted by the element on the Pipeline's bus.
+ * @param[in] pipeline name of the pipeline to query
+ * @param[in] element path of the GStreamer element to query, as passed to
+ * the QoS listener, e.g. "/my-pipeline/sinks-bin/fake-sink/sink-bin-fake"
+ * @param[out] processed total buffers processed by the element
+ * @param[out] dropped total buffers dropped by the element
+ * @param[out] jitter running average of the absolute jitter in nanoseconds
+ * @param[out] proportion long term proportion from the element's last QoS message
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_qos_element_stats_get(const wchar_t* pipeline, 
+    const wchar_t* element, uint64_t* processed, uint64_t* dropped, 
+    int64_t* jitter, double* proportion);
+
+/**
+ * @brief gets the QoS totals for all elements in the Pipeline
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] elements number of elements that have posted QoS messages
+ * @param[out] dropped sum of the dropped counters for all elements
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_qos_totals_get(const wchar_t* pipeline, 
+    uint* elements, uint64_t* dropped);
+
+/**
+ * @brief clears the QoS counters for all elements in the Pipeline
+ * @param[in] pipeline name of the pipeline to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_qos_stats_clear(const wchar_t* pipeline);
+
+/**
+ * @brief adds a callback to be notified when an element's dropped count 
+ * increases by threshold or more since the listener was last called for 
+ * the element. Called from the Pipeline's bus watch context.
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] listener pointer to the client's function to call
+ * @param[in] threshold number of new dropped buffers to notify on, > 0
+ * @param[in] client_data opaque pointer to client data passed into the listener function.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_qos_listener_add(const wchar_t* pipeline, 
+    dsl_qos_listener_cb listener, uint threshold, void* client_data);
+
+/**
+ * @brief removes a callback previously added with dsl_pipeline_qos_listener_add
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] listener pointer to the client's function to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_qos_listener_remove(const wchar_t* pipeline, 
+    dsl_qos_listener_cb listener);
+
+/**
+ * @brief sets the CPU affinity and scheduling policy for all streaming threads
+ * owned by a named component or element, or the default policy for all other 
+ * streaming threads of the Pipeline. Applied to current and future threads.
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] component name of the component or element, NULL for the default
+ * @param[in] cpu_mask bit mask of CPUs to run on, 0 to leave the affinity unchanged
+ * @param[in] sched_policy one of the DSL_THREAD_SCHED constants
+ * @param[in] priority nice value [-20..19] for DSL_THREAD_SCHED_OTHER, or
+ * real-time priority [1..99] for DSL_THREAD_SCHED_FIFO
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_thread_policy_set(const wchar_t* pipeline, 
+    const wchar_t* component, uint64_t cpu_mask, uint sched_policy, int priority);
+
+/**
+ * @brief removes a thread policy previously set with dsl_pipeline_thread_policy_set
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] component name of the component or element, NULL for the default
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_thread_policy_remove(const wchar_t* pipeline, 
+    const wchar_t* component);
+
+/**
+ * @brief gets a report of all current streaming threads of the Pipeline, one
+ * line per thread with name, thread id, element, policy and the last CPU used.
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] report the report text, valid until the next call
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_thread_report_get(const wchar_t* pipeline, 
+    const wchar_t** report);
+
 /**
  * @brief pauses a Pipeline if in a state of playing
  * @param[in] pipeline unique name of the Pipeline to pause.
@@ -3057,6 +4334,71 @@ DslReturnType dsl_pipeline_xwindow_delete_event_handler_add(const wchar_t* pipel
 DslReturnType dsl_pipeline_xwindow_delete_event_handler_remove(const wchar_t* pipeline, 
     dsl_xwindow_delete_event_handler_cb handler);
 
+/**
+ * @brief starts serving all published metrics, in the Prometheus text 
+ * exposition format, over HTTP on the loopback interface at /metrics
+ * @param[in] port TCP port to listen on
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_METRICS_RESULT otherwise.
+ */
+DslReturnType dsl_metrics_http_exporter_start(uint port);
+
+/**
+ * @brief stops the HTTP exporter started with dsl_metrics_http_exporter_start
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_METRICS_RESULT otherwise.
+ */
+DslReturnType dsl_metrics_http_exporter_stop();
+
+/**
+ * @brief starts writing all published metrics, in the Prometheus text 
+ * exposition format, to a file at a periodic interval. The file is written
+ * once on start and then replaced on each interval from the main loop.
+ * @param[in] file_path path to the file to write
+ * @param[in] interval write interval in seconds, > 0
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_METRICS_RESULT otherwise.
+ */
+DslReturnType dsl_metrics_file_exporter_start(const wchar_t* file_path, uint interval);
+
+/**
+ * @brief stops the file exporter started with dsl_metrics_file_exporter_start
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_METRICS_RESULT otherwise.
+ */
+DslReturnType dsl_metrics_file_exporter_stop();
+
+/**
+ * @brief returns the number of metrics currently published by all components
+ * @return size of the list of metrics
+ */
+uint dsl_metrics_list_size();
+
+/**
+ * @brief loads a native Plugin from a shared object implementing the plugin
+ * ABI defined in DslPluginApi.h
+ * @param[in] name unique name for the new Plugin
+ * @param[in] path absolute or relative path to the shared object
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PLUGIN_RESULT otherwise.
+ */
+DslReturnType dsl_plugin_load(const wchar_t* name, const wchar_t* path);
+
+/**
+ * @brief deletes a Plugin by name. The shared object remains loaded until
+ * all Triggers, Actions, and Pad Probe Handlers created from it are deleted.
+ * @param[in] name unique name of the Plugin to delete
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PLUGIN_RESULT otherwise.
+ */
+DslReturnType dsl_plugin_delete(const wchar_t* name);
+
+/**
+ * @brief deletes all Plugins in memory
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PLUGIN_RESULT otherwise.
+ */
+DslReturnType dsl_plugin_delete_all();
+
+/**
+ * @brief returns the number of Plugins currently loaded
+ * @return size of the list of Plugins
+ */
+uint dsl_plugin_list_size();
+
 /**
  * @brief entry point to the GST Main Loop
  * Note: This is a blocking call - executes an endless loop
@@ -33,6 +33,9 @@ namespace DSL
     BranchBintr::BranchBintr(const char* name)
         : Bintr(name)
         , m_batchTimeout(DSL_DEFAULT_STREAMMUX_BATCH_TIMEOUT)
+        , m_isSgieCacheEnabled(false)
+        , m_sgieCacheMaxAge(DSL_DEFAULT_SGIE_CACHE_MAX_AGE)
+        , m_sgieCacheMinConfidence(DSL_DEFAULT_SGIE_CACHE_MIN_CONFIDENCE)
     {
         LOG_FUNC();
     }
@@ -74,11 +77,65 @@ namespace DSL
         if (!m_pSecondaryGiesBintr)
         {
             m_pSecondaryGiesBintr = DSL_PIPELINE_SGIES_NEW("sgies-bin");
+            m_pSecondaryGiesBintr->SetCacheSettings(m_isSgieCacheEnabled, 
+                m_sgieCacheMaxAge, m_sgieCacheMinConfidence);
             AddChild(m_pSecondaryGiesBintr);
         }
         return m_pSecondaryGiesBintr->AddChild(std::dynamic_pointer_cast<SecondaryGieBintr>(pSecondaryGieBintr));
     }
 
+    void BranchBintr::GetSgieCacheSettings(bool* enabled, 
+        uint* maxAge, float* minConfidence)
+    {
+        LOG_FUNC();
+        
+        *enabled = m_isSgieCacheEnabled;
+        *maxAge = m_sgieCacheMaxAge;
+        *minConfidence = m_sgieCacheMinConfidence;
+    }
+
+    bool BranchBintr::SetSgieCacheSettings(bool enabled, 
+        uint maxAge, float minConfidence)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Branch '" << GetName() 
+                << "' is currently Linked - SGIE result cache can not be updated");
+            return false;
+        }
+        if (minConfidence < 0 or minConfidence > 1)
+        {
+            LOG_ERROR("Invalid min confidence = " << minConfidence 
+                << " for Branch '" << GetName() << "'");
+            return false;
+        }
+        m_isSgieCacheEnabled = enabled;
+        m_sgieCacheMaxAge = maxAge;
+        m_sgieCacheMinConfidence = minConfidence;
+        
+        if (m_pSecondaryGiesBintr)
+        {
+            return m_pSecondaryGiesBintr->SetCacheSettings(m_isSgieCacheEnabled, 
+                m_sgieCacheMaxAge, m_sgieCacheMinConfidence);
+        }
+        return true;
+    }
+
+    void BranchBintr::GetSgieCacheStats(uint64_t* hits, uint64_t* misses)
+    {
+        LOG_FUNC();
+        
+        if (!m_pSecondaryGiesBintr)
+        {
+            *hits = 0;
+            *misses = 0;
+            return;
+        }
+        m_pSecondaryGiesBintr->GetCacheStats(hits, misses);
+    }
+
     bool BranchBintr::AddOfvBintr(DSL_BASE_PTR pOfvBintr)
     {
         LOG_FUNC();
@@ -497,6 +554,8 @@ namespace DSL
             LOG_ERROR("SinkBintr '" << GetName() << "' failed to unlink from Tee");
             return false;
         }
+        // Remove the sink ghost pad so the Branch can be linked to a Tee again
+        gst_element_remove_pad(GetGstElement(), m_pGstStaticSinkPad);
         gst_object_unref(m_pGstStaticSinkPad);
         gst_element_release_request_pad(GetSource()->GetGstElement(), m_pGstRequestedSourcePads[srcPadName]);
         gst_object_unref(m_pGstRequestedSourcePads[srcPadName]);
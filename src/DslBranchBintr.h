@@ -70,6 +70,30 @@ namespace DSL
          */
         bool AddSecondaryGieBintr(DSL_BASE_PTR pSecondaryGieBintr);
 
+        /**
+         * @brief Gets the current Secondary GIE result cache settings for this Branch
+         * @param[out] enabled true if the result cache is enabled
+         * @param[out] maxAge maximum age, in frames, of a cached result
+         * @param[out] minConfidence minimum label probability for reuse
+         */
+        void GetSgieCacheSettings(bool* enabled, uint* maxAge, float* minConfidence);
+
+        /**
+         * @brief Sets the Secondary GIE result cache settings for this Branch
+         * @param[in] enabled set to true to enable the result cache
+         * @param[in] maxAge maximum age, in frames, of a cached result
+         * @param[in] minConfidence minimum label probability for reuse [0..1]
+         * @return false if currently linked or the settings are invalid
+         */
+        bool SetSgieCacheSettings(bool enabled, uint maxAge, float minConfidence);
+
+        /**
+         * @brief Gets the Secondary GIE result cache hit and miss counters
+         * @param[out] hits number of tracked objects that reused cached results
+         * @param[out] misses number of tracked objects inferred by the Secondary GIEs
+         */
+        void GetSgieCacheStats(uint64_t* hits, uint64_t* misses);
+
         /**
          * @brief adds a single TrackerBintr to this Branch 
          * @param[in] pTrackerBintr shared pointer to the Tracker Bintr to add
@@ -165,6 +189,21 @@ namespace DSL
         
         uint m_batchTimeout;
 
+        /**
+         * @brief true if the Secondary GIE result cache is enabled
+         */
+        bool m_isSgieCacheEnabled;
+
+        /**
+         * @brief maximum age, in frames, of a cached Secondary GIE result
+         */
+        uint m_sgieCacheMaxAge;
+
+        /**
+         * @brief minimum label probability for a cached result to be reused
+         */
+        float m_sgieCacheMinConfidence;
+
         std::vector<DSL_BINTR_PTR> m_linkedComponents;
         
         /**
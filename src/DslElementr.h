@@ -130,6 +130,32 @@ namespace DSL
             g_object_set(GetGObject(), name, value, NULL);
         }
         
+        /**
+         * @brief Gets a GST Element's attribute of type uint64_t, owned by this Elementr
+         * @param[in] name name of the attribute to set
+         * @param[out] value unsigned 64 bit integer value to get the attribute
+         */
+        void GetAttribute(const char* name, uint64_t* value)
+        {
+            LOG_FUNC();
+            
+            g_object_get(GetGObject(), name, value, NULL);
+        }
+
+        /**
+         * @brief Sets a GST Element's attribute, owned by this Elementr to a value of uint64_t
+         * @param[in] name name of the attribute to set
+         * @param[in] value unsigned 64 bit integer value to set the attribute
+         */
+        void SetAttribute(const char* name, uint64_t value)
+        {
+            LOG_FUNC();
+            
+            LOG_DEBUG("Setting attribute '" << name << "' to uint64_t value '" << value << "'");
+            
+            g_object_set(GetGObject(), name, value, NULL);
+        }
+        
         /**
          * @brief Sets a GST Element's attribute, owned by this Elementr to a 
          * null terminated array of characters (char*)
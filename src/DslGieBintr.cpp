@@ -149,6 +149,19 @@ namespace DSL
         return Bintr::SetBatchSize(batchSize);
     }
 
+    bool GieBintr::UpdateBatchSize(uint batchSize)
+    {
+        LOG_FUNC();
+        
+        if (!IsLinked())
+        {
+            return SetBatchSize(batchSize);
+        }
+        LOG_INFO("Batch size for linked GIE '" << GetName() << "' updated to '" 
+            << batchSize << "' - Infer Engine batch-size will be updated on next link");
+        return Bintr::SetBatchSize(batchSize);
+    }
+
     bool GieBintr::SetInterval(uint interval)
     {
         LOG_FUNC();
@@ -274,9 +287,24 @@ namespace DSL
     PrimaryGieBintr::PrimaryGieBintr(const char* name, const char* inferConfigFile,
         const char* modelEngineFile, uint interval)
         : GieBintr(name, NVDS_ELEM_PGIE, 1, inferConfigFile, modelEngineFile)
+        , m_isIntervalAdaptive(false)
+        , m_minInterval(0)
+        , m_maxInterval(0)
+        , m_intervalInUse(interval)
+        , m_overloadedCount(0)
+        , m_underloadedCount(0)
+        , m_inputBatchCount(0)
+        , m_outputBatchCount(0)
+        , m_accumulatedLatency(0)
+        , m_lastUpdateTime(0)
+        , m_queueProbeId(0)
+        , m_inferProbeId(0)
+        , m_pIntervalTimerSource(NULL)
     {
         LOG_FUNC();
         
+        g_mutex_init(&m_adaptiveIntervalMutex);
+        
         m_pQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "primary-gie-queue");
         m_pVidConv = DSL_ELEMENT_NEW(NVDS_ELEM_VIDEO_CONV, "primary-gie-conv");
 
@@ -305,6 +333,7 @@ namespace DSL
         {    
             UnlinkAll();
         }
+        g_mutex_clear(&m_adaptiveIntervalMutex);
     }
 
     bool PrimaryGieBintr::LinkAll()
@@ -325,7 +354,10 @@ namespace DSL
         {
             return false;
         }
-        
+        if (m_isIntervalAdaptive and !StartIntervalAdaptive())
+        {
+            return false;
+        }
         m_isLinked = true;
         
         return true;
@@ -340,6 +372,9 @@ namespace DSL
             LOG_ERROR("PrimaryGieBintr '" << GetName() << "' is not linked");
             return;
         }
+        // Safe to call if not started
+        StopIntervalAdaptive();
+        
         m_pQueue->UnlinkFromSink();
         m_pVidConv->UnlinkFromSink();
 
@@ -375,6 +410,312 @@ namespace DSL
         return true;
     }
 
+    void PrimaryGieBintr::GetIntervalAdaptive(bool* enabled, 
+        uint* minInterval, uint* maxInterval)
+    {
+        LOG_FUNC();
+        
+        *enabled = m_isIntervalAdaptive;
+        *minInterval = m_minInterval;
+        *maxInterval = m_maxInterval;
+    }
+
+    bool PrimaryGieBintr::SetIntervalAdaptive(bool enabled, 
+        uint minInterval, uint maxInterval)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set adaptive Interval for Primary GIE '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        if (enabled and minInterval > maxInterval)
+        {
+            LOG_ERROR("Invalid adaptive Interval bounds [" << minInterval << ", " 
+                << maxInterval << "] for Primary GIE '" << GetName() << "'");
+            return false;
+        }
+        m_isIntervalAdaptive = enabled;
+        m_minInterval = minInterval;
+        m_maxInterval = maxInterval;
+        
+        return true;
+    }
+    
+    uint PrimaryGieBintr::GetIntervalInUse()
+    {
+        LOG_FUNC();
+        
+        return m_intervalInUse;
+    }
+
+    bool PrimaryGieBintr::AddIntervalChangeListener(
+        dsl_gie_interval_change_listener_cb listener, void* clientData)
+    {
+        LOG_FUNC();
+        
+        if (m_intervalChangeListeners.find(listener) != m_intervalChangeListeners.end())
+        {   
+            LOG_ERROR("Interval change listener is not unique");
+            return false;
+        }
+        m_intervalChangeListeners[listener] = clientData;
+        
+        return true;
+    }
+
+    bool PrimaryGieBintr::RemoveIntervalChangeListener(
+        dsl_gie_interval_change_listener_cb listener)
+    {
+        LOG_FUNC();
+        
+        if (m_intervalChangeListeners.find(listener) == m_intervalChangeListeners.end())
+        {   
+            LOG_ERROR("Interval change listener was not found");
+            return false;
+        }
+        m_intervalChangeListeners.erase(listener);
+        
+        return true;
+    }
+
+    bool PrimaryGieBintr::StartIntervalAdaptive()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveIntervalMutex);
+        
+        GstPad* pSinkPad = gst_element_get_static_pad(m_pQueue->GetGstElement(), "sink");
+        GstPad* pSrcPad = gst_element_get_static_pad(m_pInferEngine->GetGstElement(), "src");
+        if (!pSinkPad or !pSrcPad)
+        {
+            LOG_ERROR("Failed to get Pads for PrimaryGieBintr '" << GetName() << "'");
+            if (pSinkPad) gst_object_unref(pSinkPad);
+            if (pSrcPad) gst_object_unref(pSrcPad);
+            return false;
+        }
+        m_queueProbeId = gst_pad_add_probe(pSinkPad, GST_PAD_PROBE_TYPE_BUFFER,
+            PrimaryGieQueueSinkPadProbeCB, this, NULL);
+        m_inferProbeId = gst_pad_add_probe(pSrcPad, GST_PAD_PROBE_TYPE_BUFFER,
+            PrimaryGieInferSrcPadProbeCB, this, NULL);
+        gst_object_unref(pSinkPad);
+        gst_object_unref(pSrcPad);
+
+        m_inputBatchCount = 0;
+        m_outputBatchCount = 0;
+        m_accumulatedLatency = 0;
+        m_overloadedCount = 0;
+        m_underloadedCount = 0;
+        m_batchEntryTimes.clear();
+        m_lastUpdateTime = g_get_monotonic_time();
+        
+        // start from the configured interval, clamped to the adaptive bounds
+        m_intervalInUse = std::min(m_maxInterval, std::max(m_minInterval, m_interval));
+        m_pInferEngine->SetAttribute("interval", m_intervalInUse);
+        
+        m_pIntervalTimerSource = AddPipelineTimeout(GetGstObject(), 
+            DSL_DEFAULT_GIE_ADAPTIVE_UPDATE_INTERVAL, IntervalUpdateHandler, this);
+        
+        LOG_INFO("Adaptive Interval started for PrimaryGieBintr '" << GetName() << "'");
+        return true;
+    }
+
+    void PrimaryGieBintr::StopIntervalAdaptive()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveIntervalMutex);
+
+        if (m_pIntervalTimerSource)
+        {
+            RemovePipelineTimeout(m_pIntervalTimerSource);
+            m_pIntervalTimerSource = NULL;
+        }
+        if (m_queueProbeId)
+        {
+            GstPad* pSinkPad = gst_element_get_static_pad(m_pQueue->GetGstElement(), "sink");
+            gst_pad_remove_probe(pSinkPad, m_queueProbeId);
+            gst_object_unref(pSinkPad);
+            m_queueProbeId = 0;
+        }
+        if (m_inferProbeId)
+        {
+            GstPad* pSrcPad = gst_element_get_static_pad(m_pInferEngine->GetGstElement(), "src");
+            gst_pad_remove_probe(pSrcPad, m_inferProbeId);
+            gst_object_unref(pSrcPad);
+            m_inferProbeId = 0;
+        }
+        m_batchEntryTimes.clear();
+        
+        // restore the configured interval
+        if (m_intervalInUse != m_interval)
+        {
+            m_intervalInUse = m_interval;
+            m_pInferEngine->SetAttribute("interval", m_interval);
+        }
+    }
+
+    void PrimaryGieBintr::HandleQueueSinkPadBuffer(GstBuffer* pBuffer)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveIntervalMutex);
+        
+        m_inputBatchCount++;
+        
+        if (GST_BUFFER_PTS_IS_VALID(pBuffer))
+        {
+            // Entries are only left behind by batches dropped in the GIE. 
+            // Bound the map in case the Queue is leaky.
+            if (m_batchEntryTimes.size() > DSL_DEFAULT_GIE_ADAPTIVE_MAX_BATCHES_IN_FLIGHT)
+            {
+                m_batchEntryTimes.clear();
+            }
+            m_batchEntryTimes[GST_BUFFER_PTS(pBuffer)] = g_get_monotonic_time();
+        }
+    }
+
+    void PrimaryGieBintr::HandleInferSrcPadBuffer(GstBuffer* pBuffer)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveIntervalMutex);
+        
+        m_outputBatchCount++;
+        
+        auto ientry = m_batchEntryTimes.find(GST_BUFFER_PTS(pBuffer));
+        if (ientry != m_batchEntryTimes.end())
+        {
+            m_accumulatedLatency += g_get_monotonic_time() - ientry->second;
+            m_batchEntryTimes.erase(ientry);
+        }
+    }
+
+    int PrimaryGieBintr::HandleIntervalUpdate()
+    {
+        double queueFill(0), inputRate(0), outputRate(0), batchLatency(0);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveIntervalMutex);
+            
+            gint64 now = g_get_monotonic_time();
+            double period = (double)(now - m_lastUpdateTime) / G_USEC_PER_SEC;
+            m_lastUpdateTime = now;
+            
+            if (period > 0)
+            {
+                inputRate = m_inputBatchCount / period;
+                outputRate = m_outputBatchCount / period;
+            }
+            if (m_outputBatchCount)
+            {
+                batchLatency = (double)m_accumulatedLatency / 
+                    (m_outputBatchCount * G_USEC_PER_SEC);
+            }
+            m_inputBatchCount = 0;
+            m_outputBatchCount = 0;
+            m_accumulatedLatency = 0;
+            
+            uint currentLevel(0), maxSize(0);
+            m_pQueue->GetAttribute("current-level-buffers", &currentLevel);
+            m_pQueue->GetAttribute("max-size-buffers", &maxSize);
+            if (maxSize)
+            {
+                queueFill = (double)currentLevel / maxSize;
+            }
+        }
+        // evaluate outside of the lock, listeners may be called on change
+        EvaluateIntervalLoad(queueFill, inputRate, outputRate, batchLatency);
+        
+        return true;
+    }
+
+    uint PrimaryGieBintr::EvaluateIntervalLoad(double queueFill, double inputRate, 
+        double outputRate, double batchLatency)
+    {
+        // latency relative to the period of the incoming batches
+        double latencyRatio = batchLatency * inputRate;
+        
+        bool fallingBehind = (inputRate > 0) and 
+            (outputRate*100 < inputRate*DSL_DEFAULT_GIE_ADAPTIVE_MIN_THROUGHPUT);
+        
+        bool overloaded = fallingBehind or
+            (queueFill*100 >= DSL_DEFAULT_GIE_ADAPTIVE_HIGH_QUEUE_FILL) or
+            (latencyRatio*100 >= DSL_DEFAULT_GIE_ADAPTIVE_HIGH_LATENCY);
+            
+        // Project the latency for the next lower interval, inferring on 1 in 
+        // every interval batches rather than 1 in every interval+1, so that 
+        // stepping down does not push the GIE straight back into overload.
+        double projectedRatio = (m_intervalInUse)
+            ? latencyRatio * (m_intervalInUse + 1) / m_intervalInUse
+            : latencyRatio;
+            
+        bool underloaded = !overloaded and (inputRate > 0) and
+            (queueFill*100 <= DSL_DEFAULT_GIE_ADAPTIVE_LOW_QUEUE_FILL) and
+            (projectedRatio*100 <= DSL_DEFAULT_GIE_ADAPTIVE_LOW_LATENCY);
+        
+        if (overloaded)
+        {
+            m_underloadedCount = 0;
+            if (++m_overloadedCount >= DSL_DEFAULT_GIE_ADAPTIVE_UP_HYSTERESIS and
+                m_intervalInUse < m_maxInterval)
+            {
+                LOG_INFO("PrimaryGieBintr '" << GetName() << "' is overloaded: queue fill = " 
+                    << queueFill << ", input rate = " << inputRate << ", output rate = " 
+                    << outputRate << ", latency = " << batchLatency);
+                UpdateIntervalInUse(m_intervalInUse + 1);
+                m_overloadedCount = 0;
+            }
+        }
+        else if (underloaded)
+        {
+            m_overloadedCount = 0;
+            if (++m_underloadedCount >= DSL_DEFAULT_GIE_ADAPTIVE_DOWN_HYSTERESIS and
+                m_intervalInUse > m_minInterval)
+            {
+                UpdateIntervalInUse(m_intervalInUse - 1);
+                m_underloadedCount = 0;
+            }
+        }
+        else
+        {
+            m_overloadedCount = 0;
+            m_underloadedCount = 0;
+        }
+        return m_intervalInUse;
+    }
+
+    void PrimaryGieBintr::UpdateIntervalInUse(uint interval)
+    {
+        LOG_INFO("Updating Interval for PrimaryGieBintr '" << GetName() 
+            << "' from " << m_intervalInUse << " to " << interval);
+            
+        uint prevInterval = m_intervalInUse;
+        m_intervalInUse = interval;
+        m_pInferEngine->SetAttribute("interval", m_intervalInUse);
+        
+        for (auto const& imap: m_intervalChangeListeners)
+        {
+            imap.first(prevInterval, m_intervalInUse, imap.second);
+        }
+    }
+
+    static GstPadProbeReturn PrimaryGieQueueSinkPadProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pGie)
+    {
+        static_cast<PrimaryGieBintr*>(pGie)->
+            HandleQueueSinkPadBuffer((GstBuffer*)pInfo->data);
+        return GST_PAD_PROBE_OK;
+    }
+
+    static GstPadProbeReturn PrimaryGieInferSrcPadProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pGie)
+    {
+        static_cast<PrimaryGieBintr*>(pGie)->
+            HandleInferSrcPadBuffer((GstBuffer*)pInfo->data);
+        return GST_PAD_PROBE_OK;
+    }
+
+    static int IntervalUpdateHandler(gpointer pGie)
+    {
+        return static_cast<PrimaryGieBintr*>(pGie)->HandleIntervalUpdate();
+    }
+
     // ***********************************************************************
 
     SecondaryGieBintr::SecondaryGieBintr(const char* name, const char* inferConfigFile,
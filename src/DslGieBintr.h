@@ -102,6 +102,15 @@ namespace DSL
          */
         bool SetBatchSize(uint batchSize);
         
+        /**
+         * @brief updates the batch size for this Bintr while linked, i.e. on a 
+         * dynamic Source add/remove. The Infer Engine latches its batch-size on model
+         * load, so the new value is applied on the next link. Until then, batches 
+         * larger than the engine's batch-size are inferred in multiple passes.
+         * @param the new batchSize to use
+         */
+        bool UpdateBatchSize(uint batchSize);
+        
         /**
          * @brief sets the interval for this Bintr
          * @param the new interval to use
@@ -257,8 +266,100 @@ namespace DSL
          */
         bool SetGpuId(uint gpuId);
 
+        /**
+         * @brief Gets the current adaptive interval settings for this PrimaryGieBintr
+         * @param[out] enabled true if the adaptive interval controller is enabled
+         * @param[out] minInterval lower bound for the infer interval
+         * @param[out] maxInterval upper bound for the infer interval
+         */
+        void GetIntervalAdaptive(bool* enabled, uint* minInterval, uint* maxInterval);
+
+        /**
+         * @brief Sets the adaptive interval settings for this PrimaryGieBintr. 
+         * The controller, when enabled, is started on LinkAll and stopped on UnlinkAll
+         * @param[in] enabled set to true to enable the adaptive interval controller
+         * @param[in] minInterval lower bound for the infer interval
+         * @param[in] maxInterval upper bound for the infer interval
+         * @return false if currently linked or minInterval > maxInterval, true otherwise
+         */
+        bool SetIntervalAdaptive(bool enabled, uint minInterval, uint maxInterval);
+        
+        /**
+         * @brief gets the infer interval currently set on the Infer Engine, which 
+         * differs from GetInterval while the adaptive controller is running
+         * @return the infer interval in use
+         */
+        uint GetIntervalInUse();
+
+        /**
+         * @brief adds an interval-change listener to this PrimaryGieBintr
+         * @param[in] listener client callback function to add
+         * @param[in] clientData opaque pointer to client data to return on callback
+         * @return true on successful add, false otherwise
+         */
+        bool AddIntervalChangeListener(dsl_gie_interval_change_listener_cb listener, 
+            void* clientData);
+        
+        /**
+         * @brief removes a previously added interval-change listener
+         * @param[in] listener client callback function to remove
+         * @return true on successful remove, false otherwise
+         */
+        bool RemoveIntervalChangeListener(dsl_gie_interval_change_listener_cb listener);
+
+        /**
+         * @brief Handles a buffer entering the Queue in front of the Infer Engine
+         * @param[in] pBuffer the batched buffer entering the Queue
+         */
+        void HandleQueueSinkPadBuffer(GstBuffer* pBuffer);
+
+        /**
+         * @brief Handles a buffer leaving the Infer Engine
+         * @param[in] pBuffer the batched buffer leaving the Infer Engine
+         */
+        void HandleInferSrcPadBuffer(GstBuffer* pBuffer);
+
+        /**
+         * @brief Handles the adaptive interval update-timer expiration, 
+         * collecting the health signals for the last period.
+         * @return true to continue, false to stop the timer
+         */
+        int HandleIntervalUpdate();
+
+        /**
+         * @brief Evaluates one period of load measurements, stepping the infer 
+         * interval up or down by one, within bounds, once the load has persisted 
+         * for the hysteresis number of periods. Listeners are notified on change.
+         * @param[in] queueFill fill level of the Queue in front of the Infer Engine [0..1]
+         * @param[in] inputRate rate of batches entering the GIE in batches/second
+         * @param[in] outputRate rate of batches leaving the GIE in batches/second
+         * @param[in] batchLatency average time a batch spends in the GIE in seconds
+         * @return the infer interval in use following evaluation
+         */
+        uint EvaluateIntervalLoad(double queueFill, double inputRate, 
+            double outputRate, double batchLatency);
+
     private:
 
+        /**
+         * @brief starts the adaptive interval controller, adding all probes
+         * and the update timer.
+         * @return true on successful start, false otherwise
+         */
+        bool StartIntervalAdaptive();
+
+        /**
+         * @brief stops the adaptive interval controller, removing all probes
+         * and the update timer, and restores the configured interval.
+         */
+        void StopIntervalAdaptive();
+
+        /**
+         * @brief sets the infer interval in use and notifies all listeners
+         * @param[in] interval new infer interval to use
+         */
+        void UpdateIntervalInUse(uint interval);
+
         /**
          * @brief Video Converter Elementr for this PrimaryGieBintr
          */
@@ -268,8 +369,109 @@ namespace DSL
          * @brief Tee Elementr for this PrimaryGieBintr
          */
         DSL_ELEMENT_PTR  m_pTee;
+        
+        /**
+         * @brief true if the adaptive interval controller is enabled
+         */
+        bool m_isIntervalAdaptive;
+        
+        /**
+         * @brief lower bound for the adaptive infer interval
+         */
+        uint m_minInterval;
+        
+        /**
+         * @brief upper bound for the adaptive infer interval
+         */
+        uint m_maxInterval;
+        
+        /**
+         * @brief infer interval currently set on the Infer Engine, 
+         * which differs from m_interval when the adaptive controller is running
+         */
+        uint m_intervalInUse;
+        
+        /**
+         * @brief number of consecutive overloaded update periods
+         */
+        uint m_overloadedCount;
+        
+        /**
+         * @brief number of consecutive underloaded update periods
+         */
+        uint m_underloadedCount;
+        
+        /**
+         * @brief number of batches that entered the GIE in the current period
+         */
+        uint m_inputBatchCount;
+        
+        /**
+         * @brief number of batches that left the GIE in the current period
+         */
+        uint m_outputBatchCount;
+        
+        /**
+         * @brief accumulated GIE latency, in microseconds, for the current period
+         */
+        gint64 m_accumulatedLatency;
+        
+        /**
+         * @brief monotonic time of the last update period
+         */
+        gint64 m_lastUpdateTime;
+        
+        /**
+         * @brief map of entry times by buffer PTS for batches in the GIE
+         */
+        std::map<GstClockTime, gint64> m_batchEntryTimes;
+        
+        /**
+         * @brief probe id for the Queue sink pad probe
+         */
+        gulong m_queueProbeId;
+        
+        /**
+         * @brief probe id for the Infer Engine src pad probe
+         */
+        gulong m_inferProbeId;
+        
+        /**
+         * @brief gsource for the adaptive interval update timer
+         */
+        GSource* m_pIntervalTimerSource;
+        
+        /**
+         * @brief map of all currently registered interval-change listeners
+         */
+        std::map<dsl_gie_interval_change_listener_cb, void*> m_intervalChangeListeners;
+        
+        /**
+         * @brief mutex to protect the adaptive interval state shared between
+         * the streaming threads and the update timer
+         */
+        GMutex m_adaptiveIntervalMutex;
     };
 
+    /**
+     * @brief Probe callback for batches entering the Primary GIE's Queue
+     */
+    static GstPadProbeReturn PrimaryGieQueueSinkPadProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pGie);
+
+    /**
+     * @brief Probe callback for batches leaving the Primary GIE's Infer Engine
+     */
+    static GstPadProbeReturn PrimaryGieInferSrcPadProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pGie);
+
+    /**
+     * @brief Timer callback to update the adaptive infer interval
+     * @param pGie pointer to the PrimaryGieBintr that started the timer
+     * @return true to continue, false to stop
+     */
+    static int IntervalUpdateHandler(gpointer pGie);
+
     /**
      * @class SecondaryGie
      * @brief Implements a container for a Secondary GST Infer Engine (GIE)
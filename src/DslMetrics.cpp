@@ -0,0 +1,424 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslMetrics.h"
+
+namespace DSL
+{
+    // Initialize the Registry's single instance pointer
+    MetricsRegistry* MetricsRegistry::m_pInstance = NULL;
+
+    MetricsRegistry* MetricsRegistry::GetRegistry()
+    {
+        // one time initialization of the single instance pointer
+        if (!m_pInstance)
+        {
+            LOG_INFO("Metrics Registry Initialization");
+            
+            m_pInstance = new MetricsRegistry();
+        }
+        return m_pInstance;
+    }
+    
+    MetricsRegistry::MetricsRegistry()
+        : m_httpFd(-1)
+        , m_httpStop(false)
+        , m_pHttpThread(NULL)
+        , m_fileTimerId(0)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_registryMutex);
+        g_mutex_init(&m_exporterMutex);
+    }
+    
+    std::string MetricsRegistry::Label(const char* key, const std::string& value)
+    {
+        std::string label(key);
+        label += "=\"";
+        for (auto const& ich: value)
+        {
+            switch (ich)
+            {
+            case '\\':
+                label += "\\\\";
+                break;
+            case '"':
+                label += "\\\"";
+                break;
+            case '\n':
+                label += "\\n";
+                break;
+            default:
+                label += ich;
+            }
+        }
+        label += "\"";
+        return label;
+    }
+    
+    DSL_METRIC_PTR MetricsRegistry::FindMetric(const char* name, const std::string& labels)
+    {
+        DSL_METRIC_PTR pFound;
+        
+        for (auto ivec = m_metrics.begin(); ivec != m_metrics.end();)
+        {
+            DSL_METRIC_PTR pMetric = ivec->lock();
+            if (!pMetric)
+            {
+                ivec = m_metrics.erase(ivec);
+                continue;
+            }
+            if (!pFound and pMetric->m_name == name and pMetric->m_labels == labels)
+            {
+                pFound = pMetric;
+            }
+            ivec++;
+        }
+        return pFound;
+    }
+    
+    DSL_METRIC_COUNTER_PTR MetricsRegistry::GetCounter(const char* name, 
+        const char* help, const std::string& labels)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_registryMutex);
+        
+        DSL_METRIC_COUNTER_PTR pCounter = 
+            std::dynamic_pointer_cast<MetricCounter>(FindMetric(name, labels));
+        if (!pCounter)
+        {
+            pCounter = std::shared_ptr<MetricCounter>(
+                new MetricCounter(name, help, labels));
+            m_metrics.push_back(pCounter);
+        }
+        return pCounter;
+    }
+    
+    DSL_METRIC_GAUGE_PTR MetricsRegistry::GetGauge(const char* name, 
+        const char* help, const std::string& labels)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_registryMutex);
+        
+        DSL_METRIC_GAUGE_PTR pGauge = 
+            std::dynamic_pointer_cast<MetricGauge>(FindMetric(name, labels));
+        if (!pGauge)
+        {
+            pGauge = std::shared_ptr<MetricGauge>(
+                new MetricGauge(name, help, labels));
+            m_metrics.push_back(pGauge);
+        }
+        return pGauge;
+    }
+    
+    uint MetricsRegistry::GetSize()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_registryMutex);
+        
+        uint size(0);
+        for (auto const& ivec: m_metrics)
+        {
+            if (!ivec.expired())
+            {
+                size++;
+            }
+        }
+        return size;
+    }
+    
+    std::string MetricsRegistry::ToPrometheusText()
+    {
+        std::vector<DSL_METRIC_PTR> metrics;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_registryMutex);
+            
+            for (auto const& ivec: m_metrics)
+            {
+                DSL_METRIC_PTR pMetric = ivec.lock();
+                if (pMetric)
+                {
+                    metrics.push_back(pMetric);
+                }
+            }
+        }
+        // all samples of a metric must be grouped under a single HELP/TYPE header
+        std::stable_sort(metrics.begin(), metrics.end(), 
+            [](const DSL_METRIC_PTR& a, const DSL_METRIC_PTR& b)
+            {
+                return a->m_name < b->m_name;
+            });
+        
+        std::string text;
+        std::string lastName;
+        char value[32];
+        
+        for (auto const& ivec: metrics)
+        {
+            if (ivec->m_name != lastName)
+            {
+                text += "# HELP " + ivec->m_name + " " + ivec->m_help + "\n";
+                text += "# TYPE " + ivec->m_name + " " + ivec->GetType() + "\n";
+                lastName = ivec->m_name;
+            }
+            snprintf(value, sizeof(value), "%.12g", ivec->GetValue());
+            
+            text += ivec->m_name;
+            if (ivec->m_labels.size())
+            {
+                text += "{" + ivec->m_labels + "}";
+            }
+            text += " ";
+            text += value;
+            text += "\n";
+        }
+        return text;
+    }
+    
+    bool MetricsRegistry::StartHttpExporter(uint port)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_exporterMutex);
+        
+        if (m_pHttpThread)
+        {
+            LOG_ERROR("Metrics HTTP exporter is already running");
+            return false;
+        }
+        if (!port or port > UINT16_MAX)
+        {
+            LOG_ERROR("Invalid port '" << port << "' for the Metrics HTTP exporter");
+            return false;
+        }
+        int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0)
+        {
+            LOG_ERROR("Metrics HTTP exporter failed to create socket with error: " 
+                << strerror(errno));
+            return false;
+        }
+        int reuse(1);
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        
+        // Local scraping only, the endpoint is not exposed outside of the host
+        struct sockaddr_in address = {0};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        
+        if (bind(fd, (struct sockaddr*)&address, sizeof(address)) < 0 or 
+            listen(fd, 8) < 0)
+        {
+            LOG_ERROR("Metrics HTTP exporter failed to listen on port '" << port 
+                << "' with error: " << strerror(errno));
+            close(fd);
+            return false;
+        }
+        m_httpFd = fd;
+        m_httpStop = false;
+        m_pHttpThread = g_thread_new("dsl-metrics-http", MetricsHttpExporterThread, this);
+        
+        LOG_INFO("Metrics HTTP exporter listening on port " << port);
+        return true;
+    }
+    
+    bool MetricsRegistry::StopHttpExporter()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_exporterMutex);
+        
+        if (!m_pHttpThread)
+        {
+            LOG_ERROR("Metrics HTTP exporter is not running");
+            return false;
+        }
+        m_httpStop = true;
+        g_thread_join(m_pHttpThread);
+        m_pHttpThread = NULL;
+        
+        close(m_httpFd);
+        m_httpFd = -1;
+        
+        LOG_INFO("Metrics HTTP exporter stopped");
+        return true;
+    }
+    
+    void MetricsRegistry::RunHttpExporter()
+    {
+        LOG_FUNC();
+        
+        while (!m_httpStop)
+        {
+            // poll with a timeout so that the stop flag is checked regularly
+            struct pollfd pollFd = {m_httpFd, POLLIN, 0};
+            if (poll(&pollFd, 1, 250) <= 0)
+            {
+                continue;
+            }
+            int clientFd = accept(m_httpFd, NULL, NULL);
+            if (clientFd < 0)
+            {
+                continue;
+            }
+            struct timeval timeout = {1, 0};
+            setsockopt(clientFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            setsockopt(clientFd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+            
+            // Only the request line is needed, the rest of the request is ignored
+            char request[1024];
+            ssize_t received = recv(clientFd, request, sizeof(request)-1, 0);
+            if (received > 0)
+            {
+                request[received] = 0;
+                
+                std::string status("200 OK");
+                std::string body;
+                if (strncmp(request, "GET /metrics", 12) == 0 or 
+                    strncmp(request, "GET / ", 6) == 0)
+                {
+                    body = ToPrometheusText();
+                }
+                else
+                {
+                    status = "404 Not Found";
+                }
+                std::string response = "HTTP/1.0 " + status + "\r\n"
+                    "Content-Type: text/plain; version=0.0.4\r\n"
+                    "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                    "Connection: close\r\n\r\n" + body;
+                
+                size_t sent(0);
+                while (sent < response.size())
+                {
+                    ssize_t written = send(clientFd, &response[sent], 
+                        response.size() - sent, MSG_NOSIGNAL);
+                    if (written <= 0)
+                    {
+                        break;
+                    }
+                    sent += written;
+                }
+            }
+            close(clientFd);
+        }
+    }
+    
+    bool MetricsRegistry::StartFileExporter(const char* filePath, uint interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_exporterMutex);
+        
+        if (m_fileTimerId)
+        {
+            LOG_ERROR("Metrics file exporter is already running");
+            return false;
+        }
+        if (!interval)
+        {
+            LOG_ERROR("Invalid interval of 0 for the Metrics file exporter");
+            return false;
+        }
+        m_filePath = filePath;
+        if (!WriteFile())
+        {
+            return false;
+        }
+        m_fileTimerId = g_timeout_add(interval*1000, MetricsFileExportTimeoutHandler, this);
+        
+        LOG_INFO("Metrics file exporter writing to '" << m_filePath 
+            << "' every " << interval << " seconds");
+        return true;
+    }
+    
+    bool MetricsRegistry::StopFileExporter()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_exporterMutex);
+        
+        if (!m_fileTimerId)
+        {
+            LOG_ERROR("Metrics file exporter is not running");
+            return false;
+        }
+        g_source_remove(m_fileTimerId);
+        m_fileTimerId = 0;
+        
+        LOG_INFO("Metrics file exporter stopped");
+        return true;
+    }
+    
+    int MetricsRegistry::HandleFileExportTimeout()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_exporterMutex);
+        
+        if (!m_fileTimerId)
+        {
+            return false;
+        }
+        // a failed write is logged and retried on the next interval
+        WriteFile();
+        return true;
+    }
+    
+    bool MetricsRegistry::WriteFile()
+    {
+        // write to a temporary file and rename, so that a scraper 
+        // never reads a partially written file
+        std::string tempPath = m_filePath + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::out | std::ios::trunc);
+            if (!file.is_open())
+            {
+                LOG_ERROR("Metrics file exporter failed to open '" << tempPath << "'");
+                return false;
+            }
+            file << ToPrometheusText();
+            if (!file.good())
+            {
+                LOG_ERROR("Metrics file exporter failed to write '" << tempPath << "'");
+                return false;
+            }
+        }
+        if (rename(tempPath.c_str(), m_filePath.c_str()) < 0)
+        {
+            LOG_ERROR("Metrics file exporter failed to rename '" << tempPath 
+                << "' with error: " << strerror(errno));
+            return false;
+        }
+        return true;
+    }
+    
+    static gpointer MetricsHttpExporterThread(gpointer pRegistry)
+    {
+        static_cast<MetricsRegistry*>(pRegistry)->RunHttpExporter();
+        return NULL;
+    }
+    
+    static int MetricsFileExportTimeoutHandler(gpointer pRegistry)
+    {
+        return static_cast<MetricsRegistry*>(pRegistry)->HandleFileExportTimeout();
+    }
+}
@@ -0,0 +1,350 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_METRICS_H
+#define _DSL_METRICS_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_METRIC_PTR std::shared_ptr<Metric>
+    #define DSL_METRIC_COUNTER_PTR std::shared_ptr<MetricCounter>
+    #define DSL_METRIC_GAUGE_PTR std::shared_ptr<MetricGauge>
+
+    /**
+     * @class Metric
+     * @brief Base class for all metrics published to the Metrics Registry.
+     * A metric is identified by its name and label set, e.g. 
+     * dsl_ode_trigger_occurrences_total{trigger="my-trigger"}
+     */
+    class Metric
+    {
+    public:
+    
+        /**
+         * @brief ctor for the Metric base class
+         * @param[in] name metric name, must be a valid Prometheus metric name
+         * @param[in] help one line description for the metric
+         * @param[in] labels formatted label set, without braces, empty for none
+         */
+        Metric(const char* name, const char* help, const std::string& labels)
+            : m_name(name)
+            , m_help(help)
+            , m_labels(labels)
+        {};
+        
+        virtual ~Metric(){};
+        
+        /**
+         * @brief returns the metric's Prometheus type name
+         */
+        virtual const char* GetType() = 0;
+        
+        /**
+         * @brief returns the metric's current value for export
+         */
+        virtual double GetValue() = 0;
+        
+        /**
+         * @brief unique metric name
+         */
+        std::string m_name;
+        
+        /**
+         * @brief one line description of the metric
+         */
+        std::string m_help;
+
+        /**
+         * @brief formatted label set for the metric
+         */
+        std::string m_labels;
+    };
+    
+    /**
+     * @class MetricCounter
+     * @brief Monotonic counter, incremented lock-free from any thread
+     */
+    class MetricCounter : public Metric
+    {
+    public:
+    
+        MetricCounter(const char* name, const char* help, const std::string& labels)
+            : Metric(name, help, labels)
+            , m_value(0)
+        {};
+        
+        /**
+         * @brief increments the counter by delta
+         */
+        void Increment(uint64_t delta = 1)
+        {
+            m_value.fetch_add(delta, std::memory_order_relaxed);
+        }
+        
+        /**
+         * @brief returns the current count
+         */
+        uint64_t Get()
+        {
+            return m_value.load(std::memory_order_relaxed);
+        }
+        
+        const char* GetType()
+        {
+            return "counter";
+        }
+        
+        double GetValue()
+        {
+            return (double)Get();
+        }
+        
+    private:
+    
+        std::atomic<uint64_t> m_value;
+    };
+
+    /**
+     * @class MetricGauge
+     * @brief Gauge holding the last value set, updated lock-free from any thread
+     */
+    class MetricGauge : public Metric
+    {
+    public:
+    
+        MetricGauge(const char* name, const char* help, const std::string& labels)
+            : Metric(name, help, labels)
+            , m_value(0)
+        {};
+        
+        /**
+         * @brief sets the gauge to a new value
+         */
+        void Set(double value)
+        {
+            m_value.store(value, std::memory_order_relaxed);
+        }
+        
+        /**
+         * @brief returns the current value
+         */
+        double Get()
+        {
+            return m_value.load(std::memory_order_relaxed);
+        }
+        
+        const char* GetType()
+        {
+            return "gauge";
+        }
+        
+        double GetValue()
+        {
+            return Get();
+        }
+        
+    private:
+    
+        std::atomic<double> m_value;
+    };
+
+    /**
+     * @class MetricsRegistry
+     * @brief Implements a singleton registry of all metrics published by the 
+     * DSL components, with exporters for the Prometheus text exposition format. 
+     * Components own their metrics; the registry holds weak references only, 
+     * so metrics are removed from the export once their component is deleted.
+     */
+    class MetricsRegistry
+    {
+    public:
+    
+        /**
+         * @brief Returns a pointer to this singleton
+         */
+        static MetricsRegistry* GetRegistry();
+        
+        /**
+         * @brief formats a single label for a metric's label set, escaping the value
+         * @param[in] key label name
+         * @param[in] value label value
+         * @return formatted label, e.g. source="my-source"
+         */
+        static std::string Label(const char* key, const std::string& value);
+        
+        /**
+         * @brief gets a counter from the registry, creating it if one with the same 
+         * name and labels is not currently registered
+         * @param[in] name metric name
+         * @param[in] help one line description for the metric
+         * @param[in] labels formatted label set, empty for none
+         * @return shared pointer to the counter, owned by the caller
+         */
+        DSL_METRIC_COUNTER_PTR GetCounter(const char* name, 
+            const char* help, const std::string& labels);
+        
+        /**
+         * @brief gets a gauge from the registry, creating it if one with the same 
+         * name and labels is not currently registered
+         * @param[in] name metric name
+         * @param[in] help one line description for the metric
+         * @param[in] labels formatted label set, empty for none
+         * @return shared pointer to the gauge, owned by the caller
+         */
+        DSL_METRIC_GAUGE_PTR GetGauge(const char* name, 
+            const char* help, const std::string& labels);
+        
+        /**
+         * @brief returns the number of metrics currently registered
+         */
+        uint GetSize();
+        
+        /**
+         * @brief writes all registered metrics in the Prometheus text format
+         * @return the exposition text
+         */
+        std::string ToPrometheusText();
+        
+        /**
+         * @brief starts serving the metrics over HTTP on the loopback interface
+         * @param[in] port TCP port to listen on
+         * @return false if already running or the socket could not be bound
+         */
+        bool StartHttpExporter(uint port);
+        
+        /**
+         * @brief stops the HTTP exporter and joins its thread
+         * @return false if not running
+         */
+        bool StopHttpExporter();
+        
+        /**
+         * @brief starts writing the metrics to a text file at a periodic interval.
+         * The file is replaced atomically on each write.
+         * @param[in] filePath absolute or relative path to the file to write
+         * @param[in] interval write interval in seconds, > 0
+         * @return false if already running, the interval is 0, or the 
+         * first write fails
+         */
+        bool StartFileExporter(const char* filePath, uint interval);
+        
+        /**
+         * @brief stops the file exporter
+         * @return false if not running
+         */
+        bool StopFileExporter();
+        
+        /**
+         * @brief accepts and serves HTTP requests until stopped. 
+         * Called by the HTTP exporter thread only
+         */
+        void RunHttpExporter();
+        
+        /**
+         * @brief writes the metrics file on file exporter timeout
+         * @return true to continue the timer, false otherwise
+         */
+        int HandleFileExportTimeout();
+        
+    private:
+    
+        MetricsRegistry();
+        
+        /**
+         * @brief finds a live metric with the same name and labels, pruning 
+         * expired metrics as it searches. Registry mutex must be held
+         */
+        DSL_METRIC_PTR FindMetric(const char* name, const std::string& labels);
+        
+        /**
+         * @brief writes the metrics to the exporter's file
+         * @return true on success
+         */
+        bool WriteFile();
+        
+        /**
+         * @brief single instance pointer
+         */
+        static MetricsRegistry* m_pInstance;
+        
+        /**
+         * @brief weak references to all metrics published by components
+         */
+        std::vector<std::weak_ptr<Metric>> m_metrics;
+        
+        /**
+         * @brief mutex to protect the list of metrics. Not taken on update
+         */
+        GMutex m_registryMutex;
+        
+        /**
+         * @brief mutex to protect the exporter settings
+         */
+        GMutex m_exporterMutex;
+        
+        /**
+         * @brief listening socket for the HTTP exporter, -1 when not running
+         */
+        int m_httpFd;
+        
+        /**
+         * @brief set to true to signal the HTTP exporter thread to exit
+         */
+        std::atomic<bool> m_httpStop;
+        
+        /**
+         * @brief HTTP exporter thread
+         */
+        GThread* m_pHttpThread;
+        
+        /**
+         * @brief path to the file exporter's output file
+         */
+        std::string m_filePath;
+        
+        /**
+         * @brief file exporter timer id, 0 when not running
+         */
+        uint m_fileTimerId;
+    };
+    
+    /**
+     * @brief thread function for the HTTP exporter
+     * @param[in] pRegistry pointer to the Metrics Registry
+     */
+    static gpointer MetricsHttpExporterThread(gpointer pRegistry);
+    
+    /**
+     * @brief timer callback for the file exporter
+     * @param[in] pRegistry pointer to the Metrics Registry
+     */
+    static int MetricsFileExportTimeoutHandler(gpointer pRegistry);
+}
+
+#endif // _DSL_METRICS_H
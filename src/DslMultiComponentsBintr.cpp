@@ -31,9 +31,14 @@ namespace DSL
 
     MultiComponentsBintr::MultiComponentsBintr(const char* name, const char* teeType)
         : Bintr(name)
+        , m_isTeeSrcPadIdle(false)
+        , m_pendingChildSinkEos(0)
     {
         LOG_FUNC();
         
+        g_mutex_init(&m_hotPlugMutex);
+        g_cond_init(&m_hotPlugCond);
+        
         // Single Queue and Tee element for all Components
         m_pQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "sink_bin_queue");
         m_pTee = DSL_ELEMENT_NEW(teeType, "sink_bin_tee");
@@ -55,6 +60,8 @@ namespace DSL
         {
             UnlinkAll();
         }
+        g_cond_clear(&m_hotPlugCond);
+        g_mutex_clear(&m_hotPlugMutex);
     }
     
 
@@ -86,10 +93,40 @@ namespace DSL
             return false;
         }
         
-        // If the Pipeline is currently in a linked state, Set child source Id to the next available,
-        // linkAll Elementrs now and Link to with the Stream
+        // If the Pipeline is currently in a linked state, Set child source Id to the lowest unused,
+        // linkAll Elementrs now and Link to with the Stream. For the Demuxer, the Id selects the 
+        // "src_<id>" pad, so a re-added Component must take back the Id - and stream - that was freed
         if (IsLinked())
         {
+            int id(0);
+            while (std::find_if(m_pChildComponents.begin(), m_pChildComponents.end(),
+                [id, pChildComponent](const std::pair<const std::string, DSL_BINTR_PTR>& imap)
+                {
+                    return imap.second != pChildComponent and imap.second->GetId() == id;
+                }) != m_pChildComponents.end())
+            {
+                id++;
+            }
+            if (!IsValidChildId(id))
+            {
+                m_pChildComponents.erase(pChildComponent->GetName());
+                Bintr::RemoveChild(pChildComponent);
+                return false;
+            }
+            pChildComponent->SetId(id);
+            
+            // The batch size may have been updated since this Bintr was linked
+            if (m_batchSize and !pChildComponent->SetBatchSize(m_batchSize))
+            {
+                m_pChildComponents.erase(pChildComponent->GetName());
+                Bintr::RemoveChild(pChildComponent);
+                return false;
+            }
+            
+            if (IsPlaying())
+            {
+                return AttachChildWhilePlaying(pChildComponent);
+            }
             if (!pChildComponent->LinkAll() or !pChildComponent->LinkToSource(m_pTee))
             {
                 return false;
@@ -126,9 +163,20 @@ namespace DSL
         }
         if (pChildComponent->IsLinkedToSource())
         {
-            // unlink the sink from the Tee
-            pChildComponent->UnlinkFromSource();
-            pChildComponent->UnlinkAll();
+            if (IsPlaying())
+            {
+                if (!DetachChildWhilePlaying(pChildComponent))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                // unlink the sink from the Tee
+                pChildComponent->UnlinkFromSource();
+                pChildComponent->UnlinkAll();
+            }
+            pChildComponent->SetId(-1);
         }
         
         // unreference and remove from the collection of sinks
@@ -269,6 +317,189 @@ namespace DSL
         return Bintr::SetBatchSize(batchSize);
     }
  
+    bool MultiComponentsBintr::UpdateBatchSize(uint batchSize)
+    {
+        LOG_FUNC();
+        
+        if (!IsLinked())
+        {
+            return SetBatchSize(batchSize);
+        }
+        LOG_INFO("Batch size for linked Tee '" << GetName() << "' updated to '" 
+            << batchSize << "' - linked Child Components are updated on next link");
+        return Bintr::SetBatchSize(batchSize);
+    }
+ 
+    bool MultiComponentsBintr::IsPlaying()
+    {
+        LOG_FUNC();
+        
+        if (!IsLinked())
+        {
+            return false;
+        }
+        GstState currentState;
+        gst_element_get_state(GetGstElement(), &currentState, NULL, 0);
+        
+        return (currentState == GST_STATE_PLAYING);
+    }
+
+    bool MultiComponentsBintr::AttachChildWhilePlaying(DSL_BINTR_PTR pChildComponent)
+    {
+        LOG_FUNC();
+        
+        if (!pChildComponent->LinkAll())
+        {
+            LOG_ERROR("MultiComponentsBintr '" << GetName() 
+                << "' failed to Link Child Component '" << pChildComponent->GetName() << "'");
+            return false;
+        }
+        // Bring the Child up to the parent's state before linking to the Tee so 
+        // that no data is pushed to the Child while it's changing state
+        if (!gst_element_sync_state_with_parent(pChildComponent->GetGstElement()))
+        {
+            LOG_ERROR("MultiComponentsBintr '" << GetName() 
+                << "' failed to sync state for Child Component '" << pChildComponent->GetName() << "'");
+            pChildComponent->UnlinkAll();
+            return false;
+        }
+        if (!pChildComponent->LinkToSource(m_pTee))
+        {
+            LOG_ERROR("MultiComponentsBintr '" << GetName() 
+                << "' failed to Link Child Component '" << pChildComponent->GetName() << "' to Tee");
+            gst_element_set_state(pChildComponent->GetGstElement(), GST_STATE_NULL);
+            pChildComponent->UnlinkAll();
+            return false;
+        }
+        LOG_INFO("Child Component '" << pChildComponent->GetName() 
+            << "' attached to MultiComponentsBintr '" << GetName() << "' while playing");
+        return true;
+    }
+
+    bool MultiComponentsBintr::DetachChildWhilePlaying(DSL_BINTR_PTR pChildComponent)
+    {
+        LOG_FUNC();
+        
+        GstPad* pChildSinkPad = 
+            gst_element_get_static_pad(pChildComponent->GetGstElement(), "sink");
+        GstPad* pTeeSrcPad = (pChildSinkPad) ? gst_pad_get_peer(pChildSinkPad) : NULL;
+        if (!pTeeSrcPad)
+        {
+            LOG_ERROR("Failed to get Tee src pad for Child Component '" 
+                << pChildComponent->GetName() << "'");
+            if (pChildSinkPad) gst_object_unref(pChildSinkPad);
+            return false;
+        }
+        gint64 timeout(DSL_DEFAULT_TEE_BRANCH_DETACH_TIMEOUT_IN_MS * G_TIME_SPAN_MILLISECOND);
+        
+        // Drop all data to the Child at the Tee src pad, the Tee and the other 
+        // Child Components continue to stream, then wait for any push in progress
+        gulong dropProbeId = gst_pad_add_probe(pTeeSrcPad, GST_PAD_PROBE_TYPE_DATA_DOWNSTREAM,
+            MultiComponentsTeeSrcPadDropProbeCB, this, NULL);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_hotPlugMutex);
+            m_isTeeSrcPadIdle = false;
+        }
+        // Note: the idle callback is called immediately if the pad is idle
+        gulong idleProbeId = gst_pad_add_probe(pTeeSrcPad, GST_PAD_PROBE_TYPE_IDLE,
+            MultiComponentsTeeSrcPadIdleProbeCB, this, NULL);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_hotPlugMutex);
+            
+            gint64 endTime(g_get_monotonic_time() + timeout);
+            while (!m_isTeeSrcPadIdle and 
+                g_cond_wait_until(&m_hotPlugCond, &m_hotPlugMutex, endTime));
+                
+            if (!m_isTeeSrcPadIdle)
+            {
+                LOG_WARN("Timeout waiting for Tee src pad to idle for Child Component '"
+                    << pChildComponent->GetName() << "'");
+                gst_pad_remove_probe(pTeeSrcPad, idleProbeId);
+            }
+        }
+        
+        // Drain the Child with an EOS, waiting for the EOS to reach all of its sinks
+        std::vector<std::pair<GstPad*, gulong>> childSinkProbes;
+        
+        GstIterator* pIterator = gst_bin_iterate_sinks(GST_BIN(pChildComponent->GetGstElement()));
+        GValue item = G_VALUE_INIT;
+        while (gst_iterator_next(pIterator, &item) == GST_ITERATOR_OK)
+        {
+            GstPad* pSinkPad = gst_element_get_static_pad(
+                GST_ELEMENT(g_value_get_object(&item)), "sink");
+            if (pSinkPad)
+            {
+                childSinkProbes.push_back(std::make_pair(pSinkPad, 
+                    gst_pad_add_probe(pSinkPad, GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM,
+                        MultiComponentsChildSinkEventProbeCB, this, NULL)));
+            }
+            g_value_reset(&item);
+        }
+        g_value_unset(&item);
+        gst_iterator_free(pIterator);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_hotPlugMutex);
+            m_pendingChildSinkEos = childSinkProbes.size();
+        }
+        gst_pad_send_event(pChildSinkPad, gst_event_new_eos());
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_hotPlugMutex);
+            
+            gint64 endTime(g_get_monotonic_time() + timeout);
+            while (m_pendingChildSinkEos and 
+                g_cond_wait_until(&m_hotPlugCond, &m_hotPlugMutex, endTime));
+                
+            if (m_pendingChildSinkEos)
+            {
+                LOG_WARN("Timeout waiting for Child Component '" 
+                    << pChildComponent->GetName() << "' to drain");
+            }
+        }
+        for (auto const& ivec: childSinkProbes)
+        {
+            gst_pad_remove_probe(ivec.first, ivec.second);
+            gst_object_unref(ivec.first);
+        }
+        gst_object_unref(pChildSinkPad);
+        
+        // The Child is now drained and can be unlinked and stopped
+        bool result = pChildComponent->UnlinkFromSource();
+        gst_pad_remove_probe(pTeeSrcPad, dropProbeId);
+        gst_object_unref(pTeeSrcPad);
+        
+        gst_element_set_state(pChildComponent->GetGstElement(), GST_STATE_NULL);
+        pChildComponent->UnlinkAll();
+
+        if (!result)
+        {
+            LOG_ERROR("MultiComponentsBintr '" << GetName() 
+                << "' failed to Unlink Child Component '" << pChildComponent->GetName() << "'");
+            return false;
+        }
+        LOG_INFO("Child Component '" << pChildComponent->GetName() 
+            << "' detached from MultiComponentsBintr '" << GetName() << "' while playing");
+        return true;
+    }
+
+    void MultiComponentsBintr::HandleTeeSrcPadIdle()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_hotPlugMutex);
+        
+        m_isTeeSrcPadIdle = true;
+        g_cond_signal(&m_hotPlugCond);
+    }
+
+    void MultiComponentsBintr::HandleChildSinkEos()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_hotPlugMutex);
+        
+        if (m_pendingChildSinkEos)
+        {
+            m_pendingChildSinkEos--;
+        }
+        g_cond_signal(&m_hotPlugCond);
+    }
+
     MultiSinksBintr::MultiSinksBintr(const char* name)
         : MultiComponentsBintr(name, "tee")
     {
@@ -289,6 +520,20 @@ namespace DSL
         return std::dynamic_pointer_cast<BranchBintr>(pParentBintr)->
             AddDemuxerBintr(shared_from_this());
     }
+
+    bool DemuxerBintr::IsValidChildId(int id)
+    {
+        LOG_FUNC();
+        
+        // the batch size is only known once linked, and each Id maps to one stream 
+        if (m_batchSize and id >= (int)m_batchSize)
+        {
+            LOG_ERROR("Demuxer '" << GetName() << "' has no free stream for a new Component - all "
+                << m_batchSize << " streams are in use");
+            return false;
+        }
+        return true;
+    }
    
     SplitterBintr::SplitterBintr(const char* name)
         : MultiComponentsBintr(name, "tee")
@@ -305,4 +550,26 @@ namespace DSL
             AddSplitterBintr(shared_from_this());
     }
    
-}
\ No newline at end of file
+    static GstPadProbeReturn MultiComponentsTeeSrcPadDropProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMultiComponents)
+    {
+        return GST_PAD_PROBE_DROP;
+    }
+
+    static GstPadProbeReturn MultiComponentsTeeSrcPadIdleProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMultiComponents)
+    {
+        static_cast<MultiComponentsBintr*>(pMultiComponents)->HandleTeeSrcPadIdle();
+        return GST_PAD_PROBE_REMOVE;
+    }
+
+    static GstPadProbeReturn MultiComponentsChildSinkEventProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMultiComponents)
+    {
+        if (GST_EVENT_TYPE(GST_PAD_PROBE_INFO_EVENT(pInfo)) == GST_EVENT_EOS)
+        {
+            static_cast<MultiComponentsBintr*>(pMultiComponents)->HandleChildSinkEos();
+        }
+        return GST_PAD_PROBE_OK;
+    }
+}
@@ -128,8 +128,67 @@ namespace DSL
          * @param[in] batchSize the new batch size to use
          */
         bool SetBatchSize(uint batchSize);
+
+        /**
+         * @brief updates the batch size for this Bintr while linked, i.e. on a 
+         * dynamic Source add/remove. Linked Child Components keep their batch size
+         * until their next link, Child Components added while linked are given 
+         * the new batch size.
+         * @param[in] batchSize the new batch size to use
+         */
+        bool UpdateBatchSize(uint batchSize);
+
+        /**
+         * @brief Handles the IDLE probe on a Tee src pad being detached, called 
+         * once no data is being pushed to the Child Component on the pad
+         */
+        void HandleTeeSrcPadIdle();
+
+        /**
+         * @brief Handles an EOS event reaching one of the sinks of a Child 
+         * Component being detached
+         */
+        void HandleChildSinkEos();
+        
+    protected:
+    
+        /**
+         * @brief Checks whether a Child Component can be linked with a given Id
+         * @param[in] id the lowest unused Id to assign to the new Child Component
+         * @return true if the Id can be used, false otherwise
+         */
+        virtual bool IsValidChildId(int id)
+        {
+            return true;
+        }
         
     private:
+
+        /**
+         * @brief Returns true if this MultiComponentsBintr is linked and in a
+         * PLAYING state, requiring Child Components to be attached or detached
+         * without stopping the flow of data to the other Child Components
+         */
+        bool IsPlaying();
+
+        /**
+         * @brief Attaches a new Child Component while in a PLAYING state.
+         * The Child is brought up to the parent's state before its requested 
+         * Tee src pad is linked so no data is pushed to it while changing state
+         * @param[in] pChildComponent the Child Component to attach
+         * @return true on successful attach, false otherwise
+         */
+        bool AttachChildWhilePlaying(DSL_BINTR_PTR pChildComponent);
+
+        /**
+         * @brief Detaches a Child Component while in a PLAYING state. Data to
+         * the Child is dropped at its requested Tee src pad and, once the pad 
+         * is idle, the Child is drained with an EOS before being unlinked and
+         * stopped. The Tee and the other Child Components are never blocked.
+         * @param[in] pChildComponent the Child Component to detach
+         * @return true on successful detach, false otherwise
+         */
+        bool DetachChildWhilePlaying(DSL_BINTR_PTR pChildComponent);
     
         DSL_ELEMENT_PTR m_pQueue;
         DSL_ELEMENT_PTR m_pTee;
@@ -147,6 +206,24 @@ namespace DSL
          */
         std::map<std::string, GstPad*> m_pGstRequestedSourcePads;
 
+        /**
+         * @brief mutex and condition to synchronize the detach of a Child
+         * Component with the probes on the streaming threads
+         */
+        GMutex m_hotPlugMutex;
+        GCond m_hotPlugCond;
+        
+        /**
+         * @brief true once the Tee src pad being detached is idle
+         */
+        bool m_isTeeSrcPadIdle;
+        
+        /**
+         * @brief number of sinks of the Child Component being detached that 
+         * have yet to receive the EOS event
+         */
+        uint m_pendingChildSinkEos;
+
         /**
          * @brief adds a child Elementr to this PipelineSourcesBintr
          * @param pChildElement a shared pointer to the Elementr to add
@@ -207,8 +284,36 @@ namespace DSL
          * @param[in] pParentBintr Parent Pipeline to add this Bintr to
          */
         bool AddToParent(DSL_BASE_PTR pParentBintr);
+        
+    protected:
+    
+        /**
+         * @brief overrides the base method to limit Ids to the streams demuxed,
+         * as the Id of each Child Component selects its "src_<id>" pad
+         * @param[in] id the lowest unused Id to assign to the new Child Component
+         * @return true if the Id is less than the current batch size
+         */
+        bool IsValidChildId(int id);
     };
 
+    /**
+     * @brief Probe callback to drop all data on a Tee src pad being detached
+     */
+    static GstPadProbeReturn MultiComponentsTeeSrcPadDropProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMultiComponents);
+
+    /**
+     * @brief Probe callback for the Tee src pad being detached becoming idle
+     */
+    static GstPadProbeReturn MultiComponentsTeeSrcPadIdleProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMultiComponents);
+
+    /**
+     * @brief Probe callback for events on the sink pads of the sinks of a 
+     * Child Component being detached
+     */
+    static GstPadProbeReturn MultiComponentsChildSinkEventProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMultiComponents);
 }
 
 #endif // _DSL_PROCESS_BINTR_H
\ No newline at end of file
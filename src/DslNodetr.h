@@ -266,6 +266,66 @@ namespace DSL
         DSL_NODETR_PTR m_pSink;
     };
 
+    /**
+     * @brief Key for the GMainContext set as data on the GstPipeline of a 
+     * Pipeline with its own main-context, see PipelineBintr::SetMainContextEnabled
+     */
+    #define DSL_PIPELINE_MAIN_CONTEXT_KEY "dsl-main-context"
+
+    /**
+     * @brief Gets the main-context of the Pipeline that a GstObject belongs to
+     * @param[in] pGstObject element, bin, or pad to search up from
+     * @return the Pipeline's own main-context, or NULL for the default main-context
+     */
+    static inline GMainContext* GetPipelineMainContext(GstObject* pGstObject)
+    {
+        GMainContext* pMainContext(NULL);
+        GstObject* pObject = (pGstObject) ? GST_OBJECT(gst_object_ref(pGstObject)) : NULL;
+        
+        while (pObject and !pMainContext)
+        {
+            pMainContext = (GMainContext*)g_object_get_data(G_OBJECT(pObject), 
+                DSL_PIPELINE_MAIN_CONTEXT_KEY);
+            GstObject* pParent = gst_object_get_parent(pObject);
+            gst_object_unref(pObject);
+            pObject = pParent;
+        }
+        if (pObject)
+        {
+            gst_object_unref(pObject);
+        }
+        return pMainContext;
+    }
+
+    /**
+     * @brief Adds a timeout to the main-context of the Pipeline that a GstObject 
+     * belongs to. Used in place of g_timeout_add for all Pipeline component timers
+     * @param[in] pGstObject element, bin, or pad the timer is for
+     * @param[in] interval timeout interval in milliseconds
+     * @param[in] function timeout callback, return false to stop the timer
+     * @param[in] data opaque pointer returned with each callback
+     * @return new timeout source, to be removed with RemovePipelineTimeout
+     */
+    static inline GSource* AddPipelineTimeout(GstObject* pGstObject, 
+        uint interval, GSourceFunc function, gpointer data)
+    {
+        GSource* pSource = g_timeout_source_new(interval);
+        g_source_set_callback(pSource, function, data, NULL);
+        g_source_attach(pSource, GetPipelineMainContext(pGstObject));
+        return pSource;
+    }
+
+    /**
+     * @brief Removes a timeout added with AddPipelineTimeout, from any thread 
+     * and whether or not the timeout callback has already returned false
+     * @param[in] pSource timeout source to destroy and unreference
+     */
+    static inline void RemovePipelineTimeout(GSource* pSource)
+    {
+        g_source_destroy(pSource);
+        g_source_unref(pSource);
+    }
+
    /**
      * @class GstNodetr
      * @brief Overrides the Base Class Virtual functions, adding the actuall GstObject* management
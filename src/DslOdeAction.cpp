@@ -74,6 +74,22 @@ namespace DSL
     {
         LOG_FUNC();
     }
+
+    // ********************************************************************
+
+    PluginOdeAction::PluginOdeAction(const char* name, 
+        DSL_PLUGIN_INSTANCE_PTR pInstance)
+        : CustomOdeAction(name, pInstance->GetInfo()->handle_occurrence, 
+            pInstance->GetHandle())
+        , m_pInstance(pInstance)
+    {
+        LOG_FUNC();
+    }
+
+    PluginOdeAction::~PluginOdeAction()
+    {
+        LOG_FUNC();
+    }
     
     void CustomOdeAction::HandleOccurrence(DSL_BASE_PTR pBase, GstBuffer* pBuffer, NvDsDisplayMeta* pDisplayMeta, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
@@ -838,8 +854,16 @@ namespace DSL
     {
         if (m_enabled)
         {
+            // Standby Sources are already linked and running - attach only.
             // Ignore the return value, errors will be logged 
-            Services::GetServices()->PipelineComponentAdd(m_pipeline.c_str(), m_source.c_str());
+            if (Services::GetServices()->PipelineSourceIsStandby(m_pipeline.c_str(), m_source.c_str()))
+            {
+                Services::GetServices()->PipelineSourceStandbyAttach(m_pipeline.c_str(), m_source.c_str());
+            }
+            else
+            {
+                Services::GetServices()->PipelineComponentAdd(m_pipeline.c_str(), m_source.c_str());
+            }
         }
     }
 
@@ -864,8 +888,16 @@ namespace DSL
     {
         if (m_enabled)
         {
+            // Standby Sources are returned to the pool rather than removed.
             // Ignore the return value, errors will be logged 
-            Services::GetServices()->PipelineComponentRemove(m_pipeline.c_str(), m_source.c_str());
+            if (Services::GetServices()->PipelineSourceIsStandby(m_pipeline.c_str(), m_source.c_str()))
+            {
+                Services::GetServices()->PipelineSourceStandbyDetach(m_pipeline.c_str(), m_source.c_str());
+            }
+            else
+            {
+                Services::GetServices()->PipelineComponentRemove(m_pipeline.c_str(), m_source.c_str());
+            }
         }
     }
 
@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslBase.h"
 #include "DslDisplayTypes.h"
+#include "DslPlugin.h"
 
 #include <nvbufsurftransform.h>
 #include "opencv2/imgproc/imgproc.hpp"
@@ -46,6 +47,10 @@ namespace DSL
     #define DSL_ODE_ACTION_CUSTOM_NEW(name, clientHandler, clientData) \
         std::shared_ptr<CustomOdeAction>(new CustomOdeAction(name, clientHandler, clientData))
         
+    #define DSL_ODE_ACTION_PLUGIN_PTR std::shared_ptr<PluginOdeAction>
+    #define DSL_ODE_ACTION_PLUGIN_NEW(name, pInstance) \
+        std::shared_ptr<PluginOdeAction>(new PluginOdeAction(name, pInstance))
+        
     #define DSL_ODE_ACTION_CAPTURE_FRAME_PTR std::shared_ptr<CaptureFrameOdeAction>
     #define DSL_ODE_ACTION_CAPTURE_FRAME_NEW(name, outdir, annotate) \
         std::shared_ptr<CaptureFrameOdeAction>(new CaptureFrameOdeAction(name, outdir, annotate))
@@ -255,6 +260,35 @@ namespace DSL
 
     };
     
+    /**
+     * @class PluginOdeAction
+     * @brief Custom ODE Action with its handler provided by a native Plugin
+     */
+    class PluginOdeAction : public CustomOdeAction
+    {
+    public:
+    
+        /**
+         * @brief ctor for the Plugin ODE Action class
+         * @param[in] name unique name for the ODE Action
+         * @param[in] pInstance Plugin instance providing the handler,
+         * owned by the Action from this point forward
+         */
+        PluginOdeAction(const char* name, DSL_PLUGIN_INSTANCE_PTR pInstance);
+        
+        /**
+         * @brief dtor for the Plugin ODE Action class
+         */
+        ~PluginOdeAction();
+        
+    private:
+    
+        /**
+         * @brief Plugin instance passed as client data to the handler
+         */
+        DSL_PLUGIN_INSTANCE_PTR m_pInstance;
+    };
+    
     // ********************************************************************
 
     /**
@@ -57,6 +57,13 @@ namespace DSL
         LOG_FUNC();
 
         g_mutex_init(&m_propertyMutex);
+        
+        m_pOccurrencesMetric = MetricsRegistry::GetRegistry()->GetCounter(
+            "dsl_ode_trigger_occurrences_total", 
+            "Total ODE occurrences for each ODE Trigger",
+            MetricsRegistry::Label("trigger", m_name));
+        m_pEventCountMetric = MetricsRegistry::GetRegistry()->GetCounter(
+            "dsl_ode_events_total", "Total ODE occurrences for all ODE Triggers", "");
     }
 
     OdeTrigger::~OdeTrigger()
@@ -485,6 +492,7 @@ namespace DSL
         
         // update the total event count static variable
         s_eventCount++;
+        incrementMetrics();
 
         for (const auto &imap: m_pOdeActions)
         {
@@ -545,6 +553,7 @@ namespace DSL
 
          // update the total event count static variable
         s_eventCount++;
+        incrementMetrics();
 
         for (const auto &imap: m_pOdeActions)
         {
@@ -591,6 +600,7 @@ namespace DSL
 
          // update the total event count static variable
         s_eventCount++;
+        incrementMetrics();
 
         for (const auto &imap: m_pOdeActions)
         {
@@ -650,6 +660,7 @@ namespace DSL
                         
                          // update the total event count static variable
                         s_eventCount++;
+                        incrementMetrics();
 
                         for (const auto &imap: m_pOdeActions)
                         {
@@ -687,6 +698,21 @@ namespace DSL
         LOG_FUNC();
     }
     
+    PluginOdeTrigger::PluginOdeTrigger(const char* name, const char* source, 
+        uint classId, uint limit, DSL_PLUGIN_INSTANCE_PTR pInstance)
+        : CustomOdeTrigger(name, source, classId, limit, 
+            pInstance->GetInfo()->check_for_occurrence, 
+            pInstance->GetInfo()->post_process_frame, pInstance->GetHandle())
+        , m_pInstance(pInstance)
+    {
+        LOG_FUNC();
+    }
+
+    PluginOdeTrigger::~PluginOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+    
     bool CustomOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, NvDsDisplayMeta* pDisplayMeta, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
@@ -713,6 +739,7 @@ namespace DSL
         
         // update the total event count static variable
         s_eventCount++;
+        incrementMetrics();
 
         for (const auto &imap: m_pOdeActions)
         {
@@ -747,6 +774,7 @@ namespace DSL
 
          // update the total event count static variable
         s_eventCount++;
+        incrementMetrics();
 
         for (const auto &imap: m_pOdeActions)
         {
@@ -795,6 +823,7 @@ namespace DSL
 
          // update the total event count static variable
         s_eventCount++;
+        incrementMetrics();
 
         for (const auto &imap: m_pOdeActions)
         {
@@ -843,6 +872,7 @@ namespace DSL
 
          // update the total event count static variable
         s_eventCount++;
+        incrementMetrics();
 
         for (const auto &imap: m_pOdeActions)
         {
@@ -892,6 +922,7 @@ namespace DSL
 
          // update the total event count static variable
         s_eventCount++;
+        incrementMetrics();
 
         for (const auto &imap: m_pOdeActions)
         {
@@ -939,6 +970,7 @@ namespace DSL
             m_triggered++;
             // update the total event count static variable
             s_eventCount++;
+            incrementMetrics();
 
             uint smallestArea = UINT32_MAX;
             NvDsObjectMeta* smallestObject(NULL);
@@ -1004,6 +1036,7 @@ namespace DSL
             m_triggered++;
             // update the total event count static variable
             s_eventCount++;
+            incrementMetrics();
 
             uint largestArea = 0;
             NvDsObjectMeta* largestObject(NULL);
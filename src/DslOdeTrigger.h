@@ -28,6 +28,8 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslBase.h"
+#include "DslMetrics.h"
+#include "DslPlugin.h"
 
 namespace DSL
 {
@@ -61,6 +63,11 @@ namespace DSL
         std::shared_ptr<CustomOdeTrigger>(new CustomOdeTrigger(name, \
             source, classId, limit, clientChecker, clientPostProcessor, clientData))
 
+    #define DSL_ODE_TRIGGER_PLUGIN_PTR std::shared_ptr<PluginOdeTrigger>
+    #define DSL_ODE_TRIGGER_PLUGIN_NEW(name, source, classId, limit, pInstance) \
+        std::shared_ptr<PluginOdeTrigger>(new PluginOdeTrigger(name, \
+            source, classId, limit, pInstance))
+
     #define DSL_ODE_TRIGGER_MINIMUM_PTR std::shared_ptr<MinimumOdeTrigger>
     #define DSL_ODE_TRIGGER_MINIMUM_NEW(name, source, classId, limit, minimum) \
         std::shared_ptr<MinimumOdeTrigger>(new MinimumOdeTrigger(name, source, classId, limit, minimum))
@@ -298,6 +305,26 @@ namespace DSL
          */
         bool valueInRange(int value, int min, int max);
         
+        /**
+         * @brief increments the trigger's occurrence metric and the 
+         * total event metric, called on each event occurrence
+         */
+        void incrementMetrics()
+        {
+            m_pOccurrencesMetric->Increment();
+            m_pEventCountMetric->Increment();
+        }
+        
+        /**
+         * @brief published count of all occurrences for this trigger
+         */
+        DSL_METRIC_COUNTER_PTR m_pOccurrencesMetric;
+        
+        /**
+         * @brief published count of all events, shared by all triggers
+         */
+        DSL_METRIC_COUNTER_PTR m_pEventCountMetric;
+        
         /**
          * @brief Determines if two rectangles overlaps 
          * @param[in] a rectangle A for test
@@ -615,6 +642,32 @@ namespace DSL
     
     };    
 
+    /**
+     * @class PluginOdeTrigger
+     * @brief Custom ODE Trigger with its callbacks provided by a native Plugin
+     */
+    class PluginOdeTrigger : public CustomOdeTrigger
+    {
+    public:
+    
+        /**
+         * @brief ctor for the Plugin ODE Trigger class
+         * @param[in] pInstance Plugin instance providing the callbacks,
+         * owned by the Trigger from this point forward
+         */
+        PluginOdeTrigger(const char* name, const char* source, 
+            uint classId, uint limit, DSL_PLUGIN_INSTANCE_PTR pInstance);
+        
+        ~PluginOdeTrigger();
+        
+    private:
+    
+        /**
+         * @brief Plugin instance passed as client data to all callbacks
+         */
+        DSL_PLUGIN_INSTANCE_PTR m_pInstance;
+    };
+
     class MinimumOdeTrigger : public OdeTrigger
     {
     public:
@@ -34,6 +34,7 @@ namespace DSL
     PadProbeHandler::PadProbeHandler(const char* name)
         : Base(name)
         , m_isEnabled(false)
+        , m_pParentGstObj(NULL)
     {
         LOG_FUNC();
     }
@@ -59,6 +60,7 @@ namespace DSL
             return false;
         }
         AssignParentName(pParentBintr->GetName());
+        m_pParentGstObj = pParentBintr->GetGstObject();
         return true;
     }
 
@@ -76,6 +78,7 @@ namespace DSL
             return false;
         }
         ClearParentName();
+        m_pParentGstObj = NULL;
         return true;
     }
     
@@ -220,6 +223,22 @@ namespace DSL
         }
         return true;
     }
+
+    //----------------------------------------------------------------------------------------------
+
+    PluginPadProbeHandler::PluginPadProbeHandler(const char* name, 
+        DSL_PLUGIN_INSTANCE_PTR pInstance)
+        : CustomPadProbeHandler(name, pInstance->GetInfo()->handle_buffer, 
+            pInstance->GetHandle())
+        , m_pInstance(pInstance)
+    {
+        LOG_FUNC();
+    }
+
+    PluginPadProbeHandler::~PluginPadProbeHandler()
+    {
+        LOG_FUNC();
+    }
     
     //----------------------------------------------------------------------------------------------
 
@@ -229,7 +248,7 @@ namespace DSL
         , m_interval(interval)
         , m_clientHandler(clientHandler)
         , m_clientData(clientData)
-        , m_timerId(0)
+        , m_pTimerSource(NULL)
     {
         LOG_FUNC();
         
@@ -248,9 +267,9 @@ namespace DSL
     {
         LOG_FUNC();
 
-        if (m_timerId)
+        if (m_pTimerSource)
         {
-            g_source_remove(m_timerId);
+            RemovePipelineTimeout(m_pTimerSource);
         }
         g_mutex_clear(&m_meterMutex);
     }
@@ -283,12 +302,11 @@ namespace DSL
         }
         LOG_INFO("Disabling performance measurements for MeterPadProbeHandler '" << GetName() << "'");
         
-        if (m_timerId and !g_source_remove(m_timerId))
+        if (m_pTimerSource)
         {
-            LOG_ERROR("Interval-timer shutdown failed for MeterPadProbeHandler '" << GetName() << "' ");
-            return false;
+            RemovePipelineTimeout(m_pTimerSource);
+            m_pTimerSource = NULL;
         }
-        m_timerId = 0;
         
         return true;
     }
@@ -322,10 +340,11 @@ namespace DSL
         NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
 
         // Don't start the report timer until we get the first buffer
-        if (!m_timerId)
+        if (!m_pTimerSource)
         {    
             LOG_INFO("Setting interval timer to " << m_interval*1000);
-            m_timerId = g_timeout_add(m_interval*1000, MeterIntervalTimeoutHandler, this);
+            m_pTimerSource = AddPipelineTimeout(m_pParentGstObj, 
+                m_interval*1000, MeterIntervalTimeoutHandler, this);
         }
         try
         {
@@ -365,6 +384,18 @@ namespace DSL
             intervalAverages.push_back(imap.second->GetIntervalFpsAvg());
 
             imap.second->IntervalReset();
+            
+            if (m_sessionFpsMetrics.find(imap.first) == m_sessionFpsMetrics.end())
+            {
+                std::string labels = MetricsRegistry::Label("meter", GetName()) + 
+                    "," + MetricsRegistry::Label("source_id", std::to_string(imap.first));
+                m_sessionFpsMetrics[imap.first] = MetricsRegistry::GetRegistry()->GetGauge(
+                    "dsl_meter_session_fps", "Session average frames-per-second", labels);
+                m_intervalFpsMetrics[imap.first] = MetricsRegistry::GetRegistry()->GetGauge(
+                    "dsl_meter_interval_fps", "Interval average frames-per-second", labels);
+            }
+            m_sessionFpsMetrics[imap.first]->Set(sessionAverages.back());
+            m_intervalFpsMetrics[imap.first]->Set(intervalAverages.back());
         }
         
         try
@@ -30,6 +30,8 @@ THE SOFTWARE.
 #include "DslElementr.h"
 #include "DslOdeTrigger.h"
 #include "DslSourceMeter.h"
+#include "DslMetrics.h"
+#include "DslPlugin.h"
 
 
 namespace DSL
@@ -51,6 +53,10 @@ namespace DSL
     #define DSL_PPH_CUSTOM_NEW(name, clientHandler, clientData) \
         std::shared_ptr<CustomPadProbeHandler>(new CustomPadProbeHandler(name, clientHandler, clientData))
         
+    #define DSL_PPH_PLUGIN_PTR std::shared_ptr<PluginPadProbeHandler>
+    #define DSL_PPH_PLUGIN_NEW(name, pInstance) \
+        std::shared_ptr<PluginPadProbeHandler>(new PluginPadProbeHandler(name, pInstance))
+        
     #define DSL_PAD_PROBE_PTR std::shared_ptr<PadProbetr>
     #define DSL_PAD_PROBE_NEW(name, factoryName, parentElement) \
         std::shared_ptr<PadProbetr>(new PadProbetr(name, factoryName, parentElement))    
@@ -100,6 +106,12 @@ namespace DSL
          */ 
         bool m_isEnabled;
         
+        /**
+         * @brief GstObject of the parent Bintr while added, used to find the 
+         * main-context of the parent's Pipeline for Handler timers
+         */
+        GstObject* m_pParentGstObj;
+        
     };
     
     //----------------------------------------------------------------------------------------------
@@ -137,6 +149,33 @@ namespace DSL
         
     };
     
+    //----------------------------------------------------------------------------------------------
+    /**
+     * @class PluginPadProbeHandler
+     * @brief Custom Pad Probe Handler with its handler provided by a native Plugin
+     */
+    class PluginPadProbeHandler : public CustomPadProbeHandler
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the Plugin Pad Probe Handler class
+         * @param[in] name unique name for the Pad Probe Handler
+         * @param[in] pInstance Plugin instance providing the handler,
+         * owned by the Pad Probe Handler from this point forward
+         */
+        PluginPadProbeHandler(const char* name, DSL_PLUGIN_INSTANCE_PTR pInstance);
+
+        ~PluginPadProbeHandler();
+
+    private:
+    
+        /**
+         * @brief Plugin instance passed as client data to the handler
+         */
+        DSL_PLUGIN_INSTANCE_PTR m_pInstance;
+    };
+    
     //----------------------------------------------------------------------------------------------
 
     /**
@@ -221,9 +260,9 @@ namespace DSL
         uint m_interval;
         
         /**
-         * @brief gnome timer Id for peformance calculation interval timer
+         * @brief gnome timer source for peformance calculation interval timer
          */
-        uint m_timerId;
+        GSource* m_pTimerSource;
         
         /**
          * @brief client callback funtion, called on reporting interval
@@ -244,6 +283,16 @@ namespace DSL
          * @brief map of all current source meters, one per source_id
          */
         std::map<uint, DSL_SOURCE_METER_PTR> m_sourceMeters;
+        
+        /**
+         * @brief map of published session FPS averages, one per source_id
+         */
+        std::map<uint, DSL_METRIC_GAUGE_PTR> m_sessionFpsMetrics;
+        
+        /**
+         * @brief map of published interval FPS averages, one per source_id
+         */
+        std::map<uint, DSL_METRIC_GAUGE_PTR> m_intervalFpsMetrics;
     };
 
     //----------------------------------------------------------------------------------------------
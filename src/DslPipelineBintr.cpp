@@ -32,11 +32,20 @@ namespace DSL
         : BranchBintr(name)
         , m_pGstBus(NULL)
         , m_gstBusWatch(0)
+        , m_pMainContext(NULL)
+        , m_pMainContextLoop(NULL)
+        , m_pMainContextThread(NULL)
         , m_pXWindowEventThread(NULL)
         , m_pXDisplay(0)
         , m_pXWindow(0)
         , m_xWindowWidth(0)
         , m_xWindowHeight(0)
+        , m_xWindowMapped(false)
+        , m_xWindowObscured(false)
+        , m_isBatchTimeoutAdaptive(false)
+        , m_batchTimeoutJitterMargin(DSL_DEFAULT_STREAMMUX_ADAPTIVE_JITTER_MARGIN)
+        , m_isBatchSizeAdaptive(false)
+        , m_batchSizeHysteresis(DSL_DEFAULT_STREAMMUX_ADAPTIVE_BATCH_SIZE_HYSTERESIS)
 {
         LOG_FUNC();
 
@@ -53,6 +62,9 @@ namespace DSL
         g_mutex_init(&m_busSyncMutex);
         g_mutex_init(&m_busWatchMutex);
         g_mutex_init(&m_displayMutex);
+        g_mutex_init(&m_qosMutex);
+        g_mutex_init(&m_threadPolicyMutex);
+        g_mutex_init(&m_stoppedMainContextsMutex);
 
         // get the GST message bus - one per GST pipeline
         m_pGstBus = gst_pipeline_get_bus(GST_PIPELINE(m_pGstObj));
@@ -62,6 +74,11 @@ namespace DSL
         
         // install the sync handler for the message bus
         gst_bus_set_sync_handler(m_pGstBus, bus_sync_handler, this, NULL);        
+        
+        m_pStateMetric = MetricsRegistry::GetRegistry()->GetGauge("dsl_pipeline_state", 
+            "Current DSL_STATE value of each Pipeline", 
+            MetricsRegistry::Label("pipeline", GetName()));
+        m_pStateMetric->Set(DSL_STATE_NULL);
     }
 
     PipelineBintr::~PipelineBintr()
@@ -82,14 +99,29 @@ namespace DSL
                 // Setting the display handle to NULL will terminate the XWindow Event Thread.
                 m_pXDisplay = NULL;
             }
+            for (auto const& ivec: m_xWindowSinks)
+            {
+                gst_object_unref(ivec);
+            }
             // cleanup all resources
             gst_bus_remove_watch(m_pGstBus);
             gst_object_unref(m_pGstBus);
-
-            g_mutex_clear(&m_busSyncMutex);
-            g_mutex_clear(&m_busWatchMutex);
+            
+            if (m_pMainContext)
+            {
+                StopMainContext();
+            }
         }
+        // Joined without the display mutex held, a bus message being handled
+        // by the main-context thread may be waiting on it
+        JoinStoppedMainContexts();
+        
+        g_mutex_clear(&m_busSyncMutex);
+        g_mutex_clear(&m_busWatchMutex);
         g_mutex_clear(&m_displayMutex);
+        g_mutex_clear(&m_qosMutex);
+        g_mutex_clear(&m_threadPolicyMutex);
+        g_mutex_clear(&m_stoppedMainContextsMutex);
     }
     
     bool PipelineBintr::AddSourceBintr(DSL_BASE_PTR pSourceBintr)
@@ -107,7 +139,7 @@ namespace DSL
         {
             return false;
         }
-        return true;
+        return UpdateBatchSize();
     }
 
     bool PipelineBintr::IsSourceBintrChild(DSL_BASE_PTR pSourceBintr)
@@ -127,7 +159,164 @@ namespace DSL
         LOG_FUNC();
 
         // Must cast to SourceBintr first so that correct Instance of RemoveChild is called
-        return m_pPipelineSourcesBintr->RemoveChild(std::dynamic_pointer_cast<SourceBintr>(pSourceBintr));
+        if (!m_pPipelineSourcesBintr->RemoveChild(std::dynamic_pointer_cast<SourceBintr>(pSourceBintr)))
+        {
+            return false;
+        }
+        return UpdateBatchSize();
+    }
+    
+    bool PipelineBintr::AddStandbySourceBintr(DSL_BASE_PTR pSourceBintr)
+    {
+        LOG_FUNC();
+        
+        // Create the shared sources bintr if it doesn't exist
+        if (!m_pPipelineSourcesBintr)
+        {
+            m_pPipelineSourcesBintr = DSL_PIPELINE_SOURCES_NEW("sources-bin");
+            AddChild(m_pPipelineSourcesBintr);
+        }
+        return m_pPipelineSourcesBintr->AddStandbyChild(
+            std::dynamic_pointer_cast<SourceBintr>(pSourceBintr));
+    }
+
+    bool PipelineBintr::IsStandbySourceBintrChild(DSL_BASE_PTR pSourceBintr)
+    {
+        LOG_FUNC();
+
+        if (!m_pPipelineSourcesBintr)
+        {
+            return false;
+        }
+        return m_pPipelineSourcesBintr->IsStandbyChild(
+            std::dynamic_pointer_cast<SourceBintr>(pSourceBintr));
+    }
+
+    bool PipelineBintr::RemoveStandbySourceBintr(DSL_BASE_PTR pSourceBintr)
+    {
+        LOG_FUNC();
+
+        if (!IsStandbySourceBintrChild(pSourceBintr))
+        {
+            LOG_ERROR("Source '" << pSourceBintr->GetName() 
+                << "' is not in the standby pool of Pipeline '" << GetName() << "'");
+            return false;
+        }
+        return m_pPipelineSourcesBintr->RemoveStandbyChild(
+            std::dynamic_pointer_cast<SourceBintr>(pSourceBintr));
+    }
+
+    bool PipelineBintr::AttachStandbySourceBintr(DSL_BASE_PTR pSourceBintr)
+    {
+        LOG_FUNC();
+
+        if (!IsStandbySourceBintrChild(pSourceBintr))
+        {
+            LOG_ERROR("Source '" << pSourceBintr->GetName() 
+                << "' is not in the standby pool of Pipeline '" << GetName() << "'");
+            return false;
+        }
+        if (!m_pPipelineSourcesBintr->AttachStandbyChild(
+            std::dynamic_pointer_cast<SourceBintr>(pSourceBintr)))
+        {
+            return false;
+        }
+        return UpdateBatchSize();
+    }
+
+    bool PipelineBintr::DetachStandbySourceBintr(DSL_BASE_PTR pSourceBintr)
+    {
+        LOG_FUNC();
+
+        if (!IsStandbySourceBintrChild(pSourceBintr))
+        {
+            LOG_ERROR("Source '" << pSourceBintr->GetName() 
+                << "' is not in the standby pool of Pipeline '" << GetName() << "'");
+            return false;
+        }
+        if (!m_pPipelineSourcesBintr->DetachStandbyChild(
+            std::dynamic_pointer_cast<SourceBintr>(pSourceBintr)))
+        {
+            return false;
+        }
+        return UpdateBatchSize();
+    }
+    
+    bool PipelineBintr::UpdateBatchSize()
+    {
+        LOG_FUNC();
+        
+        // Batch size is set on LinkAll, only dynamic add/remove is handled here
+        if (!m_isBatchSizeAdaptive or !IsLinked())
+        {
+            return true;
+        }
+        uint numSources = m_pPipelineSourcesBintr->GetNumChildren();
+        uint batchSize(m_batchSize);
+        
+        // Grow immediately so that no Source is left out of a batch, but only
+        // shrink once the number of Sources has fallen by the hysteresis amount
+        if (numSources > m_batchSize)
+        {
+            batchSize = numSources;
+        }
+        else if (numSources and (numSources + m_batchSizeHysteresis <= m_batchSize))
+        {
+            batchSize = numSources;
+        }
+        if (batchSize == m_batchSize)
+        {
+            return true;
+        }
+        LOG_INFO("Pipeline '" << GetName() << "' updating batch-size from " 
+            << m_batchSize << " to " << batchSize << " for " << numSources << " Sources");
+            
+        m_batchSize = batchSize;
+        m_pPipelineSourcesBintr->UpdateStreamMuxBatchSize(m_batchSize);
+        
+        if (m_pPrimaryGieBintr and !m_pPrimaryGieBintr->UpdateBatchSize(m_batchSize))
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' failed to update the Primary GIE batch-size");
+            return false;
+        }
+        if (m_pTrackerBintr and !m_pTrackerBintr->SetBatchSize(m_batchSize))
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' failed to update the Tracker batch-size");
+            return false;
+        }
+        if (m_pSecondaryGiesBintr and !m_pSecondaryGiesBintr->UpdateBatchSize(m_batchSize))
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' failed to update the Secondary GIEs batch-size");
+            return false;
+        }
+        if (m_pOfvBintr)
+        {
+            m_pOfvBintr->SetBatchSize(m_batchSize);
+        }
+        if (m_pTilerBintr)
+        {
+            m_pTilerBintr->SetBatchSize(m_batchSize);
+        }
+        if (m_pOsdBintr)
+        {
+            m_pOsdBintr->SetBatchSize(m_batchSize);
+        }
+        if (m_pDemuxerBintr and !m_pDemuxerBintr->UpdateBatchSize(m_batchSize))
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' failed to update the Demuxer batch-size");
+            return false;
+        }
+        if (m_pSplitterBintr and !m_pSplitterBintr->UpdateBatchSize(m_batchSize))
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' failed to update the Splitter batch-size");
+            return false;
+        }
+        if (m_pMultiSinksBintr and !m_pMultiSinksBintr->UpdateBatchSize(m_batchSize))
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' failed to update the Sinks batch-size");
+            return false;
+        }
+        return true;
     }
 
 
@@ -212,6 +401,496 @@ namespace DSL
         return true;
     }
     
+    void PipelineBintr::GetStreamMuxBatchTimeoutAdaptive(bool* enabled, uint* jitterMargin)
+    {
+        LOG_FUNC();
+
+        *enabled = m_isBatchTimeoutAdaptive;
+        *jitterMargin = m_batchTimeoutJitterMargin;
+    }
+
+    bool PipelineBintr::SetStreamMuxBatchTimeoutAdaptive(bool enabled, uint jitterMargin)
+    {
+        LOG_FUNC();
+
+        if (IsLinked())
+        {
+            LOG_ERROR("Pipeline '" << GetName() 
+                << "' is currently Linked - adaptive batch-timeout can not be updated");
+            return false;
+        }
+        m_isBatchTimeoutAdaptive = enabled;
+        m_batchTimeoutJitterMargin = jitterMargin;
+        
+        if (m_pPipelineSourcesBintr)
+        {
+            return m_pPipelineSourcesBintr->SetStreamMuxBatchTimeoutAdaptive(
+                m_isBatchTimeoutAdaptive, m_batchTimeoutJitterMargin);
+        }
+        return true;
+    }
+
+    void PipelineBintr::GetStreamMuxBatchStats(uint* batchTimeout, double* fillRatio)
+    {
+        LOG_FUNC();
+
+        if (!m_pPipelineSourcesBintr)
+        {
+            *batchTimeout = m_batchTimeout;
+            *fillRatio = 0;
+            return;
+        }
+        m_pPipelineSourcesBintr->GetStreamMuxBatchStats(batchTimeout, fillRatio);
+    }
+    
+    void PipelineBintr::GetStreamMuxBatchSizeAdaptive(bool* enabled, uint* hysteresis)
+    {
+        LOG_FUNC();
+
+        *enabled = m_isBatchSizeAdaptive;
+        *hysteresis = m_batchSizeHysteresis;
+    }
+
+    bool PipelineBintr::SetStreamMuxBatchSizeAdaptive(bool enabled, uint hysteresis)
+    {
+        LOG_FUNC();
+
+        if (IsLinked())
+        {
+            LOG_ERROR("Pipeline '" << GetName() 
+                << "' is currently Linked - adaptive batch-size can not be updated");
+            return false;
+        }
+        if (!hysteresis)
+        {
+            LOG_ERROR("Invalid hysteresis of 0 for Pipeline '" << GetName() << "'");
+            return false;
+        }
+        m_isBatchSizeAdaptive = enabled;
+        m_batchSizeHysteresis = hysteresis;
+        return true;
+    }
+    
+    bool PipelineBintr::GetMainContextEnabled()
+    {
+        LOG_FUNC();
+        
+        return (m_pMainContext != NULL);
+    }
+
+    bool PipelineBintr::SetMainContextEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set main-context for Pipeline '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        if (enabled == GetMainContextEnabled())
+        {
+            return true;
+        }
+        gst_bus_remove_watch(m_pGstBus);
+        
+        if (enabled)
+        {
+            m_pMainContext = g_main_context_new();
+            m_pMainContextLoop = g_main_loop_new(m_pMainContext, FALSE);
+
+            // The bus watch is attached to the thread-default main-context
+            g_main_context_push_thread_default(m_pMainContext);
+            m_gstBusWatch = gst_bus_add_watch(m_pGstBus, bus_watch, this);
+            g_main_context_pop_thread_default(m_pMainContext);
+            
+            // Component timers, added once linked, find the main-context from here
+            g_object_set_data(G_OBJECT(m_pGstObj), 
+                DSL_PIPELINE_MAIN_CONTEXT_KEY, m_pMainContext);
+            
+            std::string threadName = GetName() + "-main-context";
+            m_pMainContextThread = g_thread_new(threadName.c_str(), MainContextThread, this);
+            
+            LOG_INFO("Pipeline '" << GetName() << "' is using its own main-context");
+        }
+        else
+        {
+            g_object_set_data(G_OBJECT(m_pGstObj), DSL_PIPELINE_MAIN_CONTEXT_KEY, NULL);
+            StopMainContext();
+            m_gstBusWatch = gst_bus_add_watch(m_pGstBus, bus_watch, this);
+            
+            LOG_INFO("Pipeline '" << GetName() << "' is using the default main-context");
+        }
+        return true;
+    }
+
+    void PipelineBintr::RunMainContextLoop()
+    {
+        LOG_FUNC();
+        
+        // Hold references for the life of the loop, in case the Pipeline is
+        // deleted from a callback running on this thread
+        GMainContext* pMainContext = g_main_context_ref(m_pMainContext);
+        GMainLoop* pMainContextLoop = g_main_loop_ref(m_pMainContextLoop);
+        
+        g_main_context_push_thread_default(pMainContext);
+        g_main_loop_run(pMainContextLoop);
+        g_main_context_pop_thread_default(pMainContext);
+        
+        g_main_loop_unref(pMainContextLoop);
+        g_main_context_unref(pMainContext);
+    }
+
+    void PipelineBintr::StopMainContext()
+    {
+        LOG_FUNC();
+        
+        // Quit from an idle callback on the loop itself, so that the quit can't 
+        // be missed if the thread has yet to start running the loop
+        GSource* pQuitSource = g_idle_source_new();
+        g_source_set_callback(pQuitSource, MainContextQuitHandler, 
+            g_main_loop_ref(m_pMainContextLoop), (GDestroyNotify)g_main_loop_unref);
+        g_source_attach(pQuitSource, m_pMainContext);
+        g_source_unref(pQuitSource);
+        
+        // The thread holds its own references to the loop and context
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_stoppedMainContextsMutex);
+            m_stoppedMainContextThreads.push_back(m_pMainContextThread);
+        }
+        g_main_loop_unref(m_pMainContextLoop);
+        g_main_context_unref(m_pMainContext);
+        
+        m_pMainContextThread = NULL;
+        m_pMainContextLoop = NULL;
+        m_pMainContext = NULL;
+    }
+
+    void PipelineBintr::JoinStoppedMainContexts()
+    {
+        LOG_FUNC();
+        
+        std::vector<GThread*> stoppedThreads;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_stoppedMainContextsMutex);
+            stoppedThreads.swap(m_stoppedMainContextThreads);
+        }
+        for (auto const& pThread: stoppedThreads)
+        {
+            if (g_thread_self() == pThread)
+            {
+                g_thread_unref(pThread);
+            }
+            else
+            {
+                g_thread_join(pThread);
+            }
+        }
+    }
+
+    bool PipelineBintr::GetQosElementStats(const char* element, QosElementStats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_qosMutex);
+        
+        auto ientry = m_qosStats.find(element);
+        if (ientry == m_qosStats.end())
+        {
+            LOG_ERROR("No QoS messages have been received from element '" 
+                << element << "' in Pipeline '" << GetName() << "'");
+            return false;
+        }
+        *stats = ientry->second;
+        return true;
+    }
+    
+    void PipelineBintr::GetQosTotals(uint* elements, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_qosMutex);
+        
+        *elements = m_qosStats.size();
+        *dropped = 0;
+        for (auto const& imap: m_qosStats)
+        {
+            *dropped += imap.second.dropped;
+        }
+    }
+    
+    void PipelineBintr::ClearQosStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_qosMutex);
+        
+        m_qosStats.clear();
+        m_qosDroppedMetrics.clear();
+        for (auto& imap: m_qosListeners)
+        {
+            imap.second.lastNotified.clear();
+        }
+    }
+    
+    bool PipelineBintr::AddQosListener(dsl_qos_listener_cb listener, 
+        uint threshold, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_qosMutex);
+        
+        if (m_qosListeners.find(listener) != m_qosListeners.end())
+        {   
+            LOG_ERROR("Pipeline listener is not unique");
+            return false;
+        }
+        if (!threshold)
+        {
+            LOG_ERROR("Invalid QoS threshold of 0 for Pipeline '" << GetName() << "'");
+            return false;
+        }
+        QosListener qosListener;
+        qosListener.clientData = clientData;
+        qosListener.threshold = threshold;
+        
+        // Only drops from this point forward count towards the threshold
+        for (auto const& imap: m_qosStats)
+        {
+            qosListener.lastNotified[imap.first] = imap.second.dropped;
+        }
+        m_qosListeners[listener] = qosListener;
+        
+        return true;
+    }
+    
+    bool PipelineBintr::RemoveQosListener(dsl_qos_listener_cb listener)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_qosMutex);
+        
+        if (m_qosListeners.find(listener) == m_qosListeners.end())
+        {   
+            LOG_ERROR("Pipeline listener was not found");
+            return false;
+        }
+        m_qosListeners.erase(listener);
+        
+        return true;
+    }
+    
+    bool PipelineBintr::SetThreadPolicy(const char* component, const ThreadPolicy& policy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadPolicyMutex);
+        
+        if (policy.schedPolicy == DSL_THREAD_SCHED_FIFO)
+        {
+            if (policy.priority < sched_get_priority_min(SCHED_FIFO) or
+                policy.priority > sched_get_priority_max(SCHED_FIFO))
+            {
+                LOG_ERROR("Invalid real-time priority " << policy.priority 
+                    << " for Pipeline '" << GetName() << "'");
+                return false;
+            }
+        }
+        else if (policy.schedPolicy == DSL_THREAD_SCHED_OTHER)
+        {
+            if (policy.priority < -20 or policy.priority > 19)
+            {
+                LOG_ERROR("Invalid nice value " << policy.priority 
+                    << " for Pipeline '" << GetName() << "'");
+                return false;
+            }
+        }
+        else
+        {
+            LOG_ERROR("Invalid scheduling policy " << policy.schedPolicy 
+                << " for Pipeline '" << GetName() << "'");
+            return false;
+        }
+        m_threadPolicies[component] = policy;
+        
+        // Re-resolve all current threads, as the new policy may take precedence
+        bool result(true);
+        for (auto& imap: m_streamingThreads)
+        {
+            result &= ApplyThreadPolicy(imap.second);
+        }
+        return result;
+    }
+    
+    bool PipelineBintr::RemoveThreadPolicy(const char* component)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadPolicyMutex);
+        
+        if (m_threadPolicies.find(component) == m_threadPolicies.end())
+        {
+            LOG_ERROR("Thread policy for '" << component 
+                << "' was not found for Pipeline '" << GetName() << "'");
+            return false;
+        }
+        m_threadPolicies.erase(component);
+        
+        // Re-resolve all current threads, restoring those no longer covered
+        bool result(true);
+        for (auto& imap: m_streamingThreads)
+        {
+            result &= ApplyThreadPolicy(imap.second);
+        }
+        return result;
+    }
+    
+    const char* PipelineBintr::GetThreadReport()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadPolicyMutex);
+        
+        std::ostringstream report;
+        
+        for (auto const& imap: m_streamingThreads)
+        {
+            std::string taskPath("/proc/self/task/" + std::to_string(imap.first));
+            
+            std::string threadName;
+            std::ifstream commFile(taskPath + "/comm");
+            std::getline(commFile, threadName);
+            
+            // The processor field is the 39th, the 37th after the ')' closing 
+            // the command name, which itself may contain spaces
+            std::string cpu("?");
+            std::ifstream statFile(taskPath + "/stat");
+            std::string stat((std::istreambuf_iterator<char>(statFile)),
+                std::istreambuf_iterator<char>());
+            size_t pos = stat.rfind(')');
+            if (pos != std::string::npos)
+            {
+                std::istringstream fields(stat.substr(pos+1));
+                std::string field;
+                for (uint i = 0; i < 37 and (fields >> field); i++);
+                if (fields)
+                {
+                    cpu = field;
+                }
+            }
+            std::string policy(imap.second.policy);
+            if (policy.empty())
+            {
+                policy = "default";
+            }
+            else if (policy == "-")
+            {
+                policy = "none";
+            }
+            report << threadName << " tid=" << imap.first 
+                << " element=" << imap.second.path
+                << " policy=" << policy << " cpu=" << cpu << "\n";
+        }
+        m_threadReport = report.str();
+        return m_threadReport.c_str();
+    }
+    
+    bool PipelineBintr::ApplyThreadPolicy(StreamingThread& thread)
+    {
+        // The policy of the nearest named ancestor wins, then the default
+        auto iter = m_threadPolicies.end();
+        for (auto const& name: thread.ancestry)
+        {
+            iter = m_threadPolicies.find(name);
+            if (iter != m_threadPolicies.end())
+            {
+                break;
+            }
+        }
+        if (iter == m_threadPolicies.end())
+        {
+            iter = m_threadPolicies.find("");
+        }
+        // Start from the thread's original settings, so that nothing from 
+        // a previously applied policy carries over 
+        if (!RestoreThreadPolicy(thread))
+        {
+            return false;
+        }
+        if (iter == m_threadPolicies.end())
+        {
+            return true;
+        }
+        const ThreadPolicy& policy = iter->second;
+        thread.policy = iter->first;
+        
+        if (policy.cpuMask)
+        {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            for (uint cpu = 0; cpu < 64; cpu++)
+            {
+                if (policy.cpuMask & (1ULL << cpu))
+                {
+                    CPU_SET(cpu, &cpuSet);
+                }
+            }
+            if (sched_setaffinity(thread.tid, sizeof(cpuSet), &cpuSet))
+            {
+                LOG_ERROR("Failed to set CPU affinity for thread " << thread.tid 
+                    << " of '" << thread.path << "': " << strerror(errno));
+                return false;
+            }
+        }
+        struct sched_param param = {0};
+        if (policy.schedPolicy == DSL_THREAD_SCHED_FIFO)
+        {
+            param.sched_priority = policy.priority;
+            if (sched_setscheduler(thread.tid, SCHED_FIFO, &param))
+            {
+                LOG_ERROR("Failed to set SCHED_FIFO for thread " << thread.tid 
+                    << " of '" << thread.path << "': " << strerror(errno));
+                return false;
+            }
+            return true;
+        }
+        // On Linux the nice value is per-thread when given a thread id
+        if (sched_setscheduler(thread.tid, SCHED_OTHER, &param) or
+            setpriority(PRIO_PROCESS, thread.tid, policy.priority))
+        {
+            LOG_ERROR("Failed to set nice value for thread " << thread.tid 
+                << " of '" << thread.path << "': " << strerror(errno));
+            return false;
+        }
+        return true;
+    }
+
+    bool PipelineBintr::RestoreThreadPolicy(StreamingThread& thread)
+    {
+        if (thread.policy == "-")
+        {
+            return true;
+        }
+        thread.policy = "-";
+        
+        bool result(true);
+        if (sched_setaffinity(thread.tid, sizeof(thread.origCpuSet), 
+            &thread.origCpuSet))
+        {
+            LOG_ERROR("Failed to restore CPU affinity for thread " << thread.tid 
+                << " of '" << thread.path << "': " << strerror(errno));
+            result = false;
+        }
+        struct sched_param param = {0};
+        param.sched_priority = thread.origPriority;
+        if (sched_setscheduler(thread.tid, thread.origSchedPolicy, &param))
+        {
+            LOG_ERROR("Failed to restore scheduling policy for thread " << thread.tid 
+                << " of '" << thread.path << "': " << strerror(errno));
+            result = false;
+        }
+        // Lowering the nice value may require CAP_SYS_NICE or RLIMIT_NICE
+        if (setpriority(PRIO_PROCESS, thread.tid, thread.origNice))
+        {
+            LOG_ERROR("Failed to restore nice value for thread " << thread.tid 
+                << " of '" << thread.path << "': " << strerror(errno));
+            result = false;
+        }
+        return result;
+    }
+
     void PipelineBintr::GetXWindowDimensions(uint* width, uint* height)
     {
         LOG_FUNC();
@@ -251,10 +930,14 @@ namespace DSL
         }
 
         // If the batch size has not been explicitely set, use the number of sources.
-        if (m_batchSize < m_pPipelineSourcesBintr->GetNumChildren())
+        // If adaptive, the batch size always starts at the number of sources.
+        if (m_batchSize < m_pPipelineSourcesBintr->GetNumChildren() or
+            (m_isBatchSizeAdaptive and m_batchSize != m_pPipelineSourcesBintr->GetNumChildren()))
         {
             SetStreamMuxBatchProperties(m_pPipelineSourcesBintr->GetNumChildren(), m_batchTimeout);
         }
+        m_pPipelineSourcesBintr->SetStreamMuxBatchTimeoutAdaptive(
+            m_isBatchTimeoutAdaptive, m_batchTimeoutJitterMargin);
         
         // Start with an empty list of linked components
         m_linkedComponents.clear();
@@ -517,7 +1200,6 @@ namespace DSL
         case GST_MESSAGE_ELEMENT:
         case GST_MESSAGE_STREAM_STATUS:
         case GST_MESSAGE_DURATION_CHANGED:
-        case GST_MESSAGE_QOS:
         case GST_MESSAGE_NEW_CLOCK:
         case GST_MESSAGE_ASYNC_DONE:
         case GST_MESSAGE_TAG:
@@ -526,6 +1208,9 @@ namespace DSL
         case GST_MESSAGE_EOS:
             HandleEosMessage(pMessage);
             return true;
+        case GST_MESSAGE_QOS:
+            HandleQosMessage(pMessage);
+            return true;
         case GST_MESSAGE_INFO:
             return true;
         case GST_MESSAGE_WARNING:
@@ -565,6 +1250,17 @@ namespace DSL
                     CreateXWindow();
                 }
                 
+                // keep a reference to the sink for XWindow visibility notifications
+                {
+                    LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+                    
+                    GstElement* pSink = GST_ELEMENT(GST_MESSAGE_SRC(pMessage));
+                    if (std::find(m_xWindowSinks.begin(), m_xWindowSinks.end(), pSink) 
+                        == m_xWindowSinks.end())
+                    {
+                        m_xWindowSinks.push_back(GST_ELEMENT(gst_object_ref(pSink)));
+                    }
+                }
                 gst_video_overlay_set_window_handle(
                     GST_VIDEO_OVERLAY(GST_MESSAGE_SRC(pMessage)), m_pXWindow);
                 gst_video_overlay_expose(
@@ -573,12 +1269,95 @@ namespace DSL
                 return GST_BUS_DROP;
             }
             break;
+        case GST_MESSAGE_STREAM_STATUS:
+            HandleStreamStatusMessage(pMessage);
+            break;
         default:
             break;
         }
         return GST_BUS_PASS;
     }
     
+    void PipelineBintr::HandleStreamStatusMessage(GstMessage* pMessage)
+    {
+        GstStreamStatusType type;
+        GstElement* pOwner(NULL);
+        
+        gst_message_parse_stream_status(pMessage, &type, &pOwner);
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadPolicyMutex);
+        
+        // ENTER and LEAVE are posted synchronously from the streaming thread itself
+        pid_t tid = syscall(SYS_gettid);
+
+        if (type == GST_STREAM_STATUS_TYPE_LEAVE)
+        {
+            // The thread may be reused for another task or unrelated work
+            auto iter = m_streamingThreads.find(tid);
+            if (iter != m_streamingThreads.end())
+            {
+                RestoreThreadPolicy(iter->second);
+                m_streamingThreads.erase(iter);
+            }
+            return;
+        }
+        if (type != GST_STREAM_STATUS_TYPE_ENTER or !pOwner)
+        {
+            return;
+        }
+        StreamingThread thread;
+        thread.tid = tid;
+        thread.policy = "-";
+        
+        gchar* path = gst_object_get_path_string(GST_OBJECT(pOwner));
+        thread.path = path;
+        g_free(path);
+        
+        GetAncestry(pOwner, thread.ancestry);
+        
+        if (sched_getaffinity(tid, sizeof(thread.origCpuSet), &thread.origCpuSet))
+        {
+            // fall back to restoring all CPUs
+            CPU_ZERO(&thread.origCpuSet);
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            {
+                CPU_SET(cpu, &thread.origCpuSet);
+            }
+        }
+        thread.origSchedPolicy = sched_getscheduler(tid);
+        struct sched_param param = {0};
+        sched_getparam(tid, &param);
+        thread.origPriority = param.sched_priority;
+        errno = 0;
+        thread.origNice = getpriority(PRIO_PROCESS, tid);
+        if (thread.origSchedPolicy < 0 or errno)
+        {
+            LOG_ERROR("Failed to get the scheduling policy of thread " << tid 
+                << " of '" << thread.path << "': " << strerror(errno));
+            thread.origSchedPolicy = SCHED_OTHER;
+            thread.origPriority = 0;
+            thread.origNice = 0;
+        }
+
+        LOG_INFO("Streaming thread " << tid << " entered for '" << thread.path << "'");
+        
+        ApplyThreadPolicy(thread);
+        m_streamingThreads[tid] = thread;
+    }
+    
+    void PipelineBintr::GetAncestry(GstElement* pElement, 
+        std::vector<std::string>& ancestry)
+    {
+        GstObject* pObject = GST_OBJECT(gst_object_ref(pElement));
+        while (pObject)
+        {
+            ancestry.push_back(GST_OBJECT_NAME(pObject));
+            GstObject* pParent = gst_object_get_parent(pObject);
+            gst_object_unref(pObject);
+            pObject = pParent;
+        }
+    }
+    
     bool PipelineBintr::HandleStateChanged(GstMessage* pMessage)
     {
         if (GST_ELEMENT(GST_MESSAGE_SRC(pMessage)) != GST_ELEMENT(m_pGstObj))
@@ -590,6 +1369,8 @@ namespace DSL
         gst_message_parse_state_changed(pMessage, &oldstate, &newstate, NULL);
 
         LOG_INFO(m_mapPipelineStates[oldstate] << " => " << m_mapPipelineStates[newstate]);
+        
+        m_pStateMetric->Set(newstate);
 
         // iterate through the map of state-change-listeners calling each
         for(auto const& imap: m_stateChangeListeners)
@@ -610,6 +1391,109 @@ namespace DSL
         }
     }
     
+    void PipelineBintr::HandleQosMessage(GstMessage* pMessage)
+    {
+        GstFormat format;
+        guint64 processed(0), dropped(0);
+        gint64 jitter(0);
+        gdouble proportion(0);
+        gint quality(0);
+        
+        gst_message_parse_qos_stats(pMessage, &format, &processed, &dropped);
+        gst_message_parse_qos_values(pMessage, &jitter, &proportion, &quality);
+        
+        // Elements that don't track buffers report -1 as the unknown value
+        if (format != GST_FORMAT_BUFFERS and format != GST_FORMAT_DEFAULT)
+        {
+            processed = dropped = 0;
+        }
+        if (processed == (guint64)-1)
+        {
+            processed = 0;
+        }
+        if (dropped == (guint64)-1)
+        {
+            dropped = 0;
+        }
+        
+        // Keyed by path, element names are only unique within their parent bin,
+        // e.g. every Fake Sink has a "sink-bin-fake" element
+        gchar* path = gst_object_get_path_string(GST_MESSAGE_SRC(pMessage));
+        std::string element(path);
+        g_free(path);
+        QosElementStats stats;
+        
+        // listeners to notify are collected under lock and called after
+        // unlocking, so that they are free to call back into the Pipeline
+        std::vector<std::pair<dsl_qos_listener_cb, void*>> notify;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_qosMutex);
+            
+            auto ientry = m_qosStats.find(element);
+            if (ientry == m_qosStats.end())
+            {
+                ientry = m_qosStats.insert(
+                    std::make_pair(element, QosElementStats{0, 0, 0, 0, 0})).first;
+            }
+            QosElementStats& entry = ientry->second;
+            
+            // Running average of the absolute jitter, with a gain of 1/16 as 
+            // used for interarrival jitter in RFC 3550 
+            int64_t absJitter = (jitter < 0) ? -jitter : jitter;
+            entry.jitter = (entry.messages) 
+                ? entry.jitter + (absJitter - entry.jitter)/16
+                : absJitter;
+            
+            // counters are cumulative in the message, keep the largest seen
+            entry.processed = std::max(entry.processed, (uint64_t)processed);
+            entry.dropped = std::max(entry.dropped, (uint64_t)dropped);
+            entry.proportion = proportion;
+            entry.messages++;
+            stats = entry;
+            
+            if (m_qosDroppedMetrics.find(element) == m_qosDroppedMetrics.end())
+            {
+                m_qosDroppedMetrics[element] = MetricsRegistry::GetRegistry()->GetGauge(
+                    "dsl_pipeline_qos_dropped", 
+                    "Total buffers dropped as reported by each element's QoS messages",
+                    MetricsRegistry::Label("pipeline", GetName()) + "," + 
+                    MetricsRegistry::Label("element", element));
+            }
+            m_qosDroppedMetrics[element]->Set(stats.dropped);
+            
+            for (auto& imap: m_qosListeners)
+            {
+                uint64_t& lastNotified = imap.second.lastNotified[element];
+                if (stats.dropped >= lastNotified + imap.second.threshold)
+                {
+                    lastNotified = stats.dropped;
+                    notify.push_back(std::make_pair(imap.first, imap.second.clientData));
+                }
+            }
+        }
+        LOG_DEBUG("QoS message from element '" << element << "' processed = " 
+            << stats.processed << " dropped = " << stats.dropped 
+            << " jitter = " << jitter << " proportion = " << proportion);
+        
+        if (notify.size())
+        {
+            std::wstring wstrElement(element.begin(), element.end());
+            for (auto const& ivec: notify)
+            {
+                try
+                {
+                    ivec.first(wstrElement.c_str(), stats.processed, stats.dropped,
+                        stats.jitter, stats.proportion, ivec.second);
+                }
+                catch(...)
+                {
+                    LOG_ERROR("Pipeline '" << GetName() 
+                        << "' QoS listener threw an exception");
+                }
+            }
+        }
+    }
+    
     void PipelineBintr::HandleXWindowEvents()
     {
         while (m_pXDisplay)
@@ -665,6 +1549,31 @@ namespace DSL
                         }
                         break;
                         
+                    case MapNotify:
+                    case UnmapNotify:
+                    case VisibilityNotify:
+                        {
+                            bool wasHidden(!m_xWindowMapped or m_xWindowObscured);
+                            
+                            if (xEvent.type == VisibilityNotify)
+                            {
+                                m_xWindowObscured = 
+                                    (xEvent.xvisibility.state == VisibilityFullyObscured);
+                            }
+                            else
+                            {
+                                m_xWindowMapped = (xEvent.type == MapNotify);
+                            }
+                            bool isHidden(!m_xWindowMapped or m_xWindowObscured);
+                            if (isHidden != wasHidden)
+                            {
+                                LOG_INFO("XWindow for Pipeline '" << GetName() << "' is now " 
+                                    << ((isHidden) ? "hidden" : "visible"));
+                                NotifyXWindowVisibility(isHidden);
+                            }
+                        }
+                        break;
+                        
                     default:
                         break;
                     }
@@ -704,7 +1613,8 @@ namespace DSL
         }
         XSetWindowAttributes attr = {0};
         
-        attr.event_mask = ButtonPress | KeyRelease;
+        attr.event_mask = ButtonPress | KeyRelease | 
+            StructureNotifyMask | VisibilityChangeMask;
         XChangeWindowAttributes(m_pXDisplay, m_pXWindow, CWEventMask, &attr);
 
         Atom wmDeleteMessage = XInternAtom(m_pXDisplay, "WM_DELETE_WINDOW", False);
@@ -713,6 +1623,8 @@ namespace DSL
             XSetWMProtocols(m_pXDisplay, m_pXWindow, &wmDeleteMessage, 1);
         }
         XMapRaised(m_pXDisplay, m_pXWindow);
+        m_xWindowMapped = true;
+        m_xWindowObscured = false;
         // flush the XWindow output buffer and then wait until all requests have been 
         // received and processed by the X server. TRUE = Discard all queued events
         XSync(m_pXDisplay, TRUE);
@@ -737,6 +1649,25 @@ namespace DSL
         return true;
     }
     
+    void PipelineBintr::NotifyXWindowVisibility(bool hidden)
+    {
+        LOG_FUNC();
+        
+        for (auto const& ivec: m_xWindowSinks)
+        {
+            GstEvent* pEvent = gst_event_new_custom(GST_EVENT_CUSTOM_UPSTREAM,
+                gst_structure_new(DSL_XWINDOW_VISIBILITY_EVENT, 
+                    "hidden", G_TYPE_BOOLEAN, hidden, NULL));
+                    
+            // sent upstream from the sink, to be consumed by its parent Window Sink
+            if (!gst_element_send_event(ivec, pEvent))
+            {
+                LOG_WARN("Visibility event not handled by sink '" 
+                    << GST_ELEMENT_NAME(ivec) << "'");
+            }
+        }
+    }
+    
     void PipelineBintr::HandleErrorMessage(GstMessage* pMessage)
     {
         LOG_FUNC();
@@ -752,6 +1683,12 @@ namespace DSL
         {
             LOG_DEBUG("Debug info: " << debugInfo);
         }
+        
+        // Errors from an RTSP Source are recorded with the Source for its stream watchdog
+        if (m_pPipelineSourcesBintr)
+        {
+            m_pPipelineSourcesBintr->HandleSourceErrorMessage(pMessage->src, error->message);
+        }
 
         g_error_free(error);
         g_free(debugInfo);
@@ -791,6 +1728,18 @@ namespace DSL
         return static_cast<PipelineBintr*>(pData)->HandleBusSyncMessage(pMessage);
     }
 
+    static gpointer MainContextThread(gpointer pData)
+    {
+        static_cast<PipelineBintr*>(pData)->RunMainContextLoop();
+        return NULL;
+    }
+
+    static int MainContextQuitHandler(gpointer pLoop)
+    {
+        g_main_loop_quit((GMainLoop*)pLoop);
+        return false;
+    }
+
     static gpointer XWindowEventThread(gpointer pData)
     {
         static_cast<PipelineBintr*>(pData)->HandleXWindowEvents();
@@ -41,6 +41,129 @@ namespace DSL
     #define DSL_PIPELINE_NEW(name) \
         std::shared_ptr<PipelineBintr>(new PipelineBintr(name))
 
+    /**
+     * @struct QosElementStats
+     * @brief QoS counters for a single element, accumulated from the 
+     * GST_MESSAGE_QOS messages posted by the element on the Pipeline's bus.
+     */
+    struct QosElementStats
+    {
+        /**
+         * @brief total buffers processed as reported by the element
+         */
+        uint64_t processed;
+        
+        /**
+         * @brief total buffers dropped as reported by the element
+         */
+        uint64_t dropped;
+        
+        /**
+         * @brief running average of the absolute jitter in nanoseconds
+         */
+        int64_t jitter;
+        
+        /**
+         * @brief long term proportion from the element's last QoS message
+         */
+        double proportion;
+        
+        /**
+         * @brief number of QoS messages received from the element
+         */
+        uint64_t messages;
+    };
+
+    /**
+     * @struct QosListener
+     * @brief client QoS listener with its notification threshold, and the 
+     * dropped count for each element at the time of the last notification.
+     */
+    struct QosListener
+    {
+        /**
+         * @brief opaque pointer to client data passed to the listener
+         */
+        void* clientData;
+        
+        /**
+         * @brief number of new drops for an element to trigger a notification
+         */
+        uint threshold;
+        
+        /**
+         * @brief per-element dropped count at the last notification
+         */
+        std::map<std::string, uint64_t> lastNotified;
+    };
+
+    /**
+     * @struct ThreadPolicy
+     * @brief CPU affinity and scheduling policy to apply to streaming threads
+     */
+    struct ThreadPolicy
+    {
+        /**
+         * @brief bit mask of CPUs to run on, 0 to leave the affinity unchanged
+         */
+        uint64_t cpuMask;
+        
+        /**
+         * @brief one of the DSL_THREAD_SCHED constants
+         */
+        uint schedPolicy;
+        
+        /**
+         * @brief nice value for DSL_THREAD_SCHED_OTHER, 
+         * real-time priority for DSL_THREAD_SCHED_FIFO
+         */
+        int priority;
+    };
+
+    /**
+     * @struct StreamingThread
+     * @brief a streaming thread of the Pipeline, tracked from the time 
+     * it enters its task function until it leaves
+     */
+    struct StreamingThread
+    {
+        /**
+         * @brief kernel thread id
+         */
+        pid_t tid;
+        
+        /**
+         * @brief path of the element owning the thread's task
+         */
+        std::string path;
+        
+        /**
+         * @brief names of the owning element and all of its ancestors, 
+         * nearest first, used to resolve the thread's policy
+         */
+        std::vector<std::string> ancestry;
+        
+        /**
+         * @brief name of the policy applied, "" for the default, 
+         * "-" if no policy has been applied
+         */
+        std::string policy;
+        
+        /**
+         * @brief CPU affinity of the thread when it entered, restored when 
+         * the thread leaves or no policy applies.
+         */
+        cpu_set_t origCpuSet;
+        
+        /**
+         * @brief scheduling policy, real-time priority, and nice value 
+         * of the thread when it entered, restored with the affinity
+         */
+        int origSchedPolicy;
+        int origPriority;
+        int origNice;
+    };
+
     /**
      * @class PipelineBintr
      * @brief 
@@ -97,7 +220,8 @@ namespace DSL
             {
                 return 0;
             }
-            return m_pPipelineSourcesBintr->GetNumChildren();
+            return m_pPipelineSourcesBintr->GetNumChildren() + 
+                m_pPipelineSourcesBintr->GetNumStandbyChildren();
         } 
         
         /**
@@ -106,6 +230,43 @@ namespace DSL
          */
         bool RemoveSourceBintr(DSL_BASE_PTR pSourceBintr);
 
+        /**
+         * @brief adds a single live Source Bintr to this Pipeline's standby pool
+         * @param[in] pSourceBintr shared pointer to Source Bintr to add
+         * @return true if the Source could be added, false otherwise
+         */
+        bool AddStandbySourceBintr(DSL_BASE_PTR pSourceBintr);
+
+        /**
+         * @brief checks if a Source Bintr is in this Pipeline's standby pool
+         * @param[in] pSourceBintr shared pointer to Source Bintr to check
+         * @return true if the Source is in the standby pool, attached or not
+         */
+        bool IsStandbySourceBintrChild(DSL_BASE_PTR pSourceBintr);
+
+        /**
+         * @brief removes a single detached Source Bintr from this Pipeline's standby pool
+         * @param[in] pSourceBintr shared pointer to Source Bintr to remove
+         * @return true if the Source could be removed, false otherwise
+         */
+        bool RemoveStandbySourceBintr(DSL_BASE_PTR pSourceBintr);
+
+        /**
+         * @brief attaches a Source Bintr in this Pipeline's standby pool to the 
+         * Pipeline's Stream Muxer
+         * @param[in] pSourceBintr shared pointer to Source Bintr to attach
+         * @return true if the Source could be attached, false otherwise
+         */
+        bool AttachStandbySourceBintr(DSL_BASE_PTR pSourceBintr);
+
+        /**
+         * @brief detaches a Source Bintr in this Pipeline's standby pool from the 
+         * Pipeline's Stream Muxer, returning it to standby.
+         * @param[in] pSourceBintr shared pointer to Source Bintr to detach
+         * @return true if the Source could be detached, false otherwise
+         */
+        bool DetachStandbySourceBintr(DSL_BASE_PTR pSourceBintr);
+
         /**
          * @brief Gets the current batch settings for the Pipeline's Stream Muxer
          * @param[out] batchSize current batchSize, default == the number of source
@@ -151,6 +312,143 @@ namespace DSL
          * @return true if the Padding enable setting could be set, false otherwise.
          */
         bool SetStreamMuxPadding(bool enabled);
+
+        /**
+         * @brief Gets the current adaptive batch-timeout settings for the Pipeline's
+         * Stream Muxer
+         * @param[out] enabled true if the adaptive batch-timeout controller is enabled
+         * @param[out] jitterMargin margin in microseconds added to the slowest 
+         * source's frame period
+         */
+        void GetStreamMuxBatchTimeoutAdaptive(bool* enabled, uint* jitterMargin);
+
+        /**
+         * @brief Sets the adaptive batch-timeout settings for the Pipeline's Stream Muxer
+         * @param[in] enabled set to true to enable the adaptive controller
+         * @param[in] jitterMargin margin in microseconds to add to the frame period
+         * @return true if the settings could be updated, false otherwise
+         */
+        bool SetStreamMuxBatchTimeoutAdaptive(bool enabled, uint jitterMargin);
+        
+        /**
+         * @brief Gets the batch-timeout in use by the Pipeline's Stream Muxer 
+         * and the batch fill ratio measured over the last update interval
+         * @param[out] batchTimeout batched-push-timeout in use in microseconds
+         * @param[out] fillRatio average frames-per-batch / batch-size, 0.0 to 1.0
+         */
+        void GetStreamMuxBatchStats(uint* batchTimeout, double* fillRatio);
+
+        /**
+         * @brief Gets the current adaptive batch-size settings for the Pipeline
+         * @param[out] enabled true if the batch-size follows the number of Sources
+         * @param[out] hysteresis number of Sources the count must fall below the 
+         * current batch-size before the batch-size is reduced
+         */
+        void GetStreamMuxBatchSizeAdaptive(bool* enabled, uint* hysteresis);
+
+        /**
+         * @brief Sets the adaptive batch-size settings for the Pipeline. When enabled,
+         * the batch-size grows immediately as Sources are added while playing, and is
+         * reduced when the number of Sources falls by hysteresis or more.
+         * @param[in] enabled set to true to enable the adaptive batch-size
+         * @param[in] hysteresis number of Sources below the batch-size to reduce on
+         * @return true if the settings could be updated, false otherwise
+         */
+        bool SetStreamMuxBatchSizeAdaptive(bool enabled, uint hysteresis);
+
+        /**
+         * @brief Gets the current main-context setting for the Pipeline
+         * @return true if the Pipeline's bus messages are handled in its own 
+         * GMainContext and thread, false if handled by the default main loop
+         */
+        bool GetMainContextEnabled();
+
+        /**
+         * @brief Sets the main-context setting for the Pipeline. When enabled, the 
+         * Pipeline's bus watch is moved to a new GMainContext run by a dedicated 
+         * thread, and all state-change, end-of-stream, and error handling, including 
+         * the client listeners, is done on that thread. Component timers, added once 
+         * linked, find the main-context with GetPipelineMainContext and run there too.
+         * @param[in] enabled set to true to use a dedicated main-context and thread
+         * @return false if the Pipeline is currently linked, true otherwise
+         */
+        bool SetMainContextEnabled(bool enabled);
+
+        /**
+         * @brief Runs the Pipeline's main loop until stopped. Called by the 
+         * dedicated main-context thread only
+         */
+        void RunMainContextLoop();
+
+        /**
+         * @brief Joins the threads of all main-contexts stopped since the last 
+         * call. Must be called without holding the services mutex, as a client 
+         * listener running on a stopping thread may be waiting on it
+         */
+        void JoinStoppedMainContexts();
+
+        /**
+         * @brief Gets the QoS counters for an element in the Pipeline
+         * @param[in] element path of the GStreamer element to query
+         * @param[out] stats current QoS counters for the element
+         * @return false if no QoS message has been received from the element
+         */
+        bool GetQosElementStats(const char* element, QosElementStats* stats);
+        
+        /**
+         * @brief Gets the QoS totals for all elements in the Pipeline
+         * @param[out] elements number of elements that have posted QoS messages
+         * @param[out] dropped sum of the dropped counters for all elements
+         */
+        void GetQosTotals(uint* elements, uint64_t* dropped);
+        
+        /**
+         * @brief Clears the QoS counters for all elements in the Pipeline
+         */
+        void ClearQosStats();
+        
+        /**
+         * @brief adds a callback to be notified when an element's dropped 
+         * count increases by threshold or more since the last notification
+         * @param[in] listener pointer to the client's function to call
+         * @param[in] threshold number of new drops required to notify, > 0
+         * @param[in] clientData opaque pointer to client data passed to the listener
+         * @return false if the listener is not unique or threshold is 0
+         */
+        bool AddQosListener(dsl_qos_listener_cb listener, 
+            uint threshold, void* clientData);
+
+        /**
+         * @brief removes a previously added QoS listener
+         * @param[in] listener pointer to the client's function to remove
+         * @return false if the listener was not found
+         */
+        bool RemoveQosListener(dsl_qos_listener_cb listener);
+        
+        /**
+         * @brief Sets the thread policy for all streaming threads owned by a named 
+         * component, or the default policy for all other streaming threads. The 
+         * policy is applied to all current threads and all threads created after.
+         * @param[in] component name of the component, empty for the default policy
+         * @param[in] policy CPU affinity and scheduling policy to apply
+         * @return false if the policy is invalid or failed to be applied
+         */
+        bool SetThreadPolicy(const char* component, const ThreadPolicy& policy);
+        
+        /**
+         * @brief Removes a thread policy previously set. Threads keep their current
+         * affinity and scheduling until they next enter their task function.
+         * @param[in] component name of the component, empty for the default policy
+         * @return false if no policy has been set for the component
+         */
+        bool RemoveThreadPolicy(const char* component);
+        
+        /**
+         * @brief Gets a report of all streaming threads, with the policy applied 
+         * and the CPU each thread last ran on, one thread per line
+         * @return report text, valid until the next call
+         */
+        const char* GetThreadReport();
         
         /**
          * @brief Gets the current dimensions for the Pipeline's XWindow
@@ -306,11 +604,84 @@ namespace DSL
         
         void HandleErrorMessage(GstMessage* pMessage);
         
+        /**
+         * @brief Updates the QoS counters for the element posting the message
+         * and notifies all QoS listeners with their threshold exceeded
+         * @param[in] pMessage GST_MESSAGE_QOS message to parse
+         */
+        void HandleQosMessage(GstMessage* pMessage);
+        
+        /**
+         * @brief Tracks the streaming thread posting the message and applies 
+         * the thread policy for the owning element. Called on the streaming 
+         * thread itself from the bus sync handler
+         * @param[in] pMessage GST_MESSAGE_STREAM_STATUS message to parse
+         */
+        void HandleStreamStatusMessage(GstMessage* pMessage);
+        
+        /**
+         * @brief Gets the names of an element and all of its ancestors, nearest first
+         * @param[in] pElement element to start from
+         * @param[out] ancestry vector to append the names to
+         */
+        void GetAncestry(GstElement* pElement, std::vector<std::string>& ancestry);
+        
+        /**
+         * @brief Resolves and applies the thread policy for a streaming thread.
+         * The thread policy mutex must be held
+         * @param[in] thread streaming thread to update
+         * @return false if the policy failed to be applied
+         */
+        bool ApplyThreadPolicy(StreamingThread& thread);
+        
+        /**
+         * @brief Restores a streaming thread's CPU affinity and scheduling 
+         * policy to their values on entry, if a policy has been applied.
+         * The thread policy mutex must be held
+         * @param[in] thread streaming thread to restore
+         * @return false if the thread failed to be restored
+         */
+        bool RestoreThreadPolicy(StreamingThread& thread);
+        
+        /**
+         * @brief Notifies all Window Sinks rendering to this Pipeline's XWindow 
+         * of a change in visibility with a custom upstream event.
+         * @param[in] hidden true if the XWindow is now unmapped or fully obscured
+         */
+        void NotifyXWindowVisibility(bool hidden);
+        
+        /**
+         * @brief Updates the batch-size for the Stream Muxer, Primary GIE and Tracker
+         * on dynamic Source add/remove if the adaptive batch-size is enabled.
+         * @return true if the batch-size was updated or left unchanged, false on failure
+         */
+        bool UpdateBatchSize();
+        
         /**
          * @brief parent bin for all Source bins in this Pipeline
          */
         DSL_PIPELINE_SOURCES_PTR m_pPipelineSourcesBintr;
         
+        /**
+         * @brief true if the Stream Muxer's adaptive batch-timeout is enabled
+         */
+        bool m_isBatchTimeoutAdaptive;
+        
+        /**
+         * @brief jitter margin in microseconds for the adaptive batch-timeout
+         */
+        uint m_batchTimeoutJitterMargin;
+        
+        /**
+         * @brief true if the batch-size follows the number of Sources
+         */
+        bool m_isBatchSizeAdaptive;
+        
+        /**
+         * @brief hysteresis, in number of Sources, for reducing the batch-size
+         */
+        uint m_batchSizeHysteresis;
+        
         /**
          * @brief width setting to use on XWindow creation in pixels
          */
@@ -321,6 +692,22 @@ namespace DSL
          */
         uint m_xWindowHeight;
         
+        /**
+         * @brief true if the XWindow is currently mapped, i.e. not minimized
+         */
+        bool m_xWindowMapped;
+        
+        /**
+         * @brief true if the XWindow is currently fully obscured by other windows
+         */
+        bool m_xWindowObscured;
+        
+        /**
+         * @brief referenced sink elements that have been given this Pipeline's 
+         * XWindow handle, notified on visibility change.
+         */
+        std::vector<GstElement*> m_xWindowSinks;
+        
         /**
          * @brief map of all currently registered state-change-listeners
          * callback functions mapped with the user provided data
@@ -333,6 +720,53 @@ namespace DSL
          */
         std::map<dsl_eos_listener_cb, void*>m_eosListeners;
         
+        /**
+         * @brief map of all currently registered QoS-listeners
+         * callback functions mapped with their threshold and user data
+         */
+        std::map<dsl_qos_listener_cb, QosListener>m_qosListeners;
+        
+        /**
+         * @brief map of QoS counters by path of the posting element
+         */
+        std::map<std::string, QosElementStats> m_qosStats;
+        
+        /**
+         * @brief map of published QoS dropped counts by path of the posting element
+         */
+        std::map<std::string, DSL_METRIC_GAUGE_PTR> m_qosDroppedMetrics;
+        
+        /**
+         * @brief published GstState value of the Pipeline
+         */
+        DSL_METRIC_GAUGE_PTR m_pStateMetric;
+        
+        /**
+         * @brief map of thread policies by component name, "" for the default
+         */
+        std::map<std::string, ThreadPolicy> m_threadPolicies;
+        
+        /**
+         * @brief map of all current streaming threads by thread id
+         */
+        std::map<pid_t, StreamingThread> m_streamingThreads;
+        
+        /**
+         * @brief last report built by GetThreadReport
+         */
+        std::string m_threadReport;
+        
+        /**
+         * @brief mutex to protect the thread policies and streaming threads
+         */
+        GMutex m_threadPolicyMutex;
+        
+        /**
+         * @brief mutex to protect the QoS counters, which are updated by the 
+         * bus watch and read by the client
+         */
+        GMutex m_qosMutex;
+        
         /**
          * @brief map of all currently registered XWindow-key-event-handlers
          * callback functions mapped with the user provided data
@@ -370,6 +804,39 @@ namespace DSL
          * @brief handle to the installed Bus Watch function.
          */
         guint m_gstBusWatch;
+
+        /**
+         * @brief the Pipeline's own main-context for its bus watch, 
+         * NULL when using the default main-context
+         */
+        GMainContext* m_pMainContext;
+        
+        /**
+         * @brief main loop for the Pipeline's own main-context
+         */
+        GMainLoop* m_pMainContextLoop;
+        
+        /**
+         * @brief handle to the thread running the Pipeline's main loop
+         */
+        GThread* m_pMainContextThread;
+
+        /**
+         * @brief threads of stopped main-contexts, waiting to be joined
+         */
+        std::vector<GThread*> m_stoppedMainContextThreads;
+        
+        /**
+         * @brief mutex to protect the stopped main-context threads
+         */
+        GMutex m_stoppedMainContextsMutex;
+
+        /**
+         * @brief quits the Pipeline's main loop and frees the main-context. 
+         * The thread is joined later by JoinStoppedMainContexts. The bus 
+         * watch must be removed by the caller
+         */
+        void StopMainContext();
         
         /**
          * @brief maps a GstState constant value to a string for logging
@@ -431,6 +898,19 @@ namespace DSL
 
     static gpointer XWindowEventThread(gpointer pData);
 
+    /**
+     * @brief thread function to run a Pipeline's own main loop
+     * @param[in] pData pipeline instance pointer
+     */
+    static gpointer MainContextThread(gpointer pData);
+
+    /**
+     * @brief idle callback to quit a Pipeline's own main loop
+     * @param[in] pLoop main loop to quit
+     * @return false always to remove the callback
+     */
+    static int MainContextQuitHandler(gpointer pLoop);
+
     
 } // Namespace
 
@@ -34,6 +34,12 @@ namespace DSL
         , m_flush(false)
         , m_primaryGieUniqueId(0)
         , m_interval(0)
+        , m_isCacheEnabled(false)
+        , m_cacheMaxAge(DSL_DEFAULT_SGIE_CACHE_MAX_AGE)
+        , m_cacheMinConfidence(DSL_DEFAULT_SGIE_CACHE_MIN_CONFIDENCE)
+        , m_cacheHits(0)
+        , m_cacheMisses(0)
+        , m_cacheBatchCount(0)
     {
         LOG_FUNC();
 
@@ -59,9 +65,11 @@ namespace DSL
         }
         
         // Sink Pad Probe -- added to the Tee -- is used to wait on Stream events, and to 
-        // unblock the waiting Src Pad Probe on Flush or EOS
+        // unblock the waiting Src Pad Probe on Flush or EOS. Buffers are probed to mark
+        // the objects with cached results to skip, when the result cache is enabled.
         m_sinkPadProbeId = gst_pad_add_probe(m_pGstStaticSinkPad, 
-            GST_PAD_PROBE_TYPE_EVENT_BOTH, SecondaryGiesSinkProbeCB, this, NULL);
+            (GstPadProbeType)(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_BOTH),
+            SecondaryGiesSinkProbeCB, this, NULL);
 
         // Src Pad Probe -- added to the Queue -- used to block the stream and wait for
         // all SGIEs to finish processing the shared buffer.
@@ -79,6 +87,7 @@ namespace DSL
         
         g_mutex_init(&m_sinkPadProbeMutex);
         g_mutex_init(&m_srcPadProbeMutex);
+        g_mutex_init(&m_cacheMutex);
     }
     
     PipelineSecondaryGiesBintr::~PipelineSecondaryGiesBintr()
@@ -92,6 +101,7 @@ namespace DSL
     
         g_mutex_clear(&m_sinkPadProbeMutex);
         g_mutex_clear(&m_srcPadProbeMutex);
+        g_mutex_clear(&m_cacheMutex);
     }
      
     bool PipelineSecondaryGiesBintr::AddChild(DSL_BASE_PTR pChildElement)
@@ -244,6 +254,13 @@ namespace DSL
                 }
             }
         }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        m_cache.clear();
+        m_cacheFrameNums.clear();
+        m_cacheHits = 0;
+        m_cacheMisses = 0;
+        m_cacheBatchCount = 0;
+        
         m_isLinked = true;
         return true;
     }
@@ -294,6 +311,23 @@ namespace DSL
         m_interval = interval;
     }
     
+    bool PipelineSecondaryGiesBintr::UpdateBatchSize(uint batchSize)
+    {
+        LOG_FUNC();
+        
+        for (auto const& imap: m_pChildSecondaryGies)
+        {
+            if (!imap.second->UpdateBatchSize(batchSize))
+            {
+                LOG_ERROR("PipelineSecondaryGiesBintr '" << GetName() 
+                    << "' failed to update batch size for Child SecondaryGie '" 
+                    << imap.second->GetName() << "'");
+                return false;
+            }
+        }
+        return Bintr::SetBatchSize(batchSize);
+    }
+    
     GstPadProbeReturn PipelineSecondaryGiesBintr::HandleSecondaryGiesSinkProbe(
         GstPad* pPad, GstPadProbeInfo* pInfo)
     {
@@ -308,6 +342,15 @@ namespace DSL
                 m_stop = true;
             }
         }
+        if ((pInfo->type & GST_PAD_PROBE_TYPE_BUFFER) and m_isCacheEnabled)
+        {
+            NvDsBatchMeta* pBatchMeta = 
+                gst_buffer_get_nvds_batch_meta(GST_BUFFER(pInfo->data));
+            if (pBatchMeta)
+            {
+                SkipCachedObjects(pBatchMeta);
+            }
+        }
         return GST_PAD_PROBE_OK;
     }
 
@@ -332,10 +375,239 @@ namespace DSL
                 gint64 endtime(g_get_monotonic_time() + G_TIME_SPAN_SECOND / 1000);
                 g_cond_wait_until(&m_padWaitLock, &m_srcPadProbeMutex, endtime);
             }
+            if (m_isCacheEnabled)
+            {
+                NvDsBatchMeta* pBatchMeta = 
+                    gst_buffer_get_nvds_batch_meta(GST_BUFFER(pInfo->data));
+                if (pBatchMeta)
+                {
+                    UpdateCachedObjects(pBatchMeta);
+                }
+            }
         }
         return GST_PAD_PROBE_OK;
     }
 
+    void PipelineSecondaryGiesBintr::GetCacheSettings(bool* enabled, 
+        uint* maxAge, float* minConfidence)
+    {
+        LOG_FUNC();
+        
+        *enabled = m_isCacheEnabled;
+        *maxAge = m_cacheMaxAge;
+        *minConfidence = m_cacheMinConfidence;
+    }
+
+    bool PipelineSecondaryGiesBintr::SetCacheSettings(bool enabled, 
+        uint maxAge, float minConfidence)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set result cache settings for PipelineSecondaryGiesBintr '" 
+                << GetName() << "' as it's currently linked");
+            return false;
+        }
+        if (minConfidence < 0 or minConfidence > 1)
+        {
+            LOG_ERROR("Invalid min confidence = " << minConfidence 
+                << " for PipelineSecondaryGiesBintr '" << GetName() << "'");
+            return false;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        m_isCacheEnabled = enabled;
+        m_cacheMaxAge = maxAge;
+        m_cacheMinConfidence = minConfidence;
+        m_cache.clear();
+        m_cacheFrameNums.clear();
+        
+        return true;
+    }
+
+    void PipelineSecondaryGiesBintr::GetCacheStats(uint64_t* hits, uint64_t* misses)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        *hits = m_cacheHits;
+        *misses = m_cacheMisses;
+    }
+
+    uint PipelineSecondaryGiesBintr::SkipCachedObjects(NvDsBatchMeta* pBatchMeta)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        uint skipped(0);
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            guint64 frameNum = pFrameMeta->frame_num;
+            
+            for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+            {
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectMetaList->data);
+                
+                // Only tracked objects detected by the Primary GIE are candidates
+                if (pObjectMeta->unique_component_id != m_primaryGieUniqueId or
+                    pObjectMeta->object_id == UNTRACKED_OBJECT_ID)
+                {
+                    continue;
+                }
+                auto ientry = m_cache.find(
+                    std::make_pair(pFrameMeta->source_id, pObjectMeta->object_id));
+                    
+                // An entry from a later frame means the source has restarted
+                if (ientry == m_cache.end() or 
+                    frameNum < ientry->second.inferFrameNum or
+                    frameNum - ientry->second.inferFrameNum > m_cacheMaxAge or
+                    ientry->second.confidence < m_cacheMinConfidence)
+                {
+                    m_cacheMisses++;
+                    continue;
+                }
+                ientry->second.seenFrameNum = frameNum;
+                pObjectMeta->unique_component_id = DSL_SGIE_CACHE_SKIPPED_COMPONENT_ID;
+                m_cacheHits++;
+                skipped++;
+            }
+        }
+        return skipped;
+    }
+
+    uint PipelineSecondaryGiesBintr::UpdateCachedObjects(NvDsBatchMeta* pBatchMeta)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        uint restored(0);
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            guint64 frameNum = pFrameMeta->frame_num;
+            
+            m_cacheFrameNums[pFrameMeta->source_id] = frameNum;
+            
+            for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+            {
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectMetaList->data);
+                std::pair<guint, guint64> key = 
+                    std::make_pair(pFrameMeta->source_id, pObjectMeta->object_id);
+                
+                if (pObjectMeta->unique_component_id == DSL_SGIE_CACHE_SKIPPED_COMPONENT_ID)
+                {
+                    pObjectMeta->unique_component_id = m_primaryGieUniqueId;
+                    
+                    auto ientry = m_cache.find(key);
+                    if (ientry != m_cache.end())
+                    {
+                        AddCachedResults(pBatchMeta, pObjectMeta, ientry->second);
+                    }
+                    restored++;
+                    continue;
+                }
+                if (pObjectMeta->unique_component_id != m_primaryGieUniqueId or
+                    pObjectMeta->object_id == UNTRACKED_OBJECT_ID)
+                {
+                    continue;
+                }
+                // Fresh inference, replace any cached results for the object
+                SgieCacheEntry entry{frameNum, frameNum, 1.0f, {}};
+                
+                for (NvDsMetaList* pClassifierMetaList = pObjectMeta->classifier_meta_list;
+                    pClassifierMetaList; pClassifierMetaList = pClassifierMetaList->next)
+                {
+                    NvDsClassifierMeta* pClassifierMeta = 
+                        (NvDsClassifierMeta*)(pClassifierMetaList->data);
+                    SgieCachedResult result{pClassifierMeta->unique_component_id, {}};
+                    
+                    for (NvDsMetaList* pLabelInfoList = pClassifierMeta->label_info_list;
+                        pLabelInfoList; pLabelInfoList = pLabelInfoList->next)
+                    {
+                        NvDsLabelInfo labelInfo = *(NvDsLabelInfo*)(pLabelInfoList->data);
+                        labelInfo.pResult_label = NULL;
+                        entry.confidence = std::min(entry.confidence, labelInfo.result_prob);
+                        result.labels.push_back(labelInfo);
+                    }
+                    entry.results.push_back(result);
+                }
+                // Nothing to reuse if all classifiers are below their thresholds
+                if (entry.results.empty())
+                {
+                    m_cache.erase(key);
+                    continue;
+                }
+                m_cache[key] = entry;
+            }
+        }
+        if (++m_cacheBatchCount >= DSL_DEFAULT_SGIE_CACHE_PURGE_INTERVAL)
+        {
+            PurgeCache();
+            m_cacheBatchCount = 0;
+        }
+        return restored;
+    }
+
+    void PipelineSecondaryGiesBintr::AddCachedResults(NvDsBatchMeta* pBatchMeta, 
+        NvDsObjectMeta* pObjectMeta, const SgieCacheEntry& entry)
+    {
+        for (auto const& result: entry.results)
+        {
+            NvDsClassifierMeta* pClassifierMeta = 
+                nvds_acquire_classifier_meta_from_pool(pBatchMeta);
+            pClassifierMeta->unique_component_id = result.componentId;
+            
+            for (auto const& label: result.labels)
+            {
+                NvDsLabelInfo* pLabelInfo = 
+                    nvds_acquire_label_info_meta_from_pool(pBatchMeta);
+                pLabelInfo->num_classes = label.num_classes;
+                pLabelInfo->result_class_id = label.result_class_id;
+                pLabelInfo->label_id = label.label_id;
+                pLabelInfo->result_prob = label.result_prob;
+                g_strlcpy(pLabelInfo->result_label, label.result_label, MAX_LABEL_SIZE);
+                pLabelInfo->pResult_label = NULL;
+                
+                nvds_add_label_info_meta_to_classifier(pClassifierMeta, pLabelInfo);
+                
+                // Append the label to the display text as the Secondary GIE would have
+                if (label.result_label[0] and pObjectMeta->text_params.display_text)
+                {
+                    gchar* displayText = g_strconcat(pObjectMeta->text_params.display_text, 
+                        " ", label.result_label, NULL);
+                    g_free(pObjectMeta->text_params.display_text);
+                    pObjectMeta->text_params.display_text = displayText;
+                }
+            }
+            nvds_add_classifier_meta_to_object(pObjectMeta, pClassifierMeta);
+        }
+    }
+
+    void PipelineSecondaryGiesBintr::PurgeCache()
+    {
+        for (auto ientry = m_cache.begin(); ientry != m_cache.end();)
+        {
+            guint64 frameNum = m_cacheFrameNums[ientry->first.first];
+            
+            // Objects not seen for more than the max age are assumed lost by the Tracker
+            if (frameNum < ientry->second.seenFrameNum or
+                frameNum - ientry->second.seenFrameNum > m_cacheMaxAge)
+            {
+                ientry = m_cache.erase(ientry);
+            }
+            else
+            {
+                ientry++;
+            }
+        }
+    }
+
     // ************************************************************************
     // Sink and Src Pad Probe Callback functions for all Pipelines...
     // Callback user-data points to the Instance of PipelineSecondaryGiesBintr
@@ -40,6 +40,56 @@ namespace DSL
     #define DSL_PIPELINE_SGIES_NEW(name) \
         std::shared_ptr<PipelineSecondaryGiesBintr>(new PipelineSecondaryGiesBintr(name))
 
+    /**
+     * @brief unique component id assigned to an object's meta while its cached
+     * classifier results are in use, so that all Secondary GIEs skip the object.
+     */
+    #define DSL_SGIE_CACHE_SKIPPED_COMPONENT_ID G_MININT
+
+    /**
+     * @struct SgieCachedResult
+     * @brief a copy of one Secondary GIE's classifier meta for a tracked object
+     */
+    struct SgieCachedResult
+    {
+        /**
+         * @brief unique id of the Secondary GIE that produced the result
+         */
+        gint componentId;
+        
+        /**
+         * @brief copies of the classifier's label info, with pResult_label cleared
+         */
+        std::vector<NvDsLabelInfo> labels;
+    };
+
+    /**
+     * @struct SgieCacheEntry
+     * @brief all cached classifier results for a single tracked object
+     */
+    struct SgieCacheEntry
+    {
+        /**
+         * @brief frame number the results were last inferred on
+         */
+        guint64 inferFrameNum;
+
+        /**
+         * @brief frame number the tracked object was last seen on
+         */
+        guint64 seenFrameNum;
+
+        /**
+         * @brief lowest label probability across all cached results
+         */
+        float confidence;
+        
+        /**
+         * @brief cached results, one per Secondary GIE
+         */
+        std::vector<SgieCachedResult> results;
+    };
+
     /**
      * @class PipelineSecondaryGiesBintr
      * @brief Implements a container class for a collection of Secondary GIEs
@@ -113,6 +163,14 @@ namespace DSL
          */
         void SetInterval(uint interval);
         
+        /**
+         * @brief Updates the Batch Size for all child Secondary GIE's while linked, 
+         * i.e. on a dynamic Source add/remove. See GieBintr::UpdateBatchSize
+         * @param batchSize the new Batch Size to use
+         * @return true on successful update, false otherwise
+         */
+        bool UpdateBatchSize(uint batchSize);
+        
         /**
          * @brief 
          * @param pPad
@@ -129,7 +187,65 @@ namespace DSL
          */
         GstPadProbeReturn HandleSecondaryGiesSrcProbe(GstPad* pPad, GstPadProbeInfo* pInfo);
 
+        /**
+         * @brief Gets the current classifier result cache settings
+         * @param[out] enabled true if the result cache is enabled
+         * @param[out] maxAge maximum age, in frames, of a cached result before 
+         * the object is re-inferred
+         * @param[out] minConfidence minimum label probability for a cached result
+         * to be reused
+         */
+        void GetCacheSettings(bool* enabled, uint* maxAge, float* minConfidence);
+
+        /**
+         * @brief Sets the classifier result cache settings. The cache is cleared
+         * @param[in] enabled set to true to enable the result cache
+         * @param[in] maxAge maximum age, in frames, of a cached result
+         * @param[in] minConfidence minimum label probability for reuse [0..1]
+         * @return false if currently linked or the settings are invalid
+         */
+        bool SetCacheSettings(bool enabled, uint maxAge, float minConfidence);
+
+        /**
+         * @brief Gets the result cache hit and miss counters since the last link
+         * @param[out] hits number of tracked objects that reused cached results
+         * @param[out] misses number of tracked objects inferred by the Secondary GIEs
+         */
+        void GetCacheStats(uint64_t* hits, uint64_t* misses);
+
+        /**
+         * @brief Marks all tracked objects with fresh cached results to be 
+         * skipped by all Secondary GIEs. Called before the batch is tee'd.
+         * @param[in] pBatchMeta batch meta for the buffer about to be inferred
+         * @return number of objects marked to skip
+         */
+        uint SkipCachedObjects(NvDsBatchMeta* pBatchMeta);
+
+        /**
+         * @brief Restores all skipped objects, attaching their cached results,
+         * and updates the cache from all objects inferred on. Called once all
+         * Secondary GIEs have finished with the batch.
+         * @param[in] pBatchMeta batch meta for the buffer just inferred
+         * @return number of skipped objects restored
+         */
+        uint UpdateCachedObjects(NvDsBatchMeta* pBatchMeta);
+
     private:
+
+        /**
+         * @brief Adds copies of the cached results to an object's meta
+         * @param[in] pBatchMeta batch meta to acquire the new meta from
+         * @param[in] pObjectMeta object meta to add the classifier meta to
+         * @param[in] entry cache entry with the results to add
+         */
+        void AddCachedResults(NvDsBatchMeta* pBatchMeta, 
+            NvDsObjectMeta* pObjectMeta, const SgieCacheEntry& entry);
+
+        /**
+         * @brief Removes all entries for objects not seen for more than the max age
+         */
+        void PurgeCache();
+
         /**
          * @brief adds a child Elementr to this PipelineSourcesBintr
          * @param pChildElement a shared pointer to the Elementr to add
@@ -191,6 +307,52 @@ namespace DSL
         bool m_flush;
 
         GCond m_padWaitLock;
+        
+        /**
+         * @brief true if the classifier result cache is enabled
+         */
+        bool m_isCacheEnabled;
+        
+        /**
+         * @brief maximum age, in frames, of a cached result
+         */
+        uint m_cacheMaxAge;
+        
+        /**
+         * @brief minimum label probability for a cached result to be reused
+         */
+        float m_cacheMinConfidence;
+        
+        /**
+         * @brief number of tracked objects that reused cached results
+         */
+        uint64_t m_cacheHits;
+        
+        /**
+         * @brief number of tracked objects inferred by the Secondary GIEs
+         */
+        uint64_t m_cacheMisses;
+        
+        /**
+         * @brief number of batches updated since the last cache purge
+         */
+        uint m_cacheBatchCount;
+        
+        /**
+         * @brief cache entries keyed by {source id, tracking id}
+         */
+        std::map<std::pair<guint, guint64>, SgieCacheEntry> m_cache;
+        
+        /**
+         * @brief latest frame number, keyed by source id, used to age entries
+         */
+        std::map<guint, guint64> m_cacheFrameNums;
+        
+        /**
+         * @brief mutex to protect the cache shared between the sink (Tee) and 
+         * src (Queue) streaming threads
+         */
+        GMutex m_cacheMutex;
     };
 
     /**
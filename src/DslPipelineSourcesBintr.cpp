@@ -36,8 +36,18 @@ namespace DSL
         , m_streamMuxHeight(0)
         , m_isPaddingEnabled(false)
         , m_areSourcesLive(false)
+        , m_isBatchTimeoutAdaptive(false)
+        , m_batchTimeoutJitterMargin(DSL_DEFAULT_STREAMMUX_ADAPTIVE_JITTER_MARGIN)
+        , m_batchTimeoutInUse(0)
+        , m_batchFillRatio(0)
+        , m_batchCount(0)
+        , m_batchFrameCount(0)
+        , m_pBatchTimeoutTimerSource(NULL)
+        , m_batchFillProbeId(0)
     {
         LOG_FUNC();
+        
+        g_mutex_init(&m_adaptiveBatchMutex);
 
         g_object_set(m_pGstObj, "message-forward", TRUE, NULL);
   
@@ -60,6 +70,7 @@ namespace DSL
         {
             UnlinkAll();
         }
+        g_mutex_clear(&m_adaptiveBatchMutex);
     }
 
     bool PipelineSourcesBintr::AddChild(DSL_BASE_PTR pChildElement)
@@ -100,11 +111,15 @@ namespace DSL
         // linkAll Elementrs now and Link to with the Stream
         if (IsLinked())
         {
-            pChildSource->SetId(GetNumChildren() - 1);
+            pChildSource->SetId(GetNextAvailableId());
             if (!pChildSource->LinkAll() or !pChildSource->LinkToSink(m_pStreamMux))
             {
                 return false;
             }
+            if (m_isBatchTimeoutAdaptive and !AddArrivalProbe(pChildSource))
+            {
+                return false;
+            }
             // Sink up with the parent state
             return gst_element_sync_state_with_parent(pChildSource->GetGstElement());
         }
@@ -140,13 +155,18 @@ namespace DSL
 
         if (pChildSource->IsLinkedToSink())
         {
+            // remove the arrival probe, if any, before the sink pad is released
+            RemoveArrivalProbe(pChildSource);
+            
             // unlink the source from the Streammuxer
             pChildSource->UnlinkFromSink();
             pChildSource->UnlinkAll();
         }
         
-        // unreference and remove from the collection of source
+        // unreference and remove from the collection of source, and from 
+        // the standby pool if the Source was attached from standby
         m_pChildSources.erase(pChildSource->GetName());
+        m_pStandbySources.erase(pChildSource->GetName());
         
         // call the base function to complete the remove
         return Bintr::RemoveChild(pChildSource);
@@ -183,11 +203,30 @@ namespace DSL
             }
             id++;
         }
+        // Standby Sources are linked and held at their src pad until attached
+        for (auto const& imap: m_pStandbySources)
+        {
+            if (IsChild(imap.second))
+            {
+                continue;
+            }
+            if (!imap.second->LinkAll() or !AddStandbyProbe(imap.second))
+            {
+                LOG_ERROR("PipelineSourcesBintr '" << GetName() 
+                    << "' failed to Link Standby Source '" << imap.second->GetName() << "'");
+                return false;
+            }
+        }
         if (!m_batchSize)
         {
             // Set the Batch size to the nuber of sources owned if not already set
-            // TODO add support for managing batch timeout
-            SetStreamMuxBatchProperties(m_pChildSources.size(), 40000);
+            // The batch timeout is managed at runtime if adaptive control is enabled.
+            SetStreamMuxBatchProperties(m_pChildSources.size(), 
+                (m_batchTimeout) ? m_batchTimeout : DSL_DEFAULT_STREAMMUX_BATCH_TIMEOUT);
+        }
+        if (m_isBatchTimeoutAdaptive and !StartBatchTimeoutAdaptive())
+        {
+            return false;
         }
         m_isLinked = true;
         
@@ -203,6 +242,9 @@ namespace DSL
             LOG_ERROR("PipelineSourcesBintr '" << GetName() << "' is not linked");
             return;
         }
+        // Safe to call if not started
+        StopBatchTimeoutAdaptive();
+        
         for (auto const& imap: m_pChildSources)
         {
             // unlink from the Tee Element
@@ -219,9 +261,242 @@ namespace DSL
             imap.second->SetId(-1);
 
         }
+        for (auto const& imap: m_pStandbySources)
+        {
+            if (!IsChild(imap.second))
+            {
+                RemoveStandbyProbe(imap.second);
+                imap.second->UnlinkAll();
+            }
+        }
         m_isLinked = false;
     }
     
+    bool PipelineSourcesBintr::AddStandbyChild(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+        
+        if (IsChild(pChildSource) or IsStandbyChild(pChildSource))
+        {
+            LOG_ERROR("Source '" << pChildSource->GetName() << "' is already a child of '" << GetName() << "'");
+            return false;
+        }
+        // Only live Sources can be held in standby, as a non-live Source would 
+        // run to EOS while its buffers are being dropped.
+        if (!pChildSource->IsLive())
+        {
+            LOG_ERROR("Source '" << pChildSource->GetName() 
+                << "' must be live to be added to the standby pool of '" << GetName() << "'");
+            return false;
+        }
+        if (m_pChildSources.size() == 0 and m_pStandbySources.size() == 0)
+        {
+            SetStreamMuxPlayType(true);
+        }
+        if (!m_areSourcesLive)
+        {
+            LOG_ERROR("Standby Source '" << pChildSource->GetName() 
+                << "' can not be added to non-live Sources of '" << GetName() << "'");
+            return false;
+        }
+        m_pStandbySources[pChildSource->GetName()] = pChildSource;
+        
+        if (!Bintr::AddChild(pChildSource))
+        {
+            LOG_ERROR("Faild to add Source '" << pChildSource->GetName() << "' as a child to '" << GetName() << "'");
+            m_pStandbySources.erase(pChildSource->GetName());
+            return false;
+        }
+        
+        // If currently linked, link the new Source and sync with the parent state
+        // so that it's negotiated and decoding before it's attached.
+        if (IsLinked())
+        {
+            if (!pChildSource->LinkAll() or !AddStandbyProbe(pChildSource))
+            {
+                return false;
+            }
+            return gst_element_sync_state_with_parent(pChildSource->GetGstElement());
+        }
+        return true;
+    }
+    
+    bool PipelineSourcesBintr::RemoveStandbyChild(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+        
+        if (!IsStandbyChild(pChildSource))
+        {
+            LOG_ERROR("Source '" << pChildSource->GetName() << "' is not a standby child of '" << GetName() << "'");
+            return false;
+        }
+        if (IsChild(pChildSource))
+        {
+            LOG_ERROR("Standby Source '" << pChildSource->GetName() 
+                << "' must be detached before it can be removed from '" << GetName() << "'");
+            return false;
+        }
+        if (pChildSource->IsLinked())
+        {
+            RemoveStandbyProbe(pChildSource);
+            pChildSource->UnlinkAll();
+        }
+        m_pStandbySources.erase(pChildSource->GetName());
+        
+        return Bintr::RemoveChild(pChildSource);
+    }
+    
+    bool PipelineSourcesBintr::IsStandbyChild(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+        
+        return (m_pStandbySources.find(pChildSource->GetName()) != m_pStandbySources.end());
+    }
+    
+    uint PipelineSourcesBintr::GetNumStandbyChildren()
+    {
+        LOG_FUNC();
+        
+        uint numDetached(0);
+        for (auto const& imap: m_pStandbySources)
+        {
+            if (!IsChild(imap.second))
+            {
+                numDetached++;
+            }
+        }
+        return numDetached;
+    }
+    
+    bool PipelineSourcesBintr::AttachStandbyChild(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+        
+        if (!IsStandbyChild(pChildSource) or IsChild(pChildSource))
+        {
+            LOG_ERROR("Source '" << pChildSource->GetName() 
+                << "' is not a detached standby child of '" << GetName() << "'");
+            return false;
+        }
+        m_pChildSources[pChildSource->GetName()] = pChildSource;
+        
+        // Nothing more to do until linked, the Source will be linked as an attached Source
+        if (!IsLinked())
+        {
+            return true;
+        }
+        uint id = GetNextAvailableId();
+        pChildSource->SetId(id);
+        Services::GetServices()->_sourceNameSet(id, pChildSource->GetCStrName());
+        
+        // Link first, while buffers are still being dropped, then release the Source
+        if (!pChildSource->LinkToSink(m_pStreamMux))
+        {
+            LOG_ERROR("PipelineSourcesBintr '" << GetName() 
+                << "' failed to attach Standby Source '" << pChildSource->GetName() << "'");
+            m_pChildSources.erase(pChildSource->GetName());
+            return false;
+        }
+        if (m_isBatchTimeoutAdaptive and !AddArrivalProbe(pChildSource))
+        {
+            return false;
+        }
+        RemoveStandbyProbe(pChildSource);
+        
+        LOG_INFO("Standby Source '" << pChildSource->GetName() 
+            << "' attached with Id = " << id << " for PipelineSourcesBintr '" << GetName() << "'");
+        return true;
+    }
+    
+    bool PipelineSourcesBintr::DetachStandbyChild(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+        
+        if (!IsStandbyChild(pChildSource) or !IsChild(pChildSource))
+        {
+            LOG_ERROR("Source '" << pChildSource->GetName() 
+                << "' is not an attached standby child of '" << GetName() << "'");
+            return false;
+        }
+        if (IsLinked())
+        {
+            // Hold the Source first so that no buffer is pushed to an unlinked pad
+            if (!AddStandbyProbe(pChildSource))
+            {
+                return false;
+            }
+            RemoveArrivalProbe(pChildSource);
+            
+            if (!pChildSource->UnlinkFromSink())
+            {
+                return false;
+            }
+            Services::GetServices()->_sourceNameErase(pChildSource->GetId());
+            pChildSource->SetId(-1);
+        }
+        m_pChildSources.erase(pChildSource->GetName());
+
+        LOG_INFO("Standby Source '" << pChildSource->GetName() 
+            << "' detached for PipelineSourcesBintr '" << GetName() << "'");
+        return true;
+    }
+    
+    bool PipelineSourcesBintr::AddStandbyProbe(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+
+        GstPad* pSrcPad = gst_element_get_static_pad(pChildSource->GetGstElement(), "src");
+        if (!pSrcPad)
+        {
+            LOG_ERROR("Failed to get Src Pad for Standby Source '" << pChildSource->GetName() << "'");
+            return false;
+        }
+        m_standbyProbeIds[pChildSource->GetName()] = gst_pad_add_probe(pSrcPad, 
+            (GstPadProbeType)(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_BUFFER_LIST),
+            StandbySourceProbeCB, this, NULL);
+        gst_object_unref(pSrcPad);
+        
+        return true;
+    }
+
+    void PipelineSourcesBintr::RemoveStandbyProbe(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+
+        auto iter = m_standbyProbeIds.find(pChildSource->GetName());
+        if (iter == m_standbyProbeIds.end())
+        {
+            return;
+        }
+        GstPad* pSrcPad = gst_element_get_static_pad(pChildSource->GetGstElement(), "src");
+        gst_pad_remove_probe(pSrcPad, iter->second);
+        gst_object_unref(pSrcPad);
+        
+        m_standbyProbeIds.erase(iter);
+    }
+    
+    uint PipelineSourcesBintr::GetNextAvailableId()
+    {
+        LOG_FUNC();
+        
+        uint id(0);
+        bool inUse(true);
+        while (inUse)
+        {
+            inUse = false;
+            for (auto const& imap: m_pChildSources)
+            {
+                if (imap.second->GetId() == (int)id)
+                {
+                    inUse = true;
+                    id++;
+                    break;
+                }
+            }
+        }
+        return id;
+    }
+    
     void PipelineSourcesBintr::SetStreamMuxPlayType(bool areSourcesLive)
     {
         LOG_FUNC();
@@ -252,6 +527,7 @@ namespace DSL
 
         m_batchSize = batchSize;
         m_batchTimeout = batchTimeout;
+        m_batchTimeoutInUse = batchTimeout;
 
         LOG_INFO("Setting StreamMux batch properties: batch-size = " << m_batchSize 
             << ", batch-timeout = " << m_batchTimeout);
@@ -260,6 +536,18 @@ namespace DSL
         m_pStreamMux->SetAttribute("batched-push-timeout", m_batchTimeout);
     }
     
+    void PipelineSourcesBintr::UpdateStreamMuxBatchSize(uint batchSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveBatchMutex);
+
+        m_batchSize = batchSize;
+
+        LOG_INFO("Updating StreamMux batch-size = " << m_batchSize);
+
+        m_pStreamMux->SetAttribute("batch-size", m_batchSize);
+    }
+    
     void PipelineSourcesBintr::GetStreamMuxDimensions(uint* width, uint* height)
     {
         LOG_FUNC();
@@ -299,4 +587,284 @@ namespace DSL
         
         m_pStreamMux->SetAttribute("enable-padding", m_isPaddingEnabled);
     }
-}
+
+    void PipelineSourcesBintr::GetStreamMuxBatchTimeoutAdaptive(bool* enabled, 
+        uint* jitterMargin)
+    {
+        LOG_FUNC();
+        
+        *enabled = m_isBatchTimeoutAdaptive;
+        *jitterMargin = m_batchTimeoutJitterMargin;
+    }
+    
+    bool PipelineSourcesBintr::SetStreamMuxBatchTimeoutAdaptive(bool enabled, 
+        uint jitterMargin)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("PipelineSourcesBintr '" << GetName() 
+                << "' is currently linked - adaptive batch-timeout can not be updated");
+            return false;
+        }
+        m_isBatchTimeoutAdaptive = enabled;
+        m_batchTimeoutJitterMargin = jitterMargin;
+        
+        LOG_INFO("Setting StreamMux adaptive batch-timeout: enabled = " 
+            << m_isBatchTimeoutAdaptive << ", jitter-margin = " << m_batchTimeoutJitterMargin);
+        return true;
+    }
+    
+    void PipelineSourcesBintr::GetStreamMuxBatchStats(uint* batchTimeout, double* fillRatio)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveBatchMutex);
+        
+        *batchTimeout = m_batchTimeoutInUse;
+        *fillRatio = m_batchFillRatio;
+    }
+    
+    bool PipelineSourcesBintr::HandleSourceErrorMessage(GstObject* pSrcObject, const char* error)
+    {
+        LOG_FUNC();
+        
+        for (auto const& imap: m_pChildSources)
+        {
+            if (gst_object_has_as_ancestor(pSrcObject, imap.second->GetGstObject()))
+            {
+                DSL_RTSP_SOURCE_PTR pRtspSource = 
+                    std::dynamic_pointer_cast<RtspSourceBintr>(imap.second);
+                if (pRtspSource)
+                {
+                    pRtspSource->SetLastError(error);
+                    return true;
+                }
+                return false;
+            }
+        }
+        return false;
+    }
+    
+    bool PipelineSourcesBintr::AddArrivalProbe(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveBatchMutex);
+        
+        std::string sinkPadName = "sink_" + std::to_string(pChildSource->GetId());
+
+        GstPad* pSinkPad = gst_element_get_static_pad(m_pStreamMux->GetGstElement(), 
+            sinkPadName.c_str());
+        if (!pSinkPad)
+        {
+            LOG_ERROR("Failed to get Sink Pad '" << sinkPadName << "' for StreamMux '" 
+                << m_pStreamMux->GetName() << "'");
+            return false;
+        }
+        // The Source holds a reference to the requested pad while linked
+        gst_object_unref(pSinkPad);
+        
+        m_arrivalMeters[pSinkPad] = DSL_SOURCE_ARRIVAL_METER_NEW(pChildSource->GetId());
+        m_arrivalProbeIds[pSinkPad] = gst_pad_add_probe(pSinkPad, GST_PAD_PROBE_TYPE_BUFFER,
+            StreamMuxSinkPadProbeCB, this, NULL);
+            
+        return true;
+    }
+
+    void PipelineSourcesBintr::RemoveArrivalProbe(DSL_SOURCE_PTR pChildSource)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveBatchMutex);
+        
+        std::string sinkPadName = "sink_" + std::to_string(pChildSource->GetId());
+
+        GstPad* pSinkPad = gst_element_get_static_pad(m_pStreamMux->GetGstElement(), 
+            sinkPadName.c_str());
+        if (!pSinkPad)
+        {
+            return;
+        }
+        gst_object_unref(pSinkPad);
+
+        if (m_arrivalProbeIds.find(pSinkPad) != m_arrivalProbeIds.end())
+        {
+            gst_pad_remove_probe(pSinkPad, m_arrivalProbeIds[pSinkPad]);
+            m_arrivalProbeIds.erase(pSinkPad);
+            m_arrivalMeters.erase(pSinkPad);
+        }
+    }
+    
+    bool PipelineSourcesBintr::StartBatchTimeoutAdaptive()
+    {
+        LOG_FUNC();
+        
+        for (auto const& imap: m_pChildSources)
+        {
+            if (!AddArrivalProbe(imap.second))
+            {
+                StopBatchTimeoutAdaptive();
+                return false;
+            }
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveBatchMutex);
+        
+        GstPad* pSrcPad = gst_element_get_static_pad(m_pStreamMux->GetGstElement(), "src");
+        if (!pSrcPad)
+        {
+            LOG_ERROR("Failed to get Src Pad for StreamMux '" << m_pStreamMux->GetName() << "'");
+            return false;
+        }
+        m_batchFillProbeId = gst_pad_add_probe(pSrcPad, GST_PAD_PROBE_TYPE_BUFFER,
+            StreamMuxSrcPadProbeCB, this, NULL);
+        gst_object_unref(pSrcPad);
+
+        m_batchCount = 0;
+        m_batchFrameCount = 0;
+        m_batchFillRatio = 0;
+        m_pBatchTimeoutTimerSource = AddPipelineTimeout(GetGstObject(), 
+            DSL_DEFAULT_STREAMMUX_ADAPTIVE_UPDATE_INTERVAL, BatchTimeoutUpdateHandler, this);
+        
+        LOG_INFO("Adaptive batch-timeout started for PipelineSourcesBintr '" << GetName() << "'");
+        return true;
+    }
+
+    void PipelineSourcesBintr::StopBatchTimeoutAdaptive()
+    {
+        LOG_FUNC();
+        
+        for (auto const& imap: m_pChildSources)
+        {
+            RemoveArrivalProbe(imap.second);
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveBatchMutex);
+
+        if (m_pBatchTimeoutTimerSource)
+        {
+            RemovePipelineTimeout(m_pBatchTimeoutTimerSource);
+            m_pBatchTimeoutTimerSource = NULL;
+        }
+        if (m_batchFillProbeId)
+        {
+            GstPad* pSrcPad = gst_element_get_static_pad(m_pStreamMux->GetGstElement(), "src");
+            gst_pad_remove_probe(pSrcPad, m_batchFillProbeId);
+            gst_object_unref(pSrcPad);
+            m_batchFillProbeId = 0;
+        }
+        m_arrivalMeters.clear();
+        m_arrivalProbeIds.clear();
+        
+        // restore the configured batch-timeout
+        if (m_batchTimeoutInUse != (uint)m_batchTimeout)
+        {
+            m_batchTimeoutInUse = m_batchTimeout;
+            m_pStreamMux->SetAttribute("batched-push-timeout", m_batchTimeout);
+        }
+    }
+    
+    void PipelineSourcesBintr::HandleStreamMuxSinkPadBuffer(GstPad* pPad)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveBatchMutex);
+        
+        auto ipad = m_arrivalMeters.find(pPad);
+        if (ipad != m_arrivalMeters.end())
+        {
+            ipad->second->Timestamp(g_get_monotonic_time());
+        }
+    }
+
+    void PipelineSourcesBintr::HandleStreamMuxSrcPadBuffer(GstBuffer* pBuffer)
+    {
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (!pBatchMeta)
+        {
+            return;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveBatchMutex);
+        
+        m_batchCount++;
+        m_batchFrameCount += pBatchMeta->num_frames_in_batch;
+    }
+    
+    int PipelineSourcesBintr::HandleBatchTimeoutUpdate()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveBatchMutex);
+        
+        if (m_batchCount and m_batchSize)
+        {
+            m_batchFillRatio = (double)m_batchFrameCount / (m_batchCount*m_batchSize);
+        }
+        m_batchCount = 0;
+        m_batchFrameCount = 0;
+        
+        // Find the slowest live Source. A Source is considered stale, and excluded,
+        // if silent for 4 of its own frame periods or one full update interval.
+        gint64 now = g_get_monotonic_time();
+        double slowestPeriod(0);
+        
+        for (auto const& imap: m_arrivalMeters)
+        {
+            gint64 stalePeriod = std::max((gint64)(imap.second->GetAvgInterval()*4), 
+                (gint64)DSL_DEFAULT_STREAMMUX_ADAPTIVE_UPDATE_INTERVAL*1000);
+                
+            if (imap.second->IsLive(now, stalePeriod))
+            {
+                slowestPeriod = std::max(slowestPeriod, 
+                    imap.second->GetAvgInterval() + imap.second->GetAvgJitter());
+            }
+        }
+        if (!slowestPeriod)
+        {
+            return true;
+        }
+        
+        // Clamp to the minimum and to the configured batch-timeout as upper bound
+        uint batchTimeout = std::min((uint)m_batchTimeout, 
+            std::max((uint)DSL_DEFAULT_STREAMMUX_ADAPTIVE_MIN_BATCH_TIMEOUT,
+                (uint)slowestPeriod + m_batchTimeoutJitterMargin));
+        
+        // Only update on a change greater than 10% to avoid thrashing the Muxer
+        uint delta = (batchTimeout > m_batchTimeoutInUse) 
+            ? batchTimeout - m_batchTimeoutInUse 
+            : m_batchTimeoutInUse - batchTimeout;
+        if (delta > m_batchTimeoutInUse/10)
+        {
+            LOG_INFO("Updating StreamMux batch-timeout for '" << GetName() 
+                << "' from " << m_batchTimeoutInUse << " to " << batchTimeout
+                << ", batch fill ratio = " << m_batchFillRatio);
+                
+            m_batchTimeoutInUse = batchTimeout;
+            m_pStreamMux->SetAttribute("batched-push-timeout", (gint)m_batchTimeoutInUse);
+        }
+        return true;
+    }
+
+    //----------------------------------------------------------------------------------------------
+
+    static GstPadProbeReturn StreamMuxSinkPadProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSourcesBintr)
+    {
+        static_cast<PipelineSourcesBintr*>(pSourcesBintr)->
+            HandleStreamMuxSinkPadBuffer(pPad);
+        return GST_PAD_PROBE_OK;
+    }
+
+    static GstPadProbeReturn StreamMuxSrcPadProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSourcesBintr)
+    {
+        static_cast<PipelineSourcesBintr*>(pSourcesBintr)->
+            HandleStreamMuxSrcPadBuffer((GstBuffer*)pInfo->data);
+        return GST_PAD_PROBE_OK;
+    }
+
+    static int BatchTimeoutUpdateHandler(gpointer pSourcesBintr)
+    {
+        return static_cast<PipelineSourcesBintr*>(pSourcesBintr)->
+            HandleBatchTimeoutUpdate();
+    }
+
+    static GstPadProbeReturn StandbySourceProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSourcesBintr)
+    {
+        return GST_PAD_PROBE_DROP;
+    }
+}
\ No newline at end of file
@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslSourceBintr.h"
+#include "DslSourceMeter.h"
 
 namespace DSL
 {
@@ -63,6 +64,49 @@ namespace DSL
          */
         bool IsChild(DSL_SOURCE_PTR pChildSource);
 
+        /**
+         * @brief adds a live child SourceBintr to the standby pool of this 
+         * PipelineSourcesBintr. Standby Sources are linked and played with the
+         * Pipeline, but their output is dropped until attached to the Stream Muxer.
+         * @param pChildSource shared pointer to the live SourceBintr to add
+         * @return true if the SourceBintr was added correctly, false otherwise
+         */
+        bool AddStandbyChild(DSL_SOURCE_PTR pChildSource);
+        
+        /**
+         * @brief removes a detached child SourceBintr from the standby pool
+         * @param pChildSource shared pointer to SourceBintr to remove
+         * @return true if the SourceBintr was removed correctly, false otherwise
+         */
+        bool RemoveStandbyChild(DSL_SOURCE_PTR pChildSource);
+        
+        /**
+         * @brief checks if a SourceBintr is a member of the standby pool, 
+         * attached or detached.
+         */
+        bool IsStandbyChild(DSL_SOURCE_PTR pChildSource);
+        
+        /**
+         * @brief returns the number of detached Sources in the standby pool
+         */
+        uint GetNumStandbyChildren();
+        
+        /**
+         * @brief attaches a detached Source in the standby pool to the Stream Muxer.
+         * Once attached, the Source is a child Source like any other.
+         * @param pChildSource shared pointer to the standby SourceBintr to attach
+         * @return true if the SourceBintr was attached correctly, false otherwise
+         */
+        bool AttachStandbyChild(DSL_SOURCE_PTR pChildSource);
+        
+        /**
+         * @brief detaches an attached Source in the standby pool from the Stream
+         * Muxer, returning it to standby without stopping the Source.
+         * @param pChildSource shared pointer to the attached SourceBintr to detach
+         * @return true if the SourceBintr was detached correctly, false otherwise
+         */
+        bool DetachStandbyChild(DSL_SOURCE_PTR pChildSource);
+
         /**
          * @brief overrides the base Noder method to only return the number of 
          * child SourceBintrs and not the total number of children... 
@@ -114,6 +158,14 @@ namespace DSL
          */
         void SetStreamMuxBatchProperties(uint batchSize, uint batchTimeout);
 
+        /**
+         * @brief Updates the batch-size for the SourcesBintr's Stream Muxer in place.
+         * Unlike SetStreamMuxBatchProperties, this can be called while linked and
+         * leaves the batch-timeout, and adaptive batch-timeout controller, unchanged.
+         * @param[in] batchSize new batchSize to set
+         */
+        void UpdateStreamMuxBatchSize(uint batchSize);
+
         /**
          * @brief Gets the current dimensions for the SourcesBintr's Stream Muxer
          * @param[out] width width in pixels for the current setting
@@ -144,6 +196,60 @@ namespace DSL
          */
         void SetStreamMuxPadding(bool enabled);
 
+        /**
+         * @brief Gets the current adaptive batch-timeout settings for the Stream Muxer
+         * @param[out] enabled true if the adaptive batch-timeout controller is enabled
+         * @param[out] jitterMargin margin in microseconds added to the slowest 
+         * source's frame period
+         */
+        void GetStreamMuxBatchTimeoutAdaptive(bool* enabled, uint* jitterMargin);
+
+        /**
+         * @brief Sets the adaptive batch-timeout settings for the Stream Muxer. When
+         * enabled, the batched-push-timeout is recalculated at a fixed interval as the
+         * slowest live source's frame period plus measured jitter and jitterMargin. 
+         * The current batch-timeout property is used as the upper bound.
+         * @param[in] enabled set to true to enable the adaptive controller
+         * @param[in] jitterMargin margin in microseconds to add to the frame period
+         * @return true if the settings could be updated, false otherwise
+         */
+        bool SetStreamMuxBatchTimeoutAdaptive(bool enabled, uint jitterMargin);
+        
+        /**
+         * @brief Gets the Stream Muxer's batch-timeout currently in use, and the 
+         * batch fill ratio measured over the last update interval
+         * @param[out] batchTimeout batched-push-timeout in use in microseconds
+         * @param[out] fillRatio average frames-per-batch / batch-size, 0.0 to 1.0
+         */
+        void GetStreamMuxBatchStats(uint* batchTimeout, double* fillRatio);
+        
+        /**
+         * @brief Handles an error message posted by an Element within one of the
+         * child Sources, recording the error with the RTSP Source that owns the Element
+         * @param[in] pSrcObject the object that posted the error message
+         * @param[in] error error message to record
+         * @return true if the error was posted by one of the child RTSP Sources
+         */
+        bool HandleSourceErrorMessage(GstObject* pSrcObject, const char* error);
+        
+        /**
+         * @brief Handles a buffer arriving on one of the Stream Muxer's sink pads
+         * @param pPad the requested sink pad the buffer arrived on
+         */
+        void HandleStreamMuxSinkPadBuffer(GstPad* pPad);
+
+        /**
+         * @brief Handles a batched buffer leaving the Stream Muxer's src pad
+         * @param pBuffer batched buffer with NvDsBatchMeta
+         */
+        void HandleStreamMuxSrcPadBuffer(GstBuffer* pBuffer);
+        
+        /**
+         * @brief Handles the adaptive batch-timeout update-timer expiration
+         * @return true to continue the timer, false to stop
+         */
+        int HandleBatchTimeoutUpdate();
+
     private:
         /**
          * @brief adds a child Elementr to this PipelineSourcesBintr
@@ -158,12 +264,69 @@ namespace DSL
          */
         bool RemoveChild(DSL_BASE_PTR pChildElement);
 
+        /**
+         * @brief adds the arrival-interval probe for a Child Source to the Source's
+         * requested Stream Muxer sink pad. Source must be linked to the Stream Muxer
+         * @param pChildSource linked Child Source to meter
+         * @return true on successful add, false otherwise
+         */
+        bool AddArrivalProbe(DSL_SOURCE_PTR pChildSource);
+
+        /**
+         * @brief removes the arrival-interval probe for a Child Source if one exists
+         * @param pChildSource Child Source to stop metering
+         */
+        void RemoveArrivalProbe(DSL_SOURCE_PTR pChildSource);
+        
+        /**
+         * @brief starts the adaptive batch-timeout controller, adding all probes
+         * and the update timer. Must be called after all Sources are linked.
+         * @return true on successful start, false otherwise
+         */
+        bool StartBatchTimeoutAdaptive();
+
+        /**
+         * @brief stops the adaptive batch-timeout controller, removing all probes
+         * and the update timer, and restoring the configured batch-timeout
+         */
+        void StopBatchTimeoutAdaptive();
+
+        /**
+         * @brief adds a probe to the Source's src pad to drop all buffers while
+         * the linked Source is detached from the Stream Muxer
+         * @param pChildSource standby Source to hold
+         * @return true on successful add, false otherwise
+         */
+        bool AddStandbyProbe(DSL_SOURCE_PTR pChildSource);
+
+        /**
+         * @brief removes the standby probe for a Child Source if one exists
+         * @param pChildSource standby Source to release
+         */
+        void RemoveStandbyProbe(DSL_SOURCE_PTR pChildSource);
+        
+        /**
+         * @brief returns the lowest Source Id not in use by an attached Source
+         */
+        uint GetNextAvailableId();
+
     public:
 
         DSL_ELEMENT_PTR m_pStreamMux;
         
         std::map<std::string, DSL_SOURCE_PTR> m_pChildSources;
         
+        /**
+         * @brief map of all Sources in the standby pool, attached or detached.
+         * Attached Sources are also in m_pChildSources.
+         */
+        std::map<std::string, DSL_SOURCE_PTR> m_pStandbySources;
+        
+        /**
+         * @brief map of standby probe ids for all detached Sources, by name
+         */
+        std::map<std::string, gulong> m_standbyProbeIds;
+        
         /**
          @brief
          */
@@ -187,9 +350,101 @@ namespace DSL
          @brief
          */
         bool m_isPaddingEnabled;
+        
+        /**
+         * @brief true if the adaptive batch-timeout controller is enabled
+         */
+        bool m_isBatchTimeoutAdaptive;
+        
+        /**
+         * @brief margin in microseconds added to the slowest source's frame period
+         */
+        uint m_batchTimeoutJitterMargin;
+        
+        /**
+         * @brief batched-push-timeout currently set on the Stream Muxer, differs
+         * from m_batchTimeout when the adaptive controller is running
+         */
+        uint m_batchTimeoutInUse;
+        
+        /**
+         * @brief average frames-per-batch / batch-size over the last update interval
+         */
+        double m_batchFillRatio;
+
+        /**
+         * @brief number of batches pushed since the last update
+         */
+        uint m_batchCount;
+
+        /**
+         * @brief number of frames batched since the last update
+         */
+        uint m_batchFrameCount;
+        
+        /**
+         * @brief gsource for the adaptive batch-timeout update timer
+         */
+        GSource* m_pBatchTimeoutTimerSource;
+        
+        /**
+         * @brief probe id for the Stream Muxer src pad batch-fill probe
+         */
+        gulong m_batchFillProbeId;
+        
+        /**
+         * @brief map of Source arrival meters keyed by requested sink pad
+         */
+        std::map<GstPad*, DSL_SOURCE_ARRIVAL_METER_PTR> m_arrivalMeters;
+
+        /**
+         * @brief map of arrival-interval probe ids keyed by requested sink pad
+         */
+        std::map<GstPad*, gulong> m_arrivalProbeIds;
+        
+        /**
+         * @brief mutex to protect the adaptive batch-timeout state shared between
+         * the streaming threads and the main-loop update timer
+         */
+        GMutex m_adaptiveBatchMutex;
     };
 
-    
+    /**
+     * @brief Buffer probe callback for each of the Stream Muxer's requested sink pads
+     * @param pPad sink pad the buffer arrived on
+     * @param pInfo probe info for the buffer
+     * @param pSourcesBintr pointer to the PipelineSourcesBintr that added the probe
+     * @return GST_PAD_PROBE_OK always
+     */
+    static GstPadProbeReturn StreamMuxSinkPadProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSourcesBintr);
+
+    /**
+     * @brief Buffer probe callback for the Stream Muxer's src pad
+     * @param pPad src pad of the Stream Muxer
+     * @param pInfo probe info for the batched buffer
+     * @param pSourcesBintr pointer to the PipelineSourcesBintr that added the probe
+     * @return GST_PAD_PROBE_OK always
+     */
+    static GstPadProbeReturn StreamMuxSrcPadProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSourcesBintr);
+
+    /**
+     * @brief Timer callback to update the adaptive batch-timeout
+     * @param pSourcesBintr pointer to the PipelineSourcesBintr that started the timer
+     * @return true to continue the timer, false to stop
+     */
+    static int BatchTimeoutUpdateHandler(gpointer pSourcesBintr);
+
+    /**
+     * @brief Buffer probe callback for each detached standby Source's src pad
+     * @param pPad src pad of the standby Source
+     * @param pInfo probe info for the buffer
+     * @param pSourcesBintr pointer to the PipelineSourcesBintr that added the probe
+     * @return GST_PAD_PROBE_DROP always
+     */
+    static GstPadProbeReturn StandbySourceProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSourcesBintr);
 }
 
 #endif // _DSL_PIPELINE_SOURCES_BINTR_H
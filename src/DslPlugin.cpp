@@ -0,0 +1,135 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslPlugin.h"
+
+namespace DSL
+{
+    Plugin::Plugin(const char* name, const char* path)
+        : m_name(name)
+        , m_path(path)
+        , m_pHandle(NULL)
+        , m_pInfo(NULL)
+    {
+        LOG_FUNC();
+        
+        // Resolve all symbols now so a missing dependency fails the load
+        m_pHandle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+        if (!m_pHandle)
+        {
+            LOG_ERROR("Plugin '" << name << "' failed to load '" << path 
+                << "' with error: " << dlerror());
+            return;
+        }
+        dsl_plugin_info_get_cb infoGet = reinterpret_cast<dsl_plugin_info_get_cb>(
+            dlsym(m_pHandle, DSL_PLUGIN_INFO_SYMBOL));
+        const dsl_plugin_info* pInfo = (infoGet) ? infoGet() : NULL;
+        
+        if (!pInfo)
+        {
+            LOG_ERROR("Plugin '" << name << "' failed to get the plugin info from '" 
+                << path << "'");
+        }
+        else if (pInfo->abi_version != DSL_PLUGIN_ABI_VERSION)
+        {
+            LOG_ERROR("Plugin '" << name << "' has ABI version " << pInfo->abi_version 
+                << ", expected version " << DSL_PLUGIN_ABI_VERSION);
+        }
+        else if (!pInfo->create or !pInfo->destroy)
+        {
+            LOG_ERROR("Plugin '" << name << "' is missing its create or destroy function");
+        }
+        else
+        {
+            m_pInfo = pInfo;
+            LOG_INFO("Plugin '" << name << "' loaded from '" << path << "': " 
+                << (m_pInfo->description ? m_pInfo->description : ""));
+        }
+    }
+    
+    Plugin::~Plugin()
+    {
+        LOG_FUNC();
+        
+        if (m_pHandle)
+        {
+            dlclose(m_pHandle);
+        }
+    }
+    
+    const char* Plugin::GetName()
+    {
+        LOG_FUNC();
+        
+        return m_name.c_str();
+    }
+    
+    const dsl_plugin_info* Plugin::GetInfo()
+    {
+        LOG_FUNC();
+        
+        return m_pInfo;
+    }
+    
+    PluginInstance::PluginInstance(DSL_PLUGIN_PTR pPlugin, const char* config)
+        : m_pPlugin(pPlugin)
+        , m_pHandle(NULL)
+    {
+        LOG_FUNC();
+        
+        // A NULL handle is left for the client to check, as an invalid 
+        // config string is a client error rather than an exception
+        m_pHandle = m_pPlugin->GetInfo()->create(config);
+        if (!m_pHandle)
+        {
+            LOG_ERROR("Plugin '" << m_pPlugin->GetName() 
+                << "' failed to create an instance with config '" << config << "'");
+        }
+    }
+    
+    PluginInstance::~PluginInstance()
+    {
+        LOG_FUNC();
+        
+        if (m_pHandle)
+        {
+            m_pPlugin->GetInfo()->destroy(m_pHandle);
+        }
+    }
+    
+    const dsl_plugin_info* PluginInstance::GetInfo()
+    {
+        LOG_FUNC();
+        
+        return m_pPlugin->GetInfo();
+    }
+    
+    void* PluginInstance::GetHandle()
+    {
+        LOG_FUNC();
+        
+        return m_pHandle;
+    }
+}
@@ -0,0 +1,149 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_PLUGIN_H
+#define _DSL_PLUGIN_H
+
+#include "Dsl.h"
+#include "DslPluginApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_PLUGIN_PTR std::shared_ptr<Plugin>
+    #define DSL_PLUGIN_NEW(name, path) \
+        std::shared_ptr<Plugin>(new Plugin(name, path))
+
+    #define DSL_PLUGIN_INSTANCE_PTR std::shared_ptr<PluginInstance>
+    #define DSL_PLUGIN_INSTANCE_NEW(pPlugin, config) \
+        std::shared_ptr<PluginInstance>(new PluginInstance(pPlugin, config))
+
+    /**
+     * @class Plugin
+     * @brief Implements a native plugin loaded from a shared object. The 
+     * shared object remains loaded until the Plugin and all of its 
+     * instances have been deleted.
+     */
+    class Plugin
+    {
+    public:
+    
+        /**
+         * @brief ctor for the Plugin class. GetInfo returns NULL if the shared 
+         * object fails to load or was built against a different plugin ABI version
+         * @param[in] name unique name for the Plugin
+         * @param[in] path path to the plugin's shared object
+         */
+        Plugin(const char* name, const char* path);
+        
+        /**
+         * @brief dtor for the Plugin class
+         */
+        ~Plugin();
+        
+        /**
+         * @brief gets the name of the Plugin
+         */
+        const char* GetName();
+        
+        /**
+         * @brief gets the plugin info returned by the shared object's entry point
+         * @return plugin info, NULL if the Plugin failed to load
+         */
+        const dsl_plugin_info* GetInfo();
+        
+    private:
+    
+        /**
+         * @brief unique name for the Plugin
+         */
+        std::string m_name;
+        
+        /**
+         * @brief path to the plugin's shared object
+         */
+        std::string m_path;
+        
+        /**
+         * @brief handle returned by dlopen
+         */
+        void* m_pHandle;
+        
+        /**
+         * @brief plugin info returned by the shared object's entry point
+         */
+        const dsl_plugin_info* m_pInfo;
+    };
+    
+    /**
+     * @class PluginInstance
+     * @brief Implements an instance of a Plugin, owned by the DSL object 
+     * created from the Plugin
+     */
+    class PluginInstance
+    {
+    public:
+    
+        /**
+         * @brief ctor for the PluginInstance class. GetHandle returns 
+         * NULL if the plugin's create function fails
+         * @param[in] pPlugin shared pointer to the Plugin to create from
+         * @param[in] config opaque config string to pass to the plugin
+         */
+        PluginInstance(DSL_PLUGIN_PTR pPlugin, const char* config);
+        
+        /**
+         * @brief dtor for the PluginInstance class
+         */
+        ~PluginInstance();
+        
+        /**
+         * @brief gets the plugin info of the parent Plugin
+         */
+        const dsl_plugin_info* GetInfo();
+        
+        /**
+         * @brief gets the handle returned by the plugin's create function,
+         * to be passed as client_data to all callbacks
+         * @return plugin instance handle, NULL if create failed
+         */
+        void* GetHandle();
+        
+    private:
+    
+        /**
+         * @brief shared pointer to the parent Plugin, keeps the shared object loaded
+         */
+        DSL_PLUGIN_PTR m_pPlugin;
+        
+        /**
+         * @brief handle returned by the plugin's create function
+         */
+        void* m_pHandle;
+    };
+}
+
+#endif // _DSL_PLUGIN_H
@@ -0,0 +1,132 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_PLUGIN_API_H
+#define _DSL_PLUGIN_API_H
+
+/**
+ * C ABI for native plugins providing the callbacks of Plugin ODE Triggers, 
+ * Plugin ODE Actions, and Plugin Pad Probe Handlers. A plugin is a shared 
+ * object exporting dsl_plugin_info_get(), and is loaded by name with 
+ * dsl_plugin_load(). Each DSL object created from a plugin owns a plugin
+ * instance, created with the object's config string, and passed to all 
+ * callbacks as client_data.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <wchar.h>
+#include <sys/types.h>
+
+#include "DslApi.h"
+
+/**
+ * Version of the plugin ABI. A plugin built against a different version
+ * is rejected on load. Incremented on any change to dsl_plugin_info.
+ */
+#define DSL_PLUGIN_ABI_VERSION                                      1
+
+/**
+ * Name of the entry point exported by all plugins
+ */
+#define DSL_PLUGIN_INFO_SYMBOL                                      "dsl_plugin_info_get"
+
+EXTERN_C_BEGIN
+
+/**
+ * @brief callback typedef for a plugin's create function, called once for 
+ * each DSL object created from the plugin
+ * @param[in] config opaque config string provided on object create, never NULL
+ * @return new plugin instance, NULL on failure
+ */
+typedef void* (*dsl_plugin_create_cb)(const char* config);
+
+/**
+ * @brief callback typedef for a plugin's destroy function, called once 
+ * for each instance when its DSL object is deleted
+ * @param[in] instance plugin instance returned by the create function
+ */
+typedef void (*dsl_plugin_destroy_cb)(void* instance);
+
+/**
+ * @brief Plugin info returned by the plugin's entry point. The plugin instance
+ * is passed as client_data to all callbacks. Callbacks not supported by the 
+ * plugin are set to NULL.
+ */
+typedef struct _dsl_plugin_info
+{
+    /**
+     * @brief must be set to DSL_PLUGIN_ABI_VERSION
+     */
+    uint abi_version;
+    
+    /**
+     * @brief one line description of the plugin, for logging
+     */
+    const char* description;
+    
+    /**
+     * @brief creates a new plugin instance, required
+     */
+    dsl_plugin_create_cb create;
+    
+    /**
+     * @brief destroys a plugin instance, required
+     */
+    dsl_plugin_destroy_cb destroy;
+    
+    /**
+     * @brief ODE Trigger check-for-occurrence function
+     */
+    dsl_ode_check_for_occurrence_cb check_for_occurrence;
+    
+    /**
+     * @brief ODE Trigger post-process-frame function
+     */
+    dsl_ode_post_process_frame_cb post_process_frame;
+    
+    /**
+     * @brief ODE Action handle-occurrence function
+     */
+    dsl_ode_handle_occurrence_cb handle_occurrence;
+    
+    /**
+     * @brief Pad Probe Handler handle-buffer function
+     */
+    dsl_pph_custom_client_handler_cb handle_buffer;
+    
+} dsl_plugin_info;
+
+/**
+ * @brief entry point exported by all plugins
+ * @return pointer to the plugin's static info, valid until the plugin is unloaded
+ */
+typedef const dsl_plugin_info* (*dsl_plugin_info_get_cb)();
+
+const dsl_plugin_info* dsl_plugin_info_get();
+
+EXTERN_C_END
+
+#endif // _DSL_PLUGIN_API_H
@@ -112,6 +112,9 @@ THE SOFTWARE.
     if (!components[name]->IsType(typeid(CsiSourceBintr)) and  \
         !components[name]->IsType(typeid(UsbSourceBintr)) and  \
         !components[name]->IsType(typeid(UriSourceBintr)) and  \
+        !components[name]->IsType(typeid(PlaylistSourceBintr)) and  \
+        !components[name]->IsType(typeid(TestSourceBintr)) and  \
+        !components[name]->IsType(typeid(AppSourceBintr)) and  \
         !components[name]->IsType(typeid(RtspSourceBintr))) \
     { \
         LOG_ERROR("Component '" << name << "' is not a Source"); \
@@ -122,6 +125,7 @@ THE SOFTWARE.
 #define RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(components, name) do \
 { \
     if (!components[name]->IsType(typeid(UriSourceBintr)) and  \
+        !components[name]->IsType(typeid(PlaylistSourceBintr)) and  \
         !components[name]->IsType(typeid(RtspSourceBintr))) \
     { \
         LOG_ERROR("Component '" << name << "' is not a Decode Source"); \
@@ -132,6 +136,8 @@ THE SOFTWARE.
 #define RETURN_IF_COMPONENT_IS_NOT_ENCODE_SINK(components, name) do \
 { \
     if (!components[name]->IsType(typeid(FileSinkBintr)) and  \
+        !components[name]->IsType(typeid(SegmentSinkBintr)) and  \
+        !components[name]->IsType(typeid(SharedEncodeSinkBintr)) and  \
         !components[name]->IsType(typeid(RecordSinkBintr))) \
     { \
         LOG_ERROR("Component '" << name << "' is not a Decode Source"); \
@@ -152,7 +158,8 @@ THE SOFTWARE.
 #define RETURN_IF_COMPONENT_IS_NOT_TRACKER(components, name) do \
 { \
     if (!components[name]->IsType(typeid(KtlTrackerBintr)) and  \
-        !components[name]->IsType(typeid(IouTrackerBintr))) \
+        !components[name]->IsType(typeid(IouTrackerBintr)) and  \
+        !components[name]->IsType(typeid(CpuIouTrackerBintr))) \
     { \
         LOG_ERROR("Component '" << name << "' is not a Tracker"); \
         return DSL_RESULT_TRACKER_COMPONENT_IS_NOT_TRACKER; \
@@ -173,9 +180,13 @@ THE SOFTWARE.
 #define RETURN_IF_COMPONENT_IS_NOT_BRANCH(components, name) do \
 { \
     if (!components[name]->IsType(typeid(FakeSinkBintr)) and  \
+        !components[name]->IsType(typeid(AppSinkBintr)) and  \
+        !components[name]->IsType(typeid(MetaSinkBintr)) and  \
         !components[name]->IsType(typeid(OverlaySinkBintr)) and  \
         !components[name]->IsType(typeid(WindowSinkBintr)) and  \
         !components[name]->IsType(typeid(FileSinkBintr)) and  \
+        !components[name]->IsType(typeid(SegmentSinkBintr)) and  \
+        !components[name]->IsType(typeid(SharedEncodeSinkBintr)) and  \
         !components[name]->IsType(typeid(RecordSinkBintr)) and  \
         !components[name]->IsType(typeid(RtspSinkBintr)) and \
         !components[name]->IsType(typeid(BranchBintr)) and \
@@ -190,9 +201,13 @@ THE SOFTWARE.
 #define RETURN_IF_COMPONENT_IS_NOT_SINK(components, name) do \
 { \
     if (!components[name]->IsType(typeid(FakeSinkBintr)) and  \
+        !components[name]->IsType(typeid(AppSinkBintr)) and  \
+        !components[name]->IsType(typeid(MetaSinkBintr)) and  \
         !components[name]->IsType(typeid(OverlaySinkBintr)) and  \
         !components[name]->IsType(typeid(WindowSinkBintr)) and  \
         !components[name]->IsType(typeid(FileSinkBintr)) and  \
+        !components[name]->IsType(typeid(SegmentSinkBintr)) and  \
+        !components[name]->IsType(typeid(SharedEncodeSinkBintr)) and  \
         !components[name]->IsType(typeid(RecordSinkBintr)) and  \
         !components[name]->IsType(typeid(RtspSinkBintr))) \
     { \
@@ -201,9 +216,22 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define RETURN_IF_COMPONENT_IS_NOT_RENDER_SINK(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(OverlaySinkBintr)) and  \
+        !components[name]->IsType(typeid(WindowSinkBintr))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Render Sink"); \
+        return DSL_RESULT_SINK_COMPONENT_IS_NOT_RENDER_SINK; \
+    } \
+}while(0); 
+
 #define RETURN_IF_COMPONENT_IS_NOT_TAP(components, name) do \
 { \
-    if (!components[name]->IsType(typeid(RecordTapBintr))) \
+    if (!components[name]->IsType(typeid(RecordTapBintr)) and \
+        !components[name]->IsType(typeid(RingRecordTapBintr)) and \
+        !components[name]->IsType(typeid(FileTapBintr)) and \
+        !components[name]->IsType(typeid(RtspTapBintr))) \
     { \
         LOG_ERROR("Component '" << name << "' is not a Tap"); \
         return DSL_RESULT_TAP_COMPONENT_IS_NOT_TAP; \
@@ -248,6 +276,15 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define RETURN_IF_PLUGIN_NAME_NOT_FOUND(plugins, name) do \
+{ \
+    if (plugins.find(name) == plugins.end()) \
+    { \
+        LOG_ERROR("Plugin name '" << name << "' was not found"); \
+        return DSL_RESULT_PLUGIN_NAME_NOT_FOUND; \
+    } \
+}while(0); 
+
 
 // TODO move these defines to DSL utility file
 #define INIT_MEMORY(m) memset(&m, 0, sizeof(m));
@@ -963,6 +1000,46 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeActionPluginNew(const char* name,
+        const char* plugin, const char* config)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeActions.find(name) != m_odeActions.end())
+            {   
+                LOG_ERROR("ODE Action name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_ACTION_NAME_NOT_UNIQUE;
+            }
+            RETURN_IF_PLUGIN_NAME_NOT_FOUND(m_plugins, plugin);
+            
+            if (!m_plugins[plugin]->GetInfo()->handle_occurrence)
+            {
+                LOG_ERROR("Plugin '" << plugin << "' does not provide an ODE Action handler");
+                return DSL_RESULT_PLUGIN_CALLBACK_NOT_FOUND;
+            }
+            DSL_PLUGIN_INSTANCE_PTR pInstance = 
+                DSL_PLUGIN_INSTANCE_NEW(m_plugins[plugin], config);
+            if (!pInstance->GetHandle())
+            {
+                return DSL_RESULT_PLUGIN_CREATE_FAILED;
+            }
+            m_odeActions[name] = DSL_ODE_ACTION_PLUGIN_NEW(name, pInstance);
+
+            LOG_INFO("New ODE Plugin Action '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New ODE Plugin Action '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeActionCaptureFrameNew(const char* name,
         const char* outdir, boolean annotate)
     {
@@ -2180,6 +2257,48 @@ namespace DSL
         }
     }
             
+    DslReturnType Services::OdeTriggerPluginNew(const char* name, const char* source, 
+        uint classId, uint limit, const char* plugin, const char* config)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            RETURN_IF_PLUGIN_NAME_NOT_FOUND(m_plugins, plugin);
+            
+            const dsl_plugin_info* pInfo = m_plugins[plugin]->GetInfo();
+            if (!pInfo->check_for_occurrence and !pInfo->post_process_frame)
+            {
+                LOG_ERROR("Plugin '" << plugin << "' does not provide an ODE Trigger checker");
+                return DSL_RESULT_PLUGIN_CALLBACK_NOT_FOUND;
+            }
+            DSL_PLUGIN_INSTANCE_PTR pInstance = 
+                DSL_PLUGIN_INSTANCE_NEW(m_plugins[plugin], config);
+            if (!pInstance->GetHandle())
+            {
+                return DSL_RESULT_PLUGIN_CREATE_FAILED;
+            }
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_PLUGIN_NEW(name, source,
+                classId, limit, pInstance);
+            
+            LOG_INFO("New Plugin ODE Trigger '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Plugin ODE Trigger '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+            
     DslReturnType Services::OdeTriggerMinimumNew(const char* name, const char* source, 
         uint classId, uint limit, uint minimum)
     {
@@ -2963,6 +3082,46 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::PphPluginNew(const char* name,
+        const char* plugin, const char* config)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure handler name uniqueness 
+            if (m_padProbeHandlers.find(name) != m_padProbeHandlers.end())
+            {   
+                LOG_ERROR("Plugin Pad Probe Handler name '" << name << "' is not unique");
+                return DSL_RESULT_PPH_NAME_NOT_UNIQUE;
+            }
+            RETURN_IF_PLUGIN_NAME_NOT_FOUND(m_plugins, plugin);
+            
+            if (!m_plugins[plugin]->GetInfo()->handle_buffer)
+            {
+                LOG_ERROR("Plugin '" << plugin << "' does not provide a Pad Probe Handler");
+                return DSL_RESULT_PLUGIN_CALLBACK_NOT_FOUND;
+            }
+            DSL_PLUGIN_INSTANCE_PTR pInstance = 
+                DSL_PLUGIN_INSTANCE_NEW(m_plugins[plugin], config);
+            if (!pInstance->GetHandle())
+            {
+                return DSL_RESULT_PLUGIN_CREATE_FAILED;
+            }
+            m_padProbeHandlers[name] = DSL_PPH_PLUGIN_NEW(name, pInstance);
+
+            LOG_INFO("New Plugin Pad Probe Handler '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Plugin Pad Probe Handler '" << name << "' threw exception on create");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::PphMeterNew(const char* name, uint interval, 
         dsl_pph_meter_client_handler_cb clientHandler, void* clientData)
     {
@@ -3416,7 +3575,40 @@ namespace DSL
         }
     }
 
-    DslReturnType Services::SourceDimensionsGet(const char* name, uint* width, uint* height)
+    DslReturnType Services::SourceTestNew(const char* name, boolean isLive, uint pattern,
+        uint width, uint height, uint fps_n, uint fps_d, uint numFrames)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Source name '" << name << "' is not unique");
+                return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+            }
+            if (pattern > DSL_TEST_PATTERN_COLORS)
+            {
+                LOG_ERROR("Invalid pattern '" << pattern << "' for Test Source '" << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            m_components[name] = DSL_TEST_SOURCE_NEW(name, 
+                isLive, pattern, width, height, fps_n, fps_d, numFrames);
+
+            LOG_INFO("New Test Source '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Test Source '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceTestPatternGet(const char* name, uint* pattern)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -3424,72 +3616,85 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TestSourceBintr);
             
-            DSL_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
+            DSL_TEST_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<TestSourceBintr>(m_components[name]);
          
-            pSourceBintr->GetDimensions(width, height);
+            *pattern = pSourceBintr->GetPattern();
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception getting dimensions");
+            LOG_ERROR("Test Source '" << name << "' threw exception getting pattern");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }                
-    
-    DslReturnType Services::SourceFrameRateGet(const char* name, uint* fps_n, uint* fps_d)
+
+    DslReturnType Services::SourceTestPatternSet(const char* name, uint pattern)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TestSourceBintr);
             
-            DSL_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
+            DSL_TEST_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<TestSourceBintr>(m_components[name]);
          
-            pSourceBintr->GetFrameRate(fps_n, fps_d);
-            
+            if (!pSourceBintr->SetPattern(pattern))
+            {
+                LOG_ERROR("Test Source '" << name << "' failed to set pattern");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception getting dimensions");
+            LOG_ERROR("Test Source '" << name << "' threw exception setting pattern");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
-    }
-    
-    DslReturnType Services::SourceDecodeUriGet(const char* name, const char** uri)
+    }                
+
+    DslReturnType Services::SourceAppNew(const char* name, boolean isLive, uint format,
+        uint width, uint height, uint fps_n, uint fps_d)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Source name '" << name << "' is not unique");
+                return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+            }
+            if (format > DSL_VIDEO_FORMAT_RGBA)
+            {
+                LOG_ERROR("Invalid video format '" << format << "' for App Source '" << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            m_components[name] = DSL_APP_SOURCE_NEW(name, 
+                isLive, format, width, height, fps_n, fps_d);
 
-            DSL_DECODE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+            LOG_INFO("New App Source '" << name << "' created successfully");
 
-            *uri = pSourceBintr->GetUri();
-            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
+            LOG_ERROR("New App Source '" << name << "' threw exception on create");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-            
 
-    DslReturnType Services::SourceDecodeUriSet(const char* name, const char* uri)
+    DslReturnType Services::SourceAppDataHandlersAdd(const char* name, 
+        dsl_source_app_need_data_handler_cb needDataHandler, 
+        dsl_source_app_enough_data_handler_cb enoughDataHandler, void* clientData)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -3497,26 +3702,28 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, AppSourceBintr);
 
-            DSL_DECODE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
 
-            if (!pSourceBintr->SetUri(uri));
+            if (!pSourceBintr->AddDataHandlers(needDataHandler, enoughDataHandler, clientData))
             {
-                LOG_ERROR("Failed to Set URI '" << uri << "' for Decode Source '" << name << "'");
-                return DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED;
+                LOG_ERROR("App Source '" << name << "' failed to add data handlers");
+                return DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED;
             }
+            LOG_INFO("App Source '" << name << "' added data handlers successfully");
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
+            LOG_ERROR("App Source '" << name << "' threw exception adding data handlers");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SourceDecodeDewarperAdd(const char* name, const char* dewarper)
+    DslReturnType Services::SourceAppDataHandlersRemove(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -3524,97 +3731,94 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, dewarper);
-            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, dewarper, DewarperBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, AppSourceBintr);
 
-            DSL_DECODE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
-         
-            DSL_DEWARPER_PTR pDewarperBintr = 
-                std::dynamic_pointer_cast<DewarperBintr>(m_components[dewarper]);
-         
-            if (!pSourceBintr->AddDewarperBintr(pDewarperBintr))
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->RemoveDataHandlers())
             {
-                LOG_ERROR("Failed to add Dewarper '" << dewarper << "' to Decode Source '" << name << "'");
-                return DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED;
+                LOG_ERROR("App Source '" << name << "' failed to remove data handlers");
+                return DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED;
             }
+            LOG_INFO("App Source '" << name << "' removed data handlers successfully");
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
+            LOG_ERROR("App Source '" << name << "' threw exception removing data handlers");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::SourceDecodeDewarperRemove(const char* name)
+
+    DslReturnType Services::SourceAppBufferPush(const char* name, void* data, uint size,
+        uint64_t pts, uint64_t duration, dsl_source_app_buffer_release_cb release, 
+        void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+            DSL_APP_SOURCE_PTR pSourceBintr;
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+                
+                RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+                RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, AppSourceBintr);
 
-            DSL_DECODE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
-         
-            if (!pSourceBintr->RemoveDewarperBintr())
+                pSourceBintr = std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+            }
+            // Push unlocked. appsrc can call the client's enough-data handler from 
+            // within the push, and clients push from the need-data handler on the 
+            // streaming thread that dsl_pipeline_stop waits on with the mutex held.
+            if (!pSourceBintr->PushBuffer(data, size, pts, duration, release, clientData))
             {
-                LOG_ERROR("Failed to remove Dewarper from Decode Source '" << name << "'");
-                return DSL_RESULT_SOURCE_DEWARPER_REMOVE_FAILED;
+                LOG_ERROR("App Source '" << name << "' failed to push buffer");
+                return DSL_RESULT_SOURCE_BUFFER_PUSH_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception removing Dewarper");
+            LOG_ERROR("App Source '" << name << "' threw exception pushing buffer");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::SourceRtspTapAdd(const char* name, const char* tap)
+
+    DslReturnType Services::SourceAppEos(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tap);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
-            RETURN_IF_COMPONENT_IS_NOT_TAP(m_components, tap);
-
-            DSL_RTSP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
-                
-            if (pSourceBintr->IsLinked())
+            DSL_APP_SOURCE_PTR pSourceBintr;
             {
-                LOG_ERROR("Can not add Tap '" << tap << "' to RTSP Source '" << name << 
-                    "' as the Source is in a linked state");
-                return DSL_RESULT_SOURCE_TAP_ADD_FAILED;
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+                
+                RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+                RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, AppSourceBintr);
+
+                pSourceBintr = std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
             }
-         
-            DSL_TAP_PTR pTapBintr = 
-                std::dynamic_pointer_cast<TapBintr>(m_components[tap]);
-         
-            if (!pSourceBintr->AddTapBintr(pTapBintr))
+            // Unlocked for the same reason as SourceAppBufferPush
+            if (!pSourceBintr->Eos())
             {
-                LOG_ERROR("Failed to add Tap '" << tap << "' to RTSP Source '" << name << "'");
-                return DSL_RESULT_SOURCE_TAP_ADD_FAILED;
+                LOG_ERROR("App Source '" << name << "' failed to signal end-of-stream");
+                return DSL_RESULT_SOURCE_BUFFER_PUSH_FAILED;
             }
+            LOG_INFO("App Source '" << name << "' signaled end-of-stream successfully");
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception adding Tap");
+            LOG_ERROR("App Source '" << name << "' threw exception signaling end-of-stream");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::SourceRtspTapRemove(const char* name)
+
+    DslReturnType Services::SourceAppMaxLevelBytesGet(const char* name, uint64_t* maxBytes)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -3622,162 +3826,141 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, AppSourceBintr);
 
-            DSL_RTSP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
-         
-            if (pSourceBintr->IsLinked())
-            {
-                LOG_ERROR("Can not remove Tap from RTSP Source '" << name << 
-                    "' as the Source is in a linked state");
-                return DSL_RESULT_SOURCE_TAP_ADD_FAILED;
-            }
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            *maxBytes = pSourceBintr->GetMaxLevelBytes();
 
-            if (!pSourceBintr->RemoveTapBintr())
-            {
-                LOG_ERROR("Failed to remove Tap from RTSP Source '" << name << "'");
-                return DSL_RESULT_SOURCE_TAP_REMOVE_FAILED;
-            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception removing Tap");
+            LOG_ERROR("App Source '" << name << "' threw exception getting max level bytes");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::SourceNameGet(int sourceId, const char** name)
+
+    DslReturnType Services::SourceAppMaxLevelBytesSet(const char* name, uint64_t maxBytes)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (m_sourceNames.find(sourceId) != m_sourceNames.end())
+
+        try
         {
-            *name = m_sourceNames[sourceId].c_str();
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->SetMaxLevelBytes(maxBytes))
+            {
+                LOG_ERROR("App Source '" << name << "' failed to set max level bytes");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
             return DSL_RESULT_SUCCESS;
         }
-        *name = NULL;
-        return DSL_RESULT_SOURCE_NOT_FOUND;
-    }
-
-    DslReturnType Services::SourceIdGet(const char* name, int* sourceId)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (m_sourceIds.find(name) != m_sourceIds.end())
+        catch(...)
         {
-            *sourceId = m_sourceIds[name];
-            return DSL_RESULT_SUCCESS;
+            LOG_ERROR("App Source '" << name << "' threw exception setting max level bytes");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
-        *sourceId = -1;
-        return DSL_RESULT_SOURCE_NOT_FOUND;
     }
 
-    DslReturnType Services::_sourceNameSet(uint sourceId, const char* name)
-    {
-        LOG_FUNC();
-        
-        // called internally, do not lock mutex
-        
-        m_sourceNames[sourceId] = name;
-        m_sourceIds[name] = sourceId;
-        return DSL_RESULT_SUCCESS;
-    }
-
-    DslReturnType Services::_sourceNameErase(uint sourceId)
+    DslReturnType Services::SourcePlaylistNew(const char* name, const char** files, 
+        boolean repeatEnabled, uint cudadecMemType, uint intraDecode, uint dropFrameInterval)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
-        // called internally, do not lock mutex
-        
-        if (m_sourceNames.find(sourceId) != m_sourceNames.end())
+        try
         {
-            m_sourceIds.erase(m_sourceNames[sourceId]);
-            m_sourceNames.erase(sourceId);
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Source name '" << name << "' is not unique");
+                return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+            }
+            if (!*files)
+            {
+                LOG_ERROR("Playlist for Source '" << name << "' is empty");
+                return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+            }
+            for (const char** file = files; *file; file++)
+            {
+                std::ifstream streamFile(*file);
+                if (!streamFile.good())
+                {
+                    LOG_ERROR("Playlist file '" << *file << "' Not found");
+                    return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+                }
+            }
+            m_components[name] = DSL_PLAYLIST_SOURCE_NEW(
+                name, files, repeatEnabled, cudadecMemType, intraDecode, dropFrameInterval);
+
+            LOG_INFO("New Playlist Source '" << name << "' created successfully");
+
             return DSL_RESULT_SUCCESS;
         }
-        return DSL_RESULT_SOURCE_NOT_FOUND;
+        catch(...)
+        {
+            LOG_ERROR("New Playlist Source '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
     }
 
-    DslReturnType Services::SourcePause(const char* name)
+    DslReturnType Services::SourcePlaylistIndexGet(const char* name, uint* index, uint* size)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PlaylistSourceBintr);
+            
+            DSL_PLAYLIST_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<PlaylistSourceBintr>(m_components[name]);
+         
+            *index = pSourceBintr->GetIndex();
+            *size = pSourceBintr->GetSize();
 
-            DSL_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
-                
-            if (!pSourceBintr->IsInUse())
-            {
-                LOG_ERROR("Source '" << name << "' can not be paused - is not in use");
-                return DSL_RESULT_SOURCE_NOT_IN_USE;
-            }
-            if (pSourceBintr->GetState() != GST_STATE_PLAYING)
-            {
-                LOG_ERROR("Source '" << name << "' can not be paused - is not in play");
-                return DSL_RESULT_SOURCE_NOT_IN_PLAY;
-            }
-            if (!pSourceBintr->SetState(GST_STATE_PAUSED))
-            {
-                LOG_ERROR("Source '" << name << "' failed to change state to paused");
-                return DSL_RESULT_SOURCE_FAILED_TO_CHANGE_STATE;
-            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Component '" << name << "' threw exception on pause");
+            LOG_ERROR("Playlist Source '" << name << "' threw exception getting index");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
-    }
+    }                
 
-    DslReturnType Services::SourceResume(const char* name)
+    DslReturnType Services::SourceDimensionsGet(const char* name, uint* width, uint* height)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
             RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
-
+            
             DSL_SOURCE_PTR pSourceBintr = 
                 std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
-                
-            if (!pSourceBintr->IsInUse())
-            {
-                LOG_ERROR("Source '" << name << "' can not be resumed - is not in use");
-                return DSL_RESULT_SOURCE_NOT_IN_USE;
-            }
-            if (pSourceBintr->GetState() != GST_STATE_PAUSED)
-            {
-                LOG_ERROR("Source '" << name << "' can not be resumed - is not in pause");
-                return DSL_RESULT_SOURCE_NOT_IN_PAUSE;
-            }
+         
+            pSourceBintr->GetDimensions(width, height);
 
-            if (!pSourceBintr->SetState(GST_STATE_PLAYING))
-            {
-                LOG_ERROR("Source '" << name << "' failed to change state to play");
-                return DSL_RESULT_SOURCE_FAILED_TO_CHANGE_STATE;
-            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Component '" << name << "' threw exception on pause");
+            LOG_ERROR("Source '" << name << "' threw exception getting dimensions");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
-    }
-        
-    boolean Services::SourceIsLive(const char* name)
+    }                
+    
+    DslReturnType Services::SourceFrameRateGet(const char* name, uint* fps_n, uint* fps_d)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -3786,136 +3969,98 @@ namespace DSL
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
             RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
-
-            return std::dynamic_pointer_cast<SourceBintr>(m_components[name])->IsLive();
+            
+            DSL_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
+         
+            pSourceBintr->GetFrameRate(fps_n, fps_d);
+            
+            return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Component '" << name << "' threw exception on create");
+            LOG_ERROR("Source '" << name << "' threw exception getting dimensions");
             return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
     
-    uint Services::SourceNumInUseGet()
+    DslReturnType Services::SourceDecodeUriGet(const char* name, const char** uri)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
-        uint numInUse(0);
-        
-        for (auto const& imap: m_pipelines)
+        try
         {
-            numInUse += imap.second->GetNumSourcesInUse();
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+
+            *uri = pSourceBintr->GetUri();
+            
+            return DSL_RESULT_SUCCESS;
         }
-        return numInUse;
-    }
-    
-    uint Services::SourceNumInUseMaxGet()
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        return m_sourceNumInUseMax;
-    }
-    
-    boolean Services::SourceNumInUseMaxSet(uint max)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        uint numInUse(0);
-        
-        if (max < GetNumSourcesInUse())
+        catch(...)
         {
-            LOG_ERROR("max setting = " << max << 
-                " is less than the current number of Sources in use = " << numInUse);
-            return false;
+            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
-        m_sourceNumInUseMax = max;
-        return true;
     }
+            
 
-    DslReturnType Services::DewarperNew(const char* name, const char* configFile)
+    DslReturnType Services::SourceDecodeUriSet(const char* name, const char* uri)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("Dewarper name '" << name << "' is not unique");
-                return DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE;
-            }
-            
-            LOG_INFO("Dewarper config file: " << configFile);
-            
-            std::ifstream ifsConfigFile(configFile);
-            if (!ifsConfigFile.good())
-            {
-                LOG_ERROR("Dewarper Config File not found");
-                return DSL_RESULT_DEWARPER_CONFIG_FILE_NOT_FOUND;
-            }
-
-            m_components[name] = DSL_DEWARPER_NEW(name, configFile);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
 
-            LOG_INFO("New Dewarper '" << name << "' created successfully");
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
 
+            if (!pSourceBintr->SetUri(uri));
+            {
+                LOG_ERROR("Failed to Set URI '" << uri << "' for Decode Source '" << name << "'");
+                return DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED;
+            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Dewarper '" << name << "' threw exception on create");
-            return DSL_RESULT_DEWARPER_THREW_EXCEPTION;
+            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TapRecordNew(const char* name, const char* outdir, uint container, 
-        dsl_record_client_listner_cb clientListener)
+    DslReturnType Services::SourceDecodeRepeatEnabledGet(const char* name, boolean* enabled)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
-            struct stat info;
-
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("Tap name '" << name << "' is not unique");
-                return DSL_RESULT_TAP_NAME_NOT_UNIQUE;
-            }
-            // ensure outdir exists
-            if ((stat(outdir, &info) != 0) or !(info.st_mode & S_IFDIR))
-            {
-                LOG_ERROR("Unable to access outdir '" << outdir << "' for Record Tape '" << name << "'");
-                return DSL_RESULT_TAP_FILE_PATH_NOT_FOUND;
-            }
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
 
-            if (container > DSL_CONTAINER_MKV)
-            {   
-                LOG_ERROR("Invalid Container value = " << container << " for File Tap '" << name << "'");
-                return DSL_RESULT_TAP_CONTAINER_VALUE_INVALID;
-            }
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
 
-            m_components[name] = DSL_RECORD_TAP_NEW(name, outdir, 
-                container, (NvDsSRCallbackFunc)clientListener);
+            *enabled = pSourceBintr->GetRepeatEnabled();
             
-            LOG_INFO("New Record Tap '" << name << "' created successfully");
-
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Record Tap '" << name << "' threw exception on create");
-            return DSL_RESULT_TAP_THREW_EXCEPTION;
+            LOG_ERROR("Source '" << name << "' threw exception getting repeat enabled");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TapRecordSessionStart(const char* name, 
-        uint* session, uint start, uint duration, void* clientData)
+    DslReturnType Services::SourceDecodeRepeatEnabledSet(const char* name, boolean enabled)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -3923,26 +4068,26 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
 
-            DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
 
-            if (!pRecordTapBintr->StartSession(session, start, duration, clientData))
+            if (!pSourceBintr->SetRepeatEnabled(enabled))
             {
-                LOG_ERROR("Record Tap '" << name << "' failed to Start Session");
-                return DSL_RESULT_TAP_SET_FAILED;
+                LOG_ERROR("Failed to set repeat enabled for Decode Source '" << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Tap'" << name << "' threw an exception Starting Session");
-            return DSL_RESULT_TAP_THREW_EXCEPTION;
+            LOG_ERROR("Source '" << name << "' threw exception setting repeat enabled");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TapRecordSessionStop(const char* name, uint session)
+    DslReturnType Services::SourceDecodeDewarperAdd(const char* name, const char* dewarper)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -3950,26 +4095,31 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, dewarper);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, dewarper, DewarperBintr);
 
-            DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
-
-            if (!pRecordTapBintr->StopSession(session))
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+         
+            DSL_DEWARPER_PTR pDewarperBintr = 
+                std::dynamic_pointer_cast<DewarperBintr>(m_components[dewarper]);
+         
+            if (!pSourceBintr->AddDewarperBintr(pDewarperBintr))
             {
-                LOG_ERROR("Record Tap '" << name << "' failed to Stop Session");
-                return DSL_RESULT_TAP_SET_FAILED;
+                LOG_ERROR("Failed to add Dewarper '" << dewarper << "' to Decode Source '" << name << "'");
+                return DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Tap'" << name << "' threw an exception setting Stoping Session");
-            return DSL_RESULT_TAP_THREW_EXCEPTION;
+            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-
-    DslReturnType Services::TapRecordCacheSizeGet(const char* name, uint* cacheSize)
+    
+    DslReturnType Services::SourceDecodeDewarperRemove(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -3977,24 +4127,26 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
-
-            DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            *cacheSize = pRecordTapBintr->GetCacheSize();
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
 
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+         
+            if (!pSourceBintr->RemoveDewarperBintr())
+            {
+                LOG_ERROR("Failed to remove Dewarper from Decode Source '" << name << "'");
+                return DSL_RESULT_SOURCE_DEWARPER_REMOVE_FAILED;
+            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Tap '" << name << "' threw an exception getting Cache Size");
-            return DSL_RESULT_TAP_THREW_EXCEPTION;
+            LOG_ERROR("Source '" << name << "' threw exception removing Dewarper");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-
-    DslReturnType Services::TapRecordCacheSizeSet(const char* name, uint cacheSize)
+    
+    DslReturnType Services::SourceRtspTapAdd(const char* name, const char* tap)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -4002,27 +4154,38 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
-
-            DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tap);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
+            RETURN_IF_COMPONENT_IS_NOT_TAP(m_components, tap);
 
-            // TODO verify args before calling
-            if (!pRecordTapBintr->SetCacheSize(cacheSize))
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+                
+            if (pSourceBintr->IsLinked())
             {
-                LOG_ERROR("Record Tap '" << name << "' failed to set cache size");
-                return DSL_RESULT_TAP_SET_FAILED;
+                LOG_ERROR("Can not add Tap '" << tap << "' to RTSP Source '" << name << 
+                    "' as the Source is in a linked state");
+                return DSL_RESULT_SOURCE_TAP_ADD_FAILED;
+            }
+         
+            DSL_TAP_PTR pTapBintr = 
+                std::dynamic_pointer_cast<TapBintr>(m_components[tap]);
+         
+            if (!pSourceBintr->AddTapBintr(pTapBintr))
+            {
+                LOG_ERROR("Failed to add Tap '" << tap << "' to RTSP Source '" << name << "'");
+                return DSL_RESULT_SOURCE_TAP_ADD_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Tap '" << name << "' threw an exception setting cache size");
-            return DSL_RESULT_TAP_THREW_EXCEPTION;
+            LOG_ERROR("Source '" << name << "' threw exception adding Tap");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-        
-    DslReturnType Services::TapRecordDimensionsGet(const char* name, uint* width, uint* height)
+    
+    DslReturnType Services::SourceRtspTapRemove(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -4030,53 +4193,60 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
-
-            DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
 
-            // TODO verify args before calling
-            pRecordTapBintr->GetDimensions(width, height);
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+         
+            if (pSourceBintr->IsLinked())
+            {
+                LOG_ERROR("Can not remove Tap from RTSP Source '" << name << 
+                    "' as the Source is in a linked state");
+                return DSL_RESULT_SOURCE_TAP_ADD_FAILED;
+            }
 
+            if (!pSourceBintr->RemoveTapBintr())
+            {
+                LOG_ERROR("Failed to remove Tap from RTSP Source '" << name << "'");
+                return DSL_RESULT_SOURCE_TAP_REMOVE_FAILED;
+            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Tap '" << name << "' threw an exception getting dimensions");
-            return DSL_RESULT_TAP_THREW_EXCEPTION;
+            LOG_ERROR("Source '" << name << "' threw exception removing Tap");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-
-    DslReturnType Services::TapRecordDimensionsSet(const char* name, uint width, uint height)
+    
+    DslReturnType Services::SourceRtspTimeoutGet(const char* name, uint* timeout)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
 
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
 
-            DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+            *timeout = pSourceBintr->GetBufferTimeout();
 
-            // TODO verify args before calling
-            if (!pRecordTapBintr->SetDimensions(width, height))
-            {
-                LOG_ERROR("Record Tap '" << name << "' failed to set dimensions");
-                return DSL_RESULT_TAP_SET_FAILED;
-            }
+            LOG_INFO("RTSP Source '" << name << "' returned Timeout = " 
+                << *timeout << " successfully");
+            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Tap '" << name << "' threw an exception setting dimensions");
-            return DSL_RESULT_TAP_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Source '" << name << "' threw exception getting Timeout");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TapRecordIsOnGet(const char* name, boolean* isOn)
+    DslReturnType Services::SourceRtspTimeoutSet(const char* name, uint timeout)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -4084,23 +4254,27 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
 
-            DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
 
-            *isOn = pRecordTapBintr->IsOn();
+            pSourceBintr->SetBufferTimeout(timeout);
 
+            LOG_INFO("RTSP Source '" << name << "' set Timeout = " 
+                << timeout << " successfully");
+            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Tap '" << name << "' threw an exception getting is-recording-on flag");
-            return DSL_RESULT_TAP_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Source '" << name << "' threw exception setting Timeout");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TapRecordResetDoneGet(const char* name, boolean* resetDone)
+    DslReturnType Services::SourceRtspReconnectionParamsGet(const char* name, 
+        uint* backoffMin, uint* backoffMax)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -4108,190 +4282,144 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
 
-            DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
 
-            *resetDone = pRecordTapBintr->ResetDone();
+            pSourceBintr->GetReconnectionParams(backoffMin, backoffMax);
 
+            LOG_INFO("RTSP Source '" << name << "' returned Reconnection Params min = " 
+                << *backoffMin << ", max = " << *backoffMax << " successfully");
+            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Tap '" << name << "' threw an exception getting reset done flag");
-            return DSL_RESULT_TAP_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Source '" << name << "' threw exception getting Reconnection Params");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::PrimaryGieNew(const char* name, const char* inferConfigFile,
-        const char* modelEngineFile, uint interval)
+
+    DslReturnType Services::SourceRtspReconnectionParamsSet(const char* name, 
+        uint backoffMin, uint backoffMax)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("GIE name '" << name << "' is not unique");
-                return DSL_RESULT_GIE_NAME_NOT_UNIQUE;
-            }
-            
-            LOG_INFO("Infer config file: " << inferConfigFile);
-            
-            std::ifstream configFile(inferConfigFile);
-            if (!configFile.good())
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
+
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->SetReconnectionParams(backoffMin, backoffMax))
             {
-                LOG_ERROR("Infer Config File not found");
-                return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
+                LOG_ERROR("RTSP Source '" << name << "' failed to set Reconnection Params");
+                return DSL_RESULT_SOURCE_SET_FAILED;
             }
+            LOG_INFO("RTSP Source '" << name << "' set Reconnection Params min = " 
+                << backoffMin << ", max = " << backoffMax << " successfully");
             
-            std::string testPath(modelEngineFile);
-            if (testPath.size())
-            {
-                LOG_INFO("Model engine file: " << modelEngineFile);
-                
-                std::ifstream modelFile(modelEngineFile);
-                if (!modelFile.good())
-                {
-                    LOG_ERROR("Model Engine File not found");
-                    return DSL_RESULT_GIE_MODEL_FILE_NOT_FOUND;
-                }
-            }
-            m_components[name] = DSL_PRIMARY_GIE_NEW(name, 
-                inferConfigFile, modelEngineFile, interval);
-            LOG_INFO("New Primary GIE '" << name << "' created successfully");
-
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Primary GIE '" << name << "' threw exception on create");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Source '" << name << "' threw exception setting Reconnection Params");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::PrimaryGiePphAdd(const char* name, const char* handler, uint pad)
+    DslReturnType Services::SourceRtspConnectionDataGet(const char* name, 
+        uint* state, uint* reconnectCount, std::string& lastError)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
-            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
 
-            if (pad > DSL_PAD_SRC)
-            {
-                LOG_ERROR("Invalid Pad type = " << pad << " for PrimaryGie '" << name << "'");
-                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
-            }
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
 
-            // call on the Handler to add itself to the Tiler as a PadProbeHandler
-            if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], pad))
-            {
-                LOG_ERROR("Primary GIE '" << name << "' failed to add Pad Probe Handler");
-                return DSL_RESULT_GIE_HANDLER_ADD_FAILED;
-            }
+            pSourceBintr->GetConnectionData(state, reconnectCount, lastError);
+
+            LOG_INFO("RTSP Source '" << name << "' returned Connection Data state = " 
+                << *state << ", reconnect count = " << *reconnectCount << " successfully");
+            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Primary GIE '" << name << "' threw an exception adding Pad Probe Handler");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Source '" << name << "' threw exception getting Connection Data");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-   
-    DslReturnType Services::PrimaryGiePphRemove(const char* name, const char* handler, uint pad) 
+
+    DslReturnType Services::SourceRtspConnectionStatsClear(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
-            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
 
-            if (pad > DSL_PAD_SRC)
-            {
-                LOG_ERROR("Invalid Pad type = " << pad << " for Primary GIE '" << name << "'");
-                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
-            }
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
 
-            // call on the Handler to remove itself from the PrimaryGie
-            if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], pad))
-            {
-                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of Primary GIE '" << name << "'");
-                return DSL_RESULT_GIE_HANDLER_REMOVE_FAILED;
-            }
+            pSourceBintr->ClearConnectionStats();
+
+            LOG_INFO("RTSP Source '" << name << "' cleared Connection Stats successfully");
+            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Primary GIE '" << name << "' threw an exception removing Pad Probe Handler");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Source '" << name << "' threw exception clearing Connection Stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SecondaryGieNew(const char* name, const char* inferConfigFile,
-        const char* modelEngineFile, const char* inferOnGieName, uint interval)
+    DslReturnType Services::SourceRtspStateChangeListenerAdd(const char* name, 
+        dsl_rtsp_connection_state_change_listener_cb listener, void* userdata)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("GIE name '" << name << "' is not unique");
-                return DSL_RESULT_GIE_NAME_NOT_UNIQUE;
-            }
-            
-            LOG_INFO("Infer config file: " << inferConfigFile);
-            
-            std::ifstream configFile(inferConfigFile);
-            if (!configFile.good())
-            {
-                LOG_ERROR("Infer Config File not found");
-                return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
-            }
-            
-            LOG_INFO("Model engine file: " << modelEngineFile);
-            
-            std::string testPath(modelEngineFile);
-            if (testPath.size())
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
+
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->AddStateChangeListener(listener, userdata))
             {
-                LOG_INFO("Model engine file: " << modelEngineFile);
-                
-                std::ifstream modelFile(modelEngineFile);
-                if (!modelFile.good())
-                {
-                    LOG_ERROR("Model Engine File not found");
-                    return DSL_RESULT_GIE_MODEL_FILE_NOT_FOUND;
-                }
+                LOG_ERROR("RTSP Source '" << name 
+                    << "' failed to add a State Change Listener");
+                return DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED;
             }
-            m_components[name] = DSL_SECONDARY_GIE_NEW(name, 
-                inferConfigFile, modelEngineFile, inferOnGieName, interval);
-
-            LOG_INFO("New Secondary GIE '" << name << "' created successfully");
+            LOG_INFO("RTSP Source '" << name 
+                << "' added State Change Listener successfully");
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Primary GIE '" << name << "' threw exception on create");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Source '" << name << "' threw exception adding State Change Listener");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::GieRawOutputEnabledSet(const char* name, boolean enabled,
-        const char* path)
+    DslReturnType Services::SourceRtspStateChangeListenerRemove(const char* name, 
+        dsl_rtsp_connection_state_change_listener_cb listener)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -4299,637 +4427,603 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
-                
-            if (!pGieBintr->SetRawOutputEnabled(enabled, path))
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);
+
+            DSL_RTSP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->RemoveStateChangeListener(listener))
             {
-                LOG_ERROR("GIE '" << name << "' failed to enable raw output");
-                return DSL_RESULT_GIE_OUTPUT_DIR_DOES_NOT_EXIST;
+                LOG_ERROR("RTSP Source '" << name 
+                    << "' failed to remove a State Change Listener");
+                return DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED;
             }
+            LOG_INFO("RTSP Source '" << name 
+                << "' removed State Change Listener successfully");
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("GIE '" << name << "' threw exception on raw output enabled set");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Source '" << name << "' threw exception removing State Change Listener");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::GieInferConfigFileGet(const char* name, const char** inferConfigFile)
+    DslReturnType Services::SourceNameGet(int sourceId, const char** name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        
+        if (m_sourceNames.find(sourceId) != m_sourceNames.end())
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
-
-            *inferConfigFile = pGieBintr->GetInferConfigFile();
-            
+            *name = m_sourceNames[sourceId].c_str();
             return DSL_RESULT_SUCCESS;
         }
-        catch(...)
-        {
-            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
-        }
+        *name = NULL;
+        return DSL_RESULT_SOURCE_NOT_FOUND;
     }
 
-    DslReturnType Services::GieInferConfigFileSet(const char* name, const char* inferConfigFile)
+    DslReturnType Services::SourceIdGet(const char* name, int* sourceId)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
-        {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
-
-            if (!pGieBintr->SetInferConfigFile(inferConfigFile))
-            {
-                LOG_ERROR("GIE '" << name << "' failed to set the Infer Config file");
-                return DSL_RESULT_GIE_SET_FAILED;
-            }
-        }
-        catch(...)
+        
+        if (m_sourceIds.find(name) != m_sourceIds.end())
         {
-            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            *sourceId = m_sourceIds[name];
+            return DSL_RESULT_SUCCESS;
         }
+        *sourceId = -1;
+        return DSL_RESULT_SOURCE_NOT_FOUND;
+    }
 
+    DslReturnType Services::_sourceNameSet(uint sourceId, const char* name)
+    {
+        LOG_FUNC();
+        
+        // called internally, do not lock mutex
+        
+        m_sourceNames[sourceId] = name;
+        m_sourceIds[name] = sourceId;
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::GieModelEngineFileGet(const char* name, const char** inferConfigFile)
+    DslReturnType Services::_sourceNameErase(uint sourceId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
-        try
+        // called internally, do not lock mutex
+        
+        if (m_sourceNames.find(sourceId) != m_sourceNames.end())
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
-
-            *inferConfigFile = pGieBintr->GetModelEngineFile();
-
+            m_sourceIds.erase(m_sourceNames[sourceId]);
+            m_sourceNames.erase(sourceId);
             return DSL_RESULT_SUCCESS;
         }
-        catch(...)
-        {
-            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
-        }
+        return DSL_RESULT_SOURCE_NOT_FOUND;
     }
 
-    DslReturnType Services::GieModelEngineFileSet(const char* name, const char* inferConfigFile)
+    DslReturnType Services::SourcePause(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
 
-            if (!pGieBintr->SetModelEngineFile(inferConfigFile))
+            DSL_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
+                
+            if (!pSourceBintr->IsInUse())
             {
-                LOG_ERROR("GIE '" << name << "' failed to set the Infer Config file");
-                return DSL_RESULT_GIE_SET_FAILED;
+                LOG_ERROR("Source '" << name << "' can not be paused - is not in use");
+                return DSL_RESULT_SOURCE_NOT_IN_USE;
+            }
+            if (pSourceBintr->GetState() != GST_STATE_PLAYING)
+            {
+                LOG_ERROR("Source '" << name << "' can not be paused - is not in play");
+                return DSL_RESULT_SOURCE_NOT_IN_PLAY;
+            }
+            if (!pSourceBintr->SetState(GST_STATE_PAUSED))
+            {
+                LOG_ERROR("Source '" << name << "' failed to change state to paused");
+                return DSL_RESULT_SOURCE_FAILED_TO_CHANGE_STATE;
             }
-
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("Component '" << name << "' threw exception on pause");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::GieIntervalGet(const char* name, uint* interval)
+    DslReturnType Services::SourceResume(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
 
-            *interval = pGieBintr->GetInterval();
+            DSL_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
+                
+            if (!pSourceBintr->IsInUse())
+            {
+                LOG_ERROR("Source '" << name << "' can not be resumed - is not in use");
+                return DSL_RESULT_SOURCE_NOT_IN_USE;
+            }
+            if (pSourceBintr->GetState() != GST_STATE_PAUSED)
+            {
+                LOG_ERROR("Source '" << name << "' can not be resumed - is not in pause");
+                return DSL_RESULT_SOURCE_NOT_IN_PAUSE;
+            }
 
+            if (!pSourceBintr->SetState(GST_STATE_PLAYING))
+            {
+                LOG_ERROR("Source '" << name << "' failed to change state to play");
+                return DSL_RESULT_SOURCE_FAILED_TO_CHANGE_STATE;
+            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("GIE '" << name << "' threw an exception adding Batch Meta Handler");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("Component '" << name << "' threw exception on pause");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-
-    DslReturnType Services::GieIntervalSet(const char* name, uint interval)
+        
+    boolean Services::SourceIsLive(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
 
-            if (!pGieBintr->SetInterval(interval))
-            {
-                LOG_ERROR("GIE '" << name << "' failed to set new Interval");
-                return DSL_RESULT_GIE_SET_FAILED;
-            }
-            return DSL_RESULT_SUCCESS;
+            return std::dynamic_pointer_cast<SourceBintr>(m_components[name])->IsLive();
         }
         catch(...)
         {
-            LOG_ERROR("GIE '" << name << "' threw an exception setting Interval");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("Component '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
         }
     }
-
-    DslReturnType Services::TrackerKtlNew(const char* name, uint width, uint height)
+    
+    uint Services::SourceNumInUseGet()
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
-        try
-        {
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("KTL Tracker name '" << name << "' is not unique");
-                return DSL_RESULT_TRACKER_NAME_NOT_UNIQUE;
-            }
-            m_components[name] = std::shared_ptr<Bintr>(new KtlTrackerBintr(
-                name, width, height));
-            LOG_INFO("New KTL Tracker '" << name << "' created successfully");
-
-            return DSL_RESULT_SUCCESS;
-        }
-        catch(...)
+        uint numInUse(0);
+        
+        for (auto const& imap: m_pipelines)
         {
-            LOG_ERROR("KTL Tracker '" << name << "' threw exception on create");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            numInUse += imap.second->GetNumSourcesInUse();
         }
+        return numInUse;
     }
     
-    DslReturnType Services::TrackerIouNew(const char* name, const char* configFile, 
-        uint width, uint height)
+    uint Services::SourceNumInUseMaxGet()
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
-        {
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("IOU Tracker name '" << name << "' is not unique");
-                return DSL_RESULT_TRACKER_NAME_NOT_UNIQUE;
-            }
-            LOG_INFO("Infer config file: " << configFile);
-            
-            std::ifstream streamConfigFile(configFile);
-            if (!streamConfigFile.good())
-            {
-                LOG_ERROR("Infer Config File not found");
-                return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
-            }
-            m_components[name] = std::shared_ptr<Bintr>(new IouTrackerBintr(
-                name, configFile, width, height));
-                
-            LOG_INFO("New IOU Tracker '" << name << "' created successfully");
-
-            return DSL_RESULT_SUCCESS;
-        }
-        catch(...)
+        
+        return m_sourceNumInUseMax;
+    }
+    
+    boolean Services::SourceNumInUseMaxSet(uint max)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        uint numInUse(0);
+        
+        if (max < GetNumSourcesInUse())
         {
-            LOG_ERROR("IOU Tracker '" << name << "' threw exception on create");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("max setting = " << max << 
+                " is less than the current number of Sources in use = " << numInUse);
+            return false;
         }
+        m_sourceNumInUseMax = max;
+        return true;
     }
-   
-       DslReturnType Services::TrackerMaxDimensionsGet(const char* name, uint* width, uint* height)
+
+    DslReturnType Services::DewarperNew(const char* name, const char* configFile)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Dewarper name '" << name << "' is not unique");
+                return DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE;
+            }
+            
+            LOG_INFO("Dewarper config file: " << configFile);
+            
+            std::ifstream ifsConfigFile(configFile);
+            if (!ifsConfigFile.good())
+            {
+                LOG_ERROR("Dewarper Config File not found");
+                return DSL_RESULT_DEWARPER_CONFIG_FILE_NOT_FOUND;
+            }
 
-            DSL_TRACKER_PTR trackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+            m_components[name] = DSL_DEWARPER_NEW(name, configFile);
 
-            // TODO verify args before calling
-            trackerBintr->GetMaxDimensions(width, height);
+            LOG_INFO("New Dewarper '" << name << "' created successfully");
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tracker '" << name << "' threw an exception getting dimensions");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("New Dewarper '" << name << "' threw exception on create");
+            return DSL_RESULT_DEWARPER_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TrackerMaxDimensionsSet(const char* name, uint width, uint height)
+    DslReturnType Services::TapRecordNew(const char* name, const char* outdir, uint container, 
+        dsl_record_client_listner_cb clientListener)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            struct stat info;
 
-            if (m_components[name]->IsInUse())
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Tap name '" << name << "' is not unique");
+                return DSL_RESULT_TAP_NAME_NOT_UNIQUE;
+            }
+            // ensure outdir exists
+            if ((stat(outdir, &info) != 0) or !(info.st_mode & S_IFDIR))
             {
-                LOG_ERROR("Unable to set Max Dimensions for Tracker '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_TILER_IS_IN_USE;
+                LOG_ERROR("Unable to access outdir '" << outdir << "' for Record Tape '" << name << "'");
+                return DSL_RESULT_TAP_FILE_PATH_NOT_FOUND;
             }
 
-            DSL_TRACKER_PTR trackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            if (!trackerBintr->SetMaxDimensions(width, height))
-            {
-                LOG_ERROR("Tracker '" << name << "' failed to set dimensions");
-                return DSL_RESULT_TRACKER_SET_FAILED;
+            if (container > DSL_CONTAINER_MKV)
+            {   
+                LOG_ERROR("Invalid Container value = " << container << " for File Tap '" << name << "'");
+                return DSL_RESULT_TAP_CONTAINER_VALUE_INVALID;
             }
+
+            m_components[name] = DSL_RECORD_TAP_NEW(name, outdir, 
+                container, (NvDsSRCallbackFunc)clientListener);
+            
+            LOG_INFO("New Record Tap '" << name << "' created successfully");
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tracker '" << name << "' threw an exception setting dimensions");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("New Record Tap '" << name << "' threw exception on create");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TrackerPphAdd(const char* name, const char* handler, uint pad)
+    DslReturnType Services::TapRecordSessionStart(const char* name, 
+        uint* session, uint start, uint duration, void* clientData)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
-            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
 
-            if (pad > DSL_PAD_SRC)
-            {
-                LOG_ERROR("Invalid Pad type = " << pad << " for Tracker '" << name << "'");
-                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
-            }
+            DSL_RECORD_TAP_PTR pRecordTapBintr = 
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
 
-            // call on the Handler to add itself to the Tiler as a PadProbeHandler
-            if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], pad))
+            if (!pRecordTapBintr->StartSession(session, start, duration, clientData))
             {
-                LOG_ERROR("Tracker '" << name << "' failed to add Pad Probe Handler");
-                return DSL_RESULT_TRACKER_HANDLER_ADD_FAILED;
+                LOG_ERROR("Record Tap '" << name << "' failed to Start Session");
+                return DSL_RESULT_TAP_SET_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tracker '" << name << "' threw an exception adding Pad Probe Handler");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("Record Tap'" << name << "' threw an exception Starting Session");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
-   
-    DslReturnType Services::TrackerPphRemove(const char* name, const char* handler, uint pad) 
+
+    DslReturnType Services::TapRecordSessionStop(const char* name, uint session)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
-            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
 
-            if (pad > DSL_PAD_SRC)
-            {
-                LOG_ERROR("Invalid Pad type = " << pad << " for Tracker '" << name << "'");
-                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
-            }
+            DSL_RECORD_TAP_PTR pRecordTapBintr = 
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
 
-            // call on the Handler to remove itself from the Tracker
-            if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], pad))
+            if (!pRecordTapBintr->StopSession(session))
             {
-                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of Tracker '" << name << "'");
-                return DSL_RESULT_TRACKER_HANDLER_REMOVE_FAILED;
+                LOG_ERROR("Record Tap '" << name << "' failed to Stop Session");
+                return DSL_RESULT_TAP_SET_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tracker '" << name << "' threw an exception removing Pad Probe Handler");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("Record Tap'" << name << "' threw an exception setting Stoping Session");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
-        
-    DslReturnType Services::TeeDemuxerNew(const char* name)
+
+    DslReturnType Services::TapRecordCacheSizeGet(const char* name, uint* cacheSize)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("Demuxer Tee name '" << name << "' is not unique");
-                return DSL_RESULT_TEE_NAME_NOT_UNIQUE;
-            }
-            m_components[name] = std::shared_ptr<Bintr>(new DemuxerBintr(name));
-            
-            LOG_INFO("New Demuxer Tee '" << name << "' created successfully");
-            
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
+
+            DSL_RECORD_TAP_PTR pRecordTapBintr = 
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            *cacheSize = pRecordTapBintr->GetCacheSize();
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Demuxer Tee '" << name << "' threw exception on create");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Record Tap '" << name << "' threw an exception getting Cache Size");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TeeSplitterNew(const char* name)
+    DslReturnType Services::TapRecordCacheSizeSet(const char* name, uint cacheSize)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("Splitter Tee name '" << name << "' is not unique");
-                return DSL_RESULT_TILER_NAME_NOT_UNIQUE;
-            }
-            m_components[name] = std::shared_ptr<Bintr>(new SplitterBintr(name));
-            
-            LOG_INFO("New Splitter Tee '" << name << "' created successfully");
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
 
+            DSL_RECORD_TAP_PTR pRecordTapBintr = 
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!pRecordTapBintr->SetCacheSize(cacheSize))
+            {
+                LOG_ERROR("Record Tap '" << name << "' failed to set cache size");
+                return DSL_RESULT_TAP_SET_FAILED;
+            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Splitter Tee '" << name << "' threw exception on create");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Record Tap '" << name << "' threw an exception setting cache size");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::TeeBranchAdd(const char* tee, 
-        const char* branch)
+        
+    DslReturnType Services::TapRecordDimensionsGet(const char* name, uint* width, uint* height)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
-            RETURN_IF_COMPONENT_IS_NOT_BRANCH(m_components, branch);
-            
-            // Can't add components if they're In use by another Branch
-            if (m_components[branch]->IsInUse())
-            {
-                LOG_ERROR("Unable to add branch '" << branch 
-                    << "' as it's currently in use");
-                return DSL_RESULT_COMPONENT_IN_USE;
-            }
-            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
-                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
 
-            // Cast the Branch to a Bintr to call the correct AddChile method.
-            DSL_BINTR_PTR pBranchBintr = 
-                std::dynamic_pointer_cast<Bintr>(m_components[branch]);
+            DSL_RECORD_TAP_PTR pRecordTapBintr = 
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            pRecordTapBintr->GetDimensions(width, height);
 
-            if (!pTeeBintr->AddChild(pBranchBintr))
-            {
-                LOG_ERROR("Tee '" << tee << 
-                    "' failed to add branch '" << branch << "'");
-                return DSL_RESULT_TEE_BRANCH_ADD_FAILED;
-            }
-            LOG_INFO("Branch '" << branch 
-                << "' was added to Tee '" << tee << "' successfully");
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tee '" << tee 
-                << "' threw an exception removing branch '" << branch << "'");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Record Tap '" << name << "' threw an exception getting dimensions");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
-    }    
-    
-    DslReturnType Services::TeeBranchRemove(const char* tee, 
-        const char* branch)
+    }
+
+    DslReturnType Services::TapRecordDimensionsSet(const char* name, uint width, uint height)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
-            RETURN_IF_BRANCH_NAME_NOT_FOUND(m_components, branch);
-
-            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
-                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
 
-            if (!pTeeBintr->IsChild(m_components[branch]))
-            {
-                LOG_ERROR("Branch '" << branch << 
-                    "' is not in use by Tee '" << tee << "'");
-                return DSL_RESULT_TEE_BRANCH_IS_NOT_CHILD;
-            }
 
-            // Cast the Branch to a Bintr to call the correct AddChile method.
-            DSL_BINTR_PTR pBranchBintr = 
-                std::dynamic_pointer_cast<Bintr>(m_components[branch]);
+            DSL_RECORD_TAP_PTR pRecordTapBintr = 
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
 
-            if (!pTeeBintr->RemoveChild(pBranchBintr))
+            // TODO verify args before calling
+            if (!pRecordTapBintr->SetDimensions(width, height))
             {
-                LOG_ERROR("Tee '" << tee << 
-                    "' failed to remove branch '" << branch << "'");
-                return DSL_RESULT_TEE_BRANCH_REMOVE_FAILED;
+                LOG_ERROR("Record Tap '" << name << "' failed to set dimensions");
+                return DSL_RESULT_TAP_SET_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tee '" << tee 
-                << "' threw an exception removing branch '" << branch << "'");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Record Tap '" << name << "' threw an exception setting dimensions");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TeeBranchRemoveAll(const char* tee)
+    DslReturnType Services::TapRecordIsOnGet(const char* name, boolean* isOn)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
+
+            DSL_RECORD_TAP_PTR pRecordTapBintr = 
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+
+            *isOn = pRecordTapBintr->IsOn();
 
-            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
-                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
-                
-            // TODO WHY?
-//            m_components[tee]->RemoveAll();
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tee '" <<  tee
-                << "' threw an exception removing all branches");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Record Tap '" << name << "' threw an exception getting is-recording-on flag");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TeeBranchCountGet(const char* tee, uint* count)
+    DslReturnType Services::TapRecordResetDoneGet(const char* name, boolean* resetDone)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
 
-            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
-                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
+            DSL_RECORD_TAP_PTR pRecordTapBintr = 
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+
+            *resetDone = pRecordTapBintr->ResetDone();
 
-            *count = pTeeBintr->GetNumChildren();
-            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tee '" <<  tee
-                << "' threw an exception getting branch count");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Record Tap '" << name << "' threw an exception getting reset done flag");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
-
-    DslReturnType Services::TeePphAdd(const char* name, const char* handler)
+    
+    DslReturnType Services::TapRingRecordNew(const char* name, const char* outdir, 
+        uint container, uint64_t maxBytes, dsl_ring_record_complete_listener_cb clientListener)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, name);
-            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+            struct stat info;
 
-            // call on the Handler to add itself to the Tiler as a PadProbeHandler
-            if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], DSL_PAD_SINK))
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Tap name '" << name << "' is not unique");
+                return DSL_RESULT_TAP_NAME_NOT_UNIQUE;
+            }
+            // ensure outdir exists
+            if ((stat(outdir, &info) != 0) or !(info.st_mode & S_IFDIR))
             {
-                LOG_ERROR("Tracker '" << name << "' failed to add Pad Probe Handler");
-                return DSL_RESULT_TEE_HANDLER_ADD_FAILED;
+                LOG_ERROR("Unable to access outdir '" << outdir << "' for Ring Record Tap '" << name << "'");
+                return DSL_RESULT_TAP_FILE_PATH_NOT_FOUND;
+            }
+            if (container > DSL_CONTAINER_MKV)
+            {   
+                LOG_ERROR("Invalid Container value = " << container << " for Ring Record Tap '" << name << "'");
+                return DSL_RESULT_TAP_CONTAINER_VALUE_INVALID;
             }
+
+            m_components[name] = DSL_RING_RECORD_TAP_NEW(name, outdir, 
+                container, maxBytes, clientListener);
+            
+            LOG_INFO("New Ring Record Tap '" << name << "' created successfully");
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception adding Pad Probe Handler");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("New Ring Record Tap '" << name << "' threw exception on create");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
-   
-    DslReturnType Services::TeePphRemove(const char* name, const char* handler) 
+
+    DslReturnType Services::TapRingRecordSessionStart(const char* name, 
+        uint* session, uint preEvent, uint postEvent, void* clientData)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, name);
-            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RingRecordTapBintr);
 
-            // call on the Handler to remove itself from the Tee
-            if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], DSL_PAD_SINK))
+            DSL_RING_RECORD_TAP_PTR pRingRecordTapBintr = 
+                std::dynamic_pointer_cast<RingRecordTapBintr>(m_components[name]);
+
+            if (!pRingRecordTapBintr->StartSession(session, preEvent, postEvent, clientData))
             {
-                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of Tracker '" << name << "'");
-                return DSL_RESULT_TEE_HANDLER_REMOVE_FAILED;
+                LOG_ERROR("Ring Record Tap '" << name << "' failed to Start Session");
+                return DSL_RESULT_TAP_SET_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tee '" << name << "' threw an exception removing Pad Probe Handler");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Ring Record Tap '" << name << "' threw an exception Starting Session");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::TilerNew(const char* name, uint width, uint height)
+
+    DslReturnType Services::TapRingRecordSessionStop(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("Tiler name '" << name << "' is not unique");
-                return DSL_RESULT_TILER_NAME_NOT_UNIQUE;
-            }
-            m_components[name] = std::shared_ptr<Bintr>(new TilerBintr(
-                name, width, height));
-                
-            LOG_INFO("New Tiler '" << name << "' created successfully");
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RingRecordTapBintr);
+
+            DSL_RING_RECORD_TAP_PTR pRingRecordTapBintr = 
+                std::dynamic_pointer_cast<RingRecordTapBintr>(m_components[name]);
 
+            if (!pRingRecordTapBintr->StopSession())
+            {
+                LOG_ERROR("Ring Record Tap '" << name << "' failed to Stop Session");
+                return DSL_RESULT_TAP_SET_FAILED;
+            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Tiler'" << name << "' threw exception on create");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("Ring Record Tap '" << name << "' threw an exception Stopping Session");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TilerDimensionsGet(const char* name, uint* width, uint* height)
+    DslReturnType Services::TapRingRecordMaxBytesGet(const char* name, uint64_t* maxBytes)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -4937,53 +5031,46 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RingRecordTapBintr);
 
-            DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+            DSL_RING_RECORD_TAP_PTR pRingRecordTapBintr = 
+                std::dynamic_pointer_cast<RingRecordTapBintr>(m_components[name]);
 
-            // TODO verify args before calling
-            tilerBintr->GetDimensions(width, height);
-            
+            *maxBytes = pRingRecordTapBintr->GetMaxBytes();
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception getting dimensions");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("Ring Record Tap '" << name << "' threw an exception getting max bytes");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TilerDimensionsSet(const char* name, uint width, uint height)
+    DslReturnType Services::TapRingRecordMaxBytesSet(const char* name, uint64_t maxBytes)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RingRecordTapBintr);
 
+            DSL_RING_RECORD_TAP_PTR pRingRecordTapBintr = 
+                std::dynamic_pointer_cast<RingRecordTapBintr>(m_components[name]);
 
-            DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            if (!tilerBintr->SetDimensions(width, height))
-            {
-                LOG_ERROR("Tiler '" << name << "' failed to settin dimensions");
-                return DSL_RESULT_TILER_SET_FAILED;
-            }
+            pRingRecordTapBintr->SetMaxBytes(maxBytes);
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception setting dimensions");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("Ring Record Tap '" << name << "' threw an exception setting max bytes");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TilerTilesGet(const char* name, uint* cols, uint* rows)
+    DslReturnType Services::TapRingRecordCacheLevelGet(const char* name, 
+        uint64_t* bytes, uint* duration)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -4991,24 +5078,22 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RingRecordTapBintr);
 
-            // TODO verify args before calling
-            tilerBintr->GetTiles(cols, rows);
+            DSL_RING_RECORD_TAP_PTR pRingRecordTapBintr = 
+                std::dynamic_pointer_cast<RingRecordTapBintr>(m_components[name]);
 
+            pRingRecordTapBintr->GetCacheLevel(bytes, duration);
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception getting Tiles");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("Ring Record Tap '" << name << "' threw an exception getting cache level");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TilerTilesSet(const char* name, uint cols, uint rows)
+    DslReturnType Services::TapRingRecordIsOnGet(const char* name, boolean* isOn)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5016,107 +5101,92 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RingRecordTapBintr);
 
-            DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+            DSL_RING_RECORD_TAP_PTR pRingRecordTapBintr = 
+                std::dynamic_pointer_cast<RingRecordTapBintr>(m_components[name]);
 
-            // TODO verify args before calling
-            if (!tilerBintr->SetTiles(cols, rows))
-            {
-                LOG_ERROR("Tiler '" << name << "' failed to set Tiles");
-                return DSL_RESULT_TILER_SET_FAILED;
-            }
+            *isOn = pRingRecordTapBintr->IsOn();
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception setting Tiles");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("Ring Record Tap '" << name << "' threw an exception getting is on flag");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TilerSourceShowGet(const char* name, 
-        const char** source, uint* timeout)
+    DslReturnType Services::TapFileNew(const char* name, const char* filepath, 
+        uint codec, uint container)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
-
-            int sourceId(-1);
-            tilerBintr->GetShowSource(&sourceId, timeout);
-            
-            if (sourceId == -1)
-            {
-                *source = NULL;
-                return DSL_RESULT_SUCCESS;
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Tap name '" << name << "' is not unique");
+                return DSL_RESULT_TAP_NAME_NOT_UNIQUE;
             }
-            if (m_sourceNames.find(sourceId) == m_sourceNames.end())
-            {
-                *source = NULL;
-                LOG_ERROR("Tiler '" << name << "' failed to get Source name from Id");
-                return DSL_RESULT_SOURCE_NAME_NOT_FOUND;
+            if (codec > DSL_CODEC_MPEG4)
+            {   
+                LOG_ERROR("Invalid Codec value = " << codec << " for File Tap '" << name << "'");
+                return DSL_RESULT_TAP_CODEC_VALUE_INVALID;
             }
-            *source = m_sourceNames[sourceId].c_str();
+            if (container > DSL_CONTAINER_MKV)
+            {   
+                LOG_ERROR("Invalid Container value = " << container << " for File Tap '" << name << "'");
+                return DSL_RESULT_TAP_CONTAINER_VALUE_INVALID;
+            }
+            m_components[name] = DSL_FILE_TAP_NEW(name, filepath, codec, container);
+            
+            LOG_INFO("New File Tap '" << name << "' created successfully");
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception setting Tiles");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("New File Tap '" << name << "' threw exception on create");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TilerSourceShowSet(const char* name, 
-        const char* source, uint timeout, bool hasPrecedence)
+    DslReturnType Services::TapRtspNew(const char* name, const char* host, 
+        uint udpPort, uint rtspPort, uint codec)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            DSL_TILER_PTR pTilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
-
-            if (!pTilerBintr->IsLinked())
-            {
-                LOG_ERROR("Tiler '" << name << "' must be in a linked state to show a specific source");
-                return DSL_RESULT_TILER_SET_FAILED;
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Tap name '" << name << "' is not unique");
+                return DSL_RESULT_TAP_NAME_NOT_UNIQUE;
             }
-
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, source);
-            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, source);
-
-            DSL_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<SourceBintr>(m_components[source]);
-                    
-            if (!pTilerBintr->SetShowSource(pSourceBintr->GetId(), timeout, hasPrecedence))
-            {
-                LOG_ERROR("Tiler '" << name << "' failed to show specific source");
-                return DSL_RESULT_TILER_SET_FAILED;
+            if (codec > DSL_CODEC_H265)
+            {   
+                LOG_ERROR("Invalid Codec value = " << codec << " for RTSP Tap '" << name << "'");
+                return DSL_RESULT_TAP_CODEC_VALUE_INVALID;
             }
+            m_components[name] = DSL_RTSP_TAP_NEW(name, host, udpPort, rtspPort, codec);
             
+            LOG_INFO("New RTSP Tap '" << name << "' created successfully");
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception showing a specific source");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("New RTSP Tap '" << name << "' threw exception on create");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TilerSourceShowSet(const char* name, 
-        uint sourceId, uint timeout, bool hasPrecedence)
+    DslReturnType Services::TapRtspServerSettingsGet(const char* name, 
+        uint* udpPort, uint* rtspPort, uint* codec)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5124,59 +5194,72 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            DSL_TILER_PTR pTilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspTapBintr);
 
-            if (!pTilerBintr->IsLinked())
-            {
-                LOG_ERROR("Tiler '" << name << "' must be in a linked state to show a specific source");
-                return DSL_RESULT_TILER_SET_FAILED;
-            }
+            DSL_RTSP_TAP_PTR pRtspTapBintr = 
+                std::dynamic_pointer_cast<RtspTapBintr>(m_components[name]);
 
-            // called by automation - so set hasPrecedence to false always
-            if (!pTilerBintr->SetShowSource(sourceId, timeout, hasPrecedence))
-            {
-                // Don't log error as this can happen with the ODE actions frequently
-                LOG_DEBUG("Tiler '" << name << "' failed to show specific source");
-                return DSL_RESULT_TILER_SET_FAILED;
-            }
+            pRtspTapBintr->GetServerSettings(udpPort, rtspPort, codec);
             
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception showing a specific source");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Tap '" << name << "' threw an exception getting server settings");
+            return DSL_RESULT_TAP_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TilerSourceShowAll(const char* name)
+    DslReturnType Services::PrimaryGieNew(const char* name, const char* inferConfigFile,
+        const char* modelEngineFile, uint interval)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            DSL_TILER_PTR pTilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
-
-            pTilerBintr->ShowAllSources();
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("GIE name '" << name << "' is not unique");
+                return DSL_RESULT_GIE_NAME_NOT_UNIQUE;
+            }
+            
+            LOG_INFO("Infer config file: " << inferConfigFile);
+            
+            std::ifstream configFile(inferConfigFile);
+            if (!configFile.good())
+            {
+                LOG_ERROR("Infer Config File not found");
+                return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
+            }
             
+            std::string testPath(modelEngineFile);
+            if (testPath.size())
+            {
+                LOG_INFO("Model engine file: " << modelEngineFile);
+                
+                std::ifstream modelFile(modelEngineFile);
+                if (!modelFile.good())
+                {
+                    LOG_ERROR("Model Engine File not found");
+                    return DSL_RESULT_GIE_MODEL_FILE_NOT_FOUND;
+                }
+            }
+            m_components[name] = DSL_PRIMARY_GIE_NEW(name, 
+                inferConfigFile, modelEngineFile, interval);
+            LOG_INFO("New Primary GIE '" << name << "' created successfully");
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception showing all sources");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("New Primary GIE '" << name << "' threw exception on create");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::TilerPphAdd(const char* name, const char* handler, uint pad)
+    DslReturnType Services::PrimaryGiePphAdd(const char* name, const char* handler, uint pad)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5184,33 +5267,31 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
             RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
 
             if (pad > DSL_PAD_SRC)
             {
-                LOG_ERROR("Invalid Pad type = " << pad << " for Tiler '" << name << "'");
+                LOG_ERROR("Invalid Pad type = " << pad << " for PrimaryGie '" << name << "'");
                 return DSL_RESULT_PPH_PAD_TYPE_INVALID;
             }
 
             // call on the Handler to add itself to the Tiler as a PadProbeHandler
             if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], pad))
             {
-                LOG_ERROR("Tiler '" << name << "' failed to add Pad Probe Handler");
-                return DSL_RESULT_TILER_HANDLER_ADD_FAILED;
+                LOG_ERROR("Primary GIE '" << name << "' failed to add Pad Probe Handler");
+                return DSL_RESULT_GIE_HANDLER_ADD_FAILED;
             }
-            LOG_INFO("Pad Probe Handler '" << handler << "' added to Tiler '" << name << "' successfully");
-            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception adding Pad Probe Handler");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("Primary GIE '" << name << "' threw an exception adding Pad Probe Handler");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
    
-    DslReturnType Services::TilerPphRemove(const char* name, const char* handler, uint pad) 
+    DslReturnType Services::PrimaryGiePphRemove(const char* name, const char* handler, uint pad) 
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5219,85 +5300,111 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
             RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
 
             if (pad > DSL_PAD_SRC)
             {
-                LOG_ERROR("Invalid Pad type = " << pad << " for Tiler '" << name << "'");
+                LOG_ERROR("Invalid Pad type = " << pad << " for Primary GIE '" << name << "'");
                 return DSL_RESULT_PPH_PAD_TYPE_INVALID;
             }
 
-            // call on the Handler to remove itself from the Tiler
+            // call on the Handler to remove itself from the PrimaryGie
             if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], pad))
             {
-                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of Tiler '" << name << "'");
-                return DSL_RESULT_TILER_HANDLER_REMOVE_FAILED;
+                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of Primary GIE '" << name << "'");
+                return DSL_RESULT_GIE_HANDLER_REMOVE_FAILED;
             }
-            LOG_INFO("Pad Probe Handler '" << handler << "' removed from Tiler '" << name << "' successfully");
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception removing ODE Handle");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("Primary GIE '" << name << "' threw an exception removing Pad Probe Handler");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::OfvNew(const char* name)
+    DslReturnType Services::SecondaryGieNew(const char* name, const char* inferConfigFile,
+        const char* modelEngineFile, const char* inferOnGieName, uint interval)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
-        {   
+        {
             // ensure component name uniqueness 
             if (m_components.find(name) != m_components.end())
             {   
-                LOG_ERROR("OFV name '" << name << "' is not unique");
-                return DSL_RESULT_OFV_NAME_NOT_UNIQUE;
+                LOG_ERROR("GIE name '" << name << "' is not unique");
+                return DSL_RESULT_GIE_NAME_NOT_UNIQUE;
             }
-            m_components[name] = std::shared_ptr<Bintr>(new OfvBintr(name));
+            
+            LOG_INFO("Infer config file: " << inferConfigFile);
+            
+            std::ifstream configFile(inferConfigFile);
+            if (!configFile.good())
+            {
+                LOG_ERROR("Infer Config File not found");
+                return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
+            }
+            
+            LOG_INFO("Model engine file: " << modelEngineFile);
+            
+            std::string testPath(modelEngineFile);
+            if (testPath.size())
+            {
+                LOG_INFO("Model engine file: " << modelEngineFile);
+                
+                std::ifstream modelFile(modelEngineFile);
+                if (!modelFile.good())
+                {
+                    LOG_ERROR("Model Engine File not found");
+                    return DSL_RESULT_GIE_MODEL_FILE_NOT_FOUND;
+                }
+            }
+            m_components[name] = DSL_SECONDARY_GIE_NEW(name, 
+                inferConfigFile, modelEngineFile, inferOnGieName, interval);
 
-            LOG_INFO("New OFV '" << name << "' created successfully");
+            LOG_INFO("New Secondary GIE '" << name << "' created successfully");
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New OFV '" << name << "' threw exception on create");
-            return DSL_RESULT_OFV_THREW_EXCEPTION;
+            LOG_ERROR("New Primary GIE '" << name << "' threw exception on create");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::OsdNew(const char* name, boolean isClockEnabled)
+
+    DslReturnType Services::GieRawOutputEnabledSet(const char* name, boolean enabled,
+        const char* path)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
-        {   
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("OSD name '" << name << "' is not unique");
-                return DSL_RESULT_OSD_NAME_NOT_UNIQUE;
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+                
+            if (!pGieBintr->SetRawOutputEnabled(enabled, path))
+            {
+                LOG_ERROR("GIE '" << name << "' failed to enable raw output");
+                return DSL_RESULT_GIE_OUTPUT_DIR_DOES_NOT_EXIST;
             }
-            m_components[name] = std::shared_ptr<Bintr>(new OsdBintr(
-                name, isClockEnabled));
-                    
-            LOG_INFO("New OSD '" << name << "' created successfully");
-
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New OSD '" << name << "' threw exception on create");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("GIE '" << name << "' threw exception on raw output enabled set");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::OsdClockEnabledGet(const char* name, boolean* enabled)
+
+    DslReturnType Services::GieInferConfigFileGet(const char* name, const char** inferConfigFile)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5305,23 +5412,23 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            osdBintr->GetClockEnabled(enabled);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
 
+            *inferConfigFile = pGieBintr->GetInferConfigFile();
+            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception getting clock enabled");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::OsdClockEnabledSet(const char* name, boolean enabled)
+    DslReturnType Services::GieInferConfigFileSet(const char* name, const char* inferConfigFile)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5329,34 +5436,27 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            if (m_components[name]->IsInUse())
-            {
-                LOG_ERROR("Unable to set The clock enabled setting for the OSD '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_OSD_IS_IN_USE;
-            }
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
 
-            // TODO verify args before calling
-            if (!osdBintr->SetClockEnabled(enabled))
+            if (!pGieBintr->SetInferConfigFile(inferConfigFile))
             {
-                LOG_ERROR("OSD '" << name << "' failed to set Clock enabled");
-                return DSL_RESULT_OSD_SET_FAILED;
+                LOG_ERROR("GIE '" << name << "' failed to set the Infer Config file");
+                return DSL_RESULT_GIE_SET_FAILED;
             }
-            return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock enabled");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
+
+        return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::OsdClockOffsetsGet(const char* name, uint* offsetX, uint* offsetY)
+    DslReturnType Services::GieModelEngineFileGet(const char* name, const char** inferConfigFile)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5364,23 +5464,23 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
 
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+            *inferConfigFile = pGieBintr->GetModelEngineFile();
 
-            osdBintr->GetClockOffsets(offsetX, offsetY);
-            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception getting clock offsets");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::OsdClockOffsetsSet(const char* name, uint offsetX, uint offsetY)
+    DslReturnType Services::GieModelEngineFileSet(const char* name, const char* inferConfigFile)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5388,34 +5488,27 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
 
-            if (m_components[name]->IsInUse())
+            if (!pGieBintr->SetModelEngineFile(inferConfigFile))
             {
-                LOG_ERROR("Unable to set The clock offsets for the OSD '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_OSD_IS_IN_USE;
+                LOG_ERROR("GIE '" << name << "' failed to set the Infer Config file");
+                return DSL_RESULT_GIE_SET_FAILED;
             }
 
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            if (!osdBintr->SetClockOffsets(offsetX, offsetY))
-            {
-                LOG_ERROR("OSD '" << name << "' failed to set Clock offsets");
-                return DSL_RESULT_OSD_SET_FAILED;
-            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::OsdClockFontGet(const char* name, const char** font, uint* size)
+    DslReturnType Services::GieIntervalGet(const char* name, uint* interval)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5423,23 +5516,23 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
 
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+            *interval = pGieBintr->GetInterval();
 
-            osdBintr->GetClockFont(font, size);
-            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception getting clock font");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("GIE '" << name << "' threw an exception adding Batch Meta Handler");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::OsdClockFontSet(const char* name, const char* font, uint size)
+    DslReturnType Services::GieIntervalSet(const char* name, uint interval)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5447,34 +5540,27 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            if (m_components[name]->IsInUse())
-            {
-                LOG_ERROR("Unable to set The clock offsets for the OSD '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_OSD_IS_IN_USE;
-            }
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
 
-            // TODO verify args before calling
-            if (!osdBintr->SetClockFont(font, size))
+            if (!pGieBintr->SetInterval(interval))
             {
-                LOG_ERROR("OSD '" << name << "' failed to set Clock font");
-                return DSL_RESULT_OSD_SET_FAILED;
+                LOG_ERROR("GIE '" << name << "' failed to set new Interval");
+                return DSL_RESULT_GIE_SET_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("GIE '" << name << "' threw an exception setting Interval");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::OsdClockColorGet(const char* name, double* red, double* green, double* blue, double* alpha)
+    DslReturnType Services::PrimaryGieIntervalAdaptiveGet(const char* name, 
+        boolean* enabled, uint* minInterval, uint* maxInterval)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5482,23 +5568,27 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            osdBintr->GetClockColor(red, green, blue, alpha);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
+            
+            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
 
+            bool bEnabled(false);
+            pPrimaryGieBintr->GetIntervalAdaptive(&bEnabled, minInterval, maxInterval);
+            *enabled = bEnabled;
+            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception getting clock font");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("Primary GIE '" << name 
+                << "' threw an exception getting adaptive Interval settings");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::OsdClockColorSet(const char* name, double red, double green, double blue, double alpha)
+    DslReturnType Services::PrimaryGieIntervalAdaptiveSet(const char* name, 
+        boolean enabled, uint minInterval, uint maxInterval)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5506,99 +5596,88 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            if (m_components[name]->IsInUse())
-            {
-                LOG_ERROR("Unable to set The clock RGB colors for the OSD '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_OSD_IS_IN_USE;
-            }
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
+            
+            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
 
-            // TODO verify args before calling
-            if (!osdBintr->SetClockColor(red, green, blue, alpha))
+            if (!pPrimaryGieBintr->SetIntervalAdaptive(enabled, minInterval, maxInterval))
             {
-                LOG_ERROR("OSD '" << name << "' failed to set Clock RGB colors");
-                return DSL_RESULT_OSD_SET_FAILED;
+                LOG_ERROR("Primary GIE '" << name 
+                    << "' failed to set adaptive Interval settings");
+                return DSL_RESULT_GIE_SET_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("Primary GIE '" << name 
+                << "' threw an exception setting adaptive Interval settings");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::OsdPphAdd(const char* name, const char* handler, uint pad)
+
+    DslReturnType Services::PrimaryGieIntervalListenerAdd(const char* name, 
+        dsl_gie_interval_change_listener_cb listener, void* clientData)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
-
-            if (pad > DSL_PAD_SRC)
-            {
-                LOG_ERROR("Invalid Pad type = " << pad << " for OSD '" << name << "'");
-                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
-            }
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
+            
+            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
 
-            // call on the Handler to add itself to the Osd as a PadProbeHandler
-            if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], pad))
+            if (!pPrimaryGieBintr->AddIntervalChangeListener(listener, clientData))
             {
-                LOG_ERROR("OSD '" << name << "' failed to add Pad Probe Handler");
-                return DSL_RESULT_OSD_HANDLER_ADD_FAILED;
+                LOG_ERROR("Primary GIE '" << name 
+                    << "' failed to add an Interval Change Listener");
+                return DSL_RESULT_GIE_LISTENER_ADD_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception adding Pad Probe Handler");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("Primary GIE '" << name 
+                << "' threw an exception adding an Interval Change Listener");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
-   
-    DslReturnType Services::OsdPphRemove(const char* name, const char* handler, uint pad) 
+
+    DslReturnType Services::PrimaryGieIntervalListenerRemove(const char* name, 
+        dsl_gie_interval_change_listener_cb listener)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
-
-            if (pad > DSL_PAD_SRC)
-            {
-                LOG_ERROR("Invalid Pad type = " << pad << " for OSD '" << name << "'");
-                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
-            }
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
+            
+            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
 
-            // call on the Handler to remove itself from the Osd
-            if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], pad))
+            if (!pPrimaryGieBintr->RemoveIntervalChangeListener(listener))
             {
-                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of OSD '" << name << "'");
-                return DSL_RESULT_OSD_HANDLER_REMOVE_FAILED;
+                LOG_ERROR("Primary GIE '" << name 
+                    << "' failed to remove an Interval Change Listener");
+                return DSL_RESULT_GIE_LISTENER_REMOVE_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Osd '" << name << "' threw an exception removing ODE Handle");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("Primary GIE '" << name 
+                << "' threw an exception removing an Interval Change Listener");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
         }
     }
-   
-    DslReturnType Services::SinkFakeNew(const char* name)
+
+    DslReturnType Services::TrackerKtlNew(const char* name, uint width, uint height)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5608,24 +5687,24 @@ namespace DSL
             // ensure component name uniqueness 
             if (m_components.find(name) != m_components.end())
             {   
-                LOG_ERROR("Sink name '" << name << "' is not unique");
-                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+                LOG_ERROR("KTL Tracker name '" << name << "' is not unique");
+                return DSL_RESULT_TRACKER_NAME_NOT_UNIQUE;
             }
-            m_components[name] = DSL_FAKE_SINK_NEW(name);
-
-            LOG_INFO("New Fake Sink '" << name << "' created successfully");
+            m_components[name] = std::shared_ptr<Bintr>(new KtlTrackerBintr(
+                name, width, height));
+            LOG_INFO("New KTL Tracker '" << name << "' created successfully");
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("KTL Tracker '" << name << "' threw exception on create");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
         }
     }
-
-    DslReturnType Services::SinkOverlayNew(const char* name, uint overlay_id, uint display_id,
-        uint depth, uint offsetX, uint offsetY, uint width, uint height)
+    
+    DslReturnType Services::TrackerIouNew(const char* name, const char* configFile, 
+        uint width, uint height)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5635,25 +5714,33 @@ namespace DSL
             // ensure component name uniqueness 
             if (m_components.find(name) != m_components.end())
             {   
-                LOG_ERROR("Sink name '" << name << "' is not unique");
-                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+                LOG_ERROR("IOU Tracker name '" << name << "' is not unique");
+                return DSL_RESULT_TRACKER_NAME_NOT_UNIQUE;
             }
-            m_components[name] = DSL_OVERLAY_SINK_NEW(
-                name, overlay_id, display_id, depth, offsetX, offsetY, width, height);
-
-            LOG_INFO("New Overlay Sink '" << name << "' created successfully");
+            LOG_INFO("Infer config file: " << configFile);
+            
+            std::ifstream streamConfigFile(configFile);
+            if (!streamConfigFile.good())
+            {
+                LOG_ERROR("Infer Config File not found");
+                return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
+            }
+            m_components[name] = std::shared_ptr<Bintr>(new IouTrackerBintr(
+                name, configFile, width, height));
+                
+            LOG_INFO("New IOU Tracker '" << name << "' created successfully");
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("IOU Tracker '" << name << "' threw exception on create");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::SinkWindowNew(const char* name, 
-        uint offsetX, uint offsetY, uint width, uint height)
+   
+    DslReturnType Services::TrackerCpuIouNew(const char* name, 
+        uint maxAge, float iouThreshold, uint maxTracks)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5663,108 +5750,93 @@ namespace DSL
             // ensure component name uniqueness 
             if (m_components.find(name) != m_components.end())
             {   
-                LOG_ERROR("Sink name '" << name << "' is not unique");
-                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+                LOG_ERROR("CPU IOU Tracker name '" << name << "' is not unique");
+                return DSL_RESULT_TRACKER_NAME_NOT_UNIQUE;
             }
-            m_components[name] = DSL_WINDOW_SINK_NEW(name, offsetX, offsetY, width, height);
-
-            LOG_INFO("New Window Sink '" << name << "' created successfully");
+            if (iouThreshold <= 0 or iouThreshold > 1 or maxTracks == 0)
+            {
+                LOG_ERROR("Invalid settings for new CPU IOU Tracker '" << name << "'");
+                return DSL_RESULT_TRACKER_SETTINGS_INVALID;
+            }
+            m_components[name] = std::shared_ptr<Bintr>(new CpuIouTrackerBintr(
+                name, maxAge, iouThreshold, maxTracks));
+                
+            LOG_INFO("New CPU IOU Tracker '" << name << "' created successfully");
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("CPU IOU Tracker '" << name << "' threw exception on create");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::SinkFileNew(const char* name, const char* filepath, 
-            uint codec, uint container, uint bitrate, uint interval)
+
+    DslReturnType Services::TrackerCpuIouSettingsGet(const char* name, 
+        uint* maxAge, float* iouThreshold, uint* maxTracks)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("Sink name '" << name << "' is not unique");
-                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
-            }
-            if (codec > DSL_CODEC_MPEG4)
-            {   
-                LOG_ERROR("Invalid Codec value = " << codec << " for File Sink '" << name << "'");
-                return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
-            }
-            if (container > DSL_CONTAINER_MKV)
-            {   
-                LOG_ERROR("Invalid Container value = " << container << " for File Sink '" << name << "'");
-                return DSL_RESULT_SINK_CONTAINER_VALUE_INVALID;
-            }
-            m_components[name] = DSL_FILE_SINK_NEW(name, filepath, codec, container, bitrate, interval);
-            LOG_INFO("New File Sink '" << name << "' created successfully");
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, CpuIouTrackerBintr);
+
+            DSL_CPU_IOU_TRACKER_PTR trackerBintr = 
+                std::dynamic_pointer_cast<CpuIouTrackerBintr>(m_components[name]);
+
+            trackerBintr->GetSettings(maxAge, iouThreshold, maxTracks);
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("CPU IOU Tracker '" << name << "' threw an exception getting settings");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
         }
     }
-    
-    DslReturnType Services::SinkRecordNew(const char* name, const char* outdir, uint codec, uint container, 
-        uint bitrate, uint interval, dsl_record_client_listner_cb clientListener)
+
+    DslReturnType Services::TrackerCpuIouSettingsSet(const char* name, 
+        uint maxAge, float iouThreshold, uint maxTracks)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
-            struct stat info;
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, CpuIouTrackerBintr);
 
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("Sink name '" << name << "' is not unique");
-                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set settings for CPU IOU Tracker '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_TRACKER_IS_IN_USE;
             }
-            // ensure outdir exists
-            if ((stat(outdir, &info) != 0) or !(info.st_mode & S_IFDIR))
+            if (iouThreshold <= 0 or iouThreshold > 1 or maxTracks == 0)
             {
-                LOG_ERROR("Unable to access outdir '" << outdir << "' for Record Sink '" << name << "'");
-                return DSL_RESULT_SINK_FILE_PATH_NOT_FOUND;
+                LOG_ERROR("Invalid settings for CPU IOU Tracker '" << name << "'");
+                return DSL_RESULT_TRACKER_SETTINGS_INVALID;
             }
+            DSL_CPU_IOU_TRACKER_PTR trackerBintr = 
+                std::dynamic_pointer_cast<CpuIouTrackerBintr>(m_components[name]);
 
-            if (codec > DSL_CODEC_MPEG4)
-            {   
-                LOG_ERROR("Invalid Codec value = " << codec << " for Record Sink '" << name << "'");
-                return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
-            }
-            if (container > DSL_CONTAINER_MKV)
-            {   
-                LOG_ERROR("Invalid Container value = " << container << " for Record Sink '" << name << "'");
-                return DSL_RESULT_SINK_CONTAINER_VALUE_INVALID;
+            if (!trackerBintr->SetSettings(maxAge, iouThreshold, maxTracks))
+            {
+                LOG_ERROR("CPU IOU Tracker '" << name << "' failed to set settings");
+                return DSL_RESULT_TRACKER_SET_FAILED;
             }
-
-            m_components[name] = DSL_RECORD_SINK_NEW(name, outdir, 
-                codec, container, bitrate, interval, (NvDsSRCallbackFunc)clientListener);
-            
-            LOG_INFO("New Record Sink '" << name << "' created successfully");
-
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Record Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("CPU IOU Tracker '" << name << "' threw an exception setting settings");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkRecordSessionStart(const char* name, 
-        uint* session, uint start, uint duration, void* clientData)
+       DslReturnType Services::TrackerMaxDimensionsGet(const char* name, uint* width, uint* height)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -5772,345 +5844,393 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
 
-            DSL_RECORD_SINK_PTR recordSinkBintr = 
-                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+            DSL_TRACKER_PTR trackerBintr = 
+                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            trackerBintr->GetMaxDimensions(width, height);
 
-            if (!recordSinkBintr->StartSession(session, start, duration, clientData))
-            {
-                LOG_ERROR("Record Sink '" << name << "' failed to Start Session");
-                return DSL_RESULT_SINK_SET_FAILED;
-            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Sink'" << name << "' threw an exception setting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tracker '" << name << "' threw an exception getting dimensions");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkRecordSessionStop(const char* name, uint session)
+    DslReturnType Services::TrackerMaxDimensionsSet(const char* name, uint width, uint height)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
 
-            DSL_RECORD_SINK_PTR recordSinkBintr = 
-                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set Max Dimensions for Tracker '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_TILER_IS_IN_USE;
+            }
 
-            if (!recordSinkBintr->StopSession(session))
+            DSL_TRACKER_PTR trackerBintr = 
+                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!trackerBintr->SetMaxDimensions(width, height))
             {
-                LOG_ERROR("Record Sink '" << name << "' failed to Stop Session");
-                return DSL_RESULT_SINK_SET_FAILED;
+                LOG_ERROR("Tracker '" << name << "' failed to set dimensions");
+                return DSL_RESULT_TRACKER_SET_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Sink'" << name << "' threw an exception setting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tracker '" << name << "' threw an exception setting dimensions");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkRecordCacheSizeGet(const char* name, uint* cacheSize)
+    DslReturnType Services::TrackerPphAdd(const char* name, const char* handler, uint pad)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
-
-            DSL_RECORD_SINK_PTR recordSinkBintr = 
-                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
 
-            // TODO verify args before calling
-            *cacheSize = recordSinkBintr->GetCacheSize();
+            if (pad > DSL_PAD_SRC)
+            {
+                LOG_ERROR("Invalid Pad type = " << pad << " for Tracker '" << name << "'");
+                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
+            }
 
+            // call on the Handler to add itself to the Tiler as a PadProbeHandler
+            if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], pad))
+            {
+                LOG_ERROR("Tracker '" << name << "' failed to add Pad Probe Handler");
+                return DSL_RESULT_TRACKER_HANDLER_ADD_FAILED;
+            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Sink '" << name << "' threw an exception getting cache size");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tracker '" << name << "' threw an exception adding Pad Probe Handler");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
         }
     }
-
-    DslReturnType Services::SinkRecordCacheSizeSet(const char* name, uint cacheSize)
+   
+    DslReturnType Services::TrackerPphRemove(const char* name, const char* handler, uint pad) 
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
 
-            DSL_RECORD_SINK_PTR recordSinkBintr = 
-                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+            if (pad > DSL_PAD_SRC)
+            {
+                LOG_ERROR("Invalid Pad type = " << pad << " for Tracker '" << name << "'");
+                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
+            }
 
-            // TODO verify args before calling
-            if (!recordSinkBintr->SetCacheSize(cacheSize))
+            // call on the Handler to remove itself from the Tracker
+            if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], pad))
             {
-                LOG_ERROR("Record Sink '" << name << "' failed to set cache size");
-                return DSL_RESULT_SINK_SET_FAILED;
+                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of Tracker '" << name << "'");
+                return DSL_RESULT_TRACKER_HANDLER_REMOVE_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Sink '" << name << "' threw an exception setting s");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tracker '" << name << "' threw an exception removing Pad Probe Handler");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
         }
     }
         
-    DslReturnType Services::SinkRecordDimensionsGet(const char* name, uint* width, uint* height)
+    DslReturnType Services::TeeDemuxerNew(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
-
-            DSL_RECORD_SINK_PTR recordSinkBintr = 
-                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            recordSinkBintr->GetDimensions(width, height);
-
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Demuxer Tee name '" << name << "' is not unique");
+                return DSL_RESULT_TEE_NAME_NOT_UNIQUE;
+            }
+            m_components[name] = std::shared_ptr<Bintr>(new DemuxerBintr(name));
+            
+            LOG_INFO("New Demuxer Tee '" << name << "' created successfully");
+            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Sink '" << name << "' threw an exception getting dimensions");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("New Demuxer Tee '" << name << "' threw exception on create");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkRecordDimensionsSet(const char* name, uint width, uint height)
+    DslReturnType Services::TeeSplitterNew(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
-
-
-            DSL_RECORD_SINK_PTR recordSinkBintr = 
-                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            if (!recordSinkBintr->SetDimensions(width, height))
-            {
-                LOG_ERROR("Record Sink '" << name << "' failed to set dimensions");
-                return DSL_RESULT_SINK_SET_FAILED;
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Splitter Tee name '" << name << "' is not unique");
+                return DSL_RESULT_TILER_NAME_NOT_UNIQUE;
             }
+            m_components[name] = std::shared_ptr<Bintr>(new SplitterBintr(name));
+            
+            LOG_INFO("New Splitter Tee '" << name << "' created successfully");
+
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Sink '" << name << "' threw an exception setting dimensions");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("New Splitter Tee '" << name << "' threw exception on create");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
         }
     }
-
-    DslReturnType Services::SinkRecordIsOnGet(const char* name, boolean* isOn)
+    
+    DslReturnType Services::TeeBranchAdd(const char* tee, 
+        const char* branch)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
-
-            DSL_RECORD_SINK_PTR recordSinkBintr = 
-                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
+            RETURN_IF_COMPONENT_IS_NOT_BRANCH(m_components, branch);
+            
+            // Can't add components if they're In use by another Branch
+            if (m_components[branch]->IsInUse())
+            {
+                LOG_ERROR("Unable to add branch '" << branch 
+                    << "' as it's currently in use");
+                return DSL_RESULT_COMPONENT_IN_USE;
+            }
+            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
 
-            *isOn = recordSinkBintr->IsOn();
+            // Cast the Branch to a Bintr to call the correct AddChile method.
+            DSL_BINTR_PTR pBranchBintr = 
+                std::dynamic_pointer_cast<Bintr>(m_components[branch]);
 
+            if (!pTeeBintr->AddChild(pBranchBintr))
+            {
+                LOG_ERROR("Tee '" << tee << 
+                    "' failed to add branch '" << branch << "'");
+                return DSL_RESULT_TEE_BRANCH_ADD_FAILED;
+            }
+            LOG_INFO("Branch '" << branch 
+                << "' was added to Tee '" << tee << "' successfully");
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Record Sink '" << name << "' threw an exception getting is-recording-on flag");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tee '" << tee 
+                << "' threw an exception removing branch '" << branch << "'");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
         }
-    }
-
-    DslReturnType Services::SinkRecordResetDoneGet(const char* name, boolean* resetDone)
+    }    
+    
+    DslReturnType Services::TeeBranchRemove(const char* tee, 
+        const char* branch)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
-
-            DSL_RECORD_SINK_PTR recordSinkBintr = 
-                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
+            RETURN_IF_BRANCH_NAME_NOT_FOUND(m_components, branch);
 
-            *resetDone = recordSinkBintr->ResetDone();
+            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
 
-            return DSL_RESULT_SUCCESS;
-        }
-        catch(...)
+            if (!pTeeBintr->IsChild(m_components[branch]))
+            {
+                LOG_ERROR("Branch '" << branch << 
+                    "' is not in use by Tee '" << tee << "'");
+                return DSL_RESULT_TEE_BRANCH_IS_NOT_CHILD;
+            }
+
+            // Cast the Branch to a Bintr to call the correct AddChile method.
+            DSL_BINTR_PTR pBranchBintr = 
+                std::dynamic_pointer_cast<Bintr>(m_components[branch]);
+
+            if (!pTeeBintr->RemoveChild(pBranchBintr))
+            {
+                LOG_ERROR("Tee '" << tee << 
+                    "' failed to remove branch '" << branch << "'");
+                return DSL_RESULT_TEE_BRANCH_REMOVE_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
         {
-            LOG_ERROR("Record Sink '" << name << "' threw an exception getting reset done flag");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tee '" << tee 
+                << "' threw an exception removing branch '" << branch << "'");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkEncodeVideoFormatsGet(const char* name, uint* codec, uint* container)
+    DslReturnType Services::TeeBranchRemoveAll(const char* tee)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_ENCODE_SINK(m_components, name);
-
-            DSL_ENCODE_SINK_PTR encodeSinkBintr = 
-                std::dynamic_pointer_cast<EncodeSinkBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
 
-            encodeSinkBintr->GetVideoFormats(codec, container);
-            
+            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
+                
+            // TODO WHY?
+//            m_components[tee]->RemoveAll();
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("File Sink '" << name << "' threw an exception getting Video formats");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tee '" <<  tee
+                << "' threw an exception removing all branches");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkEncodeSettingsGet(const char* name, uint* bitrate, uint* interval)
+    DslReturnType Services::TeeBranchCountGet(const char* tee, uint* count)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_ENCODE_SINK(m_components, name);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
 
-            DSL_ENCODE_SINK_PTR encodeSinkBintr = 
-                std::dynamic_pointer_cast<EncodeSinkBintr>(m_components[name]);
+            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
 
-            encodeSinkBintr->GetEncoderSettings(bitrate, interval);
+            *count = pTeeBintr->GetNumChildren();
             
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("File Sink '" << name << "' threw an exception getting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tee '" <<  tee
+                << "' threw an exception getting branch count");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkEncodeSettingsSet(const char* name, uint bitrate, uint interval)
+    DslReturnType Services::TeePphAdd(const char* name, const char* handler)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_ENCODE_SINK(m_components, name);
-
-            if (m_components[name]->IsLinked())
-            {
-                LOG_ERROR("Unable to set Encoder settings for File Sink '" << name 
-                    << "' as it's currently linked");
-                return DSL_RESULT_SINK_IS_IN_USE;
-            }
-
-            DSL_ENCODE_SINK_PTR encodeSinkBintr = 
-                std::dynamic_pointer_cast<EncodeSinkBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, name);
+            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
 
-            if (!encodeSinkBintr->SetEncoderSettings(bitrate, interval))
+            // call on the Handler to add itself to the Tiler as a PadProbeHandler
+            if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], DSL_PAD_SINK))
             {
-                LOG_ERROR("Encode Sink '" << name << "' failed to set Encoder settings");
-                return DSL_RESULT_SINK_SET_FAILED;
+                LOG_ERROR("Tracker '" << name << "' failed to add Pad Probe Handler");
+                return DSL_RESULT_TEE_HANDLER_ADD_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("File Sink'" << name << "' threw an exception setting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tiler '" << name << "' threw an exception adding Pad Probe Handler");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
         }
     }
-
-    DslReturnType Services::SinkRtspNew(const char* name, const char* host, 
-            uint udpPort, uint rtspPort, uint codec, uint bitrate, uint interval)
+   
+    DslReturnType Services::TeePphRemove(const char* name, const char* handler) 
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        
         try
         {
-            // ensure component name uniqueness 
-            if (m_components.find(name) != m_components.end())
-            {   
-                LOG_ERROR("Sink name '" << name << "' is not unique");
-                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
-            }
-            if (codec > DSL_CODEC_H265)
-            {   
-                LOG_ERROR("Invalid Codec value = " << codec << " for File Sink '" << name << "'");
-                return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
-            }
-            m_components[name] = DSL_RTSP_SINK_NEW(name, host, udpPort, rtspPort, codec, bitrate, interval);
-
-            LOG_INFO("New RTSP Sink '" << name << "' created successfully");
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, name);
+            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
 
+            // call on the Handler to remove itself from the Tee
+            if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], DSL_PAD_SINK))
+            {
+                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of Tracker '" << name << "'");
+                return DSL_RESULT_TEE_HANDLER_REMOVE_FAILED;
+            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New RTSP Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tee '" << name << "' threw an exception removing Pad Probe Handler");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
         }
     }
     
-    DslReturnType Services::SinkRtspServerSettingsGet(const char* name, uint* udpPort, uint* rtspPort, uint* codec)
+    DslReturnType Services::TilerNew(const char* name, uint width, uint height)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            
-            DSL_RTSP_SINK_PTR rtspSinkBintr = 
-                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
-
-            rtspSinkBintr->GetServerSettings(udpPort, rtspPort, codec);
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Tiler name '" << name << "' is not unique");
+                return DSL_RESULT_TILER_NAME_NOT_UNIQUE;
+            }
+            m_components[name] = std::shared_ptr<Bintr>(new TilerBintr(
+                name, width, height));
+                
+            LOG_INFO("New Tiler '" << name << "' created successfully");
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("RTSP Sink '" << name << "' threw an exception getting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("New Tiler'" << name << "' threw exception on create");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkRtspEncoderSettingsGet(const char* name, uint* bitrate, uint* interval)
+    DslReturnType Services::TilerDimensionsGet(const char* name, uint* width, uint* height)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -6118,544 +6238,3157 @@ namespace DSL
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
-
-            DSL_RTSP_SINK_PTR rtspSinkBintr = 
-                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
 
-            rtspSinkBintr->GetEncoderSettings(bitrate, interval);
+            DSL_TILER_PTR tilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
 
+            // TODO verify args before calling
+            tilerBintr->GetDimensions(width, height);
+            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("RTSP Sink '" << name << "' threw an exception getting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tiler '" << name << "' threw an exception getting dimensions");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkRtspEncoderSettingsSet(const char* name, uint bitrate, uint interval)
+    DslReturnType Services::TilerDimensionsSet(const char* name, uint width, uint height)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
 
-            DSL_RTSP_SINK_PTR rtspSinkBintr = 
-                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
 
-            if (m_components[name]->IsInUse())
-            {
-                LOG_ERROR("Unable to set Encoder settings for RTSP Sink '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_SINK_IS_IN_USE;
-            }
+            DSL_TILER_PTR tilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
 
-            if (!rtspSinkBintr->SetEncoderSettings(bitrate, interval))
+            // TODO verify args before calling
+            if (!tilerBintr->SetDimensions(width, height))
             {
-                LOG_ERROR("RTSP Sink '" << name << "' failed to set Encoder settings");
-                return DSL_RESULT_SINK_SET_FAILED;
+                LOG_ERROR("Tiler '" << name << "' failed to settin dimensions");
+                return DSL_RESULT_TILER_SET_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("RTSP Sink '" << name << "' threw an exception setting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tiler '" << name << "' threw an exception setting dimensions");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkPphAdd(const char* name, const char* handler)
+    DslReturnType Services::TilerTilesGet(const char* name, uint* cols, uint* rows)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SINK(m_components, name);
-            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            DSL_TILER_PTR tilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            tilerBintr->GetTiles(cols, rows);
 
-            // call on the Handler to add itself to the Tiler as a PadProbeHandler
-            if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], DSL_PAD_SINK))
-            {
-                LOG_ERROR("SINK '" << name << "' failed to add Pad Probe Handler");
-                return DSL_RESULT_SINK_HANDLER_ADD_FAILED;
-            }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Sink '" << name << "' threw an exception adding Pad Probe Handler");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tiler '" << name << "' threw an exception getting Tiles");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
         }
     }
-   
-    DslReturnType Services::SinkPphRemove(const char* name, const char* handler) 
+
+    DslReturnType Services::TilerTilesSet(const char* name, uint cols, uint rows)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SINK(m_components, name);
-            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
 
-            // call on the Handler to remove itself from the Tee
-            if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], DSL_PAD_SINK))
+            DSL_TILER_PTR tilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!tilerBintr->SetTiles(cols, rows))
             {
-                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of Tracker '" << name << "'");
-                return DSL_RESULT_SINK_HANDLER_REMOVE_FAILED;
+                LOG_ERROR("Tiler '" << name << "' failed to set Tiles");
+                return DSL_RESULT_TILER_SET_FAILED;
             }
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Sink '" << name << "' threw an exception removing Pad Probe Handler");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tiler '" << name << "' threw an exception setting Tiles");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkSyncSettingsGet(const char* name,  boolean* sync, boolean* async)
+    DslReturnType Services::TilerSourceShowGet(const char* name, 
+        const char** source, uint* timeout)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SINK(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
 
-            DSL_SINK_PTR pSinkBintr = 
-                std::dynamic_pointer_cast<SinkBintr>(m_components[name]);
+            DSL_TILER_PTR tilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
 
-            bool bSync(false), bAsync(false);
-            pSinkBintr->GetSyncSettings(&bSync, &bAsync);
-            *sync = bSync;
-            *async = bAsync;
+            int sourceId(-1);
+            tilerBintr->GetShowSource(&sourceId, timeout);
             
+            if (sourceId == -1)
+            {
+                *source = NULL;
+                return DSL_RESULT_SUCCESS;
+            }
+            if (m_sourceNames.find(sourceId) == m_sourceNames.end())
+            {
+                *source = NULL;
+                LOG_ERROR("Tiler '" << name << "' failed to get Source name from Id");
+                return DSL_RESULT_SOURCE_NAME_NOT_FOUND;
+            }
+            *source = m_sourceNames[sourceId].c_str();
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Sink '" << name << "' threw an exception getting  Sync/Async settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tiler '" << name << "' threw an exception setting Tiles");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::SinkSyncSettingsSet(const char* name,  boolean sync, boolean async)
+    DslReturnType Services::TilerSourceShowSet(const char* name, 
+        const char* source, uint timeout, bool hasPrecedence)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-        
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SINK(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
 
-            DSL_SINK_PTR pSinkBintr = 
-                std::dynamic_pointer_cast<SinkBintr>(m_components[name]);
+            DSL_TILER_PTR pTilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
 
-            if (!pSinkBintr->SetSyncSettings(sync, async))
+            if (!pTilerBintr->IsLinked())
             {
-                LOG_ERROR("Sink '" << name << "' failed to set sync/async attributes");
-                return DSL_RESULT_SINK_HANDLER_REMOVE_FAILED;
+                LOG_ERROR("Tiler '" << name << "' must be in a linked state to show a specific source");
+                return DSL_RESULT_TILER_SET_FAILED;
+            }
+
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, source);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, source);
+
+            DSL_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SourceBintr>(m_components[source]);
+                    
+            if (!pTilerBintr->SetShowSource(pSourceBintr->GetId(), timeout, hasPrecedence))
+            {
+                LOG_ERROR("Tiler '" << name << "' failed to show specific source");
+                return DSL_RESULT_TILER_SET_FAILED;
             }
+            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Sink '" << name << "' threw an exception setting sync/async settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Tiler '" << name << "' threw an exception showing a specific source");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
         }
     }
 
-    uint Services::SinkNumInUseGet()
+    DslReturnType Services::TilerSourceShowSet(const char* name, 
+        uint sourceId, uint timeout, bool hasPrecedence)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
-        return GetNumSinksInUse();
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            DSL_TILER_PTR pTilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            if (!pTilerBintr->IsLinked())
+            {
+                LOG_ERROR("Tiler '" << name << "' must be in a linked state to show a specific source");
+                return DSL_RESULT_TILER_SET_FAILED;
+            }
+
+            // called by automation - so set hasPrecedence to false always
+            if (!pTilerBintr->SetShowSource(sourceId, timeout, hasPrecedence))
+            {
+                // Don't log error as this can happen with the ODE actions frequently
+                LOG_DEBUG("Tiler '" << name << "' failed to show specific source");
+                return DSL_RESULT_TILER_SET_FAILED;
+            }
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception showing a specific source");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
     }
-    
-    uint Services::SinkNumInUseMaxGet()
+
+    DslReturnType Services::TilerSourceShowAll(const char* name)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        return m_sinkNumInUseMax;
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            DSL_TILER_PTR pTilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            pTilerBintr->ShowAllSources();
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception showing all sources");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
     }
-    
-    boolean Services::SinkNumInUseMaxSet(uint max)
+
+    DslReturnType Services::TilerFramePruningEnabledGet(const char* name, boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            DSL_TILER_PTR pTilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            *enabled = pTilerBintr->GetFramePruningEnabled();
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception getting frame-pruning");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::TilerFramePruningEnabledSet(const char* name, boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            DSL_TILER_PTR pTilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            pTilerBintr->SetFramePruningEnabled(enabled);
+            
+            LOG_INFO("Tiler '" << name << "' set frame-pruning enabled = " << enabled);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception setting frame-pruning");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::TilerPphAdd(const char* name, const char* handler, uint pad)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         
-        uint numInUse(0);
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+
+            if (pad > DSL_PAD_SRC)
+            {
+                LOG_ERROR("Invalid Pad type = " << pad << " for Tiler '" << name << "'");
+                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
+            }
+
+            // call on the Handler to add itself to the Tiler as a PadProbeHandler
+            if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], pad))
+            {
+                LOG_ERROR("Tiler '" << name << "' failed to add Pad Probe Handler");
+                return DSL_RESULT_TILER_HANDLER_ADD_FAILED;
+            }
+            LOG_INFO("Pad Probe Handler '" << handler << "' added to Tiler '" << name << "' successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception adding Pad Probe Handler");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+    }
+   
+    DslReturnType Services::TilerPphRemove(const char* name, const char* handler, uint pad) 
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
         
-        if (max < GetNumSinksInUse())
+        try
         {
-            LOG_ERROR("max setting = " << max << 
-                " is less than the current number of Sinks in use = " << numInUse);
-            return false;
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+
+            if (pad > DSL_PAD_SRC)
+            {
+                LOG_ERROR("Invalid Pad type = " << pad << " for Tiler '" << name << "'");
+                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
+            }
+
+            // call on the Handler to remove itself from the Tiler
+            if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], pad))
+            {
+                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of Tiler '" << name << "'");
+                return DSL_RESULT_TILER_HANDLER_REMOVE_FAILED;
+            }
+            LOG_INFO("Pad Probe Handler '" << handler << "' removed from Tiler '" << name << "' successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception removing ODE Handle");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OfvNew(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {   
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("OFV name '" << name << "' is not unique");
+                return DSL_RESULT_OFV_NAME_NOT_UNIQUE;
+            }
+            m_components[name] = std::shared_ptr<Bintr>(new OfvBintr(name));
+
+            LOG_INFO("New OFV '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New OFV '" << name << "' threw exception on create");
+            return DSL_RESULT_OFV_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OsdNew(const char* name, boolean isClockEnabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {   
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("OSD name '" << name << "' is not unique");
+                return DSL_RESULT_OSD_NAME_NOT_UNIQUE;
+            }
+            m_components[name] = std::shared_ptr<Bintr>(new OsdBintr(
+                name, isClockEnabled));
+                    
+            LOG_INFO("New OSD '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New OSD '" << name << "' threw exception on create");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OsdClockEnabledGet(const char* name, boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            osdBintr->GetClockEnabled(enabled);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("OSD '" << name << "' threw an exception getting clock enabled");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OsdClockEnabledSet(const char* name, boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set The clock enabled setting for the OSD '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_OSD_IS_IN_USE;
+            }
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!osdBintr->SetClockEnabled(enabled))
+            {
+                LOG_ERROR("OSD '" << name << "' failed to set Clock enabled");
+                return DSL_RESULT_OSD_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock enabled");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OsdClockOffsetsGet(const char* name, uint* offsetX, uint* offsetY)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            osdBintr->GetClockOffsets(offsetX, offsetY);
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("OSD '" << name << "' threw an exception getting clock offsets");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OsdClockOffsetsSet(const char* name, uint offsetX, uint offsetY)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set The clock offsets for the OSD '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_OSD_IS_IN_USE;
+            }
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!osdBintr->SetClockOffsets(offsetX, offsetY))
+            {
+                LOG_ERROR("OSD '" << name << "' failed to set Clock offsets");
+                return DSL_RESULT_OSD_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OsdClockFontGet(const char* name, const char** font, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            osdBintr->GetClockFont(font, size);
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("OSD '" << name << "' threw an exception getting clock font");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OsdClockFontSet(const char* name, const char* font, uint size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set The clock offsets for the OSD '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_OSD_IS_IN_USE;
+            }
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!osdBintr->SetClockFont(font, size))
+            {
+                LOG_ERROR("OSD '" << name << "' failed to set Clock font");
+                return DSL_RESULT_OSD_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OsdClockColorGet(const char* name, double* red, double* green, double* blue, double* alpha)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            osdBintr->GetClockColor(red, green, blue, alpha);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("OSD '" << name << "' threw an exception getting clock font");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OsdClockColorSet(const char* name, double red, double green, double blue, double alpha)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set The clock RGB colors for the OSD '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_OSD_IS_IN_USE;
+            }
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!osdBintr->SetClockColor(red, green, blue, alpha))
+            {
+                LOG_ERROR("OSD '" << name << "' failed to set Clock RGB colors");
+                return DSL_RESULT_OSD_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OsdPphAdd(const char* name, const char* handler, uint pad)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+
+            if (pad > DSL_PAD_SRC)
+            {
+                LOG_ERROR("Invalid Pad type = " << pad << " for OSD '" << name << "'");
+                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
+            }
+
+            // call on the Handler to add itself to the Osd as a PadProbeHandler
+            if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], pad))
+            {
+                LOG_ERROR("OSD '" << name << "' failed to add Pad Probe Handler");
+                return DSL_RESULT_OSD_HANDLER_ADD_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("OSD '" << name << "' threw an exception adding Pad Probe Handler");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+   
+    DslReturnType Services::OsdPphRemove(const char* name, const char* handler, uint pad) 
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+
+            if (pad > DSL_PAD_SRC)
+            {
+                LOG_ERROR("Invalid Pad type = " << pad << " for OSD '" << name << "'");
+                return DSL_RESULT_PPH_PAD_TYPE_INVALID;
+            }
+
+            // call on the Handler to remove itself from the Osd
+            if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], pad))
+            {
+                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of OSD '" << name << "'");
+                return DSL_RESULT_OSD_HANDLER_REMOVE_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Osd '" << name << "' threw an exception removing ODE Handle");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+    }
+   
+    DslReturnType Services::SinkFakeNew(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            m_components[name] = DSL_FAKE_SINK_NEW(name);
+
+            LOG_INFO("New Fake Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppNew(const char* name, 
+        dsl_sink_app_new_data_handler_cb handler, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            m_components[name] = DSL_APP_SINK_NEW(name, handler, clientData);
+
+            LOG_INFO("New App Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppDataPull(const char* name, uint timeout, 
+        void** buffer, void** data, uint* size, void** batchMeta)
+    {
+        LOG_FUNC();
+
+        try
+        {
+            DSL_APP_SINK_PTR pSinkBintr;
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+                RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+                RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, AppSinkBintr);
+
+                pSinkBintr = std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+            }
+            // The pull can block for up to the timeout, so the services lock 
+            // is released first. The shared pointer keeps the Sink alive.
+            if (!pSinkBintr->PullData(timeout, buffer, data, size, batchMeta))
+            {
+                return DSL_RESULT_SINK_APP_DATA_NOT_AVAILABLE;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink '" << name << "' threw an exception pulling data");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppDataRelease(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, AppSinkBintr);
+
+            DSL_APP_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            pSinkBintr->ReleaseData();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink '" << name << "' threw an exception releasing data");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppMaxBuffersGet(const char* name, 
+        uint* maxBuffers, boolean* drop)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, AppSinkBintr);
+
+            DSL_APP_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            bool bDrop(false);
+            pSinkBintr->GetMaxBuffers(maxBuffers, &bDrop);
+            *drop = bDrop;
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink '" << name << "' threw an exception getting max-buffers");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppMaxBuffersSet(const char* name, 
+        uint maxBuffers, boolean drop)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, AppSinkBintr);
+
+            DSL_APP_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            if (!pSinkBintr->SetMaxBuffers(maxBuffers, drop))
+            {
+                LOG_ERROR("App Sink '" << name << "' failed to set max-buffers");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink '" << name << "' threw an exception setting max-buffers");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkMetaNew(const char* name, 
+        const char* path, uint mode, uint framesPerWrite)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            if (mode > DSL_META_SINK_MODE_SOCKET)
+            {   
+                LOG_ERROR("Invalid mode '" << mode << "' for new Meta Sink '" << name << "'");
+                return DSL_RESULT_SINK_META_MODE_INVALID;
+            }
+            m_components[name] = DSL_META_SINK_NEW(name, path, mode, framesPerWrite);
+
+            LOG_INFO("New Meta Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkMetaStatsGet(const char* name, 
+        uint64_t* framesWritten, uint64_t* framesDropped)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, MetaSinkBintr);
+
+            DSL_META_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<MetaSinkBintr>(m_components[name]);
+
+            pSinkBintr->GetStats(framesWritten, framesDropped);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta Sink '" << name << "' threw an exception getting stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkMetaStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, MetaSinkBintr);
+
+            DSL_META_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<MetaSinkBintr>(m_components[name]);
+
+            pSinkBintr->ClearStats();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta Sink '" << name << "' threw an exception clearing stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkOverlayNew(const char* name, uint overlay_id, uint display_id,
+        uint depth, uint offsetX, uint offsetY, uint width, uint height)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            m_components[name] = DSL_OVERLAY_SINK_NEW(
+                name, overlay_id, display_id, depth, offsetX, offsetY, width, height);
+
+            LOG_INFO("New Overlay Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SinkWindowNew(const char* name, 
+        uint offsetX, uint offsetY, uint width, uint height)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            m_components[name] = DSL_WINDOW_SINK_NEW(name, offsetX, offsetY, width, height);
+
+            LOG_INFO("New Window Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SinkRenderMaxFpsGet(const char* name, uint* maxFps)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_RENDER_SINK(m_components, name);
+
+            DSL_RENDER_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<RenderSinkBintr>(m_components[name]);
+
+            *maxFps = pSinkBintr->GetMaxFps();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Render Sink '" << name << "' threw an exception getting max fps");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRenderMaxFpsSet(const char* name, uint maxFps)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_RENDER_SINK(m_components, name);
+
+            DSL_RENDER_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<RenderSinkBintr>(m_components[name]);
+
+            pSinkBintr->SetMaxFps(maxFps);
+
+            LOG_INFO("Render Sink '" << name << "' set max fps = " << maxFps);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Render Sink '" << name << "' threw an exception setting max fps");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SinkWindowPauseWhenHiddenGet(const char* name, 
+        boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, WindowSinkBintr);
+
+            DSL_WINDOW_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<WindowSinkBintr>(m_components[name]);
+
+            *enabled = pSinkBintr->GetPauseWhenHidden();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Window Sink '" << name 
+                << "' threw an exception getting pause-when-hidden");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkWindowPauseWhenHiddenSet(const char* name, 
+        boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, WindowSinkBintr);
+
+            DSL_WINDOW_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<WindowSinkBintr>(m_components[name]);
+
+            pSinkBintr->SetPauseWhenHidden(enabled);
+
+            LOG_INFO("Window Sink '" << name << "' set pause-when-hidden = " << enabled);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Window Sink '" << name 
+                << "' threw an exception setting pause-when-hidden");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SinkFileNew(const char* name, const char* filepath, 
+            uint codec, uint container, uint bitrate, uint interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            if (codec > DSL_CODEC_MPEG4)
+            {   
+                LOG_ERROR("Invalid Codec value = " << codec << " for File Sink '" << name << "'");
+                return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
+            }
+            if (container > DSL_CONTAINER_MKV)
+            {   
+                LOG_ERROR("Invalid Container value = " << container << " for File Sink '" << name << "'");
+                return DSL_RESULT_SINK_CONTAINER_VALUE_INVALID;
+            }
+            m_components[name] = DSL_FILE_SINK_NEW(name, filepath, codec, container, bitrate, interval);
+            LOG_INFO("New File Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SinkSegmentNew(const char* name, const char* filePattern, 
+        uint codec, uint container, uint bitrate, uint interval,
+        uint maxDuration, uint maxFiles)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            if (codec > DSL_CODEC_MPEG4)
+            {   
+                LOG_ERROR("Invalid Codec value = " << codec << " for Segment Sink '" << name << "'");
+                return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
+            }
+            if (container > DSL_CONTAINER_MKV)
+            {   
+                LOG_ERROR("Invalid Container value = " << container << " for Segment Sink '" << name << "'");
+                return DSL_RESULT_SINK_CONTAINER_VALUE_INVALID;
+            }
+            
+            // the file pattern is used as a printf format for each segment index,
+            // and must hold exactly one integer directive, e.g. "%05d" 
+            uint directives(0);
+            bool validPattern(true);
+            for (const char* pChar = filePattern; *pChar; pChar++)
+            {
+                if (*pChar != '%')
+                {
+                    continue;
+                }
+                if (*(pChar+1) == '%')
+                {
+                    pChar++;
+                    continue;
+                }
+                pChar++;
+                while (isdigit(*pChar))
+                {
+                    pChar++;
+                }
+                if (*pChar != 'd' and *pChar != 'u' and *pChar != 'i')
+                {
+                    validPattern = false;
+                    break;
+                }
+                directives++;
+            }
+            if (!validPattern or directives != 1)
+            {
+                LOG_ERROR("Invalid file pattern '" << filePattern 
+                    << "' for Segment Sink '" << name << "'");
+                return DSL_RESULT_SINK_SEGMENT_PATTERN_INVALID;
+            }
+            m_components[name] = DSL_SEGMENT_SINK_NEW(name, filePattern, 
+                codec, container, bitrate, interval, maxDuration, maxFiles);
+            LOG_INFO("New Segment Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSegmentMaxDurationGet(const char* name, uint* maxDuration)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SegmentSinkBintr);
+
+            DSL_SEGMENT_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SegmentSinkBintr>(m_components[name]);
+
+            *maxDuration = pSinkBintr->GetMaxDuration();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Segment Sink '" << name << "' threw an exception getting max duration");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSegmentMaxDurationSet(const char* name, uint maxDuration)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SegmentSinkBintr);
+
+            DSL_SEGMENT_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SegmentSinkBintr>(m_components[name]);
+
+            pSinkBintr->SetMaxDuration(maxDuration);
+
+            LOG_INFO("Segment Sink '" << name << "' set max duration = " << maxDuration);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Segment Sink '" << name << "' threw an exception setting max duration");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSegmentMaxSizeGet(const char* name, uint64_t* maxSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SegmentSinkBintr);
+
+            DSL_SEGMENT_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SegmentSinkBintr>(m_components[name]);
+
+            *maxSize = pSinkBintr->GetMaxSize();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Segment Sink '" << name << "' threw an exception getting max size");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSegmentMaxSizeSet(const char* name, uint64_t maxSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SegmentSinkBintr);
+
+            DSL_SEGMENT_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SegmentSinkBintr>(m_components[name]);
+
+            pSinkBintr->SetMaxSize(maxSize);
+
+            LOG_INFO("Segment Sink '" << name << "' set max size = " << maxSize);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Segment Sink '" << name << "' threw an exception setting max size");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSegmentMaxFilesGet(const char* name, uint* maxFiles)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SegmentSinkBintr);
+
+            DSL_SEGMENT_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SegmentSinkBintr>(m_components[name]);
+
+            *maxFiles = pSinkBintr->GetMaxFiles();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Segment Sink '" << name << "' threw an exception getting max files");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSegmentMaxFilesSet(const char* name, uint maxFiles)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SegmentSinkBintr);
+
+            DSL_SEGMENT_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SegmentSinkBintr>(m_components[name]);
+
+            pSinkBintr->SetMaxFiles(maxFiles);
+
+            LOG_INFO("Segment Sink '" << name << "' set max files = " << maxFiles);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Segment Sink '" << name << "' threw an exception setting max files");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSegmentWriteSettingsGet(const char* name, 
+        uint* bufferSize, uint* fsyncInterval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SegmentSinkBintr);
+
+            DSL_SEGMENT_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SegmentSinkBintr>(m_components[name]);
+
+            pSinkBintr->GetWriteSettings(bufferSize, fsyncInterval);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Segment Sink '" << name << "' threw an exception getting write settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSegmentWriteSettingsSet(const char* name, 
+        uint bufferSize, uint fsyncInterval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SegmentSinkBintr);
+
+            if (m_components[name]->IsLinked())
+            {
+                LOG_ERROR("Unable to set write settings for Segment Sink '" << name 
+                    << "' as it's currently linked");
+                return DSL_RESULT_SINK_IS_IN_USE;
+            }
+
+            DSL_SEGMENT_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SegmentSinkBintr>(m_components[name]);
+
+            if (!pSinkBintr->SetWriteSettings(bufferSize, fsyncInterval))
+            {
+                LOG_ERROR("Segment Sink '" << name << "' failed to set write settings");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Segment Sink '" << name << "' threw an exception setting write settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSharedEncodeNew(const char* name, 
+        uint codec, uint bitrate, uint interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            if (codec > DSL_CODEC_MPEG4)
+            {   
+                LOG_ERROR("Invalid Codec value = " << codec << " for Shared Encode Sink '" << name << "'");
+                return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
+            }
+            m_components[name] = DSL_SHARED_ENCODE_SINK_NEW(name, codec, bitrate, interval);
+            
+            LOG_INFO("New Shared Encode Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Shared Encode Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSharedEncodeTapAdd(const char* name, const char* tap)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tap);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SharedEncodeSinkBintr);
+            RETURN_IF_COMPONENT_IS_NOT_TAP(m_components, tap);
+
+            if (m_components[tap]->IsInUse())
+            {
+                LOG_ERROR("Unable to add Tap '" << tap 
+                    << "' as it's currently in use");
+                return DSL_RESULT_TAP_IN_USE;
+            }
+
+            DSL_SHARED_ENCODE_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SharedEncodeSinkBintr>(m_components[name]);
+            DSL_TAP_PTR pTapBintr = 
+                std::dynamic_pointer_cast<TapBintr>(m_components[tap]);
+
+            if (!pSinkBintr->AddTap(pTapBintr))
+            {
+                LOG_ERROR("Shared Encode Sink '" << name 
+                    << "' failed to add Tap '" << tap << "'");
+                return DSL_RESULT_SINK_TAP_ADD_FAILED;
+            }
+            LOG_INFO("Tap '" << tap 
+                << "' added to Shared Encode Sink '" << name << "' successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Shared Encode Sink '" << name << "' threw an exception adding Tap");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSharedEncodeTapRemove(const char* name, const char* tap)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tap);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SharedEncodeSinkBintr);
+            RETURN_IF_COMPONENT_IS_NOT_TAP(m_components, tap);
+
+            DSL_SHARED_ENCODE_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SharedEncodeSinkBintr>(m_components[name]);
+            DSL_TAP_PTR pTapBintr = 
+                std::dynamic_pointer_cast<TapBintr>(m_components[tap]);
+
+            if (!pSinkBintr->RemoveTap(pTapBintr))
+            {
+                LOG_ERROR("Shared Encode Sink '" << name 
+                    << "' failed to remove Tap '" << tap << "'");
+                return DSL_RESULT_SINK_TAP_REMOVE_FAILED;
+            }
+            LOG_INFO("Tap '" << tap 
+                << "' removed from Shared Encode Sink '" << name << "' successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Shared Encode Sink '" << name << "' threw an exception removing Tap");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SinkRecordNew(const char* name, const char* outdir, uint codec, uint container, 
+        uint bitrate, uint interval, dsl_record_client_listner_cb clientListener)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            struct stat info;
+
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            // ensure outdir exists
+            if ((stat(outdir, &info) != 0) or !(info.st_mode & S_IFDIR))
+            {
+                LOG_ERROR("Unable to access outdir '" << outdir << "' for Record Sink '" << name << "'");
+                return DSL_RESULT_SINK_FILE_PATH_NOT_FOUND;
+            }
+
+            if (codec > DSL_CODEC_MPEG4)
+            {   
+                LOG_ERROR("Invalid Codec value = " << codec << " for Record Sink '" << name << "'");
+                return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
+            }
+            if (container > DSL_CONTAINER_MKV)
+            {   
+                LOG_ERROR("Invalid Container value = " << container << " for Record Sink '" << name << "'");
+                return DSL_RESULT_SINK_CONTAINER_VALUE_INVALID;
+            }
+
+            m_components[name] = DSL_RECORD_SINK_NEW(name, outdir, 
+                codec, container, bitrate, interval, (NvDsSRCallbackFunc)clientListener);
+            
+            LOG_INFO("New Record Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Record Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRecordSessionStart(const char* name, 
+        uint* session, uint start, uint duration, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+
+            DSL_RECORD_SINK_PTR recordSinkBintr = 
+                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+
+            if (!recordSinkBintr->StartSession(session, start, duration, clientData))
+            {
+                LOG_ERROR("Record Sink '" << name << "' failed to Start Session");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Record Sink'" << name << "' threw an exception setting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRecordSessionStop(const char* name, uint session)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+
+            DSL_RECORD_SINK_PTR recordSinkBintr = 
+                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+
+            if (!recordSinkBintr->StopSession(session))
+            {
+                LOG_ERROR("Record Sink '" << name << "' failed to Stop Session");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Record Sink'" << name << "' threw an exception setting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRecordCacheSizeGet(const char* name, uint* cacheSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+
+            DSL_RECORD_SINK_PTR recordSinkBintr = 
+                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            *cacheSize = recordSinkBintr->GetCacheSize();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Record Sink '" << name << "' threw an exception getting cache size");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRecordCacheSizeSet(const char* name, uint cacheSize)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+
+            DSL_RECORD_SINK_PTR recordSinkBintr = 
+                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!recordSinkBintr->SetCacheSize(cacheSize))
+            {
+                LOG_ERROR("Record Sink '" << name << "' failed to set cache size");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Record Sink '" << name << "' threw an exception setting s");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+        
+    DslReturnType Services::SinkRecordDimensionsGet(const char* name, uint* width, uint* height)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+
+            DSL_RECORD_SINK_PTR recordSinkBintr = 
+                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            recordSinkBintr->GetDimensions(width, height);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Record Sink '" << name << "' threw an exception getting dimensions");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRecordDimensionsSet(const char* name, uint width, uint height)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+
+
+            DSL_RECORD_SINK_PTR recordSinkBintr = 
+                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!recordSinkBintr->SetDimensions(width, height))
+            {
+                LOG_ERROR("Record Sink '" << name << "' failed to set dimensions");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Record Sink '" << name << "' threw an exception setting dimensions");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRecordIsOnGet(const char* name, boolean* isOn)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+
+            DSL_RECORD_SINK_PTR recordSinkBintr = 
+                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+
+            *isOn = recordSinkBintr->IsOn();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Record Sink '" << name << "' threw an exception getting is-recording-on flag");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRecordResetDoneGet(const char* name, boolean* resetDone)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordSinkBintr);
+
+            DSL_RECORD_SINK_PTR recordSinkBintr = 
+                std::dynamic_pointer_cast<RecordSinkBintr>(m_components[name]);
+
+            *resetDone = recordSinkBintr->ResetDone();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Record Sink '" << name << "' threw an exception getting reset done flag");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkEncodeVideoFormatsGet(const char* name, uint* codec, uint* container)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_ENCODE_SINK(m_components, name);
+
+            DSL_ENCODE_SINK_PTR encodeSinkBintr = 
+                std::dynamic_pointer_cast<EncodeSinkBintr>(m_components[name]);
+
+            encodeSinkBintr->GetVideoFormats(codec, container);
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("File Sink '" << name << "' threw an exception getting Video formats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkEncodeSettingsGet(const char* name, uint* bitrate, uint* interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_ENCODE_SINK(m_components, name);
+
+            DSL_ENCODE_SINK_PTR encodeSinkBintr = 
+                std::dynamic_pointer_cast<EncodeSinkBintr>(m_components[name]);
+
+            encodeSinkBintr->GetEncoderSettings(bitrate, interval);
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("File Sink '" << name << "' threw an exception getting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkEncodeSettingsSet(const char* name, uint bitrate, uint interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_ENCODE_SINK(m_components, name);
+
+            if (m_components[name]->IsLinked())
+            {
+                LOG_ERROR("Unable to set Encoder settings for File Sink '" << name 
+                    << "' as it's currently linked");
+                return DSL_RESULT_SINK_IS_IN_USE;
+            }
+
+            DSL_ENCODE_SINK_PTR encodeSinkBintr = 
+                std::dynamic_pointer_cast<EncodeSinkBintr>(m_components[name]);
+
+            if (!encodeSinkBintr->SetEncoderSettings(bitrate, interval))
+            {
+                LOG_ERROR("Encode Sink '" << name << "' failed to set Encoder settings");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("File Sink'" << name << "' threw an exception setting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRtspNew(const char* name, const char* host, 
+            uint udpPort, uint rtspPort, uint codec, uint bitrate, uint interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            if (codec > DSL_CODEC_H265)
+            {   
+                LOG_ERROR("Invalid Codec value = " << codec << " for File Sink '" << name << "'");
+                return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
+            }
+            m_components[name] = DSL_RTSP_SINK_NEW(name, host, udpPort, rtspPort, codec, bitrate, interval);
+
+            LOG_INFO("New RTSP Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New RTSP Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::SinkRtspServerSettingsGet(const char* name, uint* udpPort, uint* rtspPort, uint* codec)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            
+            DSL_RTSP_SINK_PTR rtspSinkBintr = 
+                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
+
+            rtspSinkBintr->GetServerSettings(udpPort, rtspPort, codec);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("RTSP Sink '" << name << "' threw an exception getting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRtspEncoderSettingsGet(const char* name, uint* bitrate, uint* interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
+
+            DSL_RTSP_SINK_PTR rtspSinkBintr = 
+                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
+
+            rtspSinkBintr->GetEncoderSettings(bitrate, interval);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("RTSP Sink '" << name << "' threw an exception getting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRtspEncoderSettingsSet(const char* name, uint bitrate, uint interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
+
+            DSL_RTSP_SINK_PTR rtspSinkBintr = 
+                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
+
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set Encoder settings for RTSP Sink '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_SINK_IS_IN_USE;
+            }
+
+            if (!rtspSinkBintr->SetEncoderSettings(bitrate, interval))
+            {
+                LOG_ERROR("RTSP Sink '" << name << "' failed to set Encoder settings");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("RTSP Sink '" << name << "' threw an exception setting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRtspBitrateAdaptiveGet(const char* name, 
+        boolean* enabled, uint* minBitrate, uint* maxBitrate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
+
+            DSL_RTSP_SINK_PTR rtspSinkBintr = 
+                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
+
+            bool bEnabled(false);
+            rtspSinkBintr->GetBitrateAdaptive(&bEnabled, minBitrate, maxBitrate);
+            *enabled = bEnabled;
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("RTSP Sink '" << name << "' threw an exception getting adaptive bitrate");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRtspBitrateAdaptiveSet(const char* name, 
+        boolean enabled, uint minBitrate, uint maxBitrate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
+
+            if (m_components[name]->IsLinked())
+            {
+                LOG_ERROR("Unable to set adaptive bitrate for RTSP Sink '" << name 
+                    << "' as it's currently linked");
+                return DSL_RESULT_SINK_IS_IN_USE;
+            }
+
+            DSL_RTSP_SINK_PTR rtspSinkBintr = 
+                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
+
+            if (!rtspSinkBintr->SetBitrateAdaptive(enabled, minBitrate, maxBitrate))
+            {
+                LOG_ERROR("RTSP Sink '" << name << "' failed to set adaptive bitrate");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("RTSP Sink '" << name << "' threw an exception setting adaptive bitrate");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkRtspStreamStatusGet(const char* name, 
+        uint* clientCount, uint* bitrate, boolean* isEncoding)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
+
+            DSL_RTSP_SINK_PTR rtspSinkBintr = 
+                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
+
+            bool bIsEncoding(false);
+            rtspSinkBintr->GetStreamStatus(clientCount, bitrate, &bIsEncoding);
+            *isEncoding = bIsEncoding;
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("RTSP Sink '" << name << "' threw an exception getting stream status");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkPphAdd(const char* name, const char* handler)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_SINK(m_components, name);
+            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+
+            // call on the Handler to add itself to the Tiler as a PadProbeHandler
+            if (!m_padProbeHandlers[handler]->AddToParent(m_components[name], DSL_PAD_SINK))
+            {
+                LOG_ERROR("SINK '" << name << "' failed to add Pad Probe Handler");
+                return DSL_RESULT_SINK_HANDLER_ADD_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Sink '" << name << "' threw an exception adding Pad Probe Handler");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+   
+    DslReturnType Services::SinkPphRemove(const char* name, const char* handler) 
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_SINK(m_components, name);
+            RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, handler);
+
+            // call on the Handler to remove itself from the Tee
+            if (!m_padProbeHandlers[handler]->RemoveFromParent(m_components[name], DSL_PAD_SINK))
+            {
+                LOG_ERROR("Pad Probe Handler '" << handler << "' is not a child of Tracker '" << name << "'");
+                return DSL_RESULT_SINK_HANDLER_REMOVE_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Sink '" << name << "' threw an exception removing Pad Probe Handler");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSyncSettingsGet(const char* name,  boolean* sync, boolean* async)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_SINK(m_components, name);
+
+            DSL_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SinkBintr>(m_components[name]);
+
+            bool bSync(false), bAsync(false);
+            pSinkBintr->GetSyncSettings(&bSync, &bAsync);
+            *sync = bSync;
+            *async = bAsync;
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Sink '" << name << "' threw an exception getting  Sync/Async settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkSyncSettingsSet(const char* name,  boolean sync, boolean async)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_SINK(m_components, name);
+
+            DSL_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SinkBintr>(m_components[name]);
+
+            if (!pSinkBintr->SetSyncSettings(sync, async))
+            {
+                LOG_ERROR("Sink '" << name << "' failed to set sync/async attributes");
+                return DSL_RESULT_SINK_HANDLER_REMOVE_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Sink '" << name << "' threw an exception setting sync/async settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    uint Services::SinkNumInUseGet()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        return GetNumSinksInUse();
+    }
+    
+    uint Services::SinkNumInUseMaxGet()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        return m_sinkNumInUseMax;
+    }
+    
+    boolean Services::SinkNumInUseMaxSet(uint max)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        uint numInUse(0);
+        
+        if (max < GetNumSinksInUse())
+        {
+            LOG_ERROR("max setting = " << max << 
+                " is less than the current number of Sinks in use = " << numInUse);
+            return false;
+        }
+        m_sinkNumInUseMax = max;
+        return true;
+    }
+
+    DslReturnType Services::ComponentDelete(const char* component)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        
+        if (m_components[component]->IsInUse())
+        {
+            LOG_INFO("Component '" << component << "' is in use");
+            return DSL_RESULT_COMPONENT_IN_USE;
+        }
+        m_components.erase(component);
+
+        LOG_INFO("Component '" << component << "' deleted successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::ComponentDeleteAll()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        // Only if there are Pipelines do we check if the component is in use.
+        if (m_pipelines.size())
+        {
+            for (auto const& imap: m_components)
+            {
+                // In the case of Delete all
+                if (imap.second->IsInUse())
+                {
+                    LOG_ERROR("Component '" << imap.second->GetName() << "' is currently in use");
+                    return DSL_RESULT_COMPONENT_IN_USE;
+                }
+            }
+        }
+
+        for (auto const& imap: m_components)
+        {
+            m_components.erase(imap.second->GetName());
+        }
+        LOG_INFO("All Components deleted successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    uint Services::ComponentListSize()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        return m_components.size();
+    }
+
+    DslReturnType Services::ComponentGpuIdGet(const char* component, uint* gpuid)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        
+        if (m_components[component]->IsInUse())
+        {
+            LOG_INFO("Component '" << component << "' is in use");
+            return DSL_RESULT_COMPONENT_IN_USE;
+        }
+        *gpuid = m_components[component]->GetGpuId();
+
+        LOG_INFO("Current GPU ID = " << *gpuid << " for component '" << component << "'");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::ComponentGpuIdSet(const char* component, uint gpuid)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        
+        if (m_components[component]->IsInUse())
+        {
+            LOG_INFO("Component '" << component << "' is in use");
+            return DSL_RESULT_COMPONENT_IN_USE;
+        }
+        if (!m_components[component]->SetGpuId(gpuid))
+        {
+            LOG_INFO("Component '" << component << "' faild to set GPU ID = " << gpuid);
+            return DSL_RESULT_COMPONENT_SET_GPUID_FAILED;
+        }
+
+        LOG_INFO("New GPU ID = " << gpuid << " for component '" << component << "'");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::BranchNew(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        if (m_components[name])
+        {   
+            LOG_ERROR("Branch name '" << name << "' is not unique");
+            return DSL_RESULT_BRANCH_NAME_NOT_UNIQUE;
+        }
+        try
+        {
+            m_components[name] = std::shared_ptr<Bintr>(new BranchBintr(name));
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Branch '" << name << "' threw exception on create");
+            return DSL_RESULT_BRANCH_THREW_EXCEPTION;
+        }
+        LOG_INFO("New BRANCH '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::BranchComponentAdd(const char* branch, 
+        const char* component)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+
+        try
+        {
+            // Can't add components if they're In use by another Pipeline
+            if (m_components[component]->IsInUse())
+            {
+                LOG_ERROR("Unable to add component '" << component 
+                    << "' as it's currently in use");
+                return DSL_RESULT_COMPONENT_IN_USE;
+            }
+
+            // Check for MAX Sources in Use - Do not exceed!
+            if (IsSourceComponent(component) )
+            {
+                LOG_ERROR("Can't add source '" << component << "' to branch '" << branch << 
+                    "' sources can only be added to Pipelines");
+                return DSL_RESULT_BRANCH_COMPONENT_ADD_FAILED;
+            }
+
+            if (IsSinkComponent(component) and (GetNumSinksInUse() == m_sinkNumInUseMax))
+            {
+                LOG_ERROR("Adding Sink '" << component << "' to Branch '" << branch << 
+                    "' would exceed the maximum num-in-use limit");
+                return DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED;
+            }
+            if (!m_components[component]->AddToParent(m_components[branch]))
+            {
+                LOG_ERROR("Branch '" << branch
+                    << "' failed to add component '" << component << "'");
+                return DSL_RESULT_BRANCH_COMPONENT_ADD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Branch '" << branch
+                << "' threw exception adding component '" << component << "'");
+            return DSL_RESULT_BRANCH_THREW_EXCEPTION;
+        }
+        LOG_INFO("Component '" << component 
+            << "' was added to Branch '" << branch << "' successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::BranchComponentRemove(const char* branch, 
+        const char* component)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+
+        if (!m_components[component]->IsParent(m_components[branch]))
+        {
+            LOG_ERROR("Component '" << component << 
+                "' is not in use by Branch '" << branch << "'");
+            return DSL_RESULT_COMPONENT_NOT_USED_BY_BRANCH;
+        }
+        try
+        {
+            if (!m_components[component]->RemoveFromParent(m_components[branch]))
+            {
+                LOG_ERROR("Branch '" << branch
+                    << "' failed to remove component '" << component << "'");
+                return DSL_RESULT_BRANCH_COMPONENT_REMOVE_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Branch '" << branch 
+                << "' threw an exception removing component");
+            return DSL_RESULT_BRANCH_COMPONENT_REMOVE_FAILED;
+        }
+        LOG_INFO("Component '" << component 
+            << "' was removed from Branch '" << branch << "' successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::PipelineNew(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        if (m_pipelines[name])
+        {   
+            LOG_ERROR("Pipeline name '" << name << "' is not unique");
+            return DSL_RESULT_PIPELINE_NAME_NOT_UNIQUE;
+        }
+        try
+        {
+            m_pipelines[name] = std::shared_ptr<PipelineBintr>(new PipelineBintr(name));
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Pipeline '" << name << "' threw exception on create");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        LOG_INFO("New PIPELINE '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineDelete(const char* pipeline)
+    {
+        LOG_FUNC();
+        
+        std::shared_ptr<PipelineBintr> pPipeline;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+            RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+            pPipeline = m_pipelines[pipeline];
+            pPipeline->RemoveAllChildren();
+            m_pipelines.erase(pipeline);
+        }
+        // Destroyed without the services mutex held, a client listener on 
+        // the Pipeline's main-context thread may be waiting on it.
+        pPipeline = nullptr;
+
+        LOG_INFO("Pipeline '" << pipeline << "' deleted successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineDeleteAll()
+    {
+        LOG_FUNC();
+        
+        std::vector<std::shared_ptr<PipelineBintr>> pipelines;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+            for (auto &imap: m_pipelines)
+            {
+                imap.second->RemoveAllChildren();
+                pipelines.push_back(imap.second);
+            }
+            m_pipelines.clear();
+        }
+        // Destroyed without the services mutex held, see PipelineDelete
+        pipelines.clear();
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    uint Services::PipelineListSize()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        return m_pipelines.size();
+    }
+    
+    DslReturnType Services::PipelineComponentAdd(const char* pipeline, 
+        const char* component)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        
+        try
+        {
+            // Can't add components if they're In use by another Pipeline
+            if (m_components[component]->IsInUse())
+            {
+                LOG_ERROR("Unable to add component '" << component 
+                    << "' as it's currently in use");
+                return DSL_RESULT_COMPONENT_IN_USE;
+            }
+
+            // Check for MAX Sources in Use - Do not exceed!
+            if (IsSourceComponent(component) and (GetNumSourcesInUse() == m_sourceNumInUseMax))
+            {
+                LOG_ERROR("Adding Source '" << component << "' to Pipeline '" << pipeline << 
+                    "' would exceed the maximum num-in-use limit");
+                return DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED;
+            }
+
+            if (IsSinkComponent(component) and (GetNumSinksInUse() == m_sinkNumInUseMax))
+            {
+                LOG_ERROR("Adding Sink '" << component << "' to Pipeline '" << pipeline << 
+                    "' would exceed the maximum num-in-use limit");
+                return DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED;
+            }
+
+            if (!m_components[component]->AddToParent(m_pipelines[pipeline]))
+            {
+                LOG_ERROR("Pipeline '" << pipeline
+                    << "' failed component '" << component << "'");
+                return DSL_RESULT_PIPELINE_COMPONENT_ADD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw exception adding component '" << component << "'");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        LOG_INFO("Component '" << component 
+            << "' was added to Pipeline '" << pipeline << "' successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }    
+    
+    DslReturnType Services::PipelineComponentRemove(const char* pipeline, 
+        const char* component)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+
+        if (!m_components[component]->IsParent(m_pipelines[pipeline]))
+        {
+            LOG_ERROR("Component '" << component << 
+                "' is not in use by Pipeline '" << pipeline << "'");
+            return DSL_RESULT_COMPONENT_NOT_USED_BY_PIPELINE;
+        }
+        try
+        {
+            m_components[component]->RemoveFromParent(m_pipelines[pipeline]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception removing component");
+            return DSL_RESULT_PIPELINE_COMPONENT_REMOVE_FAILED;
+        }
+        return DSL_RESULT_SUCCESS;
+}
+
+    DslReturnType Services::PipelineSourceStandbyAdd(const char* pipeline, 
+        const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, source);
+        RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, source);
+        
+        try
+        {
+            if (m_components[source]->IsInUse())
+            {
+                LOG_ERROR("Unable to add Source '" << source 
+                    << "' to standby as it's currently in use");
+                return DSL_RESULT_COMPONENT_IN_USE;
+            }
+            if (GetNumSourcesInUse() == m_sourceNumInUseMax)
+            {
+                LOG_ERROR("Adding Source '" << source << "' to Pipeline '" << pipeline << 
+                    "' would exceed the maximum num-in-use limit");
+                return DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED;
+            }
+            if (!m_pipelines[pipeline]->AddStandbySourceBintr(m_components[source]))
+            {
+                LOG_ERROR("Pipeline '" << pipeline
+                    << "' failed to add standby Source '" << source << "'");
+                return DSL_RESULT_PIPELINE_COMPONENT_ADD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw exception adding standby Source '" << source << "'");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        LOG_INFO("Source '" << source 
+            << "' was added to the standby pool of Pipeline '" << pipeline << "' successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::PipelineSourceStandbyRemove(const char* pipeline, 
+        const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, source);
+        
+        try
+        {
+            if (!m_pipelines[pipeline]->RemoveStandbySourceBintr(m_components[source]))
+            {
+                LOG_ERROR("Pipeline '" << pipeline
+                    << "' failed to remove standby Source '" << source << "'");
+                return DSL_RESULT_PIPELINE_COMPONENT_REMOVE_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw exception removing standby Source '" << source << "'");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        LOG_INFO("Source '" << source 
+            << "' was removed from the standby pool of Pipeline '" << pipeline << "' successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::PipelineSourceStandbyAttach(const char* pipeline, 
+        const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, source);
+        
+        try
+        {
+            if (!m_pipelines[pipeline]->AttachStandbySourceBintr(m_components[source]))
+            {
+                LOG_ERROR("Pipeline '" << pipeline
+                    << "' failed to attach standby Source '" << source << "'");
+                return DSL_RESULT_PIPELINE_SOURCE_ATTACH_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw exception attaching standby Source '" << source << "'");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        LOG_INFO("Standby Source '" << source 
+            << "' was attached to Pipeline '" << pipeline << "' successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::PipelineSourceStandbyDetach(const char* pipeline, 
+        const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, source);
+        
+        try
+        {
+            if (!m_pipelines[pipeline]->DetachStandbySourceBintr(m_components[source]))
+            {
+                LOG_ERROR("Pipeline '" << pipeline
+                    << "' failed to detach standby Source '" << source << "'");
+                return DSL_RESULT_PIPELINE_SOURCE_DETACH_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw exception detaching standby Source '" << source << "'");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        LOG_INFO("Standby Source '" << source 
+            << "' was detached from Pipeline '" << pipeline << "' successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    bool Services::PipelineSourceIsStandby(const char* pipeline, const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        if (m_pipelines.find(pipeline) == m_pipelines.end() or
+            m_components.find(source) == m_components.end())
+        {
+            return false;
+        }
+        return m_pipelines[pipeline]->IsStandbySourceBintrChild(m_components[source]);
+    }
+    
+    DslReturnType Services::PipelineStreamMuxBatchPropertiesGet(const char* pipeline,
+        uint* batchSize, uint* batchTimeout)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
+        {
+            m_pipelines[pipeline]->GetStreamMuxBatchProperties(batchSize, batchTimeout);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the Stream Muxer Batch Properties");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineStreamMuxBatchPropertiesSet(const char* pipeline,
+        uint batchSize, uint batchTimeout)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
+        {
+            if (!m_pipelines[pipeline]->SetStreamMuxBatchProperties(batchSize, batchTimeout))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Set the Stream Muxer Batch Properties");
+                return DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the Stream Muxer Batch Properties");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineStreamMuxDimensionsGet(const char* pipeline,
+        uint* width, uint* height)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
+        {
+            if (!m_pipelines[pipeline]->GetStreamMuxDimensions(width, height))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Get the Stream Muxer Output Dimensions");
+                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the Stream Muxer Output Dimensions");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+        
+    DslReturnType Services::PipelineStreamMuxDimensionsSet(const char* pipeline,
+        uint width, uint height)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
+        {
+            if (!m_pipelines[pipeline]->SetStreamMuxDimensions(width, height))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Set the Stream Muxer Output Dimensions");
+                return DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the Stream Muxer output size");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        m_sinkNumInUseMax = max;
-        return true;
+        return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::ComponentDelete(const char* component)
+        
+    DslReturnType Services::PipelineStreamMuxPaddingGet(const char* pipeline,
+        boolean* enabled)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
-        
-        if (m_components[component]->IsInUse())
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
         {
-            LOG_INFO("Component '" << component << "' is in use");
-            return DSL_RESULT_COMPONENT_IN_USE;
+            if (!m_pipelines[pipeline]->GetStreamMuxPadding((bool*)enabled))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Get the Stream Muxer is Padding enabled setting");
+                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw an exception getting the Stream Muxer padding");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        m_components.erase(component);
-
-        LOG_INFO("Component '" << component << "' deleted successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::ComponentDeleteAll()
+        
+    DslReturnType Services::PipelineStreamMuxPaddingSet(const char* pipeline,
+        boolean enabled)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
 
-        // Only if there are Pipelines do we check if the component is in use.
-        if (m_pipelines.size())
+        try
         {
-            for (auto const& imap: m_components)
+            if (!m_pipelines[pipeline]->SetStreamMuxPadding((bool)enabled))
             {
-                // In the case of Delete all
-                if (imap.second->IsInUse())
-                {
-                    LOG_ERROR("Component '" << imap.second->GetName() << "' is currently in use");
-                    return DSL_RESULT_COMPONENT_IN_USE;
-                }
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Get the Stream Muxer is Padding enabled setting");
+                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
             }
         }
-
-        for (auto const& imap: m_components)
+        catch(...)
         {
-            m_components.erase(imap.second->GetName());
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the Stream Muxer padding");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("All Components deleted successfully");
-
         return DSL_RESULT_SUCCESS;
     }
 
-    uint Services::ComponentListSize()
+    DslReturnType Services::PipelineStreamMuxBatchTimeoutAdaptiveGet(const char* pipeline,
+        boolean* enabled, uint* jitterMargin)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        return m_components.size();
-    }
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
 
-    DslReturnType Services::ComponentGpuIdGet(const char* component, uint* gpuid)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
-        
-        if (m_components[component]->IsInUse())
+        try
         {
-            LOG_INFO("Component '" << component << "' is in use");
-            return DSL_RESULT_COMPONENT_IN_USE;
+            bool bEnabled(false);
+            m_pipelines[pipeline]->GetStreamMuxBatchTimeoutAdaptive(&bEnabled, jitterMargin);
+            *enabled = bEnabled;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the Stream Muxer adaptive batch-timeout");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        *gpuid = m_components[component]->GetGpuId();
-
-        LOG_INFO("Current GPU ID = " << *gpuid << " for component '" << component << "'");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::ComponentGpuIdSet(const char* component, uint gpuid)
+        
+    DslReturnType Services::PipelineStreamMuxBatchTimeoutAdaptiveSet(const char* pipeline,
+        boolean enabled, uint jitterMargin)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
-        
-        if (m_components[component]->IsInUse())
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
         {
-            LOG_INFO("Component '" << component << "' is in use");
-            return DSL_RESULT_COMPONENT_IN_USE;
+            if (!m_pipelines[pipeline]->SetStreamMuxBatchTimeoutAdaptive((bool)enabled, 
+                jitterMargin))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Set the Stream Muxer adaptive batch-timeout");
+                return DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED;
+            }
         }
-        if (!m_components[component]->SetGpuId(gpuid))
+        catch(...)
         {
-            LOG_INFO("Component '" << component << "' faild to set GPU ID = " << gpuid);
-            return DSL_RESULT_COMPONENT_SET_GPUID_FAILED;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the Stream Muxer adaptive batch-timeout");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-
-        LOG_INFO("New GPU ID = " << gpuid << " for component '" << component << "'");
-
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::BranchNew(const char* name)
+        
+    DslReturnType Services::PipelineStreamMuxBatchStatsGet(const char* pipeline,
+        uint* batchTimeout, double* fillRatio)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (m_components[name])
-        {   
-            LOG_ERROR("Branch name '" << name << "' is not unique");
-            return DSL_RESULT_BRANCH_NAME_NOT_UNIQUE;
-        }
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
         try
         {
-            m_components[name] = std::shared_ptr<Bintr>(new BranchBintr(name));
+            m_pipelines[pipeline]->GetStreamMuxBatchStats(batchTimeout, fillRatio);
         }
         catch(...)
         {
-            LOG_ERROR("New Branch '" << name << "' threw exception on create");
-            return DSL_RESULT_BRANCH_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the Stream Muxer batch stats");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("New BRANCH '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::BranchComponentAdd(const char* branch, 
-        const char* component)
+    DslReturnType Services::PipelineStreamMuxBatchSizeAdaptiveGet(const char* pipeline,
+        boolean* enabled, uint* hysteresis)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
 
         try
         {
-            // Can't add components if they're In use by another Pipeline
-            if (m_components[component]->IsInUse())
-            {
-                LOG_ERROR("Unable to add component '" << component 
-                    << "' as it's currently in use");
-                return DSL_RESULT_COMPONENT_IN_USE;
-            }
-
-            // Check for MAX Sources in Use - Do not exceed!
-            if (IsSourceComponent(component) )
-            {
-                LOG_ERROR("Can't add source '" << component << "' to branch '" << branch << 
-                    "' sources can only be added to Pipelines");
-                return DSL_RESULT_BRANCH_COMPONENT_ADD_FAILED;
-            }
-
-            if (IsSinkComponent(component) and (GetNumSinksInUse() == m_sinkNumInUseMax))
-            {
-                LOG_ERROR("Adding Sink '" << component << "' to Branch '" << branch << 
-                    "' would exceed the maximum num-in-use limit");
-                return DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED;
-            }
-            if (!m_components[component]->AddToParent(m_components[branch]))
-            {
-                LOG_ERROR("Branch '" << branch
-                    << "' failed to add component '" << component << "'");
-                return DSL_RESULT_BRANCH_COMPONENT_ADD_FAILED;
-            }
+            bool bEnabled(false);
+            m_pipelines[pipeline]->GetStreamMuxBatchSizeAdaptive(&bEnabled, hysteresis);
+            *enabled = bEnabled;
         }
         catch(...)
         {
-            LOG_ERROR("Branch '" << branch
-                << "' threw exception adding component '" << component << "'");
-            return DSL_RESULT_BRANCH_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the Stream Muxer adaptive batch-size");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("Component '" << component 
-            << "' was added to Branch '" << branch << "' successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::BranchComponentRemove(const char* branch, 
-        const char* component)
+        
+    DslReturnType Services::PipelineStreamMuxBatchSizeAdaptiveSet(const char* pipeline,
+        boolean enabled, uint hysteresis)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
 
-        if (!m_components[component]->IsParent(m_components[branch]))
-        {
-            LOG_ERROR("Component '" << component << 
-                "' is not in use by Branch '" << branch << "'");
-            return DSL_RESULT_COMPONENT_NOT_USED_BY_BRANCH;
-        }
         try
         {
-            if (!m_components[component]->RemoveFromParent(m_components[branch]))
+            if (!m_pipelines[pipeline]->SetStreamMuxBatchSizeAdaptive((bool)enabled, 
+                hysteresis))
             {
-                LOG_ERROR("Branch '" << branch
-                    << "' failed to remove component '" << component << "'");
-                return DSL_RESULT_BRANCH_COMPONENT_REMOVE_FAILED;
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Set the Stream Muxer adaptive batch-size");
+                return DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Branch '" << branch 
-                << "' threw an exception removing component");
-            return DSL_RESULT_BRANCH_COMPONENT_REMOVE_FAILED;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the Stream Muxer adaptive batch-size");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("Component '" << component 
-            << "' was removed from Branch '" << branch << "' successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::PipelineNew(const char* name)
+
+    DslReturnType Services::PipelineSgieCacheSettingsGet(const char* pipeline,
+        boolean* enabled, uint* maxAge, float* minConfidence)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (m_pipelines[name])
-        {   
-            LOG_ERROR("Pipeline name '" << name << "' is not unique");
-            return DSL_RESULT_PIPELINE_NAME_NOT_UNIQUE;
-        }
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
         try
         {
-            m_pipelines[name] = std::shared_ptr<PipelineBintr>(new PipelineBintr(name));
+            bool bEnabled(false);
+            m_pipelines[pipeline]->GetSgieCacheSettings(&bEnabled, maxAge, minConfidence);
+            *enabled = bEnabled;
         }
         catch(...)
         {
-            LOG_ERROR("New Pipeline '" << name << "' threw exception on create");
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the SGIE result cache settings");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("New PIPELINE '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::PipelineDelete(const char* pipeline)
+        
+    DslReturnType Services::PipelineSgieCacheSettingsSet(const char* pipeline,
+        boolean enabled, uint maxAge, float minConfidence)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
 
-        m_pipelines[pipeline]->RemoveAllChildren();
-        m_pipelines.erase(pipeline);
-
-        LOG_INFO("Pipeline '" << pipeline << "' deleted successfully");
-
+        try
+        {
+            if (!m_pipelines[pipeline]->SetSgieCacheSettings((bool)enabled, 
+                maxAge, minConfidence))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Set the SGIE result cache settings");
+                return DSL_RESULT_PIPELINE_SGIE_CACHE_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the SGIE result cache settings");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::PipelineDeleteAll()
+        
+    DslReturnType Services::PipelineSgieCacheStatsGet(const char* pipeline,
+        uint64_t* hits, uint64_t* misses)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
 
-        for (auto &imap: m_pipelines)
+        try
         {
-            imap.second->RemoveAllChildren();
-            imap.second = nullptr;
+            m_pipelines[pipeline]->GetSgieCacheStats(hits, misses);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the SGIE result cache stats");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        m_pipelines.clear();
-
         return DSL_RESULT_SUCCESS;
     }
-
-    uint Services::PipelineListSize()
+        
+    DslReturnType Services::PipelineMainContextEnabledGet(const char* pipeline,
+        boolean* enabled)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        return m_pipelines.size();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
+        {
+            *enabled = m_pipelines[pipeline]->GetMainContextEnabled();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the main-context setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::PipelineComponentAdd(const char* pipeline, 
-        const char* component)
+        
+    DslReturnType Services::PipelineMainContextEnabledSet(const char* pipeline,
+        boolean enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
         
-        try
+        std::shared_ptr<PipelineBintr> pPipeline;
         {
-            // Can't add components if they're In use by another Pipeline
-            if (m_components[component]->IsInUse())
-            {
-                LOG_ERROR("Unable to add component '" << component 
-                    << "' as it's currently in use");
-                return DSL_RESULT_COMPONENT_IN_USE;
-            }
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+            RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
 
-            // Check for MAX Sources in Use - Do not exceed!
-            if (IsSourceComponent(component) and (GetNumSourcesInUse() == m_sourceNumInUseMax))
+            try
             {
-                LOG_ERROR("Adding Source '" << component << "' to Pipeline '" << pipeline << 
-                    "' would exceed the maximum num-in-use limit");
-                return DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED;
+                pPipeline = m_pipelines[pipeline];
+                if (!pPipeline->SetMainContextEnabled((bool)enabled))
+                {
+                    LOG_ERROR("Pipeline '" << pipeline 
+                        << "' failed to Set the main-context setting");
+                    return DSL_RESULT_PIPELINE_MAIN_CONTEXT_SET_FAILED;
+                }
             }
-
-            if (IsSinkComponent(component) and (GetNumSinksInUse() == m_sinkNumInUseMax))
+            catch(...)
             {
-                LOG_ERROR("Adding Sink '" << component << "' to Pipeline '" << pipeline << 
-                    "' would exceed the maximum num-in-use limit");
-                return DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED;
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' threw an exception setting the main-context setting");
+                return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
             }
+        }
+        // A disabled main-context's thread is joined without the services 
+        // mutex held, see PipelineDelete
+        pPipeline->JoinStoppedMainContexts();
+        
+        return DSL_RESULT_SUCCESS;
+    }
+        
+    DslReturnType Services::PipelineQosElementStatsGet(const char* pipeline,
+        const char* element, uint64_t* processed, uint64_t* dropped, 
+        int64_t* jitter, double* proportion)    
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
 
-            if (!m_components[component]->AddToParent(m_pipelines[pipeline]))
+        try
+        {
+            QosElementStats stats;
+            if (!m_pipelines[pipeline]->GetQosElementStats(element, &stats))
             {
-                LOG_ERROR("Pipeline '" << pipeline
-                    << "' failed component '" << component << "'");
-                return DSL_RESULT_PIPELINE_COMPONENT_ADD_FAILED;
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' has no QoS counters for element '" << element << "'");
+                return DSL_RESULT_PIPELINE_QOS_ELEMENT_NOT_FOUND;
             }
+            *processed = stats.processed;
+            *dropped = stats.dropped;
+            *jitter = stats.jitter;
+            *proportion = stats.proportion;
         }
         catch(...)
         {
-            LOG_ERROR("Pipeline '" << pipeline
-                << "' threw exception adding component '" << component << "'");
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting QoS counters");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("Component '" << component 
-            << "' was added to Pipeline '" << pipeline << "' successfully");
-
         return DSL_RESULT_SUCCESS;
-    }    
-    
-    DslReturnType Services::PipelineComponentRemove(const char* pipeline, 
-        const char* component)
+    }
+        
+    DslReturnType Services::PipelineQosTotalsGet(const char* pipeline,
+        uint* elements, uint64_t* dropped)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
 
-        if (!m_components[component]->IsParent(m_pipelines[pipeline]))
-        {
-            LOG_ERROR("Component '" << component << 
-                "' is not in use by Pipeline '" << pipeline << "'");
-            return DSL_RESULT_COMPONENT_NOT_USED_BY_PIPELINE;
-        }
         try
         {
-            m_components[component]->RemoveFromParent(m_pipelines[pipeline]);
+            m_pipelines[pipeline]->GetQosTotals(elements, dropped);
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception removing component");
-            return DSL_RESULT_PIPELINE_COMPONENT_REMOVE_FAILED;
+                << "' threw an exception getting QoS totals");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
-}
-    
-    DslReturnType Services::PipelineStreamMuxBatchPropertiesGet(const char* pipeline,
-        uint* batchSize, uint* batchTimeout)    
+    }
+        
+    DslReturnType Services::PipelineQosStatsClear(const char* pipeline)    
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -6663,19 +9396,19 @@ namespace DSL
 
         try
         {
-            m_pipelines[pipeline]->GetStreamMuxBatchProperties(batchSize, batchTimeout);
+            m_pipelines[pipeline]->ClearQosStats();
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception getting the Stream Muxer Batch Properties");
+                << "' threw an exception clearing QoS counters");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::PipelineStreamMuxBatchPropertiesSet(const char* pipeline,
-        uint batchSize, uint batchTimeout)    
+    
+    DslReturnType Services::PipelineQosListenerAdd(const char* pipeline, 
+        dsl_qos_listener_cb listener, uint threshold, void* clientData)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -6683,117 +9416,116 @@ namespace DSL
 
         try
         {
-            if (!m_pipelines[pipeline]->SetStreamMuxBatchProperties(batchSize, batchTimeout))
+            if (!m_pipelines[pipeline]->AddQosListener(listener, threshold, clientData))
             {
                 LOG_ERROR("Pipeline '" << pipeline 
-                    << "' failed to Set the Stream Muxer Batch Properties");
-                return DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED;
+                    << "' failed to add a QoS Listener");
+                return DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED;
             }
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception setting the Stream Muxer Batch Properties");
+                << "' threw an exception adding a QoS Listener");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::PipelineStreamMuxDimensionsGet(const char* pipeline,
-        uint* width, uint* height)    
+        
+    DslReturnType Services::PipelineQosListenerRemove(const char* pipeline, 
+        dsl_qos_listener_cb listener)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
-
+    
         try
         {
-            if (!m_pipelines[pipeline]->GetStreamMuxDimensions(width, height))
+            if (!m_pipelines[pipeline]->RemoveQosListener(listener))
             {
                 LOG_ERROR("Pipeline '" << pipeline 
-                    << "' failed to Get the Stream Muxer Output Dimensions");
-                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
+                    << "' failed to remove a QoS Listener");
+                return DSL_RESULT_PIPELINE_CALLBACK_REMOVE_FAILED;
             }
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception setting the Stream Muxer Output Dimensions");
+                << "' threw an exception removing a QoS Listener");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
         
-    DslReturnType Services::PipelineStreamMuxDimensionsSet(const char* pipeline,
-        uint width, uint height)    
+    DslReturnType Services::PipelineThreadPolicySet(const char* pipeline, 
+        const char* component, uint64_t cpuMask, uint schedPolicy, int priority)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
-
+    
         try
         {
-            if (!m_pipelines[pipeline]->SetStreamMuxDimensions(width, height))
+            ThreadPolicy policy = {cpuMask, schedPolicy, priority};
+            
+            if (!m_pipelines[pipeline]->SetThreadPolicy(component, policy))
             {
                 LOG_ERROR("Pipeline '" << pipeline 
-                    << "' failed to Set the Stream Muxer Output Dimensions");
-                return DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED;
+                    << "' failed to set the Thread Policy for '" << component << "'");
+                return DSL_RESULT_PIPELINE_THREAD_POLICY_SET_FAILED;
             }
+            LOG_INFO("Pipeline '" << pipeline 
+                << "' set the Thread Policy for '" << component << "' successfully");
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception setting the Stream Muxer output size");
+                << "' threw an exception setting a Thread Policy");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
         
-    DslReturnType Services::PipelineStreamMuxPaddingGet(const char* pipeline,
-        boolean* enabled)    
+    DslReturnType Services::PipelineThreadPolicyRemove(const char* pipeline, 
+        const char* component)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
-
+    
         try
         {
-            if (!m_pipelines[pipeline]->GetStreamMuxPadding((bool*)enabled))
+            if (!m_pipelines[pipeline]->RemoveThreadPolicy(component))
             {
                 LOG_ERROR("Pipeline '" << pipeline 
-                    << "' failed to Get the Stream Muxer is Padding enabled setting");
-                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
+                    << "' failed to remove the Thread Policy for '" << component << "'");
+                return DSL_RESULT_PIPELINE_THREAD_POLICY_REMOVE_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Pipeline '" << pipeline
-                << "' threw an exception getting the Stream Muxer padding");
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception removing a Thread Policy");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
         
-    DslReturnType Services::PipelineStreamMuxPaddingSet(const char* pipeline,
-        boolean enabled)    
+    DslReturnType Services::PipelineThreadReportGet(const char* pipeline, 
+        const char** report)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
-
+    
         try
         {
-            if (!m_pipelines[pipeline]->SetStreamMuxPadding((bool)enabled))
-            {
-                LOG_ERROR("Pipeline '" << pipeline 
-                    << "' failed to Get the Stream Muxer is Padding enabled setting");
-                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
-            }
+            *report = m_pipelines[pipeline]->GetThreadReport();
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception setting the Stream Muxer padding");
+                << "' threw an exception getting the Thread Report");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
@@ -7222,12 +9954,195 @@ namespace DSL
         return DSL_RESULT_SUCCESS;
     }
 
+    DslReturnType Services::MetricsHttpExporterStart(uint port)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            if (!MetricsRegistry::GetRegistry()->StartHttpExporter(port))
+            {
+                LOG_ERROR("Failed to start the Metrics HTTP exporter on port " << port);
+                return DSL_RESULT_METRICS_EXPORTER_START_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Metrics HTTP exporter threw an exception on start");
+            return DSL_RESULT_METRICS_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::MetricsHttpExporterStop()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            if (!MetricsRegistry::GetRegistry()->StopHttpExporter())
+            {
+                LOG_ERROR("Failed to stop the Metrics HTTP exporter");
+                return DSL_RESULT_METRICS_EXPORTER_STOP_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Metrics HTTP exporter threw an exception on stop");
+            return DSL_RESULT_METRICS_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::MetricsFileExporterStart(const char* filePath, uint interval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            if (!MetricsRegistry::GetRegistry()->StartFileExporter(filePath, interval))
+            {
+                LOG_ERROR("Failed to start the Metrics file exporter for file '" 
+                    << filePath << "'");
+                return DSL_RESULT_METRICS_EXPORTER_START_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Metrics file exporter threw an exception on start");
+            return DSL_RESULT_METRICS_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::MetricsFileExporterStop()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            if (!MetricsRegistry::GetRegistry()->StopFileExporter())
+            {
+                LOG_ERROR("Failed to stop the Metrics file exporter");
+                return DSL_RESULT_METRICS_EXPORTER_STOP_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Metrics file exporter threw an exception on stop");
+            return DSL_RESULT_METRICS_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    uint Services::MetricsListSize()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        return MetricsRegistry::GetRegistry()->GetSize();
+    }
+
+    DslReturnType Services::PluginLoad(const char* name, const char* path)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            if (m_plugins.find(name) != m_plugins.end())
+            {   
+                LOG_ERROR("Plugin name '" << name << "' is not unique");
+                return DSL_RESULT_PLUGIN_NAME_NOT_UNIQUE;
+            }
+            std::ifstream pluginFile(path);
+            if (!pluginFile.good())
+            {
+                LOG_ERROR("Plugin file '" << path << "' Not found");
+                return DSL_RESULT_PLUGIN_FILE_NOT_FOUND;
+            }
+            DSL_PLUGIN_PTR pPlugin = DSL_PLUGIN_NEW(name, path);
+            if (!pPlugin->GetInfo())
+            {
+                return DSL_RESULT_PLUGIN_LOAD_FAILED;
+            }
+            m_plugins[name] = pPlugin;
+            
+            LOG_INFO("New Plugin '" << name << "' loaded successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Plugin '" << name << "' threw exception on load");
+            return DSL_RESULT_PLUGIN_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PluginDelete(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            RETURN_IF_PLUGIN_NAME_NOT_FOUND(m_plugins, name);
+            
+            // Objects created from the Plugin keep it loaded until deleted
+            m_plugins.erase(name);
+
+            LOG_INFO("Plugin '" << name << "' deleted successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Plugin '" << name << "' threw an exception on deletion");
+            return DSL_RESULT_PLUGIN_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PluginDeleteAll()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        try
+        {
+            m_plugins.clear();
+
+            LOG_INFO("All Plugins deleted successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Plugin threw an exception on delete all");
+            return DSL_RESULT_PLUGIN_THREW_EXCEPTION;
+        }
+    }
+
+    uint Services::PluginListSize()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        return m_plugins.size();
+    }
+
     bool Services::IsSourceComponent(const char* component)
     {
         LOG_FUNC();
      
         return (m_components[component]->IsType(typeid(CsiSourceBintr)) or 
             m_components[component]->IsType(typeid(UriSourceBintr)) or
+            m_components[component]->IsType(typeid(PlaylistSourceBintr)) or
+            m_components[component]->IsType(typeid(TestSourceBintr)) or
+            m_components[component]->IsType(typeid(AppSourceBintr)) or
             m_components[component]->IsType(typeid(RtspSourceBintr)));
     }
  
@@ -7249,9 +10164,13 @@ namespace DSL
         LOG_FUNC();
      
         return (m_components[component]->IsType(typeid(FakeSinkBintr)) or 
+            m_components[component]->IsType(typeid(AppSinkBintr)) or
+            m_components[component]->IsType(typeid(MetaSinkBintr)) or
             m_components[component]->IsType(typeid(OverlaySinkBintr)) or
             m_components[component]->IsType(typeid(WindowSinkBintr)) or
             m_components[component]->IsType(typeid(FileSinkBintr)) or
+            m_components[component]->IsType(typeid(SegmentSinkBintr)) or
+            m_components[component]->IsType(typeid(SharedEncodeSinkBintr)) or
             m_components[component]->IsType(typeid(RtspSinkBintr)));
     }
  
@@ -7338,6 +10257,10 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_SOURCE_TAP_ADD_FAILED] = L"DSL_RESULT_SOURCE_TAP_ADD_FAILED";
         m_returnValueToString[DSL_RESULT_SOURCE_TAP_REMOVE_FAILED] = L"DSL_RESULT_SOURCE_TAP_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE] = L"DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE";
+        m_returnValueToString[DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED] = L"DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED";
+        m_returnValueToString[DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED] = L"DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED";
+        m_returnValueToString[DSL_RESULT_SOURCE_SET_FAILED] = L"DSL_RESULT_SOURCE_SET_FAILED";
+        m_returnValueToString[DSL_RESULT_SOURCE_BUFFER_PUSH_FAILED] = L"DSL_RESULT_SOURCE_BUFFER_PUSH_FAILED";
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE] = L"DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_NOT_FOUND] = L"DSL_RESULT_DEWARPER_NAME_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_BAD_FORMAT] = L"DSL_RESULT_DEWARPER_NAME_BAD_FORMAT";
@@ -7355,6 +10278,7 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_TRACKER_HANDLER_REMOVE_FAILED] = L"DSL_RESULT_TRACKER_HANDLER_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_TRACKER_PAD_TYPE_INVALID] = L"DSL_RESULT_TRACKER_PAD_TYPE_INVALID";
         m_returnValueToString[DSL_RESULT_TRACKER_COMPONENT_IS_NOT_TRACKER] = L"DSL_RESULT_TRACKER_COMPONENT_IS_NOT_TRACKER";
+        m_returnValueToString[DSL_RESULT_TRACKER_SETTINGS_INVALID] = L"DSL_RESULT_TRACKER_SETTINGS_INVALID";
         m_returnValueToString[DSL_RESULT_PPH_NAME_NOT_UNIQUE] = L"DSL_RESULT_PPH_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_PPH_NAME_NOT_FOUND] = L"DSL_RESULT_PPH_NAME_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_PPH_NAME_BAD_FORMAT] = L"DSL_RESULT_PPH_NAME_BAD_FORMAT";
@@ -7407,6 +10331,12 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_REMOVE_FAILED] = L"DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_SINK_HANDLER_ADD_FAILED] = L"DSL_RESULT_SINK_HANDLER_ADD_FAILED";
         m_returnValueToString[DSL_RESULT_SINK_HANDLER_REMOVE_FAILED] = L"DSL_RESULT_SINK_HANDLER_REMOVE_FAILED";
+        m_returnValueToString[DSL_RESULT_SINK_APP_DATA_NOT_AVAILABLE] = L"DSL_RESULT_SINK_APP_DATA_NOT_AVAILABLE";
+        m_returnValueToString[DSL_RESULT_SINK_META_MODE_INVALID] = L"DSL_RESULT_SINK_META_MODE_INVALID";
+        m_returnValueToString[DSL_RESULT_SINK_SEGMENT_PATTERN_INVALID] = L"DSL_RESULT_SINK_SEGMENT_PATTERN_INVALID";
+        m_returnValueToString[DSL_RESULT_SINK_TAP_ADD_FAILED] = L"DSL_RESULT_SINK_TAP_ADD_FAILED";
+        m_returnValueToString[DSL_RESULT_SINK_TAP_REMOVE_FAILED] = L"DSL_RESULT_SINK_TAP_REMOVE_FAILED";
+        m_returnValueToString[DSL_RESULT_SINK_COMPONENT_IS_NOT_RENDER_SINK] = L"DSL_RESULT_SINK_COMPONENT_IS_NOT_RENDER_SINK";
         m_returnValueToString[DSL_RESULT_OSD_NAME_NOT_UNIQUE] = L"DSL_RESULT_OSD_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_OSD_NAME_NOT_FOUND] = L"DSL_RESULT_OSD_NAME_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_OSD_NAME_BAD_FORMAT] = L"DSL_RESULT_OSD_NAME_BAD_FORMAT";
@@ -7432,6 +10362,8 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_GIE_PAD_TYPE_INVALID] = L"DSL_RESULT_GIE_PAD_TYPE_INVALID";
         m_returnValueToString[DSL_RESULT_GIE_COMPONENT_IS_NOT_GIE] = L"DSL_RESULT_GIE_COMPONENT_IS_NOT_GIE";
         m_returnValueToString[DSL_RESULT_GIE_OUTPUT_DIR_DOES_NOT_EXIST] = L"DSL_RESULT_GIE_OUTPUT_DIR_DOES_NOT_EXIST";
+        m_returnValueToString[DSL_RESULT_GIE_LISTENER_ADD_FAILED] = L"DSL_RESULT_GIE_LISTENER_ADD_FAILED";
+        m_returnValueToString[DSL_RESULT_GIE_LISTENER_REMOVE_FAILED] = L"DSL_RESULT_GIE_LISTENER_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_TEE_NAME_NOT_UNIQUE] = L"DSL_RESULT_TEE_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_TEE_NAME_NOT_FOUND] = L"DSL_RESULT_TEE_NAME_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_TEE_NAME_BAD_FORMAT] = L"DSL_RESULT_TEE_NAME_BAD_FORMAT";
@@ -7482,6 +10414,13 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_PIPELINE_FAILED_TO_STOP] = L"DSL_RESULT_PIPELINE_FAILED_TO_STOP";
         m_returnValueToString[DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED] = L"DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED";
         m_returnValueToString[DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED] = L"DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_SOURCE_ATTACH_FAILED] = L"DSL_RESULT_PIPELINE_SOURCE_ATTACH_FAILED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_SOURCE_DETACH_FAILED] = L"DSL_RESULT_PIPELINE_SOURCE_DETACH_FAILED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_SGIE_CACHE_SET_FAILED] = L"DSL_RESULT_PIPELINE_SGIE_CACHE_SET_FAILED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_MAIN_CONTEXT_SET_FAILED] = L"DSL_RESULT_PIPELINE_MAIN_CONTEXT_SET_FAILED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_QOS_ELEMENT_NOT_FOUND] = L"DSL_RESULT_PIPELINE_QOS_ELEMENT_NOT_FOUND";
+        m_returnValueToString[DSL_RESULT_PIPELINE_THREAD_POLICY_SET_FAILED] = L"DSL_RESULT_PIPELINE_THREAD_POLICY_SET_FAILED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_THREAD_POLICY_REMOVE_FAILED] = L"DSL_RESULT_PIPELINE_THREAD_POLICY_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_DISPLAY_TYPE_THREW_EXCEPTION] = L"DSL_RESULT_DISPLAY_TYPE_THREW_EXCEPTION";
         m_returnValueToString[DSL_RESULT_DISPLAY_TYPE_IN_USE] = L"DSL_RESULT_DISPLAY_TYPE_IN_USE";
         m_returnValueToString[DSL_RESULT_DISPLAY_TYPE_NAME_NOT_UNIQUE] = L"DSL_RESULT_DISPLAY_TYPE_NAME_NOT_UNIQUE";
@@ -7507,6 +10446,17 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_TAP_SET_FAILED] = L"DSL_RESULT_TAP_SET_FAILED";
         m_returnValueToString[DSL_RESULT_TAP_FILE_PATH_NOT_FOUND] = L"DSL_RESULT_TAP_FILE_PATH_NOT_FOUND";
         m_returnValueToString[DSL_RESULT_TAP_CONTAINER_VALUE_INVALID] = L"DSL_RESULT_TAP_CONTAINER_VALUE_INVALID";
+        m_returnValueToString[DSL_RESULT_TAP_CODEC_VALUE_INVALID] = L"DSL_RESULT_TAP_CODEC_VALUE_INVALID";
+        m_returnValueToString[DSL_RESULT_METRICS_THREW_EXCEPTION] = L"DSL_RESULT_METRICS_THREW_EXCEPTION";
+        m_returnValueToString[DSL_RESULT_METRICS_EXPORTER_START_FAILED] = L"DSL_RESULT_METRICS_EXPORTER_START_FAILED";
+        m_returnValueToString[DSL_RESULT_METRICS_EXPORTER_STOP_FAILED] = L"DSL_RESULT_METRICS_EXPORTER_STOP_FAILED";
+        m_returnValueToString[DSL_RESULT_PLUGIN_NAME_NOT_UNIQUE] = L"DSL_RESULT_PLUGIN_NAME_NOT_UNIQUE";
+        m_returnValueToString[DSL_RESULT_PLUGIN_NAME_NOT_FOUND] = L"DSL_RESULT_PLUGIN_NAME_NOT_FOUND";
+        m_returnValueToString[DSL_RESULT_PLUGIN_THREW_EXCEPTION] = L"DSL_RESULT_PLUGIN_THREW_EXCEPTION";
+        m_returnValueToString[DSL_RESULT_PLUGIN_FILE_NOT_FOUND] = L"DSL_RESULT_PLUGIN_FILE_NOT_FOUND";
+        m_returnValueToString[DSL_RESULT_PLUGIN_LOAD_FAILED] = L"DSL_RESULT_PLUGIN_LOAD_FAILED";
+        m_returnValueToString[DSL_RESULT_PLUGIN_CALLBACK_NOT_FOUND] = L"DSL_RESULT_PLUGIN_CALLBACK_NOT_FOUND";
+        m_returnValueToString[DSL_RESULT_PLUGIN_CREATE_FAILED] = L"DSL_RESULT_PLUGIN_CREATE_FAILED";
         
         m_returnValueToString[DSL_RESULT_INVALID_RESULT_CODE] = L"Invalid DSL Result CODE";
     }
@@ -32,6 +32,7 @@ THE SOFTWARE.
 #include "DslOdeAction.h"
 #include "DslOdeArea.h"
 #include "DslPipelineBintr.h"
+#include "DslMetrics.h"
 
 namespace DSL {
     
@@ -97,6 +98,9 @@ namespace DSL {
         DslReturnType OdeActionCustomNew(const char* name,
             dsl_ode_handle_occurrence_cb clientHandler, void* clientData);
 
+        DslReturnType OdeActionPluginNew(const char* name, 
+            const char* plugin, const char* config);
+
         DslReturnType OdeActionCaptureFrameNew(const char* name, const char* outdir, boolean annotate);
         
         DslReturnType OdeActionCaptureObjectNew(const char* name, const char* outdir);
@@ -199,6 +203,9 @@ namespace DSL {
             uint classId, uint limit,  dsl_ode_check_for_occurrence_cb client_checker, 
             dsl_ode_post_process_frame_cb client_post_processor, void* client_data);
 
+        DslReturnType OdeTriggerPluginNew(const char* name, const char* source, 
+            uint classId, uint limit, const char* plugin, const char* config);
+
         DslReturnType OdeTriggerMinimumNew(const char* name, const char* source,
             uint classId, uint limit, uint minimum);
         
@@ -267,6 +274,9 @@ namespace DSL {
         DslReturnType PphCustomNew(const char* name,
             dsl_pph_custom_client_handler_cb clientHandler, void* clientData);
 
+        DslReturnType PphPluginNew(const char* name, 
+            const char* plugin, const char* config);
+
         DslReturnType PphMeterNew(const char* name, uint interval, 
             dsl_pph_meter_client_handler_cb clientHandler, void* clientData);
             
@@ -304,6 +314,37 @@ namespace DSL {
         DslReturnType SourceRtspNew(const char* name, const char* uri, 
             uint protocol, uint cudadecMemType, uint intraDecode, uint dropFrameInterval, uint latency);
             
+        DslReturnType SourceTestNew(const char* name, boolean isLive, uint pattern,
+            uint width, uint height, uint fps_n, uint fps_d, uint numFrames);
+            
+        DslReturnType SourceTestPatternGet(const char* name, uint* pattern);
+            
+        DslReturnType SourceTestPatternSet(const char* name, uint pattern);
+            
+        DslReturnType SourceAppNew(const char* name, boolean isLive, uint format,
+            uint width, uint height, uint fps_n, uint fps_d);
+            
+        DslReturnType SourceAppDataHandlersAdd(const char* name, 
+            dsl_source_app_need_data_handler_cb needDataHandler, 
+            dsl_source_app_enough_data_handler_cb enoughDataHandler, void* clientData);
+            
+        DslReturnType SourceAppDataHandlersRemove(const char* name);
+            
+        DslReturnType SourceAppBufferPush(const char* name, void* data, uint size,
+            uint64_t pts, uint64_t duration, dsl_source_app_buffer_release_cb release, 
+            void* clientData);
+            
+        DslReturnType SourceAppEos(const char* name);
+            
+        DslReturnType SourceAppMaxLevelBytesGet(const char* name, uint64_t* maxBytes);
+            
+        DslReturnType SourceAppMaxLevelBytesSet(const char* name, uint64_t maxBytes);
+            
+        DslReturnType SourcePlaylistNew(const char* name, const char** files, 
+            boolean repeatEnabled, uint cudadecMemType, uint intraDecode, uint dropFrameInterval);
+            
+        DslReturnType SourcePlaylistIndexGet(const char* name, uint* index, uint* size);
+            
         DslReturnType SourceDimensionsGet(const char* name, uint* width, uint* height);
         
         DslReturnType SourceFrameRateGet(const char* name, uint* fps_n, uint* fps_d);
@@ -311,6 +352,10 @@ namespace DSL {
         DslReturnType SourceDecodeUriGet(const char* name, const char** uri);
 
         DslReturnType SourceDecodeUriSet(const char* name, const char* uri);
+
+        DslReturnType SourceDecodeRepeatEnabledGet(const char* name, boolean* enabled);
+
+        DslReturnType SourceDecodeRepeatEnabledSet(const char* name, boolean enabled);
     
         DslReturnType SourceDecodeDewarperAdd(const char* name, const char* dewarper);
     
@@ -320,6 +365,27 @@ namespace DSL {
     
         DslReturnType SourceRtspTapRemove(const char* name);
         
+        DslReturnType SourceRtspTimeoutGet(const char* name, uint* timeout);
+        
+        DslReturnType SourceRtspTimeoutSet(const char* name, uint timeout);
+        
+        DslReturnType SourceRtspReconnectionParamsGet(const char* name, 
+            uint* backoffMin, uint* backoffMax);
+        
+        DslReturnType SourceRtspReconnectionParamsSet(const char* name, 
+            uint backoffMin, uint backoffMax);
+        
+        DslReturnType SourceRtspConnectionDataGet(const char* name, 
+            uint* state, uint* reconnectCount, std::string& lastError);
+        
+        DslReturnType SourceRtspConnectionStatsClear(const char* name);
+        
+        DslReturnType SourceRtspStateChangeListenerAdd(const char* name, 
+            dsl_rtsp_connection_state_change_listener_cb listener, void* userdata);
+        
+        DslReturnType SourceRtspStateChangeListenerRemove(const char* name, 
+            dsl_rtsp_connection_state_change_listener_cb listener);
+        
         DslReturnType SourceNameGet(int sourceId, const char** name);
 
         DslReturnType SourceIdGet(const char* name, int* sourceId);
@@ -362,6 +428,32 @@ namespace DSL {
 
         DslReturnType TapRecordResetDoneGet(const char* name, boolean* resetDone);
 
+        DslReturnType TapRingRecordNew(const char* name, const char* outdir, uint container, 
+            uint64_t maxBytes, dsl_ring_record_complete_listener_cb clientListener);
+            
+        DslReturnType TapRingRecordSessionStart(const char* name, 
+            uint* session, uint preEvent, uint postEvent, void* clientData);
+
+        DslReturnType TapRingRecordSessionStop(const char* name);
+
+        DslReturnType TapRingRecordMaxBytesGet(const char* name, uint64_t* maxBytes);
+
+        DslReturnType TapRingRecordMaxBytesSet(const char* name, uint64_t maxBytes);
+
+        DslReturnType TapRingRecordCacheLevelGet(const char* name, 
+            uint64_t* bytes, uint* duration);
+
+        DslReturnType TapRingRecordIsOnGet(const char* name, boolean* isOn);
+
+        DslReturnType TapFileNew(const char* name, const char* filepath, 
+            uint codec, uint container);
+
+        DslReturnType TapRtspNew(const char* name, const char* host, 
+            uint udpPort, uint rtspPort, uint codec);
+
+        DslReturnType TapRtspServerSettingsGet(const char* name, 
+            uint* udpPort, uint* rtspPort, uint* codec);
+
         DslReturnType PrimaryGieNew(const char* name, const char* inferConfigFile,
             const char* modelEngineFile, uint interval);
 
@@ -387,10 +479,31 @@ namespace DSL {
 
         DslReturnType GieIntervalSet(const char* name, uint interval);
 
+        DslReturnType PrimaryGieIntervalAdaptiveGet(const char* name, 
+            boolean* enabled, uint* minInterval, uint* maxInterval);
+
+        DslReturnType PrimaryGieIntervalAdaptiveSet(const char* name, 
+            boolean enabled, uint minInterval, uint maxInterval);
+
+        DslReturnType PrimaryGieIntervalListenerAdd(const char* name, 
+            dsl_gie_interval_change_listener_cb listener, void* clientData);
+
+        DslReturnType PrimaryGieIntervalListenerRemove(const char* name, 
+            dsl_gie_interval_change_listener_cb listener);
+
         DslReturnType TrackerKtlNew(const char* name, uint width, uint height);
         
         DslReturnType TrackerIouNew(const char* name, const char* configFile, uint width, uint height);
         
+        DslReturnType TrackerCpuIouNew(const char* name, 
+            uint maxAge, float iouThreshold, uint maxTracks);
+        
+        DslReturnType TrackerCpuIouSettingsGet(const char* name, 
+            uint* maxAge, float* iouThreshold, uint* maxTracks);
+        
+        DslReturnType TrackerCpuIouSettingsSet(const char* name, 
+            uint maxAge, float iouThreshold, uint maxTracks);
+        
         DslReturnType TrackerMaxDimensionsGet(const char* name, uint* width, uint* height);
         
         DslReturnType TrackerMaxDimensionsSet(const char* name, uint width, uint height);
@@ -434,6 +547,10 @@ namespace DSL {
 
         DslReturnType TilerSourceShowAll(const char* name);
 
+        DslReturnType TilerFramePruningEnabledGet(const char* name, boolean* enabled);
+
+        DslReturnType TilerFramePruningEnabledSet(const char* name, boolean enabled);
+
         DslReturnType TilerPphAdd(const char* name, const char* handler, uint pad);
 
         DslReturnType TilerPphRemove(const char* name, const char* handler, uint pad);
@@ -464,15 +581,74 @@ namespace DSL {
 
         DslReturnType SinkFakeNew(const char* name);
 
+        DslReturnType SinkAppNew(const char* name, 
+            dsl_sink_app_new_data_handler_cb handler, void* clientData);
+
+        DslReturnType SinkAppDataPull(const char* name, uint timeout, 
+            void** buffer, void** data, uint* size, void** batchMeta);
+
+        DslReturnType SinkAppDataRelease(const char* name);
+
+        DslReturnType SinkAppMaxBuffersGet(const char* name, 
+            uint* maxBuffers, boolean* drop);
+
+        DslReturnType SinkAppMaxBuffersSet(const char* name, 
+            uint maxBuffers, boolean drop);
+
+        DslReturnType SinkMetaNew(const char* name, 
+            const char* path, uint mode, uint framesPerWrite);
+
+        DslReturnType SinkMetaStatsGet(const char* name, 
+            uint64_t* framesWritten, uint64_t* framesDropped);
+
+        DslReturnType SinkMetaStatsClear(const char* name);
+
         DslReturnType SinkOverlayNew(const char* name, uint overlay_id, uint display_id,
             uint depth, uint offsetX, uint offsetY, uint width, uint height);
                 
         DslReturnType SinkWindowNew(const char* name, 
             uint offsetX, uint offsetY, uint width, uint height);
                 
+        DslReturnType SinkRenderMaxFpsGet(const char* name, uint* maxFps);
+                
+        DslReturnType SinkRenderMaxFpsSet(const char* name, uint maxFps);
+                
+        DslReturnType SinkWindowPauseWhenHiddenGet(const char* name, boolean* enabled);
+                
+        DslReturnType SinkWindowPauseWhenHiddenSet(const char* name, boolean enabled);
+                
         DslReturnType SinkFileNew(const char* name, const char* filepath, 
             uint codec, uint muxer, uint bit_rate, uint interval);
             
+        DslReturnType SinkSegmentNew(const char* name, const char* filePattern, 
+            uint codec, uint container, uint bitrate, uint interval,
+            uint maxDuration, uint maxFiles);
+            
+        DslReturnType SinkSegmentMaxDurationGet(const char* name, uint* maxDuration);
+
+        DslReturnType SinkSegmentMaxDurationSet(const char* name, uint maxDuration);
+
+        DslReturnType SinkSegmentMaxSizeGet(const char* name, uint64_t* maxSize);
+
+        DslReturnType SinkSegmentMaxSizeSet(const char* name, uint64_t maxSize);
+
+        DslReturnType SinkSegmentMaxFilesGet(const char* name, uint* maxFiles);
+
+        DslReturnType SinkSegmentMaxFilesSet(const char* name, uint maxFiles);
+
+        DslReturnType SinkSegmentWriteSettingsGet(const char* name, 
+            uint* bufferSize, uint* fsyncInterval);
+
+        DslReturnType SinkSegmentWriteSettingsSet(const char* name, 
+            uint bufferSize, uint fsyncInterval);
+
+        DslReturnType SinkSharedEncodeNew(const char* name, 
+            uint codec, uint bitrate, uint interval);
+
+        DslReturnType SinkSharedEncodeTapAdd(const char* name, const char* tap);
+
+        DslReturnType SinkSharedEncodeTapRemove(const char* name, const char* tap);
+
         DslReturnType SinkRecordNew(const char* name, const char* outdir, 
             uint codec, uint container, uint bitrate, uint interval, dsl_record_client_listner_cb clientListener);
             
@@ -508,6 +684,15 @@ namespace DSL {
 
         DslReturnType SinkRtspEncoderSettingsSet(const char* name, uint bitrate, uint interval);
 
+        DslReturnType SinkRtspBitrateAdaptiveGet(const char* name, 
+            boolean* enabled, uint* minBitrate, uint* maxBitrate);
+
+        DslReturnType SinkRtspBitrateAdaptiveSet(const char* name, 
+            boolean enabled, uint minBitrate, uint maxBitrate);
+
+        DslReturnType SinkRtspStreamStatusGet(const char* name, 
+            uint* clientCount, uint* bitrate, boolean* isEncoding);
+
         DslReturnType SinkPphAdd(const char* name, const char* handler);
 
         DslReturnType SinkPphRemove(const char* name, const char* handler);
@@ -553,6 +738,21 @@ namespace DSL {
 
         DslReturnType PipelineComponentRemove(const char* pipeline, const char* component);
 
+        DslReturnType PipelineSourceStandbyAdd(const char* pipeline, const char* source);
+
+        DslReturnType PipelineSourceStandbyRemove(const char* pipeline, const char* source);
+
+        DslReturnType PipelineSourceStandbyAttach(const char* pipeline, const char* source);
+
+        DslReturnType PipelineSourceStandbyDetach(const char* pipeline, const char* source);
+        
+        /**
+         * @brief checks if a Source is in a Pipeline's standby pool, called by the 
+         * Add and Remove Source ODE Actions to attach and detach standby Sources.
+         * @return true if the Source is in the Pipeline's standby pool
+         */
+        bool PipelineSourceIsStandby(const char* pipeline, const char* source);
+
         DslReturnType PipelineStreamMuxBatchPropertiesGet(const char* pipeline,
             uint* batchSize, uint* batchTimeout);
 
@@ -569,6 +769,58 @@ namespace DSL {
 
         DslReturnType PipelineStreamMuxPaddingSet(const char* pipeline, boolean enabled);
 
+        DslReturnType PipelineStreamMuxBatchTimeoutAdaptiveGet(const char* pipeline, 
+            boolean* enabled, uint* jitterMargin);
+
+        DslReturnType PipelineStreamMuxBatchTimeoutAdaptiveSet(const char* pipeline, 
+            boolean enabled, uint jitterMargin);
+
+        DslReturnType PipelineStreamMuxBatchStatsGet(const char* pipeline, 
+            uint* batchTimeout, double* fillRatio);
+
+        DslReturnType PipelineStreamMuxBatchSizeAdaptiveGet(const char* pipeline, 
+            boolean* enabled, uint* hysteresis);
+
+        DslReturnType PipelineStreamMuxBatchSizeAdaptiveSet(const char* pipeline, 
+            boolean enabled, uint hysteresis);
+
+        DslReturnType PipelineSgieCacheSettingsGet(const char* pipeline, 
+            boolean* enabled, uint* maxAge, float* minConfidence);
+
+        DslReturnType PipelineSgieCacheSettingsSet(const char* pipeline, 
+            boolean enabled, uint maxAge, float minConfidence);
+
+        DslReturnType PipelineSgieCacheStatsGet(const char* pipeline, 
+            uint64_t* hits, uint64_t* misses);
+
+        DslReturnType PipelineMainContextEnabledGet(const char* pipeline, 
+            boolean* enabled);
+
+        DslReturnType PipelineMainContextEnabledSet(const char* pipeline, 
+            boolean enabled);
+
+        DslReturnType PipelineQosElementStatsGet(const char* pipeline, 
+            const char* element, uint64_t* processed, uint64_t* dropped, 
+            int64_t* jitter, double* proportion);
+
+        DslReturnType PipelineQosTotalsGet(const char* pipeline, 
+            uint* elements, uint64_t* dropped);
+
+        DslReturnType PipelineQosStatsClear(const char* pipeline);
+
+        DslReturnType PipelineQosListenerAdd(const char* pipeline, 
+            dsl_qos_listener_cb listener, uint threshold, void* clientData);
+
+        DslReturnType PipelineQosListenerRemove(const char* pipeline, 
+            dsl_qos_listener_cb listener);
+
+        DslReturnType PipelineThreadPolicySet(const char* pipeline, const char* component,
+            uint64_t cpuMask, uint schedPolicy, int priority);
+
+        DslReturnType PipelineThreadPolicyRemove(const char* pipeline, const char* component);
+
+        DslReturnType PipelineThreadReportGet(const char* pipeline, const char** report);
+
         DslReturnType PipelineXWindowClear(const char* pipeline);
         
         DslReturnType PipelineXWindowDimensionsGet(const char* pipeline,
@@ -621,6 +873,24 @@ namespace DSL {
         DslReturnType PipelineXWindowDeleteEventHandlerRemove(const char* pipeline, 
             dsl_xwindow_delete_event_handler_cb handler);
         
+        DslReturnType MetricsHttpExporterStart(uint port);
+        
+        DslReturnType MetricsHttpExporterStop();
+        
+        DslReturnType MetricsFileExporterStart(const char* filePath, uint interval);
+        
+        DslReturnType MetricsFileExporterStop();
+        
+        uint MetricsListSize();
+        
+        DslReturnType PluginLoad(const char* name, const char* path);
+        
+        DslReturnType PluginDelete(const char* name);
+        
+        DslReturnType PluginDeleteAll();
+        
+        uint PluginListSize();
+        
         GMainLoop* GetMainLoopHandle()
         {
             LOG_FUNC();
@@ -752,6 +1022,11 @@ namespace DSL {
          */
         std::map <std::string, DSL_PPH_PTR> m_padProbeHandlers;
 
+        /**
+         * @brief map of all Plugins loaded by the client, key=name
+         */
+        std::map <std::string, DSL_PLUGIN_PTR> m_plugins;
+
         /**
          * @brief map of all pipelines creaated by the client, key=name
          */
@@ -243,9 +243,704 @@ namespace DSL
     
     //-------------------------------------------------------------------------
 
+    AppSinkBintr::AppSinkBintr(const char* name, 
+        dsl_sink_app_new_data_handler_cb clientHandler, void* clientData)
+        : SinkBintr(name, false, false)
+        , m_clientHandler(clientHandler)
+        , m_clientData(clientData)
+        , m_maxBuffers(DSL_DEFAULT_APP_SINK_MAX_BUFFERS)
+        , m_drop(true)
+        , m_pPulledSample(NULL)
+    {
+        LOG_FUNC();
+        
+        m_pAppSink = DSL_ELEMENT_NEW("appsink", "sink-bin-app");
+        m_pAppSink->SetAttribute("enable-last-sample", false);
+        m_pAppSink->SetAttribute("emit-signals", false);
+        m_pAppSink->SetAttribute("sync", m_sync);
+        m_pAppSink->SetAttribute("async", m_async);
+        m_pAppSink->SetAttribute("max-buffers", m_maxBuffers);
+        m_pAppSink->SetAttribute("drop", m_drop);
+        
+        // The Sink's queue runs the appsink - and client handler - on its own
+        // thread, leaking downstream when dropping so the branch never blocks.
+        m_pQueue->SetAttribute("max-size-buffers", m_maxBuffers);
+        m_pQueue->SetAttribute("max-size-bytes", (uint)0);
+        m_pQueue->SetAttribute("max-size-time", (uint64_t)0);
+        m_pQueue->SetAttribute("leaky", (m_drop) ? 2 : 0);
+        
+        if (m_clientHandler)
+        {
+            GstAppSinkCallbacks callbacks = {NULL, NULL, AppSinkNewSampleCB};
+            gst_app_sink_set_callbacks(GST_APP_SINK(m_pAppSink->GetGstElement()),
+                &callbacks, this, NULL);
+        }
+        g_mutex_init(&m_pullMutex);
+        
+        AddChild(m_pAppSink);
+    }
+    
+    AppSinkBintr::~AppSinkBintr()
+    {
+        LOG_FUNC();
+    
+        if (IsLinked())
+        {    
+            UnlinkAll();
+        }
+        ReleaseData();
+        g_mutex_clear(&m_pullMutex);
+    }
+
+    bool AppSinkBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("AppSinkBintr '" << m_name << "' is already linked");
+            return false;
+        }
+        if (!m_pQueue->LinkToSink(m_pAppSink))
+        {
+            return false;
+        }
+        m_isLinked = true;
+        return true;
+    }
+    
+    void AppSinkBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("AppSinkBintr '" << m_name << "' is not linked");
+            return;
+        }
+        m_pQueue->UnlinkFromSink();
+        m_isLinked = false;
+    }
+
+    bool AppSinkBintr::SetSyncSettings(bool sync, bool async)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set Sync/Async Settings for AppSinkBintr '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        m_sync = sync;
+        m_async = async;
+        
+        m_pAppSink->SetAttribute("sync", m_sync);
+        m_pAppSink->SetAttribute("async", m_async);
+        
+        return true;
+    }
+    
+    void AppSinkBintr::GetMaxBuffers(uint* maxBuffers, bool* drop)
+    {
+        LOG_FUNC();
+        
+        *maxBuffers = m_maxBuffers;
+        *drop = m_drop;
+    }
+    
+    bool AppSinkBintr::SetMaxBuffers(uint maxBuffers, bool drop)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set max-buffers for AppSinkBintr '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        m_maxBuffers = maxBuffers;
+        m_drop = drop;
+        
+        m_pAppSink->SetAttribute("max-buffers", m_maxBuffers);
+        m_pAppSink->SetAttribute("drop", m_drop);
+        m_pQueue->SetAttribute("max-size-buffers", m_maxBuffers);
+        m_pQueue->SetAttribute("leaky", (m_drop) ? 2 : 0);
+        
+        return true;
+    }
+    
+    bool AppSinkBintr::PullData(uint timeout, void** buffer, void** data, 
+        uint* size, void** batchMeta)
+    {
+        LOG_FUNC();
+        
+        if (m_clientHandler)
+        {
+            LOG_ERROR("Unable to pull data from AppSinkBintr '" << GetName() 
+                << "' as it was created with a client handler");
+            return false;
+        }
+        
+        // release the previous sample before blocking on the next
+        ReleaseData();
+        
+        GstSample* pSample = gst_app_sink_try_pull_sample(
+            GST_APP_SINK(m_pAppSink->GetGstElement()), timeout*GST_MSECOND);
+        if (!pSample)
+        {
+            LOG_DEBUG("AppSinkBintr '" << GetName() 
+                << "' timed out or reached end-of-stream on pull");
+            return false;
+        }
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_pullMutex);
+        
+        // a concurrent pull may have completed while this one was blocked
+        if (m_pPulledSample)
+        {
+            gst_buffer_unmap(gst_sample_get_buffer(m_pPulledSample), &m_pulledMapInfo);
+            gst_sample_unref(m_pPulledSample);
+            m_pPulledSample = NULL;
+        }
+        GstBuffer* pBuffer = gst_sample_get_buffer(pSample);
+        if (!gst_buffer_map(pBuffer, &m_pulledMapInfo, GST_MAP_READ))
+        {
+            LOG_ERROR("AppSinkBintr '" << GetName() << "' failed to map pulled buffer");
+            gst_sample_unref(pSample);
+            return false;
+        }
+        m_pPulledSample = pSample;
+        
+        *buffer = pBuffer;
+        *data = m_pulledMapInfo.data;
+        *size = m_pulledMapInfo.size;
+        *batchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        
+        return true;
+    }
+    
+    void AppSinkBintr::ReleaseData()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_pullMutex);
+        
+        if (m_pPulledSample)
+        {
+            gst_buffer_unmap(gst_sample_get_buffer(m_pPulledSample), &m_pulledMapInfo);
+            gst_sample_unref(m_pPulledSample);
+            m_pPulledSample = NULL;
+        }
+    }
+    
+    GstFlowReturn AppSinkBintr::HandleNewSample()
+    {
+        GstSample* pSample = gst_app_sink_pull_sample(
+            GST_APP_SINK(m_pAppSink->GetGstElement()));
+        if (!pSample)
+        {
+            return GST_FLOW_OK;
+        }
+        GstBuffer* pBuffer = gst_sample_get_buffer(pSample);
+        
+        // the mapped view is read-only and only valid for the duration of the call 
+        GstMapInfo mapInfo;
+        if (gst_buffer_map(pBuffer, &mapInfo, GST_MAP_READ))
+        {
+            try
+            {
+                m_clientHandler(pBuffer, mapInfo.data, mapInfo.size, 
+                    gst_buffer_get_nvds_batch_meta(pBuffer), m_clientData);
+            }
+            catch(...)
+            {
+                LOG_ERROR("AppSinkBintr '" << GetName() 
+                    << "' threw exception calling client handler");
+            }
+            gst_buffer_unmap(pBuffer, &mapInfo);
+        }
+        else
+        {
+            LOG_ERROR("AppSinkBintr '" << GetName() << "' failed to map new buffer");
+        }
+        gst_sample_unref(pSample);
+        
+        return GST_FLOW_OK;
+    }
+    
+    //-------------------------------------------------------------------------
+
+    MetaSinkBintr::MetaSinkBintr(const char* name, 
+        const char* path, uint mode, uint framesPerWrite)
+        : SinkBintr(name, false, false)
+        , m_path(path)
+        , m_mode(mode)
+        , m_framesPerWrite(std::max(framesPerWrite, 1u))
+        , m_fd(-1)
+        , m_lastConnectTime(0)
+        , m_framesInMessage(0)
+        , m_framesWritten(0)
+        , m_framesDropped(0)
+        , m_probeId(0)
+    {
+        LOG_FUNC();
+        
+        m_pFakeSink = DSL_ELEMENT_NEW(NVDS_ELEM_SINK_FAKESINK, "sink-bin-meta");
+        m_pFakeSink->SetAttribute("enable-last-sample", false);
+        m_pFakeSink->SetAttribute("max-lateness", -1);
+        m_pFakeSink->SetAttribute("sync", m_sync);
+        m_pFakeSink->SetAttribute("async", m_async);
+        m_pFakeSink->SetAttribute("qos", false);
+        
+        g_mutex_init(&m_metaMutex);
+        
+        AddChild(m_pFakeSink);
+    }
+    
+    MetaSinkBintr::~MetaSinkBintr()
+    {
+        LOG_FUNC();
+    
+        if (IsLinked())
+        {    
+            UnlinkAll();
+        }
+        g_mutex_clear(&m_metaMutex);
+    }
+
+    bool MetaSinkBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("MetaSinkBintr '" << m_name << "' is already linked");
+            return false;
+        }
+        // A file must be writable up front. A socket's consumer may not be 
+        // listening yet, so connection is retried on write.
+        if (!OpenOutput() and m_mode == DSL_META_SINK_MODE_FILE)
+        {
+            return false;
+        }
+        if (!m_pQueue->LinkToSink(m_pFakeSink))
+        {
+            CloseOutput();
+            return false;
+        }
+        GstPad* pSinkPad = gst_element_get_static_pad(m_pFakeSink->GetGstElement(), "sink");
+        m_probeId = gst_pad_add_probe(pSinkPad, (GstPadProbeType)
+            (GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM),
+            MetaSinkProbeCB, this, NULL);
+        gst_object_unref(pSinkPad);
+        
+        m_isLinked = true;
+        return true;
+    }
+    
+    void MetaSinkBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("MetaSinkBintr '" << m_name << "' is not linked");
+            return;
+        }
+        if (m_probeId)
+        {
+            GstPad* pSinkPad = gst_element_get_static_pad(m_pFakeSink->GetGstElement(), "sink");
+            gst_pad_remove_probe(pSinkPad, m_probeId);
+            gst_object_unref(pSinkPad);
+            m_probeId = 0;
+        }
+        HandleFlush();
+        CloseOutput();
+        
+        m_pQueue->UnlinkFromSink();
+        m_isLinked = false;
+    }
+
+    bool MetaSinkBintr::SetSyncSettings(bool sync, bool async)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set Sync/Async Settings for MetaSinkBintr '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        m_sync = sync;
+        m_async = async;
+        
+        m_pFakeSink->SetAttribute("sync", m_sync);
+        m_pFakeSink->SetAttribute("async", m_async);
+        
+        return true;
+    }
+    
+    void MetaSinkBintr::GetStats(uint64_t* framesWritten, uint64_t* framesDropped)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_metaMutex);
+        
+        *framesWritten = m_framesWritten;
+        *framesDropped = m_framesDropped;
+    }
+    
+    void MetaSinkBintr::ClearStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_metaMutex);
+        
+        m_framesWritten = 0;
+        m_framesDropped = 0;
+    }
+    
+    void MetaSinkBintr::HandleBuffer(GstBuffer* pBuffer)
+    {
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (!pBatchMeta)
+        {
+            return;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_metaMutex);
+
+        for (NvDsMetaList* pFrameList = pBatchMeta->frame_meta_list; 
+            pFrameList; pFrameList = pFrameList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameList->data);
+            
+            // reserve the message header - length, version, frame count
+            if (!m_framesInMessage)
+            {
+                m_message.clear();
+                AppendValue<uint32_t>(0);
+                AppendValue<uint16_t>(DSL_META_SINK_FORMAT_VERSION);
+                AppendValue<uint16_t>(0);
+            }
+            AppendValue<uint32_t>(pFrameMeta->source_id);
+            AppendValue<uint32_t>(pFrameMeta->frame_num);
+            AppendValue<uint64_t>(pFrameMeta->buf_pts);
+            AppendValue<uint64_t>(pFrameMeta->ntp_timestamp);
+            
+            // object count is updated once all objects are serialized
+            size_t objectCountOffset = m_message.size();
+            AppendValue<uint32_t>(0);
+            
+            uint32_t objectCount(0);
+            for (NvDsMetaList* pObjectList = pFrameMeta->obj_meta_list; 
+                pObjectList; pObjectList = pObjectList->next)
+            {
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectList->data);
+                
+                AppendValue<uint64_t>(pObjectMeta->object_id);
+                AppendValue<int32_t>(pObjectMeta->class_id);
+                AppendValue<float>(pObjectMeta->confidence);
+                AppendValue<float>(pObjectMeta->rect_params.left);
+                AppendValue<float>(pObjectMeta->rect_params.top);
+                AppendValue<float>(pObjectMeta->rect_params.width);
+                AppendValue<float>(pObjectMeta->rect_params.height);
+                objectCount++;
+            }
+            memcpy(&m_message[objectCountOffset], &objectCount, sizeof(objectCount));
+            
+            if (++m_framesInMessage >= m_framesPerWrite)
+            {
+                WriteMessage();
+            }
+        }
+    }
+    
+    void MetaSinkBintr::HandleFlush()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_metaMutex);
+        
+        if (m_framesInMessage)
+        {
+            WriteMessage();
+        }
+    }
+    
+    bool MetaSinkBintr::OpenOutput()
+    {
+        LOG_FUNC();
+        
+        if (m_fd >= 0)
+        {
+            return true;
+        }
+        if (m_mode == DSL_META_SINK_MODE_FILE)
+        {
+            m_fd = open(m_path.c_str(), 
+                O_WRONLY | O_CREAT | O_APPEND | O_NONBLOCK | O_CLOEXEC, 0644);
+            if (m_fd < 0)
+            {
+                LOG_ERROR("MetaSinkBintr '" << GetName() << "' failed to open file '"
+                    << m_path << "' with error: " << strerror(errno));
+                return false;
+            }
+            LOG_INFO("MetaSinkBintr '" << GetName() << "' opened file '" << m_path << "'");
+            return true;
+        }
+        
+        // limit connection attempts to one per second while no consumer is listening
+        int64_t now = g_get_monotonic_time();
+        if (m_lastConnectTime and (now - m_lastConnectTime) < G_USEC_PER_SEC)
+        {
+            return false;
+        }
+        m_lastConnectTime = now;
+        
+        struct sockaddr_un address = {0};
+        address.sun_family = AF_UNIX;
+        if (m_path.size() >= sizeof(address.sun_path))
+        {
+            LOG_ERROR("MetaSinkBintr '" << GetName() << "' socket path '"
+                << m_path << "' is too long");
+            return false;
+        }
+        strncpy(address.sun_path, m_path.c_str(), sizeof(address.sun_path) - 1);
+        
+        m_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (m_fd < 0)
+        {
+            LOG_ERROR("MetaSinkBintr '" << GetName() 
+                << "' failed to create socket with error: " << strerror(errno));
+            return false;
+        }
+        if (connect(m_fd, (struct sockaddr*)&address, sizeof(address)) < 0)
+        {
+            LOG_DEBUG("MetaSinkBintr '" << GetName() << "' unable to connect to '"
+                << m_path << "': " << strerror(errno));
+            close(m_fd);
+            m_fd = -1;
+            return false;
+        }
+        LOG_INFO("MetaSinkBintr '" << GetName() << "' connected to socket '" << m_path << "'");
+        return true;
+    }
+    
+    void MetaSinkBintr::CloseOutput()
+    {
+        LOG_FUNC();
+        
+        if (m_fd >= 0)
+        {
+            close(m_fd);
+            m_fd = -1;
+        }
+        m_pending.clear();
+        m_lastConnectTime = 0;
+    }
+    
+    void MetaSinkBintr::WriteMessage()
+    {
+        uint32_t length = m_message.size() - sizeof(uint32_t);
+        uint16_t frameCount = m_framesInMessage;
+        memcpy(&m_message[0], &length, sizeof(length));
+        memcpy(&m_message[sizeof(uint32_t) + sizeof(uint16_t)], 
+            &frameCount, sizeof(frameCount));
+        m_framesInMessage = 0;
+        
+        if (m_fd < 0 and !OpenOutput())
+        {
+            m_framesDropped += frameCount;
+            return;
+        }
+        
+        // finish any partially written message first so the stream stays framed
+        if (m_pending.size())
+        {
+            ssize_t written = (m_mode == DSL_META_SINK_MODE_SOCKET)
+                ? send(m_fd, &m_pending[0], m_pending.size(), MSG_NOSIGNAL)
+                : write(m_fd, &m_pending[0], m_pending.size());
+            if (written > 0)
+            {
+                m_pending.erase(m_pending.begin(), m_pending.begin() + written);
+            }
+            if (m_pending.size())
+            {
+                if (written < 0 and errno != EAGAIN and errno != EWOULDBLOCK)
+                {
+                    CloseOutput();
+                }
+                m_framesDropped += frameCount;
+                return;
+            }
+        }
+        
+        ssize_t written = (m_mode == DSL_META_SINK_MODE_SOCKET)
+            ? send(m_fd, &m_message[0], m_message.size(), MSG_NOSIGNAL)
+            : write(m_fd, &m_message[0], m_message.size());
+            
+        if (written < 0)
+        {
+            if (errno != EAGAIN and errno != EWOULDBLOCK)
+            {
+                LOG_WARN("MetaSinkBintr '" << GetName() 
+                    << "' failed to write with error: " << strerror(errno));
+                CloseOutput();
+            }
+            m_framesDropped += frameCount;
+            return;
+        }
+        if ((size_t)written < m_message.size())
+        {
+            m_pending.assign(m_message.begin() + written, m_message.end());
+        }
+        m_framesWritten += frameCount;
+    }
+    
+    //-------------------------------------------------------------------------
+
+    RenderSinkBintr::RenderSinkBintr(const char* name, bool sync, bool async)
+        : SinkBintr(name, sync, async)
+        , m_maxFps(0)
+        , m_pauseWhenHidden(false)
+        , m_isHidden(false)
+        , m_nextRenderPts(GST_CLOCK_TIME_NONE)
+        , m_renderProbeId(0)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_renderMutex);
+
+        // Frames are dropped on the queue's src pad, before any conversion or
+        // rendering. Upstream events are probed for XWindow visibility changes.
+        GstPad* pSrcPad = gst_element_get_static_pad(m_pQueue->GetGstElement(), "src");
+        m_renderProbeId = gst_pad_add_probe(pSrcPad, (GstPadProbeType)
+            (GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM |
+            GST_PAD_PROBE_TYPE_EVENT_UPSTREAM), RenderSinkProbeCB, this, NULL);
+        gst_object_unref(pSrcPad);
+    }
+    
+    RenderSinkBintr::~RenderSinkBintr()
+    {
+        LOG_FUNC();
+        
+        if (m_renderProbeId)
+        {
+            GstPad* pSrcPad = gst_element_get_static_pad(m_pQueue->GetGstElement(), "src");
+            gst_pad_remove_probe(pSrcPad, m_renderProbeId);
+            gst_object_unref(pSrcPad);
+        }
+        g_mutex_clear(&m_renderMutex);
+    }
+    
+    uint RenderSinkBintr::GetMaxFps()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_renderMutex);
+        
+        return m_maxFps;
+    }
+    
+    void RenderSinkBintr::SetMaxFps(uint maxFps)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_renderMutex);
+        
+        m_maxFps = maxFps;
+        m_nextRenderPts = GST_CLOCK_TIME_NONE;
+        
+        LOG_INFO("Max render FPS for RenderSinkBintr '" << GetName() 
+            << "' set to " << m_maxFps);
+    }
+    
+    bool RenderSinkBintr::GetPauseWhenHidden()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_renderMutex);
+        
+        return m_pauseWhenHidden;
+    }
+    
+    void RenderSinkBintr::SetPauseWhenHidden(bool enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_renderMutex);
+        
+        m_pauseWhenHidden = enabled;
+    }
+    
+    bool RenderSinkBintr::IsHidden()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_renderMutex);
+        
+        return m_isHidden;
+    }
+    
+    GstPadProbeReturn RenderSinkBintr::HandleRenderProbe(GstPadProbeInfo* pInfo)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_renderMutex);
+        
+        if (pInfo->type & GST_PAD_PROBE_TYPE_EVENT_BOTH)
+        {
+            GstEvent* pEvent = GST_PAD_PROBE_INFO_EVENT(pInfo);
+            
+            if (GST_EVENT_TYPE(pEvent) == GST_EVENT_CUSTOM_UPSTREAM and
+                gst_event_has_name(pEvent, DSL_XWINDOW_VISIBILITY_EVENT))
+            {
+                gboolean hidden(FALSE);
+                gst_structure_get_boolean(gst_event_get_structure(pEvent), 
+                    "hidden", &hidden);
+                if (m_isHidden != (bool)hidden)
+                {
+                    LOG_INFO("RenderSinkBintr '" << GetName() << "' is now " 
+                        << ((hidden) ? "hidden" : "visible"));
+                    m_isHidden = hidden;
+                }
+                gst_event_unref(pEvent);
+                GST_PAD_PROBE_INFO_DATA(pInfo) = NULL;
+                return GST_PAD_PROBE_HANDLED;
+            }
+            // new segment, e.g. after a seek - restart the frame-rate cap
+            if (GST_EVENT_TYPE(pEvent) == GST_EVENT_SEGMENT)
+            {
+                m_nextRenderPts = GST_CLOCK_TIME_NONE;
+            }
+            return GST_PAD_PROBE_OK;
+        }
+
+        if (m_pauseWhenHidden and m_isHidden)
+        {
+            return GST_PAD_PROBE_DROP;
+        }
+        if (!m_maxFps)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        GstClockTime pts = GST_BUFFER_PTS(GST_PAD_PROBE_INFO_BUFFER(pInfo));
+        if (!GST_CLOCK_TIME_IS_VALID(pts))
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        GstClockTime interval = GST_SECOND / m_maxFps;
+
+        // Allow frames up to a quarter interval early so that timestamp jitter 
+        // doesn't reduce the rendered rate below the cap
+        if (GST_CLOCK_TIME_IS_VALID(m_nextRenderPts) and 
+            pts + interval/4 < m_nextRenderPts)
+        {
+            return GST_PAD_PROBE_DROP;
+        }
+        m_nextRenderPts = (GST_CLOCK_TIME_IS_VALID(m_nextRenderPts) and 
+            pts < m_nextRenderPts + interval)
+            ? m_nextRenderPts + interval
+            : pts + interval;
+            
+        return GST_PAD_PROBE_OK;
+    }
+    
+    //-------------------------------------------------------------------------
+
     OverlaySinkBintr::OverlaySinkBintr(const char* name, uint overlayId, uint displayId, 
         uint depth, uint offsetX, uint offsetY, uint width, uint height)
-        : SinkBintr(name, true, false) // sync, async
+        : RenderSinkBintr(name, true, false) // sync, async
         , m_qos(FALSE)
         , m_overlayId(overlayId)
         , m_displayId(displayId)
@@ -410,7 +1105,7 @@ namespace DSL
 
     WindowSinkBintr::WindowSinkBintr(const char* name, guint offsetX, guint offsetY, 
         guint width, guint height)
-        : SinkBintr(name, true, false)
+        : RenderSinkBintr(name, true, false)
         , m_qos(false)
         , m_offsetX(offsetX)
         , m_offsetY(offsetY)
@@ -712,32 +1407,421 @@ namespace DSL
         
         if (m_isLinked)
         {
-            LOG_ERROR("FileSinkBintr '" << m_name << "' is already linked");
+            LOG_ERROR("FileSinkBintr '" << m_name << "' is already linked");
+            return false;
+        }
+        if (!m_pQueue->LinkToSink(m_pTransform) or
+            !m_pTransform->LinkToSink(m_pCapsFilter) or
+            !m_pCapsFilter->LinkToSink(m_pEncoder) or
+            !m_pEncoder->LinkToSink(m_pParser) or
+            !m_pParser->LinkToSink(m_pContainer) or
+            !m_pContainer->LinkToSink(m_pFileSink))
+        {
+            return false;
+        }
+        m_isLinked = true;
+        return true;
+    }
+    
+    void FileSinkBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("FileSinkBintr '" << m_name << "' is not linked");
+            return;
+        }
+        m_pContainer->UnlinkFromSink();
+        m_pParser->UnlinkFromSink();
+        m_pEncoder->UnlinkFromSink();
+        m_pCapsFilter->UnlinkFromSink();
+        m_pTransform->UnlinkFromSink();
+        m_pQueue->UnlinkFromSink();
+        m_isLinked = false;
+    }
+
+    bool FileSinkBintr::SetSyncSettings(bool sync, bool async)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set Sync/Async Settings for FileSinkBintr '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        m_sync = sync;
+        m_async = async;
+        
+        m_pFileSink->SetAttribute("sync", m_sync);
+        m_pFileSink->SetAttribute("async", m_async);
+
+        return true;
+    }
+    
+    //-------------------------------------------------------------------------
+    
+    SegmentSinkBintr::SegmentSinkBintr(const char* name, const char* filePattern, 
+        uint codec, uint container, uint bitRate, uint interval,
+        uint maxDuration, uint maxFiles)
+        : EncodeSinkBintr(name, codec, container, bitRate, interval)
+        , m_filePattern(filePattern)
+        , m_maxDuration(maxDuration)
+        , m_maxSize(0)
+        , m_maxFiles(maxFiles)
+        , m_writeBufferSize(DSL_DEFAULT_SEGMENT_SINK_WRITE_BUFFER_SIZE)
+        , m_fsyncInterval(DSL_DEFAULT_SEGMENT_SINK_FSYNC_INTERVAL)
+        , m_pFsyncThread(NULL)
+        , m_fsyncStop(false)
+        , m_pFileSink(NULL)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_fsyncMutex);
+        g_cond_init(&m_fsyncCond);
+
+        // The write queue bounds on bytes only, allowing the muxer and writer 
+        // to fall several seconds behind the encoder on a disk latency spike.
+        m_pWriteQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "segment-sink-bin-write-queue");
+        m_pWriteQueue->SetAttribute("max-size-buffers", (uint)0);
+        m_pWriteQueue->SetAttribute("max-size-bytes", (uint)(64*1024*1024));
+        m_pWriteQueue->SetAttribute("max-size-time", (uint64_t)0);
+        
+        m_pSplitMuxSink = DSL_ELEMENT_NEW("splitmuxsink", "segment-sink-bin-splitmux");
+        m_pSplitMuxSink->SetAttribute("location", filePattern);
+        m_pSplitMuxSink->SetAttribute("max-size-time", (uint64_t)m_maxDuration*GST_SECOND);
+        m_pSplitMuxSink->SetAttribute("max-size-bytes", m_maxSize);
+        m_pSplitMuxSink->SetAttribute("max-files", m_maxFiles);
+        m_pSplitMuxSink->SetAttribute("send-keyframe-requests", true);
+
+        GstElement* pMuxer(NULL);
+        switch (container)
+        {
+        case DSL_CONTAINER_MP4 :
+            pMuxer = gst_element_factory_make(NVDS_ELEM_MUX_MP4, "segment-sink-bin-muxer");
+            break;
+        case DSL_CONTAINER_MKV :
+            pMuxer = gst_element_factory_make(NVDS_ELEM_MKV, "segment-sink-bin-muxer");
+            break;
+        default:
+            LOG_ERROR("Invalid container = '" << container << "' for new Sink '" << name << "'");
+            throw;
+        }
+        
+        // fully buffered writes, flushed to the kernel every m_writeBufferSize bytes
+        m_pFileSink = gst_element_factory_make(NVDS_ELEM_SINK_FILE, "segment-sink-bin-filesink");
+        if (!pMuxer or !m_pFileSink)
+        {
+            LOG_ERROR("Failed to create muxer or filesink for new Sink '" << name << "'");
+            throw;
+        }
+        g_object_set(m_pFileSink, "buffer-mode", 2, "buffer-size", m_writeBufferSize,
+            "sync", m_sync, "async", m_async, NULL);
+
+        // splitmuxsink takes ownership of both the muxer and filesink
+        g_object_set(m_pSplitMuxSink->GetGObject(), 
+            "muxer", pMuxer, "sink", m_pFileSink, NULL);
+
+        g_signal_connect(m_pSplitMuxSink->GetGObject(), "format-location", 
+            G_CALLBACK(SegmentSinkFormatLocationCB), this);
+
+        AddChild(m_pWriteQueue);
+        AddChild(m_pSplitMuxSink);
+    }
+    
+    SegmentSinkBintr::~SegmentSinkBintr()
+    {
+        LOG_FUNC();
+
+        if (IsLinked())
+        {    
+            UnlinkAll();
+        }
+        g_cond_clear(&m_fsyncCond);
+        g_mutex_clear(&m_fsyncMutex);
+    }
+
+    bool SegmentSinkBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("SegmentSinkBintr '" << m_name << "' is already linked");
+            return false;
+        }
+        if (!m_pQueue->LinkToSink(m_pTransform) or
+            !m_pTransform->LinkToSink(m_pCapsFilter) or
+            !m_pCapsFilter->LinkToSink(m_pEncoder) or
+            !m_pEncoder->LinkToSink(m_pParser) or
+            !m_pParser->LinkToSink(m_pWriteQueue) or
+            !m_pWriteQueue->LinkToSink(m_pSplitMuxSink))
+        {
+            return false;
+        }
+        if (m_fsyncInterval)
+        {
+            m_fsyncStop = false;
+            m_pFsyncThread = g_thread_new("segment-sink-fsync", 
+                SegmentSinkFsyncThread, this);
+        }
+        m_isLinked = true;
+        return true;
+    }
+    
+    void SegmentSinkBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("SegmentSinkBintr '" << m_name << "' is not linked");
+            return;
+        }
+        if (m_pFsyncThread)
+        {
+            g_mutex_lock(&m_fsyncMutex);
+            m_fsyncStop = true;
+            g_cond_signal(&m_fsyncCond);
+            g_mutex_unlock(&m_fsyncMutex);
+            
+            g_thread_join(m_pFsyncThread);
+            m_pFsyncThread = NULL;
+        }
+        m_pWriteQueue->UnlinkFromSink();
+        m_pParser->UnlinkFromSink();
+        m_pEncoder->UnlinkFromSink();
+        m_pCapsFilter->UnlinkFromSink();
+        m_pTransform->UnlinkFromSink();
+        m_pQueue->UnlinkFromSink();
+        m_isLinked = false;
+    }
+
+    bool SegmentSinkBintr::SetSyncSettings(bool sync, bool async)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set Sync/Async Settings for SegmentSinkBintr '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        m_sync = sync;
+        m_async = async;
+        
+        g_object_set(m_pFileSink, "sync", m_sync, "async", m_async, NULL);
+
+        return true;
+    }
+    
+    uint SegmentSinkBintr::GetMaxDuration()
+    {
+        LOG_FUNC();
+        
+        return m_maxDuration;
+    }
+    
+    void SegmentSinkBintr::SetMaxDuration(uint maxDuration)
+    {
+        LOG_FUNC();
+        
+        m_maxDuration = maxDuration;
+        m_pSplitMuxSink->SetAttribute("max-size-time", (uint64_t)m_maxDuration*GST_SECOND);
+    }
+    
+    uint64_t SegmentSinkBintr::GetMaxSize()
+    {
+        LOG_FUNC();
+        
+        return m_maxSize;
+    }
+    
+    void SegmentSinkBintr::SetMaxSize(uint64_t maxSize)
+    {
+        LOG_FUNC();
+        
+        m_maxSize = maxSize;
+        m_pSplitMuxSink->SetAttribute("max-size-bytes", m_maxSize);
+    }
+    
+    uint SegmentSinkBintr::GetMaxFiles()
+    {
+        LOG_FUNC();
+        
+        return m_maxFiles;
+    }
+    
+    void SegmentSinkBintr::SetMaxFiles(uint maxFiles)
+    {
+        LOG_FUNC();
+        
+        m_maxFiles = maxFiles;
+        m_pSplitMuxSink->SetAttribute("max-files", m_maxFiles);
+    }
+    
+    void SegmentSinkBintr::GetWriteSettings(uint* bufferSize, uint* fsyncInterval)
+    {
+        LOG_FUNC();
+        
+        *bufferSize = m_writeBufferSize;
+        *fsyncInterval = m_fsyncInterval;
+    }
+    
+    bool SegmentSinkBintr::SetWriteSettings(uint bufferSize, uint fsyncInterval)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set Write Settings for SegmentSinkBintr '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        m_writeBufferSize = bufferSize;
+        m_fsyncInterval = fsyncInterval;
+        
+        g_object_set(m_pFileSink, "buffer-size", m_writeBufferSize, NULL);
+        
+        return true;
+    }
+    
+    gchar* SegmentSinkBintr::HandleFormatLocation(uint fragmentId)
+    {
+        // splitmuxsink has already wrapped the id to max-files
+        gchar* filePath = g_strdup_printf(m_filePattern.c_str(), fragmentId);
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_fsyncMutex);
+        m_currentFilePath.assign(filePath);
+        
+        LOG_INFO("SegmentSinkBintr '" << GetName() << "' starting new segment '" 
+            << m_currentFilePath << "'");
+        return filePath;
+    }
+    
+    void SegmentSinkBintr::HandleFsync()
+    {
+        LOG_FUNC();
+        
+        g_mutex_lock(&m_fsyncMutex);
+        while (!m_fsyncStop)
+        {
+            gint64 endTime = g_get_monotonic_time() + 
+                m_fsyncInterval*G_TIME_SPAN_MILLISECOND;
+                
+            while (!m_fsyncStop and g_cond_wait_until(&m_fsyncCond, &m_fsyncMutex, endTime));
+            
+            if (m_fsyncStop or m_currentFilePath.empty())
+            {
+                continue;
+            }
+            std::string filePath(m_currentFilePath);
+            
+            // flush outside of the lock so the streaming thread is never blocked
+            g_mutex_unlock(&m_fsyncMutex);
+            int fd = open(filePath.c_str(), O_RDONLY);
+            if (fd >= 0)
+            {
+                if (fdatasync(fd))
+                {
+                    LOG_WARN("SegmentSinkBintr '" << GetName() << "' failed to fsync '" 
+                        << filePath << "' with errno = " << errno);
+                }
+                close(fd);
+            }
+            g_mutex_lock(&m_fsyncMutex);
+        }
+        g_mutex_unlock(&m_fsyncMutex);
+    }
+    
+    //-------------------------------------------------------------------------
+    
+    SharedEncodeSinkBintr::SharedEncodeSinkBintr(const char* name, 
+        uint codec, uint bitRate, uint interval)
+        : EncodeSinkBintr(name, codec, DSL_CONTAINER_MP4, bitRate, interval)
+        , m_tapBlocked(false)
+        , m_tapEosCount(0)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_unlinkMutex);
+        g_cond_init(&m_unlinkCond);
+        
+        if (codec == DSL_CODEC_H264 or codec == DSL_CODEC_H265)
+        {
+            // Taps can be added mid-stream, so the parameter sets are resent 
+            // with every IDR frame for each new Tap to start from
+            m_pEncoder->SetAttribute("insert-sps-pps", true);
+            m_pParser->SetAttribute("config-interval", -1);
+        }
+        
+        // The Tee must not fail the stream while no Taps are linked
+        m_pTee = DSL_ELEMENT_NEW(NVDS_ELEM_TEE, "shared-encode-sink-bin-tee");
+        m_pTee->SetAttribute("allow-not-linked", true);
+        
+        AddChild(m_pTee);
+    }
+    
+    SharedEncodeSinkBintr::~SharedEncodeSinkBintr()
+    {
+        LOG_FUNC();
+
+        if (IsLinked())
+        {    
+            UnlinkAll();
+        }
+        g_cond_clear(&m_unlinkCond);
+        g_mutex_clear(&m_unlinkMutex);
+    }
+
+    bool SharedEncodeSinkBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("SharedEncodeSinkBintr '" << m_name << "' is already linked");
             return false;
         }
         if (!m_pQueue->LinkToSink(m_pTransform) or
             !m_pTransform->LinkToSink(m_pCapsFilter) or
             !m_pCapsFilter->LinkToSink(m_pEncoder) or
             !m_pEncoder->LinkToSink(m_pParser) or
-            !m_pParser->LinkToSink(m_pContainer) or
-            !m_pContainer->LinkToSink(m_pFileSink))
+            !m_pParser->LinkToSink(m_pTee))
         {
             return false;
         }
+        for (auto const& imap: m_pTaps)
+        {
+            if (!imap.second->LinkAll() or !imap.second->LinkToSource(m_pTee))
+            {
+                LOG_ERROR("SharedEncodeSinkBintr '" << GetName() 
+                    << "' failed to Link Tap '" << imap.second->GetName() << "'");
+                return false;
+            }
+        }
         m_isLinked = true;
         return true;
     }
     
-    void FileSinkBintr::UnlinkAll()
+    void SharedEncodeSinkBintr::UnlinkAll()
     {
         LOG_FUNC();
         
         if (!m_isLinked)
         {
-            LOG_ERROR("FileSinkBintr '" << m_name << "' is not linked");
+            LOG_ERROR("SharedEncodeSinkBintr '" << m_name << "' is not linked");
             return;
         }
-        m_pContainer->UnlinkFromSink();
+        for (auto const& imap: m_pTaps)
+        {
+            if (imap.second->IsLinkedToSource())
+            {
+                imap.second->UnlinkFromSource();
+            }
+            imap.second->UnlinkAll();
+        }
         m_pParser->UnlinkFromSink();
         m_pEncoder->UnlinkFromSink();
         m_pCapsFilter->UnlinkFromSink();
@@ -746,23 +1830,222 @@ namespace DSL
         m_isLinked = false;
     }
 
-    bool FileSinkBintr::SetSyncSettings(bool sync, bool async)
+    bool SharedEncodeSinkBintr::SetSyncSettings(bool sync, bool async)
+    {
+        LOG_FUNC();
+        
+        LOG_ERROR("Unable to set Sync settings for SharedEncodeSinkBintr '" 
+            << GetName() << "' - each Tap controls its own synchronization");
+        return false;
+    }
+    
+    bool SharedEncodeSinkBintr::AddTap(DSL_TAP_PTR pTapBintr)
     {
         LOG_FUNC();
         
+        if (IsTap(pTapBintr))
+        {
+            LOG_ERROR("Tap '" << pTapBintr->GetName() 
+                << "' is already a child of SharedEncodeSinkBintr '" << GetName() << "'");
+            return false;
+        }
+        m_pTaps[pTapBintr->GetName()] = pTapBintr;
+        
+        if (!Bintr::AddChild(pTapBintr))
+        {
+            LOG_ERROR("Failed to add Tap '" << pTapBintr->GetName() 
+                << "' to SharedEncodeSinkBintr '" << GetName() << "'");
+            m_pTaps.erase(pTapBintr->GetName());
+            return false;
+        }
         if (IsLinked())
         {
-            LOG_ERROR("Unable to set Sync/Async Settings for FileSinkBintr '" << GetName() 
-                << "' as it's currently linked");
+            if (!pTapBintr->LinkAll() or !pTapBintr->LinkToSource(m_pTee) or
+                !gst_element_sync_state_with_parent(pTapBintr->GetGstElement()))
+            {
+                LOG_ERROR("SharedEncodeSinkBintr '" << GetName() 
+                    << "' failed to Link new Tap '" << pTapBintr->GetName() << "'");
+                    
+                // leave the Tap as it was before the add
+                if (pTapBintr->IsLinkedToSource())
+                {
+                    pTapBintr->UnlinkFromSource();
+                }
+                gst_element_set_state(pTapBintr->GetGstElement(), GST_STATE_NULL);
+                if (pTapBintr->IsLinked())
+                {
+                    pTapBintr->UnlinkAll();
+                }
+                m_pTaps.erase(pTapBintr->GetName());
+                Bintr::RemoveChild(pTapBintr);
+                return false;
+            }
+            // request a keyframe so the new Tap can start without waiting 
+            // for the next scheduled IDR frame
+            GstPad* pSinkPad = gst_element_get_static_pad(
+                pTapBintr->GetGstElement(), "sink");
+            gst_pad_push_event(pSinkPad, gst_video_event_new_upstream_force_key_unit(
+                GST_CLOCK_TIME_NONE, TRUE, 0));
+            gst_object_unref(pSinkPad);
+        }
+        LOG_INFO("Tap '" << pTapBintr->GetName() 
+            << "' added to SharedEncodeSinkBintr '" << GetName() << "'");
+        return true;
+    }
+    
+    bool SharedEncodeSinkBintr::RemoveTap(DSL_TAP_PTR pTapBintr)
+    {
+        LOG_FUNC();
+        
+        if (!IsTap(pTapBintr))
+        {
+            LOG_ERROR("Tap '" << pTapBintr->GetName() 
+                << "' is not a child of SharedEncodeSinkBintr '" << GetName() << "'");
             return false;
         }
-        m_sync = sync;
-        m_async = async;
+        if (pTapBintr->IsLinkedToSource())
+        {
+            UnlinkTap(pTapBintr);
+            
+            // the Tap must be stopped before it can be removed from a playing bin
+            gst_element_set_state(pTapBintr->GetGstElement(), GST_STATE_NULL);
+            pTapBintr->UnlinkAll();
+        }
+        m_pTaps.erase(pTapBintr->GetName());
         
-        m_pFileSink->SetAttribute("sync", m_sync);
-        m_pFileSink->SetAttribute("async", m_async);
+        LOG_INFO("Removing Tap '" << pTapBintr->GetName() 
+            << "' from SharedEncodeSinkBintr '" << GetName() << "'");
+        return Bintr::RemoveChild(pTapBintr);
+    }
+    
+    bool SharedEncodeSinkBintr::IsTap(DSL_TAP_PTR pTapBintr)
+    {
+        LOG_FUNC();
+        
+        return (m_pTaps.find(pTapBintr->GetName()) != m_pTaps.end());
+    }
+    
+    uint SharedEncodeSinkBintr::GetNumTaps()
+    {
+        LOG_FUNC();
+        
+        return m_pTaps.size();
+    }
+    
+    bool SharedEncodeSinkBintr::UnlinkTap(DSL_TAP_PTR pTapBintr)
+    {
+        LOG_FUNC();
+        
+        GstState state(GST_STATE_NULL);
+        gst_element_get_state(GetGstElement(), &state, NULL, 0);
+        
+        if (state < GST_STATE_PAUSED)
+        {
+            return pTapBintr->UnlinkFromSource();
+        }
+        
+        GstPad* pTapSinkPad = gst_element_get_static_pad(
+            pTapBintr->GetGstElement(), "sink");
+        GstPad* pTeeSrcPad = (pTapSinkPad) ? gst_pad_get_peer(pTapSinkPad) : NULL;
+        if (!pTeeSrcPad)
+        {
+            LOG_ERROR("Failed to get Tee src pad for Tap '" 
+                << pTapBintr->GetName() << "'");
+            if (pTapSinkPad) gst_object_unref(pTapSinkPad);
+            return false;
+        }
+        gint64 timeout(DSL_DEFAULT_TEE_BRANCH_DETACH_TIMEOUT_IN_MS * G_TIME_SPAN_MILLISECOND);
+        
+        // Drop all data to the Tap at the Tee src pad, the Tee and the other 
+        // Taps continue to stream, then wait for any push in progress
+        gulong dropProbeId = gst_pad_add_probe(pTeeSrcPad, GST_PAD_PROBE_TYPE_DATA_DOWNSTREAM,
+            SharedEncodeSinkDropProbeCB, this, NULL);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_unlinkMutex);
+            m_tapBlocked = false;
+        }
+        // Note: the idle callback is called immediately if the pad is idle
+        gulong idleProbeId = gst_pad_add_probe(pTeeSrcPad, GST_PAD_PROBE_TYPE_IDLE,
+            SharedEncodeSinkIdleProbeCB, this, NULL);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_unlinkMutex);
+            
+            gint64 endTime(g_get_monotonic_time() + timeout);
+            while (!m_tapBlocked and 
+                g_cond_wait_until(&m_unlinkCond, &m_unlinkMutex, endTime));
+                
+            if (!m_tapBlocked)
+            {
+                LOG_WARN("Timeout waiting for Tee src pad to idle for Tap '" 
+                    << pTapBintr->GetName() << "'");
+                gst_pad_remove_probe(pTeeSrcPad, idleProbeId);
+            }
+        }
 
-        return true;
+        // Drain the Tap with an EOS, waiting for the EOS to reach all of its 
+        // sinks, so that muxers can finalize their files before it's stopped.
+        std::vector<std::pair<GstPad*, gulong>> eosProbes;
+        GstIterator* pIterator = gst_bin_iterate_sinks(GST_BIN(pTapBintr->GetGstElement()));
+        GValue item = G_VALUE_INIT;
+        while (gst_iterator_next(pIterator, &item) == GST_ITERATOR_OK)
+        {
+            GstElement* pSink = GST_ELEMENT(g_value_get_object(&item));
+            GstPad* pSinkPad = gst_element_get_static_pad(pSink, "sink");
+            if (pSinkPad)
+            {
+                eosProbes.push_back(std::make_pair(pSinkPad, gst_pad_add_probe(pSinkPad, 
+                    GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM, SharedEncodeSinkEosProbeCB, 
+                    this, NULL)));
+            }
+            g_value_reset(&item);
+        }
+        g_value_unset(&item);
+        gst_iterator_free(pIterator);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_unlinkMutex);
+            m_tapEosCount = 0;
+        }
+        gst_pad_send_event(pTapSinkPad, gst_event_new_eos());
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_unlinkMutex);
+            
+            gint64 endTime(g_get_monotonic_time() + timeout);
+            while (m_tapEosCount < eosProbes.size() and 
+                g_cond_wait_until(&m_unlinkCond, &m_unlinkMutex, endTime));
+                
+            if (m_tapEosCount < eosProbes.size())
+            {
+                LOG_WARN("Timeout waiting for Tap '" 
+                    << pTapBintr->GetName() << "' to drain");
+            }
+        }
+        for (auto const& ivec: eosProbes)
+        {
+            gst_pad_remove_probe(ivec.first, ivec.second);
+            gst_object_unref(ivec.first);
+        }
+        gst_object_unref(pTapSinkPad);
+        
+        // The Tap is now drained and can be unlinked, and the Tee's pad released
+        bool result = pTapBintr->UnlinkFromSource();
+        gst_pad_remove_probe(pTeeSrcPad, dropProbeId);
+        gst_object_unref(pTeeSrcPad);
+        
+        return result;
+    }
+    
+    void SharedEncodeSinkBintr::HandleTapBlocked()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_unlinkMutex);
+        m_tapBlocked = true;
+        g_cond_signal(&m_unlinkCond);
+    }
+    
+    void SharedEncodeSinkBintr::HandleTapEos()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_unlinkMutex);
+        m_tapEosCount++;
+        g_cond_signal(&m_unlinkCond);
     }
     
     //-------------------------------------------------------------------------
@@ -1048,10 +2331,21 @@ namespace DSL
         , m_bitRate(bitRate)
         , m_interval(interval)
         , m_pServer(NULL)
+        , m_pServerSrcId(0)
         , m_pFactory(NULL)
+        , m_isBitrateAdaptive(false)
+        , m_minBitRate(bitRate)
+        , m_maxBitRate(bitRate)
+        , m_bitRateInUse(bitRate)
+        , m_clientCount(0)
+        , m_isEncoderPaused(false)
+        , m_encoderProbeId(0)
+        , m_pBitrateTimerSource(NULL)
     {
         LOG_FUNC();
         
+        g_mutex_init(&m_adaptiveMutex);
+        
         m_pUdpSink = DSL_ELEMENT_NEW("udpsink", "rtsp-sink-bin");
         m_pTransform = DSL_ELEMENT_NEW(NVDS_ELEM_VIDEO_CONV, "rtsp-sink-bin-transform");
         m_pCapsFilter = DSL_ELEMENT_NEW(NVDS_ELEM_CAPS_FILTER, "rtsp-sink-bin-caps-filter");
@@ -1113,6 +2407,12 @@ namespace DSL
         std::string uniquePath = "/" + m_name;
         gst_rtsp_mount_points_add_factory(pMounts, uniquePath.c_str(), m_pFactory);
         g_object_unref(pMounts);
+        
+        // Client connections and media are tracked for the adaptive bitrate controller.
+        g_signal_connect(m_pServer, "client-connected", 
+            G_CALLBACK(RtspSinkClientConnectedCB), this);
+        g_signal_connect(m_pFactory, "media-configure", 
+            G_CALLBACK(RtspSinkMediaConfigureCB), this);
 
         AddChild(m_pUdpSink);
         AddChild(m_pTransform);
@@ -1130,6 +2430,22 @@ namespace DSL
         {    
             UnlinkAll();
         }
+        // a NULL filter returns a new reference to every client still connected
+        GList* pClients = gst_rtsp_server_client_filter(m_pServer, NULL, NULL);
+        for (GList* pItem = pClients; pItem; pItem = pItem->next)
+        {
+            g_signal_handlers_disconnect_by_data(pItem->data, this);
+        }
+        g_list_free_full(pClients, g_object_unref);
+        
+        g_signal_handlers_disconnect_by_data(m_pServer, this);
+        g_signal_handlers_disconnect_by_data(m_pFactory, this);
+        for (auto const& ivec: m_medias)
+        {
+            g_signal_handlers_disconnect_by_data(ivec, this);
+            g_object_unref(ivec);
+        }
+        g_mutex_clear(&m_adaptiveMutex);
     }
 
     bool RtspSinkBintr::LinkAll()
@@ -1156,6 +2472,10 @@ namespace DSL
         // connections the once main loop has been started
         m_pServerSrcId = gst_rtsp_server_attach(m_pServer, NULL);
 
+        if (m_isBitrateAdaptive and !StartBitrateAdaptive())
+        {
+            return false;
+        }
         m_isLinked = true;
         return true;
     }
@@ -1169,6 +2489,8 @@ namespace DSL
             LOG_ERROR("RtspSinkBintr '" << m_name << "' is not linked");
             return;
         }
+        StopBitrateAdaptive();
+        
         if (m_pServerSrcId)
         {
             // Remove (destroy) the source from the Main loop context
@@ -1243,4 +2565,369 @@ namespace DSL
         return true;
     }
     
-}    
\ No newline at end of file
+    void RtspSinkBintr::GetBitrateAdaptive(bool* enabled, 
+        uint* minBitRate, uint* maxBitRate)
+    {
+        LOG_FUNC();
+        
+        *enabled = m_isBitrateAdaptive;
+        *minBitRate = m_minBitRate;
+        *maxBitRate = m_maxBitRate;
+    }
+    
+    bool RtspSinkBintr::SetBitrateAdaptive(bool enabled, 
+        uint minBitRate, uint maxBitRate)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set adaptive bitrate for RtspSinkBintr '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        if (enabled and (!minBitRate or minBitRate > maxBitRate))
+        {
+            LOG_ERROR("Invalid adaptive bitrate bounds min = " << minBitRate 
+                << ", max = " << maxBitRate << " for RtspSinkBintr '" << GetName() << "'");
+            return false;
+        }
+        m_isBitrateAdaptive = enabled;
+        m_minBitRate = minBitRate;
+        m_maxBitRate = maxBitRate;
+        
+        LOG_INFO("Adaptive bitrate for RtspSinkBintr '" << GetName() << "' enabled = " 
+            << m_isBitrateAdaptive << ", min = " << m_minBitRate << ", max = " << m_maxBitRate);
+        return true;
+    }
+    
+    void RtspSinkBintr::GetStreamStatus(uint* clientCount, uint* bitRate, bool* isEncoding)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveMutex);
+        
+        *clientCount = m_clientCount;
+        *bitRate = m_bitRateInUse;
+        *isEncoding = !m_isEncoderPaused;
+    }
+    
+    bool RtspSinkBintr::StartBitrateAdaptive()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveMutex);
+        
+        GstPad* pSinkPad = gst_element_get_static_pad(m_pEncoder->GetGstElement(), "sink");
+        if (!pSinkPad)
+        {
+            LOG_ERROR("Failed to get Sink Pad for Encoder '" << m_pEncoder->GetName() << "'");
+            return false;
+        }
+        m_encoderProbeId = gst_pad_add_probe(pSinkPad, GST_PAD_PROBE_TYPE_BUFFER,
+            RtspSinkEncoderProbeCB, this, NULL);
+        gst_object_unref(pSinkPad);
+        
+        // start from the configured bitrate, within bounds, and with encoding 
+        // paused until the first client connects
+        m_bitRateInUse = std::min(m_maxBitRate, std::max(m_minBitRate, m_bitRate));
+        m_pEncoder->SetAttribute("bitrate", m_bitRateInUse);
+        m_isEncoderPaused = (m_clientCount == 0);
+
+        m_pBitrateTimerSource = AddPipelineTimeout(GetGstObject(), 
+            DSL_DEFAULT_RTSP_SINK_ADAPTIVE_UPDATE_INTERVAL, RtspSinkBitrateUpdateHandler, this);
+        
+        LOG_INFO("Adaptive bitrate started for RtspSinkBintr '" << GetName() << "'");
+        return true;
+    }
+
+    void RtspSinkBintr::StopBitrateAdaptive()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveMutex);
+        
+        if (m_pBitrateTimerSource)
+        {
+            RemovePipelineTimeout(m_pBitrateTimerSource);
+            m_pBitrateTimerSource = NULL;
+        }
+        if (m_encoderProbeId)
+        {
+            GstPad* pSinkPad = gst_element_get_static_pad(m_pEncoder->GetGstElement(), "sink");
+            gst_pad_remove_probe(pSinkPad, m_encoderProbeId);
+            gst_object_unref(pSinkPad);
+            m_encoderProbeId = 0;
+        }
+        m_isEncoderPaused = false;
+        
+        // restore the configured bitrate
+        if (m_bitRateInUse != m_bitRate)
+        {
+            m_bitRateInUse = m_bitRate;
+            m_pEncoder->SetAttribute("bitrate", m_bitRate);
+        }
+    }
+    
+    void RtspSinkBintr::ResumeEncoding()
+    {
+        LOG_INFO("Resuming encoding for RtspSinkBintr '" << GetName() 
+            << "' with " << m_clientCount << " client(s) connected");
+            
+        m_isEncoderPaused = false;
+        
+        // The new client can't decode until the next keyframe
+        gst_element_send_event(m_pEncoder->GetGstElement(), 
+            gst_video_event_new_upstream_force_key_unit(GST_CLOCK_TIME_NONE, TRUE, 0));
+    }
+    
+    void RtspSinkBintr::HandleClientConnected(GstRTSPClient* pClient)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveMutex);
+        
+        g_signal_connect(pClient, "closed", G_CALLBACK(RtspSinkClientClosedCB), this);
+        m_clientCount++;
+        
+        if (m_isEncoderPaused)
+        {
+            ResumeEncoding();
+        }
+    }
+
+    void RtspSinkBintr::HandleClientClosed()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveMutex);
+        
+        if (m_clientCount)
+        {
+            m_clientCount--;
+        }
+    }
+    
+    void RtspSinkBintr::HandleMediaConfigure(GstRTSPMedia* pMedia)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveMutex);
+        
+        m_medias.push_back(GST_RTSP_MEDIA(g_object_ref(pMedia)));
+        g_signal_connect(pMedia, "unprepared", G_CALLBACK(RtspSinkMediaUnpreparedCB), this);
+    }
+    
+    void RtspSinkBintr::HandleMediaUnprepared(GstRTSPMedia* pMedia)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveMutex);
+        
+        auto ivec = std::find(m_medias.begin(), m_medias.end(), pMedia);
+        if (ivec != m_medias.end())
+        {
+            m_medias.erase(ivec);
+            g_signal_handlers_disconnect_by_data(pMedia, this);
+            g_object_unref(pMedia);
+        }
+    }
+    
+    GstPadProbeReturn RtspSinkBintr::HandleEncoderBuffer()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveMutex);
+        
+        return (m_isEncoderPaused) ? GST_PAD_PROBE_DROP : GST_PAD_PROBE_OK;
+    }
+    
+    int RtspSinkBintr::HandleBitrateUpdate()
+    {
+        uint worstFractionLost(0), worstJitter(0);
+        bool haveReport(false);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveMutex);
+            
+            if (!m_clientCount)
+            {
+                if (!m_isEncoderPaused)
+                {
+                    LOG_INFO("Pausing encoding for RtspSinkBintr '" << GetName() 
+                        << "' with no clients connected");
+                    m_isEncoderPaused = true;
+                }
+                return true;
+            }
+            if (m_isEncoderPaused)
+            {
+                ResumeEncoding();
+            }
+            
+            // The receiver reports are held in the stats of the remote sources 
+            // that sent them, for each stream of each media served.
+            for (auto const& imedia: m_medias)
+            {
+                for (uint i = 0; i < gst_rtsp_media_n_streams(imedia); i++)
+                {
+                    GstRTSPStream* pStream = gst_rtsp_media_get_stream(imedia, i);
+                    GObject* pSession = gst_rtsp_stream_get_rtpsession(pStream);
+                    if (!pSession)
+                    {
+                        continue;
+                    }
+                    GstStructure* pStats(NULL);
+                    g_object_get(pSession, "stats", &pStats, NULL);
+                    g_object_unref(pSession);
+                    if (!pStats)
+                    {
+                        continue;
+                    }
+                    const GValue* pSourceStats = gst_structure_get_value(pStats, "source-stats");
+                    GValueArray* pSources = pSourceStats 
+                        ? (GValueArray*)g_value_get_boxed(pSourceStats) : NULL;
+                        
+                    for (uint j = 0; pSources and j < pSources->n_values; j++)
+                    {
+                        const GstStructure* pSource = gst_value_get_structure(
+                            g_value_array_get_nth(pSources, j));
+                        gboolean haveRb(FALSE);
+                        guint fractionLost(0), jitter(0);
+                        if (gst_structure_get_boolean(pSource, "have-rb", &haveRb) and haveRb and
+                            gst_structure_get_uint(pSource, "rb-fractionlost", &fractionLost) and
+                            gst_structure_get_uint(pSource, "rb-jitter", &jitter))
+                        {
+                            haveReport = true;
+                            worstFractionLost = std::max(worstFractionLost, fractionLost);
+                            // jitter is reported in RTP clock units of 90 kHz
+                            worstJitter = std::max(worstJitter, jitter/90);
+                        }
+                    }
+                    gst_structure_free(pStats);
+                }
+            }
+        }
+        if (haveReport)
+        {
+            HandleReceiverReport(worstFractionLost, worstJitter);
+        }
+        return true;
+    }
+    
+    uint RtspSinkBintr::HandleReceiverReport(uint fractionLost, uint jitter)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_adaptiveMutex);
+        
+        uint bitRate(m_bitRateInUse);
+        
+        if (fractionLost > DSL_DEFAULT_RTSP_SINK_ADAPTIVE_HIGH_LOSS)
+        {
+            // back off in proportion to the loss, as with TFRC and GCC
+            bitRate = (uint)(bitRate * (1.0 - 0.5*fractionLost/256.0));
+        }
+        else if (fractionLost < DSL_DEFAULT_RTSP_SINK_ADAPTIVE_LOW_LOSS and
+            jitter < DSL_DEFAULT_RTSP_SINK_ADAPTIVE_MAX_JITTER)
+        {
+            bitRate = (uint)(bitRate * 1.05);
+        }
+        bitRate = std::min(m_maxBitRate, std::max(m_minBitRate, bitRate));
+        
+        if (bitRate != m_bitRateInUse)
+        {
+            LOG_INFO("Updating encoder bitrate for RtspSinkBintr '" << GetName() 
+                << "' from " << m_bitRateInUse << " to " << bitRate 
+                << ", fraction lost = " << fractionLost << "/256, jitter = " << jitter << "ms");
+                
+            m_bitRateInUse = bitRate;
+            m_pEncoder->SetAttribute("bitrate", m_bitRateInUse);
+        }
+        return m_bitRateInUse;
+    }
+    
+    static GstFlowReturn AppSinkNewSampleCB(GstAppSink* pAppSink, gpointer pSink)
+    {
+        return static_cast<AppSinkBintr*>(pSink)->HandleNewSample();
+    }
+    
+    static GstPadProbeReturn MetaSinkProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMetaSink)
+    {
+        if (pInfo->type & GST_PAD_PROBE_TYPE_BUFFER)
+        {
+            static_cast<MetaSinkBintr*>(pMetaSink)->HandleBuffer(
+                GST_PAD_PROBE_INFO_BUFFER(pInfo));
+        }
+        else if (GST_EVENT_TYPE(GST_PAD_PROBE_INFO_EVENT(pInfo)) == GST_EVENT_EOS)
+        {
+            static_cast<MetaSinkBintr*>(pMetaSink)->HandleFlush();
+        }
+        return GST_PAD_PROBE_OK;
+    }
+    
+    static GstPadProbeReturn RenderSinkProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pRenderSink)
+    {
+        return static_cast<RenderSinkBintr*>(pRenderSink)->HandleRenderProbe(pInfo);
+    }
+    
+    static gchar* SegmentSinkFormatLocationCB(GstElement* pSplitMuxSink,
+        guint fragmentId, gpointer pSegmentSink)
+    {
+        return static_cast<SegmentSinkBintr*>(pSegmentSink)->
+            HandleFormatLocation(fragmentId);
+    }
+    
+    static gpointer SegmentSinkFsyncThread(gpointer pSegmentSink)
+    {
+        static_cast<SegmentSinkBintr*>(pSegmentSink)->HandleFsync();
+        return NULL;
+    }
+    
+    static GstPadProbeReturn SharedEncodeSinkDropProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSharedEncodeSink)
+    {
+        return GST_PAD_PROBE_DROP;
+    }
+    
+    static GstPadProbeReturn SharedEncodeSinkIdleProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSharedEncodeSink)
+    {
+        static_cast<SharedEncodeSinkBintr*>(pSharedEncodeSink)->HandleTapBlocked();
+        return GST_PAD_PROBE_REMOVE;
+    }
+    
+    static GstPadProbeReturn SharedEncodeSinkEosProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSharedEncodeSink)
+    {
+        if (GST_EVENT_TYPE(GST_PAD_PROBE_INFO_EVENT(pInfo)) == GST_EVENT_EOS)
+        {
+            static_cast<SharedEncodeSinkBintr*>(pSharedEncodeSink)->HandleTapEos();
+        }
+        return GST_PAD_PROBE_OK;
+    }
+    
+    static void RtspSinkClientConnectedCB(GstRTSPServer* pServer, 
+        GstRTSPClient* pClient, gpointer pRtspSink)
+    {
+        static_cast<RtspSinkBintr*>(pRtspSink)->HandleClientConnected(pClient);
+    }
+
+    static void RtspSinkClientClosedCB(GstRTSPClient* pClient, gpointer pRtspSink)
+    {
+        static_cast<RtspSinkBintr*>(pRtspSink)->HandleClientClosed();
+    }
+
+    static void RtspSinkMediaConfigureCB(GstRTSPMediaFactory* pFactory, 
+        GstRTSPMedia* pMedia, gpointer pRtspSink)
+    {
+        static_cast<RtspSinkBintr*>(pRtspSink)->HandleMediaConfigure(pMedia);
+    }
+
+    static void RtspSinkMediaUnpreparedCB(GstRTSPMedia* pMedia, gpointer pRtspSink)
+    {
+        static_cast<RtspSinkBintr*>(pRtspSink)->HandleMediaUnprepared(pMedia);
+    }
+
+    static GstPadProbeReturn RtspSinkEncoderProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pRtspSink)
+    {
+        return static_cast<RtspSinkBintr*>(pRtspSink)->HandleEncoderBuffer();
+    }
+
+    static int RtspSinkBitrateUpdateHandler(gpointer pRtspSink)
+    {
+        return static_cast<RtspSinkBintr*>(pRtspSink)->HandleBitrateUpdate();
+    }
+    
+}
@@ -30,6 +30,7 @@ THE SOFTWARE.
 #include "DslBintr.h"
 #include "DslElementr.h"
 #include "DslSourceMeter.h"
+#include "DslTapBintr.h"
 
 #include <gst-nvdssr.h>
 
@@ -47,6 +48,18 @@ namespace DSL
         std::shared_ptr<MeterSinkBintr>( \
         new MeterSinkBintr(name, interval, clientListener, clientData))
 
+    #define DSL_APP_SINK_PTR std::shared_ptr<AppSinkBintr>
+    #define DSL_APP_SINK_NEW(name, clientHandler, clientData) \
+        std::shared_ptr<AppSinkBintr>( \
+        new AppSinkBintr(name, clientHandler, clientData))
+
+    #define DSL_META_SINK_PTR std::shared_ptr<MetaSinkBintr>
+    #define DSL_META_SINK_NEW(name, path, mode, framesPerWrite) \
+        std::shared_ptr<MetaSinkBintr>( \
+        new MetaSinkBintr(name, path, mode, framesPerWrite))
+
+    #define DSL_RENDER_SINK_PTR std::shared_ptr<RenderSinkBintr>
+
     #define DSL_OVERLAY_SINK_PTR std::shared_ptr<OverlaySinkBintr>
     #define DSL_OVERLAY_SINK_NEW(name, overlayId, displayId, depth, offsetX, offsetY, width, height) \
         std::shared_ptr<OverlaySinkBintr>( \
@@ -64,6 +77,18 @@ namespace DSL
         std::shared_ptr<FileSinkBintr>( \
         new FileSinkBintr(name, filepath, codec, container, bitRate, interval))
         
+    #define DSL_SEGMENT_SINK_PTR std::shared_ptr<SegmentSinkBintr>
+    #define DSL_SEGMENT_SINK_NEW(name, \
+        filePattern, codec, container, bitRate, interval, maxDuration, maxFiles) \
+        std::shared_ptr<SegmentSinkBintr>( \
+        new SegmentSinkBintr(name, \
+            filePattern, codec, container, bitRate, interval, maxDuration, maxFiles))
+        
+    #define DSL_SHARED_ENCODE_SINK_PTR std::shared_ptr<SharedEncodeSinkBintr>
+    #define DSL_SHARED_ENCODE_SINK_NEW(name, codec, bitRate, interval) \
+        std::shared_ptr<SharedEncodeSinkBintr>( \
+        new SharedEncodeSinkBintr(name, codec, bitRate, interval))
+        
     #define DSL_RECORD_SINK_PTR std::shared_ptr<RecordSinkBintr>
     #define DSL_RECORD_SINK_NEW(name, outdir, codec, container, bitRate, interval, clientListener) \
         std::shared_ptr<RecordSinkBintr>( \
@@ -167,7 +192,389 @@ namespace DSL
 
     //-------------------------------------------------------------------------
 
-    class OverlaySinkBintr : public SinkBintr
+    /**
+     * @class AppSinkBintr
+     * @brief Implements an App Sink using the appsink plugin, delivering each 
+     * buffer, as a mapped read-only view with its batch meta, to the client by 
+     * callback or on pull. The Sink's queue decouples the client from the 
+     * upstream streaming thread.
+     */
+    class AppSinkBintr : public SinkBintr
+    {
+    public: 
+    
+        AppSinkBintr(const char* name, 
+            dsl_sink_app_new_data_handler_cb clientHandler, void* clientData);
+
+        ~AppSinkBintr();
+  
+        /**
+         * @brief Links all Child Elementrs owned by this Bintr
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs owned by this Bintr
+         * Calling UnlinkAll when in an unlinked state has no effect.
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief sets the current sync and async settings for the SinkBintr
+         * @param[in] sync current sync setting, true if set, false otherwise.
+         * @param[in] async current async setting, true if set, false otherwise.
+         * @return true is successful, false otherwise. 
+         */
+        bool SetSyncSettings(bool sync, bool async);
+        
+        /**
+         * @brief gets the current max-buffers and drop policy for the AppSinkBintr
+         * @param[out] maxBuffers maximum number of buffers to queue, 0 = unlimited
+         * @param[out] drop if true, old buffers are dropped when the queue is full,
+         * otherwise the upstream branch is blocked until the client catches up.
+         */
+        void GetMaxBuffers(uint* maxBuffers, bool* drop);
+        
+        /**
+         * @brief sets the max-buffers and drop policy for the AppSinkBintr
+         * @param[in] maxBuffers maximum number of buffers to queue, 0 = unlimited
+         * @param[in] drop if true, old buffers are dropped when the queue is full
+         * @return true is successful, false otherwise. 
+         */
+        bool SetMaxBuffers(uint maxBuffers, bool drop);
+        
+        /**
+         * @brief pulls the next buffer from the AppSinkBintr, releasing the last.
+         * Only available if the Sink was created without a client handler.
+         * @param[in] timeout maximum time to wait for a buffer in milliseconds
+         * @param[out] buffer the pulled GstBuffer
+         * @param[out] data mapped read-only view of the buffer data
+         * @param[out] size size of the mapped data in bytes
+         * @param[out] batchMeta NvDsBatchMeta for the buffer, NULL if none
+         * @return true if a buffer was pulled, false on timeout or end-of-stream
+         */
+        bool PullData(uint timeout, void** buffer, void** data, 
+            uint* size, void** batchMeta);
+        
+        /**
+         * @brief releases the buffer last pulled with PullData, if one is held
+         */
+        void ReleaseData();
+        
+        /**
+         * @brief handles the appsink new-sample callback by mapping the sample's
+         * buffer and calling the client's handler
+         * @return GST_FLOW_OK always
+         */
+        GstFlowReturn HandleNewSample();
+
+    private:
+    
+        /**
+         * @brief client handler to call with each new buffer, NULL for pull mode
+         */
+        dsl_sink_app_new_data_handler_cb m_clientHandler;
+        
+        /**
+         * @brief opaque pointer to client data passed to the client handler
+         */
+        void* m_clientData;
+        
+        /**
+         * @brief maximum number of buffers to queue, 0 = unlimited
+         */
+        uint m_maxBuffers;
+        
+        /**
+         * @brief if true, old buffers are dropped when the queue is full
+         */
+        bool m_drop;
+        
+        /**
+         * @brief mutex to protect the pulled sample and map
+         */
+        GMutex m_pullMutex;
+        
+        /**
+         * @brief sample last pulled by the client, NULL if none held
+         */
+        GstSample* m_pPulledSample;
+        
+        /**
+         * @brief read-only map of the last pulled sample's buffer
+         */
+        GstMapInfo m_pulledMapInfo;
+        
+        /**
+         * @brief App Sink element for the Sink Bintr.
+         */
+        DSL_ELEMENT_PTR m_pAppSink;
+    };
+
+    //-------------------------------------------------------------------------
+
+    /**
+     * @class MetaSinkBintr
+     * @brief Implements a metadata-only Sink that serializes the frame and 
+     * object meta of each batch into a compact, length-prefixed binary 
+     * message, written to a file or Unix domain socket with non-blocking I/O.
+     * The video buffers themselves are consumed by a fakesink.
+     */
+    class MetaSinkBintr : public SinkBintr
+    {
+    public: 
+    
+        MetaSinkBintr(const char* name, 
+            const char* path, uint mode, uint framesPerWrite);
+
+        ~MetaSinkBintr();
+  
+        /**
+         * @brief Links all Child Elementrs owned by this Bintr and opens
+         * the output file or socket. 
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs owned by this Bintr, flushing 
+         * any pending frames and closing the output.
+         * Calling UnlinkAll when in an unlinked state has no effect.
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief sets the current sync and async settings for the SinkBintr
+         * @param[in] sync current sync setting, true if set, false otherwise.
+         * @param[in] async current async setting, true if set, false otherwise.
+         * @return true is successful, false otherwise. 
+         */
+        bool SetSyncSettings(bool sync, bool async);
+        
+        /**
+         * @brief gets the current write statistics for the MetaSinkBintr
+         * @param[out] framesWritten number of frames written since last cleared
+         * @param[out] framesDropped number of frames dropped since last cleared,
+         * either because the output would block or was unavailable.
+         */
+        void GetStats(uint64_t* framesWritten, uint64_t* framesDropped);
+        
+        /**
+         * @brief clears the current write statistics for the MetaSinkBintr
+         */
+        void ClearStats();
+        
+        /**
+         * @brief serializes the batch meta of a buffer into the current 
+         * message, writing the message once framesPerWrite frames are held.
+         * @param[in] pBuffer buffer with the batch meta to serialize
+         */
+        void HandleBuffer(GstBuffer* pBuffer);
+        
+        /**
+         * @brief writes any frames held in the current message. Called
+         * on end-of-stream and when unlinking.
+         */
+        void HandleFlush();
+
+    private:
+    
+        /**
+         * @brief appends a value to the current message in host byte order
+         * @param[in] value value to append
+         */
+        template <typename T> void AppendValue(T value)
+        {
+            const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(&value);
+            m_message.insert(m_message.end(), pBytes, pBytes + sizeof(T));
+        }
+        
+        /**
+         * @brief opens the output file, or connects to the output socket
+         * @return true if the output is open, false otherwise
+         */
+        bool OpenOutput();
+        
+        /**
+         * @brief closes the output file or socket if open
+         */
+        void CloseOutput();
+        
+        /**
+         * @brief completes the message header and writes the current message
+         * without blocking, updating the statistics for all frames held.
+         */
+        void WriteMessage();
+        
+        /**
+         * @brief absolute or relative path to the output file or socket
+         */
+        std::string m_path;
+        
+        /**
+         * @brief one of DSL_META_SINK_MODE_FILE or DSL_META_SINK_MODE_SOCKET
+         */
+        uint m_mode;
+        
+        /**
+         * @brief number of frames to batch into each write
+         */
+        uint m_framesPerWrite;
+        
+        /**
+         * @brief file descriptor for the open output, -1 if not open
+         */
+        int m_fd;
+        
+        /**
+         * @brief monotonic time of the last socket connect attempt in microseconds
+         */
+        int64_t m_lastConnectTime;
+        
+        /**
+         * @brief mutex to protect the message, output, and statistics
+         */
+        GMutex m_metaMutex;
+        
+        /**
+         * @brief current message being serialized, header first
+         */
+        std::vector<uint8_t> m_message;
+        
+        /**
+         * @brief number of frames serialized into the current message
+         */
+        uint m_framesInMessage;
+        
+        /**
+         * @brief remainder of a message partially written to the socket. 
+         * Must be written before the next message to preserve framing.
+         */
+        std::vector<uint8_t> m_pending;
+        
+        /**
+         * @brief number of frames written since last cleared
+         */
+        uint64_t m_framesWritten;
+        
+        /**
+         * @brief number of frames dropped since last cleared
+         */
+        uint64_t m_framesDropped;
+        
+        /**
+         * @brief probe id for the fakesink's sink pad buffer and EOS probe
+         */
+        gulong m_probeId;
+        
+        /**
+         * @brief Fake Sink element for the Sink Bintr.
+         */
+        DSL_ELEMENT_PTR m_pFakeSink;
+    };
+
+    //-------------------------------------------------------------------------
+
+    /**
+     * @brief name of the custom upstream event sent by the Pipeline to its 
+     * Window Sinks when the visibility of the Pipeline's XWindow changes.
+     */
+    #define DSL_XWINDOW_VISIBILITY_EVENT "dsl-xwindow-visibility"
+
+    /**
+     * @class RenderSinkBintr
+     * @brief Common base for the Overlay and Window Sinks. Frames are dropped
+     * on the Sink's queue, upstream of any converter and renderer, to cap the
+     * render frame-rate and optionally to pause rendering while hidden.
+     */
+    class RenderSinkBintr : public SinkBintr
+    {
+    public: 
+    
+        RenderSinkBintr(const char* name, bool sync, bool async);
+
+        ~RenderSinkBintr();
+
+        /**
+         * @brief Gets the current maximum render frame-rate for this RenderSinkBintr
+         * @return current maximum frames per second, 0 = unlimited
+         */
+        uint GetMaxFps();
+
+        /**
+         * @brief Sets the maximum render frame-rate for this RenderSinkBintr.
+         * Can be called at any time, taking effect from the next frame.
+         * @param[in] maxFps new maximum frames per second, 0 = unlimited
+         */
+        void SetMaxFps(uint maxFps);
+
+        /**
+         * @brief Gets the current pause-when-hidden setting for this RenderSinkBintr
+         * @return true if rendering is paused while hidden, false otherwise
+         */
+        bool GetPauseWhenHidden();
+
+        /**
+         * @brief Sets the pause-when-hidden setting for this RenderSinkBintr.
+         * Can be called at any time, taking effect from the next frame.
+         * @param[in] enabled set to true to pause rendering while hidden
+         */
+        void SetPauseWhenHidden(bool enabled);
+
+        /**
+         * @brief Gets the last visibility state reported for this RenderSinkBintr
+         * @return true if the Sink's display is currently hidden
+         */
+        bool IsHidden();
+
+        /**
+         * @brief Handles a buffer or event received on the queue's src pad,
+         * dropping the buffer if rendering is paused or rate-limited and 
+         * consuming the Pipeline's XWindow visibility events
+         * @param[in] pInfo probe info with the buffer or event
+         * @return GST_PAD_PROBE_DROP to drop the buffer, GST_PAD_PROBE_HANDLED
+         * for a consumed visibility event, GST_PAD_PROBE_OK otherwise
+         */
+        GstPadProbeReturn HandleRenderProbe(GstPadProbeInfo* pInfo);
+
+    protected:
+
+        /**
+         * @brief maximum frames per second to render, 0 = unlimited
+         */
+        uint m_maxFps;
+
+        /**
+         * @brief if true, all frames are dropped while the Sink is hidden
+         */
+        bool m_pauseWhenHidden;
+
+        /**
+         * @brief true if the Sink's display was last reported as hidden
+         */
+        bool m_isHidden;
+
+        /**
+         * @brief presentation time at or after which the next frame is rendered
+         * when the frame-rate is capped. GST_CLOCK_TIME_NONE until the first frame.
+         */
+        GstClockTime m_nextRenderPts;
+
+        /**
+         * @brief probe id for the queue's src pad buffer and event probe
+         */
+        gulong m_renderProbeId;
+
+        /**
+         * @brief mutex to protect the render settings from the streaming thread
+         */
+        GMutex m_renderMutex;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class OverlaySinkBintr : public RenderSinkBintr
     {
     public: 
     
@@ -249,7 +656,7 @@ namespace DSL
 
     //-------------------------------------------------------------------------
 
-    class WindowSinkBintr : public SinkBintr
+    class WindowSinkBintr : public RenderSinkBintr
     {
     public: 
     
@@ -411,6 +818,308 @@ namespace DSL
 
     //-------------------------------------------------------------------------
 
+    /**
+     * @class SegmentSinkBintr
+     * @brief Implements an Encode Sink that rolls its output over a sequence
+     * of segment files, splitting on keyframes once a maximum duration or 
+     * size is reached. The muxer and file writer run on their own streaming 
+     * thread behind a write queue, with writes batched by a fully buffered 
+     * filesink. The current segment is fsync'd on a separate thread so that 
+     * disk latency is never seen by the encoder.
+     */
+    class SegmentSinkBintr : public EncodeSinkBintr
+    {
+    public: 
+    
+        SegmentSinkBintr(const char* name, const char* filePattern, 
+            uint codec, uint container, uint bitRate, uint interval,
+            uint maxDuration, uint maxFiles);
+
+        ~SegmentSinkBintr();
+  
+        /**
+         * @brief Links all Child Elementrs owned by this Bintr and starts
+         * the fsync thread if enabled
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs owned by this Bintr and stops
+         * the fsync thread if running
+         * Calling UnlinkAll when in an unlinked state has no effect.
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief sets the current sync and async settings for the SinkBintr
+         * @param[in] sync current sync setting, true if set, false otherwise.
+         * @param[in] async current async setting, true if set, false otherwise.
+         * @return true is successful, false otherwise. 
+         */
+        bool SetSyncSettings(bool sync, bool async);
+        
+        /**
+         * @brief gets the current maximum duration for each segment
+         * @return maximum segment duration in seconds, 0 = unlimited.
+         */
+        uint GetMaxDuration();
+        
+        /**
+         * @brief sets the maximum duration for each segment, taking effect
+         * from the next keyframe. 
+         * @param[in] maxDuration new maximum duration in seconds, 0 = unlimited.
+         */
+        void SetMaxDuration(uint maxDuration);
+        
+        /**
+         * @brief gets the current maximum size for each segment
+         * @return maximum segment size in bytes, 0 = unlimited.
+         */
+        uint64_t GetMaxSize();
+        
+        /**
+         * @brief sets the maximum size for each segment, taking effect
+         * from the next keyframe. 
+         * @param[in] maxSize new maximum size in bytes, 0 = unlimited.
+         */
+        void SetMaxSize(uint64_t maxSize);
+        
+        /**
+         * @brief gets the current maximum number of segment files to retain
+         * @return maximum number of files, 0 = unlimited.
+         */
+        uint GetMaxFiles();
+        
+        /**
+         * @brief sets the maximum number of segment files to retain. Once 
+         * reached, the oldest segment file is overwritten.
+         * @param[in] maxFiles new maximum number of files, 0 = unlimited.
+         */
+        void SetMaxFiles(uint maxFiles);
+        
+        /**
+         * @brief gets the current write settings for the SegmentSinkBintr
+         * @param[out] bufferSize size of the write buffer in bytes
+         * @param[out] fsyncInterval interval between fsyncs in ms, 0 = disabled
+         */
+        void GetWriteSettings(uint* bufferSize, uint* fsyncInterval);
+        
+        /**
+         * @brief sets the write settings for the SegmentSinkBintr
+         * @param[in] bufferSize new write buffer size in bytes
+         * @param[in] fsyncInterval new fsync interval in ms, 0 = disabled
+         * @return false if the SegmentSinkBintr is currently linked.
+         */
+        bool SetWriteSettings(uint bufferSize, uint fsyncInterval);
+        
+        /**
+         * @brief handles the splitmuxsink format-location signal, 
+         * formating and saving the file path for the next segment.
+         * @param[in] fragmentId id for the next segment, wrapped to maxFiles
+         * @return newly allocated file path, owned by the caller
+         */
+        gchar* HandleFormatLocation(uint fragmentId);
+        
+        /**
+         * @brief fsync thread function, flushing the current segment file 
+         * to disk every fsyncInterval until the thread is stopped.
+         */
+        void HandleFsync();
+        
+    private:
+    
+        /**
+         * @brief printf-style file pattern with a single integer directive
+         */
+        std::string m_filePattern;
+        
+        /**
+         * @brief maximum segment duration in seconds, 0 = unlimited
+         */
+        uint m_maxDuration;
+        
+        /**
+         * @brief maximum segment size in bytes, 0 = unlimited
+         */
+        uint64_t m_maxSize;
+        
+        /**
+         * @brief maximum number of segment files to retain, 0 = unlimited
+         */
+        uint m_maxFiles;
+        
+        /**
+         * @brief size of the filesink's write buffer in bytes
+         */
+        uint m_writeBufferSize;
+        
+        /**
+         * @brief interval between fsyncs of the current segment in ms
+         */
+        uint m_fsyncInterval;
+        
+        /**
+         * @brief file path of the segment currently being written
+         */
+        std::string m_currentFilePath;
+        
+        /**
+         * @brief mutex to protect the current file path and fsync state
+         */
+        GMutex m_fsyncMutex;
+        
+        /**
+         * @brief condition used to wake the fsync thread when stopping
+         */
+        GCond m_fsyncCond;
+        
+        /**
+         * @brief fsync thread, NULL when not running
+         */
+        GThread* m_pFsyncThread;
+        
+        /**
+         * @brief true when the fsync thread has been requested to stop
+         */
+        bool m_fsyncStop;
+
+        /**
+         * @brief queue decoupling the encoder from the muxer and writer
+         */
+        DSL_ELEMENT_PTR m_pWriteQueue;
+        
+        /**
+         * @brief splitmuxsink element owning the muxer and filesink
+         */
+        DSL_ELEMENT_PTR m_pSplitMuxSink;
+        
+        /**
+         * @brief filesink owned by the splitmuxsink, kept for updates
+         */
+        GstElement* m_pFileSink;
+    };
+
+    //-------------------------------------------------------------------------
+
+    /**
+     * @class SharedEncodeSinkBintr
+     * @brief Implements an Encode Sink that encodes the stream once and tees
+     * the parsed output to any number of Taps - File, RTSP, Record, and
+     * Ring Record - each muxing, payloading, or recording without re-encoding.
+     * Taps can be added and removed while the Pipeline is playing.
+     */
+    class SharedEncodeSinkBintr : public EncodeSinkBintr
+    {
+    public: 
+    
+        SharedEncodeSinkBintr(const char* name, 
+            uint codec, uint bitRate, uint interval);
+
+        ~SharedEncodeSinkBintr();
+  
+        /**
+         * @brief Links all Child Elementrs and Taps owned by this Bintr
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs and Taps owned by this Bintr
+         * Calling UnlinkAll when in an unlinked state has no effect.
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief The SharedEncodeSinkBintr has no sink element of its own,
+         * each Tap controls its own synchronization. 
+         * @return false always
+         */
+        bool SetSyncSettings(bool sync, bool async);
+        
+        /**
+         * @brief Adds a Tap to this SharedEncodeSinkBintr. If linked, the Tap
+         * is linked to the Tee, synced with the Sink's state, and a keyframe 
+         * is requested from the encoder.
+         * @param[in] pTapBintr shared pointer to the Tap to add
+         * @return true on successful add, false otherwise
+         */
+        bool AddTap(DSL_TAP_PTR pTapBintr);
+        
+        /**
+         * @brief Removes a Tap from this SharedEncodeSinkBintr. If playing, data
+         * to the Tap is dropped at the Tee's src pad, without blocking the other 
+         * Taps, and the Tap is drained with end-of-stream before it's stopped.
+         * @param[in] pTapBintr shared pointer to the Tap to remove
+         * @return true on successful remove, false otherwise
+         */
+        bool RemoveTap(DSL_TAP_PTR pTapBintr);
+        
+        /**
+         * @brief checks if a Tap is a child of this SharedEncodeSinkBintr
+         * @param[in] pTapBintr shared pointer to the Tap to check
+         * @return true if the Tap is a child, false otherwise
+         */
+        bool IsTap(DSL_TAP_PTR pTapBintr);
+        
+        /**
+         * @brief gets the number of Taps currently added
+         * @return the current number of Taps
+         */
+        uint GetNumTaps();
+        
+        /**
+         * @brief handles the idle probe on a Tee src pad, signaling that no 
+         * data is in flight to the Tap being removed.
+         */
+        void HandleTapBlocked();
+        
+        /**
+         * @brief handles an end-of-stream event reaching a sink within a 
+         * Tap being removed.
+         */
+        void HandleTapEos();
+        
+    private:
+    
+        /**
+         * @brief unlinks a Tap from the Tee, dropping data at the Tee's src pad
+         * and waiting for end-of-stream to drain through the Tap if playing.
+         * @param[in] pTapBintr shared pointer to the Tap to unlink
+         * @return true on successful unlink, false otherwise
+         */
+        bool UnlinkTap(DSL_TAP_PTR pTapBintr);
+    
+        /**
+         * @brief map of Taps currently added, by unique name
+         */
+        std::map<std::string, DSL_TAP_PTR> m_pTaps;
+        
+        /**
+         * @brief mutex and condition used when unlinking a Tap while playing
+         */
+        GMutex m_unlinkMutex;
+        GCond m_unlinkCond;
+        
+        /**
+         * @brief true once the Tee src pad for the Tap being removed is idle
+         */
+        bool m_tapBlocked;
+        
+        /**
+         * @brief number of end-of-stream events received by the sinks
+         * of the Tap being removed.
+         */
+        uint m_tapEosCount;
+
+        /**
+         * @brief Tee element, fanning out the parsed encoder output
+         */
+        DSL_ELEMENT_PTR m_pTee;
+    };
+
+    //-------------------------------------------------------------------------
+
     class RecordSinkBintr : public EncodeSinkBintr
     {
     public: 
@@ -597,9 +1306,105 @@ namespace DSL
          */
         bool SetSyncSettings(bool sync, bool async);
 
+        /**
+         * @brief Gets the current adaptive bitrate settings for the RtspSinkBintr
+         * @param[out] enabled true if the adaptive bitrate controller is enabled
+         * @param[out] minBitRate lower bound for the encoder bitrate in bits/sec
+         * @param[out] maxBitRate upper bound for the encoder bitrate in bits/sec
+         */
+        void GetBitrateAdaptive(bool* enabled, uint* minBitRate, uint* maxBitRate);
+
+        /**
+         * @brief Sets the adaptive bitrate settings for the RtspSinkBintr. When 
+         * enabled, the encoder bitrate is adjusted from the RTCP receiver reports
+         * of all connected clients, and encoding is paused while no client is connected.
+         * @param[in] enabled set to true to enable the adaptive bitrate controller
+         * @param[in] minBitRate lower bound for the encoder bitrate in bits/sec
+         * @param[in] maxBitRate upper bound for the encoder bitrate in bits/sec
+         * @return false if the Sink is linked or the bounds are invalid, true otherwise
+         */
+        bool SetBitrateAdaptive(bool enabled, uint minBitRate, uint maxBitRate);
+
+        /**
+         * @brief Gets the current client and encoder status for the RtspSinkBintr
+         * @param[out] clientCount number of RTSP clients currently connected
+         * @param[out] bitRate encoder bitrate currently in use in bits/sec
+         * @param[out] isEncoding false while encoding is paused, true otherwise
+         */
+        void GetStreamStatus(uint* clientCount, uint* bitRate, bool* isEncoding);
+
+        /**
+         * @brief handles a new client connection to the RTSP Server, resuming
+         * encoding if paused
+         * @param[in] pClient newly connected client
+         */
+        void HandleClientConnected(GstRTSPClient* pClient);
+
+        /**
+         * @brief handles a client connection closing, encoding is paused on the
+         * next update if it was the last client
+         */
+        void HandleClientClosed();
+
+        /**
+         * @brief handles a new media configured by the RTSP Media Factory,
+         * holding a reference to read the RTCP receiver reports of its sessions
+         * @param[in] pMedia newly configured media
+         */
+        void HandleMediaConfigure(GstRTSPMedia* pMedia);
+
+        /**
+         * @brief handles a media being unprepared, releasing its reference
+         * @param[in] pMedia media being unprepared
+         */
+        void HandleMediaUnprepared(GstRTSPMedia* pMedia);
+
+        /**
+         * @brief handles a buffer arriving at the encoder while the adaptive 
+         * bitrate controller is running
+         * @return GST_PAD_PROBE_DROP while encoding is paused, GST_PAD_PROBE_OK otherwise
+         */
+        GstPadProbeReturn HandleEncoderBuffer();
+
+        /**
+         * @brief timer handler to pause/resume encoding and to update the 
+         * encoder bitrate from the current RTCP receiver reports
+         * @return true to continue the timer
+         */
+        int HandleBitrateUpdate();
+
+        /**
+         * @brief updates the encoder bitrate from the worst-case receiver report
+         * of all clients. The bitrate is reduced in proportion to the fraction 
+         * lost when the loss is high, and increased by 5% when both loss and jitter
+         * are low, always within the configured bounds.
+         * @param[in] fractionLost worst fraction lost in units of 1/256
+         * @param[in] jitter worst inter-arrival jitter in milliseconds
+         * @return the encoder bitrate in use after the update
+         */
+        uint HandleReceiverReport(uint fractionLost, uint jitter);
 
     private:
 
+        /**
+         * @brief starts the adaptive bitrate controller, adding the encoder probe
+         * and the update timer.
+         * @return true on successful start, false otherwise
+         */
+        bool StartBitrateAdaptive();
+
+        /**
+         * @brief stops the adaptive bitrate controller, removing the encoder probe
+         * and the update timer, and restoring the configured bitrate
+         */
+        void StopBitrateAdaptive();
+
+        /**
+         * @brief resumes encoding, requesting a keyframe for the new client. 
+         * Must be called with the adaptive mutex held.
+         */
+        void ResumeEncoding();
+
         std::string m_host;
         uint m_udpPort;
         uint m_rtspPort;
@@ -610,6 +1415,54 @@ namespace DSL
         GstRTSPServer* m_pServer;
         uint m_pServerSrcId;
         GstRTSPMediaFactory* m_pFactory;
+        
+        /**
+         * @brief true if the adaptive bitrate controller is enabled
+         */
+        bool m_isBitrateAdaptive;
+        
+        /**
+         * @brief lower and upper bounds for the adaptive encoder bitrate
+         */
+        uint m_minBitRate;
+        uint m_maxBitRate;
+        
+        /**
+         * @brief encoder bitrate currently set, differs from m_bitRate 
+         * when the adaptive controller is running
+         */
+        uint m_bitRateInUse;
+        
+        /**
+         * @brief number of RTSP clients currently connected
+         */
+        uint m_clientCount;
+        
+        /**
+         * @brief true while encoding is paused with no clients connected
+         */
+        bool m_isEncoderPaused;
+        
+        /**
+         * @brief media configured by the RTSP Media Factory and not yet unprepared
+         */
+        std::vector<GstRTSPMedia*> m_medias;
+        
+        /**
+         * @brief id of the encoder sink pad probe while the controller is running
+         */
+        gulong m_encoderProbeId;
+        
+        /**
+         * @brief source of the update timer while the controller is running
+         */
+        GSource* m_pBitrateTimerSource;
+        
+        /**
+         * @brief mutex to protect the adaptive controller state, shared between 
+         * the main-loop and the encoder's streaming thread
+         */
+        GMutex m_adaptiveMutex;
  
         DSL_ELEMENT_PTR m_pUdpSink;
         DSL_ELEMENT_PTR m_pTransform;
@@ -619,6 +1472,130 @@ namespace DSL
         DSL_ELEMENT_PTR m_pPayloader;  
     };
     
+    /**
+     * @brief Callback function for the appsink new-sample signal
+     * @param[in] pAppSink appsink element with a new sample
+     * @param[in] pSink (callback user data) pointer to the unique sink opject
+     * @return GST_FLOW_OK always
+     */
+    static GstFlowReturn AppSinkNewSampleCB(GstAppSink* pAppSink, gpointer pSink);
+
+    /**
+     * @brief Buffer and EOS event probe callback for the MetaSinkBintr
+     * @param[in] pPad fakesink sink pad
+     * @param[in] pInfo probe info with the buffer or event
+     * @param[in] pMetaSink pointer to the MetaSinkBintr that added the probe
+     * @return GST_PAD_PROBE_OK always
+     */
+    static GstPadProbeReturn MetaSinkProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMetaSink);
+
+    /**
+     * @brief Buffer and event probe callback for a RenderSinkBintr's queue
+     * @param[in] pPad queue src pad
+     * @param[in] pInfo probe info with the buffer or event
+     * @param[in] pRenderSink pointer to the RenderSinkBintr that added the probe
+     * @return result of RenderSinkBintr::HandleRenderProbe
+     */
+    static GstPadProbeReturn RenderSinkProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pRenderSink);
+
+    /**
+     * @brief Callback function for the splitmuxsink format-location signal
+     * @param[in] pSplitMuxSink splitmuxsink requesting the next location
+     * @param[in] fragmentId id of the next segment
+     * @param[in] pSegmentSink pointer to the SegmentSinkBintr
+     * @return newly allocated file path for the next segment
+     */
+    static gchar* SegmentSinkFormatLocationCB(GstElement* pSplitMuxSink,
+        guint fragmentId, gpointer pSegmentSink);
+
+    /**
+     * @brief Thread function for the SegmentSinkBintr's fsync thread
+     * @param[in] pSegmentSink pointer to the SegmentSinkBintr
+     * @return NULL always
+     */
+    static gpointer SegmentSinkFsyncThread(gpointer pSegmentSink);
+
+    /**
+     * @brief Data probe callback for the Tee src pad of a Tap being removed
+     * @param[in] pPad Tee src pad
+     * @param[in] pInfo probe info
+     * @param[in] pSharedEncodeSink pointer to the SharedEncodeSinkBintr
+     * @return GST_PAD_PROBE_DROP always
+     */
+    static GstPadProbeReturn SharedEncodeSinkDropProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSharedEncodeSink);
+
+    /**
+     * @brief Idle probe callback for the Tee src pad of a Tap being removed
+     * @param[in] pPad Tee src pad
+     * @param[in] pInfo probe info
+     * @param[in] pSharedEncodeSink pointer to the SharedEncodeSinkBintr
+     * @return GST_PAD_PROBE_REMOVE always, the Tee is never left blocked
+     */
+    static GstPadProbeReturn SharedEncodeSinkIdleProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSharedEncodeSink);
+
+    /**
+     * @brief Event probe callback for the sinks of a Tap being removed
+     * @param[in] pPad sink element's sink pad
+     * @param[in] pInfo probe info with the event
+     * @param[in] pSharedEncodeSink pointer to the SharedEncodeSinkBintr
+     * @return GST_PAD_PROBE_OK always
+     */
+    static GstPadProbeReturn SharedEncodeSinkEosProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSharedEncodeSink);
+
+    /**
+     * @brief Callback function for the RTSP Server's client-connected signal
+     * @param[in] pServer RTSP Server owned by the RtspSinkBintr
+     * @param[in] pClient newly connected client
+     * @param[in] pRtspSink pointer to the RtspSinkBintr
+     */
+    static void RtspSinkClientConnectedCB(GstRTSPServer* pServer, 
+        GstRTSPClient* pClient, gpointer pRtspSink);
+
+    /**
+     * @brief Callback function for an RTSP client's closed signal
+     * @param[in] pClient client whose connection closed
+     * @param[in] pRtspSink pointer to the RtspSinkBintr
+     */
+    static void RtspSinkClientClosedCB(GstRTSPClient* pClient, gpointer pRtspSink);
+
+    /**
+     * @brief Callback function for the RTSP Media Factory's media-configure signal
+     * @param[in] pFactory RTSP Media Factory owned by the RtspSinkBintr
+     * @param[in] pMedia newly configured media
+     * @param[in] pRtspSink pointer to the RtspSinkBintr
+     */
+    static void RtspSinkMediaConfigureCB(GstRTSPMediaFactory* pFactory, 
+        GstRTSPMedia* pMedia, gpointer pRtspSink);
+
+    /**
+     * @brief Callback function for an RTSP media's unprepared signal
+     * @param[in] pMedia media being unprepared
+     * @param[in] pRtspSink pointer to the RtspSinkBintr
+     */
+    static void RtspSinkMediaUnpreparedCB(GstRTSPMedia* pMedia, gpointer pRtspSink);
+
+    /**
+     * @brief Buffer probe callback for the RTSP Sink's encoder sink pad
+     * @param[in] pPad encoder sink pad
+     * @param[in] pInfo probe info with the buffer
+     * @param[in] pRtspSink pointer to the RtspSinkBintr
+     * @return result of RtspSinkBintr::HandleEncoderBuffer
+     */
+    static GstPadProbeReturn RtspSinkEncoderProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pRtspSink);
+
+    /**
+     * @brief Timer callback to update the RTSP Sink's adaptive bitrate
+     * @param[in] pRtspSink pointer to the RtspSinkBintr that started the timer
+     * @return true to continue the timer
+     */
+    static int RtspSinkBitrateUpdateHandler(gpointer pRtspSink);
 }
+
 #endif // _DSL_SINK_BINTR_H
     
\ No newline at end of file
@@ -353,14 +353,511 @@ namespace DSL
 
     //*********************************************************************************
 
+    TestSourceBintr::TestSourceBintr(const char* name, bool isLive, uint pattern,
+        guint width, guint height, guint fps_n, guint fps_d, uint numFrames)
+        : SourceBintr(name)
+        , m_pattern(pattern)
+        , m_numFrames(numFrames)
+    {
+        LOG_FUNC();
+
+        m_isLive = isLive;
+        m_width = width;
+        m_height = height;
+        m_fps_n = fps_n;
+        m_fps_d = fps_d;
+        
+        m_pSourceElement = DSL_ELEMENT_NEW("videotestsrc", "test_pattern_elem");
+        m_pRawCapsFilter = DSL_ELEMENT_NEW(NVDS_ELEM_CAPS_FILTER, "src_raw_caps_filter");
+        m_pVidConv = DSL_ELEMENT_NEW(NVDS_ELEM_VIDEO_CONV, "src_video_conv");
+        m_pCapsFilter = DSL_ELEMENT_NEW(NVDS_ELEM_CAPS_FILTER, "src_caps_filter");
+
+        m_pSourceElement->SetAttribute("is-live", m_isLive);
+        m_pSourceElement->SetAttribute("pattern", m_pattern);
+        m_pSourceElement->SetAttribute("num-buffers", 
+            (m_numFrames) ? (gint)m_numFrames : -1);
+        
+        // The pattern is rendered on the CPU as NV12 then copied to NVMM memory
+        GstCaps * pCaps = gst_caps_new_simple("video/x-raw", "format", G_TYPE_STRING, "NV12",
+            "width", G_TYPE_INT, m_width, "height", G_TYPE_INT, m_height, 
+            "framerate", GST_TYPE_FRACTION, m_fps_n, m_fps_d, NULL);
+        if (!pCaps)
+        {
+            LOG_ERROR("Failed to create new Simple Capabilities for '" << name << "'");
+            throw;  
+        }
+        m_pRawCapsFilter->SetAttribute("caps", pCaps);
+        
+        GstCaps* pNvmmCaps = gst_caps_copy(pCaps);
+        gst_caps_unref(pCaps);        
+
+        GstCapsFeatures *feature = NULL;
+        feature = gst_caps_features_new("memory:NVMM", NULL);
+        gst_caps_set_features(pNvmmCaps, 0, feature);
+
+        m_pCapsFilter->SetAttribute("caps", pNvmmCaps);
+        
+        gst_caps_unref(pNvmmCaps);        
+        
+        m_pVidConv->SetAttribute("gpu-id", m_gpuId);
+        m_pVidConv->SetAttribute("nvbuf-memory-type", m_nvbufMemoryType);
+
+        AddChild(m_pSourceElement);
+        AddChild(m_pRawCapsFilter);
+        AddChild(m_pVidConv);
+        AddChild(m_pCapsFilter);
+        
+        m_pCapsFilter->AddGhostPadToParent("src");
+    }
+
+    TestSourceBintr::~TestSourceBintr()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {    
+            UnlinkAll();
+        }
+    }
+
+    bool TestSourceBintr::LinkAll()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("TestSourceBintr '" << GetName() << "' is already in a linked state");
+            return false;
+        }
+        if (!m_pSourceElement->LinkToSink(m_pRawCapsFilter) or 
+            !m_pRawCapsFilter->LinkToSink(m_pVidConv) or
+            !m_pVidConv->LinkToSink(m_pCapsFilter))
+        {
+            return false;
+        }
+        m_isLinked = true;
+        
+        return true;
+    }
+
+    void TestSourceBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("TestSourceBintr '" << GetName() << "' is not in a linked state");
+            return;
+        }
+        m_pVidConv->UnlinkFromSink();
+        m_pRawCapsFilter->UnlinkFromSink();
+        m_pSourceElement->UnlinkFromSink();
+        m_isLinked = false;
+    }
+    
+    uint TestSourceBintr::GetPattern()
+    {
+        LOG_FUNC();
+        
+        return m_pattern;
+    }
+    
+    bool TestSourceBintr::SetPattern(uint pattern)
+    {
+        LOG_FUNC();
+        
+        if (pattern > DSL_TEST_PATTERN_COLORS)
+        {
+            LOG_ERROR("Invalid pattern '" << pattern << "' for TestSourceBintr '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_pattern = pattern;
+        m_pSourceElement->SetAttribute("pattern", m_pattern);
+        
+        return true;
+    }
+    
+    bool TestSourceBintr::SetGpuId(uint gpuId)
+    {
+        LOG_FUNC();
+        
+        if (IsInUse())
+        {
+            LOG_ERROR("Unable to set GPU ID for TestSourceBintr '" << GetName() 
+                << "' as it's currently in use");
+            return false;
+        }
+
+        m_gpuId = gpuId;
+        LOG_DEBUG("Setting GPU ID to '" << gpuId << "' for TestSourceBintr '" << m_name << "'");
+
+        m_pVidConv->SetAttribute("gpu-id", m_gpuId);
+        
+        return true;
+    }
+
+    //*********************************************************************************
+
+    /**
+     * @brief Client release data for a wrapped buffer, freed by AppSourceBufferReleaseCB
+     */
+    struct AppSourceBufferRelease
+    {
+        dsl_source_app_buffer_release_cb release;
+        void* data;
+        void* clientData;
+    };
+    
+    /**
+     * @brief Raw video format strings indexed by DSL_VIDEO_FORMAT value
+     */
+    static const char* appSourceFormats[] = {"I420", "NV12", "RGBA"};
+    
+    AppSourceBintr::AppSourceBintr(const char* name, bool isLive, uint format,
+        guint width, guint height, guint fps_n, guint fps_d)
+        : SourceBintr(name)
+        , m_format(format)
+        , m_needDataHandler(NULL)
+        , m_enoughDataHandler(NULL)
+        , m_clientData(NULL)
+        , m_pBufferPool(NULL)
+        , m_bufferPoolSize(0)
+    {
+        LOG_FUNC();
+
+        m_isLive = isLive;
+        m_width = width;
+        m_height = height;
+        m_fps_n = fps_n;
+        m_fps_d = fps_d;
+        
+        m_pSourceElement = DSL_ELEMENT_NEW("appsrc", "app_src_elem");
+        m_pVidConv = DSL_ELEMENT_NEW(NVDS_ELEM_VIDEO_CONV, "src_video_conv");
+        m_pCapsFilter = DSL_ELEMENT_NEW(NVDS_ELEM_CAPS_FILTER, "src_caps_filter");
+
+        GstCaps * pCaps = gst_caps_new_simple("video/x-raw", 
+            "format", G_TYPE_STRING, appSourceFormats[m_format],
+            "width", G_TYPE_INT, m_width, "height", G_TYPE_INT, m_height, 
+            "framerate", GST_TYPE_FRACTION, m_fps_n, m_fps_d, NULL);
+        if (!pCaps)
+        {
+            LOG_ERROR("Failed to create new Simple Capabilities for '" << name << "'");
+            throw;  
+        }
+        m_pSourceElement->SetAttribute("caps", pCaps);
+        
+        GstCaps* pNvmmCaps = gst_caps_new_simple("video/x-raw", 
+            "format", G_TYPE_STRING, "NV12",
+            "width", G_TYPE_INT, m_width, "height", G_TYPE_INT, m_height, 
+            "framerate", GST_TYPE_FRACTION, m_fps_n, m_fps_d, NULL);
+        gst_caps_unref(pCaps);        
+
+        GstCapsFeatures *feature = NULL;
+        feature = gst_caps_features_new("memory:NVMM", NULL);
+        gst_caps_set_features(pNvmmCaps, 0, feature);
+
+        m_pCapsFilter->SetAttribute("caps", pNvmmCaps);
+        
+        gst_caps_unref(pNvmmCaps);        
+
+        // Buffers without a client timestamp are stamped with the running-time on push
+        m_pSourceElement->SetAttribute("is-live", m_isLive);
+        m_pSourceElement->SetAttribute("format", GST_FORMAT_TIME);
+        m_pSourceElement->SetAttribute("do-timestamp", true);
+        
+        m_pVidConv->SetAttribute("gpu-id", m_gpuId);
+        m_pVidConv->SetAttribute("nvbuf-memory-type", m_nvbufMemoryType);
+        
+        GstAppSrcCallbacks callbacks = {AppSourceNeedDataCB, AppSourceEnoughDataCB, NULL};
+        gst_app_src_set_callbacks(GST_APP_SRC(m_pSourceElement->GetGstElement()),
+            &callbacks, this, NULL);
+        
+        g_mutex_init(&m_appSourceMutex);
+
+        AddChild(m_pSourceElement);
+        AddChild(m_pVidConv);
+        AddChild(m_pCapsFilter);
+        
+        m_pCapsFilter->AddGhostPadToParent("src");
+    }
+
+    AppSourceBintr::~AppSourceBintr()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {    
+            UnlinkAll();
+        }
+        if (m_pBufferPool)
+        {
+            gst_buffer_pool_set_active(m_pBufferPool, false);
+            gst_object_unref(m_pBufferPool);
+        }
+        g_mutex_clear(&m_appSourceMutex);
+    }
+
+    bool AppSourceBintr::LinkAll()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() << "' is already in a linked state");
+            return false;
+        }
+        if (!m_pSourceElement->LinkToSink(m_pVidConv) or
+            !m_pVidConv->LinkToSink(m_pCapsFilter))
+        {
+            return false;
+        }
+        m_isLinked = true;
+        
+        return true;
+    }
+
+    void AppSourceBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() << "' is not in a linked state");
+            return;
+        }
+        m_pVidConv->UnlinkFromSink();
+        m_pSourceElement->UnlinkFromSink();
+        m_isLinked = false;
+    }
+    
+    bool AppSourceBintr::AddDataHandlers(
+        dsl_source_app_need_data_handler_cb needDataHandler, 
+        dsl_source_app_enough_data_handler_cb enoughDataHandler, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_appSourceMutex);
+        
+        if (m_needDataHandler)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() << "' already has data handlers");
+            return false;
+        }
+        m_needDataHandler = needDataHandler;
+        m_enoughDataHandler = enoughDataHandler;
+        m_clientData = clientData;
+        
+        return true;
+    }
+    
+    bool AppSourceBintr::RemoveDataHandlers()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_appSourceMutex);
+        
+        if (!m_needDataHandler)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() << "' has no data handlers to remove");
+            return false;
+        }
+        m_needDataHandler = NULL;
+        m_enoughDataHandler = NULL;
+        m_clientData = NULL;
+        
+        return true;
+    }
+    
+    bool AppSourceBintr::PushBuffer(void* data, uint size, uint64_t pts, 
+        uint64_t duration, dsl_source_app_buffer_release_cb release, void* clientData)
+    {
+        // Note: called once per frame, no function logging.
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' must be linked to push a buffer");
+            return false;
+        }
+        
+        GstBuffer* pBuffer(NULL);
+        
+        if (release)
+        {
+            // wrap the client's memory - the release data is freed on buffer destroy
+            AppSourceBufferRelease* pRelease = new AppSourceBufferRelease{
+                release, data, clientData};
+            pBuffer = gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, 
+                data, size, 0, size, pRelease, AppSourceBufferReleaseCB);
+        }
+        else
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_appSourceMutex);
+            
+            // (re)create the buffer pool on first use or when the frame size changes
+            if (!m_pBufferPool or m_bufferPoolSize != size)
+            {
+                if (m_pBufferPool)
+                {
+                    gst_buffer_pool_set_active(m_pBufferPool, false);
+                    gst_object_unref(m_pBufferPool);
+                }
+                m_pBufferPool = gst_buffer_pool_new();
+                GstStructure* pConfig = gst_buffer_pool_get_config(m_pBufferPool);
+                gst_buffer_pool_config_set_params(pConfig, NULL, size, 
+                    DSL_DEFAULT_APP_SOURCE_MIN_POOL_BUFFERS, 0);
+                    
+                if (!gst_buffer_pool_set_config(m_pBufferPool, pConfig) or
+                    !gst_buffer_pool_set_active(m_pBufferPool, true))
+                {
+                    LOG_ERROR("AppSourceBintr '" << GetName() 
+                        << "' failed to activate buffer pool");
+                    gst_object_unref(m_pBufferPool);
+                    m_pBufferPool = NULL;
+                    m_bufferPoolSize = 0;
+                    return false;
+                }
+                m_bufferPoolSize = size;
+            }
+            if (gst_buffer_pool_acquire_buffer(m_pBufferPool, 
+                &pBuffer, NULL) != GST_FLOW_OK)
+            {
+                LOG_ERROR("AppSourceBintr '" << GetName() 
+                    << "' failed to acquire a buffer from its pool");
+                return false;
+            }
+            gst_buffer_fill(pBuffer, 0, data, size);
+        }
+        GST_BUFFER_PTS(pBuffer) = pts;
+        GST_BUFFER_DURATION(pBuffer) = duration;
+        
+        // appsrc takes ownership of the buffer, even on failure
+        GstFlowReturn retval = gst_app_src_push_buffer(
+            GST_APP_SRC(m_pSourceElement->GetGstElement()), pBuffer);
+        if (retval != GST_FLOW_OK)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' failed to push buffer with flow return '" 
+                << gst_flow_get_name(retval) << "'");
+            return false;
+        }
+        return true;
+    }
+    
+    bool AppSourceBintr::Eos()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' must be linked to signal end-of-stream");
+            return false;
+        }
+        return (gst_app_src_end_of_stream(
+            GST_APP_SRC(m_pSourceElement->GetGstElement())) == GST_FLOW_OK);
+    }
+    
+    uint64_t AppSourceBintr::GetMaxLevelBytes()
+    {
+        LOG_FUNC();
+        
+        uint64_t maxBytes(0);
+        m_pSourceElement->GetAttribute("max-bytes", &maxBytes);
+        
+        return maxBytes;
+    }
+    
+    bool AppSourceBintr::SetMaxLevelBytes(uint64_t maxBytes)
+    {
+        LOG_FUNC();
+        
+        m_pSourceElement->SetAttribute("max-bytes", maxBytes);
+        
+        return true;
+    }
+    
+    void AppSourceBintr::HandleNeedData(uint length)
+    {
+        dsl_source_app_need_data_handler_cb needDataHandler(NULL);
+        void* clientData(NULL);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_appSourceMutex);
+            needDataHandler = m_needDataHandler;
+            clientData = m_clientData;
+        }
+        // call the client unlocked so it can push buffers from within the handler
+        if (needDataHandler)
+        {
+            try
+            {
+                needDataHandler(length, clientData);
+            }
+            catch(...)
+            {
+                LOG_ERROR("AppSourceBintr '" << GetName() 
+                    << "' threw exception calling client need-data handler");
+            }
+        }
+    }
+    
+    void AppSourceBintr::HandleEnoughData()
+    {
+        dsl_source_app_enough_data_handler_cb enoughDataHandler(NULL);
+        void* clientData(NULL);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_appSourceMutex);
+            enoughDataHandler = m_enoughDataHandler;
+            clientData = m_clientData;
+        }
+        if (enoughDataHandler)
+        {
+            try
+            {
+                enoughDataHandler(clientData);
+            }
+            catch(...)
+            {
+                LOG_ERROR("AppSourceBintr '" << GetName() 
+                    << "' threw exception calling client enough-data handler");
+            }
+        }
+    }
+    
+    bool AppSourceBintr::SetGpuId(uint gpuId)
+    {
+        LOG_FUNC();
+        
+        if (IsInUse())
+        {
+            LOG_ERROR("Unable to set GPU ID for AppSourceBintr '" << GetName() 
+                << "' as it's currently in use");
+            return false;
+        }
+
+        m_gpuId = gpuId;
+        LOG_DEBUG("Setting GPU ID to '" << gpuId << "' for AppSourceBintr '" << m_name << "'");
+
+        m_pVidConv->SetAttribute("gpu-id", m_gpuId);
+        
+        return true;
+    }
+
+    //*********************************************************************************
+
     DecodeSourceBintr::DecodeSourceBintr(const char* name, const char* factoryName, const char* uri,
         bool isLive, uint cudadecMemType, uint intraDecode, uint dropFrameInterval)
         : SourceBintr(name)
         , m_cudadecMemtype(cudadecMemType)
         , m_intraDecode(intraDecode)
         , m_dropFrameInterval(dropFrameInterval)
-        , m_accumulatedBase(0)
-        , m_prevAccumulatedBase(0)
+        , m_repeatEnabled(false)
+        , m_firstSegmentReceived(false)
+        , m_segmentSeekActive(false)
+        , m_streamTimeOffset(0)
+        , m_streamLastBufferEnd(0)
+        , m_streamLastBufferDuration(0)
+        , m_pStreamRestartPad(NULL)
+        , m_bufferProbeId(0)
     {
         LOG_FUNC();
         
@@ -401,6 +898,16 @@ namespace DSL
         AddChild(m_pSourceElement);
     }
     
+    DecodeSourceBintr::~DecodeSourceBintr()
+    {
+        LOG_FUNC();
+        
+        if (m_pStreamRestartPad)
+        {
+            gst_object_unref(m_pStreamRestartPad);
+        }
+    }
+    
     void DecodeSourceBintr::HandleOnChildAdded(GstChildProxy* pChildProxy, GObject* pObject,
         gchar* name)
     {
@@ -454,64 +961,152 @@ namespace DSL
             g_object_set(pObject, "drop-frame-interval", m_dropFrameInterval, NULL);
             g_object_set(pObject, "num-extra-surfaces", m_numExtraSurfaces, NULL);
 
-            // if the source is from file, then setup Stream buffer probe function
-            // to handle the stream restart/loop on GST_EVENT_EOS.
-            if (!m_isLive and false)
+            // if the source's stream can restart - repeating file or playlist - 
+            // then setup the Stream buffer probe function to present the decoder
+            // with a single continuous stream.
+            if (IsStreamRestartEnabled())
             {
                 GstPadProbeType mask = (GstPadProbeType) 
                     (GST_PAD_PROBE_TYPE_EVENT_BOTH |
                     GST_PAD_PROBE_TYPE_EVENT_FLUSH | 
                     GST_PAD_PROBE_TYPE_BUFFER);
-                    
-                GstPad* pStaticSinkpad = gst_element_get_static_pad(GST_ELEMENT(pObject), "sink");
                 
-                m_bufferProbeId = 
-                    gst_pad_add_probe(pStaticSinkpad, mask, StreamBufferRestartProbCB, this, NULL);
+                // a new decoder is created on each transition to PLAYING
+                if (m_pStreamRestartPad)
+                {
+                    gst_object_unref(m_pStreamRestartPad);
+                }
+                m_pStreamRestartPad = gst_element_get_static_pad(GST_ELEMENT(pObject), "sink");
+                
+                m_firstSegmentReceived = false;
+                m_segmentSeekActive = false;
+                m_streamTimeOffset = 0;
+                m_streamLastBufferEnd = 0;
+                m_streamLastBufferDuration = 0;
+                
+                m_bufferProbeId = gst_pad_add_probe(m_pStreamRestartPad, 
+                    mask, StreamBufferRestartProbCB, this, NULL);
             }
         }
     }
     
-    GstPadProbeReturn DecodeSourceBintr::HandleStreamBufferRestart(GstPad* pPad, GstPadProbeInfo* pInfo)
+    bool DecodeSourceBintr::GetRepeatEnabled()
     {
         LOG_FUNC();
-
-        GstEvent* event = GST_EVENT(pInfo->data);
-
-        if (pInfo->type & GST_PAD_PROBE_TYPE_BUFFER)
+        
+        return m_repeatEnabled;
+    }
+    
+    bool DecodeSourceBintr::SetRepeatEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        if (m_isLive)
+        {
+            LOG_ERROR("Unable to set repeat enabled for Source '" << GetName() 
+                << "' as it's a live source");
+            return false;
+        }
+        if (IsLinked())
         {
-            GST_BUFFER_PTS(GST_BUFFER(pInfo->data)) += m_prevAccumulatedBase;
+            LOG_ERROR("Unable to set repeat enabled for Source '" << GetName() 
+                << "' as it's currently linked");
+            return false;
         }
+        m_repeatEnabled = enabled;
         
-        if (pInfo->type & GST_PAD_PROBE_TYPE_EVENT_BOTH)
+        return true;
+    }
+    
+    GstPadProbeReturn DecodeSourceBintr::HandleStreamBufferRestart(GstPad* pPad, GstPadProbeInfo* pInfo)
+    {
+        if (pInfo->type & GST_PAD_PROBE_TYPE_BUFFER)
         {
-            if (GST_EVENT_TYPE(event) == GST_EVENT_EOS)
+            GstBuffer* pBuffer = GST_PAD_PROBE_INFO_BUFFER(pInfo);
+            
+            if (m_streamTimeOffset)
             {
-                g_timeout_add(1, StreamBufferSeekCB, this);
+                pBuffer = gst_buffer_make_writable(pBuffer);
+                
+                if (GST_BUFFER_PTS_IS_VALID(pBuffer))
+                {
+                    GST_BUFFER_PTS(pBuffer) = 
+                        std::max((GstClockTimeDiff)0, (GstClockTimeDiff)GST_BUFFER_PTS(pBuffer) + m_streamTimeOffset);
+                }
+                if (GST_BUFFER_DTS_IS_VALID(pBuffer))
+                {
+                    GST_BUFFER_DTS(pBuffer) = 
+                        std::max((GstClockTimeDiff)0, (GstClockTimeDiff)GST_BUFFER_DTS(pBuffer) + m_streamTimeOffset);
+                }
+                GST_PAD_PROBE_INFO_DATA(pInfo) = pBuffer;
             }
-            if (GST_EVENT_TYPE(event) == GST_EVENT_SEGMENT)
+            if (GST_BUFFER_DURATION_IS_VALID(pBuffer))
             {
-                GstSegment* segment;
-
-                gst_event_parse_segment(event, (const GstSegment**)&segment);
-                segment->base = m_accumulatedBase;
-                m_prevAccumulatedBase = m_accumulatedBase;
-                m_accumulatedBase += segment->stop;
+                m_streamLastBufferDuration = GST_BUFFER_DURATION(pBuffer);
+            }
+            if (GST_BUFFER_PTS_IS_VALID(pBuffer))
+            {
+                m_streamLastBufferEnd = std::max(m_streamLastBufferEnd,
+                    GST_BUFFER_PTS(pBuffer) + m_streamLastBufferDuration);
             }
-            switch (GST_EVENT_TYPE (event))
+            return GST_PAD_PROBE_OK;
+        }
+        
+        GstEvent* pEvent = GST_PAD_PROBE_INFO_EVENT(pInfo);
+
+        switch (GST_EVENT_TYPE(pEvent))
+        {
+        case GST_EVENT_SEGMENT:
             {
-            case GST_EVENT_EOS:
-            // QOS events from downstream sink elements cause decoder to drop
-            // frames after looping the file since the timestamps reset to 0.
-            // We should drop the QOS events since we have custom logic for
-            // looping individual sources.
-            case GST_EVENT_QOS:
-            case GST_EVENT_SEGMENT:
-            case GST_EVENT_FLUSH_START:
-            case GST_EVENT_FLUSH_STOP:
-                return GST_PAD_PROBE_DROP;
-            default:
-                break;
+                const GstSegment* pSegment;
+                gst_event_parse_segment(pEvent, &pSegment);
+                
+                // All subsequent segments are dropped, with the offset updated 
+                // so that the restarted stream continues from the last buffer.
+                if (m_firstSegmentReceived)
+                {
+                    m_streamTimeOffset = 
+                        (GstClockTimeDiff)m_streamLastBufferEnd - (GstClockTimeDiff)pSegment->start;
+                    LOG_INFO("Stream restarted for Source '" << GetName() 
+                        << "' with time offset = " << m_streamTimeOffset);
+                    return GST_PAD_PROBE_DROP;
+                }
+                m_firstSegmentReceived = true;
+                
+                // The first segment is opened ended to allow for the continuous stream
+                GstSegment segment;
+                gst_segment_copy_into(pSegment, &segment);
+                segment.stop = GST_CLOCK_TIME_NONE;
+                segment.duration = GST_CLOCK_TIME_NONE;
+                
+                GstEvent* pNewEvent = gst_event_new_segment(&segment);
+                gst_event_set_seqnum(pNewEvent, gst_event_get_seqnum(pEvent));
+                gst_event_unref(pEvent);
+                GST_PAD_PROBE_INFO_DATA(pInfo) = pNewEvent;
+                
+                HandleFirstSegment();
+                return GST_PAD_PROBE_OK;
             }
+        case GST_EVENT_SEGMENT_DONE:
+            g_timeout_add(1, StreamBufferSeekCB, this);
+            return GST_PAD_PROBE_DROP;
+            
+        case GST_EVENT_STREAM_START:
+            return (m_firstSegmentReceived) ? GST_PAD_PROBE_DROP : GST_PAD_PROBE_OK;
+            
+        case GST_EVENT_EOS:
+            return (HandleStreamEos()) ? GST_PAD_PROBE_DROP : GST_PAD_PROBE_OK;
+            
+        // QOS events from downstream sink elements cause decoder to drop
+        // frames after looping the file since the timestamps reset to 0.
+        // Flush events are the result of the initial segment seek and 
+        // must not reach the Stream Muxer.
+        case GST_EVENT_QOS:
+        case GST_EVENT_FLUSH_START:
+        case GST_EVENT_FLUSH_STOP:
+            return GST_PAD_PROBE_DROP;
+        default:
+            break;
         }
         return GST_PAD_PROBE_OK;
     }
@@ -524,20 +1119,39 @@ namespace DSL
         }
     }
     
+    void DecodeSourceBintr::HandleFirstSegment()
+    {
+        if (m_repeatEnabled)
+        {
+            g_timeout_add(1, StreamBufferSeekCB, this);
+        }
+    }
+    
     gboolean DecodeSourceBintr::HandleStreamBufferSeek()
     {
-        SetState(GST_STATE_PAUSED);
+        LOG_FUNC();
         
-        gboolean retval = gst_element_seek(GetGstElement(), 1.0, GST_FORMAT_TIME,
-            (GstSeekFlags)(GST_SEEK_FLAG_KEY_UNIT | GST_SEEK_FLAG_FLUSH),
-            GST_SEEK_TYPE_SET, 0, GST_SEEK_TYPE_NONE, GST_CLOCK_TIME_NONE);
-
-        if (!retval)
+        if (!m_pStreamRestartPad)
         {
-            LOG_WARN("Failure to seek");
+            return false;
         }
+        
+        // The initial seek flushes the partially played first pass. All others are
+        // non-flushing so the demuxer queues the next pass behind the current.
+        GstSeekFlags flags = (m_segmentSeekActive)
+            ? GST_SEEK_FLAG_SEGMENT
+            : (GstSeekFlags)(GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_SEGMENT);
 
-        SetState(GST_STATE_PLAYING);
+        GstEvent* pSeekEvent = gst_event_new_seek(1.0, GST_FORMAT_TIME, flags,
+            GST_SEEK_TYPE_SET, 0, GST_SEEK_TYPE_NONE, GST_CLOCK_TIME_NONE);
+        
+        // Send upstream from the decoder sink pad to the demuxer
+        if (!gst_pad_push_event(m_pStreamRestartPad, pSeekEvent))
+        {
+            LOG_WARN("Failure to seek for Source '" << GetName() << "'");
+        }
+        m_segmentSeekActive = true;
+        
         return false;
     }
 
@@ -690,46 +1304,280 @@ namespace DSL
 
         return true;
     }
-
-    void UriSourceBintr::UnlinkAll()
+
+    void UriSourceBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+    
+        if (!m_isLinked)
+        {
+            LOG_ERROR("UriSourceBintr '" << GetName() << "' is not in a linked state");
+            return;
+        }
+        m_pFakeSinkQueue->UnlinkFromSource();
+        m_pFakeSinkQueue->UnlinkFromSink();
+
+        if (HasDewarperBintr())
+        {
+            m_pDewarperBintr->UnlinkFromSource();
+            m_pDewarperBintr->UnlinkFromSink();
+        }
+        else
+        {
+            m_pSourceQueue->UnlinkFromSource();
+        }
+
+        for (auto const& imap: m_pGstRequestedSourcePads)
+        {
+            gst_element_release_request_pad(m_pTee->GetGstElement(), imap.second);
+            gst_object_unref(imap.second);
+        }
+        
+        m_isLinked = false;
+    }
+
+    void UriSourceBintr::HandleSourceElementOnPadAdded(GstElement* pBin, GstPad* pPad)
+    {
+        LOG_FUNC();
+
+        // The "pad-added" callback will be called twice for each URI source,
+        // once each for the decoded Audio and Video streams. Since we only 
+        // want to link to the Video source pad, we need to know which of the
+        // two streams this call is for.
+        GstCaps* pCaps = gst_pad_query_caps(pPad, NULL);
+        GstStructure* structure = gst_caps_get_structure(pCaps, 0);
+        std::string name = gst_structure_get_name(structure);
+        
+        LOG_INFO("Caps structs name " << name);
+        if (name.find("video") != std::string::npos)
+        {
+            m_pGstStaticSinkPad = gst_element_get_static_pad(m_pTee->GetGstElement(), "sink");
+            if (!m_pGstStaticSinkPad)
+            {
+                LOG_ERROR("Failed to get Static Source Pad for Streaming Source '" << GetName() << "'");
+            }
+            
+            if (gst_pad_link(pPad, m_pGstStaticSinkPad) != GST_PAD_LINK_OK) 
+            {
+                LOG_ERROR("Failed to link decodebin to pipeline");
+                throw;
+            }
+            
+            // Update the cap memebers for this URI Source Bintr
+            gst_structure_get_uint(structure, "width", &m_width);
+            gst_structure_get_uint(structure, "height", &m_height);
+            gst_structure_get_fraction(structure, "framerate", (gint*)&m_fps_n, (gint*)&m_fps_d);
+            
+            LOG_INFO("Video decode linked for URI source '" << GetName() << "'");
+        }
+    }
+
+    bool UriSourceBintr::SetUri(const char* uri)
+    {
+        LOG_FUNC();
+        
+        if (IsInUse())
+        {
+            LOG_ERROR("Unable to set Uri for UriSourceBintr '" << GetName() 
+                << "' as it's currently in use");
+            return false;
+        }
+        std::string newUri(uri);
+        if (newUri.find("http") == std::string::npos)
+        {
+            if (m_isLive)
+            {
+                LOG_ERROR("Invalid URI '" << uri << "' for Live source '" << GetName() << "'");
+                return false;
+            }
+            std::ifstream streamUriFile(uri);
+            if (!streamUriFile.good())
+            {
+                LOG_ERROR("URI Source'" << uri << "' Not found");
+                return false;
+            }
+            // File source, not live - setup full path
+            char absolutePath[PATH_MAX+1];
+            m_uri.assign(realpath(uri, absolutePath));
+            m_uri.insert(0, "file:");
+        }        
+        m_pSourceElement->SetAttribute("uri", m_uri.c_str());
+        
+        return true;
+    }
+    
+    //*********************************************************************************
+
+    PlaylistSourceBintr::PlaylistSourceBintr(const char* name, const char** files, 
+        bool repeatEnabled, uint cudadecMemType, uint intraDecode, uint dropFrameInterval)
+        : DecodeSourceBintr(name, "filesrc", files[0], false, cudadecMemType, intraDecode, dropFrameInterval)
+        , m_index(0)
+    {
+        LOG_FUNC();
+        
+        m_repeatEnabled = repeatEnabled;
+        
+        for (const char** file = files; *file; file++)
+        {
+            std::ifstream streamFile(*file);
+            if (!streamFile.good())
+            {
+                LOG_ERROR("Playlist file '" << *file << "' Not found");
+                throw;
+            }
+            char absolutePath[PATH_MAX+1];
+            m_files.push_back(realpath(*file, absolutePath));
+        }
+        
+        // New Elementrs for this Source
+        m_pParseBin = DSL_ELEMENT_NEW("parsebin", "parse-bin");
+        m_pDecodeBin = DSL_ELEMENT_NEW("decodebin", "decode-bin");
+        m_pSourceQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "src-queue");
+
+        m_pSourceElement->SetAttribute("location", m_files[0].c_str());
+
+        // Connect Parse and Decode Setup Callbacks
+        g_signal_connect(m_pParseBin->GetGObject(), "pad-added", 
+            G_CALLBACK(PlaylistParseElementOnPadAddedCB), this);
+        g_signal_connect(m_pDecodeBin->GetGObject(), "pad-added", 
+            G_CALLBACK(PlaylistDecodeElementOnPadAddedCB), this);
+        g_signal_connect(m_pDecodeBin->GetGObject(), "child-added", 
+            G_CALLBACK(OnChildAddedCB), this);
+
+        AddChild(m_pParseBin);
+        AddChild(m_pDecodeBin);
+        AddChild(m_pSourceQueue);
+        
+        // Source Ghost Pad for Source Queue
+        m_pSourceQueue->AddGhostPadToParent("src");
+    }
+
+    PlaylistSourceBintr::~PlaylistSourceBintr()
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            UnlinkAll();
+        }
+    }
+    
+    bool PlaylistSourceBintr::LinkAll()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("PlaylistSourceBintr '" << GetName() << "' is already in a linked state");
+            return false;
+        }
+        
+        // always start from the beginning of the playlist
+        m_index = 0;
+        m_pSourceElement->SetAttribute("location", m_files[m_index].c_str());
+        
+        if (!m_pSourceElement->LinkToSink(m_pParseBin))
+        {
+            return false;
+        }
+        if (HasDewarperBintr() and !m_pDewarperBintr->LinkToSink(m_pSourceQueue))
+        {
+            return false;
+        }
+        m_isLinked = true;
+        
+        return true;
+    }
+
+    void PlaylistSourceBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("PlaylistSourceBintr '" << GetName() << "' is not in a linked state");
+            return;
+        }
+        m_pSourceElement->UnlinkFromSink();
+        
+        if (HasDewarperBintr())
+        {
+            m_pDewarperBintr->UnlinkFromSink();
+        }
+        m_isLinked = false;
+    }
+
+    bool PlaylistSourceBintr::SetUri(const char* uri)
+    {
+        LOG_FUNC();
+        
+        if (IsInUse())
+        {
+            LOG_ERROR("Unable to set Uri for PlaylistSourceBintr '" << GetName() 
+                << "' as it's currently in use");
+            return false;
+        }
+        std::ifstream streamUriFile(uri);
+        if (!streamUriFile.good())
+        {
+            LOG_ERROR("Playlist file '" << uri << "' Not found");
+            return false;
+        }
+        char absolutePath[PATH_MAX+1];
+        m_files.assign(1, realpath(uri, absolutePath));
+        
+        m_uri.assign(m_files[0]);
+        m_uri.insert(0, "file:");
+        m_pSourceElement->SetAttribute("location", m_files[0].c_str());
+        
+        return true;
+    }
+    
+    uint PlaylistSourceBintr::GetIndex()
     {
         LOG_FUNC();
+        
+        return m_index;
+    }
     
-        if (!m_isLinked)
-        {
-            LOG_ERROR("UriSourceBintr '" << GetName() << "' is not in a linked state");
-            return;
-        }
-        m_pFakeSinkQueue->UnlinkFromSource();
-        m_pFakeSinkQueue->UnlinkFromSink();
+    uint PlaylistSourceBintr::GetSize()
+    {
+        LOG_FUNC();
+        
+        return m_files.size();
+    }
 
-        if (HasDewarperBintr())
-        {
-            m_pDewarperBintr->UnlinkFromSource();
-            m_pDewarperBintr->UnlinkFromSink();
-        }
-        else
-        {
-            m_pSourceQueue->UnlinkFromSource();
-        }
+    void PlaylistSourceBintr::HandleParseElementOnPadAdded(GstElement* pBin, GstPad* pPad)
+    {
+        LOG_FUNC();
 
-        for (auto const& imap: m_pGstRequestedSourcePads)
+        GstCaps* pCaps = gst_pad_query_caps(pPad, NULL);
+        GstStructure* structure = gst_caps_get_structure(pCaps, 0);
+        std::string name = gst_structure_get_name(structure);
+        gst_caps_unref(pCaps);
+        
+        LOG_INFO("Caps structs name " << name);
+        if (name.find("video") != std::string::npos)
         {
-            gst_element_release_request_pad(m_pTee->GetGstElement(), imap.second);
-            gst_object_unref(imap.second);
+            // The decodebin's sink pad is relinked for each file in the playlist 
+            GstPad* pSinkPad = gst_element_get_static_pad(m_pDecodeBin->GetGstElement(), "sink");
+            if (gst_pad_is_linked(pSinkPad))
+            {
+                LOG_WARN("Playlist Source '" << GetName() << "' has more than one video stream");
+            }
+            else if (gst_pad_link(pPad, pSinkPad) != GST_PAD_LINK_OK) 
+            {
+                LOG_ERROR("Failed to link parsebin to decodebin for Playlist Source '" 
+                    << GetName() << "'");
+            }
+            gst_object_unref(pSinkPad);
         }
-        
-        m_isLinked = false;
     }
-
-    void UriSourceBintr::HandleSourceElementOnPadAdded(GstElement* pBin, GstPad* pPad)
+    
+    void PlaylistSourceBintr::HandleDecodeElementOnPadAdded(GstElement* pBin, GstPad* pPad)
     {
         LOG_FUNC();
 
-        // The "pad-added" callback will be called twice for each URI source,
-        // once each for the decoded Audio and Video streams. Since we only 
-        // want to link to the Video source pad, we need to know which of the
-        // two streams this call is for.
         GstCaps* pCaps = gst_pad_query_caps(pPad, NULL);
         GstStructure* structure = gst_caps_get_structure(pCaps, 0);
         std::string name = gst_structure_get_name(structure);
@@ -737,7 +1585,11 @@ namespace DSL
         LOG_INFO("Caps structs name " << name);
         if (name.find("video") != std::string::npos)
         {
-            m_pGstStaticSinkPad = gst_element_get_static_pad(m_pTee->GetGstElement(), "sink");
+            GstElement* pSinkElement = (HasDewarperBintr())
+                ? m_pDewarperBintr->GetGstElement()
+                : m_pSourceQueue->GetGstElement();
+                
+            m_pGstStaticSinkPad = gst_element_get_static_pad(pSinkElement, "sink");
             if (!m_pGstStaticSinkPad)
             {
                 LOG_ERROR("Failed to get Static Source Pad for Streaming Source '" << GetName() << "'");
@@ -749,58 +1601,78 @@ namespace DSL
                 throw;
             }
             
-            // Update the cap memebers for this URI Source Bintr
+            // Update the cap memebers for this Playlist Source Bintr
             gst_structure_get_uint(structure, "width", &m_width);
             gst_structure_get_uint(structure, "height", &m_height);
             gst_structure_get_fraction(structure, "framerate", (gint*)&m_fps_n, (gint*)&m_fps_d);
             
-            LOG_INFO("Video decode linked for URI source '" << GetName() << "'");
+            LOG_INFO("Video decode linked for Playlist source '" << GetName() << "'");
         }
+        gst_caps_unref(pCaps);
     }
-
-    bool UriSourceBintr::SetUri(const char* uri)
+    
+    bool PlaylistSourceBintr::HandleStreamEos()
+    {
+        // end of a non-repeating playlist, let the EOS through
+        if (!m_repeatEnabled and m_index == m_files.size()-1)
+        {
+            return false;
+        }
+        g_timeout_add(1, PlaylistNextCB, this);
+        return true;
+    }
+    
+    gboolean PlaylistSourceBintr::HandlePlaylistNext()
     {
         LOG_FUNC();
         
-        if (IsInUse())
+        if (!IsLinked())
         {
-            LOG_ERROR("Unable to set Uri for UriSourceBintr '" << GetName() 
-                << "' as it's currently in use");
             return false;
         }
-        std::string newUri(uri);
-        if (newUri.find("http") == std::string::npos)
+        m_index = (m_index + 1) % m_files.size();
+
+        // Restart the file source and parser only. The parsebin's src pad is removed
+        // on transition to NULL, and the new pad relinked to the running decodebin. 
+        gst_element_set_state(m_pParseBin->GetGstElement(), GST_STATE_NULL);
+        gst_element_set_state(m_pSourceElement->GetGstElement(), GST_STATE_NULL);
+        
+        m_pSourceElement->SetAttribute("location", m_files[m_index].c_str());
+        
+        if (!gst_element_sync_state_with_parent(m_pParseBin->GetGstElement()) or
+            !gst_element_sync_state_with_parent(m_pSourceElement->GetGstElement()))
         {
-            if (m_isLive)
-            {
-                LOG_ERROR("Invalid URI '" << uri << "' for Live source '" << GetName() << "'");
-                return false;
-            }
-            std::ifstream streamUriFile(uri);
-            if (!streamUriFile.good())
-            {
-                LOG_ERROR("URI Source'" << uri << "' Not found");
-                return false;
-            }
-            // File source, not live - setup full path
-            char absolutePath[PATH_MAX+1];
-            m_uri.assign(realpath(uri, absolutePath));
-            m_uri.insert(0, "file:");
-        }        
-        m_pSourceElement->SetAttribute("uri", m_uri.c_str());
+            LOG_ERROR("Failed to restart Playlist Source '" << GetName() 
+                << "' with file '" << m_files[m_index] << "'");
+            return false;
+        }
+        LOG_INFO("Playlist Source '" << GetName() << "' playing file '" 
+            << m_files[m_index] << "' at index " << m_index);
         
-        return true;
+        return false;
     }
-    
+
     //*********************************************************************************
     
     RtspSourceBintr::RtspSourceBintr(const char* name, const char* uri, uint protocol,
         uint cudadecMemType, uint intraDecode, uint dropFrameInterval, uint latency)
         : DecodeSourceBintr(name, "rtspsrc", uri, true, cudadecMemType, intraDecode, dropFrameInterval)
         , m_rtpProtocols(protocol)
+        , m_bufferTimeout(DSL_DEFAULT_RTSP_BUFFER_TIMEOUT)
+        , m_reconnectBackoffMin(DSL_DEFAULT_RTSP_RECONNECT_BACKOFF_MIN)
+        , m_reconnectBackoffMax(DSL_DEFAULT_RTSP_RECONNECT_BACKOFF_MAX)
+        , m_reconnectBackoff(DSL_DEFAULT_RTSP_RECONNECT_BACKOFF_MIN)
+        , m_lastBufferTime(0)
+        , m_nextReconnectTime(0)
+        , m_connectionState(DSL_RTSP_CONNECTION_STATE_IDLE)
+        , m_reconnectCount(0)
+        , m_pWatchdogTimerSource(NULL)
+        , m_watchdogProbeId(0)
     {
         LOG_FUNC();
         
+        g_mutex_init(&m_connectionMutex);
+
         // Set RTSP latency
         m_latency = latency;
         LOG_DEBUG("Setting latency to '" << latency << "' for RtspSourceBintr '" << m_name << "'");
@@ -836,6 +1708,15 @@ namespace DSL
         
         // Source Ghost Pad for Source Queue
         m_pSourceQueue->AddGhostPadToParent("src");
+        
+        m_pConnectionStateMetric = MetricsRegistry::GetRegistry()->GetGauge(
+            "dsl_rtsp_source_connection_state", 
+            "Current DSL_RTSP_CONNECTION_STATE of each RTSP Source",
+            MetricsRegistry::Label("source", GetName()));
+        m_pReconnectsMetric = MetricsRegistry::GetRegistry()->GetCounter(
+            "dsl_rtsp_source_reconnects_total", 
+            "Total reconnection attempts for each RTSP Source",
+            MetricsRegistry::Label("source", GetName()));
     }
 
     RtspSourceBintr::~RtspSourceBintr()
@@ -846,6 +1727,7 @@ namespace DSL
         {
             UnlinkAll();
         }
+        g_mutex_clear(&m_connectionMutex);
     }
     
     bool RtspSourceBintr::LinkAll()
@@ -890,6 +1772,17 @@ namespace DSL
         {
             return false;
         }
+        
+        // Timestamp every buffer leaving the decoder for the stream watchdog
+        GstPad* pSinkPad = gst_element_get_static_pad(m_pSourceQueue->GetGstElement(), "sink");
+        m_watchdogProbeId = gst_pad_add_probe(pSinkPad, GST_PAD_PROBE_TYPE_BUFFER,
+            RtspStreamBufferProbeCB, this, NULL);
+        gst_object_unref(pSinkPad);
+        
+        m_lastBufferTime = 0;
+        m_pWatchdogTimerSource = AddPipelineTimeout(GetGstObject(), 
+            1000, RtspStreamWatchdogHandler, this);
+
         m_isLinked = true;
         
         return true;
@@ -904,6 +1797,20 @@ namespace DSL
             LOG_ERROR("RtspSourceBintr '" << GetName() << "' is not in a linked state");
             return;
         }
+        if (m_pWatchdogTimerSource)
+        {
+            RemovePipelineTimeout(m_pWatchdogTimerSource);
+            m_pWatchdogTimerSource = NULL;
+        }
+        if (m_watchdogProbeId)
+        {
+            GstPad* pSinkPad = gst_element_get_static_pad(m_pSourceQueue->GetGstElement(), "sink");
+            gst_pad_remove_probe(pSinkPad, m_watchdogProbeId);
+            gst_object_unref(pSinkPad);
+            m_watchdogProbeId = 0;
+        }
+        SetConnectionState(DSL_RTSP_CONNECTION_STATE_IDLE);
+        
         m_pPreDecodeQueue->UnlinkFromSink();
         if (HasTapBintr())
         {
@@ -911,8 +1818,11 @@ namespace DSL
             m_pTapBintr->UnlinkAll();
             m_pPreDecodeQueue->UnlinkFromSource();
         }
-        m_pParser->UnlinkFromSink();
-        m_pDepay->UnlinkFromSink();
+        if (m_pDepay and m_pDepay->IsLinkedToSink())
+        {
+            m_pParser->UnlinkFromSink();
+            m_pDepay->UnlinkFromSink();
+        }
         
         for (auto const& imap: m_pGstRequestedSourcePads)
         {
@@ -1006,23 +1916,36 @@ namespace DSL
             LOG_WARN("Unsupported media = '" << media << "' for RtspSourceBitnr '" << GetName() << "'");
             return false;
         }
-        if (encoding.find("H264") != std::string::npos)
+        // On reconnect or replay, the depay and parser already exist and are reused.
+        if (m_pDepay)
+        {
+            LOG_INFO("Reusing existing depay and parser for RtspSourceBitnr '" << GetName() << "'");
+        }
+        else if (encoding.find("H264") != std::string::npos)
         {
             m_pParser = DSL_ELEMENT_NEW("h264parse", "src-parse");
             m_pDepay = DSL_ELEMENT_NEW("rtph264depay", "src-depay");
+            AddChild(m_pDepay);
+            AddChild(m_pParser);
         }
         else if (encoding.find("H265") != std::string::npos)
         {
             m_pParser = DSL_ELEMENT_NEW("h265parse", "src-parse");
             m_pDepay = DSL_ELEMENT_NEW("rtph265depay", "src-depayload");
+            AddChild(m_pDepay);
+            AddChild(m_pParser);
         }
         else
         {
             LOG_ERROR("Unsupported encoding = '" << encoding << "' for RtspSourceBitnr '" << GetName() << "'");
             return false;
         }
-        AddChild(m_pDepay);
-        AddChild(m_pParser);
+        // On reconnect, the chain is still linked downstream. After a stop, 
+        // UnlinkAll has unlinked it and it must be relinked for the replay.
+        if (m_pDepay->IsLinkedToSink())
+        {
+            return true;
+        }
 
         // If we're tapping off of the pre-decode source stream, then link to the pre-decode Tee
         // The Pre-decode Queue will already be linked downstream as the first branch on the Tee
@@ -1110,6 +2033,235 @@ namespace DSL
     }
     
     
+    uint RtspSourceBintr::GetBufferTimeout()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+        
+        return m_bufferTimeout;
+    }
+    
+    void RtspSourceBintr::SetBufferTimeout(uint timeout)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+        
+        m_bufferTimeout = timeout;
+        
+        // restart the timeout period from now 
+        m_lastBufferTime = g_get_monotonic_time();
+    }
+    
+    void RtspSourceBintr::GetReconnectionParams(uint* backoffMin, uint* backoffMax)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+        
+        *backoffMin = m_reconnectBackoffMin;
+        *backoffMax = m_reconnectBackoffMax;
+    }
+    
+    bool RtspSourceBintr::SetReconnectionParams(uint backoffMin, uint backoffMax)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+        
+        if (!backoffMin or backoffMin > backoffMax)
+        {
+            LOG_ERROR("Invalid reconnection params min = " << backoffMin 
+                << ", max = " << backoffMax << " for RtspSourceBintr '" << GetName() << "'");
+            return false;
+        }
+        m_reconnectBackoffMin = backoffMin;
+        m_reconnectBackoffMax = backoffMax;
+        m_reconnectBackoff = backoffMin;
+        return true;
+    }
+    
+    void RtspSourceBintr::GetConnectionData(uint* state, uint* reconnectCount, 
+        std::string& lastError)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+        
+        *state = m_connectionState;
+        *reconnectCount = m_reconnectCount;
+        
+        // copied while locked, the error can be updated from the bus-watch thread
+        lastError.assign(m_lastError);
+    }
+    
+    void RtspSourceBintr::ClearConnectionStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+        
+        m_reconnectCount = 0;
+        m_lastError.clear();
+    }
+    
+    void RtspSourceBintr::SetLastError(const char* error)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+        
+        m_lastError.assign(error);
+    }
+    
+    bool RtspSourceBintr::AddStateChangeListener(
+        dsl_rtsp_connection_state_change_listener_cb listener, void* userdata)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+        
+        if (m_stateChangeListeners.find(listener) != m_stateChangeListeners.end())
+        {   
+            LOG_ERROR("RTSP Source listener is not unique");
+            return false;
+        }
+        m_stateChangeListeners[listener] = userdata;
+        
+        return true;
+    }
+
+    bool RtspSourceBintr::RemoveStateChangeListener(
+        dsl_rtsp_connection_state_change_listener_cb listener)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+        
+        if (m_stateChangeListeners.find(listener) == m_stateChangeListeners.end())
+        {   
+            LOG_ERROR("RTSP Source listener was not found");
+            return false;
+        }
+        m_stateChangeListeners.erase(listener);
+        
+        return true;
+    }
+    
+    void RtspSourceBintr::SetConnectionState(uint state)
+    {
+        uint prevState;
+        std::map<dsl_rtsp_connection_state_change_listener_cb, void*> listeners;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+            
+            if (m_connectionState == state)
+            {
+                return;
+            }
+            prevState = m_connectionState;
+            m_connectionState = state;
+            listeners = m_stateChangeListeners;
+            
+            m_pConnectionStateMetric->Set(state);
+        }
+        LOG_INFO("Connection state change from " << prevState << " to " 
+            << state << " for RtspSourceBintr '" << GetName() << "'");
+
+        // iterate through the map of state-change-listeners calling each
+        for(auto const& imap: listeners)
+        {
+            imap.first(prevState, state, imap.second);
+        }
+    }
+    
+    void RtspSourceBintr::HandleStreamBuffer()
+    {
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+            
+            m_lastBufferTime = g_get_monotonic_time();
+            
+            if (m_connectionState == DSL_RTSP_CONNECTION_STATE_CONNECTED)
+            {
+                return;
+            }
+            m_reconnectBackoff = m_reconnectBackoffMin;
+        }
+        SetConnectionState(DSL_RTSP_CONNECTION_STATE_CONNECTED);
+    }
+    
+    int RtspSourceBintr::HandleStreamWatchdog()
+    {
+        bool isStreamLost(false);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_connectionMutex);
+            
+            gint64 now = g_get_monotonic_time();
+
+            // The timeout period starts once the Source is playing
+            if (!m_bufferTimeout or GST_STATE(GetGstElement()) != GST_STATE_PLAYING or
+                !m_lastBufferTime)
+            {
+                m_lastBufferTime = now;
+                return true;
+            }
+            if (m_connectionState == DSL_RTSP_CONNECTION_STATE_RECONNECTING)
+            {
+                if (now < m_nextReconnectTime)
+                {
+                    return true;
+                }
+                // The last attempt failed to produce a buffer in time, so back off
+                m_reconnectBackoff = std::min(m_reconnectBackoff*2, m_reconnectBackoffMax);
+            }
+            else if ((now - m_lastBufferTime) < (gint64)m_bufferTimeout*G_USEC_PER_SEC)
+            {
+                return true;
+            }
+            else
+            {
+                LOG_WARN("No buffer received within " << m_bufferTimeout 
+                    << " seconds for RtspSourceBintr '" << GetName() << "'");
+                isStreamLost = true;
+            }
+            m_reconnectCount++;
+            m_pReconnectsMetric->Increment();
+            
+            // Each attempt is given at least the buffer timeout to produce a buffer
+            m_nextReconnectTime = now + 
+                (gint64)std::max(m_reconnectBackoff, m_bufferTimeout)*G_USEC_PER_SEC;
+        }
+        // Must not hold the connection mutex while notifying clients or
+        // while stopping the streaming threads
+        if (isStreamLost)
+        {
+            SetConnectionState(DSL_RTSP_CONNECTION_STATE_RECONNECTING);
+        }
+        Reconnect();
+        return true;
+    }
+    
+    void RtspSourceBintr::Reconnect()
+    {
+        LOG_FUNC();
+        
+        LOG_INFO("Reconnecting RtspSourceBintr '" << GetName() << "' to '" << m_uri << "'");
+        
+        // The depay and parser are only created once the first stream is selected
+        std::vector<DSL_ELEMENT_PTR> elementrs = {m_pSourceElement, m_pDepay, m_pParser, m_pDecodeBin};
+
+        for (auto const& ivec: elementrs)
+        {
+            if (ivec and gst_element_set_state(ivec->GetGstElement(), 
+                GST_STATE_NULL) == GST_STATE_CHANGE_FAILURE)
+            {
+                LOG_ERROR("Failed to set Elementr '" << ivec->GetName() 
+                    << "' to NULL for RtspSourceBintr '" << GetName() << "'");
+            }
+        }
+        for (auto const& ivec: elementrs)
+        {
+            if (ivec and !gst_element_sync_state_with_parent(ivec->GetGstElement()))
+            {
+                LOG_ERROR("Failed to sync Elementr '" << ivec->GetName() 
+                    << "' with parent for RtspSourceBintr '" << GetName() << "'");
+            }
+        }
+    }
+    
     static void UriSourceElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource)
     {
         static_cast<UriSourceBintr*>(pSource)->HandleSourceElementOnPadAdded(pBin, pPad);
@@ -1121,6 +2273,21 @@ namespace DSL
         static_cast<RtspSourceBintr*>(pSource)->HandleSelectStream(pBin, num, caps);
     }
         
+    static void PlaylistParseElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource)
+    {
+        static_cast<PlaylistSourceBintr*>(pSource)->HandleParseElementOnPadAdded(pBin, pPad);
+    }
+    
+    static void PlaylistDecodeElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource)
+    {
+        static_cast<PlaylistSourceBintr*>(pSource)->HandleDecodeElementOnPadAdded(pBin, pPad);
+    }
+    
+    static gboolean PlaylistNextCB(gpointer pSource)
+    {
+        return static_cast<PlaylistSourceBintr*>(pSource)->HandlePlaylistNext();
+    }
+    
     static void RtspSourceElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource)
     {
         static_cast<RtspSourceBintr*>(pSource)->HandleSourceElementOnPadAdded(pBin, pPad);
@@ -1131,6 +2298,18 @@ namespace DSL
         static_cast<RtspSourceBintr*>(pSource)->HandleDecodeElementOnPadAdded(pBin, pPad);
     }
     
+    static GstPadProbeReturn RtspStreamBufferProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource)
+    {
+        static_cast<RtspSourceBintr*>(pSource)->HandleStreamBuffer();
+        return GST_PAD_PROBE_OK;
+    }
+    
+    static int RtspStreamWatchdogHandler(gpointer pSource)
+    {
+        return static_cast<RtspSourceBintr*>(pSource)->HandleStreamWatchdog();
+    }
+    
     static void OnChildAddedCB(GstChildProxy* pChildProxy, GObject* pObject,
         gchar* name, gpointer pSource)
     {
@@ -1155,4 +2334,29 @@ namespace DSL
         return static_cast<DecodeSourceBintr*>(pSource)->HandleStreamBufferSeek();
     }
 
-} // SDL namespace
\ No newline at end of file
+    static void AppSourceNeedDataCB(GstAppSrc* pAppSrc, guint length, gpointer pSource)
+    {
+        static_cast<AppSourceBintr*>(pSource)->HandleNeedData(length);
+    }
+    
+    static void AppSourceEnoughDataCB(GstAppSrc* pAppSrc, gpointer pSource)
+    {
+        static_cast<AppSourceBintr*>(pSource)->HandleEnoughData();
+    }
+    
+    static void AppSourceBufferReleaseCB(gpointer pReleaseData)
+    {
+        AppSourceBufferRelease* pRelease = 
+            static_cast<AppSourceBufferRelease*>(pReleaseData);
+        try
+        {
+            pRelease->release(pRelease->data, pRelease->clientData);
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source threw exception calling client buffer release");
+        }
+        delete pRelease;
+    }
+
+} // SDL namespace
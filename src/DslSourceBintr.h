@@ -32,6 +32,7 @@ THE SOFTWARE.
 #include "DslElementr.h"
 #include "DslDewarperBintr.h"
 #include "DslTapBintr.h"
+#include "DslMetrics.h"
 
 namespace DSL
 {
@@ -50,12 +51,24 @@ namespace DSL
     #define DSL_USB_SOURCE_NEW(name, width, height, fps_n, fps_d) \
         std::shared_ptr<UsbSourceBintr>(new UsbSourceBintr(name, width, height, fps_n, fps_d))
         
+    #define DSL_TEST_SOURCE_PTR std::shared_ptr<TestSourceBintr>
+    #define DSL_TEST_SOURCE_NEW(name, isLive, pattern, width, height, fps_n, fps_d, numFrames) \
+        std::shared_ptr<TestSourceBintr>(new TestSourceBintr(name, isLive, pattern, width, height, fps_n, fps_d, numFrames))
+        
+    #define DSL_APP_SOURCE_PTR std::shared_ptr<AppSourceBintr>
+    #define DSL_APP_SOURCE_NEW(name, isLive, format, width, height, fps_n, fps_d) \
+        std::shared_ptr<AppSourceBintr>(new AppSourceBintr(name, isLive, format, width, height, fps_n, fps_d))
+        
     #define DSL_DECODE_SOURCE_PTR std::shared_ptr<DecodeSourceBintr>
         
     #define DSL_URI_SOURCE_PTR std::shared_ptr<UriSourceBintr>
     #define DSL_URI_SOURCE_NEW(name, uri, isLive, cudadecMemType, intraDecode, dropFrameInterval) \
         std::shared_ptr<UriSourceBintr>(new UriSourceBintr(name, uri, isLive, cudadecMemType, intraDecode, dropFrameInterval))
         
+    #define DSL_PLAYLIST_SOURCE_PTR std::shared_ptr<PlaylistSourceBintr>
+    #define DSL_PLAYLIST_SOURCE_NEW(name, files, repeatEnabled, cudadecMemType, intraDecode, dropFrameInterval) \
+        std::shared_ptr<PlaylistSourceBintr>(new PlaylistSourceBintr(name, files, repeatEnabled, cudadecMemType, intraDecode, dropFrameInterval))
+        
     #define DSL_RTSP_SOURCE_PTR std::shared_ptr<RtspSourceBintr>
     #define DSL_RTSP_SOURCE_NEW(name, uri, protocol, cudadecMemType, intraDecode, dropFrameInterval, latency) \
         std::shared_ptr<RtspSourceBintr>(new RtspSourceBintr(name, uri, protocol, cudadecMemType, intraDecode, dropFrameInterval, latency))
@@ -254,6 +267,220 @@ namespace DSL
         DSL_ELEMENT_PTR m_pVidConv2;
     };    
 
+    //*********************************************************************************
+    /**
+     * @class TestSourceBintr
+     * @brief Implements a synthetic test-pattern Source using the videotestsrc 
+     * plugin. Requires no camera device, media file or decoder.
+     */
+    class TestSourceBintr : public SourceBintr
+    {
+    public: 
+    
+        TestSourceBintr(const char* name, bool isLive, uint pattern, 
+            uint width, uint height, uint fps_n, uint fps_d, uint numFrames);
+
+        ~TestSourceBintr();
+
+        /**
+         * @brief Links all Child Elementrs owned by this Source Bintr
+         * @return True success, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elementrs owned by this Source Bintr
+         */
+        void UnlinkAll();
+        
+        /**
+         * @brief Gets the current test pattern in use by this TestSourceBintr
+         * @return one of the DSL_TEST_PATTERN constant values
+         */
+        uint GetPattern();
+        
+        /**
+         * @brief Sets the test pattern for this TestSourceBintr to use
+         * @param[in] pattern one of the DSL_TEST_PATTERN constant values
+         * @return false if the pattern is invalid, true otherwise.
+         */
+        bool SetPattern(uint pattern);
+        
+        /**
+         * @brief Sets the GPU ID for all Elementrs
+         * @return true if successfully set, false otherwise.
+         */
+        bool SetGpuId(uint gpuId);
+
+    private:
+    
+        /**
+         * @brief current DSL_TEST_PATTERN value
+         */
+        uint m_pattern;
+        
+        /**
+         * @brief number of frames to generate before end-of-stream, 0 = unlimited
+         */
+        uint m_numFrames;
+        
+        /**
+         * @brief Caps Filter for the raw test pattern
+         */
+        DSL_ELEMENT_PTR m_pRawCapsFilter;
+
+        /**
+         * @brief Video converter to NVMM memory for the Stream Muxer
+         */
+        DSL_ELEMENT_PTR m_pVidConv;
+        
+        /**
+         * @brief Caps Filter for the NVMM output
+         */
+        DSL_ELEMENT_PTR m_pCapsFilter;
+    };    
+
+    //*********************************************************************************
+    /**
+     * @class AppSourceBintr
+     * @brief Implements an App Source using the appsrc plugin, for the client to 
+     * push raw video frames from application memory into the Pipeline.
+     */
+    class AppSourceBintr : public SourceBintr
+    {
+    public: 
+    
+        AppSourceBintr(const char* name, bool isLive, uint format, 
+            uint width, uint height, uint fps_n, uint fps_d);
+
+        ~AppSourceBintr();
+
+        /**
+         * @brief Links all Child Elementrs owned by this Source Bintr
+         * @return True success, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elementrs owned by this Source Bintr
+         */
+        void UnlinkAll();
+        
+        /**
+         * @brief Adds need-data and enough-data handlers to this AppSourceBintr
+         * @param[in] needDataHandler client function to call when data is needed
+         * @param[in] enoughDataHandler client function to call when the queue is full
+         * @param[in] clientData opaque pointer to client data passed to both handlers
+         * @return false if handlers have already been added, true otherwise.
+         */
+        bool AddDataHandlers(dsl_source_app_need_data_handler_cb needDataHandler, 
+            dsl_source_app_enough_data_handler_cb enoughDataHandler, void* clientData);
+        
+        /**
+         * @brief Removes the data handlers previously added to this AppSourceBintr
+         * @return false if handlers were not previously added, true otherwise.
+         */
+        bool RemoveDataHandlers();
+        
+        /**
+         * @brief Pushes a client frame into this AppSourceBintr. The client memory is
+         * wrapped without copying if a release function is provided, otherwise the data
+         * is copied into a recycled buffer from this Source's buffer pool.
+         * @param[in] data pointer to the client's frame data
+         * @param[in] size size of the frame data in bytes
+         * @param[in] pts presentation timestamp in ns or DSL_APP_SOURCE_TIMESTAMP_NONE
+         * @param[in] duration frame duration in ns or DSL_APP_SOURCE_TIMESTAMP_NONE
+         * @param[in] release client function to call when the data is released, or NULL
+         * @param[in] clientData opaque pointer to client data passed to release
+         * @return true if the buffer was queued successfully, false otherwise.
+         */
+        bool PushBuffer(void* data, uint size, uint64_t pts, uint64_t duration,
+            dsl_source_app_buffer_release_cb release, void* clientData);
+            
+        /**
+         * @brief Signals end-of-stream to this AppSourceBintr
+         * @return true on successful signal, false otherwise.
+         */
+        bool Eos();
+        
+        /**
+         * @brief Gets the maximum number of bytes the appsrc will queue
+         * @return current max queue level in bytes, 0 = unlimited
+         */
+        uint64_t GetMaxLevelBytes();
+        
+        /**
+         * @brief Sets the maximum number of bytes the appsrc will queue
+         * @param[in] maxBytes new max queue level in bytes, 0 = unlimited
+         * @return true on successful update, false otherwise.
+         */
+        bool SetMaxLevelBytes(uint64_t maxBytes);
+        
+        /**
+         * @brief Handles the appsrc need-data callback by calling the client's handler
+         * @param[in] length number of bytes needed, 0 if unknown.
+         */
+        void HandleNeedData(uint length);
+        
+        /**
+         * @brief Handles the appsrc enough-data callback by calling the client's handler
+         */
+        void HandleEnoughData();
+        
+        /**
+         * @brief Sets the GPU ID for all Elementrs
+         * @return true if successfully set, false otherwise.
+         */
+        bool SetGpuId(uint gpuId);
+
+    private:
+    
+        /**
+         * @brief current DSL_VIDEO_FORMAT value
+         */
+        uint m_format;
+        
+        /**
+         * @brief mutex to protect the client handlers and buffer pool
+         */
+        GMutex m_appSourceMutex;
+        
+        /**
+         * @brief client need-data handler, NULL if not set
+         */
+        dsl_source_app_need_data_handler_cb m_needDataHandler;
+        
+        /**
+         * @brief client enough-data handler, NULL if not set
+         */
+        dsl_source_app_enough_data_handler_cb m_enoughDataHandler;
+        
+        /**
+         * @brief opaque pointer to client data passed to both data handlers
+         */
+        void* m_clientData;
+        
+        /**
+         * @brief pool of recycled buffers used when the client's data must be copied
+         */
+        GstBufferPool* m_pBufferPool;
+        
+        /**
+         * @brief size of each buffer in m_pBufferPool in bytes
+         */
+        uint m_bufferPoolSize;
+
+        /**
+         * @brief Video converter to NVMM memory for the Stream Muxer
+         */
+        DSL_ELEMENT_PTR m_pVidConv;
+        
+        /**
+         * @brief Caps Filter for the NVMM output
+         */
+        DSL_ELEMENT_PTR m_pCapsFilter;
+    };    
+
     //*********************************************************************************
 
     /**
@@ -266,6 +493,8 @@ namespace DSL
     
         DecodeSourceBintr(const char* name, const char* factoryName, const char* uri, 
             bool isLive, uint cudadecMemType, uint intraDecode, uint dropFrameInterval);
+            
+        ~DecodeSourceBintr();
 
         /**
          * @brief returns the current URI source for this DecodeSourceBintr
@@ -303,16 +532,33 @@ namespace DSL
         void HandleOnSourceSetup(GstElement* pObject, GstElement* arg0);
 
         /**
-         * @brief 
-         * @param pPad
-         * @param pInfo
-         * @return 
+         * @brief Gets the current repeat enabled setting for this DecodeSourceBintr
+         * @return true if the file stream will be repeated on end-of-stream
+         */
+        bool GetRepeatEnabled();
+        
+        /**
+         * @brief Sets the repeat enabled setting for this DecodeSourceBintr
+         * @param[in] enabled set to true to repeat the file stream on end-of-stream
+         * @return false if the Source is live or currently linked, true otherwise
+         */
+        bool SetRepeatEnabled(bool enabled);
+
+        /**
+         * @brief Handles all buffers and events on the decoder's sink pad, offsetting
+         * the timestamps of each restarted stream so that they continue from the end 
+         * of the previous and the decoder sees a single continuous stream.
+         * @param[in] pPad decoder sink pad
+         * @param[in] pInfo probe info with the buffer or event
+         * @return GST_PAD_PROBE_DROP for all events superseded by the continuous 
+         * stream, GST_PAD_PROBE_OK otherwise.
          */
         GstPadProbeReturn HandleStreamBufferRestart(GstPad* pPad, GstPadProbeInfo* pInfo);
         
         /**
-         * @brief 
-         * @return 
+         * @brief Handles the segment seek timer, scheduled by the buffer restart
+         * probe on the first segment and each segment-done thereafter.
+         * @return false always to stop the one-shot timer.
          */
         gboolean HandleStreamBufferSeek();
 
@@ -338,6 +584,32 @@ namespace DSL
         
     protected:
 
+        /**
+         * @brief Called by the buffer restart probe on receipt of the first segment.
+         * Repeating file streams are played with segment seeks so that the demuxer
+         * signals segment-done rather than end-of-stream.
+         */
+        virtual void HandleFirstSegment();
+        
+        /**
+         * @brief Called by the buffer restart probe on receipt of an end-of-stream
+         * event. The default implementation lets the event continue downstream.
+         * @return true if the event has been handled and is to be dropped.
+         */
+        virtual bool HandleStreamEos()
+        {
+            return false;
+        };
+        
+        /**
+         * @brief Returns true if the buffer restart probe is to be added to the 
+         * decoder's sink pad, i.e. the Source's stream may restart.
+         */
+        virtual bool IsStreamRestartEnabled()
+        {
+            return (!m_isLive and m_repeatEnabled);
+        };
+
         /**
          * @brief
          */
@@ -359,14 +631,45 @@ namespace DSL
         guint m_dropFrameInterval;
         
         /**
-         * @brief
+         * @brief if true, the file stream is repeated with segment seeks 
+         * rather than ending on end-of-stream.
          */
-        guint m_accumulatedBase;
+        bool m_repeatEnabled;
+        
+        /**
+         * @brief true once the first segment of the continuous stream has been
+         * received. All subsequent segments are dropped by the buffer restart probe.
+         */
+        bool m_firstSegmentReceived;
 
         /**
-         * @brief
+         * @brief true once the initial flushing segment seek has been performed.
+         * All subsequent seeks are non-flushing to avoid any gap in the stream.
          */
-        guint m_prevAccumulatedBase;
+        bool m_segmentSeekActive;
+        
+        /**
+         * @brief current offset added to all buffer timestamps to continue the
+         * timeline of the first segment, in nanoseconds.
+         */
+        GstClockTimeDiff m_streamTimeOffset;
+        
+        /**
+         * @brief end time of the latest (offset) buffer received, in nanoseconds.
+         */
+        GstClockTime m_streamLastBufferEnd;
+        
+        /**
+         * @brief duration of the last buffer with a valid duration, used for
+         * buffers received without one, in nanoseconds.
+         */
+        GstClockTime m_streamLastBufferDuration;
+
+        /**
+         * @brief decoder sink pad the buffer restart probe is added to, and the
+         * pad the segment seeks are sent upstream from.
+         */
+        GstPad* m_pStreamRestartPad;
         
         /**
          * @brief
@@ -433,6 +736,111 @@ namespace DSL
     private:
 
 
+    };
+
+    //*********************************************************************************
+
+    /**
+     * @class PlaylistSourceBintr
+     * @brief Implements a file Source that plays a list of files, one after the other,
+     * as a single continuous stream. Only the file source and parser are restarted 
+     * for each file. The decoder persists for the life of the stream, and requires
+     * all files to use the same codec.
+     */
+    class PlaylistSourceBintr : public DecodeSourceBintr
+    {
+    public: 
+    
+        PlaylistSourceBintr(const char* name, const char** files, bool repeatEnabled,
+            uint cudadecMemType, uint intraDecode, uint dropFrameInterval);
+
+        ~PlaylistSourceBintr();
+
+        /**
+         * @brief Links all Child Elementrs owned by this Source Bintr
+         * @return True success, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elementrs owned by this Source Bintr
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief Sets the first file of the playlist - a playlist of one file.
+         * @param[in] uri relative or absolute path to the file to play
+         * @return false if the Source is currently in use or the file can't be found.
+         */
+        bool SetUri(const char* uri);
+        
+        /**
+         * @brief Gets the index of the file currently playing
+         * @return index into the playlist, starting at 0
+         */
+        uint GetIndex();
+        
+        /**
+         * @brief Gets the number of files in the playlist
+         * @return size of the playlist
+         */
+        uint GetSize();
+
+        void HandleParseElementOnPadAdded(GstElement* pBin, GstPad* pPad);
+
+        void HandleDecodeElementOnPadAdded(GstElement* pBin, GstPad* pPad);
+        
+        /**
+         * @brief Handles the next file timer, scheduled on end-of-stream of the current
+         * file, by restarting the file source and parser with the next file.
+         * @return false always to stop the one-shot timer.
+         */
+        gboolean HandlePlaylistNext();
+        
+    protected:
+
+        /**
+         * @brief Schedules the next file in the playlist on end-of-stream, dropping
+         * the event, unless the end of a non-repeating playlist has been reached.
+         * @return true if the end-of-stream event is to be dropped.
+         */
+        bool HandleStreamEos();
+
+        /**
+         * @brief Playlists are restarted on end-of-stream, not with segment seeks.
+         */
+        void HandleFirstSegment(){};
+
+        /**
+         * @brief The buffer restart probe is required for all playlists
+         */
+        bool IsStreamRestartEnabled()
+        {
+            return true;
+        };
+
+    private:
+    
+        /**
+         * @brief list of absolute file paths to play in order
+         */
+        std::vector<std::string> m_files;
+        
+        /**
+         * @brief index of the file currently playing
+         */
+        uint m_index;
+
+        /**
+         * @brief Parse bin - restarted for each file in the playlist
+         */
+        DSL_ELEMENT_PTR m_pParseBin;
+
+        /**
+         * @brief Decode bin - persists for the life of the stream.
+         */
+        DSL_ELEMENT_PTR m_pDecodeBin;
+
     };
 
     /**
@@ -485,13 +893,180 @@ namespace DSL
 
         void HandleDecodeElementOnPadAdded(GstElement* pBin, GstPad* pPad);
 
+        /**
+         * @brief Gets the current buffer timeout for the stream watchdog
+         * @return timeout in seconds, 0 = watchdog disabled
+         */
+        uint GetBufferTimeout();
+        
+        /**
+         * @brief Sets the buffer timeout for the stream watchdog
+         * @param[in] timeout time to wait for a buffer in seconds, 0 to disable
+         */
+        void SetBufferTimeout(uint timeout);
+        
+        /**
+         * @brief Gets the current reconnection params for the RtspSourceBintr
+         * @param[out] backoffMin initial wait between reconnection attempts in seconds
+         * @param[out] backoffMax maximum wait between reconnection attempts in seconds
+         */
+        void GetReconnectionParams(uint* backoffMin, uint* backoffMax);
+        
+        /**
+         * @brief Sets the reconnection params for the RtspSourceBintr
+         * @param[in] backoffMin initial wait between reconnection attempts in seconds
+         * @param[in] backoffMax maximum wait between reconnection attempts in seconds
+         * @return false if backoffMin is 0 or greater than backoffMax, true otherwise
+         */
+        bool SetReconnectionParams(uint backoffMin, uint backoffMax);
+        
+        /**
+         * @brief Gets the current connection data for the RtspSourceBintr
+         * @param[out] state one of the DSL_RTSP_CONNECTION_STATE constants
+         * @param[out] reconnectCount number of reconnection attempts since last clear
+         * @param[out] lastError copy of the last error message reported by the rtspsrc
+         */
+        void GetConnectionData(uint* state, uint* reconnectCount, std::string& lastError);
+        
+        /**
+         * @brief Clears the reconnect count and last error for the RtspSourceBintr
+         */
+        void ClearConnectionStats();
+        
+        /**
+         * @brief Sets the last error message for the RtspSourceBintr, called by the 
+         * parent Pipeline on receipt of an error message from one of this Source's children
+         * @param[in] error error message to set
+         */
+        void SetLastError(const char* error);
+        
+        /**
+         * @brief adds a callback to be notified on connection state change
+         * @param[in] listener pointer to the client's function to call on state change
+         * @param[in] userdata opaque pointer to client data passed into the listener function.
+         * @return true on successful add, false otherwise
+         */
+        bool AddStateChangeListener(dsl_rtsp_connection_state_change_listener_cb listener, 
+            void* userdata);
+
+        /**
+         * @brief removes a previously added callback
+         * @param[in] listener pointer to the client's function to remove
+         * @return true on successful remove, false otherwise
+         */
+        bool RemoveStateChangeListener(dsl_rtsp_connection_state_change_listener_cb listener);
+        
+        /**
+         * @brief Handles a buffer on the Source Queue's sink pad, timestamping the last
+         * buffer received and setting the connection state to CONNECTED
+         */
+        void HandleStreamBuffer();
+        
+        /**
+         * @brief Handles the stream watchdog timer. Initiates a reconnect if no buffer
+         * has been received within the buffer timeout or a reconnect attempt has failed
+         * @return true to continue the timer, false to stop.
+         */
+        int HandleStreamWatchdog();
+
     private:
 
+        /**
+         * @brief Restarts the rtspsrc, depay, parser and decodebin Elementrs while
+         * the parent Pipeline continues to play.
+         */
+        void Reconnect();
+        
+        /**
+         * @brief Sets the current connection state, notifying all client listeners
+         * on change. Must be called with m_connectionMutex unlocked.
+         * @param[in] state new DSL_RTSP_CONNECTION_STATE value
+         */
+        void SetConnectionState(uint state);
+
         /**
          @brief 0x4 for TCP and 0x7 for All (UDP/UDP-MCAST/TCP)
          */
         uint m_rtpProtocols;
         
+        /**
+         * @brief time to wait for a buffer before reconnecting in seconds, 0 = disabled
+         */
+        uint m_bufferTimeout;
+        
+        /**
+         * @brief initial wait between reconnection attempts in seconds
+         */
+        uint m_reconnectBackoffMin;
+        
+        /**
+         * @brief maximum wait between reconnection attempts in seconds
+         */
+        uint m_reconnectBackoffMax;
+        
+        /**
+         * @brief current wait between reconnection attempts in seconds, doubled
+         * on each failed attempt and reset on receipt of the first buffer.
+         */
+        uint m_reconnectBackoff;
+        
+        /**
+         * @brief monotonic time of the last buffer received in microseconds
+         */
+        gint64 m_lastBufferTime;
+        
+        /**
+         * @brief monotonic time of the next reconnection attempt in microseconds
+         */
+        gint64 m_nextReconnectTime;
+        
+        /**
+         * @brief current DSL_RTSP_CONNECTION_STATE value
+         */
+        uint m_connectionState;
+        
+        /**
+         * @brief number of reconnection attempts since last clear
+         */
+        uint m_reconnectCount;
+        
+        /**
+         * @brief published DSL_RTSP_CONNECTION_STATE value
+         */
+        DSL_METRIC_GAUGE_PTR m_pConnectionStateMetric;
+        
+        /**
+         * @brief published count of all reconnection attempts, not cleared
+         */
+        DSL_METRIC_COUNTER_PTR m_pReconnectsMetric;
+        
+        /**
+         * @brief last error message reported by the rtspsrc
+         */
+        std::string m_lastError;
+        
+        /**
+         * @brief gnome timer source for the stream watchdog, NULL when not running
+         */
+        GSource* m_pWatchdogTimerSource;
+        
+        /**
+         * @brief probe id for the buffer probe on the Source Queue's sink pad
+         */
+        guint m_watchdogProbeId;
+        
+        /**
+         * @brief mutex to protect the connection data shared between the 
+         * streaming thread and the watchdog timer.
+         */
+        GMutex m_connectionMutex;
+        
+        /**
+         * @brief map of all currently registered connection state-change-listeners
+         * callback functions mapped with the user provided data
+         */
+        std::map<dsl_rtsp_connection_state_change_listener_cb, void*>m_stateChangeListeners;
+        
         /**
          * @brief optional child TapBintr, tapped in pre-decode
          */ 
@@ -543,6 +1118,29 @@ namespace DSL
      */
     static void UriSourceElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource);
 
+    /**
+     * @brief Called by the Playlist Source's parsebin on new pad added
+     * @param[in] pBin parsebin that added the pad
+     * @param[in] pPad new parsed stream pad
+     * @param[in] pSource (callback user data) pointer to the unique source opject
+     */
+    static void PlaylistParseElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource);
+
+    /**
+     * @brief Called by the Playlist Source's decodebin on new pad added
+     * @param[in] pBin decodebin that added the pad
+     * @param[in] pPad new decoded stream pad
+     * @param[in] pSource (callback user data) pointer to the unique source opject
+     */
+    static void PlaylistDecodeElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource);
+
+    /**
+     * @brief Timer callback function to play the next file in a Playlist Source
+     * @param[in] pSource (callback user data) pointer to the unique source opject
+     * @return false always to stop the one-shot timer.
+     */
+    static gboolean PlaylistNextCB(gpointer pSource);
+
     /**
      * @brief 
      * @param pBin
@@ -560,6 +1158,23 @@ namespace DSL
      */
     static void RtspDecodeElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource);
 
+    /**
+     * @brief Probe function to timestamp each buffer received by an RTSP Source
+     * @param[in] pPad Source Queue sink pad
+     * @param[in] pInfo probe info with the buffer
+     * @param[in] pSource (callback user data) pointer to the unique source opject
+     * @return GST_PAD_PROBE_OK always
+     */
+    static GstPadProbeReturn RtspStreamBufferProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource);
+
+    /**
+     * @brief Timer callback function to check the stream health of an RTSP Source
+     * @param[in] pSource (callback user data) pointer to the unique source opject
+     * @return true to continue the timer, false to stop.
+     */
+    static int RtspStreamWatchdogHandler(gpointer pSource);
+
     /**
      * @brief 
      * @param[in] pChildProxy
@@ -579,22 +1194,44 @@ namespace DSL
     static void OnSourceSetupCB(GstElement* pObject, GstElement* arg0, gpointer pSource);
 
     /**
-     * @brief Probe function to drop certain events to support
-     * custom logic of looping of each decode source (file) stream.
-     * @param pPad
-     * @param pInfo
-     * @param pSource
-     * @return 
+     * @brief Probe function to drop certain events and offset buffer timestamps 
+     * to support gapless looping and playlists of each decode source (file) stream.
+     * @param[in] pPad decoder sink pad
+     * @param[in] pInfo probe info with the buffer or event
+     * @param[in] pSource (callback user data) pointer to the unique source opject
+     * @return GST_PAD_PROBE_DROP or GST_PAD_PROBE_OK
      */
     static GstPadProbeReturn StreamBufferRestartProbCB(GstPad* pPad, 
         GstPadProbeInfo* pInfo, gpointer pSource);
 
     /**
-     * @brief 
-     * @param pSource
-     * @return 
+     * @brief Timer callback function to perform a segment seek on a decode source
+     * @param[in] pSource (callback user data) pointer to the unique source opject
+     * @return false always to stop the one-shot timer.
      */
     static gboolean StreamBufferSeekCB(gpointer pSource);
 
+    /**
+     * @brief Callback function for the appsrc need-data signal
+     * @param[in] pAppSrc appsrc element that needs data
+     * @param[in] length number of bytes needed, 0 if unknown
+     * @param[in] pSource (callback user data) pointer to the unique source opject
+     */
+    static void AppSourceNeedDataCB(GstAppSrc* pAppSrc, guint length, gpointer pSource);
+
+    /**
+     * @brief Callback function for the appsrc enough-data signal
+     * @param[in] pAppSrc appsrc element with a full queue
+     * @param[in] pSource (callback user data) pointer to the unique source opject
+     */
+    static void AppSourceEnoughDataCB(GstAppSrc* pAppSrc, gpointer pSource);
+
+    /**
+     * @brief Destroy notify function for wrapped client memory. Calls the client's
+     * release function once the Pipeline is done with the buffer.
+     * @param[in] pReleaseData pointer to the AppSourceBufferRelease data to free
+     */
+    static void AppSourceBufferReleaseCB(gpointer pReleaseData);
+
 } // DSL
 #endif // _DSL_SOURCE_BINTR_H
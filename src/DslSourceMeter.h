@@ -169,5 +169,112 @@ namespace DSL
          */
         uint m_sessionFrameCount;
     };
+
+    #define DSL_SOURCE_ARRIVAL_METER_PTR std::shared_ptr<SourceArrivalMeter>
+    #define DSL_SOURCE_ARRIVAL_METER_NEW(sourceId) \
+        std::shared_ptr<SourceArrivalMeter>(new SourceArrivalMeter(sourceId))
+
+    /**
+     * @class SourceArrivalMeter
+     * @brief Implements a Meter to measure the buffer arrival interval and jitter
+     * for a single Source. Both values are smoothed with a 1/16 gain as per RFC 3550.
+     */
+    class SourceArrivalMeter
+    {
+    public:
+    
+        /**
+         * @brief ctor for the Source Arrival Meter
+         * @param sourceId unique Id of the Source being metered.
+         */
+        SourceArrivalMeter(uint sourceId)
+            : m_sourceId(sourceId)
+            , m_lastArrival(0)
+            , m_avgInterval(0)
+            , m_avgJitter(0)
+            , m_intervalCount(0)
+            {};
+            
+        /**
+         * @brief Updates the arrival interval and jitter averages. Must be called
+         * on each buffer received from the Source.
+         * @param now monotonic time of arrival in microseconds
+         */
+        void Timestamp(gint64 now)
+        {
+            if (m_lastArrival)
+            {
+                double interval = (double)(now - m_lastArrival);
+                
+                // first interval seeds the average
+                if (!m_intervalCount++)
+                {
+                    m_avgInterval = interval;
+                }
+                else
+                {
+                    double deviation = interval - m_avgInterval;
+                    m_avgInterval += deviation/16;
+                    m_avgJitter += (fabs(deviation) - m_avgJitter)/16;
+                }
+            }
+            m_lastArrival = now;
+        }
+        
+        /**
+         * @brief Determines if the Source is live, i.e. has produced at least one 
+         * interval and has not been silent for longer than the stale period
+         * @param now current monotonic time in microseconds
+         * @param stalePeriod maximum time without a buffer before considered stale
+         * @return true if the Source is considered live, false otherwise
+         */
+        bool IsLive(gint64 now, gint64 stalePeriod)
+        {
+            return (m_intervalCount and (now - m_lastArrival) < stalePeriod);
+        }
+        
+        /**
+         * @brief Gets the smoothed buffer arrival interval in microseconds
+         */
+        double GetAvgInterval()
+        {
+            return m_avgInterval;
+        }
+        
+        /**
+         * @brief Gets the smoothed arrival jitter in microseconds
+         */
+        double GetAvgJitter()
+        {
+            return m_avgJitter;
+        }
+        
+    private:
+    
+        /**
+         * @brief unique source Id for the soure being metered
+         */
+        int m_sourceId;
+
+        /**
+         * @brief monotonic time in microseconds of the last buffer arrival
+         */
+        gint64 m_lastArrival;
+
+        /**
+         * @brief smoothed interval between buffer arrivals in microseconds
+         */
+        double m_avgInterval;
+        
+        /**
+         * @brief smoothed mean deviation of the arrival interval in microseconds
+         */
+        double m_avgJitter;
+        
+        /**
+         * @brief number of arrival intervals measured
+         */
+        uint m_intervalCount;
+    };
 }
 #endif // _DSL_SOURCE_METER_H
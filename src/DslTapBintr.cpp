@@ -363,4 +363,852 @@ namespace DSL
         return m_pContext->resetDone;
     }
 
+    //-------------------------------------------------------------------------
+    
+    EncodedPacketRing::EncodedPacketRing(uint64_t maxBytes)
+        : m_maxBytes(maxBytes)
+        , m_bytes(0)
+    {
+        LOG_FUNC();
+    }
+    
+    EncodedPacketRing::~EncodedPacketRing()
+    {
+        LOG_FUNC();
+        
+        Clear();
+    }
+    
+    GstClockTime EncodedPacketRing::GetBufferTime(GstBuffer* pBuffer)
+    {
+        return (GST_BUFFER_DTS_IS_VALID(pBuffer)) 
+            ? GST_BUFFER_DTS(pBuffer) : GST_BUFFER_PTS(pBuffer);
+    }
+    
+    bool EncodedPacketRing::Push(GstBuffer* pBuffer)
+    {
+        // the ring must always start on a keyframe
+        if (m_packets.empty() and 
+            GST_BUFFER_FLAG_IS_SET(pBuffer, GST_BUFFER_FLAG_DELTA_UNIT))
+        {
+            return false;
+        }
+        m_packets.push_back(gst_buffer_ref(pBuffer));
+        m_bytes += gst_buffer_get_size(pBuffer);
+        
+        Evict();
+        return true;
+    }
+    
+    std::vector<GstBuffer*> EncodedPacketRing::Snapshot(GstClockTime preEvent)
+    {
+        std::vector<GstBuffer*> packets;
+        if (m_packets.empty())
+        {
+            return packets;
+        }
+        GstClockTime newest = GetBufferTime(m_packets.back());
+        GstClockTime start = (GST_CLOCK_TIME_IS_VALID(newest) and newest > preEvent)
+            ? newest - preEvent : 0;
+        
+        // latest keyframe at or before the start of the window, the front
+        // of the ring is always a keyframe.
+        size_t first(0);
+        for (size_t i = 0; i < m_packets.size(); i++)
+        {
+            GstClockTime time = GetBufferTime(m_packets[i]);
+            if (GST_CLOCK_TIME_IS_VALID(time) and time > start)
+            {
+                break;
+            }
+            if (!GST_BUFFER_FLAG_IS_SET(m_packets[i], GST_BUFFER_FLAG_DELTA_UNIT))
+            {
+                first = i;
+            }
+        }
+        for (size_t i = first; i < m_packets.size(); i++)
+        {
+            packets.push_back(gst_buffer_ref(m_packets[i]));
+        }
+        return packets;
+    }
+    
+    void EncodedPacketRing::Clear()
+    {
+        while (!m_packets.empty())
+        {
+            PopFront();
+        }
+    }
+    
+    uint64_t EncodedPacketRing::GetMaxBytes()
+    {
+        return m_maxBytes;
+    }
+    
+    void EncodedPacketRing::SetMaxBytes(uint64_t maxBytes)
+    {
+        m_maxBytes = maxBytes;
+        Evict();
+    }
+    
+    uint64_t EncodedPacketRing::GetBytes()
+    {
+        return m_bytes;
+    }
+    
+    uint EncodedPacketRing::GetCount()
+    {
+        return m_packets.size();
+    }
+    
+    GstClockTime EncodedPacketRing::GetDuration()
+    {
+        if (m_packets.empty())
+        {
+            return 0;
+        }
+        GstClockTime oldest = GetBufferTime(m_packets.front());
+        GstClockTime newest = GetBufferTime(m_packets.back());
+        
+        return (GST_CLOCK_TIME_IS_VALID(oldest) and 
+            GST_CLOCK_TIME_IS_VALID(newest) and newest > oldest) ? newest - oldest : 0;
+    }
+    
+    void EncodedPacketRing::Evict()
+    {
+        while (m_bytes > m_maxBytes and !m_packets.empty())
+        {
+            // evict the oldest GOP whole, up to the next keyframe
+            PopFront();
+            while (!m_packets.empty() and 
+                GST_BUFFER_FLAG_IS_SET(m_packets.front(), GST_BUFFER_FLAG_DELTA_UNIT))
+            {
+                PopFront();
+            }
+        }
+    }
+    
+    void EncodedPacketRing::PopFront()
+    {
+        m_bytes -= gst_buffer_get_size(m_packets.front());
+        gst_buffer_unref(m_packets.front());
+        m_packets.pop_front();
+    }
+    
+    //-------------------------------------------------------------------------
+    
+    RingRecordSession::RingRecordSession(uint id, const char* filePath, uint container,
+        dsl_ring_record_complete_listener_cb clientListener, void* clientData)
+        : m_id(id)
+        , m_filePath(filePath)
+        , m_container(container)
+        , m_clientListener(clientListener)
+        , m_clientData(clientData)
+        , m_baseTime(GST_CLOCK_TIME_NONE)
+        , m_ended(false)
+        , m_pPipeline(NULL)
+        , m_pAppSrc(NULL)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_sessionMutex);
+        g_cond_init(&m_sessionCond);
+    }
+    
+    RingRecordSession::~RingRecordSession()
+    {
+        LOG_FUNC();
+        
+        if (m_pPipeline)
+        {
+            gst_element_set_state(m_pPipeline, GST_STATE_NULL);
+            gst_object_unref(m_pPipeline);
+        }
+        g_cond_clear(&m_sessionCond);
+        g_mutex_clear(&m_sessionMutex);
+    }
+    
+    bool RingRecordSession::Start(GstCaps* pCaps)
+    {
+        LOG_FUNC();
+        
+        const gchar* mediaType = gst_structure_get_name(gst_caps_get_structure(pCaps, 0));
+        const gchar* parserFactory(NULL);
+        
+        if (g_str_equal(mediaType, "video/x-h264"))
+        {
+            parserFactory = "h264parse";
+        }
+        else if (g_str_equal(mediaType, "video/x-h265"))
+        {
+            parserFactory = "h265parse";
+        }
+        else
+        {
+            LOG_ERROR("Unsupported media type '" << mediaType 
+                << "' for recording session '" << m_filePath << "'");
+            return false;
+        }
+        
+        std::string pipelineName = "ring-record-session-" + std::to_string(m_id);
+        m_pPipeline = gst_pipeline_new(pipelineName.c_str());
+        m_pAppSrc = gst_element_factory_make("appsrc", NULL);
+        GstElement* pParser = gst_element_factory_make(parserFactory, NULL);
+        GstElement* pMuxer = gst_element_factory_make(
+            (m_container == DSL_CONTAINER_MP4) ? "mp4mux" : "matroskamux", NULL);
+        GstElement* pFileSink = gst_element_factory_make("filesink", NULL);
+        
+        if (!m_pPipeline or !m_pAppSrc or !pParser or !pMuxer or !pFileSink)
+        {
+            LOG_ERROR("Failed to create elements for recording session '" 
+                << m_filePath << "'");
+            for (GstElement* pElement: {m_pAppSrc, pParser, pMuxer, pFileSink})
+            {
+                if (pElement)
+                {
+                    gst_object_unref(pElement);
+                }
+            }
+            m_pAppSrc = NULL;
+            return false;
+        }
+        g_object_set(m_pAppSrc, "caps", pCaps, "format", GST_FORMAT_TIME, 
+            "is-live", FALSE, "max-bytes", (guint64)0, NULL);
+        g_object_set(pFileSink, "location", m_filePath.c_str(), 
+            "sync", FALSE, "async", FALSE, NULL);
+        
+        gst_bin_add_many(GST_BIN(m_pPipeline), m_pAppSrc, pParser, pMuxer, pFileSink, NULL);
+        if (!gst_element_link_many(m_pAppSrc, pParser, pMuxer, pFileSink, NULL))
+        {
+            LOG_ERROR("Failed to link elements for recording session '" 
+                << m_filePath << "'");
+            return false;
+        }
+        if (gst_element_set_state(m_pPipeline, GST_STATE_PLAYING) == GST_STATE_CHANGE_FAILURE)
+        {
+            LOG_ERROR("Failed to play recording session '" << m_filePath << "'");
+            return false;
+        }
+        
+        // The thread owns the session from here, deleting it once ended.
+        g_thread_unref(g_thread_new(pipelineName.c_str(), RingRecordSessionThread, this));
+        
+        LOG_INFO("Recording session '" << m_filePath << "' started");
+        return true;
+    }
+    
+    bool RingRecordSession::Push(GstBuffer* pBuffer)
+    {
+        if (!GST_CLOCK_TIME_IS_VALID(m_baseTime))
+        {
+            m_baseTime = EncodedPacketRing::GetBufferTime(pBuffer);
+        }
+        
+        // shallow copy to rebase the timestamps, the memory is shared
+        GstBuffer* pCopy = gst_buffer_copy(pBuffer);
+        if (GST_CLOCK_TIME_IS_VALID(m_baseTime))
+        {
+            if (GST_BUFFER_PTS_IS_VALID(pCopy))
+            {
+                GST_BUFFER_PTS(pCopy) = (GST_BUFFER_PTS(pCopy) > m_baseTime) 
+                    ? GST_BUFFER_PTS(pCopy) - m_baseTime : 0;
+            }
+            if (GST_BUFFER_DTS_IS_VALID(pCopy))
+            {
+                GST_BUFFER_DTS(pCopy) = (GST_BUFFER_DTS(pCopy) > m_baseTime) 
+                    ? GST_BUFFER_DTS(pCopy) - m_baseTime : 0;
+            }
+        }
+        return (gst_app_src_push_buffer(GST_APP_SRC(m_pAppSrc), pCopy) == GST_FLOW_OK);
+    }
+    
+    void RingRecordSession::End()
+    {
+        LOG_FUNC();
+        
+        gst_app_src_end_of_stream(GST_APP_SRC(m_pAppSrc));
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sessionMutex);
+        m_ended = true;
+        g_cond_signal(&m_sessionCond);
+    }
+    
+    void RingRecordSession::HandleCompletion()
+    {
+        LOG_FUNC();
+        
+        GstBus* pBus = gst_element_get_bus(m_pPipeline);
+        GstMessage* pMessage = gst_bus_timed_pop_filtered(pBus, GST_CLOCK_TIME_NONE,
+            (GstMessageType)(GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+        gst_object_unref(pBus);
+        
+        bool success = (GST_MESSAGE_TYPE(pMessage) == GST_MESSAGE_EOS);
+        if (!success)
+        {
+            GError* pError(NULL);
+            gchar* pDebugInfo(NULL);
+            gst_message_parse_error(pMessage, &pError, &pDebugInfo);
+            LOG_ERROR("Recording session '" << m_filePath << "' failed with error: " 
+                << pError->message);
+            g_clear_error(&pError);
+            g_free(pDebugInfo);
+        }
+        gst_message_unref(pMessage);
+        
+        // finalize the file before notifying the client
+        gst_element_set_state(m_pPipeline, GST_STATE_NULL);
+        
+        LOG_INFO("Recording session '" << m_filePath << "' completed");
+        
+        if (m_clientListener)
+        {
+            std::string cstrFilePath(m_filePath);
+            std::wstring wstrFilePath(cstrFilePath.begin(), cstrFilePath.end());
+            try
+            {
+                m_clientListener(m_id, wstrFilePath.c_str(), success, m_clientData);
+            }
+            catch(...)
+            {
+                LOG_ERROR("Recording session '" << m_filePath 
+                    << "' threw exception calling client listener");
+            }
+        }
+        
+        // a failed session may still be referenced by its Tap until ended
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sessionMutex);
+        while (!m_ended)
+        {
+            g_cond_wait(&m_sessionCond, &m_sessionMutex);
+        }
+    }
+    
+    //-------------------------------------------------------------------------
+    
+    RingRecordTapBintr::RingRecordTapBintr(const char* name, const char* outdir, 
+        uint container, uint64_t maxBytes, 
+        dsl_ring_record_complete_listener_cb clientListener)
+        : TapBintr(name)
+        , m_outdir(outdir)
+        , m_container(container)
+        , m_clientListener(clientListener)
+        , m_ring(maxBytes)
+        , m_pCaps(NULL)
+        , m_pSession(NULL)
+        , m_sessionEndTime(GST_CLOCK_TIME_NONE)
+        , m_sessionCount(0)
+    {
+        LOG_FUNC();
+        
+        m_pAppSink = DSL_ELEMENT_NEW("appsink", "tap-bin-ring");
+        m_pAppSink->SetAttribute("enable-last-sample", false);
+        m_pAppSink->SetAttribute("emit-signals", false);
+        m_pAppSink->SetAttribute("sync", false);
+        m_pAppSink->SetAttribute("async", false);
+        
+        GstAppSinkCallbacks callbacks = {NULL, NULL, RingRecordTapNewSampleCB};
+        gst_app_sink_set_callbacks(GST_APP_SINK(m_pAppSink->GetGstElement()),
+            &callbacks, this, NULL);
+            
+        g_mutex_init(&m_ringMutex);
+
+        AddChild(m_pAppSink);
+    }
+    
+    RingRecordTapBintr::~RingRecordTapBintr()
+    {
+        LOG_FUNC();
+    
+        if (IsLinked())
+        {    
+            UnlinkAll();
+        }
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringMutex);
+            EndSession();
+            m_ring.Clear();
+            if (m_pCaps)
+            {
+                gst_caps_unref(m_pCaps);
+            }
+        }
+        g_mutex_clear(&m_ringMutex);
+    }
+
+    bool RingRecordTapBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("RingRecordTapBintr '" << m_name << "' is already linked");
+            return false;
+        }
+        if (!m_pQueue->LinkToSink(m_pAppSink))
+        {
+            return false;
+        }
+        m_isLinked = true;
+        return true;
+    }
+    
+    void RingRecordTapBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("RingRecordTapBintr '" << m_name << "' is not linked");
+            return;
+        }
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringMutex);
+            EndSession();
+            m_ring.Clear();
+        }
+        m_pQueue->UnlinkFromSink();
+        m_isLinked = false;
+    }
+
+    uint64_t RingRecordTapBintr::GetMaxBytes()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringMutex);
+        
+        return m_ring.GetMaxBytes();
+    }
+    
+    void RingRecordTapBintr::SetMaxBytes(uint64_t maxBytes)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringMutex);
+        
+        m_ring.SetMaxBytes(maxBytes);
+    }
+    
+    void RingRecordTapBintr::GetCacheLevel(uint64_t* bytes, uint* duration)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringMutex);
+        
+        *bytes = m_ring.GetBytes();
+        *duration = m_ring.GetDuration() / GST_MSECOND;
+    }
+    
+    bool RingRecordTapBintr::StartSession(uint* session, 
+        uint preEvent, uint postEvent, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringMutex);
+        
+        if (!IsLinked())
+        {
+            LOG_ERROR("Unable to Start Session for RingRecordTapBintr '" << GetName() 
+                << "' as it is not currently Linked");
+            return false;
+        }
+        if (m_pSession)
+        {
+            LOG_ERROR("Unable to Start Session for RingRecordTapBintr '" << GetName() 
+                << "' as a session is currently in progress");
+            return false;
+        }
+        if (!m_pCaps or !m_ring.GetCount())
+        {
+            LOG_ERROR("Unable to Start Session for RingRecordTapBintr '" << GetName() 
+                << "' as no keyframe has been received");
+            return false;
+        }
+        
+        char dateTime[32] = {0};
+        time_t now = time(NULL);
+        strftime(dateTime, sizeof(dateTime), "%Y%m%d-%H%M%S", localtime(&now));
+        
+        std::string filePath = m_outdir + "/" + GetName() + "_" + 
+            std::to_string(m_sessionCount) + "_" + dateTime +
+            ((m_container == DSL_CONTAINER_MP4) ? ".mp4" : ".mkv");
+            
+        RingRecordSession* pSession = new RingRecordSession(m_sessionCount,
+            filePath.c_str(), m_container, m_clientListener, clientData);
+        if (!pSession->Start(m_pCaps))
+        {
+            delete pSession;
+            return false;
+        }
+        *session = m_sessionCount++;
+        m_pSession = pSession;
+        
+        // flush the pre-event window, the post-event window is timed 
+        // from the newest packet in the ring
+        std::vector<GstBuffer*> packets = 
+            m_ring.Snapshot((GstClockTime)preEvent * GST_SECOND);
+        GstClockTime newest = EncodedPacketRing::GetBufferTime(packets.back());
+        
+        for (auto const& ivec: packets)
+        {
+            if (m_pSession)
+            {
+                if (!m_pSession->Push(ivec))
+                {
+                    EndSession();
+                }
+            }
+            gst_buffer_unref(ivec);
+        }
+        m_sessionEndTime = (GST_CLOCK_TIME_IS_VALID(newest))
+            ? newest + (GstClockTime)postEvent * GST_SECOND : GST_CLOCK_TIME_NONE;
+            
+        if (m_pSession and !postEvent)
+        {
+            EndSession();
+        }
+        return true;
+    }
+    
+    bool RingRecordTapBintr::StopSession()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringMutex);
+        
+        if (!m_pSession)
+        {
+            LOG_ERROR("Unable to Stop Session for RingRecordTapBintr '" << GetName() 
+                << "' as no session is in progress");
+            return false;
+        }
+        EndSession();
+        return true;
+    }
+    
+    bool RingRecordTapBintr::IsOn()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringMutex);
+        
+        return (m_pSession != NULL);
+    }
+    
+    GstFlowReturn RingRecordTapBintr::HandleNewSample()
+    {
+        GstSample* pSample = gst_app_sink_pull_sample(
+            GST_APP_SINK(m_pAppSink->GetGstElement()));
+        if (!pSample)
+        {
+            return GST_FLOW_OK;
+        }
+        GstBuffer* pBuffer = gst_sample_get_buffer(pSample);
+        GstCaps* pCaps = gst_sample_get_caps(pSample);
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringMutex);
+        
+        if (pCaps and (!m_pCaps or !gst_caps_is_equal(pCaps, m_pCaps)))
+        {
+            gst_caps_replace(&m_pCaps, pCaps);
+        }
+        m_ring.Push(pBuffer);
+        
+        if (m_pSession)
+        {
+            GstClockTime time = EncodedPacketRing::GetBufferTime(pBuffer);
+            if (!m_pSession->Push(pBuffer) or (GST_CLOCK_TIME_IS_VALID(time) and
+                GST_CLOCK_TIME_IS_VALID(m_sessionEndTime) and time >= m_sessionEndTime))
+            {
+                EndSession();
+            }
+        }
+        gst_sample_unref(pSample);
+        
+        return GST_FLOW_OK;
+    }
+    
+    void RingRecordTapBintr::EndSession()
+    {
+        if (m_pSession)
+        {
+            m_pSession->End();
+            m_pSession = NULL;
+            m_sessionEndTime = GST_CLOCK_TIME_NONE;
+        }
+    }
+    
+    //-------------------------------------------------------------------------
+    
+    FileTapBintr::FileTapBintr(const char* name, const char* filepath, 
+        uint codec, uint container)
+        : TapBintr(name)
+        , m_codec(codec)
+        , m_container(container)
+        , m_gotKeyFrame(false)
+        , m_keyFrameProbeId(0)
+    {
+        LOG_FUNC();
+        
+        switch (codec)
+        {
+        case DSL_CODEC_H264 :
+            m_pParser = DSL_ELEMENT_NEW("h264parse", "file-tap-parser");
+            break;
+        case DSL_CODEC_H265 :
+            m_pParser = DSL_ELEMENT_NEW("h265parse", "file-tap-parser");
+            break;
+        case DSL_CODEC_MPEG4 :
+            m_pParser = DSL_ELEMENT_NEW("mpeg4videoparse", "file-tap-parser");
+            break;
+        default:
+            LOG_ERROR("Invalid codec = '" << codec << "' for new FileTapBintr '" << name << "'");
+            throw;
+        }
+        switch (container)
+        {
+        case DSL_CONTAINER_MP4 :
+            m_pContainer = DSL_ELEMENT_NEW(NVDS_ELEM_MUX_MP4, "file-tap-container");        
+            break;
+        case DSL_CONTAINER_MKV :
+            m_pContainer = DSL_ELEMENT_NEW(NVDS_ELEM_MKV, "file-tap-container");        
+            break;
+        default:
+            LOG_ERROR("Invalid container = '" << container << "' for new FileTapBintr '" << name << "'");
+            throw;
+        }
+        m_pFileSink = DSL_ELEMENT_NEW(NVDS_ELEM_SINK_FILE, "file-tap-sink");
+        m_pFileSink->SetAttribute("location", filepath);
+        m_pFileSink->SetAttribute("sync", false);
+        m_pFileSink->SetAttribute("async", false);
+
+        AddChild(m_pParser);
+        AddChild(m_pContainer);
+        AddChild(m_pFileSink);
+    }
+    
+    FileTapBintr::~FileTapBintr()
+    {
+        LOG_FUNC();
+    
+        if (IsLinked())
+        {    
+            UnlinkAll();
+        }
+    }
+
+    bool FileTapBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("FileTapBintr '" << m_name << "' is already linked");
+            return false;
+        }
+        if (!m_pQueue->LinkToSink(m_pParser) or
+            !m_pParser->LinkToSink(m_pContainer) or
+            !m_pContainer->LinkToSink(m_pFileSink))
+        {
+            return false;
+        }
+        m_gotKeyFrame = false;
+        
+        GstPad* pSinkPad = gst_element_get_static_pad(m_pQueue->GetGstElement(), "sink");
+        m_keyFrameProbeId = gst_pad_add_probe(pSinkPad, GST_PAD_PROBE_TYPE_BUFFER,
+            FileTapKeyFrameProbeCB, this, NULL);
+        gst_object_unref(pSinkPad);
+        
+        m_isLinked = true;
+        return true;
+    }
+    
+    void FileTapBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("FileTapBintr '" << m_name << "' is not linked");
+            return;
+        }
+        if (m_keyFrameProbeId)
+        {
+            GstPad* pSinkPad = gst_element_get_static_pad(m_pQueue->GetGstElement(), "sink");
+            gst_pad_remove_probe(pSinkPad, m_keyFrameProbeId);
+            gst_object_unref(pSinkPad);
+            m_keyFrameProbeId = 0;
+        }
+        m_pContainer->UnlinkFromSink();
+        m_pParser->UnlinkFromSink();
+        m_pQueue->UnlinkFromSink();
+        m_isLinked = false;
+    }
+
+    void FileTapBintr::GetVideoFormats(uint* codec, uint* container)
+    {
+        LOG_FUNC();
+        
+        *codec = m_codec;
+        *container = m_container;
+    }
+    
+    GstPadProbeReturn FileTapBintr::HandleBuffer(GstBuffer* pBuffer)
+    {
+        if (m_gotKeyFrame)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        if (GST_BUFFER_FLAG_IS_SET(pBuffer, GST_BUFFER_FLAG_DELTA_UNIT))
+        {
+            return GST_PAD_PROBE_DROP;
+        }
+        LOG_INFO("FileTapBintr '" << GetName() << "' received first keyframe");
+        m_gotKeyFrame = true;
+        return GST_PAD_PROBE_OK;
+    }
+    
+    //-------------------------------------------------------------------------
+    
+    RtspTapBintr::RtspTapBintr(const char* name, const char* host, 
+        uint udpPort, uint rtspPort, uint codec)
+        : TapBintr(name)
+        , m_host(host)
+        , m_udpPort(udpPort)
+        , m_rtspPort(rtspPort)
+        , m_codec(codec)
+        , m_pServer(NULL)
+        , m_pServerSrcId(0)
+        , m_pFactory(NULL)
+    {
+        LOG_FUNC();
+        
+        std::string codecString;
+        switch (codec)
+        {
+        case DSL_CODEC_H264 :
+            m_pParser = DSL_ELEMENT_NEW("h264parse", "rtsp-tap-h264-parser");
+            m_pPayloader = DSL_ELEMENT_NEW("rtph264pay", "rtsp-tap-h264-payloader");
+            codecString.assign("H264");
+            break;
+        case DSL_CODEC_H265 :
+            m_pParser = DSL_ELEMENT_NEW("h265parse", "rtsp-tap-h265-parser");
+            m_pPayloader = DSL_ELEMENT_NEW("rtph265pay", "rtsp-tap-h265-payloader");
+            codecString.assign("H265");
+            break;
+        default:
+            LOG_ERROR("Invalid codec = '" << codec << "' for new RtspTapBintr '" << name << "'");
+            throw;
+        }
+        
+        // resend the parameter sets with every IDR frame for clients joining mid-stream
+        m_pParser->SetAttribute("config-interval", -1);
+
+        m_pUdpSink = DSL_ELEMENT_NEW("udpsink", "rtsp-tap-udp-sink");
+        m_pUdpSink->SetAttribute("host", m_host.c_str());
+        m_pUdpSink->SetAttribute("port", m_udpPort);
+        m_pUdpSink->SetAttribute("sync", false);
+        m_pUdpSink->SetAttribute("async", false);
+        
+        // Setup the GST RTSP Server
+        m_pServer = gst_rtsp_server_new();
+        g_object_set(m_pServer, "service", std::to_string(m_rtspPort).c_str(), NULL);
+
+        std::string udpSrc = "(udpsrc name=pay0 port=" + std::to_string(m_udpPort) + 
+            " caps=\"application/x-rtp, media=video, clock-rate=90000, encoding-name=" +
+            codecString + ", payload=96 \")";
+        
+        m_pFactory = gst_rtsp_media_factory_new();
+        gst_rtsp_media_factory_set_launch(m_pFactory, udpSrc.c_str());
+
+        LOG_INFO("UDP Src for RtspTapBintr '" << m_name << "' = " << udpSrc);
+
+        // Attach the RTSP Media Factory to the unique mount-point-path
+        GstRTSPMountPoints* pMounts = gst_rtsp_server_get_mount_points(m_pServer);
+        std::string uniquePath = "/" + m_name;
+        gst_rtsp_mount_points_add_factory(pMounts, uniquePath.c_str(), m_pFactory);
+        g_object_unref(pMounts);
+
+        AddChild(m_pParser);
+        AddChild(m_pPayloader);
+        AddChild(m_pUdpSink);
+    }
+    
+    RtspTapBintr::~RtspTapBintr()
+    {
+        LOG_FUNC();
+    
+        if (IsLinked())
+        {    
+            UnlinkAll();
+        }
+        g_object_unref(m_pServer);
+    }
+
+    bool RtspTapBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("RtspTapBintr '" << m_name << "' is already linked");
+            return false;
+        }
+        if (!m_pQueue->LinkToSink(m_pParser) or
+            !m_pParser->LinkToSink(m_pPayloader) or
+            !m_pPayloader->LinkToSink(m_pUdpSink))
+        {
+            return false;
+        }
+        // Server will accept connections once the main loop has been started
+        m_pServerSrcId = gst_rtsp_server_attach(m_pServer, NULL);
+
+        m_isLinked = true;
+        return true;
+    }
+    
+    void RtspTapBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("RtspTapBintr '" << m_name << "' is not linked");
+            return;
+        }
+        if (m_pServerSrcId)
+        {
+            g_source_remove(m_pServerSrcId);
+            m_pServerSrcId = 0;
+        }
+        m_pPayloader->UnlinkFromSink();
+        m_pParser->UnlinkFromSink();
+        m_pQueue->UnlinkFromSink();
+        m_isLinked = false;
+    }
+
+    void RtspTapBintr::GetServerSettings(uint* udpPort, uint* rtspPort, uint* codec)
+    {
+        LOG_FUNC();
+        
+        *udpPort = m_udpPort;
+        *rtspPort = m_rtspPort;
+        *codec = m_codec;
+    }
+    
+    static GstFlowReturn RingRecordTapNewSampleCB(GstAppSink* pAppSink, gpointer pTap)
+    {
+        return static_cast<RingRecordTapBintr*>(pTap)->HandleNewSample();
+    }
+    
+    static gpointer RingRecordSessionThread(gpointer pSession)
+    {
+        RingRecordSession* pRingRecordSession = static_cast<RingRecordSession*>(pSession);
+        
+        pRingRecordSession->HandleCompletion();
+        delete pRingRecordSession;
+        
+        return NULL;
+    }
+    
+    static GstPadProbeReturn FileTapKeyFrameProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pTap)
+    {
+        return static_cast<FileTapBintr*>(pTap)->HandleBuffer(
+            GST_PAD_PROBE_INFO_BUFFER(pInfo));
+    }
 }
\ No newline at end of file
@@ -40,6 +40,21 @@ namespace DSL
     #define DSL_RECORD_TAP_NEW(name, outdir, container, clientListener) std::shared_ptr<RecordTapBintr>( \
         new RecordTapBintr(name, outdir, container, clientListener))
 
+    #define DSL_RING_RECORD_TAP_PTR std::shared_ptr<RingRecordTapBintr>
+    #define DSL_RING_RECORD_TAP_NEW(name, outdir, container, maxBytes, clientListener) \
+        std::shared_ptr<RingRecordTapBintr>( \
+        new RingRecordTapBintr(name, outdir, container, maxBytes, clientListener))
+
+    #define DSL_FILE_TAP_PTR std::shared_ptr<FileTapBintr>
+    #define DSL_FILE_TAP_NEW(name, filepath, codec, container) \
+        std::shared_ptr<FileTapBintr>( \
+        new FileTapBintr(name, filepath, codec, container))
+
+    #define DSL_RTSP_TAP_PTR std::shared_ptr<RtspTapBintr>
+    #define DSL_RTSP_TAP_NEW(name, host, udpPort, rtspPort, codec) \
+        std::shared_ptr<RtspTapBintr>( \
+        new RtspTapBintr(name, host, udpPort, rtspPort, codec))
+
     class TapBintr : public Bintr
     {
     public: 
@@ -185,5 +200,499 @@ namespace DSL
         DSL_NODETR_PTR m_pRecordBin;
     };
 
+    //-------------------------------------------------------------------------
+
+    /**
+     * @class EncodedPacketRing
+     * @brief Keyframe-aligned ring of encoded packets with a fixed byte budget.
+     * The oldest GOP is evicted whole once the budget is exceeded, so the ring 
+     * always starts on a keyframe. The ring is not thread safe, the owner
+     * is responsible for locking.
+     */
+    class EncodedPacketRing
+    {
+    public: 
+    
+        EncodedPacketRing(uint64_t maxBytes);
+        
+        ~EncodedPacketRing();
+        
+        /**
+         * @brief returns the decode time of a buffer, or its presentation
+         * time if the decode time is not set.
+         * @param[in] pBuffer buffer to query
+         * @return buffer time or GST_CLOCK_TIME_NONE if neither is set
+         */
+        static GstClockTime GetBufferTime(GstBuffer* pBuffer);
+        
+        /**
+         * @brief adds a new reference to a packet to the back of the ring, 
+         * evicting GOPs from the front as required to stay within budget.
+         * @param[in] pBuffer encoded packet to add
+         * @return false if the packet was dropped as the ring is waiting
+         * for a keyframe, true otherwise.
+         */
+        bool Push(GstBuffer* pBuffer);
+        
+        /**
+         * @brief returns new references to all packets from the latest keyframe 
+         * at least preEvent before the newest packet, or from the oldest 
+         * keyframe if the ring holds less than preEvent. 
+         * @param[in] preEvent duration of the pre-event window
+         * @return packets in order, the caller must unref each
+         */
+        std::vector<GstBuffer*> Snapshot(GstClockTime preEvent);
+        
+        /**
+         * @brief removes and unrefs all packets in the ring
+         */
+        void Clear();
+        
+        /**
+         * @brief gets the current byte budget for the ring
+         * @return maximum bytes held
+         */
+        uint64_t GetMaxBytes();
+        
+        /**
+         * @brief sets the byte budget for the ring, evicting as required
+         * @param[in] maxBytes new maximum bytes to hold
+         */
+        void SetMaxBytes(uint64_t maxBytes);
+        
+        /**
+         * @brief gets the number of bytes currently held
+         * @return size of all packets in the ring in bytes
+         */
+        uint64_t GetBytes();
+        
+        /**
+         * @brief gets the number of packets currently held
+         * @return number of packets in the ring
+         */
+        uint GetCount();
+        
+        /**
+         * @brief gets the time spanned by the packets currently held
+         * @return time from the oldest to the newest packet
+         */
+        GstClockTime GetDuration();
+        
+    private:
+    
+        /**
+         * @brief evicts GOPs from the front until within the byte budget
+         */
+        void Evict();
+        
+        /**
+         * @brief removes and unrefs the packet at the front of the ring
+         */
+        void PopFront();
+    
+        /**
+         * @brief maximum number of bytes to hold
+         */
+        uint64_t m_maxBytes;
+        
+        /**
+         * @brief number of bytes currently held
+         */
+        uint64_t m_bytes;
+        
+        /**
+         * @brief packets currently held, oldest first
+         */
+        std::deque<GstBuffer*> m_packets;
+    };
+
+    //-------------------------------------------------------------------------
+
+    /**
+     * @class RingRecordSession
+     * @brief Writes the encoded packets of one recording session to file, 
+     * through a parser and muxer in a separate Pipeline with its own threads.
+     * Once started, the session waits for completion on its own thread, calls 
+     * the client listener, and deletes itself after End is called.
+     */
+    class RingRecordSession
+    {
+    public: 
+    
+        RingRecordSession(uint id, const char* filePath, uint container,
+            dsl_ring_record_complete_listener_cb clientListener, void* clientData);
+        
+        ~RingRecordSession();
+        
+        /**
+         * @brief builds and plays the session's Pipeline for the caps provided
+         * and starts the completion thread. The caller retains ownership, and 
+         * must delete the session, if Start fails.
+         * @param[in] pCaps caps of the encoded packets, H.264 or H.265 only
+         * @return true on successful start, false otherwise
+         */
+        bool Start(GstCaps* pCaps);
+        
+        /**
+         * @brief pushes a shallow copy of a packet, with its timestamps rebased
+         * to the session's first packet. No data is copied or re-encoded.
+         * @param[in] pBuffer encoded packet to push
+         * @return true on success, false if the session has failed.
+         */
+        bool Push(GstBuffer* pBuffer);
+        
+        /**
+         * @brief ends the session with an EOS. The session must not be 
+         * accessed by the caller once ended.
+         */
+        void End();
+        
+        /**
+         * @brief waits for the session's Pipeline to complete, notifies the
+         * client, and then waits for End. Called on the completion thread.
+         */
+        void HandleCompletion();
+        
+    private:
+    
+        /**
+         * @brief unique id for this session
+         */
+        uint m_id;
+        
+        /**
+         * @brief absolute or relative path to the recording file
+         */
+        std::string m_filePath;
+        
+        /**
+         * @brief one of DSL_CONTAINER_MP4 or DSL_CONTAINER_MKV
+         */
+        uint m_container;
+        
+        /**
+         * @brief client listener to notify on completion
+         */
+        dsl_ring_record_complete_listener_cb m_clientListener;
+        
+        /**
+         * @brief opaque pointer to client data passed to the listener
+         */
+        void* m_clientData;
+        
+        /**
+         * @brief time of the first packet pushed, subtracted from all packets
+         */
+        GstClockTime m_baseTime;
+        
+        /**
+         * @brief mutex and condition to wait for End on the completion thread
+         */
+        GMutex m_sessionMutex;
+        GCond m_sessionCond;
+        
+        /**
+         * @brief true once End has been called
+         */
+        bool m_ended;
+        
+        /**
+         * @brief the session's Pipeline and App Source, owned by the session
+         */
+        GstElement* m_pPipeline;
+        GstElement* m_pAppSrc;
+    };
+
+    //-------------------------------------------------------------------------
+
+    /**
+     * @class RingRecordTapBintr
+     * @brief Implements a pre-event recording Tap that holds the encoded stream 
+     * in a keyframe-aligned ring buffer with a fixed byte budget. On session 
+     * start, the pre-event window and the post-event stream are written to 
+     * file by a RingRecordSession, without re-encoding.
+     */
+    class RingRecordTapBintr : public TapBintr
+    {
+    public: 
+    
+        RingRecordTapBintr(const char* name, const char* outdir, uint container, 
+            uint64_t maxBytes, dsl_ring_record_complete_listener_cb clientListener);
+
+        ~RingRecordTapBintr();
+  
+        /**
+         * @brief Links all Child Elementrs owned by this Bintr
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs owned by this Bintr, ending any
+         * session in progress and clearing the ring buffer.
+         * Calling UnlinkAll when in an unlinked state has no effect.
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief Gets the current byte budget for the ring buffer
+         * @return maximum bytes held by the ring buffer
+         */
+        uint64_t GetMaxBytes();
+        
+        /**
+         * @brief Sets the byte budget for the ring buffer, evicting as required
+         * @param[in] maxBytes new maximum bytes to hold
+         */
+        void SetMaxBytes(uint64_t maxBytes);
+        
+        /**
+         * @brief Gets the current level of the ring buffer
+         * @param[out] bytes number of bytes currently held
+         * @param[out] duration time spanned by the packets held in milliseconds
+         */
+        void GetCacheLevel(uint64_t* bytes, uint* duration);
+        
+        /**
+         * @brief Starts a new recording session. Only one session can be in
+         * progress at a time.
+         * @param[out] session unique Id for the new recording session
+         * @param[in] preEvent seconds before the current time to record, 
+         * limited by the contents of the ring buffer
+         * @param[in] postEvent seconds after the current time to record
+         * @param[in] clientData returned on call to client listener
+         * @return true on succesful start, false otherwise
+         */
+        bool StartSession(uint* session, uint preEvent, uint postEvent, void* clientData);
+        
+        /**
+         * @brief Stops the current recording session before the end
+         * of its post-event window.
+         * @return true on succesful stop, false if no session is in progress
+         */
+        bool StopSession();
+        
+        /**
+         * @brief Queries the Tap to check if a session is in progress
+         * @return true if recording is currently on
+         */
+        bool IsOn();
+        
+        /**
+         * @brief handles the appsink new-sample callback by adding the packet
+         * to the ring buffer and to the session in progress, if any.
+         * @return GST_FLOW_OK always
+         */
+        GstFlowReturn HandleNewSample();
+
+    private:
+
+        /**
+         * @brief ends the session in progress. Caller must hold the ring mutex.
+         */
+        void EndSession();
+
+        /**
+         * @brief absolute or relative path to the recording output dir
+         */
+        std::string m_outdir;
+        
+        /**
+         * @brief one of DSL_CONTAINER_MP4 or DSL_CONTAINER_MKV
+         */
+        uint m_container;
+        
+        /**
+         * @brief client listener to notify on session completion
+         */
+        dsl_ring_record_complete_listener_cb m_clientListener;
+        
+        /**
+         * @brief mutex to protect the ring buffer, caps, and session
+         */
+        GMutex m_ringMutex;
+        
+        /**
+         * @brief ring buffer of encoded packets
+         */
+        EncodedPacketRing m_ring;
+        
+        /**
+         * @brief caps of the encoded stream, NULL until the first packet
+         */
+        GstCaps* m_pCaps;
+        
+        /**
+         * @brief session in progress, NULL if none
+         */
+        RingRecordSession* m_pSession;
+        
+        /**
+         * @brief stream time at which the session in progress ends
+         */
+        GstClockTime m_sessionEndTime;
+        
+        /**
+         * @brief number of sessions started, used for the next session id
+         */
+        uint m_sessionCount;
+
+        /**
+         * @brief App Sink element receiving the encoded packets
+         */
+        DSL_ELEMENT_PTR m_pAppSink;
+    };
+    
+    //-------------------------------------------------------------------------
+
+    /**
+     * @class FileTapBintr
+     * @brief Implements a Tap that muxes the encoded stream to a media 
+     * container file, without re-encoding. Delta frames are dropped until
+     * the first keyframe, so the Tap can be attached mid-stream.
+     */
+    class FileTapBintr : public TapBintr
+    {
+    public: 
+    
+        FileTapBintr(const char* name, const char* filepath, 
+            uint codec, uint container);
+
+        ~FileTapBintr();
+  
+        /**
+         * @brief Links all Child Elementrs owned by this Bintr
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs owned by this Bintr
+         * Calling UnlinkAll when in an unlinked state has no effect.
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief Gets the current codec and media container formats 
+         * @param[out] codec the current codec format in use [MPEG, H.264, H.265]
+         * @param[out] container the current media container format [MP4, MKV]
+         */ 
+        void GetVideoFormats(uint* codec, uint* container);
+        
+        /**
+         * @brief handles a buffer arriving at the Tap, dropping delta 
+         * frames until the first keyframe is received.
+         * @param[in] pBuffer encoded buffer to check
+         * @return GST_PAD_PROBE_DROP for leading delta frames, 
+         * GST_PAD_PROBE_OK otherwise
+         */
+        GstPadProbeReturn HandleBuffer(GstBuffer* pBuffer);
+        
+    private:
+    
+        /**
+         * @brief one of DSL_CODEC_H264, DSL_CODEC_H265, DSL_CODEC_MPEG4
+         */
+        uint m_codec;
+        
+        /**
+         * @brief one of DSL_CONTAINER_MP4 or DSL_CONTAINER_MKV
+         */
+        uint m_container;
+        
+        /**
+         * @brief true once the first keyframe has been received
+         */
+        bool m_gotKeyFrame;
+        
+        /**
+         * @brief id of the keyframe pad probe while linked
+         */
+        gulong m_keyFrameProbeId;
+
+        DSL_ELEMENT_PTR m_pParser;
+        DSL_ELEMENT_PTR m_pContainer;
+        DSL_ELEMENT_PTR m_pFileSink;
+    };
+
+    //-------------------------------------------------------------------------
+
+    /**
+     * @class RtspTapBintr
+     * @brief Implements a Tap that serves the encoded stream over RTSP, 
+     * without re-encoding, using the same UDP Sink and RTSP Server 
+     * model as the RtspSinkBintr.
+     */
+    class RtspTapBintr : public TapBintr
+    {
+    public: 
+    
+        RtspTapBintr(const char* name, const char* host, 
+            uint udpPort, uint rtspPort, uint codec);
+
+        ~RtspTapBintr();
+  
+        /**
+         * @brief Links all Child Elementrs owned by this Bintr and 
+         * attaches the RTSP Server to the main loop context
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs owned by this Bintr and 
+         * removes the RTSP Server from the main loop context
+         * Calling UnlinkAll when in an unlinked state has no effect.
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief Gets the current UDP/RTSP port and codec settings
+         * @param[out] udpPort the current UDP port number for the UDP Sink
+         * @param[out] rtspPort the current RTSP port number for the RTSP Server
+         * @param[out] codec the current codec in use, H.264 or H.265
+         */ 
+        void GetServerSettings(uint* udpPort, uint* rtspPort, uint* codec);
+        
+    private:
+
+        std::string m_host;
+        uint m_udpPort;
+        uint m_rtspPort;
+        uint m_codec;
+        
+        GstRTSPServer* m_pServer;
+        uint m_pServerSrcId;
+        GstRTSPMediaFactory* m_pFactory;
+ 
+        DSL_ELEMENT_PTR m_pParser;
+        DSL_ELEMENT_PTR m_pPayloader;  
+        DSL_ELEMENT_PTR m_pUdpSink;
+    };
+    
+    /**
+     * @brief Callback function for the Ring Record Tap's appsink new-sample
+     * @param[in] pAppSink appsink element with a new sample
+     * @param[in] pTap (callback user data) pointer to the unique tap object
+     * @return GST_FLOW_OK always
+     */
+    static GstFlowReturn RingRecordTapNewSampleCB(GstAppSink* pAppSink, gpointer pTap);
+
+    /**
+     * @brief Thread function for a RingRecordSession's completion
+     * @param[in] pSession pointer to the RingRecordSession, deleted on return
+     * @return NULL always
+     */
+    static gpointer RingRecordSessionThread(gpointer pSession);
+
+    /**
+     * @brief Buffer probe callback for the File Tap's queue sink pad
+     * @param[in] pPad queue sink pad
+     * @param[in] pInfo probe info with the buffer
+     * @param[in] pTap pointer to the FileTapBintr that added the probe
+     * @return result of FileTapBintr::HandleBuffer
+     */
+    static GstPadProbeReturn FileTapKeyFrameProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pTap);
 }
 #endif // _DSL_TAP_BINTR_H
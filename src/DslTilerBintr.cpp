@@ -38,7 +38,9 @@ namespace DSL
         , m_showSourceId(-1)
         , m_showSourceTimeout(0)
         , m_showSourceCounter(0)
-        , m_showSourceTimerId(0)    
+        , m_pShowSourceTimerSource(NULL)    
+        , m_isFramePruningEnabled(false)
+        , m_framePruningProbeId(0)
     {
         LOG_FUNC();
 
@@ -61,6 +63,13 @@ namespace DSL
         m_pSrcPadProbe = DSL_PAD_PROBE_NEW("tiler-src-pad-probe", "src", m_pTiler);
     
         g_mutex_init(&m_showSourceMutex);
+        
+        // Added ahead of the src pad probe handlers, so that they and all
+        // downstream components see the pruned batch
+        GstPad* pSrcPad = gst_element_get_static_pad(m_pTiler->GetGstElement(), "src");
+        m_framePruningProbeId = gst_pad_add_probe(pSrcPad, GST_PAD_PROBE_TYPE_BUFFER,
+            TilerFramePruningProbeCB, this, NULL);
+        gst_object_unref(pSrcPad);
     }
 
     TilerBintr::~TilerBintr()
@@ -71,11 +80,17 @@ namespace DSL
         {    
             UnlinkAll();
         }
-        if (m_showSourceTimerId)
+        if (m_pShowSourceTimerSource)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_showSourceMutex);
             
-            g_source_remove(m_showSourceTimerId);
+            RemovePipelineTimeout(m_pShowSourceTimerSource);
+        }
+        if (m_framePruningProbeId)
+        {
+            GstPad* pSrcPad = gst_element_get_static_pad(m_pTiler->GetGstElement(), "src");
+            gst_pad_remove_probe(pSrcPad, m_framePruningProbeId);
+            gst_object_unref(pSrcPad);
         }
         g_mutex_clear(&m_showSourceMutex);
     }
@@ -183,7 +198,7 @@ namespace DSL
         
         if (sourceId != m_showSourceId)
         {
-            if (m_showSourceTimerId and !hasPrecedence)
+            if (m_pShowSourceTimerSource and !hasPrecedence)
             {
                 // don't log error as this may be common with ODE Triggers and Actions calling
                 LOG_DEBUG("Show source Timer is running for Source '" << m_showSourceId << 
@@ -196,10 +211,16 @@ namespace DSL
             m_pTiler->SetAttribute("show-source", m_showSourceId);
 
             m_showSourceCounter = timeout*10;
+            if (m_pShowSourceTimerSource)
+            {
+                RemovePipelineTimeout(m_pShowSourceTimerSource);
+                m_pShowSourceTimerSource = NULL;
+            }
             if (m_showSourceCounter)
             {
                 LOG_INFO("Adding show-source timer with timeout = " << timeout << "' for TilerBintr '" << GetName());
-                m_showSourceTimerId = g_timeout_add(100, ShowSourceTimerHandler, this);
+                m_pShowSourceTimerSource = AddPipelineTimeout(GetGstObject(), 
+                    100, ShowSourceTimerHandler, this);
             }
             return true;
         }
@@ -208,10 +229,11 @@ namespace DSL
         
         m_showSourceTimeout = timeout;
         m_showSourceCounter = timeout*10;
-        if (!m_showSourceTimerId and m_showSourceCounter)
+        if (!m_pShowSourceTimerSource and m_showSourceCounter)
         {
             LOG_INFO("Adding show-source timer with timeout = " << timeout << "' for TilerBintr '" << GetName());
-            m_showSourceTimerId = g_timeout_add(100, ShowSourceTimerHandler, this);
+            m_pShowSourceTimerSource = AddPipelineTimeout(GetGstObject(), 
+                100, ShowSourceTimerHandler, this);
         }
         return true;
     }
@@ -222,8 +244,9 @@ namespace DSL
         
         if (--m_showSourceCounter == 0)
         {
-            // reset the timer Id, show all sources, and return false to destroy the timer
-            m_showSourceTimerId = 0;
+            // release the timer, show all sources, and return false to destroy the timer
+            RemovePipelineTimeout(m_pShowSourceTimerSource);
+            m_pShowSourceTimerSource = NULL;
             m_showSourceId = -1;
             m_pTiler->SetAttribute("show-source", m_showSourceId);
             return false;
@@ -234,10 +257,10 @@ namespace DSL
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_showSourceMutex);
         
-        if (m_showSourceTimerId)
+        if (m_pShowSourceTimerSource)
         {
-            g_source_remove(m_showSourceTimerId);
-            m_showSourceTimerId = 0;
+            RemovePipelineTimeout(m_pShowSourceTimerSource);
+            m_pShowSourceTimerSource = NULL;
         }
         if (m_showSourceId != -1)
         {
@@ -246,6 +269,76 @@ namespace DSL
         }
     }
 
+    bool TilerBintr::GetFramePruningEnabled()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_showSourceMutex);
+        
+        return m_isFramePruningEnabled;
+    }
+    
+    void TilerBintr::SetFramePruningEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_showSourceMutex);
+        
+        m_isFramePruningEnabled = enabled;
+    }
+    
+    uint TilerBintr::PruneHiddenFrames(NvDsBatchMeta* pBatchMeta)
+    {
+        // Don't log function entry/exit as this is called for every batch
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_showSourceMutex);
+        
+        if (!pBatchMeta or !m_isFramePruningEnabled or m_showSourceId == -1)
+        {
+            return 0;
+        }
+        
+        nvds_acquire_meta_lock(pBatchMeta);
+        
+        uint hiddenFrames(0);
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            if (!pFrameMeta or (int)pFrameMeta->source_id == m_showSourceId)
+            {
+                continue;
+            }
+            hiddenFrames++;
+            
+            // The frame and its object meta are left in the batch for all 
+            // downstream consumers, only what the OSD would draw is removed.
+            std::vector<NvDsDisplayMeta*> displayMetas;
+            for (NvDsMetaList* pDisplayMetaList = pFrameMeta->display_meta_list; 
+                pDisplayMetaList; pDisplayMetaList = pDisplayMetaList->next)
+            {
+                displayMetas.push_back((NvDsDisplayMeta*)(pDisplayMetaList->data));
+            }
+            for (auto const& ivec: displayMetas)
+            {
+                nvds_remove_display_meta_from_frame(pFrameMeta, ivec);
+            }
+            for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+            {
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectMetaList->data);
+                
+                pObjectMeta->rect_params.border_width = 0;
+                pObjectMeta->rect_params.has_bg_color = 0;
+                pObjectMeta->text_params.set_bg_clr = 0;
+                if (pObjectMeta->text_params.display_text)
+                {
+                    pObjectMeta->text_params.display_text[0] = 0;
+                }
+            }
+        }
+        nvds_release_meta_lock(pBatchMeta);
+        
+        return hiddenFrames;
+    }
+
     bool TilerBintr::SetGpuId(uint gpuId)
     {
         LOG_FUNC();
@@ -272,4 +365,12 @@ namespace DSL
         return static_cast<TilerBintr*>(user_data)->
             HandleShowSourceTimer();
     }
+
+    static GstPadProbeReturn TilerFramePruningProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pTiler)
+    {
+        static_cast<TilerBintr*>(pTiler)->PruneHiddenFrames(
+            gst_buffer_get_nvds_batch_meta(GST_PAD_PROBE_INFO_BUFFER(pInfo)));
+        return GST_PAD_PROBE_OK;
+    }
 }
\ No newline at end of file
@@ -124,6 +124,32 @@ namespace DSL
          */
         void ShowAllSources();
         
+        /**
+         * @brief Gets the current frame-pruning setting for the TilerBintr
+         * @return true if frame-pruning is enabled, false otherwise
+         */
+        bool GetFramePruningEnabled();
+        
+        /**
+         * @brief Sets the frame-pruning setting for the TilerBintr. When enabled,
+         * and while a single source is shown, the display meta of all hidden 
+         * sources is removed on the Tiler's src pad, and their object boxes and 
+         * labels are hidden, so the OSD draws the shown source only. The frame 
+         * and object meta of the hidden sources remain in the batch.
+         * Can be called at any time.
+         * @param[in] enabled set to true to enable frame-pruning
+         */
+        void SetFramePruningEnabled(bool enabled);
+        
+        /**
+         * @brief Removes the display meta, and hides the object boxes and labels,
+         * of all hidden sources in a batch, if frame-pruning is enabled and a 
+         * single source is shown.
+         * @param[in] pBatchMeta batch meta to prune
+         * @return number of hidden frames pruned
+         */
+        uint PruneHiddenFrames(NvDsBatchMeta* pBatchMeta);
+        
         /**
          * @brief Sets the GPU ID for all Elementrs
          * @return true if successfully set, false otherwise.
@@ -183,14 +209,35 @@ namespace DSL
         uint m_showSourceCounter;
 
         /**
-         * @brief show-source timer-id, non-zero == currently running
+         * @brief show-source timer source, non-NULL == currently running
          */
-        uint m_showSourceTimerId;
+        GSource* m_pShowSourceTimerSource;
+        
+        /**
+         * @brief true if the frames of hidden sources are pruned from the batch
+         * while a single source is shown.
+         */
+        bool m_isFramePruningEnabled;
+        
+        /**
+         * @brief probe id for the Tiler's src pad frame-pruning probe
+         */
+        gulong m_framePruningProbeId;
     };
 
     //----------------------------------------------------------------------------------------------
 
     static int ShowSourceTimerHandler(void* user_data);
+
+    /**
+     * @brief Buffer probe callback for the Tiler's src pad
+     * @param[in] pPad Tiler src pad
+     * @param[in] pInfo probe info with the buffer
+     * @param[in] pTiler pointer to the TilerBintr that added the probe
+     * @return GST_PAD_PROBE_OK always
+     */
+    static GstPadProbeReturn TilerFramePruningProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pTiler);
 }
 
 #endif // _DSL_TILER_BINTR_H
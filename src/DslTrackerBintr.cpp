@@ -53,6 +53,23 @@ namespace DSL
         m_pSrcPadProbe = DSL_PAD_PROBE_NEW("tracker-src-pad-probe", "src", m_pTracker);
     }
 
+    TrackerBintr::TrackerBintr(const char* name)
+        : Bintr(name)
+        , m_width(0)
+        , m_height(0)
+    {
+        LOG_FUNC();
+        m_pTracker = DSL_ELEMENT_NEW("identity", "tracker-tracker");
+
+        AddChild(m_pTracker);
+
+        m_pTracker->AddGhostPadToParent("sink");
+        m_pTracker->AddGhostPadToParent("src");
+        
+        m_pSinkPadProbe = DSL_PAD_PROBE_NEW("tracker-sink-pad-probe", "sink", m_pTracker);
+        m_pSrcPadProbe = DSL_PAD_PROBE_NEW("tracker-src-pad-probe", "src", m_pTracker);
+    }
+
     TrackerBintr::~TrackerBintr()
     {
         LOG_FUNC();
@@ -185,4 +202,388 @@ namespace DSL
         }
         m_pTracker->SetAttribute("ll-config-file", configFile);
     }
+
+    CpuIouTrackerBintr::CpuIouTrackerBintr(const char* name, 
+        uint maxAge, float iouThreshold, uint maxTracks)
+        : TrackerBintr(name)
+        , m_maxAge(maxAge)
+        , m_iouThreshold(iouThreshold)
+        , m_maxTracks(maxTracks)
+        , m_lastTrackId(0)
+        , m_sinkProbeId(0)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_tracksMutex);
+    }
+
+    CpuIouTrackerBintr::~CpuIouTrackerBintr()
+    {
+        LOG_FUNC();
+
+        if (IsLinked())
+        {
+            UnlinkAll();
+        }
+        g_mutex_clear(&m_tracksMutex);
+    }
+
+    bool CpuIouTrackerBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!TrackerBintr::LinkAll())
+        {
+            return false;
+        }
+        // The tracking probe is added after the sink Pad Probe so that sink 
+        // pad-probe-handlers see the batch before tracking, as with nvtracker
+        GstPad* pSinkPad = gst_element_get_static_pad(m_pTracker->GetGstElement(), "sink");
+        if (!pSinkPad)
+        {
+            LOG_ERROR("Failed to get sink pad for CpuIouTrackerBintr '" << GetName() << "'");
+            TrackerBintr::UnlinkAll();
+            return false;
+        }
+        m_sinkProbeId = gst_pad_add_probe(pSinkPad, GST_PAD_PROBE_TYPE_BUFFER,
+            CpuIouTrackerSinkPadProbeCB, this, NULL);
+        gst_object_unref(pSinkPad);
+        
+        return true;
+    }
+    
+    void CpuIouTrackerBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("CpuIouTrackerBintr '" << m_name << "' is not linked");
+            return;
+        }
+        if (m_sinkProbeId)
+        {
+            GstPad* pSinkPad = gst_element_get_static_pad(m_pTracker->GetGstElement(), "sink");
+            gst_pad_remove_probe(pSinkPad, m_sinkProbeId);
+            gst_object_unref(pSinkPad);
+            m_sinkProbeId = 0;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracksMutex);
+        
+        m_trackPools.clear();
+        m_lastTrackId = 0;
+        
+        TrackerBintr::UnlinkAll();
+    }
+
+    void CpuIouTrackerBintr::GetMaxDimensions(uint* width, uint* height)
+    {
+        LOG_FUNC();
+        
+        *width = m_width;
+        *height = m_height;
+    }
+
+    bool CpuIouTrackerBintr::SetMaxDimensions(uint width, uint height)
+    {
+        LOG_FUNC();
+        
+        LOG_ERROR("Max dimensions are not supported by CpuIouTrackerBintr '" 
+            << GetName() << "'");
+        return false;
+    }
+
+    bool CpuIouTrackerBintr::SetGpuId(uint gpuId)
+    {
+        LOG_FUNC();
+        
+        LOG_ERROR("GPU ID is not supported by CpuIouTrackerBintr '" 
+            << GetName() << "'");
+        return false;
+    }
+
+    void CpuIouTrackerBintr::GetSettings(uint* maxAge, 
+        float* iouThreshold, uint* maxTracks)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracksMutex);
+        
+        *maxAge = m_maxAge;
+        *iouThreshold = m_iouThreshold;
+        *maxTracks = m_maxTracks;
+    }
+
+    bool CpuIouTrackerBintr::SetSettings(uint maxAge, 
+        float iouThreshold, uint maxTracks)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set settings for CpuIouTrackerBintr '" 
+                << GetName() << "' as it's currently linked");
+            return false;
+        }
+        if (iouThreshold <= 0 or iouThreshold > 1 or maxTracks == 0)
+        {
+            LOG_ERROR("Invalid settings iou-threshold = " << iouThreshold 
+                << " max-tracks = " << maxTracks << " for CpuIouTrackerBintr '" 
+                << GetName() << "'");
+            return false;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracksMutex);
+        
+        m_maxAge = maxAge;
+        m_iouThreshold = iouThreshold;
+        m_maxTracks = maxTracks;
+        m_trackPools.clear();
+        
+        return true;
+    }
+
+    uint CpuIouTrackerBintr::GetNumActiveTracks()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracksMutex);
+        
+        uint numActive(0);
+        for (auto const& ipool: m_trackPools)
+        {
+            for (auto const& track: ipool.second)
+            {
+                numActive += track.active;
+            }
+        }
+        return numActive;
+    }
+
+    void CpuIouTrackerBintr::HandleSinkPadBuffer(GstBuffer* pBuffer)
+    {
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (pBatchMeta)
+        {
+            TrackObjects(pBatchMeta);
+        }
+    }
+
+    uint CpuIouTrackerBintr::TrackObjects(NvDsBatchMeta* pBatchMeta)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_tracksMutex);
+        
+        uint tracked(0);
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            
+            auto ipool = m_trackPools.find(pFrameMeta->source_id);
+            if (ipool == m_trackPools.end())
+            {
+                // Allocate the source's pool once, at full capacity
+                ipool = m_trackPools.emplace(pFrameMeta->source_id, 
+                    std::vector<CpuIouTrack>(m_maxTracks, CpuIouTrack{0})).first;
+            }
+            tracked += TrackFrameObjects(pFrameMeta, ipool->second);
+        }
+        return tracked;
+    }
+
+    /**
+     * @brief four packed floats, using GCC's vector extensions so that the IOU
+     * row is computed with SSE on x86 and NEON on aarch64 at any optimization 
+     * level, without relying on the auto-vectorizer.
+     */
+    typedef float IouFloat4 __attribute__((vector_size(16)));
+
+    static inline IouFloat4 LoadIouFloat4(const float* pFloats)
+    {
+        IouFloat4 value;
+        memcpy(&value, pFloats, sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief Computes one row of the IOU matrix, the IOU of a single track's 
+     * box with each object box. Four objects are computed per iteration over 
+     * separate coordinate arrays, with a scalar loop for the remainder. Both
+     * paths use the same operations, in the same order, as std::min/std::max.
+     */
+    static void ComputeIouRow(const CpuIouTrack& track, const float* lefts, 
+        const float* tops, const float* rights, const float* bottoms, 
+        uint count, float* row)
+    {
+        float trackArea = (track.right - track.left) * (track.bottom - track.top);
+        
+        const IouFloat4 zero = {0.0f, 0.0f, 0.0f, 0.0f};
+        const IouFloat4 one = {1.0f, 1.0f, 1.0f, 1.0f};
+        const IouFloat4 trackLeft = {track.left, track.left, track.left, track.left};
+        const IouFloat4 trackTop = {track.top, track.top, track.top, track.top};
+        const IouFloat4 trackRight = {track.right, track.right, track.right, track.right};
+        const IouFloat4 trackBottom = {track.bottom, track.bottom, track.bottom, track.bottom};
+        const IouFloat4 trackArea4 = {trackArea, trackArea, trackArea, trackArea};
+        
+        uint i(0);
+        for (; i + 4 <= count; i += 4)
+        {
+            IouFloat4 left = LoadIouFloat4(&lefts[i]);
+            IouFloat4 top = LoadIouFloat4(&tops[i]);
+            IouFloat4 right = LoadIouFloat4(&rights[i]);
+            IouFloat4 bottom = LoadIouFloat4(&bottoms[i]);
+            
+            IouFloat4 width = ((right < trackRight) ? right : trackRight) - 
+                ((trackLeft < left) ? left : trackLeft);
+            width = (zero < width) ? width : zero;
+            IouFloat4 height = ((bottom < trackBottom) ? bottom : trackBottom) - 
+                ((trackTop < top) ? top : trackTop);
+            height = (zero < height) ? height : zero;
+            
+            IouFloat4 intersection = width * height;
+            IouFloat4 area = (right - left) * (bottom - top);
+            IouFloat4 uni = trackArea4 + area - intersection;
+            
+            // degenerate boxes have no intersection, avoid the divide by 0
+            IouFloat4 iou = intersection / ((uni > zero) ? uni : one);
+            memcpy(&row[i], &iou, sizeof(iou));
+        }
+        for (; i < count; i++)
+        {
+            float width = std::max(0.0f, 
+                std::min(track.right, rights[i]) - std::max(track.left, lefts[i]));
+            float height = std::max(0.0f, 
+                std::min(track.bottom, bottoms[i]) - std::max(track.top, tops[i]));
+            float intersection = width * height;
+            float area = (rights[i] - lefts[i]) * (bottoms[i] - tops[i]);
+            float uni = trackArea + area - intersection;
+            
+            row[i] = intersection / ((uni > 0.0f) ? uni : 1.0f);
+        }
+    }
+
+    uint CpuIouTrackerBintr::TrackFrameObjects(NvDsFrameMeta* pFrameMeta, 
+        std::vector<CpuIouTrack>& tracks)
+    {
+        std::vector<NvDsObjectMeta*> objects;
+        m_objectLefts.clear();
+        m_objectTops.clear();
+        m_objectRights.clear();
+        m_objectBottoms.clear();
+        
+        for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+            pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+        {
+            NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectMetaList->data);
+            NvOSD_RectParams& rect = pObjectMeta->rect_params;
+            
+            objects.push_back(pObjectMeta);
+            m_objectLefts.push_back(rect.left);
+            m_objectTops.push_back(rect.top);
+            m_objectRights.push_back(rect.left + rect.width);
+            m_objectBottoms.push_back(rect.top + rect.height);
+        }
+        uint numObjects = objects.size();
+        uint numTracks = tracks.size();
+        
+        // Build the tracks x objects IOU matrix, inactive rows are zeroed 
+        m_iouMatrix.assign(numTracks * numObjects, 0.0f);
+        
+        std::vector<std::pair<float, std::pair<uint, uint>>> candidates;
+        for (uint t = 0; t < numTracks; t++)
+        {
+            if (!tracks[t].active)
+            {
+                continue;
+            }
+            float* row = &m_iouMatrix[t * numObjects];
+            ComputeIouRow(tracks[t], m_objectLefts.data(), m_objectTops.data(), 
+                m_objectRights.data(), m_objectBottoms.data(), numObjects, row);
+                
+            for (uint o = 0; o < numObjects; o++)
+            {
+                if (row[o] >= m_iouThreshold and 
+                    tracks[t].classId == objects[o]->class_id)
+                {
+                    candidates.push_back(std::make_pair(row[o], std::make_pair(t, o)));
+                }
+            }
+        }
+        
+        // Greedy association, highest IOU first
+        std::sort(candidates.begin(), candidates.end(), 
+            [](const std::pair<float, std::pair<uint, uint>>& a, 
+                const std::pair<float, std::pair<uint, uint>>& b)
+            { return a.first > b.first; });
+            
+        std::vector<bool> trackMatched(numTracks, false);
+        std::vector<bool> objectMatched(numObjects, false);
+        uint tracked(0);
+        
+        for (auto const& candidate: candidates)
+        {
+            uint t = candidate.second.first;
+            uint o = candidate.second.second;
+            if (trackMatched[t] or objectMatched[o])
+            {
+                continue;
+            }
+            trackMatched[t] = objectMatched[o] = true;
+            
+            tracks[t].left = m_objectLefts[o];
+            tracks[t].top = m_objectTops[o];
+            tracks[t].right = m_objectRights[o];
+            tracks[t].bottom = m_objectBottoms[o];
+            tracks[t].age = 0;
+            objects[o]->object_id = tracks[t].trackId;
+            tracked++;
+        }
+        
+        // Age out the unmatched tracks, freeing their slots in the pool
+        for (uint t = 0; t < numTracks; t++)
+        {
+            if (tracks[t].active and !trackMatched[t] and ++tracks[t].age > m_maxAge)
+            {
+                tracks[t].active = false;
+            }
+        }
+        
+        // Start new tracks for the unmatched objects while there's capacity
+        uint nextSlot(0);
+        for (uint o = 0; o < numObjects; o++)
+        {
+            if (objectMatched[o])
+            {
+                continue;
+            }
+            while (nextSlot < numTracks and tracks[nextSlot].active)
+            {
+                nextSlot++;
+            }
+            if (nextSlot == numTracks)
+            {
+                objects[o]->object_id = UNTRACKED_OBJECT_ID;
+                continue;
+            }
+            CpuIouTrack& track = tracks[nextSlot];
+            track.trackId = ++m_lastTrackId;
+            track.classId = objects[o]->class_id;
+            track.left = m_objectLefts[o];
+            track.top = m_objectTops[o];
+            track.right = m_objectRights[o];
+            track.bottom = m_objectBottoms[o];
+            track.age = 0;
+            track.active = true;
+            
+            objects[o]->object_id = track.trackId;
+            tracked++;
+        }
+        return tracked;
+    }
+
+    static GstPadProbeReturn CpuIouTrackerSinkPadProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pTracker)
+    {
+        static_cast<CpuIouTrackerBintr*>(pTracker)->
+            HandleSinkPadBuffer((GstBuffer*)pInfo->data);
+        return GST_PAD_PROBE_OK;
+    }
 } // DSL
\ No newline at end of file
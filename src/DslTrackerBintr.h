@@ -48,6 +48,11 @@ namespace DSL
     #define DSL_IOU_TRACKER_NEW(name, configFile, width, height) \
         std::shared_ptr<IouTrackerBintr>(new IouTrackerBintr(name, configFile, width, height))
 
+    #define DSL_CPU_IOU_TRACKER_PTR std::shared_ptr<CpuIouTrackerBintr>
+    #define DSL_CPU_IOU_TRACKER_NEW(name, maxAge, iouThreshold, maxTracks) \
+        std::shared_ptr<CpuIouTrackerBintr>(new CpuIouTrackerBintr(name, \
+            maxAge, iouThreshold, maxTracks))
+
     class TrackerBintr : public Bintr
     {
     public: 
@@ -103,7 +108,7 @@ namespace DSL
          * @param[out] width the current width setting in pixels
          * @param[out] height the current height setting in pixels
          */ 
-        void GetMaxDimensions(uint* width, uint* height);
+        virtual void GetMaxDimensions(uint* width, uint* height);
         
         /**
          * @brief Sets the current width and height settings for this Tracker
@@ -112,7 +117,7 @@ namespace DSL
          * @param[in] height the height value to set in pixels
          * @return false if the Tracker is currently in Use. True otherwise
          */ 
-        bool SetMaxDimensions(uint width, uint hieght);
+        virtual bool SetMaxDimensions(uint width, uint hieght);
 
         /**
          * @brief Sets the GPU ID for all Elementrs
@@ -121,6 +126,13 @@ namespace DSL
         bool SetGpuId(uint gpuId);
         
     protected:
+    
+        /**
+         * @brief ctor for derived Trackers that implement their tracking
+         * in a pad probe over a pass-through Elementr in place of nvtracker
+         * @param[in] name unique name for the new TrackerBintr
+         */
+        TrackerBintr(const char* name);
 
         /**
          * @brief pathspec to the tracker config file used by this TrackerBintr
@@ -162,6 +174,183 @@ namespace DSL
         IouTrackerBintr(const char* name, const char* configFile, guint width, guint height);
     };
 
+    /**
+     * @struct CpuIouTrack
+     * @brief a single entry in a CpuIouTrackerBintr's fixed-capacity track pool
+     */
+    struct CpuIouTrack
+    {
+        guint64 trackId;
+        gint classId;
+        float left;
+        float top;
+        float right;
+        float bottom;
+        
+        /**
+         * @brief number of consecutive frames the track has gone unmatched
+         */
+        uint age;
+        bool active;
+    };
+
+    /**
+     * @class CpuIouTrackerBintr
+     * @brief Implements a lightweight CPU tracker that associates the objects 
+     * of each frame with the active tracks of the same source by greedy IOU 
+     * matching, assigning each tracked object a unique object_id.
+     */
+    class CpuIouTrackerBintr : public TrackerBintr
+    {
+    public: 
+    
+        CpuIouTrackerBintr(const char* name, 
+            uint maxAge, float iouThreshold, uint maxTracks);
+
+        ~CpuIouTrackerBintr();
+
+        /**
+         * @brief Links all Child Elementrs owned by this Bintr and
+         * adds the tracking pad probe
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs owned by this Bintr and
+         * removes the tracking pad probe, clearing all tracks
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief The CPU IOU Tracker has no input transform, the max 
+         * width and height are always returned as 0
+         */ 
+        void GetMaxDimensions(uint* width, uint* height);
+        
+        /**
+         * @brief The CPU IOU Tracker has no input transform, max 
+         * dimensions can not be set.
+         * @return false always
+         */ 
+        bool SetMaxDimensions(uint width, uint hieght);
+
+        /**
+         * @brief The CPU IOU Tracker runs on the CPU only, the GPU ID 
+         * can not be set.
+         * @return false always
+         */ 
+        bool SetGpuId(uint gpuId);
+
+        /**
+         * @brief Gets the current tracking settings for this CpuIouTrackerBintr
+         * @param[out] maxAge max frames a track can go unmatched before removal
+         * @param[out] iouThreshold minimum IOU for an object to match a track
+         * @param[out] maxTracks capacity of the track pool for each source
+         */
+        void GetSettings(uint* maxAge, float* iouThreshold, uint* maxTracks);
+
+        /**
+         * @brief Sets the tracking settings for this CpuIouTrackerBintr
+         * @param[in] maxAge max frames a track can go unmatched before removal
+         * @param[in] iouThreshold minimum IOU for an object to match a track, 
+         * in the range (0.0, 1.0]
+         * @param[in] maxTracks capacity of the track pool for each source, > 0
+         * @return false if the Tracker is currently linked or the settings 
+         * are invalid, true otherwise
+         */
+        bool SetSettings(uint maxAge, float iouThreshold, uint maxTracks);
+
+        /**
+         * @brief Gets the current number of active tracks for all sources
+         * @return number of active tracks
+         */
+        uint GetNumActiveTracks();
+
+        /**
+         * @brief Associates all objects in a batch with the active tracks 
+         * of their source, assigning each matched or new track's id as
+         * the object's object_id. Objects that can't be tracked because the
+         * pool is full are set to UNTRACKED_OBJECT_ID
+         * @param[in] pBatchMeta batch meta for the current buffer
+         * @return number of objects assigned a track id
+         */
+        uint TrackObjects(NvDsBatchMeta* pBatchMeta);
+
+        /**
+         * @brief Handles a buffer on the Tracker's sink pad
+         * @param[in] pBuffer buffer to track the objects of
+         */
+        void HandleSinkPadBuffer(GstBuffer* pBuffer);
+
+    private:
+
+        /**
+         * @brief Associates the objects of a single frame with the track pool
+         * of the frame's source
+         * @param[in] pFrameMeta frame meta with the objects to track
+         * @param[in] tracks track pool for the frame's source
+         * @return number of objects assigned a track id
+         */
+        uint TrackFrameObjects(NvDsFrameMeta* pFrameMeta, 
+            std::vector<CpuIouTrack>& tracks);
+    
+        /**
+         * @brief max frames a track can go unmatched before it's removed
+         */
+        uint m_maxAge;
+        
+        /**
+         * @brief minimum IOU for an object to be matched with a track
+         */
+        float m_iouThreshold;
+        
+        /**
+         * @brief capacity of the track pool allocated for each source
+         */
+        uint m_maxTracks;
+        
+        /**
+         * @brief last track id assigned, ids are unique across all sources
+         */
+        guint64 m_lastTrackId;
+
+        /**
+         * @brief map of fixed-capacity track pools, keyed by source id
+         */
+        std::map<uint, std::vector<CpuIouTrack>> m_trackPools;
+
+        /**
+         * @brief scratch buffers for the object boxes of the current frame,
+         * stored as separate arrays so the IOU loop can be vectorized
+         */
+        std::vector<float> m_objectLefts;
+        std::vector<float> m_objectTops;
+        std::vector<float> m_objectRights;
+        std::vector<float> m_objectBottoms;
+        
+        /**
+         * @brief scratch buffer for the tracks x objects IOU matrix
+         */
+        std::vector<float> m_iouMatrix;
+        
+        /**
+         * @brief sink pad probe id for the tracking probe, 0 when not added
+         */
+        gulong m_sinkProbeId;
+        
+        /**
+         * @brief mutex to protect the track pools and settings
+         */
+        GMutex m_tracksMutex;
+    };
+
+    /**
+     * @brief Probe callback for buffers entering the CPU IOU Tracker
+     */
+    static GstPadProbeReturn CpuIouTrackerSinkPadProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pTracker);
+
 } // DSL
 
 #endif // _DSL_TRACKER_BINTR_H
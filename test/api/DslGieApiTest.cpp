@@ -414,6 +414,96 @@ SCENARIO( "A Primary GIE can Get and Set its Interval",  "[gie-api]" )
     }
 }
 
+SCENARIO( "A Primary GIE can Get and Set its adaptive Interval settings",  "[gie-api]" )
+{
+    GIVEN( "A new Primary GIE in memory" ) 
+    {
+        std::wstring primaryGieName(L"primary-gie");
+        std::wstring inferConfigFile = L"./test/configs/config_infer_primary_nano.txt";
+        std::wstring modelEngineFile = L"./test/models/Primary_Detector_Nano/resnet10.caffemodel";
+        uint interval(1);
+
+        REQUIRE( dsl_gie_primary_new(primaryGieName.c_str(), inferConfigFile.c_str(), 
+            modelEngineFile.c_str(), interval) == DSL_RESULT_SUCCESS );
+
+        boolean retEnabled(true);
+        uint retMinInterval(99), retMaxInterval(99);
+        REQUIRE( dsl_gie_primary_interval_adaptive_get(primaryGieName.c_str(), 
+            &retEnabled, &retMinInterval, &retMaxInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( retEnabled == false );
+        REQUIRE( retMinInterval == 0 );
+        REQUIRE( retMaxInterval == 0 );
+        
+        WHEN( "The Primary GIE's adaptive Interval settings are set" )
+        {
+            REQUIRE( dsl_gie_primary_interval_adaptive_set(primaryGieName.c_str(), 
+                true, 1, 4) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct settings are returned on get" )
+            {
+                REQUIRE( dsl_gie_primary_interval_adaptive_get(primaryGieName.c_str(), 
+                    &retEnabled, &retMinInterval, &retMaxInterval) == DSL_RESULT_SUCCESS );
+                REQUIRE( retEnabled == true );
+                REQUIRE( retMinInterval == 1 );
+                REQUIRE( retMaxInterval == 4 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The Primary GIE's adaptive Interval bounds are invalid" )
+        {
+            THEN( "The set fails and the settings are unchanged" )
+            {
+                REQUIRE( dsl_gie_primary_interval_adaptive_set(primaryGieName.c_str(), 
+                    true, 4, 1) == DSL_RESULT_GIE_SET_FAILED );
+                REQUIRE( dsl_gie_primary_interval_adaptive_get(primaryGieName.c_str(), 
+                    &retEnabled, &retMinInterval, &retMaxInterval) == DSL_RESULT_SUCCESS );
+                REQUIRE( retEnabled == false );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+static void interval_change_listener_cb(uint prev_interval, uint curr_interval, void* client_data)
+{
+}
+
+SCENARIO( "An Interval Change Listener can be added and removed from a Primary GIE",  "[gie-api]" )
+{
+    GIVEN( "A new Primary GIE in memory" ) 
+    {
+        std::wstring primaryGieName(L"primary-gie");
+        std::wstring inferConfigFile = L"./test/configs/config_infer_primary_nano.txt";
+        std::wstring modelEngineFile = L"./test/models/Primary_Detector_Nano/resnet10.caffemodel";
+
+        REQUIRE( dsl_gie_primary_new(primaryGieName.c_str(), inferConfigFile.c_str(), 
+            modelEngineFile.c_str(), 0) == DSL_RESULT_SUCCESS );
+
+        WHEN( "An Interval Change Listener is added" )
+        {
+            REQUIRE( dsl_gie_primary_interval_listener_add(primaryGieName.c_str(), 
+                interval_change_listener_cb, NULL) == DSL_RESULT_SUCCESS );
+
+            // second call must fail
+            REQUIRE( dsl_gie_primary_interval_listener_add(primaryGieName.c_str(), 
+                interval_change_listener_cb, NULL) == DSL_RESULT_GIE_LISTENER_ADD_FAILED );
+
+            THEN( "The same listener can be removed" )
+            {
+                REQUIRE( dsl_gie_primary_interval_listener_remove(primaryGieName.c_str(), 
+                    interval_change_listener_cb) == DSL_RESULT_SUCCESS );
+
+                // second call must fail
+                REQUIRE( dsl_gie_primary_interval_listener_remove(primaryGieName.c_str(), 
+                    interval_change_listener_cb) == DSL_RESULT_GIE_LISTENER_REMOVE_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
 
 SCENARIO( "The GIE API checks for NULL input parameters", "[gie-api]" )
 {
@@ -451,6 +541,13 @@ SCENARIO( "The GIE API checks for NULL input parameters", "[gie-api]" )
                 REQUIRE( dsl_gie_model_engine_file_set(gieName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );                
                 REQUIRE( dsl_gie_interval_get(NULL, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );                
                 REQUIRE( dsl_gie_interval_set(NULL, interval) == DSL_RESULT_INVALID_INPUT_PARAM );                
+                REQUIRE( dsl_gie_primary_interval_adaptive_get(NULL, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );                
+                REQUIRE( dsl_gie_primary_interval_adaptive_get(gieName.c_str(), NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );                
+                REQUIRE( dsl_gie_primary_interval_adaptive_set(NULL, true, 0, 1) == DSL_RESULT_INVALID_INPUT_PARAM );                
+                REQUIRE( dsl_gie_primary_interval_listener_add(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );                
+                REQUIRE( dsl_gie_primary_interval_listener_add(gieName.c_str(), NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );                
+                REQUIRE( dsl_gie_primary_interval_listener_remove(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );                
+                REQUIRE( dsl_gie_primary_interval_listener_remove(gieName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );                
 
                 REQUIRE( dsl_component_list_size() == 0 );
             }
@@ -0,0 +1,125 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslApi.h"
+
+SCENARIO( "The Metrics HTTP exporter can be started and stopped", "[metrics-api]" )
+{
+    GIVEN( "An available local port" ) 
+    {
+        uint port(9464);
+
+        WHEN( "The HTTP exporter is started" ) 
+        {
+            REQUIRE( dsl_metrics_http_exporter_start(port) == DSL_RESULT_SUCCESS );
+
+            THEN( "The exporter can't be started twice and can be stopped" ) 
+            {
+                REQUIRE( dsl_metrics_http_exporter_start(port) == 
+                    DSL_RESULT_METRICS_EXPORTER_START_FAILED );
+                REQUIRE( dsl_metrics_http_exporter_stop() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_metrics_http_exporter_stop() == 
+                    DSL_RESULT_METRICS_EXPORTER_STOP_FAILED );
+            }
+        }
+        WHEN( "An invalid port is used" ) 
+        {
+            THEN( "The exporter fails to start" ) 
+            {
+                REQUIRE( dsl_metrics_http_exporter_start(0) == 
+                    DSL_RESULT_METRICS_EXPORTER_START_FAILED );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Metrics file exporter can be started and stopped", "[metrics-api]" )
+{
+    GIVEN( "A file path for the metrics file" ) 
+    {
+        std::wstring filePath(L"./metrics-api-test.prom");
+
+        WHEN( "The file exporter is started" ) 
+        {
+            REQUIRE( dsl_metrics_file_exporter_start(filePath.c_str(), 5) == DSL_RESULT_SUCCESS );
+
+            THEN( "The exporter can't be started twice and can be stopped" ) 
+            {
+                REQUIRE( dsl_metrics_file_exporter_start(filePath.c_str(), 5) == 
+                    DSL_RESULT_METRICS_EXPORTER_START_FAILED );
+                REQUIRE( dsl_metrics_file_exporter_stop() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_metrics_file_exporter_stop() == 
+                    DSL_RESULT_METRICS_EXPORTER_STOP_FAILED );
+            }
+        }
+        WHEN( "An invalid interval is used" ) 
+        {
+            THEN( "The exporter fails to start" ) 
+            {
+                REQUIRE( dsl_metrics_file_exporter_start(filePath.c_str(), 0) == 
+                    DSL_RESULT_METRICS_EXPORTER_START_FAILED );
+            }
+        }
+    }
+}
+
+SCENARIO( "ODE Triggers publish their metrics on creation", "[metrics-api]" )
+{
+    GIVEN( "An empty list of ODE Triggers" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+        
+        REQUIRE( dsl_ode_trigger_list_size() == 0 );
+        uint initialSize = dsl_metrics_list_size();
+
+        WHEN( "A new ODE Trigger is created" ) 
+        {
+            REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+                NULL, 0, 0) == DSL_RESULT_SUCCESS );
+
+            THEN( "The Trigger's metrics are published until deleted" ) 
+            {
+                REQUIRE( dsl_metrics_list_size() > initialSize );
+                
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_metrics_list_size() == initialSize );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Metrics API checks for NULL input parameters", "[metrics-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_metrics_file_exporter_start(NULL, 1) == DSL_RESULT_INVALID_INPUT_PARAM );
+            }
+        }
+    }
+}
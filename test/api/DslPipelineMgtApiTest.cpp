@@ -144,3 +144,329 @@ SCENARIO( "A non-unique Pipeline name fails when creating Many Pipelines", "[Pip
         REQUIRE( dsl_pipeline_list_size() == 0 );
     }
 }
+
+SCENARIO( "A Pipeline's SGIE result cache settings can be updated", "[PipelineMgt]" )
+{
+    GIVEN( "A new Pipeline" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        boolean enabled(true);
+        uint maxAge(0);
+        float minConfidence(0);
+        
+        REQUIRE( dsl_pipeline_sgie_cache_settings_get(pipelineName.c_str(), 
+            &enabled, &maxAge, &minConfidence) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        REQUIRE( maxAge == DSL_DEFAULT_SGIE_CACHE_MAX_AGE );
+        REQUIRE( minConfidence == (float)DSL_DEFAULT_SGIE_CACHE_MIN_CONFIDENCE );
+
+        WHEN( "The SGIE result cache is enabled" ) 
+        {
+            REQUIRE( dsl_pipeline_sgie_cache_settings_set(pipelineName.c_str(), 
+                true, 10, 0.75) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct settings are returned and the stats are cleared" ) 
+            {
+                REQUIRE( dsl_pipeline_sgie_cache_settings_get(pipelineName.c_str(), 
+                    &enabled, &maxAge, &minConfidence) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                REQUIRE( maxAge == 10 );
+                REQUIRE( minConfidence == 0.75f );
+                
+                uint64_t hits(99), misses(99);
+                REQUIRE( dsl_pipeline_sgie_cache_stats_get(pipelineName.c_str(), 
+                    &hits, &misses) == DSL_RESULT_SUCCESS );
+                REQUIRE( hits == 0 );
+                REQUIRE( misses == 0 );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "An invalid min confidence is used" ) 
+        {
+            THEN( "The update fails" ) 
+            {
+                REQUIRE( dsl_pipeline_sgie_cache_settings_set(pipelineName.c_str(), 
+                    true, 10, 1.5) == DSL_RESULT_PIPELINE_SGIE_CACHE_SET_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Pipeline SGIE result cache API checks for NULL input parameters", "[PipelineMgt]" )
+{
+    GIVEN( "An empty list of Pipelines" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_pipeline_list_size() == 0 );
+
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_pipeline_sgie_cache_settings_get(NULL, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_sgie_cache_settings_get(pipelineName.c_str(), NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_sgie_cache_settings_set(NULL, true, 10, 0.5) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_sgie_cache_stats_get(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_sgie_cache_stats_get(pipelineName.c_str(), NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline's main-context setting can be updated", "[PipelineMgt]" )
+{
+    GIVEN( "A new Pipeline" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        boolean enabled(true);
+        
+        REQUIRE( dsl_pipeline_main_context_enabled_get(pipelineName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+
+        WHEN( "The Pipeline's main-context is enabled" ) 
+        {
+            REQUIRE( dsl_pipeline_main_context_enabled_set(pipelineName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+
+            // enabling a second time must succeed without creating a new thread
+            REQUIRE( dsl_pipeline_main_context_enabled_set(pipelineName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct setting is returned" ) 
+            {
+                REQUIRE( dsl_pipeline_main_context_enabled_get(pipelineName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+
+                REQUIRE( dsl_pipeline_main_context_enabled_set(pipelineName.c_str(), 
+                    false) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_main_context_enabled_get(pipelineName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The Pipeline is deleted with its main-context enabled" ) 
+        {
+            REQUIRE( dsl_pipeline_main_context_enabled_set(pipelineName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+
+            THEN( "The Pipeline and its main-context thread are deleted" ) 
+            {
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Pipeline main-context API checks for NULL input parameters", "[PipelineMgt]" )
+{
+    GIVEN( "An empty list of Pipelines" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_pipeline_list_size() == 0 );
+
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_pipeline_main_context_enabled_get(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_main_context_enabled_get(pipelineName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_main_context_enabled_set(NULL, true) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
+
+static void pipeline_qos_listener(const wchar_t* element, uint64_t processed, 
+    uint64_t dropped, int64_t jitter, double proportion, void* client_data)
+{
+}
+
+SCENARIO( "A Pipeline's QoS counters can be queried and cleared", "[PipelineMgt]" )
+{
+    GIVEN( "A new Pipeline" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        std::wstring elementName(L"test-element");
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "No QoS messages have been received" ) 
+        {
+            uint elements(99);
+            uint64_t dropped(99);
+            REQUIRE( dsl_pipeline_qos_totals_get(pipelineName.c_str(), 
+                &elements, &dropped) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The totals are zero and no element counters are found" ) 
+            {
+                REQUIRE( elements == 0 );
+                REQUIRE( dropped == 0 );
+
+                uint64_t processed(0);
+                int64_t jitter(0);
+                double proportion(0);
+                REQUIRE( dsl_pipeline_qos_element_stats_get(pipelineName.c_str(), 
+                    elementName.c_str(), &processed, &dropped, &jitter, 
+                    &proportion) == DSL_RESULT_PIPELINE_QOS_ELEMENT_NOT_FOUND );
+                REQUIRE( dsl_pipeline_qos_stats_clear(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A QoS listener is added" ) 
+        {
+            REQUIRE( dsl_pipeline_qos_listener_add(pipelineName.c_str(), 
+                pipeline_qos_listener, 10, NULL) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same listener can't be added twice and can be removed" ) 
+            {
+                REQUIRE( dsl_pipeline_qos_listener_add(pipelineName.c_str(), 
+                    pipeline_qos_listener, 10, NULL) == DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED );
+                REQUIRE( dsl_pipeline_qos_listener_remove(pipelineName.c_str(), 
+                    pipeline_qos_listener) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_qos_listener_remove(pipelineName.c_str(), 
+                    pipeline_qos_listener) == DSL_RESULT_PIPELINE_CALLBACK_REMOVE_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A QoS listener is added with a threshold of 0" ) 
+        {
+            THEN( "The add fails" ) 
+            {
+                REQUIRE( dsl_pipeline_qos_listener_add(pipelineName.c_str(), 
+                    pipeline_qos_listener, 0, NULL) == DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Pipeline QoS API checks for NULL input parameters", "[PipelineMgt]" )
+{
+    GIVEN( "An empty list of Pipelines" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        std::wstring elementName(L"test-element");
+        
+        REQUIRE( dsl_pipeline_list_size() == 0 );
+
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_pipeline_qos_element_stats_get(NULL, NULL, NULL, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_qos_element_stats_get(pipelineName.c_str(), NULL, NULL, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_qos_element_stats_get(pipelineName.c_str(), elementName.c_str(), NULL, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_qos_totals_get(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_qos_totals_get(pipelineName.c_str(), NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_qos_stats_clear(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_qos_listener_add(NULL, NULL, 1, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_qos_listener_add(pipelineName.c_str(), NULL, 1, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_qos_listener_remove(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_qos_listener_remove(pipelineName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline's thread policies can be set and removed", "[PipelineMgt]" )
+{
+    GIVEN( "A new Pipeline" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        std::wstring componentName(L"test-component");
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "A default and a component thread policy are set" ) 
+        {
+            REQUIRE( dsl_pipeline_thread_policy_set(pipelineName.c_str(), NULL, 
+                0x1, DSL_THREAD_SCHED_OTHER, 0) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_thread_policy_set(pipelineName.c_str(), 
+                componentName.c_str(), 0x1, DSL_THREAD_SCHED_FIFO, 10) == DSL_RESULT_SUCCESS );
+
+            THEN( "The policies can be removed once only" ) 
+            {
+                const wchar_t* report(NULL);
+                REQUIRE( dsl_pipeline_thread_report_get(pipelineName.c_str(), 
+                    &report) == DSL_RESULT_SUCCESS );
+                REQUIRE( report != NULL );
+                
+                // No streaming threads until the Pipeline is playing
+                REQUIRE( std::wstring(report) == L"" );
+                
+                REQUIRE( dsl_pipeline_thread_policy_remove(pipelineName.c_str(), 
+                    componentName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_thread_policy_remove(pipelineName.c_str(), 
+                    componentName.c_str()) == DSL_RESULT_PIPELINE_THREAD_POLICY_REMOVE_FAILED );
+                REQUIRE( dsl_pipeline_thread_policy_remove(pipelineName.c_str(), 
+                    NULL) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A thread policy with an invalid priority or policy is set" ) 
+        {
+            THEN( "The set fails" ) 
+            {
+                REQUIRE( dsl_pipeline_thread_policy_set(pipelineName.c_str(), NULL, 
+                    0x1, DSL_THREAD_SCHED_OTHER, 20) == DSL_RESULT_PIPELINE_THREAD_POLICY_SET_FAILED );
+                REQUIRE( dsl_pipeline_thread_policy_set(pipelineName.c_str(), NULL, 
+                    0x1, DSL_THREAD_SCHED_FIFO, 0) == DSL_RESULT_PIPELINE_THREAD_POLICY_SET_FAILED );
+                REQUIRE( dsl_pipeline_thread_policy_set(pipelineName.c_str(), NULL, 
+                    0x1, 2, 0) == DSL_RESULT_PIPELINE_THREAD_POLICY_SET_FAILED );
+                REQUIRE( dsl_pipeline_thread_policy_remove(pipelineName.c_str(), 
+                    NULL) == DSL_RESULT_PIPELINE_THREAD_POLICY_REMOVE_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Pipeline thread policy API checks for NULL input parameters", "[PipelineMgt]" )
+{
+    GIVEN( "An empty list of Pipelines" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_pipeline_list_size() == 0 );
+
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_pipeline_thread_policy_set(NULL, NULL, 0, DSL_THREAD_SCHED_OTHER, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_thread_policy_remove(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_thread_report_get(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_thread_report_get(pipelineName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -85,6 +85,261 @@ SCENARIO( "A new Pipeline with a URI File Source, FakeSink, and Tiled Display ca
     }
 }
 
+SCENARIO( "A new Pipeline with four Test Sources, FakeSink, and Tiled Display can play", "[pipeline-play]" )
+{
+    GIVEN( "A Pipeline, four Test sources, Fake Sink, and Tiled Display" ) 
+    {
+        std::wstring tilerName(L"tiler");
+        uint width(1280);
+        uint height(720);
+
+        std::wstring fakeSinkName(L"fake-sink");
+
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_test_new(L"test-source-1", false, DSL_TEST_PATTERN_SMPTE,
+            width, height, 30, 1, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_test_new(L"test-source-2", false, DSL_TEST_PATTERN_BALL,
+            width, height, 30, 1, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_test_new(L"test-source-3", false, DSL_TEST_PATTERN_SNOW,
+            width, height, 30, 1, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_test_new(L"test-source-4", false, DSL_TEST_PATTERN_CIRCULAR,
+            width, height, 30, 1, 0) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"test-source-1", L"test-source-2", 
+            L"test-source-3", L"test-source-4", L"tiler", L"fake-sink", NULL};
+        
+        WHEN( "When the Pipeline is Assembled" ) 
+        {
+            REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+
+            THEN( "Pipeline is Able to LinkAll and Play" )
+            {
+                REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                uint currentState(DSL_STATE_NULL);
+                REQUIRE( dsl_pipeline_state_get(pipelineName.c_str(), &currentState) == DSL_RESULT_SUCCESS );
+                REQUIRE( currentState == DSL_STATE_PLAYING );
+                
+                std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+static uint appSourceReleaseCount(0);
+
+static void app_source_buffer_release(void* data, void* client_data)
+{
+    appSourceReleaseCount++;
+}
+
+SCENARIO( "A new Pipeline with an App Source, FakeSink, and Tiled Display can play", "[pipeline-play]" )
+{
+    GIVEN( "A Pipeline, App source, Fake Sink, and Tiled Display" ) 
+    {
+        std::wstring sourceName(L"app-source");
+        std::wstring tilerName(L"tiler");
+        uint width(1280);
+        uint height(720);
+        static uint8_t frame[1280*720*3/2] = {0};
+        uint64_t duration(GST_SECOND/30);
+        appSourceReleaseCount = 0;
+
+        std::wstring fakeSinkName(L"fake-sink");
+
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_app_new(sourceName.c_str(), false, DSL_VIDEO_FORMAT_I420,
+            width, height, 30, 1) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"app-source", L"tiler", L"fake-sink", NULL};
+        
+        WHEN( "When the Pipeline is Assembled" ) 
+        {
+            REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+
+            THEN( "Pipeline is Able to LinkAll and Play with both copied and wrapped frames" )
+            {
+                REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                uint currentState(DSL_STATE_NULL);
+                REQUIRE( dsl_pipeline_state_get(pipelineName.c_str(), &currentState) == DSL_RESULT_SUCCESS );
+                REQUIRE( currentState == DSL_STATE_PLAYING );
+                
+                for (uint i = 0; i < 30; i++)
+                {
+                    REQUIRE( dsl_source_app_buffer_push(sourceName.c_str(), frame, sizeof(frame),
+                        i*duration, duration, NULL, NULL) == DSL_RESULT_SUCCESS );
+                }
+                for (uint i = 30; i < 60; i++)
+                {
+                    REQUIRE( dsl_source_app_buffer_push(sourceName.c_str(), frame, sizeof(frame),
+                        i*duration, duration, app_source_buffer_release, NULL) == DSL_RESULT_SUCCESS );
+                }
+                REQUIRE( dsl_source_app_eos(sourceName.c_str()) == DSL_RESULT_SUCCESS );
+                
+                std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( appSourceReleaseCount == 30 );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+static uint appSourceNeedDataPushCount(0);
+
+static void app_source_need_data_push(uint length, void* client_data)
+{
+    static uint8_t frame[1280*720*3/2] = {0};
+    
+    // push from the appsrc streaming thread, the return value is ignored as
+    // pushes made while the Pipeline is stopping are expected to fail
+    dsl_source_app_buffer_push((const wchar_t*)client_data, frame, sizeof(frame),
+        DSL_APP_SOURCE_TIMESTAMP_NONE, DSL_APP_SOURCE_TIMESTAMP_NONE, NULL, NULL);
+    appSourceNeedDataPushCount++;
+}
+
+static void app_source_enough_data(void* client_data)
+{
+}
+
+SCENARIO( "A Pipeline with an App Source pushing from its need-data handler can be stopped", "[pipeline-play]" )
+{
+    GIVEN( "A Pipeline, App source with need-data handler, Fake Sink, and Tiled Display" ) 
+    {
+        std::wstring sourceName(L"app-source");
+        std::wstring tilerName(L"tiler");
+        uint width(1280);
+        uint height(720);
+        appSourceNeedDataPushCount = 0;
+
+        std::wstring fakeSinkName(L"fake-sink");
+
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_app_new(sourceName.c_str(), true, DSL_VIDEO_FORMAT_I420,
+            width, height, 30, 1) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_app_data_handlers_add(sourceName.c_str(), 
+            app_source_need_data_push, app_source_enough_data, (void*)sourceName.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"app-source", L"tiler", L"fake-sink", NULL};
+        
+        WHEN( "When the Pipeline is Assembled and playing" ) 
+        {
+            REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+
+            THEN( "The Pipeline can be stopped while the need-data handler is pushing" )
+            {
+                REQUIRE( appSourceNeedDataPushCount > 0 );
+                
+                // would deadlock if the push held the services mutex
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new Pipeline with a Playlist Source, FakeSink, and Tiled Display can play", "[pipeline-play]" )
+{
+    GIVEN( "A Pipeline, Playlist source, Fake Sink, and Tiled Display" ) 
+    {
+        std::wstring sourceName1(L"playlist-source");
+        const wchar_t* files[] = {L"./test/streams/sample_1080p_h264.mp4", 
+            L"./test/streams/sample_1080p_h264.mp4", NULL};
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0); 
+
+        std::wstring tilerName(L"tiler");
+        uint width(1280);
+        uint height(720);
+
+        std::wstring fakeSinkName(L"fake-sink");
+
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_playlist_new(sourceName1.c_str(), files, true,
+            cudadecMemType, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"playlist-source", L"tiler", L"fake-sink", NULL};
+        
+        WHEN( "When the Pipeline is Assembled" ) 
+        {
+            REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+
+            THEN( "Pipeline is Able to LinkAll and Play" )
+            {
+                REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                uint currentState(DSL_STATE_NULL);
+                REQUIRE( dsl_pipeline_state_get(pipelineName.c_str(), &currentState) == DSL_RESULT_SUCCESS );
+                REQUIRE( currentState == DSL_STATE_PLAYING );
+                
+                std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new Pipeline with a URI File Source, GIE, FakeSink, and Tiled Display can play", "[pipeline-play]" )
 {
     GIVEN( "A Pipeline, URI source, Fake Sink, and Tiled Display" ) 
@@ -1422,6 +1677,167 @@ SCENARIO( "A new Pipeline with a URI File Source, Splitter, OSD, and two Overlay
 }
 
 
+SCENARIO( "Branches can be added to and removed from a playing Splitter repeatedly", "[pipeline-stress]" )
+{
+    GIVEN( "A Pipeline, Test source, and Splitter with a Fake Sink branch" ) 
+    {
+        std::wstring sourceName(L"test-source");
+        std::wstring splitterName(L"splitter");
+        std::wstring branchName(L"toggle-branch");
+        std::wstring fakeSinkName1(L"fake-sink1");
+        std::wstring fakeSinkName2(L"fake-sink2");
+        std::wstring fakeSinkName3(L"fake-sink3");
+        std::wstring pipelineName(L"test-pipeline");
+        uint toggleCount(300);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_test_new(sourceName.c_str(), false, DSL_TEST_PATTERN_BALL,
+            1280, 720, 30, 1, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tee_splitter_new(splitterName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_branch_new(branchName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName1.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName2.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName3.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_branch_component_add(branchName.c_str(), 
+            fakeSinkName2.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tee_branch_add(splitterName.c_str(), 
+            fakeSinkName1.c_str()) == DSL_RESULT_SUCCESS );
+
+        const wchar_t* components[] = {L"test-source", L"splitter", NULL};
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), 
+            components) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Pipeline is playing" ) 
+        {
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+
+            THEN( "A Branch and a Sink can be attached and detached hundreds of times" )
+            {
+                for (uint i = 0; i < toggleCount; i++)
+                {
+                    REQUIRE( dsl_tee_branch_add(splitterName.c_str(), 
+                        branchName.c_str()) == DSL_RESULT_SUCCESS );
+                    REQUIRE( dsl_tee_branch_add(splitterName.c_str(), 
+                        fakeSinkName3.c_str()) == DSL_RESULT_SUCCESS );
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    REQUIRE( dsl_tee_branch_remove(splitterName.c_str(), 
+                        branchName.c_str()) == DSL_RESULT_SUCCESS );
+                    REQUIRE( dsl_tee_branch_remove(splitterName.c_str(), 
+                        fakeSinkName3.c_str()) == DSL_RESULT_SUCCESS );
+                }
+                uint currentState(DSL_STATE_NULL);
+                REQUIRE( dsl_pipeline_state_get(pipelineName.c_str(), 
+                    &currentState) == DSL_RESULT_SUCCESS );
+                REQUIRE( currentState == DSL_STATE_PLAYING );
+
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+static std::atomic<int> demuxerBranchSourceId(-1);
+
+static boolean demuxer_branch_source_id_handler(void* buffer, void* client_data)
+{
+    NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta((GstBuffer*)buffer);
+    if (pBatchMeta and pBatchMeta->frame_meta_list)
+    {
+        demuxerBranchSourceId = 
+            ((NvDsFrameMeta*)(pBatchMeta->frame_meta_list->data))->source_id;
+    }
+    return true;
+}
+
+SCENARIO( "A Branch re-added to a playing Demuxer receives the stream it was removed from", "[pipeline-stress]" )
+{
+    GIVEN( "A Pipeline, two Test sources, and Demuxer with two Fake Sink branches" ) 
+    {
+        std::wstring sourceName1(L"test-source-1");
+        std::wstring sourceName2(L"test-source-2");
+        std::wstring demuxerName(L"demuxer");
+        std::wstring fakeSinkName1(L"fake-sink1");
+        std::wstring fakeSinkName2(L"fake-sink2");
+        std::wstring customPphName(L"source-id-pph");
+        std::wstring pipelineName(L"test-pipeline");
+        uint toggleCount(30);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_test_new(sourceName1.c_str(), true, DSL_TEST_PATTERN_BALL,
+            1280, 720, 30, 1, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_test_new(sourceName2.c_str(), true, DSL_TEST_PATTERN_BALL,
+            1280, 720, 30, 1, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tee_demuxer_new(demuxerName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName1.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName2.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_pph_custom_new(customPphName.c_str(), 
+            demuxer_branch_source_id_handler, NULL) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_pph_add(fakeSinkName1.c_str(), 
+            customPphName.c_str()) == DSL_RESULT_SUCCESS );
+
+        // Branches are linked in name order, fake-sink1 to stream 0 and fake-sink2 to stream 1
+        REQUIRE( dsl_tee_branch_add(demuxerName.c_str(), 
+            fakeSinkName1.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tee_branch_add(demuxerName.c_str(), 
+            fakeSinkName2.c_str()) == DSL_RESULT_SUCCESS );
+
+        const wchar_t* components[] = {L"test-source-1", L"test-source-2", L"demuxer", NULL};
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), 
+            components) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Pipeline is playing" ) 
+        {
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+            REQUIRE( demuxerBranchSourceId == 0 );
+
+            THEN( "The first Branch always receives stream 0 when re-added" )
+            {
+                for (uint i = 0; i < toggleCount; i++)
+                {
+                    REQUIRE( dsl_tee_branch_remove(demuxerName.c_str(), 
+                        fakeSinkName1.c_str()) == DSL_RESULT_SUCCESS );
+                    demuxerBranchSourceId = -1;
+                    REQUIRE( dsl_tee_branch_add(demuxerName.c_str(), 
+                        fakeSinkName1.c_str()) == DSL_RESULT_SUCCESS );
+                    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                    REQUIRE( demuxerBranchSourceId == 0 );
+                }
+                // No stream is left for a third Branch
+                std::wstring fakeSinkName3(L"fake-sink3");
+                REQUIRE( dsl_sink_fake_new(fakeSinkName3.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_tee_branch_add(demuxerName.c_str(), 
+                    fakeSinkName3.c_str()) == DSL_RESULT_TEE_BRANCH_ADD_FAILED );
+
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 //SCENARIO( "A new Pipeline with a URI File Source, Tiled Display, and DSL_CODEC_H264 FileSink can play", "[pipeline-play]" )
 //{
 //    GIVEN( "A Pipeline, URI source, Overlay Sink, and Tiled Display" ) 
@@ -1608,3 +2024,401 @@ SCENARIO( "A new Pipeline with a URI File Source, Tiled Display, and Meter PPH c
     }
 }
 
+
+/**
+ * @brief local RTSP Server stand-in for an RTSP camera, serving a live 
+ * H.264 test-pattern on rtsp://127.0.0.1:8564/test
+ */
+static GstRTSPServer* rtsp_test_server_new()
+{
+    GstRTSPServer* pServer = gst_rtsp_server_new();
+    g_object_set(pServer, "service", "8564", NULL);
+    
+    GstRTSPMediaFactory* pFactory = gst_rtsp_media_factory_new();
+    gst_rtsp_media_factory_set_launch(pFactory, 
+        "( videotestsrc is-live=true ! video/x-raw,width=320,height=240,framerate=15/1 ! "
+        "x264enc tune=zerolatency key-int-max=15 ! rtph264pay name=pay0 pt=96 )");
+    gst_rtsp_media_factory_set_shared(pFactory, true);
+    
+    GstRTSPMountPoints* pMounts = gst_rtsp_server_get_mount_points(pServer);
+    gst_rtsp_mount_points_add_factory(pMounts, "/test", pFactory);
+    g_object_unref(pMounts);
+    
+    return pServer;
+}
+
+static GstRTSPFilterResult rtsp_test_server_client_remove_cb(GstRTSPServer* pServer, 
+    GstRTSPClient* pClient, gpointer user_data)
+{
+    return GST_RTSP_FILTER_REMOVE;
+}
+
+static void rtsp_connection_state_listener_cb(uint prev_state, uint curr_state, void* user_data)
+{
+    if (curr_state == DSL_RTSP_CONNECTION_STATE_RECONNECTING)
+    {
+        (*(uint*)user_data)++;
+    }
+}
+
+static bool rtsp_source_wait_for_state(const wchar_t* name, uint state, uint timeoutInSec)
+{
+    uint currState(DSL_RTSP_CONNECTION_STATE_IDLE), reconnectCount(0);
+    const wchar_t* lastError;
+    
+    for (uint i = 0; i < timeoutInSec*10; i++)
+    {
+        dsl_source_rtsp_connection_data_get(name, &currState, &reconnectCount, &lastError);
+        if (currState == state)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return false;
+}
+
+SCENARIO( "A Pipeline with an RTSP Source reconnects after the stream is lost", "[pipeline-play]" )
+{
+    GIVEN( "A local RTSP Server and a Pipeline with RTSP Source, FakeSink, and Tiled Display" ) 
+    {
+        std::wstring sourceName(L"rtsp-source");
+        std::wstring uri(L"rtsp://127.0.0.1:8564/test");
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+        uint latency(100);
+
+        std::wstring tilerName(L"tiler");
+        uint width(1280);
+        uint height(720);
+
+        std::wstring fakeSinkName(L"fake-sink");
+
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        // The server attaches to the default main-context run by dsl_main_loop_run
+        GstRTSPServer* pServer = rtsp_test_server_new();
+        uint serverId = gst_rtsp_server_attach(pServer, NULL);
+        REQUIRE( serverId != 0 );
+        std::thread mainLoopThread(dsl_main_loop_run);
+
+        REQUIRE( dsl_source_rtsp_new(sourceName.c_str(), uri.c_str(), DSL_RTP_TCP, 
+            cudadecMemType, intrDecode, dropFrameInterval, latency) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_rtsp_timeout_set(sourceName.c_str(), 2) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_rtsp_reconnection_params_set(sourceName.c_str(), 1, 4) == DSL_RESULT_SUCCESS );
+
+        uint reconnectingCount(0);
+        REQUIRE( dsl_source_rtsp_state_change_listener_add(sourceName.c_str(), 
+            rtsp_connection_state_listener_cb, &reconnectingCount) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"rtsp-source", L"tiler", L"fake-sink", NULL};
+        
+        REQUIRE( dsl_pipeline_new_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The RTSP Server drops all clients once the Source is connected" ) 
+        {
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( rtsp_source_wait_for_state(sourceName.c_str(), 
+                DSL_RTSP_CONNECTION_STATE_CONNECTED, 10) == true );
+            
+            gst_rtsp_server_client_filter(pServer, rtsp_test_server_client_remove_cb, NULL);
+
+            THEN( "The Source reconnects while the Pipeline continues to play" )
+            {
+                REQUIRE( rtsp_source_wait_for_state(sourceName.c_str(), 
+                    DSL_RTSP_CONNECTION_STATE_RECONNECTING, 10) == true );
+                REQUIRE( rtsp_source_wait_for_state(sourceName.c_str(), 
+                    DSL_RTSP_CONNECTION_STATE_CONNECTED, 20) == true );
+                    
+                uint currentState(DSL_STATE_NULL);
+                REQUIRE( dsl_pipeline_state_get(pipelineName.c_str(), &currentState) == DSL_RESULT_SUCCESS );
+                REQUIRE( currentState == DSL_STATE_PLAYING );
+
+                uint state(0), reconnectCount(0);
+                const wchar_t* lastError;
+                REQUIRE( dsl_source_rtsp_connection_data_get(sourceName.c_str(), 
+                    &state, &reconnectCount, &lastError) == DSL_RESULT_SUCCESS );
+                REQUIRE( reconnectCount >= 1 );
+                REQUIRE( reconnectingCount >= 1 );
+
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                dsl_main_loop_quit();
+                mainLoopThread.join();
+                g_source_remove(serverId);
+                g_object_unref(pServer);
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+static std::atomic<bool> listenerEntered(false);
+static std::atomic<bool> listenerExited(false);
+
+static void services_calling_state_change_listener(uint prev_state, 
+    uint curr_state, void* client_data)
+{
+    if (curr_state != DSL_STATE_PLAYING or listenerEntered)
+    {
+        return;
+    }
+    listenerEntered = true;
+    
+    // hold the main-context thread while the client deletes the Pipeline
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    
+    // takes the services mutex - must not deadlock with the delete
+    dsl_pipeline_list_size();
+    
+    listenerExited = true;
+}
+
+SCENARIO( "A Pipeline with its main-context enabled can be deleted while a listener calls a service", "[pipeline-play]" )
+{
+    GIVEN( "A Pipeline, URI source, and Fake Sink with its main-context enabled" ) 
+    {
+        std::wstring sourceName1(L"uri-source");
+        std::wstring uri(L"./test/streams/sample_1080p_h264.mp4");
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0); 
+
+        std::wstring fakeSinkName(L"fake-sink");
+
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(sourceName1.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"uri-source", L"fake-sink", NULL};
+        
+        WHEN( "The Pipeline is deleted while the listener is running" ) 
+        {
+            listenerEntered = false;
+            listenerExited = false;
+            
+            REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_main_context_enabled_set(pipelineName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_state_change_listener_add(pipelineName.c_str(),
+                services_calling_state_change_listener, NULL) == DSL_RESULT_SUCCESS );
+        
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), 
+                components) == DSL_RESULT_SUCCESS );
+
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            
+            for (uint i = 0; i < 100 and !listenerEntered; i++)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            REQUIRE( listenerEntered == true );
+
+            THEN( "The delete returns once the listener has completed" )
+            {
+                REQUIRE( dsl_pipeline_delete(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( listenerExited == true );
+                
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline with an RTSP Source can play, stop, and play again", "[pipeline-play]" )
+{
+    GIVEN( "A server Pipeline with an RTSP Sink and a client Pipeline with an RTSP Source" ) 
+    {
+        std::wstring uriSourceName(L"uri-source");
+        std::wstring uri(L"./test/streams/sample_1080p_h264.mp4");
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        std::wstring tilerName(L"tiler");
+        uint width(1280);
+        uint height(720);
+
+        std::wstring rtspSinkName(L"rtsp-sink");
+        std::wstring host(L"224.224.255.255");
+        uint udpPort(5400);
+        uint rtspPort(8554);
+        uint codec(DSL_CODEC_H264);
+        uint bitrate(4000000);
+        uint interval(0);
+
+        std::wstring rtspSourceName(L"rtsp-source");
+        std::wstring rtspUri(L"rtsp://127.0.0.1:8554/rtsp-sink");
+        uint latency(100);
+
+        std::wstring fakeSinkName(L"fake-sink");
+
+        std::wstring serverPipelineName(L"server-pipeline");
+        std::wstring clientPipelineName(L"client-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(uriSourceName.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_rtsp_new(rtspSinkName.c_str(), host.c_str(),
+            udpPort, rtspPort, codec, bitrate, interval) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_source_rtsp_new(rtspSourceName.c_str(), rtspUri.c_str(), 
+            DSL_RTP_ALL, cudadecMemType, intrDecode, dropFrameInterval, 
+            latency) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* serverComponents[] = {L"uri-source", L"tiler", L"rtsp-sink", NULL};
+        const wchar_t* clientComponents[] = {L"rtsp-source", L"fake-sink", NULL};
+        
+        WHEN( "When both Pipelines are Assembled and the server is playing" ) 
+        {
+            REQUIRE( dsl_pipeline_new(serverPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_component_add_many(serverPipelineName.c_str(), 
+                serverComponents) == DSL_RESULT_SUCCESS );
+
+            REQUIRE( dsl_pipeline_new(clientPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_component_add_many(clientPipelineName.c_str(), 
+                clientComponents) == DSL_RESULT_SUCCESS );
+
+            REQUIRE( dsl_pipeline_play(serverPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+
+            THEN( "The client Pipeline relinks its RTSP Source when played a second time" )
+            {
+                uint currentState(DSL_STATE_NULL);
+
+                REQUIRE( dsl_pipeline_play(clientPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+                REQUIRE( dsl_pipeline_stop(clientPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_play(clientPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+                REQUIRE( dsl_pipeline_state_get(clientPipelineName.c_str(), 
+                    &currentState) == DSL_RESULT_SUCCESS );
+                REQUIRE( currentState == DSL_STATE_PLAYING );
+                REQUIRE( dsl_pipeline_stop(clientPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                
+                REQUIRE( dsl_pipeline_stop(serverPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+static std::atomic<uint> hiddenSourceObjects(0);
+
+static boolean hidden_source_object_counter_cb(void* buffer, void* client_data)
+{
+    NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta((GstBuffer*)buffer);
+    
+    for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+        pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+    {
+        NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+        
+        // source-id 1 is hidden while the Tiler shows source-id 0
+        if (pFrameMeta->source_id == 1)
+        {
+            hiddenSourceObjects += pFrameMeta->num_obj_meta;
+        }
+    }
+    return true;
+}
+
+SCENARIO( "A Tiler with frame-pruning enabled passes the object meta of hidden sources downstream", "[pipeline-play]" )
+{
+    GIVEN( "A Pipeline, two URI sources, Primary GIE, Tiler with frame-pruning, and Fake Sink" ) 
+    {
+        std::wstring sourceName1(L"uri-source-1");
+        std::wstring sourceName2(L"uri-source-2");
+        std::wstring uri(L"./test/streams/sample_1080p_h264.mp4");
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0); 
+
+        std::wstring primaryGieName(L"primary-gie");
+        std::wstring inferConfigFile(L"./test/configs/config_infer_primary_nano.txt");
+        std::wstring modelEngineFile(L"./test/models/Primary_Detector_Nano/resnet10.caffemodel_b8_gpu0_fp16.engine");
+
+        std::wstring tilerName(L"tiler");
+        uint width(1280);
+        uint height(720);
+
+        std::wstring customPphName(L"custom-pph");
+        std::wstring fakeSinkName(L"fake-sink");
+
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(sourceName1.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_uri_new(sourceName2.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_gie_primary_new(primaryGieName.c_str(), inferConfigFile.c_str(), 
+            modelEngineFile.c_str(), 0) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_frame_pruning_enabled_set(tilerName.c_str(), 
+            true) == DSL_RESULT_SUCCESS );
+            
+        REQUIRE( dsl_pph_custom_new(customPphName.c_str(), 
+            hidden_source_object_counter_cb, NULL) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_pph_add(tilerName.c_str(), customPphName.c_str(), 
+            DSL_PAD_SRC) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"uri-source-1", L"uri-source-2", 
+            L"primary-gie", L"tiler", L"fake-sink", NULL};
+        
+        WHEN( "The Pipeline is playing with the first source shown" ) 
+        {
+            hiddenSourceObjects = 0;
+            
+            REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_tiler_source_show_set(tilerName.c_str(), 
+                sourceName1.c_str(), 0, true) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+
+            THEN( "The hidden source's object meta reaches the Tiler's src pad-probe-handler" )
+            {
+                REQUIRE( hiddenSourceObjects > 0 );
+                
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -330,3 +330,124 @@ SCENARIO( "A single Source of a multi-source Pipeline can Pause and Resume", "[P
         }
     }
 }
+
+SCENARIO( "A Live Source can be added to and removed from a Pipeline's standby pool", "[PipelineSources]" )
+{
+    GIVEN( "A Pipeline and an RTSP Source" ) 
+    {
+        std::wstring sourceName = L"rtsp-source";
+        std::wstring uri = L"rtsp://127.0.0.1:8554/test";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+        uint latency(100);
+
+        std::wstring pipelineName  = L"test-pipeline";
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_rtsp_new(sourceName.c_str(), uri.c_str(), DSL_RTP_ALL, 
+            cudadecMemType, intrDecode, dropFrameInterval, latency) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Source is added to the Pipeline's standby pool" ) 
+        {
+            REQUIRE( dsl_pipeline_source_standby_add(pipelineName.c_str(), 
+                sourceName.c_str()) == DSL_RESULT_SUCCESS );
+
+            THEN( "The Source is in-use and can be attached and detached" )
+            {
+                REQUIRE( dsl_source_num_in_use_get() == 1 );
+                
+                // second add must fail
+                REQUIRE( dsl_pipeline_source_standby_add(pipelineName.c_str(), 
+                    sourceName.c_str()) == DSL_RESULT_COMPONENT_IN_USE );
+
+                // detach before attach must fail
+                REQUIRE( dsl_pipeline_source_standby_detach(pipelineName.c_str(), 
+                    sourceName.c_str()) == DSL_RESULT_PIPELINE_SOURCE_DETACH_FAILED );
+                
+                REQUIRE( dsl_pipeline_source_standby_attach(pipelineName.c_str(), 
+                    sourceName.c_str()) == DSL_RESULT_SUCCESS );
+
+                // second attach and remove while attached must fail
+                REQUIRE( dsl_pipeline_source_standby_attach(pipelineName.c_str(), 
+                    sourceName.c_str()) == DSL_RESULT_PIPELINE_SOURCE_ATTACH_FAILED );
+                REQUIRE( dsl_pipeline_source_standby_remove(pipelineName.c_str(), 
+                    sourceName.c_str()) == DSL_RESULT_PIPELINE_COMPONENT_REMOVE_FAILED );
+
+                REQUIRE( dsl_pipeline_source_standby_detach(pipelineName.c_str(), 
+                    sourceName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_source_standby_remove(pipelineName.c_str(), 
+                    sourceName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_num_in_use_get() == 0 );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A non-live Source can not be added to a Pipeline's standby pool", "[PipelineSources]" )
+{
+    GIVEN( "A Pipeline and a URI Source" ) 
+    {
+        std::wstring sourceName = L"uri-source";
+        std::wstring uri = L"./test/streams/sample_1080p_h264.mp4";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        std::wstring pipelineName  = L"test-pipeline";
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(sourceName.c_str(), uri.c_str(), cudadecMemType, 
+            intrDecode, false, dropFrameInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Source is added to the Pipeline's standby pool" ) 
+        {
+            uint retval = dsl_pipeline_source_standby_add(pipelineName.c_str(), 
+                sourceName.c_str());
+
+            THEN( "The add fails and the Source remains not-in-use" )
+            {
+                REQUIRE( retval == DSL_RESULT_PIPELINE_COMPONENT_ADD_FAILED );
+                REQUIRE( dsl_source_num_in_use_get() == 0 );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Pipeline Source standby API checks for NULL input parameters", "[PipelineSources]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring pipelineName  = L"test-pipeline";
+        std::wstring sourceName = L"rtsp-source";
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_pipeline_source_standby_add(NULL, sourceName.c_str()) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_source_standby_add(pipelineName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_source_standby_remove(NULL, sourceName.c_str()) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_source_standby_remove(pipelineName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_source_standby_attach(NULL, sourceName.c_str()) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_source_standby_attach(pipelineName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_source_standby_detach(NULL, sourceName.c_str()) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pipeline_source_standby_detach(pipelineName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -109,4 +109,259 @@ SCENARIO( "The Batch Size for a Pipeline with multiple-sources can be updated",
             }
         }
     }
-}
\ No newline at end of file
+}
+
+SCENARIO( "The Adaptive Batch Timeout for a Pipeline can be enabled", "[pipeline-streammux]" )
+{
+    GIVEN( "A Pipeline with three sources and minimal components" ) 
+    {
+        std::wstring sourceName1 = L"test-uri-source-1";
+        std::wstring sourceName2 = L"test-uri-source-2";
+        std::wstring sourceName3 = L"test-uri-source-3";
+        std::wstring uri = L"./test/streams/sample_1080p_h264.mp4";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        std::wstring tilerName = L"tiler";
+        uint width(1280);
+        uint height(720);
+
+        std::wstring fakeSinkName = L"fake-sink";
+        std::wstring pipelineName  = L"test-pipeline";
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(sourceName1.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_uri_new(sourceName2.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_uri_new(sourceName3.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+            
+        const wchar_t* components[] = {L"test-uri-source-1", L"test-uri-source-2", L"test-uri-source-3", 
+            L"tiler", L"fake-sink", NULL};
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        boolean enabled(true);
+        uint jitterMargin(0);
+        
+        REQUIRE( dsl_pipeline_streammux_batch_timeout_adaptive_get(pipelineName.c_str(), 
+            &enabled, &jitterMargin) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        REQUIRE( jitterMargin == DSL_DEFAULT_STREAMMUX_ADAPTIVE_JITTER_MARGIN );
+        
+        WHEN( "The Pipeline's Adaptive Batch Timeout is enabled" ) 
+        {
+            uint newJitterMargin(10000);
+            REQUIRE( dsl_pipeline_streammux_batch_timeout_adaptive_set(pipelineName.c_str(), 
+                true, newJitterMargin) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_streammux_batch_timeout_adaptive_get(pipelineName.c_str(), 
+                &enabled, &jitterMargin) == DSL_RESULT_SUCCESS );
+            REQUIRE( enabled == true );
+            REQUIRE( jitterMargin == newJitterMargin );
+        
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+            THEN( "The settings can't be updated while playing and the batch stats are available" )
+            {
+                REQUIRE( dsl_pipeline_streammux_batch_timeout_adaptive_set(pipelineName.c_str(), 
+                    false, newJitterMargin) == DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED );
+                
+                std::this_thread::sleep_for(std::chrono::milliseconds(
+                    DSL_DEFAULT_STREAMMUX_ADAPTIVE_UPDATE_INTERVAL*3));
+                
+                uint batchTimeout(0);
+                double fillRatio(0);
+                REQUIRE( dsl_pipeline_streammux_batch_stats_get(pipelineName.c_str(), 
+                    &batchTimeout, &fillRatio) == DSL_RESULT_SUCCESS );
+                REQUIRE( batchTimeout <= DSL_DEFAULT_STREAMMUX_BATCH_TIMEOUT );
+                REQUIRE( fillRatio <= 1.0 );
+                
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Adaptive Batch Size for a Pipeline follows the number of Sources", "[pipeline-streammux]" )
+{
+    GIVEN( "A Pipeline with two sources and minimal components" ) 
+    {
+        std::wstring sourceName1 = L"test-uri-source-1";
+        std::wstring sourceName2 = L"test-uri-source-2";
+        std::wstring sourceName3 = L"test-uri-source-3";
+        std::wstring uri = L"./test/streams/sample_1080p_h264.mp4";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        std::wstring tilerName = L"tiler";
+        uint width(1280);
+        uint height(720);
+
+        std::wstring fakeSinkName = L"fake-sink";
+        std::wstring pipelineName  = L"test-pipeline";
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(sourceName1.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_uri_new(sourceName2.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_uri_new(sourceName3.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+            
+        const wchar_t* components[] = {L"test-uri-source-1", L"test-uri-source-2", 
+            L"tiler", L"fake-sink", NULL};
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        boolean enabled(true);
+        uint hysteresis(0);
+        
+        REQUIRE( dsl_pipeline_streammux_batch_size_adaptive_get(pipelineName.c_str(), 
+            &enabled, &hysteresis) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        REQUIRE( hysteresis == DSL_DEFAULT_STREAMMUX_ADAPTIVE_BATCH_SIZE_HYSTERESIS );
+        
+        REQUIRE( dsl_pipeline_streammux_batch_size_adaptive_set(pipelineName.c_str(), 
+            true, 0) == DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED );
+        REQUIRE( dsl_pipeline_streammux_batch_size_adaptive_set(pipelineName.c_str(), 
+            true, 2) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+        
+        WHEN( "Sources are added and removed while playing" ) 
+        {
+            uint batchSize(0), batchTimeout(0);
+
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+            
+            dsl_pipeline_streammux_batch_properties_get(pipelineName.c_str(), &batchSize, &batchTimeout);
+            REQUIRE( batchSize == 2 );
+
+            REQUIRE( dsl_pipeline_component_add(pipelineName.c_str(), 
+                sourceName3.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+                
+            THEN( "The batch size grows immediately and shrinks with hysteresis" )
+            {
+                dsl_pipeline_streammux_batch_properties_get(pipelineName.c_str(), &batchSize, &batchTimeout);
+                REQUIRE( batchSize == 3 );
+                
+                REQUIRE( dsl_pipeline_component_remove(pipelineName.c_str(), 
+                    sourceName3.c_str()) == DSL_RESULT_SUCCESS );
+                dsl_pipeline_streammux_batch_properties_get(pipelineName.c_str(), &batchSize, &batchTimeout);
+                REQUIRE( batchSize == 3 );
+
+                REQUIRE( dsl_pipeline_component_remove(pipelineName.c_str(), 
+                    sourceName2.c_str()) == DSL_RESULT_SUCCESS );
+                dsl_pipeline_streammux_batch_properties_get(pipelineName.c_str(), &batchSize, &batchTimeout);
+                REQUIRE( batchSize == 1 );
+                
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Demuxer branch can be added for a Source added past the initial Adaptive Batch Size", "[pipeline-streammux]" )
+{
+    GIVEN( "A Pipeline with two sources and a Demuxer with two branches" ) 
+    {
+        std::wstring sourceName1 = L"test-uri-source-1";
+        std::wstring sourceName2 = L"test-uri-source-2";
+        std::wstring sourceName3 = L"test-uri-source-3";
+        std::wstring uri = L"./test/streams/sample_1080p_h264.mp4";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        std::wstring demuxerName = L"demuxer";
+        std::wstring fakeSinkName1 = L"fake-sink-1";
+        std::wstring fakeSinkName2 = L"fake-sink-2";
+        std::wstring fakeSinkName3 = L"fake-sink-3";
+        std::wstring pipelineName  = L"test-pipeline";
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(sourceName1.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_uri_new(sourceName2.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_uri_new(sourceName3.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_fake_new(fakeSinkName1.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName2.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName3.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tee_demuxer_new(demuxerName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tee_branch_add(demuxerName.c_str(), 
+            fakeSinkName1.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tee_branch_add(demuxerName.c_str(), 
+            fakeSinkName2.c_str()) == DSL_RESULT_SUCCESS );
+            
+        const wchar_t* components[] = {L"test-uri-source-1", L"test-uri-source-2", 
+            L"demuxer", NULL};
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_streammux_batch_size_adaptive_set(pipelineName.c_str(), 
+            true, 2) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+        
+        WHEN( "A third Source is added while playing" ) 
+        {
+            uint batchSize(0), batchTimeout(0);
+
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+            
+            REQUIRE( dsl_pipeline_component_add(pipelineName.c_str(), 
+                sourceName3.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+                
+            THEN( "A Demuxer branch can be attached for the third stream" )
+            {
+                dsl_pipeline_streammux_batch_properties_get(pipelineName.c_str(), &batchSize, &batchTimeout);
+                REQUIRE( batchSize == 3 );
+                
+                REQUIRE( dsl_tee_branch_add(demuxerName.c_str(), 
+                    fakeSinkName3.c_str()) == DSL_RESULT_SUCCESS );
+                std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+                
+                uint currentState(DSL_STATE_NULL);
+                REQUIRE( dsl_pipeline_state_get(pipelineName.c_str(), 
+                    &currentState) == DSL_RESULT_SUCCESS );
+                REQUIRE( currentState == DSL_STATE_PLAYING );
+                
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
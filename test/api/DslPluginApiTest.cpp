@@ -0,0 +1,164 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslApi.h"
+
+static const std::wstring testPluginPath(L"./test/plugins/dsl-test-plugin.so");
+
+SCENARIO( "A new Plugin can be loaded and deleted", "[plugin-api]" )
+{
+    GIVEN( "An empty list of Plugins" ) 
+    {
+        std::wstring pluginName(L"test-plugin");
+        
+        REQUIRE( dsl_plugin_list_size() == 0 );
+
+        WHEN( "A new Plugin is loaded" ) 
+        {
+            REQUIRE( dsl_plugin_load(pluginName.c_str(), 
+                testPluginPath.c_str()) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size is updated and the name must be unique" ) 
+            {
+                REQUIRE( dsl_plugin_list_size() == 1 );
+                REQUIRE( dsl_plugin_load(pluginName.c_str(), 
+                    testPluginPath.c_str()) == DSL_RESULT_PLUGIN_NAME_NOT_UNIQUE );
+                    
+                REQUIRE( dsl_plugin_delete(pluginName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_plugin_delete(pluginName.c_str()) == 
+                    DSL_RESULT_PLUGIN_NAME_NOT_FOUND );
+                REQUIRE( dsl_plugin_list_size() == 0 );
+            }
+        }
+        WHEN( "A Plugin is loaded from a non-existent file" ) 
+        {
+            THEN( "The load fails" ) 
+            {
+                REQUIRE( dsl_plugin_load(pluginName.c_str(), 
+                    L"./test/plugins/non-existent.so") == DSL_RESULT_PLUGIN_FILE_NOT_FOUND );
+                REQUIRE( dsl_plugin_list_size() == 0 );
+            }
+        }
+        WHEN( "A Plugin is loaded from a file that is not a plugin" ) 
+        {
+            THEN( "The load fails" ) 
+            {
+                REQUIRE( dsl_plugin_load(pluginName.c_str(), 
+                    L"./Makefile") == DSL_RESULT_PLUGIN_LOAD_FAILED );
+                REQUIRE( dsl_plugin_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "ODE Triggers, ODE Actions and Pad Probe Handlers can be created from a Plugin", 
+    "[plugin-api]" )
+{
+    GIVEN( "A new Plugin" ) 
+    {
+        std::wstring pluginName(L"test-plugin");
+        std::wstring odeTriggerName(L"plugin-trigger");
+        std::wstring odeActionName(L"plugin-action");
+        std::wstring pphName(L"plugin-pph");
+        
+        REQUIRE( dsl_plugin_load(pluginName.c_str(), 
+            testPluginPath.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "A new Trigger, Action and Pad Probe Handler are created" ) 
+        {
+            REQUIRE( dsl_ode_trigger_plugin_new(odeTriggerName.c_str(), NULL, 
+                DSL_ODE_ANY_CLASS, 0, pluginName.c_str(), 
+                L"") == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_action_plugin_new(odeActionName.c_str(), 
+                pluginName.c_str(), L"") == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pph_plugin_new(pphName.c_str(), 
+                pluginName.c_str(), L"") == DSL_RESULT_SUCCESS );
+
+            THEN( "The objects outlive the deleted Plugin and can be deleted" ) 
+            {
+                REQUIRE( dsl_plugin_delete(pluginName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_plugin_list_size() == 0 );
+                
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The plugin fails to create an instance" ) 
+        {
+            THEN( "The create fails" ) 
+            {
+                REQUIRE( dsl_ode_action_plugin_new(odeActionName.c_str(), 
+                    pluginName.c_str(), L"fail") == DSL_RESULT_PLUGIN_CREATE_FAILED );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+                
+                REQUIRE( dsl_plugin_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "An unknown Plugin is used" ) 
+        {
+            THEN( "The create fails" ) 
+            {
+                REQUIRE( dsl_pph_plugin_new(pphName.c_str(), 
+                    L"unknown", L"") == DSL_RESULT_PLUGIN_NAME_NOT_FOUND );
+                REQUIRE( dsl_pph_list_size() == 0 );
+                
+                REQUIRE( dsl_plugin_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Plugin API checks for NULL input parameters", "[plugin-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring name(L"test-name");
+        
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_plugin_load(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_plugin_load(name.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_plugin_delete(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                
+                REQUIRE( dsl_ode_trigger_plugin_new(NULL, NULL, 0, 0, NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_plugin_new(name.c_str(), NULL, 0, 0, NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_plugin_new(NULL, NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_plugin_new(name.c_str(), NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_plugin_new(NULL, NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_plugin_new(name.c_str(), NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+            }
+        }
+    }
+}
@@ -98,6 +98,170 @@ SCENARIO( "A Fake Sink can update it Sync/Async attributes", "[fake-sink-api]" )
     }
 }    
 
+static void app_sink_new_data_handler_cb(void* buffer, void* data, 
+    uint size, void* batch_meta, void* client_data)
+{
+}
+
+SCENARIO( "The Components container is updated correctly on new App Sink", "[app-sink-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring sinkName = L"app-sink";
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new App Sink is created with a client handler" ) 
+        {
+            REQUIRE( dsl_sink_app_new(sinkName.c_str(), 
+                app_sink_new_data_handler_cb, NULL) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and attributes are updated correctly" ) 
+            {
+                REQUIRE( dsl_component_list_size() == 1 );
+                uint maxBuffers(0);
+                boolean drop(false);
+                REQUIRE( dsl_sink_app_max_buffers_get(sinkName.c_str(), 
+                    &maxBuffers, &drop) == DSL_RESULT_SUCCESS );
+                REQUIRE( maxBuffers == DSL_DEFAULT_APP_SINK_MAX_BUFFERS );
+                REQUIRE( drop == true );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A new App Sink is created without a client handler" ) 
+        {
+            REQUIRE( dsl_sink_app_new(sinkName.c_str(), 
+                NULL, NULL) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size is updated correctly" ) 
+            {
+                REQUIRE( dsl_component_list_size() == 1 );
+                REQUIRE( dsl_component_delete(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "An App Sink's max-buffers settings can be updated", "[app-sink-api]" )
+{
+    GIVEN( "A new App Sink" ) 
+    {
+        std::wstring sinkName = L"app-sink";
+
+        REQUIRE( dsl_sink_app_new(sinkName.c_str(), NULL, NULL) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The App Sink's max-buffers settings are updated" ) 
+        {
+            uint newMaxBuffers(16);
+            boolean newDrop(false);
+            REQUIRE( dsl_sink_app_max_buffers_set(sinkName.c_str(), 
+                newMaxBuffers, newDrop) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct values are returned on get" ) 
+            {
+                uint retMaxBuffers(0);
+                boolean retDrop(true);
+                REQUIRE( dsl_sink_app_max_buffers_get(sinkName.c_str(), 
+                    &retMaxBuffers, &retDrop) == DSL_RESULT_SUCCESS );
+                REQUIRE( retMaxBuffers == newMaxBuffers );
+                REQUIRE( retDrop == newDrop );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "An App Sink correctly handles data pull and release", "[app-sink-api]" )
+{
+    GIVEN( "Two new App Sinks, one with and one without a client handler" ) 
+    {
+        std::wstring pullSinkName = L"pull-app-sink";
+        std::wstring handlerSinkName = L"handler-app-sink";
+
+        REQUIRE( dsl_sink_app_new(pullSinkName.c_str(), NULL, NULL) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_app_new(handlerSinkName.c_str(), 
+            app_sink_new_data_handler_cb, NULL) == DSL_RESULT_SUCCESS );
+
+        WHEN( "Data is pulled from each App Sink when not playing" ) 
+        {
+            void* buffer(NULL);
+            void* data(NULL);
+            void* batchMeta(NULL);
+            uint size(0);
+
+            THEN( "No data is available in pull mode and the pull fails in handler mode" ) 
+            {
+                REQUIRE( dsl_sink_app_data_pull(pullSinkName.c_str(), 10,
+                    &buffer, &data, &size, &batchMeta) == 
+                        DSL_RESULT_SINK_APP_DATA_NOT_AVAILABLE );
+                REQUIRE( dsl_sink_app_data_pull(handlerSinkName.c_str(), 10,
+                    &buffer, &data, &size, &batchMeta) == 
+                        DSL_RESULT_SINK_APP_DATA_NOT_AVAILABLE );
+                REQUIRE( buffer == NULL );
+                REQUIRE( data == NULL );
+                REQUIRE( size == 0 );
+                REQUIRE( dsl_sink_app_data_release(pullSinkName.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Components container is updated correctly on new Meta Sink", "[meta-sink-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring sinkName = L"meta-sink";
+        std::wstring path = L"./meta-sink.bin";
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Meta Sink is created" ) 
+        {
+            REQUIRE( dsl_sink_meta_new(sinkName.c_str(), path.c_str(),
+                DSL_META_SINK_MODE_FILE, 4) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and stats are updated correctly" ) 
+            {
+                REQUIRE( dsl_component_list_size() == 1 );
+                uint64_t framesWritten(99), framesDropped(99);
+                REQUIRE( dsl_sink_meta_stats_get(sinkName.c_str(), 
+                    &framesWritten, &framesDropped) == DSL_RESULT_SUCCESS );
+                REQUIRE( framesWritten == 0 );
+                REQUIRE( framesDropped == 0 );
+                REQUIRE( dsl_sink_meta_stats_clear(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "Creating a new Meta Sink with an invalid mode will fail", "[meta-sink-api]" )
+{
+    GIVEN( "Attributes for a new Meta Sink" ) 
+    {
+        std::wstring sinkName = L"meta-sink";
+        std::wstring path = L"./meta-sink.sock";
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Meta Sink is created with an invalid mode" ) 
+        {
+            uint invalidMode(DSL_META_SINK_MODE_SOCKET + 1);
+
+            THEN( "The Meta Sink is not created" ) 
+            {
+                REQUIRE( dsl_sink_meta_new(sinkName.c_str(), path.c_str(),
+                    invalidMode, 4) == DSL_RESULT_SINK_META_MODE_INVALID );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The Components container is updated correctly on new Overlay Sink", "[overlay-sink-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -503,6 +667,116 @@ SCENARIO( "A Window Sink in use can't be added to a second Pipeline", "[window-s
     }
 }
 
+SCENARIO( "A Window Sink's max render FPS can be updated", "[window-sink-api]" )
+{
+    GIVEN( "A new Window Sink" ) 
+    {
+        std::wstring windowSinkName = L"window-sink";
+
+        uint offsetX(0);
+        uint offsetY(0);
+        uint sinkW(1280);
+        uint sinkH(720);
+
+        REQUIRE( dsl_sink_window_new(windowSinkName.c_str(), 
+            offsetX, offsetY, sinkW, sinkH) == DSL_RESULT_SUCCESS );
+
+        uint retMaxFps(99);
+        REQUIRE( dsl_sink_render_max_fps_get(windowSinkName.c_str(), 
+            &retMaxFps) == DSL_RESULT_SUCCESS );
+        REQUIRE( retMaxFps == 0 );
+
+        WHEN( "The Window Sink's max render FPS is updated" ) 
+        {
+            uint newMaxFps(5);
+            REQUIRE( dsl_sink_render_max_fps_set(windowSinkName.c_str(), 
+                newMaxFps) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_sink_render_max_fps_get(windowSinkName.c_str(), 
+                    &retMaxFps) == DSL_RESULT_SUCCESS );
+                REQUIRE( retMaxFps == newMaxFps );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A Window Sink's pause-when-hidden setting can be updated", "[window-sink-api]" )
+{
+    GIVEN( "A new Window Sink" ) 
+    {
+        std::wstring windowSinkName = L"window-sink";
+
+        uint offsetX(0);
+        uint offsetY(0);
+        uint sinkW(1280);
+        uint sinkH(720);
+
+        REQUIRE( dsl_sink_window_new(windowSinkName.c_str(), 
+            offsetX, offsetY, sinkW, sinkH) == DSL_RESULT_SUCCESS );
+
+        boolean retEnabled(true);
+        REQUIRE( dsl_sink_window_pause_when_hidden_get(windowSinkName.c_str(), 
+            &retEnabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( retEnabled == false );
+
+        WHEN( "The Window Sink's pause-when-hidden setting is enabled" ) 
+        {
+            REQUIRE( dsl_sink_window_pause_when_hidden_set(windowSinkName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_sink_window_pause_when_hidden_get(windowSinkName.c_str(), 
+                    &retEnabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( retEnabled == true );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "The render settings services fail for the wrong Sink types", "[window-sink-api]" )
+{
+    GIVEN( "A new Overlay Sink and a new Fake Sink" ) 
+    {
+        std::wstring overlaySinkName = L"overlay-sink";
+        std::wstring fakeSinkName = L"fake-sink";
+
+        REQUIRE( dsl_sink_overlay_new(overlaySinkName.c_str(), 1, 0, 0, 
+            0, 0, 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The render settings are updated for each Sink" ) 
+        {
+            THEN( "Only the services supported by each Sink type succeed" ) 
+            {
+                uint retMaxFps(0);
+                boolean retEnabled(false);
+                
+                REQUIRE( dsl_sink_render_max_fps_set(overlaySinkName.c_str(), 
+                    10) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_sink_render_max_fps_get(overlaySinkName.c_str(), 
+                    &retMaxFps) == DSL_RESULT_SUCCESS );
+                REQUIRE( retMaxFps == 10 );
+                REQUIRE( dsl_sink_window_pause_when_hidden_get(overlaySinkName.c_str(), 
+                    &retEnabled) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                    
+                REQUIRE( dsl_sink_render_max_fps_set(fakeSinkName.c_str(), 
+                    10) == DSL_RESULT_SINK_COMPONENT_IS_NOT_RENDER_SINK );
+                REQUIRE( dsl_sink_render_max_fps_get(fakeSinkName.c_str(), 
+                    &retMaxFps) == DSL_RESULT_SINK_COMPONENT_IS_NOT_RENDER_SINK );
+                REQUIRE( dsl_sink_window_pause_when_hidden_set(fakeSinkName.c_str(), 
+                    true) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The Components container is updated correctly on new File Sink", "[file-sink-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -686,6 +960,272 @@ SCENARIO( "An invalid File Sink is caught on Encoder settings Get and Set", "[fi
     }
 }
 
+SCENARIO( "The Components container is updated correctly on new Segment Sink", "[segment-sink-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring segmentSinkName(L"segment-sink");
+        std::wstring filePattern(L"./output-%05d.mp4");
+        uint codec(DSL_CODEC_H264);
+        uint container(DSL_CONTAINER_MP4);
+        uint bitrate(2000000);
+        uint interval(0);
+        uint maxDuration(60);
+        uint maxFiles(10);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Segment Sink is created" ) 
+        {
+            REQUIRE( dsl_sink_segment_new(segmentSinkName.c_str(), filePattern.c_str(),
+                codec, container, bitrate, interval, maxDuration, maxFiles) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and default values are updated correctly" ) 
+            {
+                uint retCodec(0), retContainer(0);
+                REQUIRE( dsl_sink_encode_video_formats_get(segmentSinkName.c_str(), 
+                    &retCodec, &retContainer) == DSL_RESULT_SUCCESS );
+                REQUIRE( retCodec == codec );
+                REQUIRE( retContainer == container );
+                
+                uint retMaxDuration(0), retMaxFiles(0);
+                uint64_t retMaxSize(99);
+                REQUIRE( dsl_sink_segment_max_duration_get(segmentSinkName.c_str(), 
+                    &retMaxDuration) == DSL_RESULT_SUCCESS );
+                REQUIRE( retMaxDuration == maxDuration );
+                REQUIRE( dsl_sink_segment_max_size_get(segmentSinkName.c_str(), 
+                    &retMaxSize) == DSL_RESULT_SUCCESS );
+                REQUIRE( retMaxSize == 0 );
+                REQUIRE( dsl_sink_segment_max_files_get(segmentSinkName.c_str(), 
+                    &retMaxFiles) == DSL_RESULT_SUCCESS );
+                REQUIRE( retMaxFiles == maxFiles );
+                
+                uint retBufferSize(0), retFsyncInterval(0);
+                REQUIRE( dsl_sink_segment_write_settings_get(segmentSinkName.c_str(), 
+                    &retBufferSize, &retFsyncInterval) == DSL_RESULT_SUCCESS );
+                REQUIRE( retBufferSize == DSL_DEFAULT_SEGMENT_SINK_WRITE_BUFFER_SIZE );
+                REQUIRE( retFsyncInterval == DSL_DEFAULT_SEGMENT_SINK_FSYNC_INTERVAL );
+                
+                REQUIRE( dsl_component_list_size() == 1 );
+            }
+        }
+        REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+    }
+}    
+
+SCENARIO( "Creating a new Segment Sink with an invalid file pattern will fail", "[segment-sink-api]" )
+{
+    GIVEN( "Attributes for a new Segment Sink" ) 
+    {
+        std::wstring segmentSinkName(L"segment-sink");
+        uint codec(DSL_CODEC_H264);
+        uint container(DSL_CONTAINER_MKV);
+        uint bitrate(2000000);
+        uint interval(0);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "When creating a new Segment Sink with an invalid file pattern" ) 
+        {
+            THEN( "The create fails and the list size is left unchanged" ) 
+            {
+                REQUIRE( dsl_sink_segment_new(segmentSinkName.c_str(), L"./output.mkv",
+                    codec, container, bitrate, interval, 60, 0) == 
+                    DSL_RESULT_SINK_SEGMENT_PATTERN_INVALID );
+                REQUIRE( dsl_sink_segment_new(segmentSinkName.c_str(), L"./output-%s.mkv",
+                    codec, container, bitrate, interval, 60, 0) == 
+                    DSL_RESULT_SINK_SEGMENT_PATTERN_INVALID );
+                REQUIRE( dsl_sink_segment_new(segmentSinkName.c_str(), L"./output-%d-%d.mkv",
+                    codec, container, bitrate, interval, 60, 0) == 
+                    DSL_RESULT_SINK_SEGMENT_PATTERN_INVALID );
+                REQUIRE( dsl_component_list_size() == 0 );
+                
+                REQUIRE( dsl_sink_segment_new(segmentSinkName.c_str(), L"./100%%-%03u.mkv",
+                    codec, container, bitrate, interval, 60, 0) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 1 );
+            }
+        }
+        REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+    }
+}    
+
+SCENARIO( "A Segment Sink's limits and write settings can be updated", "[segment-sink-api]" )
+{
+    GIVEN( "A new Segment Sink" ) 
+    {
+        std::wstring segmentSinkName(L"segment-sink");
+        std::wstring filePattern(L"./output-%05d.mp4");
+
+        REQUIRE( dsl_sink_segment_new(segmentSinkName.c_str(), filePattern.c_str(),
+            DSL_CODEC_H265, DSL_CONTAINER_MP4, 2000000, 0, 60, 0) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Segment Sink's limits and write settings are Set" )
+        {
+            REQUIRE( dsl_sink_segment_max_duration_set(segmentSinkName.c_str(), 
+                300) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_sink_segment_max_size_set(segmentSinkName.c_str(), 
+                1073741824) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_sink_segment_max_files_set(segmentSinkName.c_str(), 
+                24) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_sink_segment_write_settings_set(segmentSinkName.c_str(), 
+                4194304, 0) == DSL_RESULT_SUCCESS );
+
+            THEN( "The new values are returned on Get")
+            {
+                uint retMaxDuration(0), retMaxFiles(0);
+                uint64_t retMaxSize(0);
+                REQUIRE( dsl_sink_segment_max_duration_get(segmentSinkName.c_str(), 
+                    &retMaxDuration) == DSL_RESULT_SUCCESS );
+                REQUIRE( retMaxDuration == 300 );
+                REQUIRE( dsl_sink_segment_max_size_get(segmentSinkName.c_str(), 
+                    &retMaxSize) == DSL_RESULT_SUCCESS );
+                REQUIRE( retMaxSize == 1073741824 );
+                REQUIRE( dsl_sink_segment_max_files_get(segmentSinkName.c_str(), 
+                    &retMaxFiles) == DSL_RESULT_SUCCESS );
+                REQUIRE( retMaxFiles == 24 );
+                
+                uint retBufferSize(0), retFsyncInterval(99);
+                REQUIRE( dsl_sink_segment_write_settings_get(segmentSinkName.c_str(), 
+                    &retBufferSize, &retFsyncInterval) == DSL_RESULT_SUCCESS );
+                REQUIRE( retBufferSize == 4194304 );
+                REQUIRE( retFsyncInterval == 0 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An invalid Segment Sink is caught on Get and Set", "[segment-sink-api]" )
+{
+    GIVEN( "A new File Sink as incorrect Sink Type" ) 
+    {
+        std::wstring fileSinkName(L"file-sink");
+        std::wstring filePath(L"./output.mp4");
+        
+        uint maxDuration(0), bufferSize(0), fsyncInterval(0);
+
+        WHEN( "The Segment Sink Get-Set API called with a File sink" )
+        {
+            REQUIRE( dsl_sink_file_new(fileSinkName.c_str(), filePath.c_str(),
+                DSL_CODEC_H264, DSL_CONTAINER_MP4, 2000000, 0) == DSL_RESULT_SUCCESS );
+
+            THEN( "The Segment Sink APIs fail correctly")
+            {
+                REQUIRE( dsl_sink_segment_max_duration_get(fileSinkName.c_str(), 
+                    &maxDuration) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_sink_segment_write_settings_set(fileSinkName.c_str(), 
+                    bufferSize, fsyncInterval) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Components container is updated correctly on new Shared Encode Sink", "[shared-encode-sink-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring sharedEncodeSinkName(L"shared-encode-sink");
+        uint codec(DSL_CODEC_H265);
+        uint bitrate(2000000);
+        uint interval(30);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Shared Encode Sink is created" ) 
+        {
+            REQUIRE( dsl_sink_shared_encode_new(sharedEncodeSinkName.c_str(), 
+                codec, bitrate, interval) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and encoder settings are updated correctly" ) 
+            {
+                uint retBitrate(0), retInterval(0);
+                REQUIRE( dsl_sink_encode_settings_get(sharedEncodeSinkName.c_str(), 
+                    &retBitrate, &retInterval) == DSL_RESULT_SUCCESS );
+                REQUIRE( retBitrate == bitrate );
+                REQUIRE( retInterval == interval );
+                REQUIRE( dsl_component_list_size() == 1 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "An invalid Codec is specified" ) 
+        {
+            THEN( "The new Shared Encode Sink fails to create" ) 
+            {
+                REQUIRE( dsl_sink_shared_encode_new(sharedEncodeSinkName.c_str(), 
+                    DSL_CODEC_MPEG4+1, bitrate, interval) == DSL_RESULT_SINK_CODEC_VALUE_INVALID );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "Taps can be added to and removed from a Shared Encode Sink", "[shared-encode-sink-api]" )
+{
+    GIVEN( "A new Shared Encode Sink, File Tap, and RTSP Tap" ) 
+    {
+        std::wstring sharedEncodeSinkName(L"shared-encode-sink");
+        std::wstring otherSinkName(L"other-shared-encode-sink");
+        std::wstring fileTapName(L"file-tap");
+        std::wstring filePath(L"./output.mp4");
+        std::wstring rtspTapName(L"rtsp-tap");
+        std::wstring host(L"224.224.255.255");
+
+        REQUIRE( dsl_sink_shared_encode_new(sharedEncodeSinkName.c_str(), 
+            DSL_CODEC_H264, 2000000, 30) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_shared_encode_new(otherSinkName.c_str(), 
+            DSL_CODEC_H264, 2000000, 30) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tap_file_new(fileTapName.c_str(), filePath.c_str(),
+            DSL_CODEC_H264, DSL_CONTAINER_MP4) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tap_rtsp_new(rtspTapName.c_str(), host.c_str(),
+            5400, 8554, DSL_CODEC_H264) == DSL_RESULT_SUCCESS );
+
+        WHEN( "Both Taps are added to the Shared Encode Sink" ) 
+        {
+            REQUIRE( dsl_sink_shared_encode_tap_add(sharedEncodeSinkName.c_str(), 
+                fileTapName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_sink_shared_encode_tap_add(sharedEncodeSinkName.c_str(), 
+                rtspTapName.c_str()) == DSL_RESULT_SUCCESS );
+
+            THEN( "The Taps are in use and can be removed" ) 
+            {
+                REQUIRE( dsl_sink_shared_encode_tap_add(otherSinkName.c_str(), 
+                    fileTapName.c_str()) == DSL_RESULT_TAP_IN_USE );
+                REQUIRE( dsl_component_delete(fileTapName.c_str()) == 
+                    DSL_RESULT_COMPONENT_IN_USE );
+                    
+                REQUIRE( dsl_sink_shared_encode_tap_remove(sharedEncodeSinkName.c_str(), 
+                    fileTapName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_sink_shared_encode_tap_remove(sharedEncodeSinkName.c_str(), 
+                    fileTapName.c_str()) == DSL_RESULT_SINK_TAP_REMOVE_FAILED );
+                REQUIRE( dsl_sink_shared_encode_tap_remove(sharedEncodeSinkName.c_str(), 
+                    rtspTapName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "A non-Tap component is added to the Shared Encode Sink" ) 
+        {
+            THEN( "The add fails and the component is not in use" ) 
+            {
+                REQUIRE( dsl_sink_shared_encode_tap_add(sharedEncodeSinkName.c_str(), 
+                    otherSinkName.c_str()) == DSL_RESULT_TAP_COMPONENT_IS_NOT_TAP );
+                REQUIRE( dsl_sink_shared_encode_tap_add(fileTapName.c_str(), 
+                    rtspTapName.c_str()) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "The Components container is updated correctly on new Record Sink", "[record-sink-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -945,6 +1485,65 @@ SCENARIO( "An invalid RTSP Sink is caught on Encoder settings Get and Set", "[fi
     }
 }
 
+SCENARIO( "An RTSP Sink's adaptive bitrate settings can be updated", "[rtsp-sink-api]" )
+{
+    GIVEN( "A new RTSP Sink" ) 
+    {
+        std::wstring rtspSinkName(L"rtsp-sink");
+        std::wstring host(L"224.224.255.255");
+        uint bitrate(4000000);
+
+        REQUIRE( dsl_sink_rtsp_new(rtspSinkName.c_str(), host.c_str(),
+            5400, 8554, DSL_CODEC_H264, bitrate, 0) == DSL_RESULT_SUCCESS );
+
+        boolean retEnabled(true);
+        uint retMinBitrate(0), retMaxBitrate(0);
+        REQUIRE( dsl_sink_rtsp_bitrate_adaptive_get(rtspSinkName.c_str(), 
+            &retEnabled, &retMinBitrate, &retMaxBitrate) == DSL_RESULT_SUCCESS );
+        REQUIRE( retEnabled == false );
+        REQUIRE( retMinBitrate == bitrate );
+        REQUIRE( retMaxBitrate == bitrate );
+
+        WHEN( "The RTSP Sink's adaptive bitrate is enabled" ) 
+        {
+            uint minBitrate(500000), maxBitrate(6000000);
+            REQUIRE( dsl_sink_rtsp_bitrate_adaptive_set(rtspSinkName.c_str(), 
+                true, minBitrate, maxBitrate) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_sink_rtsp_bitrate_adaptive_get(rtspSinkName.c_str(), 
+                    &retEnabled, &retMinBitrate, &retMaxBitrate) == DSL_RESULT_SUCCESS );
+                REQUIRE( retEnabled == true );
+                REQUIRE( retMinBitrate == minBitrate );
+                REQUIRE( retMaxBitrate == maxBitrate );
+                
+                uint retClientCount(99), retBitrate(0);
+                boolean retIsEncoding(false);
+                REQUIRE( dsl_sink_rtsp_stream_status_get(rtspSinkName.c_str(), 
+                    &retClientCount, &retBitrate, &retIsEncoding) == DSL_RESULT_SUCCESS );
+                REQUIRE( retClientCount == 0 );
+                REQUIRE( retBitrate == bitrate );
+                REQUIRE( retIsEncoding == true );
+                
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "Invalid adaptive bitrate bounds are used" ) 
+        {
+            THEN( "The set service fails" ) 
+            {
+                REQUIRE( dsl_sink_rtsp_bitrate_adaptive_set(rtspSinkName.c_str(), 
+                    true, 0, 6000000) == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_sink_rtsp_bitrate_adaptive_set(rtspSinkName.c_str(), 
+                    true, 6000000, 500000) == DSL_RESULT_SINK_SET_FAILED );
+                    
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 
 
 SCENARIO( "A Client is able to update the Sink in-use max", "[sink-api]" )
@@ -1134,7 +1733,14 @@ SCENARIO( "The Sink API checks for NULL input parameters", "[sink-api]" )
         std::wstring otherName  = L"other";
         
         uint cache_size(0), width(0), height(0), codec(0), container(0), bitrate(0), interval(0), udpPort(0), rtspPort(0);
-        boolean is_on(0), reset_done(0), sync(0), async(0);
+        boolean is_on(0), reset_done(0), sync(0), async(0), drop(0);
+        void* buffer(NULL);
+        void* data(NULL);
+        void* batch_meta(NULL);
+        uint size(0), max_buffers(0);
+        uint64_t frames_written(0), frames_dropped(0);
+        uint max_duration(0), max_files(0), buffer_size(0), fsync_interval(0);
+        uint64_t max_size(0);
         
         REQUIRE( dsl_component_list_size() == 0 );
 
@@ -1144,12 +1750,67 @@ SCENARIO( "The Sink API checks for NULL input parameters", "[sink-api]" )
             {
                 REQUIRE( dsl_sink_fake_new(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 
+                REQUIRE( dsl_sink_app_new(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_data_pull(NULL, 0, &buffer, &data, &size, &batch_meta) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_data_pull(sinkName.c_str(), 0, NULL, &data, &size, &batch_meta) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_data_pull(sinkName.c_str(), 0, &buffer, NULL, &size, &batch_meta) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_data_pull(sinkName.c_str(), 0, &buffer, &data, NULL, &batch_meta) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_data_pull(sinkName.c_str(), 0, &buffer, &data, &size, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_data_release(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_max_buffers_get(NULL, &max_buffers, &drop) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_max_buffers_set(NULL, max_buffers, drop) == DSL_RESULT_INVALID_INPUT_PARAM );
+                
+                REQUIRE( dsl_sink_meta_new(NULL, NULL, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_meta_new(sinkName.c_str(), NULL, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_meta_stats_get(NULL, &frames_written, &frames_dropped) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_meta_stats_get(sinkName.c_str(), NULL, &frames_dropped) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_meta_stats_get(sinkName.c_str(), &frames_written, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_meta_stats_clear(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                
                 REQUIRE( dsl_sink_overlay_new(NULL, 0, 0, 0, 0, 0, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_sink_window_new(NULL, 0, 0, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_render_max_fps_get(NULL, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_render_max_fps_get(sinkName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_render_max_fps_set(NULL, interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_window_pause_when_hidden_get(NULL, &sync) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_window_pause_when_hidden_get(sinkName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_window_pause_when_hidden_set(NULL, sync) == DSL_RESULT_INVALID_INPUT_PARAM );
                 
                 REQUIRE( dsl_sink_file_new(NULL, NULL, 0, 0, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_sink_file_new(sinkName.c_str(), NULL, 0, 0, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 
+                REQUIRE( dsl_sink_segment_new(NULL, NULL, 0, 0, 0, 0, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_new(sinkName.c_str(), NULL, 0, 0, 0, 0, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_max_duration_get(NULL, &max_duration) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_max_duration_get(sinkName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_max_duration_set(NULL, max_duration) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_max_size_get(NULL, &max_size) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_max_size_get(sinkName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_max_size_set(NULL, max_size) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_max_files_get(NULL, &max_files) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_max_files_get(sinkName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_max_files_set(NULL, max_files) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_write_settings_get(NULL, &buffer_size, &fsync_interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_write_settings_get(sinkName.c_str(), NULL, &fsync_interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_write_settings_get(sinkName.c_str(), &buffer_size, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_segment_write_settings_set(NULL, buffer_size, fsync_interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_sink_rtsp_bitrate_adaptive_get(NULL, &sync, &bitrate, &bitrate) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_rtsp_bitrate_adaptive_get(sinkName.c_str(), NULL, &bitrate, &bitrate) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_rtsp_bitrate_adaptive_get(sinkName.c_str(), &sync, NULL, &bitrate) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_rtsp_bitrate_adaptive_get(sinkName.c_str(), &sync, &bitrate, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_rtsp_bitrate_adaptive_set(NULL, false, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_rtsp_stream_status_get(NULL, &bitrate, &bitrate, &sync) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_rtsp_stream_status_get(sinkName.c_str(), NULL, &bitrate, &sync) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_rtsp_stream_status_get(sinkName.c_str(), &bitrate, NULL, &sync) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_rtsp_stream_status_get(sinkName.c_str(), &bitrate, &bitrate, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_sink_shared_encode_new(NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_shared_encode_tap_add(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_shared_encode_tap_add(sinkName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_shared_encode_tap_remove(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_shared_encode_tap_remove(sinkName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                
                 REQUIRE( dsl_sink_record_new(NULL, NULL, 0, 0, 0, 0, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_sink_record_new(sinkName.c_str(), NULL, 0, 0, 0, 0, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_sink_record_session_start(NULL, 0, 0, 0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -586,6 +586,465 @@ SCENARIO( "Adding an invalid Dewarper to a Decode Source Component fails", "[sou
     }
 }
 
+static void rtsp_state_change_listener_cb1(uint prev_state, uint curr_state, void* user_data)
+{
+}
+
+static void rtsp_state_change_listener_cb2(uint prev_state, uint curr_state, void* user_data)
+{
+}
+
+SCENARIO( "An RTSP Source's stream watchdog settings can be updated", "[source-api]" )
+{
+    GIVEN( "A new RTSP Source" )
+    {
+        std::wstring sourceName = L"rtsp-source";
+        std::wstring uri = L"rtsp://127.0.0.1:8564/test";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+        uint latency(100);
+
+        REQUIRE( dsl_source_rtsp_new(sourceName.c_str(), uri.c_str(), DSL_RTP_ALL, 
+            cudadecMemType, intrDecode, dropFrameInterval, latency) == DSL_RESULT_SUCCESS );
+
+        uint timeout(99), backoffMin(99), backoffMax(99);
+        REQUIRE( dsl_source_rtsp_timeout_get(sourceName.c_str(), &timeout) == DSL_RESULT_SUCCESS );
+        REQUIRE( timeout == DSL_DEFAULT_RTSP_BUFFER_TIMEOUT );
+        REQUIRE( dsl_source_rtsp_reconnection_params_get(sourceName.c_str(), 
+            &backoffMin, &backoffMax) == DSL_RESULT_SUCCESS );
+        REQUIRE( backoffMin == DSL_DEFAULT_RTSP_RECONNECT_BACKOFF_MIN );
+        REQUIRE( backoffMax == DSL_DEFAULT_RTSP_RECONNECT_BACKOFF_MAX );
+        
+        uint state(99), reconnectCount(99);
+        const wchar_t* lastError;
+        REQUIRE( dsl_source_rtsp_connection_data_get(sourceName.c_str(), 
+            &state, &reconnectCount, &lastError) == DSL_RESULT_SUCCESS );
+        REQUIRE( state == DSL_RTSP_CONNECTION_STATE_IDLE );
+        REQUIRE( reconnectCount == 0 );
+        REQUIRE( std::wstring(lastError) == L"" );
+
+        WHEN( "The RTSP Source's watchdog settings are updated" ) 
+        {
+            REQUIRE( dsl_source_rtsp_timeout_set(sourceName.c_str(), 5) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_source_rtsp_reconnection_params_set(sourceName.c_str(), 
+                2, 16) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct values are returned on get" )
+            {
+                REQUIRE( dsl_source_rtsp_timeout_get(sourceName.c_str(), &timeout) == DSL_RESULT_SUCCESS );
+                REQUIRE( timeout == 5 );
+                REQUIRE( dsl_source_rtsp_reconnection_params_get(sourceName.c_str(), 
+                    &backoffMin, &backoffMax) == DSL_RESULT_SUCCESS );
+                REQUIRE( backoffMin == 2 );
+                REQUIRE( backoffMax == 16 );
+                
+                // invalid params must fail
+                REQUIRE( dsl_source_rtsp_reconnection_params_set(sourceName.c_str(), 
+                    0, 16) == DSL_RESULT_SOURCE_SET_FAILED );
+                REQUIRE( dsl_source_rtsp_reconnection_params_set(sourceName.c_str(), 
+                    17, 16) == DSL_RESULT_SOURCE_SET_FAILED );
+                
+                REQUIRE( dsl_source_rtsp_connection_stats_clear(sourceName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "State Change Listeners are added to the RTSP Source" ) 
+        {
+            REQUIRE( dsl_source_rtsp_state_change_listener_add(sourceName.c_str(), 
+                rtsp_state_change_listener_cb1, NULL) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_source_rtsp_state_change_listener_add(sourceName.c_str(), 
+                rtsp_state_change_listener_cb2, NULL) == DSL_RESULT_SUCCESS );
+
+            // A second add of the same listener must fail
+            REQUIRE( dsl_source_rtsp_state_change_listener_add(sourceName.c_str(), 
+                rtsp_state_change_listener_cb1, NULL) == DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED );
+
+            THEN( "The same Listeners can be removed" )
+            {
+                REQUIRE( dsl_source_rtsp_state_change_listener_remove(sourceName.c_str(), 
+                    rtsp_state_change_listener_cb1) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_rtsp_state_change_listener_remove(sourceName.c_str(), 
+                    rtsp_state_change_listener_cb2) == DSL_RESULT_SUCCESS );
+
+                // A second remove must fail
+                REQUIRE( dsl_source_rtsp_state_change_listener_remove(sourceName.c_str(), 
+                    rtsp_state_change_listener_cb1) == DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The RTSP Source watchdog APIs fail with a non RTSP Source", "[source-api]" )
+{
+    GIVEN( "A new URI Source" )
+    {
+        std::wstring sourceName = L"uri-source";
+        std::wstring uri = L"./test/streams/sample_1080p_h264.mp4";
+
+        REQUIRE( dsl_source_uri_new(sourceName.c_str(), uri.c_str(), false, 
+            DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The RTSP Source watchdog APIs are called" ) 
+        {
+            uint timeout(0);
+            
+            THEN( "All calls fail with the correct return value" )
+            {
+                REQUIRE( dsl_source_rtsp_timeout_get(sourceName.c_str(), 
+                    &timeout) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_source_rtsp_timeout_set(sourceName.c_str(), 
+                    5) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_source_rtsp_connection_stats_clear(
+                    sourceName.c_str()) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A URI Source's repeat enabled setting can be updated", "[source-api]" )
+{
+    GIVEN( "A new URI Source" )
+    {
+        std::wstring sourceName = L"uri-source";
+        std::wstring uri = L"./test/streams/sample_1080p_h264.mp4";
+
+        REQUIRE( dsl_source_uri_new(sourceName.c_str(), uri.c_str(), false, 
+            DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_source_decode_repeat_enabled_get(sourceName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+
+        WHEN( "The repeat enabled setting is updated" ) 
+        {
+            REQUIRE( dsl_source_decode_repeat_enabled_set(sourceName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct value is returned on get" )
+            {
+                REQUIRE( dsl_source_decode_repeat_enabled_get(sourceName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Live Source's repeat enabled setting can not be updated", "[source-api]" )
+{
+    GIVEN( "A new RTSP Source" )
+    {
+        std::wstring sourceName = L"rtsp-source";
+        std::wstring uri = L"rtsp://127.0.0.1:8554/test";
+
+        REQUIRE( dsl_source_rtsp_new(sourceName.c_str(), uri.c_str(), DSL_RTP_ALL, 
+            DSL_CUDADEC_MEMTYPE_DEVICE, false, 0, 100) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The repeat enabled setting is updated" ) 
+        {
+            uint retval = dsl_source_decode_repeat_enabled_set(sourceName.c_str(), true);
+            
+            THEN( "The service fails" )
+            {
+                REQUIRE( retval == DSL_RESULT_SOURCE_SET_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new Playlist Source returns the correct attribute values", "[source-api]" )
+{
+    GIVEN( "A list of files to play" )
+    {
+        std::wstring sourceName = L"playlist-source";
+        const wchar_t* files[] = {L"./test/streams/sample_1080p_h264.mp4", 
+            L"./test/streams/sample_1080p_h264.mp4", NULL};
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Playlist Source is created" ) 
+        {
+            REQUIRE( dsl_source_playlist_new(sourceName.c_str(), files, true,
+                DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and contents are updated correctly" ) 
+            {
+                uint index(99), size(0);
+                boolean enabled(false);
+                REQUIRE( dsl_component_list_size() == 1 );
+                REQUIRE( dsl_source_is_live(sourceName.c_str()) == false );
+                REQUIRE( dsl_source_playlist_index_get(sourceName.c_str(), 
+                    &index, &size) == DSL_RESULT_SUCCESS );
+                REQUIRE( index == 0 );
+                REQUIRE( size == 2 );
+                REQUIRE( dsl_source_decode_repeat_enabled_get(sourceName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new Playlist Source fails to create with an invalid file", "[source-api]" )
+{
+    GIVEN( "A list of files with one that doesn't exist" )
+    {
+        std::wstring sourceName = L"playlist-source";
+        const wchar_t* files[] = {L"./test/streams/sample_1080p_h264.mp4", 
+            L"./test/streams/bad-file-name.mp4", NULL};
+        const wchar_t* empty[] = {NULL};
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Playlist Source is created" ) 
+        {
+            uint retval = dsl_source_playlist_new(sourceName.c_str(), files, false,
+                DSL_CUDADEC_MEMTYPE_DEVICE, false, 0);
+
+            THEN( "The service fails and the list size is unchanged" ) 
+            {
+                REQUIRE( retval == DSL_RESULT_SOURCE_FILE_NOT_FOUND );
+                REQUIRE( dsl_source_playlist_new(sourceName.c_str(), empty, false,
+                    DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SOURCE_FILE_NOT_FOUND );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new Test Source returns the correct attribute values", "[source-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring sourceName(L"test-pattern-source");
+        uint width(1280);
+        uint height(720);
+        uint fps_n(30);
+        uint fps_d(1);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Test Source is created" ) 
+        {
+            REQUIRE( dsl_source_test_new(sourceName.c_str(), false, DSL_TEST_PATTERN_BALL,
+                width, height, fps_n, fps_d, 0) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and contents are updated correctly" ) 
+            {
+                uint ret_width(0), ret_height(0), ret_fps_n(0), ret_fps_d(0), ret_pattern(99);
+                REQUIRE( dsl_component_list_size() == 1 );
+                REQUIRE( dsl_source_dimensions_get(sourceName.c_str(), &ret_width, &ret_height) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_frame_rate_get(sourceName.c_str(), &ret_fps_n, &ret_fps_d) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_width == width );
+                REQUIRE( ret_height == height );
+                REQUIRE( ret_fps_n == fps_n );
+                REQUIRE( ret_fps_d == fps_d );
+                REQUIRE( dsl_source_is_live(sourceName.c_str()) == false );
+                REQUIRE( dsl_source_test_pattern_get(sourceName.c_str(), &ret_pattern) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_pattern == DSL_TEST_PATTERN_BALL );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A Test Source's pattern can be updated", "[source-api]" )
+{
+    GIVEN( "A new Test Source" ) 
+    {
+        std::wstring sourceName(L"test-pattern-source");
+
+        REQUIRE( dsl_component_list_size() == 0 );
+        REQUIRE( dsl_source_test_new(sourceName.c_str(), true, DSL_TEST_PATTERN_SMPTE,
+            1280, 720, 30, 1, 100) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_is_live(sourceName.c_str()) == true );
+
+        WHEN( "The Test Source's pattern is updated" ) 
+        {
+            REQUIRE( dsl_source_test_pattern_set(sourceName.c_str(), 
+                DSL_TEST_PATTERN_CHECKERS_8) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" ) 
+            {
+                uint pattern(0);
+                REQUIRE( dsl_source_test_pattern_get(sourceName.c_str(), &pattern) == DSL_RESULT_SUCCESS );
+                REQUIRE( pattern == DSL_TEST_PATTERN_CHECKERS_8 );
+
+                // invalid patterns must fail
+                REQUIRE( dsl_source_test_pattern_set(sourceName.c_str(), 
+                    DSL_TEST_PATTERN_COLORS+1) == DSL_RESULT_SOURCE_SET_FAILED );
+                REQUIRE( dsl_source_test_new(L"bad-pattern", false, DSL_TEST_PATTERN_COLORS+1,
+                    1280, 720, 30, 1, 0) == DSL_RESULT_SOURCE_SET_FAILED );
+                    
+                // non Test Sources must fail
+                REQUIRE( dsl_source_usb_new(L"usb-source", 1280, 720, 30, 1) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_test_pattern_get(L"usb-source", &pattern) == 
+                    DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+static void need_data_handler(uint length, void* client_data)
+{
+}
+
+static void enough_data_handler(void* client_data)
+{
+}
+
+static void buffer_release(void* data, void* client_data)
+{
+}
+
+SCENARIO( "A new App Source returns the correct attribute values", "[source-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring sourceName(L"app-source");
+        uint width(1280);
+        uint height(720);
+        uint fps_n(30);
+        uint fps_d(1);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new App Source is created" ) 
+        {
+            REQUIRE( dsl_source_app_new(sourceName.c_str(), true, DSL_VIDEO_FORMAT_I420,
+                width, height, fps_n, fps_d) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and contents are updated correctly" ) 
+            {
+                uint ret_width(0), ret_height(0), ret_fps_n(0), ret_fps_d(0);
+                REQUIRE( dsl_component_list_size() == 1 );
+                REQUIRE( dsl_source_dimensions_get(sourceName.c_str(), &ret_width, &ret_height) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_frame_rate_get(sourceName.c_str(), &ret_fps_n, &ret_fps_d) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_width == width );
+                REQUIRE( ret_height == height );
+                REQUIRE( ret_fps_n == fps_n );
+                REQUIRE( ret_fps_d == fps_d );
+                REQUIRE( dsl_source_is_live(sourceName.c_str()) == true );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A new App Source is created with an invalid format" ) 
+        {
+            uint retval = dsl_source_app_new(sourceName.c_str(), true, 
+                DSL_VIDEO_FORMAT_RGBA+1, width, height, fps_n, fps_d);
+
+            THEN( "The service fails and the list size is unchanged" ) 
+            {
+                REQUIRE( retval == DSL_RESULT_SOURCE_SET_FAILED );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "An App Source's data handlers can be added and removed", "[source-api]" )
+{
+    GIVEN( "A new App Source" ) 
+    {
+        std::wstring sourceName(L"app-source");
+
+        REQUIRE( dsl_component_list_size() == 0 );
+        REQUIRE( dsl_source_app_new(sourceName.c_str(), true, DSL_VIDEO_FORMAT_NV12,
+            1280, 720, 30, 1) == DSL_RESULT_SUCCESS );
+
+        WHEN( "Data handlers are added" ) 
+        {
+            REQUIRE( dsl_source_app_data_handlers_add(sourceName.c_str(), 
+                need_data_handler, enough_data_handler, NULL) == DSL_RESULT_SUCCESS );
+
+            // second call must fail
+            REQUIRE( dsl_source_app_data_handlers_add(sourceName.c_str(), 
+                need_data_handler, enough_data_handler, NULL) == DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED );
+
+            THEN( "The same handlers can be removed" ) 
+            {
+                REQUIRE( dsl_source_app_data_handlers_remove(sourceName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_app_data_handlers_remove(sourceName.c_str()) == DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "An App Source's max level bytes can be updated", "[source-api]" )
+{
+    GIVEN( "A new App Source" ) 
+    {
+        std::wstring sourceName(L"app-source");
+        uint64_t newMaxBytes(1280*720*3/2*4);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+        REQUIRE( dsl_source_app_new(sourceName.c_str(), true, DSL_VIDEO_FORMAT_I420,
+            1280, 720, 30, 1) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The max level bytes is updated" ) 
+        {
+            REQUIRE( dsl_source_app_max_level_bytes_set(sourceName.c_str(), 
+                newMaxBytes) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" ) 
+            {
+                uint64_t maxBytes(0);
+                REQUIRE( dsl_source_app_max_level_bytes_get(sourceName.c_str(), 
+                    &maxBytes) == DSL_RESULT_SUCCESS );
+                REQUIRE( maxBytes == newMaxBytes );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "An App Source not-in-use can not push buffers or end-of-stream", "[source-api]" )
+{
+    GIVEN( "A new App Source" ) 
+    {
+        std::wstring sourceName(L"app-source");
+        static uint8_t frame[1280*720*3/2] = {0};
+
+        REQUIRE( dsl_component_list_size() == 0 );
+        REQUIRE( dsl_source_app_new(sourceName.c_str(), true, DSL_VIDEO_FORMAT_I420,
+            1280, 720, 30, 1) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The App Source is not linked" ) 
+        {
+            THEN( "The push and end-of-stream services fail" ) 
+            {
+                REQUIRE( dsl_source_app_buffer_push(sourceName.c_str(), frame, sizeof(frame),
+                    DSL_APP_SOURCE_TIMESTAMP_NONE, DSL_APP_SOURCE_TIMESTAMP_NONE, 
+                    NULL, NULL) == DSL_RESULT_SOURCE_BUFFER_PUSH_FAILED );
+                REQUIRE( dsl_source_app_eos(sourceName.c_str()) == 
+                    DSL_RESULT_SOURCE_BUFFER_PUSH_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The Source API checks for NULL input parameters", "[source-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -615,6 +1074,31 @@ SCENARIO( "The Source API checks for NULL input parameters", "[source-api]" )
                 REQUIRE( dsl_source_decode_uri_get( sourceName.c_str(), NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_decode_uri_set( NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_decode_uri_set( sourceName.c_str(), NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_decode_repeat_enabled_get( NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_decode_repeat_enabled_get( sourceName.c_str(), NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_decode_repeat_enabled_set( NULL, false ) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_source_playlist_new( NULL, NULL, false, 0, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_playlist_new( sourceName.c_str(), NULL, false, 0, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_playlist_index_get( NULL, NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_playlist_index_get( sourceName.c_str(), NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_source_test_new( NULL, false, 0, 0, 0, 0, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_test_pattern_get( NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_test_pattern_get( sourceName.c_str(), NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_test_pattern_set( NULL, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_source_app_new( NULL, false, 0, 0, 0, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_data_handlers_add( NULL, NULL, NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_data_handlers_add( sourceName.c_str(), NULL, NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_data_handlers_add( sourceName.c_str(), need_data_handler, NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_data_handlers_remove( NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_push( NULL, NULL, 0, 0, 0, NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_push( sourceName.c_str(), NULL, 0, 0, 0, buffer_release, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_eos( NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_max_level_bytes_get( NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_max_level_bytes_get( sourceName.c_str(), NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_max_level_bytes_set( NULL, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_source_decode_dewarper_add( NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_decode_dewarper_add( sourceName.c_str(), NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -624,6 +1108,20 @@ SCENARIO( "The Source API checks for NULL input parameters", "[source-api]" )
                 REQUIRE( dsl_source_rtsp_tap_add( sourceName.c_str(), NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_rtsp_tap_remove( NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
 
+                REQUIRE( dsl_source_rtsp_timeout_get( NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_timeout_get( sourceName.c_str(), NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_timeout_set( NULL, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_reconnection_params_get( NULL, NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_reconnection_params_get( sourceName.c_str(), NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_reconnection_params_set( NULL, 0, 0 ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_connection_data_get( NULL, NULL, NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_connection_data_get( sourceName.c_str(), NULL, NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_connection_stats_clear( NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_state_change_listener_add( NULL, NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_state_change_listener_add( sourceName.c_str(), NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_state_change_listener_remove( NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_rtsp_state_change_listener_remove( sourceName.c_str(), NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_source_pause( NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_resume( NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
 
@@ -204,6 +204,193 @@ SCENARIO( "An invalid Component is checked on Record Tap Get/Set", "[tap-api]" )
     }
 }
 
+static void ring_record_complete_listener(uint session, 
+    const wchar_t* file_path, boolean success, void* client_data)
+{
+}
+
+SCENARIO( "The Components container is updated correctly on new Ring Record Tap", "[tap-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring ringRecordTapName(L"ring-record-tap");
+        std::wstring outdir(L"./");
+        uint container(DSL_CONTAINER_MP4);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Ring Record Tap is created" ) 
+        {
+            REQUIRE( dsl_tap_ring_record_new(ringRecordTapName.c_str(), outdir.c_str(),
+                container, DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES, 
+                ring_record_complete_listener) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and default values are updated correctly" ) 
+            {
+                uint64_t ret_max_bytes(0), ret_bytes(99);
+                uint ret_duration(99);
+                boolean ret_is_on(true);
+                REQUIRE( dsl_tap_ring_record_max_bytes_get(ringRecordTapName.c_str(), 
+                    &ret_max_bytes) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_max_bytes == DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES );
+                REQUIRE( dsl_tap_ring_record_cache_level_get(ringRecordTapName.c_str(), 
+                    &ret_bytes, &ret_duration) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_bytes == 0 );
+                REQUIRE( ret_duration == 0 );
+                REQUIRE( dsl_tap_ring_record_is_on_get(ringRecordTapName.c_str(), 
+                    &ret_is_on) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_is_on == false );
+                REQUIRE( dsl_component_list_size() == 1 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A Ring Record Tap's max bytes can be Set/Get and a Session can't start when not in use", 
+    "[tap-api]" )
+{
+    GIVEN( "A new Ring Record Tap" ) 
+    {
+        std::wstring ringRecordTapName(L"ring-record-tap");
+        std::wstring outdir(L"./");
+        uint container(DSL_CONTAINER_MKV);
+
+        REQUIRE( dsl_tap_ring_record_new(ringRecordTapName.c_str(), outdir.c_str(),
+            container, DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES, NULL) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The max bytes is set" ) 
+        {
+            uint64_t new_max_bytes(1024*1024);
+            REQUIRE( dsl_tap_ring_record_max_bytes_set(ringRecordTapName.c_str(), 
+                new_max_bytes) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned and sessions fail to Start/Stop" )
+            {
+                uint64_t ret_max_bytes(0);
+                REQUIRE( dsl_tap_ring_record_max_bytes_get(ringRecordTapName.c_str(), 
+                    &ret_max_bytes) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_max_bytes == new_max_bytes );
+
+                uint session(0);
+                REQUIRE( dsl_tap_ring_record_session_start(ringRecordTapName.c_str(), 
+                    &session, 10, 10, NULL) == DSL_RESULT_TAP_SET_FAILED );
+                REQUIRE( dsl_tap_ring_record_session_stop(ringRecordTapName.c_str()) == 
+                    DSL_RESULT_TAP_SET_FAILED );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "An invalid New parameters are checked on Ring Record Tap create", "[tap-api]" )
+{
+    GIVEN( "An attributes for a new Ring Record Tap" ) 
+    {
+        std::wstring ringRecordTapName(L"ring-record-tap");
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "An invalid Output Directory is specified" ) 
+        {
+            std::wstring outdir(L"/this/is/a/bad/path");
+            uint container(DSL_CONTAINER_MKV);
+
+            THEN( "The New Ring Record Tap fails to create" )
+            {
+                REQUIRE( dsl_tap_ring_record_new(ringRecordTapName.c_str(), outdir.c_str(),
+                    container, DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES, NULL) == 
+                        DSL_RESULT_TAP_FILE_PATH_NOT_FOUND );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "An invalid Container Type is specified" ) 
+        {
+            std::wstring outdir(L"./");
+            uint container(DSL_CONTAINER_MKV+1);
+
+            THEN( "The New Ring Record Tap fails to create" )
+            {
+                REQUIRE( dsl_tap_ring_record_new(ringRecordTapName.c_str(), outdir.c_str(),
+                    container, DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES, NULL) == 
+                        DSL_RESULT_TAP_CONTAINER_VALUE_INVALID );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Components container is updated correctly on new File and RTSP Taps", "[tap-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring fileTapName(L"file-tap");
+        std::wstring filePath(L"./output.mp4");
+        std::wstring rtspTapName(L"rtsp-tap");
+        std::wstring host(L"224.224.255.255");
+        uint udpPort(5400), rtspPort(8554);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new File Tap and RTSP Tap are created" ) 
+        {
+            REQUIRE( dsl_tap_file_new(fileTapName.c_str(), filePath.c_str(),
+                DSL_CODEC_H264, DSL_CONTAINER_MP4) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_tap_rtsp_new(rtspTapName.c_str(), host.c_str(),
+                udpPort, rtspPort, DSL_CODEC_H265) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and server settings are updated correctly" ) 
+            {
+                uint retUdpPort(0), retRtspPort(0), retCodec(0);
+                REQUIRE( dsl_tap_rtsp_server_settings_get(rtspTapName.c_str(), 
+                    &retUdpPort, &retRtspPort, &retCodec) == DSL_RESULT_SUCCESS );
+                REQUIRE( retUdpPort == udpPort );
+                REQUIRE( retRtspPort == rtspPort );
+                REQUIRE( retCodec == DSL_CODEC_H265 );
+                REQUIRE( dsl_tap_rtsp_server_settings_get(fileTapName.c_str(), 
+                    &retUdpPort, &retRtspPort, &retCodec) == 
+                        DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_component_list_size() == 2 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "An invalid New parameters are checked on File and RTSP Tap create", "[tap-api]" )
+{
+    GIVEN( "An attributes for new File and RTSP Taps" ) 
+    {
+        std::wstring fileTapName(L"file-tap");
+        std::wstring filePath(L"./output.mkv");
+        std::wstring rtspTapName(L"rtsp-tap");
+        std::wstring host(L"224.224.255.255");
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "An invalid Codec is specified" ) 
+        {
+            THEN( "The New Taps fail to create" )
+            {
+                REQUIRE( dsl_tap_file_new(fileTapName.c_str(), filePath.c_str(),
+                    DSL_CODEC_MPEG4+1, DSL_CONTAINER_MKV) == DSL_RESULT_TAP_CODEC_VALUE_INVALID );
+                REQUIRE( dsl_tap_rtsp_new(rtspTapName.c_str(), host.c_str(),
+                    5400, 8554, DSL_CODEC_MPEG4) == DSL_RESULT_TAP_CODEC_VALUE_INVALID );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "An invalid Container Type is specified" ) 
+        {
+            THEN( "The New File Tap fails to create" )
+            {
+                REQUIRE( dsl_tap_file_new(fileTapName.c_str(), filePath.c_str(),
+                    DSL_CODEC_H264, DSL_CONTAINER_MKV+1) == DSL_RESULT_TAP_CONTAINER_VALUE_INVALID );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "The Tap API checks for NULL input parameters", "[tap-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -211,7 +398,8 @@ SCENARIO( "The Tap API checks for NULL input parameters", "[tap-api]" )
         std::wstring tapName  = L"test-tap";
         std::wstring otherName  = L"other";
         
-        uint cache_size(0), width(0), height(0);
+        uint cache_size(0), width(0), height(0), session(0), duration(0);
+        uint64_t max_bytes(0), bytes(0);
         boolean is_on(0), reset_done(0), sync(0), async(0);
         
         REQUIRE( dsl_component_list_size() == 0 );
@@ -235,6 +423,29 @@ SCENARIO( "The Tap API checks for NULL input parameters", "[tap-api]" )
 
                 REQUIRE( dsl_tap_record_reset_done_get(NULL, &reset_done) == DSL_RESULT_INVALID_INPUT_PARAM );
 
+                REQUIRE( dsl_tap_ring_record_new(NULL, NULL, 0, 0, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_new(tapName.c_str(), NULL, 0, 0, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_session_start(NULL, &session, 0, 0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_session_start(tapName.c_str(), NULL, 0, 0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_session_stop(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_max_bytes_get(NULL, &max_bytes) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_max_bytes_get(tapName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_max_bytes_set(NULL, max_bytes) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_cache_level_get(NULL, &bytes, &duration) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_cache_level_get(tapName.c_str(), NULL, &duration) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_cache_level_get(tapName.c_str(), &bytes, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_is_on_get(NULL, &is_on) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_ring_record_is_on_get(tapName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_tap_file_new(NULL, NULL, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_file_new(tapName.c_str(), NULL, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_rtsp_new(NULL, NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_rtsp_new(tapName.c_str(), NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_rtsp_server_settings_get(NULL, &width, &height, &duration) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_rtsp_server_settings_get(tapName.c_str(), NULL, &height, &duration) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_rtsp_server_settings_get(tapName.c_str(), &width, NULL, &duration) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tap_rtsp_server_settings_get(tapName.c_str(), &width, &height, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_component_list_size() == 0 );
             }
         }
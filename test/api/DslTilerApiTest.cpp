@@ -287,6 +287,10 @@ SCENARIO( "An invalid Tiler is caught by all Set and Get API calls", "[tiler-api
                 REQUIRE( dsl_tiler_tiles_get(fakeSinkName.c_str(), &rows, &cols) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE);
                 REQUIRE( dsl_tiler_tiles_set(fakeSinkName.c_str(), 1, 1) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE);
 
+                boolean enabled(false);
+                REQUIRE( dsl_tiler_frame_pruning_enabled_get(fakeSinkName.c_str(), &enabled) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE);
+                REQUIRE( dsl_tiler_frame_pruning_enabled_set(fakeSinkName.c_str(), true) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE);
+
                 REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
                 REQUIRE( dsl_component_list_size() == 0 );
             }
@@ -346,6 +350,21 @@ SCENARIO( "A Tiled Display can Set and Get all properties", "[tiler-api]" )
                 REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
             }
         }
+        WHEN( "A Tiler's Frame Pruning is Enabled " ) 
+        {
+            boolean retEnabled(true);
+            REQUIRE( dsl_tiler_frame_pruning_enabled_get(tilerName.c_str(), &retEnabled) == DSL_RESULT_SUCCESS);
+            REQUIRE( retEnabled == false );
+            
+            REQUIRE( dsl_tiler_frame_pruning_enabled_set(tilerName.c_str(), true) == DSL_RESULT_SUCCESS);
+            
+            THEN( "The correct value is returned on Get" ) 
+            {
+                REQUIRE( dsl_tiler_frame_pruning_enabled_get(tilerName.c_str(), &retEnabled) == DSL_RESULT_SUCCESS);
+                REQUIRE( retEnabled == true );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
     }
 }
 
@@ -381,6 +400,11 @@ SCENARIO( "The Tiler API checks for NULL input parameters", "[tiler-api]" )
 
                 REQUIRE( dsl_tiler_source_show_all(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
 
+                boolean enabled(false);
+                REQUIRE( dsl_tiler_frame_pruning_enabled_get(NULL, &enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tiler_frame_pruning_enabled_get(tilerName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tiler_frame_pruning_enabled_set(NULL, enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_component_list_size() == 0 );
             }
         }
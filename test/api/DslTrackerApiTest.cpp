@@ -255,6 +255,118 @@ SCENARIO( "The Trackers Max Dimensions can be queried and updated", "[tracker-ap
     }
 }
 
+SCENARIO( "The Components container is updated correctly on new CPU IOU Tracker", "[tracker-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring trackerName(L"cpu-iou-tracker");
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new CPU IOU Tracker is created" ) 
+        {
+            REQUIRE( dsl_tracker_cpu_iou_new(trackerName.c_str(), 
+                DSL_DEFAULT_CPU_IOU_TRACKER_MAX_AGE, DSL_DEFAULT_CPU_IOU_TRACKER_IOU_THRESHOLD,
+                DSL_DEFAULT_CPU_IOU_TRACKER_MAX_TRACKS) == DSL_RESULT_SUCCESS );
+
+            THEN( "The list size and contents are updated correctly" ) 
+            {
+                REQUIRE( dsl_component_list_size() == 1 );
+                
+                // Max Dimensions are not supported by the CPU IOU Tracker
+                REQUIRE( dsl_tracker_max_dimensions_set(trackerName.c_str(), 
+                    300, 150) == DSL_RESULT_TRACKER_SET_FAILED );
+            }
+        }
+        WHEN( "Invalid settings are used" ) 
+        {
+            THEN( "The CPU IOU Tracker fails to create" ) 
+            {
+                REQUIRE( dsl_tracker_cpu_iou_new(trackerName.c_str(), 
+                    10, 0.0, 128) == DSL_RESULT_TRACKER_SETTINGS_INVALID );
+                REQUIRE( dsl_tracker_cpu_iou_new(trackerName.c_str(), 
+                    10, 1.1, 128) == DSL_RESULT_TRACKER_SETTINGS_INVALID );
+                REQUIRE( dsl_tracker_cpu_iou_new(trackerName.c_str(), 
+                    10, 0.3, 0) == DSL_RESULT_TRACKER_SETTINGS_INVALID );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+    }
+}
+
+SCENARIO( "The CPU IOU Tracker's settings can be queried and updated", "[tracker-api]" )
+{
+    GIVEN( "A new CPU IOU Tracker in memory" ) 
+    {
+        std::wstring trackerName(L"cpu-iou-tracker");
+        std::wstring ktlTrackerName(L"ktl-tracker");
+
+        REQUIRE( dsl_tracker_cpu_iou_new(trackerName.c_str(), 
+            DSL_DEFAULT_CPU_IOU_TRACKER_MAX_AGE, DSL_DEFAULT_CPU_IOU_TRACKER_IOU_THRESHOLD,
+            DSL_DEFAULT_CPU_IOU_TRACKER_MAX_TRACKS) == DSL_RESULT_SUCCESS );
+
+        uint maxAge(0), maxTracks(0);
+        float iouThreshold(0);
+
+        REQUIRE( dsl_tracker_cpu_iou_settings_get(trackerName.c_str(), 
+            &maxAge, &iouThreshold, &maxTracks) == DSL_RESULT_SUCCESS );
+        REQUIRE( maxAge == DSL_DEFAULT_CPU_IOU_TRACKER_MAX_AGE );
+        REQUIRE( iouThreshold == (float)DSL_DEFAULT_CPU_IOU_TRACKER_IOU_THRESHOLD );
+        REQUIRE( maxTracks == DSL_DEFAULT_CPU_IOU_TRACKER_MAX_TRACKS );
+
+        WHEN( "The CPU IOU Tracker's settings are updated" ) 
+        {
+            REQUIRE( dsl_tracker_cpu_iou_settings_set(trackerName.c_str(), 
+                30, 0.5, 64) == DSL_RESULT_SUCCESS );
+
+            THEN( "The new settings are returned on get" ) 
+            {
+                REQUIRE( dsl_tracker_cpu_iou_settings_get(trackerName.c_str(), 
+                    &maxAge, &iouThreshold, &maxTracks) == DSL_RESULT_SUCCESS );
+                REQUIRE( maxAge == 30 );
+                REQUIRE( iouThreshold == 0.5f );
+                REQUIRE( maxTracks == 64 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "Invalid settings or the wrong Tracker type are used" ) 
+        {
+            REQUIRE( dsl_tracker_ktl_new(ktlTrackerName.c_str(), 480, 272) == DSL_RESULT_SUCCESS );
+
+            THEN( "The update fails" ) 
+            {
+                REQUIRE( dsl_tracker_cpu_iou_settings_set(trackerName.c_str(), 
+                    30, 0.0, 64) == DSL_RESULT_TRACKER_SETTINGS_INVALID );
+                REQUIRE( dsl_tracker_cpu_iou_settings_set(trackerName.c_str(), 
+                    30, 0.5, 0) == DSL_RESULT_TRACKER_SETTINGS_INVALID );
+                REQUIRE( dsl_tracker_cpu_iou_settings_get(ktlTrackerName.c_str(), 
+                    &maxAge, &iouThreshold, &maxTracks) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_tracker_cpu_iou_settings_set(ktlTrackerName.c_str(), 
+                    30, 0.5, 64) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The CPU IOU Tracker's GPU ID is set" ) 
+        {
+            uint gpuId(99);
+            
+            THEN( "The update fails and the GPU ID is unchanged" ) 
+            {
+                REQUIRE( dsl_component_gpuid_set(trackerName.c_str(), 
+                    1) == DSL_RESULT_COMPONENT_SET_GPUID_FAILED );
+                REQUIRE( dsl_component_gpuid_get(trackerName.c_str(), 
+                    &gpuId) == DSL_RESULT_SUCCESS );
+                REQUIRE( gpuId == 0 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 static boolean pad_probe_handler_cb1(void* buffer, void* user_data)
 {
 }
@@ -397,6 +509,11 @@ SCENARIO( "The Tracker API checks for NULL input parameters", "[tracker-api]" )
                 REQUIRE( dsl_tracker_iou_new(NULL, NULL, 0,  0) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_tracker_iou_new( trackerName.c_str(), NULL, 0,  0) == DSL_RESULT_INVALID_INPUT_PARAM );
 
+                REQUIRE( dsl_tracker_cpu_iou_new(NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tracker_cpu_iou_settings_get(NULL, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tracker_cpu_iou_settings_get(trackerName.c_str(), NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_tracker_cpu_iou_settings_set(NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+
                 // TODO - have yet to be implemented.
 //                REQUIRE( dsl_tracker_iou_config_file_get(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
 //                REQUIRE( dsl_tracker_iou_config_file_get(trackerName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -61,6 +61,37 @@ print(dsl_source_osd_remove("csi-source"))
 print(dsl_component_delete("csi-source"))
 print(dsl_component_delete("osd"))
 
+##
+## dsl_source_rtsp_timeout_get()
+## dsl_source_rtsp_timeout_set()
+## dsl_source_rtsp_reconnection_params_get()
+## dsl_source_rtsp_reconnection_params_set()
+## dsl_source_rtsp_connection_data_get()
+## dsl_source_rtsp_connection_stats_clear()
+## dsl_source_rtsp_state_change_listener_add()
+## dsl_source_rtsp_state_change_listener_remove()
+##
+print("dsl_source_rtsp_timeout_get")
+print("dsl_source_rtsp_timeout_set")
+print("dsl_source_rtsp_reconnection_params_get")
+print("dsl_source_rtsp_reconnection_params_set")
+print("dsl_source_rtsp_connection_data_get")
+print("dsl_source_rtsp_connection_stats_clear")
+print("dsl_source_rtsp_state_change_listener_add")
+print("dsl_source_rtsp_state_change_listener_remove")
+def rtsp_state_change_listener(prev_state, curr_state, client_data):
+    print(prev_state, curr_state)
+print(dsl_source_rtsp_new("rtsp-source", "rtsp://127.0.0.1:8554/test", DSL_RTP_ALL, 0, 0, 0, 100))
+print(dsl_source_rtsp_timeout_get("rtsp-source"))
+print(dsl_source_rtsp_timeout_set("rtsp-source", 10))
+print(dsl_source_rtsp_reconnection_params_get("rtsp-source"))
+print(dsl_source_rtsp_reconnection_params_set("rtsp-source", 2, 60))
+print(dsl_source_rtsp_connection_data_get("rtsp-source"))
+print(dsl_source_rtsp_connection_stats_clear("rtsp-source"))
+print(dsl_source_rtsp_state_change_listener_add("rtsp-source", rtsp_state_change_listener, None))
+print(dsl_source_rtsp_state_change_listener_remove("rtsp-source", rtsp_state_change_listener))
+print(dsl_component_delete("rtsp-source"))
+
 ##
 ## dsl_source_sink_add()
 ## dsl_source_sink_remove()
@@ -85,6 +116,64 @@ print(dsl_source_decode_uri_set("uri-source", "../../test/streams/sample_1080p_h
 print(dsl_source_decode_uri_get("uri-source"))
 print(dsl_component_delete("uri-source"))
 
+##
+## dsl_source_decode_repeat_enabled_get()
+## dsl_source_decode_repeat_enabled_set()
+##
+print("dsl_source_decode_repeat_enabled_get")
+print("dsl_source_decode_repeat_enabled_set")
+print(dsl_source_uri_new("uri-source", "../../test/streams/sample_1080p_h264.mp4", False, 0, 0, 0))
+print(dsl_source_decode_repeat_enabled_set("uri-source", True))
+print(dsl_source_decode_repeat_enabled_get("uri-source"))
+print(dsl_component_delete("uri-source"))
+
+##
+## dsl_source_playlist_new()
+## dsl_source_playlist_index_get()
+##
+print("dsl_source_playlist_new")
+print("dsl_source_playlist_index_get")
+print(dsl_source_playlist_new("playlist-source", ["../../test/streams/sample_1080p_h264.mp4", 
+    "../../test/streams/sample_1080p_h264.mp4", None], True, 0, 0, 0))
+print(dsl_source_playlist_index_get("playlist-source"))
+print(dsl_component_delete("playlist-source"))
+
+##
+## dsl_source_test_new()
+## dsl_source_test_pattern_get()
+## dsl_source_test_pattern_set()
+##
+print("dsl_source_test_new")
+print("dsl_source_test_pattern_get")
+print("dsl_source_test_pattern_set")
+print(dsl_source_test_new("test-source", False, DSL_TEST_PATTERN_BALL, 1280, 720, 30, 1, 0))
+print(dsl_source_test_pattern_set("test-source", DSL_TEST_PATTERN_SMPTE))
+print(dsl_source_test_pattern_get("test-source"))
+print(dsl_component_delete("test-source"))
+
+##
+## dsl_source_app_new()
+## dsl_source_app_data_handlers_add()
+## dsl_source_app_data_handlers_remove()
+## dsl_source_app_max_level_bytes_get()
+## dsl_source_app_max_level_bytes_set()
+##
+def need_data_handler(length, client_data):
+    print(length)
+def enough_data_handler(client_data):
+    print(client_data)
+print("dsl_source_app_new")
+print("dsl_source_app_data_handlers_add")
+print("dsl_source_app_data_handlers_remove")
+print("dsl_source_app_max_level_bytes_get")
+print("dsl_source_app_max_level_bytes_set")
+print(dsl_source_app_new("app-source", True, DSL_VIDEO_FORMAT_I420, 1280, 720, 30, 1))
+print(dsl_source_app_data_handlers_add("app-source", need_data_handler, enough_data_handler, None))
+print(dsl_source_app_data_handlers_remove("app-source"))
+print(dsl_source_app_max_level_bytes_set("app-source", 4000000))
+print(dsl_source_app_max_level_bytes_get("app-source"))
+print(dsl_component_delete("app-source"))
+
 ##
 ## dsl_source_is_live()
 ##
@@ -151,6 +240,26 @@ print(dsl_gie_primary_kitti_output_enabled_set("primary-gie", True, "./"))
 print(dsl_gie_primary_kitti_output_enabled_set("primary-gie", False, ""))
 print(dsl_component_delete("primary-gie"))
 
+##
+## dsl_gie_primary_interval_adaptive_get()
+## dsl_gie_primary_interval_adaptive_set()
+## dsl_gie_primary_interval_listener_add()
+## dsl_gie_primary_interval_listener_remove()
+##
+print("dsl_gie_primary_interval_adaptive_get")
+print("dsl_gie_primary_interval_adaptive_set")
+print("dsl_gie_primary_interval_listener_add")
+print("dsl_gie_primary_interval_listener_remove")
+def interval_change_listener(prev_interval, curr_interval, client_data):
+    print(prev_interval, curr_interval)
+print(dsl_gie_primary_new("primary-gie", "./test/configs/config_infer_primary_nano.txt", 
+    "./test/models/Primary_Detector_Nano/resnet10.caffemodel", 0))
+print(dsl_gie_primary_interval_adaptive_set("primary-gie", True, 0, 4))
+print(dsl_gie_primary_interval_adaptive_get("primary-gie"))
+print(dsl_gie_primary_interval_listener_add("primary-gie", interval_change_listener, None))
+print(dsl_gie_primary_interval_listener_remove("primary-gie", interval_change_listener))
+print(dsl_component_delete("primary-gie"))
+
 ##
 ## dsl_gie_secondary_new()
 ##
@@ -183,6 +292,19 @@ print("dsl_tracker_iou_new")
 print(dsl_tracker_iou_new("iou-tracker", "./test/configs/iou_config.txt", 300, 150))
 print(dsl_component_delete("iou-tracker"))
 
+##
+## dsl_tracker_cpu_iou_new()
+## dsl_tracker_cpu_iou_settings_set()
+## dsl_tracker_cpu_iou_settings_get()
+##
+print("dsl_tracker_cpu_iou_new")
+print("dsl_tracker_cpu_iou_settings_set")
+print("dsl_tracker_cpu_iou_settings_get")
+print(dsl_tracker_cpu_iou_new("cpu-iou-tracker", 10, 0.3, 128))
+print(dsl_tracker_cpu_iou_settings_set("cpu-iou-tracker", 30, 0.5, 64))
+print(dsl_tracker_cpu_iou_settings_get("cpu-iou-tracker"))
+print(dsl_component_delete("cpu-iou-tracker"))
+
 ##
 ## dsl_tracker_max_dimensions_set()
 ## dsl_tracker_max_dimensions_get()
@@ -310,6 +432,16 @@ print("dsl_tiler_new")
 print(dsl_tiler_new("tiler", 1280, 720))
 print(dsl_component_delete("tiler"))
 
+##
+## dsl_tiler_frame_pruning_enabled_get()
+## dsl_tiler_frame_pruning_enabled_set()
+##
+print("dsl_tiler_frame_pruning_enabled_set")
+print(dsl_tiler_new("tiler", 1280, 720))
+print(dsl_tiler_frame_pruning_enabled_set("tiler", True))
+print(dsl_tiler_frame_pruning_enabled_get("tiler"))
+print(dsl_component_delete("tiler"))
+
 ##
 ## dsl_tiler_batch_meta_handler_add()
 ## dsl_tiler_batch_meta_handler_remove()
@@ -324,6 +456,91 @@ print(dsl_tiler_batch_meta_handler_add("tiler", DSL_PAD_SRC, mb_handler, None))
 print(dsl_tiler_batch_meta_handler_remove("tiler", DSL_PAD_SRC, mb_handler))
 print(dsl_component_delete("tiler"))
 
+##
+## dsl_sink_app_new()
+##
+print("dsl_sink_app_new")
+print("dsl_sink_app_max_buffers_set")
+print("dsl_sink_app_max_buffers_get")
+print("dsl_sink_app_data_release")
+print(dsl_sink_app_new("app-sink", None, None))
+print(dsl_sink_app_max_buffers_set("app-sink", 8, False))
+print(dsl_sink_app_max_buffers_get("app-sink"))
+print(dsl_sink_app_data_release("app-sink"))
+print(dsl_component_delete("app-sink"))
+
+##
+## dsl_sink_meta_new()
+##
+print("dsl_sink_meta_new")
+print("dsl_sink_meta_stats_get")
+print("dsl_sink_meta_stats_clear")
+print(dsl_sink_meta_new("meta-sink", "./meta-sink.bin", DSL_META_SINK_MODE_FILE, 4))
+print(dsl_sink_meta_stats_get("meta-sink"))
+print(dsl_sink_meta_stats_clear("meta-sink"))
+print(dsl_component_delete("meta-sink"))
+
+##
+## dsl_sink_segment_new()
+##
+print("dsl_sink_segment_new")
+print("dsl_sink_segment_max_duration_set")
+print("dsl_sink_segment_max_duration_get")
+print("dsl_sink_segment_max_size_set")
+print("dsl_sink_segment_max_size_get")
+print("dsl_sink_segment_max_files_set")
+print("dsl_sink_segment_max_files_get")
+print("dsl_sink_segment_write_settings_set")
+print("dsl_sink_segment_write_settings_get")
+print(dsl_sink_segment_new("segment-sink", "./output-%05d.mp4", DSL_CODEC_H264, 
+    DSL_CONTAINER_MP4, 2000000, 0, 60, 10))
+print(dsl_sink_segment_max_duration_set("segment-sink", 300))
+print(dsl_sink_segment_max_duration_get("segment-sink"))
+print(dsl_sink_segment_max_size_set("segment-sink", 1073741824))
+print(dsl_sink_segment_max_size_get("segment-sink"))
+print(dsl_sink_segment_max_files_set("segment-sink", 24))
+print(dsl_sink_segment_max_files_get("segment-sink"))
+print(dsl_sink_segment_write_settings_set("segment-sink", 4194304, 5000))
+print(dsl_sink_segment_write_settings_get("segment-sink"))
+print(dsl_component_delete("segment-sink"))
+
+##
+## dsl_tap_ring_record_new()
+##
+print("dsl_tap_ring_record_new")
+print("dsl_tap_ring_record_max_bytes_set")
+print("dsl_tap_ring_record_max_bytes_get")
+print("dsl_tap_ring_record_cache_level_get")
+print("dsl_tap_ring_record_is_on_get")
+def ring_record_complete(session, file_path, success, client_data):
+    print(session, file_path, success)
+print(dsl_tap_ring_record_new("ring-record-tap", "./", DSL_CONTAINER_MP4, 
+    DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES, ring_record_complete))
+print(dsl_tap_ring_record_max_bytes_set("ring-record-tap", 1024*1024))
+print(dsl_tap_ring_record_max_bytes_get("ring-record-tap"))
+print(dsl_tap_ring_record_cache_level_get("ring-record-tap"))
+print(dsl_tap_ring_record_is_on_get("ring-record-tap"))
+print(dsl_component_delete("ring-record-tap"))
+
+##
+## dsl_sink_shared_encode_new()
+##
+print("dsl_sink_shared_encode_new")
+print("dsl_tap_file_new")
+print("dsl_tap_rtsp_new")
+print("dsl_tap_rtsp_server_settings_get")
+print("dsl_sink_shared_encode_tap_add")
+print("dsl_sink_shared_encode_tap_remove")
+print(dsl_sink_shared_encode_new("shared-encode-sink", DSL_CODEC_H264, 2000000, 0))
+print(dsl_tap_file_new("file-tap", "./output.mp4", DSL_CODEC_H264, DSL_CONTAINER_MP4))
+print(dsl_tap_rtsp_new("rtsp-tap", "224.224.255.255", 5400, 8554, DSL_CODEC_H264))
+print(dsl_tap_rtsp_server_settings_get("rtsp-tap"))
+print(dsl_sink_shared_encode_tap_add("shared-encode-sink", "file-tap"))
+print(dsl_sink_shared_encode_tap_add("shared-encode-sink", "rtsp-tap"))
+print(dsl_sink_shared_encode_tap_remove("shared-encode-sink", "file-tap"))
+print(dsl_sink_shared_encode_tap_remove("shared-encode-sink", "rtsp-tap"))
+print(dsl_component_delete_all())
+
 ##
 ## dsl_sink_overlay_new()
 ##
@@ -336,6 +553,22 @@ print(dsl_component_delete("overlay-sink"))
 ##
 print("dsl_sink_window_new")
 print(dsl_sink_window_new("window-sink", 0, 0, 1280, 720))
+
+##
+## dsl_sink_render_max_fps_get()
+## dsl_sink_render_max_fps_set()
+##
+print("dsl_sink_render_max_fps_set")
+print(dsl_sink_render_max_fps_set("window-sink", 5))
+print(dsl_sink_render_max_fps_get("window-sink"))
+
+##
+## dsl_sink_window_pause_when_hidden_get()
+## dsl_sink_window_pause_when_hidden_set()
+##
+print("dsl_sink_window_pause_when_hidden_set")
+print(dsl_sink_window_pause_when_hidden_set("window-sink", True))
+print(dsl_sink_window_pause_when_hidden_get("window-sink"))
 print(dsl_component_delete("window-sink"))
 
 ##
@@ -391,6 +624,20 @@ print(dsl_sink_rtsp_encoder_settings_set("rtsp-sink", 4500000, 5))
 print(dsl_sink_rtsp_server_settings_get("rtsp-sink"))
 print(dsl_component_delete(" rtsp-sink"))
 
+##
+## dsl_sink_rtsp_bitrate_adaptive_get()
+## dsl_sink_rtsp_bitrate_adaptive_set()
+## dsl_sink_rtsp_stream_status_get()
+##
+print("dsl_sink_rtsp_bitrate_adaptive_get")
+print("dsl_sink_rtsp_bitrate_adaptive_set")
+print("dsl_sink_rtsp_stream_status_get")
+print(dsl_sink_rtsp_new("rtsp-sink-2", "224.224.255.255", 5400, 8554, DSL_CODEC_H264, 4000000, 0))
+print(dsl_sink_rtsp_bitrate_adaptive_set("rtsp-sink-2", True, 500000, 6000000))
+print(dsl_sink_rtsp_bitrate_adaptive_get("rtsp-sink-2"))
+print(dsl_sink_rtsp_stream_status_get("rtsp-sink-2"))
+print(dsl_component_delete("rtsp-sink-2"))
+
 ##
 ## dsl_sink_num_in_use_get()
 ##
@@ -491,6 +738,25 @@ print(dsl_pipeline_component_add_many("pipeline", ["tiler", None]))
 print(dsl_pipeline_delete_all())
 print(dsl_component_delete_all())
 
+##
+## dsl_pipeline_source_standby_add()
+## dsl_pipeline_source_standby_attach()
+## dsl_pipeline_source_standby_detach()
+## dsl_pipeline_source_standby_remove()
+##
+print("dsl_pipeline_source_standby_add")
+print("dsl_pipeline_source_standby_attach")
+print("dsl_pipeline_source_standby_detach")
+print("dsl_pipeline_source_standby_remove")
+print(dsl_source_rtsp_new("rtsp-source", "rtsp://127.0.0.1:8554/test", DSL_RTP_ALL, 0, 0, 0, 100))
+print(dsl_pipeline_new("pipeline"))
+print(dsl_pipeline_source_standby_add("pipeline", "rtsp-source"))
+print(dsl_pipeline_source_standby_attach("pipeline", "rtsp-source"))
+print(dsl_pipeline_source_standby_detach("pipeline", "rtsp-source"))
+print(dsl_pipeline_source_standby_remove("pipeline", "rtsp-source"))
+print(dsl_pipeline_delete_all())
+print(dsl_component_delete_all())
+
 ##
 ## dsl_pipeline_streammux_batch_properties_get()
 ##
@@ -521,6 +787,118 @@ print(dsl_pipeline_streammux_padding_get("pipeline"))
 print(dsl_pipeline_streammux_padding_set("pipeline", True))
 print(dsl_pipeline_delete("pipeline"))
 
+##
+## dsl_pipeline_streammux_batch_timeout_adaptive_get()
+## dsl_pipeline_streammux_batch_timeout_adaptive_set()
+## dsl_pipeline_streammux_batch_stats_get()
+##
+print("dsl_pipeline_streammux_batch_timeout_adaptive_get")
+print("dsl_pipeline_streammux_batch_timeout_adaptive_set")
+print("dsl_pipeline_streammux_batch_stats_get")
+print(dsl_pipeline_new("pipeline"))
+print(dsl_pipeline_streammux_batch_timeout_adaptive_get("pipeline"))
+print(dsl_pipeline_streammux_batch_timeout_adaptive_set("pipeline", True, 5000))
+print(dsl_pipeline_streammux_batch_stats_get("pipeline"))
+print(dsl_pipeline_delete("pipeline"))
+
+##
+## dsl_pipeline_streammux_batch_size_adaptive_get()
+## dsl_pipeline_streammux_batch_size_adaptive_set()
+##
+print("dsl_pipeline_streammux_batch_size_adaptive_get")
+print("dsl_pipeline_streammux_batch_size_adaptive_set")
+print(dsl_pipeline_new("pipeline"))
+print(dsl_pipeline_streammux_batch_size_adaptive_get("pipeline"))
+print(dsl_pipeline_streammux_batch_size_adaptive_set("pipeline", True, 2))
+print(dsl_pipeline_delete("pipeline"))
+
+##
+## dsl_pipeline_sgie_cache_settings_get()
+## dsl_pipeline_sgie_cache_settings_set()
+## dsl_pipeline_sgie_cache_stats_get()
+##
+print("dsl_pipeline_sgie_cache_settings_get")
+print("dsl_pipeline_sgie_cache_settings_set")
+print("dsl_pipeline_sgie_cache_stats_get")
+print(dsl_pipeline_new("pipeline"))
+print(dsl_pipeline_sgie_cache_settings_get("pipeline"))
+print(dsl_pipeline_sgie_cache_settings_set("pipeline", True, 30, 0.5))
+print(dsl_pipeline_sgie_cache_stats_get("pipeline"))
+print(dsl_pipeline_delete("pipeline"))
+
+##
+## dsl_pipeline_main_context_enabled_get()
+## dsl_pipeline_main_context_enabled_set()
+##
+print("dsl_pipeline_main_context_enabled_get")
+print("dsl_pipeline_main_context_enabled_set")
+print(dsl_pipeline_new("pipeline"))
+print(dsl_pipeline_main_context_enabled_get("pipeline"))
+print(dsl_pipeline_main_context_enabled_set("pipeline", True))
+print(dsl_pipeline_main_context_enabled_set("pipeline", False))
+print(dsl_pipeline_delete("pipeline"))
+
+##
+## dsl_pipeline_qos_element_stats_get()
+## dsl_pipeline_qos_totals_get()
+## dsl_pipeline_qos_stats_clear()
+## dsl_pipeline_qos_listener_add()
+## dsl_pipeline_qos_listener_remove()
+##
+def qos_listener(element, processed, dropped, jitter, proportion, client_data):
+    print(element, processed, dropped, jitter, proportion)
+print("dsl_pipeline_qos_element_stats_get")
+print("dsl_pipeline_qos_totals_get")
+print("dsl_pipeline_qos_stats_clear")
+print("dsl_pipeline_qos_listener_add")
+print("dsl_pipeline_qos_listener_remove")
+print(dsl_pipeline_new("pipeline"))
+print(dsl_pipeline_qos_element_stats_get("pipeline", "sink"))
+print(dsl_pipeline_qos_totals_get("pipeline"))
+print(dsl_pipeline_qos_stats_clear("pipeline"))
+print(dsl_pipeline_qos_listener_add("pipeline", qos_listener, 10, None))
+print(dsl_pipeline_qos_listener_remove("pipeline", qos_listener))
+print(dsl_pipeline_delete("pipeline"))
+
+##
+## dsl_pipeline_thread_policy_set()
+## dsl_pipeline_thread_policy_remove()
+## dsl_pipeline_thread_report_get()
+##
+print("dsl_pipeline_thread_policy_set")
+print("dsl_pipeline_thread_policy_remove")
+print("dsl_pipeline_thread_report_get")
+print(dsl_pipeline_new("pipeline"))
+print(dsl_pipeline_thread_policy_set("pipeline", None, 0x3, DSL_THREAD_SCHED_OTHER, 0))
+print(dsl_pipeline_thread_report_get("pipeline"))
+print(dsl_pipeline_thread_policy_remove("pipeline", None))
+print(dsl_pipeline_delete("pipeline"))
+
+##
+## dsl_plugin_load()
+## dsl_ode_trigger_plugin_new()
+## dsl_ode_action_plugin_new()
+## dsl_pph_plugin_new()
+## dsl_plugin_delete()
+## dsl_plugin_delete_all()
+## dsl_plugin_list_size()
+##
+print("dsl_plugin_load")
+print("dsl_ode_trigger_plugin_new")
+print("dsl_ode_action_plugin_new")
+print("dsl_pph_plugin_new")
+print("dsl_plugin_delete")
+print("dsl_plugin_delete_all")
+print("dsl_plugin_list_size")
+print(dsl_plugin_load("plugin", "./test/plugins/dsl-test-plugin.so"))
+print(dsl_ode_trigger_plugin_new("plugin-trigger", None, 0, 0, "plugin", ""))
+print(dsl_ode_action_plugin_new("plugin-action", "plugin", ""))
+print(dsl_pph_plugin_new("plugin-pph", "plugin", ""))
+print(dsl_plugin_list_size())
+print(dsl_plugin_delete("plugin"))
+print(dsl_plugin_delete_all())
+print(dsl_pipeline_delete("pipeline"))
+
 ##
 ## dsl_pipeline_xwindow_dimensions_get()
 ## dsl_pipeline_xwindow_dimensions_set()
@@ -625,6 +1003,24 @@ print(dsl_pipeline_new("pipeline"))
 print(dsl_pipeline_xwindow_delete_event_handler_add("pipeline", delete_handler, None))
 print(dsl_pipeline_xwindow_delete_event_handler_remove("pipeline", delete_handler))
 
+##
+## dsl_metrics_http_exporter_start()
+## dsl_metrics_http_exporter_stop()
+## dsl_metrics_file_exporter_start()
+## dsl_metrics_file_exporter_stop()
+## dsl_metrics_list_size()
+##
+print("dsl_metrics_http_exporter_start")
+print("dsl_metrics_http_exporter_stop")
+print("dsl_metrics_file_exporter_start")
+print("dsl_metrics_file_exporter_stop")
+print("dsl_metrics_list_size")
+print(dsl_metrics_http_exporter_start(9464))
+print(dsl_metrics_http_exporter_stop())
+print(dsl_metrics_file_exporter_start("./metrics.prom", 10))
+print(dsl_metrics_file_exporter_stop())
+print(dsl_metrics_list_size())
+
 ##
 ## dsl_main_loop_run()
 ## dsl_main_loop_quit()
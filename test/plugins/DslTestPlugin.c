@@ -0,0 +1,95 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/**
+ * Minimal plugin used by the unit and API tests to exercise the plugin ABI.
+ * Each instance counts its callbacks. The config "fail" fails the create.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "DslPluginApi.h"
+
+typedef struct _test_plugin_instance
+{
+    uint checks;
+    uint occurrences;
+    uint buffers;
+} test_plugin_instance;
+
+static void* test_plugin_create(const char* config)
+{
+    if (strcmp(config, "fail") == 0)
+    {
+        return NULL;
+    }
+    return calloc(1, sizeof(test_plugin_instance));
+}
+
+static void test_plugin_destroy(void* instance)
+{
+    free(instance);
+}
+
+static boolean test_plugin_check_for_occurrence(void* buffer,
+    void* frame_meta, void* object_meta, void* client_data)
+{
+    ((test_plugin_instance*)client_data)->checks++;
+    return true;
+}
+
+static boolean test_plugin_post_process_frame(void* buffer,
+    void* frame_meta, void* client_data)
+{
+    return false;
+}
+
+static void test_plugin_handle_occurrence(uint64_t event_id, const wchar_t* trigger,
+    void* buffer, void* frame_meta, void* object_meta, void* client_data)
+{
+    ((test_plugin_instance*)client_data)->occurrences++;
+}
+
+static boolean test_plugin_handle_buffer(void* buffer, void* client_data)
+{
+    ((test_plugin_instance*)client_data)->buffers++;
+    return true;
+}
+
+static const dsl_plugin_info test_plugin_info = 
+{
+    DSL_PLUGIN_ABI_VERSION,
+    "DSL test plugin",
+    test_plugin_create,
+    test_plugin_destroy,
+    test_plugin_check_for_occurrence,
+    test_plugin_post_process_frame,
+    test_plugin_handle_occurrence,
+    test_plugin_handle_buffer
+};
+
+const dsl_plugin_info* dsl_plugin_info_get()
+{
+    return &test_plugin_info;
+}
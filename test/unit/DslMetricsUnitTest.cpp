@@ -0,0 +1,130 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslMetrics.h"
+
+using namespace DSL;
+
+SCENARIO( "The Metrics Registry publishes counters and gauges", "[MetricsRegistry]" )
+{
+    GIVEN( "The Metrics Registry" ) 
+    {
+        MetricsRegistry* pRegistry = MetricsRegistry::GetRegistry();
+        uint initialSize = pRegistry->GetSize();
+
+        WHEN( "A counter and a gauge are published" )
+        {
+            DSL_METRIC_COUNTER_PTR pCounter = pRegistry->GetCounter(
+                "dsl_test_total", "Test counter", MetricsRegistry::Label("name", "test"));
+            DSL_METRIC_GAUGE_PTR pGauge = pRegistry->GetGauge(
+                "dsl_test_value", "Test gauge", "");
+            
+            pCounter->Increment();
+            pCounter->Increment(2);
+            pGauge->Set(1.5);
+            
+            THEN( "Both are exported in the Prometheus text format" )
+            {
+                REQUIRE( pRegistry->GetSize() == initialSize + 2 );
+                REQUIRE( pCounter->Get() == 3 );
+                
+                std::string text = pRegistry->ToPrometheusText();
+                REQUIRE( text.find("# TYPE dsl_test_total counter\n") != std::string::npos );
+                REQUIRE( text.find("dsl_test_total{name=\"test\"} 3\n") != std::string::npos );
+                REQUIRE( text.find("# TYPE dsl_test_value gauge\n") != std::string::npos );
+                REQUIRE( text.find("dsl_test_value 1.5\n") != std::string::npos );
+                
+                // the same name and labels returns the same counter
+                REQUIRE( pRegistry->GetCounter("dsl_test_total", "Test counter", 
+                    MetricsRegistry::Label("name", "test")) == pCounter );
+            }
+        }
+        WHEN( "A published metric is released by its owner" )
+        {
+            DSL_METRIC_COUNTER_PTR pCounter = pRegistry->GetCounter(
+                "dsl_test_total", "Test counter", "");
+            REQUIRE( pRegistry->GetSize() == initialSize + 1 );
+            
+            pCounter = nullptr;
+            
+            THEN( "The metric is no longer exported" )
+            {
+                REQUIRE( pRegistry->GetSize() == initialSize );
+                REQUIRE( pRegistry->ToPrometheusText().find("dsl_test_total") 
+                    == std::string::npos );
+            }
+        }
+    }
+}
+
+SCENARIO( "Metric labels are escaped correctly", "[MetricsRegistry]" )
+{
+    GIVEN( "A label value with quotes and backslashes" ) 
+    {
+        std::string value("a\"b\\c");
+
+        WHEN( "The label is formatted" )
+        {
+            std::string label = MetricsRegistry::Label("name", value);
+            
+            THEN( "The special characters are escaped" )
+            {
+                REQUIRE( label == "name=\"a\\\"b\\\\c\"" );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Metrics file exporter writes the metrics on start", "[MetricsRegistry]" )
+{
+    GIVEN( "A published counter" ) 
+    {
+        MetricsRegistry* pRegistry = MetricsRegistry::GetRegistry();
+        std::string filePath("./metrics-unit-test.prom");
+        
+        DSL_METRIC_COUNTER_PTR pCounter = pRegistry->GetCounter(
+            "dsl_test_file_total", "Test counter", "");
+        pCounter->Increment(7);
+
+        WHEN( "The file exporter is started" )
+        {
+            REQUIRE( pRegistry->StartFileExporter(filePath.c_str(), 0) == false );
+            REQUIRE( pRegistry->StartFileExporter(filePath.c_str(), 1) == true );
+            REQUIRE( pRegistry->StartFileExporter(filePath.c_str(), 1) == false );
+            
+            THEN( "The file is written and the exporter can be stopped" )
+            {
+                std::ifstream file(filePath);
+                std::stringstream contents;
+                contents << file.rdbuf();
+                REQUIRE( contents.str().find("dsl_test_file_total 7\n") != std::string::npos );
+                
+                REQUIRE( pRegistry->StopFileExporter() == true );
+                REQUIRE( pRegistry->StopFileExporter() == false );
+                remove(filePath.c_str());
+            }
+        }
+    }
+}
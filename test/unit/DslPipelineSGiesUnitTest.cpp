@@ -442,3 +442,160 @@ SCENARIO( "A PipelineSGiesBintr with several SecondaryGieBintrs can UnlinkAll",
         }
     }
 }
+
+static NvDsBatchMeta* CreateSGiesTestBatchMeta(int primaryUniqueId, 
+    gint frameNum, std::vector<guint64> objectIds)
+{
+    NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1, 1);
+    NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+    pFrameMeta->source_id = 0;
+    pFrameMeta->frame_num = frameNum;
+    nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+    
+    for (auto const& objectId: objectIds)
+    {
+        NvDsObjectMeta* pObjectMeta = nvds_acquire_obj_meta_from_pool(pBatchMeta);
+        pObjectMeta->unique_component_id = primaryUniqueId;
+        pObjectMeta->object_id = objectId;
+        nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+    }
+    return pBatchMeta;
+}
+
+static void AddSGiesTestClassifierMeta(NvDsBatchMeta* pBatchMeta, 
+    NvDsObjectMeta* pObjectMeta, int secondaryUniqueId, const char* label, float prob)
+{
+    NvDsClassifierMeta* pClassifierMeta = nvds_acquire_classifier_meta_from_pool(pBatchMeta);
+    pClassifierMeta->unique_component_id = secondaryUniqueId;
+    
+    NvDsLabelInfo* pLabelInfo = nvds_acquire_label_info_meta_from_pool(pBatchMeta);
+    pLabelInfo->result_prob = prob;
+    g_strlcpy(pLabelInfo->result_label, label, MAX_LABEL_SIZE);
+    nvds_add_label_info_meta_to_classifier(pClassifierMeta, pLabelInfo);
+    
+    nvds_add_classifier_meta_to_object(pObjectMeta, pClassifierMeta);
+}
+
+SCENARIO( "A PipelineSGiesBintr can Get and Set its result cache settings", "[PipelineSGiesBintr]" )
+{
+    GIVEN( "A new PipelineSGiesBintr" ) 
+    {
+        std::string pipelineSGiesName = "pipeline-sgies";
+
+        DSL_PIPELINE_SGIES_PTR pPipelineSGiesBintr = 
+            DSL_PIPELINE_SGIES_NEW(pipelineSGiesName.c_str());
+            
+        bool enabled(true);
+        uint maxAge(0);
+        float minConfidence(0);
+        
+        pPipelineSGiesBintr->GetCacheSettings(&enabled, &maxAge, &minConfidence);
+        REQUIRE( enabled == false );
+        REQUIRE( maxAge == DSL_DEFAULT_SGIE_CACHE_MAX_AGE );
+        REQUIRE( minConfidence == (float)DSL_DEFAULT_SGIE_CACHE_MIN_CONFIDENCE );
+
+        WHEN( "The result cache settings are updated" )
+        {
+            REQUIRE( pPipelineSGiesBintr->SetCacheSettings(true, 10, 0.8) == true );
+            
+            THEN( "The correct settings are returned on get" )
+            {
+                pPipelineSGiesBintr->GetCacheSettings(&enabled, &maxAge, &minConfidence);
+                REQUIRE( enabled == true );
+                REQUIRE( maxAge == 10 );
+                REQUIRE( minConfidence == 0.8f );
+            }
+        }
+        WHEN( "An invalid min confidence is used" )
+        {
+            THEN( "The update fails" )
+            {
+                REQUIRE( pPipelineSGiesBintr->SetCacheSettings(true, 10, 1.2) == false );
+                REQUIRE( pPipelineSGiesBintr->SetCacheSettings(true, 10, -0.1) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A PipelineSGiesBintr reuses fresh cached results for tracked objects", "[PipelineSGiesBintr]" )
+{
+    GIVEN( "A new PipelineSGiesBintr with its result cache enabled" ) 
+    {
+        std::string pipelineSGiesName = "pipeline-sgies";
+        int primaryUniqueId(1234);
+        int secondaryUniqueId(5678);
+        uint maxAge(2);
+
+        DSL_PIPELINE_SGIES_PTR pPipelineSGiesBintr = 
+            DSL_PIPELINE_SGIES_NEW(pipelineSGiesName.c_str());
+        pPipelineSGiesBintr->SetInferOnGieId(primaryUniqueId);
+        REQUIRE( pPipelineSGiesBintr->SetCacheSettings(true, maxAge, 0.5) == true );
+        
+        // First frame, nothing cached. Both objects are inferred on with
+        // the second object's result below the min confidence
+        NvDsBatchMeta* pBatchMeta = 
+            CreateSGiesTestBatchMeta(primaryUniqueId, 0, {1, 2});
+        REQUIRE( pPipelineSGiesBintr->SkipCachedObjects(pBatchMeta) == 0 );
+        
+        NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)pBatchMeta->frame_meta_list->data;
+        AddSGiesTestClassifierMeta(pBatchMeta, 
+            (NvDsObjectMeta*)pFrameMeta->obj_meta_list->data, secondaryUniqueId, "red", 0.9);
+        AddSGiesTestClassifierMeta(pBatchMeta, 
+            (NvDsObjectMeta*)pFrameMeta->obj_meta_list->next->data, secondaryUniqueId, "blue", 0.3);
+        REQUIRE( pPipelineSGiesBintr->UpdateCachedObjects(pBatchMeta) == 0 );
+        nvds_destroy_batch_meta(pBatchMeta);
+        
+        WHEN( "The tracked objects are seen within the max age" )
+        {
+            pBatchMeta = CreateSGiesTestBatchMeta(primaryUniqueId, maxAge, {1, 2});
+            pFrameMeta = (NvDsFrameMeta*)pBatchMeta->frame_meta_list->data;
+            NvDsObjectMeta* pObjectMeta1 = (NvDsObjectMeta*)pFrameMeta->obj_meta_list->data;
+            NvDsObjectMeta* pObjectMeta2 = (NvDsObjectMeta*)pFrameMeta->obj_meta_list->next->data;
+            
+            THEN( "Only the object with a confident result is skipped and restored" )
+            {
+                REQUIRE( pPipelineSGiesBintr->SkipCachedObjects(pBatchMeta) == 1 );
+                REQUIRE( pObjectMeta1->unique_component_id == DSL_SGIE_CACHE_SKIPPED_COMPONENT_ID );
+                REQUIRE( pObjectMeta2->unique_component_id == primaryUniqueId );
+                
+                REQUIRE( pPipelineSGiesBintr->UpdateCachedObjects(pBatchMeta) == 1 );
+                REQUIRE( pObjectMeta1->unique_component_id == primaryUniqueId );
+                REQUIRE( g_list_length(pObjectMeta1->classifier_meta_list) == 1 );
+                
+                NvDsClassifierMeta* pClassifierMeta = 
+                    (NvDsClassifierMeta*)pObjectMeta1->classifier_meta_list->data;
+                REQUIRE( pClassifierMeta->unique_component_id == secondaryUniqueId );
+                NvDsLabelInfo* pLabelInfo = (NvDsLabelInfo*)pClassifierMeta->label_info_list->data;
+                REQUIRE( std::string(pLabelInfo->result_label) == "red" );
+                REQUIRE( pLabelInfo->result_prob == 0.9f );
+                
+                uint64_t hits(0), misses(0);
+                pPipelineSGiesBintr->GetCacheStats(&hits, &misses);
+                REQUIRE( hits == 1 );
+                REQUIRE( misses == 3 );
+                
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+        }
+        WHEN( "The tracked objects are seen after the max age" )
+        {
+            pBatchMeta = CreateSGiesTestBatchMeta(primaryUniqueId, maxAge+1, {1, 2});
+            
+            THEN( "No objects are skipped" )
+            {
+                REQUIRE( pPipelineSGiesBintr->SkipCachedObjects(pBatchMeta) == 0 );
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+        }
+        WHEN( "The objects are detected but not tracked" )
+        {
+            pBatchMeta = CreateSGiesTestBatchMeta(primaryUniqueId, 1, {UNTRACKED_OBJECT_ID});
+            
+            THEN( "No objects are skipped" )
+            {
+                REQUIRE( pPipelineSGiesBintr->SkipCachedObjects(pBatchMeta) == 0 );
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+        }
+    }
+}
@@ -255,6 +255,78 @@ SCENARIO( "Unlinking multiple Sources from a StreamMux is managed correctly", "[
     }
 }
 
+SCENARIO( "The Adaptive Batch Timeout is managed correctly on Link and Unlink", "[PipelineSourcesBintr]" )
+{
+    GIVEN( "A Pipeline Sources Bintr with multiple Sources in memory" ) 
+    {
+        std::string pipelineSourcesName = "pipeline-sources";
+        std::string sourceName0 = "csi-source-0";
+        std::string sourceName1 = "csi-source-1";
+        uint batchTimeout(0);
+        double fillRatio(0);
+
+        DSL_PIPELINE_SOURCES_PTR pPipelineSourcesBintr = 
+            DSL_PIPELINE_SOURCES_NEW(pipelineSourcesName.c_str());
+
+        std::shared_ptr<DSL::CsiSourceBintr> pSourceBintr0 = 
+            std::shared_ptr<DSL::CsiSourceBintr>(new DSL::CsiSourceBintr(
+            sourceName0.c_str(), 1280, 720, 30, 1));
+
+        std::shared_ptr<DSL::CsiSourceBintr> pSourceBintr1 = 
+            std::shared_ptr<DSL::CsiSourceBintr>(new DSL::CsiSourceBintr(
+            sourceName1.c_str(), 1280, 720, 30, 1));
+
+        REQUIRE( pPipelineSourcesBintr->AddChild(std::dynamic_pointer_cast<SourceBintr>(pSourceBintr0)) == true );
+        REQUIRE( pPipelineSourcesBintr->AddChild(std::dynamic_pointer_cast<SourceBintr>(pSourceBintr1)) == true );
+        
+        pPipelineSourcesBintr->SetStreamMuxBatchProperties(2, 40000);
+        REQUIRE( pPipelineSourcesBintr->SetStreamMuxBatchTimeoutAdaptive(true, 1000) == true );
+                    
+        WHEN( "All Sources are linked to the StreamMux" )
+        {
+            REQUIRE( pPipelineSourcesBintr->LinkAll() == true );
+            
+            THEN( "The adaptive settings can't be updated and the configured timeout is in use" )
+            {
+                REQUIRE( pPipelineSourcesBintr->SetStreamMuxBatchTimeoutAdaptive(false, 1000) == false );
+                
+                pPipelineSourcesBintr->GetStreamMuxBatchStats(&batchTimeout, &fillRatio);
+                REQUIRE( batchTimeout == 40000 );
+                REQUIRE( fillRatio == 0 );
+                
+                pPipelineSourcesBintr->UnlinkAll();
+                REQUIRE( pPipelineSourcesBintr->SetStreamMuxBatchTimeoutAdaptive(false, 1000) == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "A SourceArrivalMeter measures the arrival interval and jitter correctly", "[PipelineSourcesBintr]" )
+{
+    GIVEN( "A new SourceArrivalMeter" ) 
+    {
+        DSL_SOURCE_ARRIVAL_METER_PTR pArrivalMeter = DSL_SOURCE_ARRIVAL_METER_NEW(0);
+
+        REQUIRE( pArrivalMeter->IsLive(0, 1000000) == false );
+        
+        WHEN( "Buffers arrive at a fixed interval" )
+        {
+            for (gint64 now = 1000000; now <= 2000000; now += 40000)
+            {
+                pArrivalMeter->Timestamp(now);
+            }
+            
+            THEN( "The interval is measured with zero jitter" )
+            {
+                REQUIRE( pArrivalMeter->GetAvgInterval() == 40000 );
+                REQUIRE( pArrivalMeter->GetAvgJitter() == 0 );
+                REQUIRE( pArrivalMeter->IsLive(2040000, 160000) == true );
+                REQUIRE( pArrivalMeter->IsLive(2200000, 160000) == false );
+            }
+        }
+    }
+}
+
 SCENARIO( "All GST Resources are released on PipelineSourcesBintr destruction", "[PipelineSourcesBintr]" )
 {
     GIVEN( "Attributes for a new PipelineSourcesBintr and several new SourcesBintrs" ) 
@@ -1186,3 +1186,319 @@ SCENARIO( "A Pipeline is able to LinkAll/UnlinkAll with a Demuxer, Primary GIE,
         }
     }
 }
+
+SCENARIO( "A Pipeline can run its bus watch in its own main-context", "[PipelineBintr]" )
+{
+    GIVEN( "A new Pipeline with its main-context disabled" ) 
+    {
+        std::string pipelineName = "pipeline";
+
+        DSL_PIPELINE_PTR pPipelineBintr = DSL_PIPELINE_NEW(pipelineName.c_str());
+
+        REQUIRE( pPipelineBintr->GetMainContextEnabled() == false );
+
+        WHEN( "The Pipeline's main-context is enabled" )
+        {
+            REQUIRE( pPipelineBintr->SetMainContextEnabled(true) == true );
+            REQUIRE( pPipelineBintr->GetMainContextEnabled() == true );
+
+            THEN( "The main-context can be disabled and its thread stopped" )
+            {
+                REQUIRE( pPipelineBintr->SetMainContextEnabled(false) == true );
+                REQUIRE( pPipelineBintr->GetMainContextEnabled() == false );
+            }
+        }
+    }
+}
+
+static std::atomic<GThread*> pipelineTimeoutThread(NULL);
+
+static int pipeline_timeout_handler(gpointer pData)
+{
+    pipelineTimeoutThread = g_thread_self();
+    return false;
+}
+
+SCENARIO( "A Pipeline's component timers run on the Pipeline's main-context", "[PipelineBintr]" )
+{
+    GIVEN( "A new Pipeline with a Tiler" ) 
+    {
+        std::string pipelineName = "pipeline";
+        std::string tilerName = "tiler";
+
+        DSL_PIPELINE_PTR pPipelineBintr = DSL_PIPELINE_NEW(pipelineName.c_str());
+        DSL_TILER_PTR pTilerBintr = DSL_TILER_NEW(tilerName.c_str(), 1280, 720);
+
+        REQUIRE( pTilerBintr->AddToParent(pPipelineBintr) == true );
+        REQUIRE( GetPipelineMainContext(pTilerBintr->GetGstObject()) == NULL );
+
+        WHEN( "The Pipeline's main-context is enabled" )
+        {
+            REQUIRE( pPipelineBintr->SetMainContextEnabled(true) == true );
+            REQUIRE( GetPipelineMainContext(pTilerBintr->GetGstObject()) != NULL );
+
+            THEN( "A timer added for the Tiler is dispatched by the Pipeline's thread" )
+            {
+                // The default main loop is not run by the unit tests
+                GSource* pSource = AddPipelineTimeout(pTilerBintr->GetGstObject(), 
+                    10, pipeline_timeout_handler, NULL);
+                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                RemovePipelineTimeout(pSource);
+                
+                REQUIRE( pipelineTimeoutThread != NULL );
+                REQUIRE( pipelineTimeoutThread != g_thread_self() );
+
+                REQUIRE( pPipelineBintr->SetMainContextEnabled(false) == true );
+                REQUIRE( GetPipelineMainContext(pTilerBintr->GetGstObject()) == NULL );
+            }
+        }
+    }
+}
+
+static uint qosListenerCallCount(0);
+static uint64_t qosListenerDropped(0);
+
+static void pipeline_qos_listener(const wchar_t* element, uint64_t processed, 
+    uint64_t dropped, int64_t jitter, double proportion, void* client_data)
+{
+    qosListenerCallCount++;
+    qosListenerDropped = dropped;
+}
+
+static GstMessage* new_test_qos_message(GstElement* pElement, 
+    uint64_t processed, uint64_t dropped, int64_t jitter)
+{
+    GstMessage* pMessage = gst_message_new_qos(GST_OBJECT(pElement), true, 
+        0, 0, 0, GST_SECOND/30);
+    gst_message_set_qos_stats(pMessage, GST_FORMAT_BUFFERS, processed, dropped);
+    gst_message_set_qos_values(pMessage, jitter, 0.9, 1000000);
+    return pMessage;
+}
+
+SCENARIO( "A Pipeline accumulates QoS counters from QoS messages", "[PipelineBintr]" )
+{
+    GIVEN( "A new Pipeline and an element posting QoS messages" ) 
+    {
+        std::string pipelineName = "pipeline";
+
+        DSL_PIPELINE_PTR pPipelineBintr = DSL_PIPELINE_NEW(pipelineName.c_str());
+        
+        GstElement* pSink = gst_element_factory_make("fakesink", "test-sink");
+        REQUIRE( pSink != NULL );
+        
+        QosElementStats stats;
+        REQUIRE( pPipelineBintr->GetQosElementStats("/test-sink", &stats) == false );
+        
+        qosListenerCallCount = 0;
+        REQUIRE( pPipelineBintr->AddQosListener(pipeline_qos_listener, 0, NULL) == false );
+        REQUIRE( pPipelineBintr->AddQosListener(pipeline_qos_listener, 5, NULL) == true );
+
+        WHEN( "QoS messages are handled by the Pipeline's bus watch" )
+        {
+            GstMessage* pMessage = new_test_qos_message(pSink, 100, 2, -4000);
+            pPipelineBintr->HandleBusWatchMessage(pMessage);
+            gst_message_unref(pMessage);
+
+            pMessage = new_test_qos_message(pSink, 200, 8, 4000);
+            pPipelineBintr->HandleBusWatchMessage(pMessage);
+            gst_message_unref(pMessage);
+
+            THEN( "The counters are updated and the listener is called on threshold" )
+            {
+                REQUIRE( pPipelineBintr->GetQosElementStats("/test-sink", &stats) == true );
+                REQUIRE( stats.processed == 200 );
+                REQUIRE( stats.dropped == 8 );
+                REQUIRE( stats.jitter == 4000 );
+                REQUIRE( stats.proportion == 0.9 );
+                REQUIRE( stats.messages == 2 );
+                
+                uint elements(0);
+                uint64_t dropped(0);
+                pPipelineBintr->GetQosTotals(&elements, &dropped);
+                REQUIRE( elements == 1 );
+                REQUIRE( dropped == 8 );
+                
+                REQUIRE( qosListenerCallCount == 1 );
+                REQUIRE( qosListenerDropped == 8 );
+                
+                pPipelineBintr->ClearQosStats();
+                REQUIRE( pPipelineBintr->GetQosElementStats("/test-sink", &stats) == false );
+                
+                REQUIRE( pPipelineBintr->RemoveQosListener(pipeline_qos_listener) == true );
+                REQUIRE( pPipelineBintr->RemoveQosListener(pipeline_qos_listener) == false );
+                gst_object_unref(pSink);
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline keeps separate QoS counters for two Sinks of the same type", "[PipelineBintr]" )
+{
+    GIVEN( "A new Pipeline and two Fake Sinks with the same element names" ) 
+    {
+        std::string pipelineName = "pipeline";
+
+        DSL_PIPELINE_PTR pPipelineBintr = DSL_PIPELINE_NEW(pipelineName.c_str());
+        
+        DSL_FAKE_SINK_PTR pSinkBintr1 = DSL_FAKE_SINK_NEW("fake-sink-1");
+        DSL_FAKE_SINK_PTR pSinkBintr2 = DSL_FAKE_SINK_NEW("fake-sink-2");
+        
+        GstElement* pSink1 = gst_bin_get_by_name(
+            GST_BIN(pSinkBintr1->GetGstElement()), "sink-bin-fake");
+        GstElement* pSink2 = gst_bin_get_by_name(
+            GST_BIN(pSinkBintr2->GetGstElement()), "sink-bin-fake");
+        REQUIRE( pSink1 != NULL );
+        REQUIRE( pSink2 != NULL );
+
+        WHEN( "Both Sinks post QoS messages" )
+        {
+            GstMessage* pMessage = new_test_qos_message(pSink1, 100, 2, 0);
+            pPipelineBintr->HandleBusWatchMessage(pMessage);
+            gst_message_unref(pMessage);
+
+            pMessage = new_test_qos_message(pSink2, 50, 7, 0);
+            pPipelineBintr->HandleBusWatchMessage(pMessage);
+            gst_message_unref(pMessage);
+
+            THEN( "The counters are kept by element path and not merged" )
+            {
+                QosElementStats stats;
+                REQUIRE( pPipelineBintr->GetQosElementStats("sink-bin-fake", &stats) == false );
+                
+                REQUIRE( pPipelineBintr->GetQosElementStats(
+                    "/fake-sink-1/sink-bin-fake", &stats) == true );
+                REQUIRE( stats.processed == 100 );
+                REQUIRE( stats.dropped == 2 );
+                
+                REQUIRE( pPipelineBintr->GetQosElementStats(
+                    "/fake-sink-2/sink-bin-fake", &stats) == true );
+                REQUIRE( stats.processed == 50 );
+                REQUIRE( stats.dropped == 7 );
+                
+                uint elements(0);
+                uint64_t dropped(0);
+                pPipelineBintr->GetQosTotals(&elements, &dropped);
+                REQUIRE( elements == 2 );
+                REQUIRE( dropped == 9 );
+                
+                gst_object_unref(pSink1);
+                gst_object_unref(pSink2);
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline tracks its streaming threads from stream-status messages", "[PipelineBintr]" )
+{
+    GIVEN( "A new Pipeline with a default thread policy" ) 
+    {
+        std::string pipelineName = "pipeline";
+
+        DSL_PIPELINE_PTR pPipelineBintr = DSL_PIPELINE_NEW(pipelineName.c_str());
+        
+        GstElement* pQueue = gst_element_factory_make("queue", "test-queue");
+        REQUIRE( pQueue != NULL );
+        
+        // Leave the affinity unchanged and keep the current nice value
+        ThreadPolicy policy = {0, DSL_THREAD_SCHED_OTHER, 0};
+        REQUIRE( pPipelineBintr->SetThreadPolicy("", policy) == true );
+
+        WHEN( "The current thread posts a stream-status ENTER message" )
+        {
+            GstMessage* pMessage = gst_message_new_stream_status(GST_OBJECT(pQueue),
+                GST_STREAM_STATUS_TYPE_ENTER, pQueue);
+            pPipelineBintr->HandleBusSyncMessage(pMessage);
+            gst_message_unref(pMessage);
+
+            THEN( "The thread is reported until a LEAVE message is posted" )
+            {
+                std::string tid("tid=" + std::to_string(syscall(SYS_gettid)));
+                std::string report(pPipelineBintr->GetThreadReport());
+                REQUIRE( report.find(tid) != std::string::npos );
+                REQUIRE( report.find("element=/test-queue") != std::string::npos );
+                REQUIRE( report.find("policy=default") != std::string::npos );
+
+                pMessage = gst_message_new_stream_status(GST_OBJECT(pQueue),
+                    GST_STREAM_STATUS_TYPE_LEAVE, pQueue);
+                pPipelineBintr->HandleBusSyncMessage(pMessage);
+                gst_message_unref(pMessage);
+                
+                REQUIRE( std::string(pPipelineBintr->GetThreadReport()) == "" );
+                REQUIRE( pPipelineBintr->RemoveThreadPolicy("") == true );
+                REQUIRE( pPipelineBintr->RemoveThreadPolicy("") == false );
+                gst_object_unref(pQueue);
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline restores a streaming thread's affinity when its policy no longer applies", "[PipelineBintr]" )
+{
+    GIVEN( "A new Pipeline with a default thread policy pinning to a single CPU" ) 
+    {
+        std::string pipelineName = "pipeline";
+
+        DSL_PIPELINE_PTR pPipelineBintr = DSL_PIPELINE_NEW(pipelineName.c_str());
+        
+        GstElement* pQueue = gst_element_factory_make("queue", "test-queue");
+        REQUIRE( pQueue != NULL );
+        
+        pid_t tid = syscall(SYS_gettid);
+        cpu_set_t origCpuSet, cpuSet;
+        REQUIRE( sched_getaffinity(tid, sizeof(origCpuSet), &origCpuSet) == 0 );
+        
+        uint cpu(0);
+        while (!CPU_ISSET(cpu, &origCpuSet))
+        {
+            cpu++;
+        }
+        REQUIRE( cpu < 64 );
+        
+        // Keep the current nice value, so that no privilege is required
+        ThreadPolicy policy = {1ULL << cpu, DSL_THREAD_SCHED_OTHER, 
+            getpriority(PRIO_PROCESS, tid)};
+        REQUIRE( pPipelineBintr->SetThreadPolicy("", policy) == true );
+
+        GstMessage* pMessage = gst_message_new_stream_status(GST_OBJECT(pQueue),
+            GST_STREAM_STATUS_TYPE_ENTER, pQueue);
+        pPipelineBintr->HandleBusSyncMessage(pMessage);
+        gst_message_unref(pMessage);
+        
+        REQUIRE( sched_getaffinity(tid, sizeof(cpuSet), &cpuSet) == 0 );
+        REQUIRE( CPU_COUNT(&cpuSet) == 1 );
+        REQUIRE( CPU_ISSET(cpu, &cpuSet) );
+
+        WHEN( "The thread policy is removed" )
+        {
+            REQUIRE( pPipelineBintr->RemoveThreadPolicy("") == true );
+
+            THEN( "The thread's original affinity is restored" )
+            {
+                REQUIRE( sched_getaffinity(tid, sizeof(cpuSet), &cpuSet) == 0 );
+                REQUIRE( CPU_EQUAL(&cpuSet, &origCpuSet) );
+                
+                pMessage = gst_message_new_stream_status(GST_OBJECT(pQueue),
+                    GST_STREAM_STATUS_TYPE_LEAVE, pQueue);
+                pPipelineBintr->HandleBusSyncMessage(pMessage);
+                gst_message_unref(pMessage);
+                gst_object_unref(pQueue);
+            }
+        }
+        WHEN( "The thread posts a stream-status LEAVE message" )
+        {
+            pMessage = gst_message_new_stream_status(GST_OBJECT(pQueue),
+                GST_STREAM_STATUS_TYPE_LEAVE, pQueue);
+            pPipelineBintr->HandleBusSyncMessage(pMessage);
+            gst_message_unref(pMessage);
+
+            THEN( "The thread's original affinity is restored" )
+            {
+                REQUIRE( sched_getaffinity(tid, sizeof(cpuSet), &cpuSet) == 0 );
+                REQUIRE( CPU_EQUAL(&cpuSet, &origCpuSet) );
+                
+                REQUIRE( pPipelineBintr->RemoveThreadPolicy("") == true );
+                gst_object_unref(pQueue);
+            }
+        }
+    }
+}
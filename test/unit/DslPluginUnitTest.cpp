@@ -0,0 +1,156 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslPlugin.h"
+#include "DslOdeAction.h"
+
+using namespace DSL;
+
+static const std::string testPluginPath("./test/plugins/dsl-test-plugin.so");
+
+// Must match the instance layout in ./test/plugins/DslTestPlugin.c
+typedef struct _test_plugin_instance
+{
+    uint checks;
+    uint occurrences;
+    uint buffers;
+} test_plugin_instance;
+
+SCENARIO( "A new Plugin is loaded correctly", "[Plugin]" )
+{
+    GIVEN( "Attributes for a new Plugin" ) 
+    {
+        std::string pluginName("test-plugin");
+
+        WHEN( "A new Plugin is created from a valid shared object" )
+        {
+            DSL_PLUGIN_PTR pPlugin = DSL_PLUGIN_NEW(pluginName.c_str(), 
+                testPluginPath.c_str());
+
+            THEN( "The Plugin's members are setup and returned correctly" )
+            {
+                std::string retName = pPlugin->GetName();
+                REQUIRE( pluginName == retName );
+                
+                const dsl_plugin_info* pInfo = pPlugin->GetInfo();
+                REQUIRE( pInfo != NULL );
+                REQUIRE( pInfo->abi_version == DSL_PLUGIN_ABI_VERSION );
+                REQUIRE( pInfo->create != NULL );
+                REQUIRE( pInfo->destroy != NULL );
+            }
+        }
+        WHEN( "A new Plugin is created from an invalid path" )
+        {
+            DSL_PLUGIN_PTR pPlugin = DSL_PLUGIN_NEW(pluginName.c_str(), 
+                "./test/plugins/non-existent.so");
+
+            THEN( "The Plugin fails to load" )
+            {
+                REQUIRE( pPlugin->GetInfo() == NULL );
+            }
+        }
+    }
+}
+
+SCENARIO( "A PluginInstance is created and destroyed correctly", "[Plugin]" )
+{
+    GIVEN( "A new Plugin" ) 
+    {
+        std::string pluginName("test-plugin");
+
+        DSL_PLUGIN_PTR pPlugin = DSL_PLUGIN_NEW(pluginName.c_str(), 
+            testPluginPath.c_str());
+        REQUIRE( pPlugin->GetInfo() != NULL );
+
+        WHEN( "A new PluginInstance is created with a valid config" )
+        {
+            DSL_PLUGIN_INSTANCE_PTR pInstance = 
+                DSL_PLUGIN_INSTANCE_NEW(pPlugin, "");
+
+            THEN( "The plugin's create function returns a handle" )
+            {
+                REQUIRE( pInstance->GetInfo() == pPlugin->GetInfo() );
+                REQUIRE( pInstance->GetHandle() != NULL );
+            }
+        }
+        WHEN( "A new PluginInstance is created with a config the plugin rejects" )
+        {
+            DSL_PLUGIN_INSTANCE_PTR pInstance = 
+                DSL_PLUGIN_INSTANCE_NEW(pPlugin, "fail");
+
+            THEN( "The handle is NULL" )
+            {
+                REQUIRE( pInstance->GetHandle() == NULL );
+            }
+        }
+    }
+}
+
+SCENARIO( "A PluginOdeAction handles an ODE Occurence correctly", "[Plugin]" )
+{
+    GIVEN( "A new PluginOdeAction" ) 
+    {
+        std::string odeTriggerName("first-occurence");
+        std::string source;
+        uint classId(1);
+        uint limit(1);
+
+        std::string actionName("ode-action");
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        DSL_PLUGIN_PTR pPlugin = DSL_PLUGIN_NEW("test-plugin", 
+            testPluginPath.c_str());
+        DSL_PLUGIN_INSTANCE_PTR pInstance = 
+            DSL_PLUGIN_INSTANCE_NEW(pPlugin, "");
+            
+        DSL_ODE_ACTION_PLUGIN_PTR pAction = 
+            DSL_ODE_ACTION_PLUGIN_NEW(actionName.c_str(), pInstance);
+
+        WHEN( "A new ODE is created" )
+        {
+            NvDsFrameMeta frameMeta =  {0};
+            frameMeta.bInferDone = true;  // required to process
+            frameMeta.frame_num = 444;
+            frameMeta.ntp_timestamp = INT64_MAX;
+            frameMeta.source_id = 2;
+
+            NvDsObjectMeta objectMeta = {0};
+            objectMeta.class_id = classId;
+            objectMeta.object_id = INT64_MAX; 
+            
+            THEN( "The plugin's occurrence handler is called with its instance" )
+            {
+                pAction->HandleOccurrence(pTrigger, NULL, NULL, &frameMeta, &objectMeta);
+                
+                test_plugin_instance* pTestInstance = 
+                    (test_plugin_instance*)pInstance->GetHandle();
+                REQUIRE( pTestInstance->occurrences == 1 );
+            }
+        }
+    }
+}
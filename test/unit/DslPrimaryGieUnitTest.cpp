@@ -311,3 +311,149 @@ SCENARIO( "A PrimaryGieBintr in a Linked state fails to Set its Interval",  "[Pr
     }
 }
 
+
+SCENARIO( "A PrimaryGieBintr can Get and Set its adaptive Interval settings",  "[PrimaryGieBintr]" )
+{
+    GIVEN( "A new PrimaryGieBintr in memory" ) 
+    {
+        std::string primaryGieName = "primary-gie";
+        std::string inferConfigFile = "./test/configs/config_infer_primary_nano.txt";
+        std::string modelEngineFile = "./test/models/Primary_Detector_Nano/resnet10.caffemodel";
+        uint interval(1);
+
+        DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+            DSL_PRIMARY_GIE_NEW(primaryGieName.c_str(), inferConfigFile.c_str(), 
+            modelEngineFile.c_str(), interval);
+
+        bool enabled(true);
+        uint minInterval(99), maxInterval(99);
+        pPrimaryGieBintr->GetIntervalAdaptive(&enabled, &minInterval, &maxInterval);
+        REQUIRE( enabled == false );
+        REQUIRE( minInterval == 0 );
+        REQUIRE( maxInterval == 0 );
+        
+        WHEN( "The PrimaryGieBintr's adaptive Interval settings are set" )
+        {
+            REQUIRE( pPrimaryGieBintr->SetIntervalAdaptive(true, 0, 4) == true );
+
+            THEN( "The correct settings are returned on get" )
+            {
+                pPrimaryGieBintr->GetIntervalAdaptive(&enabled, &minInterval, &maxInterval);
+                REQUIRE( enabled == true );
+                REQUIRE( minInterval == 0 );
+                REQUIRE( maxInterval == 4 );
+            }
+        }
+        WHEN( "The PrimaryGieBintr is Linked" )
+        {
+            pPrimaryGieBintr->SetBatchSize(1);
+            REQUIRE( pPrimaryGieBintr->LinkAll() == true );
+
+            THEN( "The PrimaryGieBintr fails to set its adaptive Interval settings" )
+            {
+                REQUIRE( pPrimaryGieBintr->SetIntervalAdaptive(true, 0, 4) == false );
+
+                pPrimaryGieBintr->UnlinkAll();
+                REQUIRE( pPrimaryGieBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
+static void interval_change_listener_cb(uint prev_interval, uint curr_interval, void* client_data)
+{
+    (*(uint*)client_data)++;
+}
+
+SCENARIO( "A PrimaryGieBintr steps its Interval with load, within bounds and with hysteresis",  "[PrimaryGieBintr]" )
+{
+    GIVEN( "A new PrimaryGieBintr with its adaptive Interval settings set" ) 
+    {
+        std::string primaryGieName = "primary-gie";
+        std::string inferConfigFile = "./test/configs/config_infer_primary_nano.txt";
+        std::string modelEngineFile = "./test/models/Primary_Detector_Nano/resnet10.caffemodel";
+        uint interval(0);
+        uint changeCount(0);
+
+        DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+            DSL_PRIMARY_GIE_NEW(primaryGieName.c_str(), inferConfigFile.c_str(), 
+            modelEngineFile.c_str(), interval);
+
+        REQUIRE( pPrimaryGieBintr->SetIntervalAdaptive(true, 0, 2) == true );
+        REQUIRE( pPrimaryGieBintr->AddIntervalChangeListener(
+            interval_change_listener_cb, &changeCount) == true );
+        
+        WHEN( "The PrimaryGieBintr's Queue is filling up" )
+        {
+            // First period is absorbed by hysteresis
+            REQUIRE( pPrimaryGieBintr->EvaluateIntervalLoad(0.8, 30, 30, 0.01) == 0 );
+            REQUIRE( pPrimaryGieBintr->EvaluateIntervalLoad(0.8, 30, 30, 0.01) == 1 );
+
+            THEN( "The Interval is raised up to the upper bound only" )
+            {
+                REQUIRE( pPrimaryGieBintr->GetIntervalInUse() == 1 );
+                REQUIRE( changeCount == 1 );
+                
+                for (auto i=0; i<10; i++)
+                {
+                    pPrimaryGieBintr->EvaluateIntervalLoad(0.8, 30, 30, 0.01);
+                }
+                REQUIRE( pPrimaryGieBintr->GetIntervalInUse() == 2 );
+                REQUIRE( changeCount == 2 );
+                
+                // The configured interval is unchanged
+                REQUIRE( pPrimaryGieBintr->GetInterval() == interval );
+            }
+        }
+        WHEN( "The PrimaryGieBintr is falling behind its input rate" )
+        {
+            pPrimaryGieBintr->EvaluateIntervalLoad(0.0, 30, 20, 0.01);
+            pPrimaryGieBintr->EvaluateIntervalLoad(0.0, 30, 20, 0.01);
+
+            THEN( "The Interval is raised" )
+            {
+                REQUIRE( pPrimaryGieBintr->GetIntervalInUse() == 1 );
+            }
+        }
+        WHEN( "The PrimaryGieBintr becomes idle after being overloaded" )
+        {
+            pPrimaryGieBintr->EvaluateIntervalLoad(0.8, 30, 30, 0.01);
+            pPrimaryGieBintr->EvaluateIntervalLoad(0.8, 30, 30, 0.01);
+            REQUIRE( pPrimaryGieBintr->GetIntervalInUse() == 1 );
+
+            // 4 idle periods, broken by a normal period, then 4 more
+            for (auto i=0; i<4; i++)
+            {
+                pPrimaryGieBintr->EvaluateIntervalLoad(0.0, 30, 30, 0.005);
+            }
+            pPrimaryGieBintr->EvaluateIntervalLoad(0.3, 30, 30, 0.005);
+            for (auto i=0; i<4; i++)
+            {
+                pPrimaryGieBintr->EvaluateIntervalLoad(0.0, 30, 30, 0.005);
+            }
+            REQUIRE( pPrimaryGieBintr->GetIntervalInUse() == 1 );
+
+            THEN( "The Interval is lowered once idle for the full hysteresis" )
+            {
+                REQUIRE( pPrimaryGieBintr->EvaluateIntervalLoad(0.0, 30, 30, 0.005) == 0 );
+                REQUIRE( changeCount == 2 );
+            }
+        }
+        WHEN( "The PrimaryGieBintr is idle but would be overloaded at the lower Interval" )
+        {
+            pPrimaryGieBintr->EvaluateIntervalLoad(0.8, 30, 30, 0.01);
+            pPrimaryGieBintr->EvaluateIntervalLoad(0.8, 30, 30, 0.01);
+            REQUIRE( pPrimaryGieBintr->GetIntervalInUse() == 1 );
+
+            THEN( "The Interval is not lowered" )
+            {
+                // latency of 40% of the batch period projects to 80% at interval 0
+                for (auto i=0; i<10; i++)
+                {
+                    pPrimaryGieBintr->EvaluateIntervalLoad(0.0, 30, 30, 0.4/30);
+                }
+                REQUIRE( pPrimaryGieBintr->GetIntervalInUse() == 1 );
+            }
+        }
+    }
+}
@@ -25,6 +25,9 @@ THE SOFTWARE.
 #include "catch.hpp"
 #include "Dsl.h"
 #include "DslSinkBintr.h"
+#include "DslSourceBintr.h"
+#include "DslTilerBintr.h"
+#include "DslPipelineBintr.h"
 
 using namespace DSL;
 
@@ -73,6 +76,168 @@ SCENARIO( "A new FakeSinkBintr can LinkAll Child Elementrs", "[FakeSinkBintr]" )
     }
 }
 
+SCENARIO( "A new AppSinkBintr is created correctly",  "[AppSinkBintr]" )
+{
+    GIVEN( "Attributes for a new App Sink" ) 
+    {
+        std::string sinkName("app-sink");
+
+        WHEN( "The AppSinkBintr is created " )
+        {
+            DSL_APP_SINK_PTR pSinkBintr = 
+                DSL_APP_SINK_NEW(sinkName.c_str(), NULL, NULL);
+            
+            THEN( "The correct attribute values are returned" )
+            {
+                bool sync(true), async(true);
+                pSinkBintr->GetSyncSettings(&sync, &async);
+                REQUIRE( sync == false );
+                REQUIRE( async == false );
+                
+                uint maxBuffers(0);
+                bool drop(false);
+                pSinkBintr->GetMaxBuffers(&maxBuffers, &drop);
+                REQUIRE( maxBuffers == DSL_DEFAULT_APP_SINK_MAX_BUFFERS );
+                REQUIRE( drop == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new AppSinkBintr can LinkAll and UnlinkAll Child Elementrs", "[AppSinkBintr]" )
+{
+    GIVEN( "A new AppSinkBintr in an Unlinked state" ) 
+    {
+        std::string sinkName("app-sink");
+
+        DSL_APP_SINK_PTR pSinkBintr = 
+            DSL_APP_SINK_NEW(sinkName.c_str(), NULL, NULL);
+
+        REQUIRE( pSinkBintr->IsLinked() == false );
+
+        WHEN( "A new AppSinkBintr is Linked and then Unlinked" )
+        {
+            REQUIRE( pSinkBintr->LinkAll() == true );
+            REQUIRE( pSinkBintr->IsLinked() == true );
+
+            THEN( "The AppSinkBintr's IsLinked state is updated correctly" )
+            {
+                pSinkBintr->UnlinkAll();
+                REQUIRE( pSinkBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "An AppSinkBintr's max-buffers settings can only be updated when unlinked", "[AppSinkBintr]" )
+{
+    GIVEN( "A new AppSinkBintr in an Unlinked state" ) 
+    {
+        std::string sinkName("app-sink");
+
+        DSL_APP_SINK_PTR pSinkBintr = 
+            DSL_APP_SINK_NEW(sinkName.c_str(), NULL, NULL);
+
+        WHEN( "The AppSinkBintr's max-buffers settings are updated" )
+        {
+            REQUIRE( pSinkBintr->SetMaxBuffers(10, false) == true );
+
+            THEN( "The new values are returned on get and Set fails once linked" )
+            {
+                uint maxBuffers(0);
+                bool drop(true);
+                pSinkBintr->GetMaxBuffers(&maxBuffers, &drop);
+                REQUIRE( maxBuffers == 10 );
+                REQUIRE( drop == false );
+                
+                REQUIRE( pSinkBintr->LinkAll() == true );
+                REQUIRE( pSinkBintr->SetMaxBuffers(2, true) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new MetaSinkBintr is created correctly",  "[MetaSinkBintr]" )
+{
+    GIVEN( "Attributes for a new Meta Sink" ) 
+    {
+        std::string sinkName("meta-sink");
+        std::string path("./meta-sink.bin");
+
+        WHEN( "The MetaSinkBintr is created " )
+        {
+            DSL_META_SINK_PTR pSinkBintr = 
+                DSL_META_SINK_NEW(sinkName.c_str(), path.c_str(), DSL_META_SINK_MODE_FILE, 4);
+            
+            THEN( "The correct attribute values are returned" )
+            {
+                bool sync(true), async(true);
+                pSinkBintr->GetSyncSettings(&sync, &async);
+                REQUIRE( sync == false );
+                REQUIRE( async == false );
+                
+                uint64_t framesWritten(99), framesDropped(99);
+                pSinkBintr->GetStats(&framesWritten, &framesDropped);
+                REQUIRE( framesWritten == 0 );
+                REQUIRE( framesDropped == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new MetaSinkBintr can LinkAll and UnlinkAll Child Elementrs", "[MetaSinkBintr]" )
+{
+    GIVEN( "A new MetaSinkBintr in file mode and one in socket mode" ) 
+    {
+        std::string fileSinkName("meta-file-sink");
+        std::string socketSinkName("meta-socket-sink");
+        std::string filePath("./meta-sink.bin");
+        std::string socketPath("./no-consumer.sock");
+
+        DSL_META_SINK_PTR pFileSinkBintr = DSL_META_SINK_NEW(fileSinkName.c_str(), 
+            filePath.c_str(), DSL_META_SINK_MODE_FILE, 4);
+        DSL_META_SINK_PTR pSocketSinkBintr = DSL_META_SINK_NEW(socketSinkName.c_str(), 
+            socketPath.c_str(), DSL_META_SINK_MODE_SOCKET, 4);
+
+        WHEN( "Both MetaSinkBintrs are Linked, with no socket consumer listening" )
+        {
+            REQUIRE( pFileSinkBintr->LinkAll() == true );
+            REQUIRE( pSocketSinkBintr->LinkAll() == true );
+
+            THEN( "Both MetaSinkBintrs can be Unlinked" )
+            {
+                pFileSinkBintr->UnlinkAll();
+                pSocketSinkBintr->UnlinkAll();
+                REQUIRE( pFileSinkBintr->IsLinked() == false );
+                REQUIRE( pSocketSinkBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaSinkBintr in file mode fails to Link with an invalid path", "[MetaSinkBintr]" )
+{
+    GIVEN( "A new MetaSinkBintr with a path to a non-existent directory" ) 
+    {
+        std::string sinkName("meta-sink");
+        std::string path("./no-such-dir/meta-sink.bin");
+
+        DSL_META_SINK_PTR pSinkBintr = DSL_META_SINK_NEW(sinkName.c_str(), 
+            path.c_str(), DSL_META_SINK_MODE_FILE, 4);
+
+        WHEN( "The MetaSinkBintr is Linked" )
+        {
+            bool result = pSinkBintr->LinkAll();
+
+            THEN( "The Link fails and the state is unchanged" )
+            {
+                REQUIRE( result == false );
+                REQUIRE( pSinkBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new OverlaySinkBintr is created correctly",  "[OverlaySinkBintr]" )
 {
     GIVEN( "Attributes for a new Overlay Sink" ) 
@@ -492,6 +657,90 @@ SCENARIO( "A WindowSinkBintr can Get and Set its GPU ID",  "[WindowSinkBintr]" )
     }
 }
 
+SCENARIO( "A WindowSinkBintr with a max FPS drops frames in excess of the maximum", "[WindowSinkBintr]" )
+{
+    GIVEN( "A new WindowSinkBintr with a max FPS of 10" ) 
+    {
+        std::string sinkName("window-sink");
+
+        DSL_WINDOW_SINK_PTR pWindowSinkBintr = 
+            DSL_WINDOW_SINK_NEW(sinkName.c_str(), 0, 0, 1280, 720);
+        REQUIRE( pWindowSinkBintr->GetMaxFps() == 0 );
+        pWindowSinkBintr->SetMaxFps(10);
+        REQUIRE( pWindowSinkBintr->GetMaxFps() == 10 );
+
+        WHEN( "One second of 30 fps buffers are probed" )
+        {
+            uint rendered(0);
+            for (uint i = 0; i < 30; i++)
+            {
+                GstBuffer* pBuffer = gst_buffer_new();
+                GST_BUFFER_PTS(pBuffer) = gst_util_uint64_scale(i, GST_SECOND, 30);
+                GstPadProbeInfo info = {(GstPadProbeType)0};
+                info.type = GST_PAD_PROBE_TYPE_BUFFER;
+                info.data = pBuffer;
+                
+                if (pWindowSinkBintr->HandleRenderProbe(&info) == GST_PAD_PROBE_OK)
+                {
+                    rendered++;
+                }
+                gst_buffer_unref(pBuffer);
+            }
+            THEN( "Only the maximum number of frames are rendered" )
+            {
+                REQUIRE( rendered == 10 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A WindowSinkBintr pauses rendering while hidden", "[WindowSinkBintr]" )
+{
+    GIVEN( "A new WindowSinkBintr with pause-when-hidden enabled" ) 
+    {
+        std::string sinkName("window-sink");
+
+        DSL_WINDOW_SINK_PTR pWindowSinkBintr = 
+            DSL_WINDOW_SINK_NEW(sinkName.c_str(), 0, 0, 1280, 720);
+        REQUIRE( pWindowSinkBintr->GetPauseWhenHidden() == false );
+        pWindowSinkBintr->SetPauseWhenHidden(true);
+        REQUIRE( pWindowSinkBintr->GetPauseWhenHidden() == true );
+        REQUIRE( pWindowSinkBintr->IsHidden() == false );
+
+        GstBuffer* pBuffer = gst_buffer_new();
+        GstPadProbeInfo bufferInfo = {(GstPadProbeType)0};
+        bufferInfo.type = GST_PAD_PROBE_TYPE_BUFFER;
+        bufferInfo.data = pBuffer;
+        
+        REQUIRE( pWindowSinkBintr->HandleRenderProbe(&bufferInfo) == GST_PAD_PROBE_OK );
+
+        WHEN( "The XWindow visibility event is received with hidden = true" )
+        {
+            GstPadProbeInfo eventInfo = {(GstPadProbeType)0};
+            eventInfo.type = GST_PAD_PROBE_TYPE_EVENT_UPSTREAM;
+            eventInfo.data = gst_event_new_custom(GST_EVENT_CUSTOM_UPSTREAM,
+                gst_structure_new(DSL_XWINDOW_VISIBILITY_EVENT, 
+                    "hidden", G_TYPE_BOOLEAN, TRUE, NULL));
+            
+            REQUIRE( pWindowSinkBintr->HandleRenderProbe(&eventInfo) == GST_PAD_PROBE_HANDLED );
+            REQUIRE( pWindowSinkBintr->IsHidden() == true );
+
+            THEN( "All frames are dropped until visible again" )
+            {
+                REQUIRE( pWindowSinkBintr->HandleRenderProbe(&bufferInfo) == GST_PAD_PROBE_DROP );
+                
+                eventInfo.data = gst_event_new_custom(GST_EVENT_CUSTOM_UPSTREAM,
+                    gst_structure_new(DSL_XWINDOW_VISIBILITY_EVENT, 
+                        "hidden", G_TYPE_BOOLEAN, FALSE, NULL));
+                REQUIRE( pWindowSinkBintr->HandleRenderProbe(&eventInfo) == GST_PAD_PROBE_HANDLED );
+                REQUIRE( pWindowSinkBintr->IsHidden() == false );
+                REQUIRE( pWindowSinkBintr->HandleRenderProbe(&bufferInfo) == GST_PAD_PROBE_OK );
+                gst_buffer_unref(pBuffer);
+            }
+        }
+    }
+}
+
 SCENARIO( "A new DSL_CODEC_MPEG4 FileSinkBintr is created correctly",  "[FileSinkBintr]" )
 {
     GIVEN( "Attributes for a new DSL_CODEC_MPEG4 File Sink" ) 
@@ -817,6 +1066,337 @@ SCENARIO( "A FileSinkBintr can Get and Set its GPU ID",  "[FileSinkBintr]" )
     }
 }
 
+SCENARIO( "A new SegmentSinkBintr is created correctly",  "[SegmentSinkBintr]" )
+{
+    GIVEN( "Attributes for a new SegmentSinkBintr" ) 
+    {
+        std::string sinkName("segment-sink");
+        std::string filePattern("./output-%05d.mkv");
+        uint codec(DSL_CODEC_H264);
+        uint container(DSL_CONTAINER_MKV);
+        uint bitrate(2000000);
+        uint interval(0);
+        uint maxDuration(60);
+        uint maxFiles(10);
+
+        WHEN( "The SegmentSinkBintr is created " )
+        {
+            DSL_SEGMENT_SINK_PTR pSinkBintr = DSL_SEGMENT_SINK_NEW(sinkName.c_str(), 
+                filePattern.c_str(), codec, container, bitrate, interval, maxDuration, maxFiles);
+            
+            THEN( "The correct attribute values are returned" )
+            {
+                REQUIRE( pSinkBintr->GetMaxDuration() == maxDuration );
+                REQUIRE( pSinkBintr->GetMaxSize() == 0 );
+                REQUIRE( pSinkBintr->GetMaxFiles() == maxFiles );
+                
+                uint bufferSize(0), fsyncInterval(0);
+                pSinkBintr->GetWriteSettings(&bufferSize, &fsyncInterval);
+                REQUIRE( bufferSize == DSL_DEFAULT_SEGMENT_SINK_WRITE_BUFFER_SIZE );
+                REQUIRE( fsyncInterval == DSL_DEFAULT_SEGMENT_SINK_FSYNC_INTERVAL );
+                
+                bool sync(false), async(false);
+                pSinkBintr->GetSyncSettings(&sync, &async);
+                REQUIRE( sync == true );
+                REQUIRE( async == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new SegmentSinkBintr can LinkAll and UnlinkAll Child Elementrs", "[SegmentSinkBintr]" )
+{
+    GIVEN( "A new SegmentSinkBintr in an Unlinked state" ) 
+    {
+        std::string sinkName("segment-sink");
+        std::string filePattern("./output-%05d.mp4");
+
+        DSL_SEGMENT_SINK_PTR pSinkBintr = DSL_SEGMENT_SINK_NEW(sinkName.c_str(), 
+            filePattern.c_str(), DSL_CODEC_H264, DSL_CONTAINER_MP4, 2000000, 0, 60, 0);
+
+        REQUIRE( pSinkBintr->IsLinked() == false );
+
+        WHEN( "A new SegmentSinkBintr is Linked" )
+        {
+            REQUIRE( pSinkBintr->LinkAll() == true );
+
+            THEN( "The SegmentSinkBintr's IsLinked state is updated correctly" )
+            {
+                REQUIRE( pSinkBintr->IsLinked() == true );
+                
+                // write settings can't be updated while the fsync thread is running
+                REQUIRE( pSinkBintr->SetWriteSettings(4194304, 500) == false );
+                
+                pSinkBintr->UnlinkAll();
+                REQUIRE( pSinkBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A SegmentSinkBintr's limits and write settings can be updated", "[SegmentSinkBintr]" )
+{
+    GIVEN( "A new SegmentSinkBintr in memory" ) 
+    {
+        std::string sinkName("segment-sink");
+        std::string filePattern("./output-%05d.mp4");
+
+        DSL_SEGMENT_SINK_PTR pSinkBintr = DSL_SEGMENT_SINK_NEW(sinkName.c_str(), 
+            filePattern.c_str(), DSL_CODEC_H265, DSL_CONTAINER_MP4, 2000000, 0, 60, 0);
+
+        WHEN( "The SegmentSinkBintr's limits and write settings are Set" )
+        {
+            pSinkBintr->SetMaxDuration(600);
+            pSinkBintr->SetMaxSize(1073741824);
+            pSinkBintr->SetMaxFiles(6);
+            REQUIRE( pSinkBintr->SetWriteSettings(4194304, 0) == true );
+
+            THEN( "The new values are returned on Get")
+            {
+                REQUIRE( pSinkBintr->GetMaxDuration() == 600 );
+                REQUIRE( pSinkBintr->GetMaxSize() == 1073741824 );
+                REQUIRE( pSinkBintr->GetMaxFiles() == 6 );
+                
+                uint bufferSize(0), fsyncInterval(99);
+                pSinkBintr->GetWriteSettings(&bufferSize, &fsyncInterval);
+                REQUIRE( bufferSize == 4194304 );
+                REQUIRE( fsyncInterval == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A SegmentSinkBintr formats the file path for each new segment", "[SegmentSinkBintr]" )
+{
+    GIVEN( "A new SegmentSinkBintr in memory" ) 
+    {
+        std::string sinkName("segment-sink");
+        std::string filePattern("./output-%05d.mp4");
+
+        DSL_SEGMENT_SINK_PTR pSinkBintr = DSL_SEGMENT_SINK_NEW(sinkName.c_str(), 
+            filePattern.c_str(), DSL_CODEC_H264, DSL_CONTAINER_MP4, 2000000, 0, 60, 4);
+
+        WHEN( "A new segment location is requested" )
+        {
+            gchar* filePath = pSinkBintr->HandleFormatLocation(3);
+
+            THEN( "The segment index is formated into the file pattern")
+            {
+                REQUIRE( std::string(filePath) == "./output-00003.mp4" );
+                g_free(filePath);
+            }
+        }
+    }
+}
+
+SCENARIO( "A new SharedEncodeSinkBintr is created correctly",  "[SharedEncodeSinkBintr]" )
+{
+    GIVEN( "Attributes for a new SharedEncodeSinkBintr" ) 
+    {
+        std::string sinkName("shared-encode-sink");
+        uint codec(DSL_CODEC_H264);
+        uint bitrate(2000000);
+        uint interval(0);
+
+        WHEN( "The SharedEncodeSinkBintr is created " )
+        {
+            DSL_SHARED_ENCODE_SINK_PTR pSinkBintr = 
+                DSL_SHARED_ENCODE_SINK_NEW(sinkName.c_str(), codec, bitrate, interval);
+            
+            THEN( "The correct attribute values are returned" )
+            {
+                uint retBitrate(0), retInterval(99);
+                pSinkBintr->GetEncoderSettings(&retBitrate, &retInterval);
+                REQUIRE( retBitrate == bitrate );
+                REQUIRE( retInterval == interval );
+                REQUIRE( pSinkBintr->GetNumTaps() == 0 );
+                REQUIRE( pSinkBintr->IsLinked() == false );
+                
+                // each Tap controls its own synchronization
+                REQUIRE( pSinkBintr->SetSyncSettings(false, false) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "Taps can be added to and removed from an unlinked SharedEncodeSinkBintr", "[SharedEncodeSinkBintr]" )
+{
+    GIVEN( "A new SharedEncodeSinkBintr, FileTapBintr, and RtspTapBintr" ) 
+    {
+        DSL_SHARED_ENCODE_SINK_PTR pSinkBintr = 
+            DSL_SHARED_ENCODE_SINK_NEW("shared-encode-sink", DSL_CODEC_H264, 2000000, 0);
+        DSL_FILE_TAP_PTR pFileTapBintr = DSL_FILE_TAP_NEW("file-tap", 
+            "./shared-encode-test.mp4", DSL_CODEC_H264, DSL_CONTAINER_MP4);
+        DSL_RTSP_TAP_PTR pRtspTapBintr = DSL_RTSP_TAP_NEW("rtsp-tap", 
+            "224.224.255.255", 5400, 8554, DSL_CODEC_H264);
+
+        WHEN( "The Taps are added to the SharedEncodeSinkBintr" )
+        {
+            REQUIRE( pSinkBintr->AddTap(pFileTapBintr) == true );
+            REQUIRE( pSinkBintr->AddTap(pRtspTapBintr) == true );
+            
+            THEN( "The Taps are in use and can be removed" )
+            {
+                REQUIRE( pSinkBintr->GetNumTaps() == 2 );
+                REQUIRE( pSinkBintr->IsTap(pFileTapBintr) == true );
+                REQUIRE( pFileTapBintr->IsInUse() == true );
+                REQUIRE( pSinkBintr->AddTap(pFileTapBintr) == false );
+                
+                REQUIRE( pSinkBintr->RemoveTap(pFileTapBintr) == true );
+                REQUIRE( pSinkBintr->RemoveTap(pFileTapBintr) == false );
+                REQUIRE( pFileTapBintr->IsInUse() == false );
+                REQUIRE( pSinkBintr->RemoveTap(pRtspTapBintr) == true );
+                REQUIRE( pSinkBintr->GetNumTaps() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A SharedEncodeSinkBintr links and unlinks its Taps", "[SharedEncodeSinkBintr]" )
+{
+    GIVEN( "A new SharedEncodeSinkBintr with a FileTapBintr" ) 
+    {
+        DSL_SHARED_ENCODE_SINK_PTR pSinkBintr = 
+            DSL_SHARED_ENCODE_SINK_NEW("shared-encode-sink", DSL_CODEC_H264, 2000000, 0);
+        DSL_FILE_TAP_PTR pFileTapBintr = DSL_FILE_TAP_NEW("file-tap", 
+            "./shared-encode-test.mp4", DSL_CODEC_H264, DSL_CONTAINER_MP4);
+        DSL_RTSP_TAP_PTR pRtspTapBintr = DSL_RTSP_TAP_NEW("rtsp-tap", 
+            "224.224.255.255", 5400, 8554, DSL_CODEC_H264);
+
+        REQUIRE( pSinkBintr->AddTap(pFileTapBintr) == true );
+
+        WHEN( "The SharedEncodeSinkBintr is linked and a second Tap is added" )
+        {
+            REQUIRE( pSinkBintr->LinkAll() == true );
+            REQUIRE( pSinkBintr->AddTap(pRtspTapBintr) == true );
+            
+            THEN( "Both Taps are linked, and each can be removed while linked" )
+            {
+                REQUIRE( pFileTapBintr->IsLinked() == true );
+                REQUIRE( pFileTapBintr->IsLinkedToSource() == true );
+                REQUIRE( pRtspTapBintr->IsLinked() == true );
+                REQUIRE( pRtspTapBintr->IsLinkedToSource() == true );
+                
+                REQUIRE( pSinkBintr->RemoveTap(pRtspTapBintr) == true );
+                REQUIRE( pRtspTapBintr->IsLinked() == false );
+                REQUIRE( pRtspTapBintr->IsLinkedToSource() == false );
+                REQUIRE( pFileTapBintr->IsLinkedToSource() == true );
+                
+                pSinkBintr->UnlinkAll();
+                REQUIRE( pSinkBintr->IsLinked() == false );
+                REQUIRE( pFileTapBintr->IsLinked() == false );
+                REQUIRE( pFileTapBintr->IsLinkedToSource() == false );
+            }
+        }
+    }
+}
+
+static uint CountEncoders(GstElement* pBin)
+{
+    uint count(0);
+    GstIterator* pIterator = gst_bin_iterate_recurse(GST_BIN(pBin));
+    GValue item = G_VALUE_INIT;
+    while (gst_iterator_next(pIterator, &item) == GST_ITERATOR_OK)
+    {
+        GstElementFactory* pFactory = gst_element_get_factory(
+            GST_ELEMENT(g_value_get_object(&item)));
+        if (pFactory and strstr(gst_element_factory_get_metadata(pFactory, 
+            GST_ELEMENT_METADATA_KLASS), "Encoder"))
+        {
+            count++;
+        }
+        g_value_reset(&item);
+    }
+    g_value_unset(&item);
+    gst_iterator_free(pIterator);
+    
+    return count;
+}
+
+static bool TapIsLinkedToTee(DSL_TAP_PTR pTapBintr, GstElement* pTee)
+{
+    GstPad* pSinkPad = gst_element_get_static_pad(pTapBintr->GetGstElement(), "sink");
+    GstPad* pPeerPad = gst_pad_get_peer(pSinkPad);
+    gst_object_unref(pSinkPad);
+    if (!pPeerPad)
+    {
+        return false;
+    }
+    GstElement* pPeer = gst_pad_get_parent_element(pPeerPad);
+    gst_object_unref(pPeerPad);
+    
+    bool result(pPeer == pTee);
+    if (pPeer)
+    {
+        gst_object_unref(pPeer);
+    }
+    return result;
+}
+
+SCENARIO( "A playing SharedEncodeSinkBintr encodes once for all of its Taps", "[SharedEncodeSinkBintr]" )
+{
+    GIVEN( "A Pipeline with a Test Source, Tiler, and SharedEncodeSinkBintr with two FileTapBintrs" ) 
+    {
+        uint width(640);
+        uint height(480);
+
+        DSL_TEST_SOURCE_PTR pSourceBintr = DSL_TEST_SOURCE_NEW("test-source", 
+            true, DSL_TEST_PATTERN_BALL, width, height, 30, 1, 0);
+        DSL_TILER_PTR pTilerBintr = DSL_TILER_NEW("tiler", width, height);
+
+        // software encoder, so that the test doesn't depend on NVENC
+        DSL_SHARED_ENCODE_SINK_PTR pSinkBintr = 
+            DSL_SHARED_ENCODE_SINK_NEW("shared-encode-sink", DSL_CODEC_MPEG4, 2000000, 30);
+        DSL_FILE_TAP_PTR pFileTapBintr1 = DSL_FILE_TAP_NEW("file-tap-1", 
+            "./shared-encode-test-1.mp4", DSL_CODEC_MPEG4, DSL_CONTAINER_MP4);
+        DSL_FILE_TAP_PTR pFileTapBintr2 = DSL_FILE_TAP_NEW("file-tap-2", 
+            "./shared-encode-test-2.mp4", DSL_CODEC_MPEG4, DSL_CONTAINER_MP4);
+        DSL_FILE_TAP_PTR pFileTapBintr3 = DSL_FILE_TAP_NEW("file-tap-3", 
+            "./shared-encode-test-3.mp4", DSL_CODEC_MPEG4, DSL_CONTAINER_MP4);
+
+        DSL_PIPELINE_PTR pPipelineBintr = DSL_PIPELINE_NEW("pipeline");
+
+        REQUIRE( pSinkBintr->AddTap(pFileTapBintr1) == true );
+        REQUIRE( pSinkBintr->AddTap(pFileTapBintr2) == true );
+        
+        REQUIRE( pSourceBintr->AddToParent(pPipelineBintr) == true );
+        REQUIRE( pTilerBintr->AddToParent(pPipelineBintr) == true );
+        REQUIRE( pSinkBintr->AddToParent(pPipelineBintr) == true );
+        
+        GstElement* pTee = gst_bin_get_by_name(GST_BIN(pSinkBintr->GetGstElement()), 
+            "shared-encode-sink-bin-tee");
+        REQUIRE( pTee != NULL );
+
+        WHEN( "The Pipeline is playing" )
+        {
+            REQUIRE( pPipelineBintr->Play() == true );
+            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+            THEN( "There is one encoder, and Taps are linked to its Tee and unlinked while playing" )
+            {
+                REQUIRE( CountEncoders(pPipelineBintr->GetGstElement()) == 1 );
+                REQUIRE( TapIsLinkedToTee(pFileTapBintr1, pTee) == true );
+                REQUIRE( TapIsLinkedToTee(pFileTapBintr2, pTee) == true );
+                
+                REQUIRE( pSinkBintr->AddTap(pFileTapBintr3) == true );
+                REQUIRE( TapIsLinkedToTee(pFileTapBintr3, pTee) == true );
+                REQUIRE( CountEncoders(pPipelineBintr->GetGstElement()) == 1 );
+                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+                
+                REQUIRE( pSinkBintr->RemoveTap(pFileTapBintr1) == true );
+                REQUIRE( pFileTapBintr1->IsLinkedToSource() == false );
+                REQUIRE( TapIsLinkedToTee(pFileTapBintr1, pTee) == false );
+                REQUIRE( TapIsLinkedToTee(pFileTapBintr2, pTee) == true );
+                REQUIRE( TapIsLinkedToTee(pFileTapBintr3, pTee) == true );
+                REQUIRE( pSinkBintr->GetNumTaps() == 2 );
+                
+                REQUIRE( pPipelineBintr->Stop() == true );
+                gst_object_unref(pTee);
+            }
+        }
+    }
+}
+
 SCENARIO( "A new DSL_CONTAINER_MP4 RecordSinkBintr is created correctly",  "[RecordSinkBintr]" )
 {
     GIVEN( "Attributes for a new DSL_CODEC_MPEG4 RecordSinkBintr" ) 
@@ -1187,3 +1767,130 @@ SCENARIO( "A RtspSinkBintr can Get and Set its GPU ID",  "[RtspSinkBintr]" )
         }
     }
 }
+
+SCENARIO( "A RtspSinkBintr's adaptive bitrate settings can be updated", "[RtspSinkBintr]" )
+{
+    GIVEN( "A new RtspSinkBintr in memory" ) 
+    {
+        DSL_RTSP_SINK_PTR pRtspSinkBintr = DSL_RTSP_SINK_NEW("rtsp-sink", 
+            "224.224.255.255", 5400, 8554, DSL_CODEC_H264, 4000000, 0);
+
+        bool enabled(true);
+        uint minBitRate(0), maxBitRate(0);
+        pRtspSinkBintr->GetBitrateAdaptive(&enabled, &minBitRate, &maxBitRate);
+        REQUIRE( enabled == false );
+        
+        WHEN( "The adaptive bitrate is enabled" )
+        {
+            REQUIRE( pRtspSinkBintr->SetBitrateAdaptive(true, 1000000, 8000000) == true );
+
+            THEN( "The new settings are returned and can't be updated while linked" )
+            {
+                pRtspSinkBintr->GetBitrateAdaptive(&enabled, &minBitRate, &maxBitRate);
+                REQUIRE( enabled == true );
+                REQUIRE( minBitRate == 1000000 );
+                REQUIRE( maxBitRate == 8000000 );
+                REQUIRE( pRtspSinkBintr->SetBitrateAdaptive(true, 8000000, 1000000) == false );
+                
+                REQUIRE( pRtspSinkBintr->LinkAll() == true );
+                REQUIRE( pRtspSinkBintr->SetBitrateAdaptive(false, 0, 0) == false );
+                pRtspSinkBintr->UnlinkAll();
+            }
+        }
+    }
+}
+
+SCENARIO( "A linked adaptive RtspSinkBintr pauses encoding with no clients connected", "[RtspSinkBintr]" )
+{
+    GIVEN( "A new RtspSinkBintr with adaptive bitrate enabled" ) 
+    {
+        DSL_RTSP_SINK_PTR pRtspSinkBintr = DSL_RTSP_SINK_NEW("rtsp-sink", 
+            "224.224.255.255", 5400, 8554, DSL_CODEC_H264, 4000000, 0);
+        REQUIRE( pRtspSinkBintr->SetBitrateAdaptive(true, 1000000, 8000000) == true );
+
+        uint clientCount(99), bitRate(0);
+        bool isEncoding(true);
+        
+        WHEN( "The RtspSinkBintr is linked with no clients connected" )
+        {
+            REQUIRE( pRtspSinkBintr->LinkAll() == true );
+            pRtspSinkBintr->GetStreamStatus(&clientCount, &bitRate, &isEncoding);
+            REQUIRE( clientCount == 0 );
+            REQUIRE( isEncoding == false );
+            REQUIRE( pRtspSinkBintr->HandleEncoderBuffer() == GST_PAD_PROBE_DROP );
+
+            THEN( "Encoding resumes on client connect and pauses once closed" )
+            {
+                GstRTSPClient* pClient = gst_rtsp_client_new();
+                pRtspSinkBintr->HandleClientConnected(pClient);
+                pRtspSinkBintr->GetStreamStatus(&clientCount, &bitRate, &isEncoding);
+                REQUIRE( clientCount == 1 );
+                REQUIRE( isEncoding == true );
+                REQUIRE( pRtspSinkBintr->HandleEncoderBuffer() == GST_PAD_PROBE_OK );
+                
+                g_signal_emit_by_name(pClient, "closed");
+                REQUIRE( pRtspSinkBintr->HandleBitrateUpdate() == true );
+                pRtspSinkBintr->GetStreamStatus(&clientCount, &bitRate, &isEncoding);
+                REQUIRE( clientCount == 0 );
+                REQUIRE( isEncoding == false );
+                
+                pRtspSinkBintr->UnlinkAll();
+                pRtspSinkBintr->GetStreamStatus(&clientCount, &bitRate, &isEncoding);
+                REQUIRE( isEncoding == true );
+                REQUIRE( bitRate == 4000000 );
+                g_object_unref(pClient);
+            }
+        }
+    }
+}
+
+SCENARIO( "An adaptive RtspSinkBintr adjusts its bitrate from receiver reports within bounds", "[RtspSinkBintr]" )
+{
+    GIVEN( "A linked RtspSinkBintr with adaptive bitrate enabled" ) 
+    {
+        uint minBitRate(1000000), maxBitRate(5000000);
+        DSL_RTSP_SINK_PTR pRtspSinkBintr = DSL_RTSP_SINK_NEW("rtsp-sink", 
+            "224.224.255.255", 5400, 8554, DSL_CODEC_H264, 4000000, 0);
+        REQUIRE( pRtspSinkBintr->SetBitrateAdaptive(true, minBitRate, maxBitRate) == true );
+        REQUIRE( pRtspSinkBintr->LinkAll() == true );
+
+        WHEN( "Receiver reports with high loss are handled" )
+        {
+            // 25% loss backs off by 12.5% each report
+            REQUIRE( pRtspSinkBintr->HandleReceiverReport(64, 10) == 3500000 );
+            
+            THEN( "The bitrate is reduced to no less than the minimum" )
+            {
+                for (uint i = 0; i < 20; i++)
+                {
+                    pRtspSinkBintr->HandleReceiverReport(128, 10);
+                }
+                REQUIRE( pRtspSinkBintr->HandleReceiverReport(128, 10) == minBitRate );
+                pRtspSinkBintr->UnlinkAll();
+            }
+        }
+        WHEN( "Receiver reports with moderate loss or high jitter are handled" )
+        {
+            THEN( "The bitrate is held" )
+            {
+                REQUIRE( pRtspSinkBintr->HandleReceiverReport(10, 10) == 4000000 );
+                REQUIRE( pRtspSinkBintr->HandleReceiverReport(0, 100) == 4000000 );
+                pRtspSinkBintr->UnlinkAll();
+            }
+        }
+        WHEN( "Receiver reports with low loss and jitter are handled" )
+        {
+            REQUIRE( pRtspSinkBintr->HandleReceiverReport(0, 5) == 4200000 );
+            
+            THEN( "The bitrate is increased to no more than the maximum" )
+            {
+                for (uint i = 0; i < 20; i++)
+                {
+                    pRtspSinkBintr->HandleReceiverReport(0, 5);
+                }
+                REQUIRE( pRtspSinkBintr->HandleReceiverReport(0, 5) == maxBitRate );
+                pRtspSinkBintr->UnlinkAll();
+            }
+        }
+    }
+}
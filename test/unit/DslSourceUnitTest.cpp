@@ -364,6 +364,255 @@ SCENARIO( "A UriSourceBintr can UnlinkAll all child Elementrs correctly",  "[Uri
     }
 }
 
+SCENARIO( "A UriSourceBintr can Get and Set its repeat enabled setting",  "[UriSourceBintr]" )
+{
+    GIVEN( "A new UriSourceBintr in memory" ) 
+    {
+        std::string sourceName("test-file-source");
+        std::string uri("./test/streams/sample_1080p_h264.mp4");
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(true);
+        uint dropFrameInterval(2);
+
+        DSL_URI_SOURCE_PTR pSourceBintr = DSL_URI_SOURCE_NEW(
+            sourceName.c_str(), uri.c_str(), false, cudadecMemType, intrDecode, dropFrameInterval);
+
+        REQUIRE( pSourceBintr->GetRepeatEnabled() == false );
+
+        WHEN( "The UriSourceBintr's repeat enabled setting is set" )
+        {
+            REQUIRE( pSourceBintr->SetRepeatEnabled(true) == true );
+
+            THEN( "The correct setting is returned on get" )
+            {
+                REQUIRE( pSourceBintr->GetRepeatEnabled() == true );
+                
+                // setting must fail once linked
+                REQUIRE( pSourceBintr->LinkAll() == true );
+                REQUIRE( pSourceBintr->SetRepeatEnabled(false) == false );
+                REQUIRE( pSourceBintr->GetRepeatEnabled() == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new PlaylistSourceBintr is created correctly",  "[PlaylistSourceBintr]" )
+{
+    GIVEN( "A list of files for a new PlaylistSourceBintr" ) 
+    {
+        std::string sourceName = "test-playlist-source";
+        const char* files[] = {"./test/streams/sample_1080p_h264.mp4", 
+            "./test/streams/sample_1080p_h264.mp4", NULL};
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+        
+        char absolutePath[PATH_MAX+1];
+        std::string fullUriPath = realpath(files[0], absolutePath);
+        fullUriPath.insert(0, "file:");
+
+        WHEN( "The PlaylistSourceBintr is created " )
+        {
+            DSL_PLAYLIST_SOURCE_PTR pSourceBintr = DSL_PLAYLIST_SOURCE_NEW(
+                sourceName.c_str(), files, false, cudadecMemType, intrDecode, dropFrameInterval);
+
+            THEN( "All memeber variables are initialized correctly" )
+            {
+                REQUIRE( pSourceBintr->GetGstObject() != NULL );
+                REQUIRE( pSourceBintr->GetId() == -1 );
+                REQUIRE( pSourceBintr->IsInUse() == false );
+                REQUIRE( pSourceBintr->IsLive() == false );
+                REQUIRE( pSourceBintr->GetRepeatEnabled() == false );
+                REQUIRE( pSourceBintr->GetIndex() == 0 );
+                REQUIRE( pSourceBintr->GetSize() == 2 );
+                
+                std::string returnedUri = pSourceBintr->GetUri();
+                REQUIRE( returnedUri == fullUriPath );
+            }
+        }
+    }
+}
+
+SCENARIO( "A PlaylistSourceBintr can LinkAll and UnlinkAll child Elementrs correctly",  "[PlaylistSourceBintr]" )
+{
+    GIVEN( "A new PlaylistSourceBintr in memory" ) 
+    {
+        std::string sourceName = "test-playlist-source";
+        const char* files[] = {"./test/streams/sample_1080p_h264.mp4", NULL};
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        DSL_PLAYLIST_SOURCE_PTR pSourceBintr = DSL_PLAYLIST_SOURCE_NEW(
+            sourceName.c_str(), files, true, cudadecMemType, intrDecode, dropFrameInterval);
+
+        WHEN( "The PlaylistSourceBintr is called to LinkAll" )
+        {
+            REQUIRE( pSourceBintr->LinkAll() == true );
+
+            THEN( "The PlaylistSourceBintr IsLinked state is updated correctly" )
+            {
+                REQUIRE( pSourceBintr->IsLinked() == true );
+                pSourceBintr->UnlinkAll();
+                REQUIRE( pSourceBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new TestSourceBintr is created correctly",  "[TestSourceBintr]" )
+{
+    GIVEN( "Attributes for a new TestSourceBintr" ) 
+    {
+        std::string sourceName = "test-pattern-source";
+        uint width(1280);
+        uint height(720);
+        uint fps_n(30);
+        uint fps_d(1);
+
+        WHEN( "The TestSourceBintr is created " )
+        {
+            DSL_TEST_SOURCE_PTR pSourceBintr = DSL_TEST_SOURCE_NEW(sourceName.c_str(), 
+                false, DSL_TEST_PATTERN_BALL, width, height, fps_n, fps_d, 0);
+
+            THEN( "All memeber variables are initialized correctly" )
+            {
+                uint retWidth(0), retHeight(0), retFpsN(0), retFpsD(0);
+                pSourceBintr->GetDimensions(&retWidth, &retHeight);
+                pSourceBintr->GetFrameRate(&retFpsN, &retFpsD);
+                
+                REQUIRE( pSourceBintr->GetGstObject() != NULL );
+                REQUIRE( pSourceBintr->GetId() == -1 );
+                REQUIRE( pSourceBintr->IsInUse() == false );
+                REQUIRE( pSourceBintr->IsLive() == false );
+                REQUIRE( pSourceBintr->GetPattern() == DSL_TEST_PATTERN_BALL );
+                REQUIRE( retWidth == width );
+                REQUIRE( retHeight == height );
+                REQUIRE( retFpsN == fps_n );
+                REQUIRE( retFpsD == fps_d );
+            }
+        }
+    }
+}
+
+SCENARIO( "A TestSourceBintr can LinkAll and UnlinkAll child Elementrs correctly",  "[TestSourceBintr]" )
+{
+    GIVEN( "A new TestSourceBintr in memory" ) 
+    {
+        std::string sourceName = "test-pattern-source";
+
+        DSL_TEST_SOURCE_PTR pSourceBintr = DSL_TEST_SOURCE_NEW(sourceName.c_str(), 
+            true, DSL_TEST_PATTERN_SMPTE, 1280, 720, 30, 1, 0);
+
+        WHEN( "The TestSourceBintr is called to LinkAll" )
+        {
+            REQUIRE( pSourceBintr->LinkAll() == true );
+
+            THEN( "The TestSourceBintr IsLinked state is updated correctly" )
+            {
+                REQUIRE( pSourceBintr->IsLinked() == true );
+                pSourceBintr->UnlinkAll();
+                REQUIRE( pSourceBintr->IsLinked() == false );
+                
+                REQUIRE( pSourceBintr->SetPattern(DSL_TEST_PATTERN_COLORS+1) == false );
+                REQUIRE( pSourceBintr->SetPattern(DSL_TEST_PATTERN_SNOW) == true );
+                REQUIRE( pSourceBintr->GetPattern() == DSL_TEST_PATTERN_SNOW );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new AppSourceBintr is created correctly",  "[AppSourceBintr]" )
+{
+    GIVEN( "Attributes for a new AppSourceBintr" ) 
+    {
+        std::string sourceName = "test-app-source";
+        uint width(1280);
+        uint height(720);
+        uint fps_n(30);
+        uint fps_d(1);
+
+        WHEN( "The AppSourceBintr is created " )
+        {
+            DSL_APP_SOURCE_PTR pSourceBintr = DSL_APP_SOURCE_NEW(sourceName.c_str(), 
+                true, DSL_VIDEO_FORMAT_I420, width, height, fps_n, fps_d);
+
+            THEN( "All memeber variables are initialized correctly" )
+            {
+                uint retWidth(0), retHeight(0), retFpsN(0), retFpsD(0);
+                pSourceBintr->GetDimensions(&retWidth, &retHeight);
+                pSourceBintr->GetFrameRate(&retFpsN, &retFpsD);
+                
+                REQUIRE( pSourceBintr->GetGstObject() != NULL );
+                REQUIRE( pSourceBintr->GetId() == -1 );
+                REQUIRE( pSourceBintr->IsInUse() == false );
+                REQUIRE( pSourceBintr->IsLive() == true );
+                REQUIRE( retWidth == width );
+                REQUIRE( retHeight == height );
+                REQUIRE( retFpsN == fps_n );
+                REQUIRE( retFpsD == fps_d );
+            }
+        }
+    }
+}
+
+static uint unitTestReleaseCount(0);
+
+static void unit_test_buffer_release(void* data, void* client_data)
+{
+    unitTestReleaseCount++;
+}
+
+SCENARIO( "An AppSourceBintr can LinkAll and UnlinkAll child Elementrs correctly",  "[AppSourceBintr]" )
+{
+    GIVEN( "A new AppSourceBintr in memory" ) 
+    {
+        std::string sourceName = "test-app-source";
+
+        DSL_APP_SOURCE_PTR pSourceBintr = DSL_APP_SOURCE_NEW(sourceName.c_str(), 
+            true, DSL_VIDEO_FORMAT_NV12, 1280, 720, 30, 1);
+
+        WHEN( "The AppSourceBintr is called to LinkAll" )
+        {
+            REQUIRE( pSourceBintr->LinkAll() == true );
+
+            THEN( "The AppSourceBintr IsLinked state is updated correctly" )
+            {
+                REQUIRE( pSourceBintr->IsLinked() == true );
+                pSourceBintr->UnlinkAll();
+                REQUIRE( pSourceBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "An AppSourceBintr releases wrapped client memory",  "[AppSourceBintr]" )
+{
+    GIVEN( "A new AppSourceBintr in memory" ) 
+    {
+        std::string sourceName = "test-app-source";
+        static uint8_t frame[1280*720*3/2] = {0};
+        unitTestReleaseCount = 0;
+
+        DSL_APP_SOURCE_PTR pSourceBintr = DSL_APP_SOURCE_NEW(sourceName.c_str(), 
+            true, DSL_VIDEO_FORMAT_NV12, 1280, 720, 30, 1);
+
+        WHEN( "The AppSourceBintr is linked and client memory is pushed" )
+        {
+            REQUIRE( pSourceBintr->LinkAll() == true );
+            
+            pSourceBintr->PushBuffer(frame, sizeof(frame), DSL_APP_SOURCE_TIMESTAMP_NONE,
+                DSL_APP_SOURCE_TIMESTAMP_NONE, unit_test_buffer_release, NULL);
+
+            THEN( "The client's release function is called once the Bintr is destroyed" )
+            {
+                pSourceBintr = nullptr;
+                REQUIRE( unitTestReleaseCount == 1 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A UriSourceBintr can Add a Child DewarperBintr",  "[DecodeSourceBintr]" )
 {
     GIVEN( "A new UriSourceBintr and DewarperBintr in memory" ) 
@@ -641,6 +890,58 @@ SCENARIO( "A RtspSourceBintr can Get and Set its GPU ID",  "[RtspSourceBintr]" )
     }
 }
 
+SCENARIO( "A RtspSourceBintr can Get and Set its stream watchdog params",  "[RtspSourceBintr]" )
+{
+    GIVEN( "A new RtspSourceBintr in memory" ) 
+    {
+        std::string sourceName("test-rtps-source");
+        std::string uri("rtsp://127.0.0.1:8564/test");
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(true);
+        uint dropFrameInterval(2);
+        uint latency(100);
+        
+        DSL_RTSP_SOURCE_PTR pRtspSourceBintr = DSL_RTSP_SOURCE_NEW(
+            sourceName.c_str(), uri.c_str(), DSL_RTP_ALL, cudadecMemType, intrDecode, dropFrameInterval, latency);
+
+        REQUIRE( pRtspSourceBintr->GetBufferTimeout() == DSL_DEFAULT_RTSP_BUFFER_TIMEOUT );
+
+        uint backoffMin(0), backoffMax(0);
+        pRtspSourceBintr->GetReconnectionParams(&backoffMin, &backoffMax);
+        REQUIRE( backoffMin == DSL_DEFAULT_RTSP_RECONNECT_BACKOFF_MIN );
+        REQUIRE( backoffMax == DSL_DEFAULT_RTSP_RECONNECT_BACKOFF_MAX );
+        
+        WHEN( "The RtspSourceBintr's watchdog params are set" )
+        {
+            pRtspSourceBintr->SetBufferTimeout(10);
+            REQUIRE( pRtspSourceBintr->SetReconnectionParams(2, 64) == true );
+            pRtspSourceBintr->SetLastError("test-error");
+
+            THEN( "The correct params are returned on get" )
+            {
+                REQUIRE( pRtspSourceBintr->GetBufferTimeout() == 10 );
+                pRtspSourceBintr->GetReconnectionParams(&backoffMin, &backoffMax);
+                REQUIRE( backoffMin == 2 );
+                REQUIRE( backoffMax == 64 );
+                
+                uint state(99), reconnectCount(99);
+                std::string lastError;
+                pRtspSourceBintr->GetConnectionData(&state, &reconnectCount, lastError);
+                REQUIRE( state == DSL_RTSP_CONNECTION_STATE_IDLE );
+                REQUIRE( reconnectCount == 0 );
+                REQUIRE( lastError == "test-error" );
+                
+                pRtspSourceBintr->ClearConnectionStats();
+                pRtspSourceBintr->GetConnectionData(&state, &reconnectCount, lastError);
+                REQUIRE( lastError == "" );
+                
+                REQUIRE( pRtspSourceBintr->SetReconnectionParams(0, 64) == false );
+                REQUIRE( pRtspSourceBintr->SetReconnectionParams(65, 64) == false );
+            }
+        }
+    }
+}
+
 SCENARIO( "A UriSourceBintr can Set and Get its URI",  "[UriSourceBintr]" )
 {
     GIVEN( "A new UriSourceBintr in memory" ) 
@@ -162,3 +162,346 @@ SCENARIO( "A Linked DSL_CONTAINER_MKV RecordTapBintr can UnlinkAll Child Element
         }
     }
 }
+
+static GstBuffer* NewPacket(gsize size, GstClockTime time, bool isKeyFrame)
+{
+    GstBuffer* pBuffer = gst_buffer_new_allocate(NULL, size, NULL);
+    GST_BUFFER_PTS(pBuffer) = time;
+    GST_BUFFER_DTS(pBuffer) = time;
+    if (!isKeyFrame)
+    {
+        GST_BUFFER_FLAG_SET(pBuffer, GST_BUFFER_FLAG_DELTA_UNIT);
+    }
+    return pBuffer;
+}
+
+static void PushPacket(EncodedPacketRing& ring, 
+    gsize size, GstClockTime time, bool isKeyFrame)
+{
+    GstBuffer* pBuffer = NewPacket(size, time, isKeyFrame);
+    ring.Push(pBuffer);
+    gst_buffer_unref(pBuffer);
+}
+
+SCENARIO( "An EncodedPacketRing waits for a keyframe before holding packets", "[RingRecordTapBintr]" )
+{
+    GIVEN( "A new EncodedPacketRing" ) 
+    {
+        EncodedPacketRing ring(1000);
+
+        WHEN( "A delta packet is pushed to the empty ring" )
+        {
+            GstBuffer* pBuffer = NewPacket(100, 0, false);
+            bool result = ring.Push(pBuffer);
+            gst_buffer_unref(pBuffer);
+
+            THEN( "The packet is dropped until a keyframe is pushed" )
+            {
+                REQUIRE( result == false );
+                REQUIRE( ring.GetCount() == 0 );
+                REQUIRE( ring.GetBytes() == 0 );
+                
+                PushPacket(ring, 100, GST_SECOND, true);
+                REQUIRE( ring.GetCount() == 1 );
+                REQUIRE( ring.GetBytes() == 100 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An EncodedPacketRing evicts whole GOPs to stay within its byte budget", "[RingRecordTapBintr]" )
+{
+    GIVEN( "A new EncodedPacketRing with a budget of two GOPs" ) 
+    {
+        EncodedPacketRing ring(1000);
+
+        WHEN( "Three GOPs of 500 bytes each are pushed" )
+        {
+            for (uint gop = 0; gop < 3; gop++)
+            {
+                PushPacket(ring, 300, gop*3*GST_MSECOND, true);
+                PushPacket(ring, 100, (gop*3+1)*GST_MSECOND, false);
+                PushPacket(ring, 100, (gop*3+2)*GST_MSECOND, false);
+            }
+
+            THEN( "The oldest GOP is evicted whole and the ring starts on a keyframe" )
+            {
+                REQUIRE( ring.GetBytes() == 1000 );
+                REQUIRE( ring.GetCount() == 6 );
+                REQUIRE( ring.GetDuration() == 5*GST_MSECOND );
+                
+                std::vector<GstBuffer*> packets = ring.Snapshot(GST_CLOCK_TIME_NONE);
+                REQUIRE( packets.size() == 6 );
+                REQUIRE( !GST_BUFFER_FLAG_IS_SET(packets[0], GST_BUFFER_FLAG_DELTA_UNIT) );
+                REQUIRE( GST_BUFFER_PTS(packets[0]) == 3*GST_MSECOND );
+                for (auto const& ivec: packets)
+                {
+                    gst_buffer_unref(ivec);
+                }
+            }
+        }
+        WHEN( "The byte budget is reduced below the current level" )
+        {
+            for (uint gop = 0; gop < 2; gop++)
+            {
+                PushPacket(ring, 300, gop*3*GST_MSECOND, true);
+                PushPacket(ring, 100, (gop*3+1)*GST_MSECOND, false);
+                PushPacket(ring, 100, (gop*3+2)*GST_MSECOND, false);
+            }
+            ring.SetMaxBytes(600);
+
+            THEN( "The oldest GOP is evicted immediately" )
+            {
+                REQUIRE( ring.GetMaxBytes() == 600 );
+                REQUIRE( ring.GetBytes() == 500 );
+                REQUIRE( ring.GetCount() == 3 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An EncodedPacketRing snapshot starts on the latest keyframe before the pre-event window", "[RingRecordTapBintr]" )
+{
+    GIVEN( "An EncodedPacketRing holding five GOPs, one per second, at 10 fps" ) 
+    {
+        EncodedPacketRing ring(1024*1024);
+        
+        for (uint i = 0; i < 50; i++)
+        {
+            PushPacket(ring, 1000, i*100*GST_MSECOND, (i % 10) == 0);
+        }
+        REQUIRE( ring.GetCount() == 50 );
+
+        WHEN( "A snapshot with a 2 second pre-event window is taken" )
+        {
+            std::vector<GstBuffer*> packets = ring.Snapshot(2*GST_SECOND);
+
+            THEN( "The snapshot starts on the keyframe at 2 seconds" )
+            {
+                REQUIRE( packets.size() == 30 );
+                REQUIRE( GST_BUFFER_PTS(packets[0]) == 2*GST_SECOND );
+                for (auto const& ivec: packets)
+                {
+                    gst_buffer_unref(ivec);
+                }
+            }
+        }
+        WHEN( "A snapshot with a pre-event window longer than the ring is taken" )
+        {
+            std::vector<GstBuffer*> packets = ring.Snapshot(100*GST_SECOND);
+
+            THEN( "The snapshot holds all packets" )
+            {
+                REQUIRE( packets.size() == 50 );
+                for (auto const& ivec: packets)
+                {
+                    gst_buffer_unref(ivec);
+                }
+            }
+        }
+    }
+}
+
+static uint ringRecordCompleteCount(0);
+static boolean ringRecordCompleteSuccess(false);
+
+static void ring_record_complete_listener(uint session, 
+    const wchar_t* file_path, boolean success, void* client_data)
+{
+    ringRecordCompleteSuccess = success;
+    ringRecordCompleteCount++;
+}
+
+SCENARIO( "A RingRecordSession records x264enc packets from an EncodedPacketRing to file", "[RingRecordTapBintr]" )
+{
+    GIVEN( "An EncodedPacketRing holding 60 frames encoded with x264enc" ) 
+    {
+        std::string filePath("./ring-record-session-test.mp4");
+        remove(filePath.c_str());
+        
+        GstElement* pEncodePipeline = gst_parse_launch(
+            "videotestsrc num-buffers=60 ! video/x-raw,width=320,height=240,framerate=30/1 ! "
+            "x264enc key-int-max=15 ! h264parse ! appsink name=sink sync=false", NULL);
+        REQUIRE( pEncodePipeline != NULL );
+        
+        GstElement* pAppSink = gst_bin_get_by_name(GST_BIN(pEncodePipeline), "sink");
+        REQUIRE( gst_element_set_state(pEncodePipeline, 
+            GST_STATE_PLAYING) != GST_STATE_CHANGE_FAILURE );
+        
+        EncodedPacketRing ring(DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES);
+        GstCaps* pCaps(NULL);
+        
+        GstSample* pSample(NULL);
+        while ((pSample = gst_app_sink_pull_sample(GST_APP_SINK(pAppSink))))
+        {
+            gst_caps_replace(&pCaps, gst_sample_get_caps(pSample));
+            ring.Push(gst_sample_get_buffer(pSample));
+            gst_sample_unref(pSample);
+        }
+        gst_element_set_state(pEncodePipeline, GST_STATE_NULL);
+        gst_object_unref(pAppSink);
+        gst_object_unref(pEncodePipeline);
+        
+        REQUIRE( ring.GetCount() == 60 );
+        REQUIRE( pCaps != NULL );
+
+        WHEN( "The ring's contents are recorded by a new RingRecordSession" )
+        {
+            ringRecordCompleteCount = 0;
+            RingRecordSession* pSession = new RingRecordSession(0, filePath.c_str(), 
+                DSL_CONTAINER_MP4, ring_record_complete_listener, NULL);
+            REQUIRE( pSession->Start(pCaps) == true );
+            
+            std::vector<GstBuffer*> packets = ring.Snapshot(GST_CLOCK_TIME_NONE);
+            for (auto const& ivec: packets)
+            {
+                REQUIRE( pSession->Push(ivec) == true );
+                gst_buffer_unref(ivec);
+            }
+            // the session deletes itself once ended and complete
+            pSession->End();
+            
+            for (uint i = 0; i < 50 and !ringRecordCompleteCount; i++)
+            {
+                g_usleep(100000);
+            }
+
+            THEN( "The client is notified and the recording file is written" )
+            {
+                REQUIRE( ringRecordCompleteCount == 1 );
+                REQUIRE( ringRecordCompleteSuccess == true );
+                
+                struct stat info;
+                REQUIRE( stat(filePath.c_str(), &info) == 0 );
+                REQUIRE( info.st_size > 0 );
+                remove(filePath.c_str());
+            }
+        }
+        gst_caps_unref(pCaps);
+    }
+}
+
+SCENARIO( "A new RingRecordTapBintr is created correctly and can LinkAll/UnlinkAll", "[RingRecordTapBintr]" )
+{
+    GIVEN( "Attributes for a new RingRecordTapBintr" ) 
+    {
+        std::string ringRecordTapName("ring-record-tap");
+        std::string outDir("./");
+        uint container(DSL_CONTAINER_MKV);
+
+        DSL_RING_RECORD_TAP_PTR pRingRecordTapBintr = 
+            DSL_RING_RECORD_TAP_NEW(ringRecordTapName.c_str(), outDir.c_str(), 
+                container, DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES, NULL);
+
+        REQUIRE( pRingRecordTapBintr->GetMaxBytes() == DSL_DEFAULT_RING_RECORD_TAP_MAX_BYTES );
+        REQUIRE( pRingRecordTapBintr->IsOn() == false );
+        REQUIRE( pRingRecordTapBintr->IsLinked() == false );
+
+        WHEN( "The RingRecordTapBintr is Linked" )
+        {
+            REQUIRE( pRingRecordTapBintr->LinkAll() == true );
+
+            THEN( "A session can't start until a keyframe is received" )
+            {
+                REQUIRE( pRingRecordTapBintr->IsLinked() == true );
+                
+                uint session(99);
+                REQUIRE( pRingRecordTapBintr->StartSession(&session, 10, 10, NULL) == false );
+                REQUIRE( pRingRecordTapBintr->StopSession() == false );
+                
+                pRingRecordTapBintr->UnlinkAll();
+                REQUIRE( pRingRecordTapBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new FileTapBintr is created correctly and can LinkAll/UnlinkAll", "[FileTapBintr]" )
+{
+    GIVEN( "Attributes for a new FileTapBintr" ) 
+    {
+        std::string fileTapName("file-tap");
+        std::string filePath("./file-tap-test.mkv");
+
+        DSL_FILE_TAP_PTR pFileTapBintr = DSL_FILE_TAP_NEW(fileTapName.c_str(), 
+            filePath.c_str(), DSL_CODEC_H265, DSL_CONTAINER_MKV);
+
+        uint retCodec(99), retContainer(99);
+        pFileTapBintr->GetVideoFormats(&retCodec, &retContainer);
+        REQUIRE( retCodec == DSL_CODEC_H265 );
+        REQUIRE( retContainer == DSL_CONTAINER_MKV );
+        REQUIRE( pFileTapBintr->IsLinked() == false );
+
+        WHEN( "The FileTapBintr is Linked" )
+        {
+            REQUIRE( pFileTapBintr->LinkAll() == true );
+
+            THEN( "The FileTapBintr's IsLinked state is updated correctly" )
+            {
+                REQUIRE( pFileTapBintr->IsLinked() == true );
+                pFileTapBintr->UnlinkAll();
+                REQUIRE( pFileTapBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A FileTapBintr drops delta frames until the first keyframe", "[FileTapBintr]" )
+{
+    GIVEN( "A new FileTapBintr" ) 
+    {
+        std::string fileTapName("file-tap");
+        std::string filePath("./file-tap-test.mp4");
+
+        DSL_FILE_TAP_PTR pFileTapBintr = DSL_FILE_TAP_NEW(fileTapName.c_str(), 
+            filePath.c_str(), DSL_CODEC_H264, DSL_CONTAINER_MP4);
+
+        WHEN( "Delta frames are received before and after a keyframe" )
+        {
+            GstBuffer* pDeltaFrame = gst_buffer_new();
+            GST_BUFFER_FLAG_SET(pDeltaFrame, GST_BUFFER_FLAG_DELTA_UNIT);
+            GstBuffer* pKeyFrame = gst_buffer_new();
+
+            THEN( "Only the leading delta frames are dropped" )
+            {
+                REQUIRE( pFileTapBintr->HandleBuffer(pDeltaFrame) == GST_PAD_PROBE_DROP );
+                REQUIRE( pFileTapBintr->HandleBuffer(pKeyFrame) == GST_PAD_PROBE_OK );
+                REQUIRE( pFileTapBintr->HandleBuffer(pDeltaFrame) == GST_PAD_PROBE_OK );
+                gst_buffer_unref(pDeltaFrame);
+                gst_buffer_unref(pKeyFrame);
+            }
+        }
+    }
+}
+
+SCENARIO( "A new RtspTapBintr is created correctly and can LinkAll/UnlinkAll", "[RtspTapBintr]" )
+{
+    GIVEN( "Attributes for a new RtspTapBintr" ) 
+    {
+        std::string rtspTapName("rtsp-tap");
+        std::string host("224.224.255.255");
+        uint udpPort(5400), rtspPort(8554);
+
+        DSL_RTSP_TAP_PTR pRtspTapBintr = DSL_RTSP_TAP_NEW(rtspTapName.c_str(), 
+            host.c_str(), udpPort, rtspPort, DSL_CODEC_H264);
+
+        uint retUdpPort(0), retRtspPort(0), retCodec(99);
+        pRtspTapBintr->GetServerSettings(&retUdpPort, &retRtspPort, &retCodec);
+        REQUIRE( retUdpPort == udpPort );
+        REQUIRE( retRtspPort == rtspPort );
+        REQUIRE( retCodec == DSL_CODEC_H264 );
+        REQUIRE( pRtspTapBintr->IsLinked() == false );
+
+        WHEN( "The RtspTapBintr is Linked" )
+        {
+            REQUIRE( pRtspTapBintr->LinkAll() == true );
+
+            THEN( "The RtspTapBintr's IsLinked state is updated correctly" )
+            {
+                REQUIRE( pRtspTapBintr->IsLinked() == true );
+                pRtspTapBintr->UnlinkAll();
+                REQUIRE( pRtspTapBintr->IsLinked() == false );
+            }
+        }
+    }
+}
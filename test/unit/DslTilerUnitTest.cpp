@@ -132,6 +132,67 @@ SCENARIO( "A TilerBintr can Get and Set its Show Source setting",  "[TilerBintr]
     }
 }
 
+SCENARIO( "A TilerBintr with frame-pruning enabled prunes the frames of hidden sources",  "[TilerBintr]" )
+{
+    GIVEN( "A new TilerBintr and a batch of four frames" ) 
+    {
+        std::string tilerName = "tiled-display";
+        uint width(1280);
+        uint height(720);
+        uint batchSize(4);
+
+        DSL_TILER_PTR pTilerBintr = 
+            DSL_TILER_NEW(tilerName.c_str(), width, height);
+        REQUIRE( pTilerBintr->SetBatchSize(batchSize) );
+        REQUIRE( pTilerBintr->GetFramePruningEnabled() == false );
+
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(batchSize, 1);
+        for (uint i = 0; i < batchSize; i++)
+        {
+            NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+            pFrameMeta->source_id = i;
+            pFrameMeta->batch_id = i;
+            nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+        }
+        
+        WHEN( "All sources are shown" )
+        {
+            pTilerBintr->SetFramePruningEnabled(true);
+            
+            THEN( "No frames are pruned" )
+            {
+                REQUIRE( pTilerBintr->PruneHiddenFrames(pBatchMeta) == 0 );
+                REQUIRE( g_list_length(pBatchMeta->frame_meta_list) == batchSize );
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+        }
+        WHEN( "A single source is shown with frame-pruning disabled" )
+        {
+            REQUIRE( pTilerBintr->SetShowSource(2, 0, true) == true );
+            
+            THEN( "No frames are pruned" )
+            {
+                REQUIRE( pTilerBintr->PruneHiddenFrames(pBatchMeta) == 0 );
+                REQUIRE( g_list_length(pBatchMeta->frame_meta_list) == batchSize );
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+        }
+        WHEN( "A single source is shown with frame-pruning enabled" )
+        {
+            REQUIRE( pTilerBintr->SetShowSource(2, 0, true) == true );
+            pTilerBintr->SetFramePruningEnabled(true);
+            
+            THEN( "Only the frame of the shown source remains" )
+            {
+                REQUIRE( pTilerBintr->PruneHiddenFrames(pBatchMeta) == batchSize-1 );
+                REQUIRE( g_list_length(pBatchMeta->frame_meta_list) == 1 );
+                REQUIRE( ((NvDsFrameMeta*)pBatchMeta->frame_meta_list->data)->source_id == 2 );
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+        }
+    }
+}
+
 SCENARIO( "A TilerBintr can Get and Set its GPU ID",  "[TilerBintr]" )
 {
     GIVEN( "A new TilerBintr in memory" ) 
@@ -114,3 +114,159 @@ SCENARIO( "A Tracker's dimensions can be updated", "[TrackerBintr]" )
 
 
 
+SCENARIO( "A CPU IOU Tracker is created correctly", "[TrackerBintr]" )
+{
+    GIVEN( "Attributes for a new CPU IOU Tracker" ) 
+    {
+        std::string trackerName("cpu-iou-tracker");
+        uint maxAge(5);
+        float iouThreshold(0.4);
+        uint maxTracks(16);
+
+        WHEN( "The CPU IOU Tracker is created" )
+        {
+            DSL_CPU_IOU_TRACKER_PTR pTrackerBintr = DSL_CPU_IOU_TRACKER_NEW(
+                trackerName.c_str(), maxAge, iouThreshold, maxTracks);
+
+            THEN( "The CPU IOU Tracker's settings are returned correctly")
+            {
+                uint retMaxAge(0), retMaxTracks(0);
+                float retIouThreshold(0);
+                
+                pTrackerBintr->GetSettings(&retMaxAge, &retIouThreshold, &retMaxTracks);
+                REQUIRE( retMaxAge == maxAge );
+                REQUIRE( retIouThreshold == iouThreshold );
+                REQUIRE( retMaxTracks == maxTracks );
+                REQUIRE( pTrackerBintr->GetNumActiveTracks() == 0 );
+                
+                std::string retLibPathSpec(pTrackerBintr->GetLibFile());
+                REQUIRE( retLibPathSpec == "" );
+                
+                // invalid settings are rejected
+                REQUIRE( pTrackerBintr->SetSettings(maxAge, 0.0, maxTracks) == false );
+                REQUIRE( pTrackerBintr->SetSettings(maxAge, iouThreshold, 0) == false );
+                REQUIRE( pTrackerBintr->SetMaxDimensions(300, 150) == false );
+                REQUIRE( pTrackerBintr->SetGpuId(1) == false );
+                REQUIRE( pTrackerBintr->GetGpuId() == 0 );
+            }
+        }
+    }
+}
+
+static NvDsBatchMeta* CreateTrackerTestBatchMeta(uint sourceId, 
+    std::vector<std::vector<float>> boxes)
+{
+    NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1, 1);
+    NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+    pFrameMeta->source_id = sourceId;
+    nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+    
+    for (auto const& box: boxes)
+    {
+        NvDsObjectMeta* pObjectMeta = nvds_acquire_obj_meta_from_pool(pBatchMeta);
+        pObjectMeta->class_id = 0;
+        pObjectMeta->object_id = UNTRACKED_OBJECT_ID;
+        pObjectMeta->rect_params.left = box[0];
+        pObjectMeta->rect_params.top = box[1];
+        pObjectMeta->rect_params.width = box[2];
+        pObjectMeta->rect_params.height = box[3];
+        nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+    }
+    return pBatchMeta;
+}
+
+static guint64 GetTrackerTestObjectId(NvDsBatchMeta* pBatchMeta, uint index)
+{
+    NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)pBatchMeta->frame_meta_list->data;
+    NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list;
+    
+    for (uint i = 0; i < index; i++)
+    {
+        pObjectMetaList = pObjectMetaList->next;
+    }
+    return ((NvDsObjectMeta*)pObjectMetaList->data)->object_id;
+}
+
+SCENARIO( "A CPU IOU Tracker assigns and maintains object ids across frames", "[TrackerBintr]" )
+{
+    GIVEN( "A new CPU IOU Tracker with two tracked objects" ) 
+    {
+        std::string trackerName("cpu-iou-tracker");
+        uint maxAge(2);
+
+        DSL_CPU_IOU_TRACKER_PTR pTrackerBintr = DSL_CPU_IOU_TRACKER_NEW(
+            trackerName.c_str(), maxAge, 0.3, 2);
+
+        NvDsBatchMeta* pBatchMeta = CreateTrackerTestBatchMeta(0, 
+            {{100, 100, 50, 50}, {300, 300, 50, 50}});
+        REQUIRE( pTrackerBintr->TrackObjects(pBatchMeta) == 2 );
+        guint64 firstId = GetTrackerTestObjectId(pBatchMeta, 0);
+        guint64 secondId = GetTrackerTestObjectId(pBatchMeta, 1);
+        REQUIRE( firstId != UNTRACKED_OBJECT_ID );
+        REQUIRE( secondId != UNTRACKED_OBJECT_ID );
+        REQUIRE( firstId != secondId );
+        REQUIRE( pTrackerBintr->GetNumActiveTracks() == 2 );
+        nvds_destroy_batch_meta(pBatchMeta);
+        
+        WHEN( "The objects move slightly, in reverse order" )
+        {
+            pBatchMeta = CreateTrackerTestBatchMeta(0, 
+                {{305, 302, 50, 50}, {104, 98, 50, 50}});
+            
+            THEN( "Each object is matched with its existing track" )
+            {
+                REQUIRE( pTrackerBintr->TrackObjects(pBatchMeta) == 2 );
+                REQUIRE( GetTrackerTestObjectId(pBatchMeta, 0) == secondId );
+                REQUIRE( GetTrackerTestObjectId(pBatchMeta, 1) == firstId );
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+        }
+        WHEN( "A new object is seen while the track pool is full" )
+        {
+            pBatchMeta = CreateTrackerTestBatchMeta(0, 
+                {{100, 100, 50, 50}, {300, 300, 50, 50}, {600, 100, 50, 50}});
+            
+            THEN( "The new object is left untracked" )
+            {
+                REQUIRE( pTrackerBintr->TrackObjects(pBatchMeta) == 2 );
+                REQUIRE( GetTrackerTestObjectId(pBatchMeta, 2) == UNTRACKED_OBJECT_ID );
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+        }
+        WHEN( "The same boxes are seen from a different source" )
+        {
+            pBatchMeta = CreateTrackerTestBatchMeta(1, 
+                {{100, 100, 50, 50}, {300, 300, 50, 50}});
+            
+            THEN( "The objects are assigned new ids" )
+            {
+                REQUIRE( pTrackerBintr->TrackObjects(pBatchMeta) == 2 );
+                REQUIRE( GetTrackerTestObjectId(pBatchMeta, 0) != firstId );
+                REQUIRE( GetTrackerTestObjectId(pBatchMeta, 1) != secondId );
+                REQUIRE( pTrackerBintr->GetNumActiveTracks() == 4 );
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+        }
+        WHEN( "An object goes unmatched for more than the max age" )
+        {
+            for (uint i = 0; i <= maxAge; i++)
+            {
+                pBatchMeta = CreateTrackerTestBatchMeta(0, {{100, 100, 50, 50}});
+                REQUIRE( pTrackerBintr->TrackObjects(pBatchMeta) == 1 );
+                REQUIRE( GetTrackerTestObjectId(pBatchMeta, 0) == firstId );
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+            THEN( "Its track is removed and a returning object gets a new id" )
+            {
+                REQUIRE( pTrackerBintr->GetNumActiveTracks() == 1 );
+                
+                pBatchMeta = CreateTrackerTestBatchMeta(0, 
+                    {{100, 100, 50, 50}, {300, 300, 50, 50}});
+                REQUIRE( pTrackerBintr->TrackObjects(pBatchMeta) == 2 );
+                REQUIRE( GetTrackerTestObjectId(pBatchMeta, 0) == firstId );
+                REQUIRE( GetTrackerTestObjectId(pBatchMeta, 1) != secondId );
+                nvds_destroy_batch_meta(pBatchMeta);
+            }
+        }
+    }
+}